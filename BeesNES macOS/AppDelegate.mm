@@ -7,7 +7,6 @@
 
 #include "../Src/LSNLSpiroNes.h"
 #include "../Src/Audio/LSNAudio.h"
-#include "../Src/Database/LSNDatabase.h"
 
 #import "AppDelegate.h"
 
@@ -18,14 +17,12 @@
 @implementation AppDelegate
 
 - (void)applicationDidFinishLaunching:(NSNotification *)aNotification {
-    lsn::CDatabase::Init();
     lsn::CAudio::InitializeAudio();
 }
 
 
 - (void)applicationWillTerminate:(NSNotification *)aNotification {
     lsn::CAudio::ShutdownAudio();
-    lsn::CDatabase::Reset();
 }
 
 
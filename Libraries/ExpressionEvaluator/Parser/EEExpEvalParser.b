@@ -102,6 +102,8 @@ extern int yylex( /*YYSTYPE*/void * _pvNodeUnion, ee::CExpEvalLexer * _peelLexer
 
 %token EE_ARANGE EE_FULL EE_FULL_LIKE EE_GEOMSPACE EE_LINSPACE EE_LOGSPACE EE_ONES EE_ONES_LIKE EE_ZEROS EE_ZEROS_LIKE
 
+%token EE_CONVOLVE EE_DIV EE_RESAMPLE EE_RMS
+
 %type <sStringIndex>										identifier
 %type <sStringIndex>										string
 %type <sStringIndex>										custom_var
@@ -821,6 +823,20 @@ intrinsic
 	| EE_SUM '(' exp ')'									{ m_peecContainer->CreateVectorSum( $3, $$ ); }
 	| EE_SWAP '(' exp ',' exp ')'							{ m_peecContainer->CreateVectorSwap( $3, $5, $$ ); }
 	| custom_var '.' EE_SWAP '(' exp ')'					{ m_peecContainer->CreateVectorSwap( $1, $5, $$ ); }
+	| array_var '.' EE_ADD '(' exp ')'						{ m_peecContainer->CreateArrayApply( $1, token::EE_ADD, $5, $$ ); }
+	| array_var '.' EE_ADD '(' array_var ')'				{ m_peecContainer->CreateArrayApply( $1, token::EE_ADD, $5, $$ ); }
+	| array_var '.' EE_CONVOLVE '(' array_var ',' array_var ')'	{ m_peecContainer->CreateArrayConvolve( $1, $5, $7, $$ ); }
+	| array_var '.' EE_DIV '(' exp ')'						{ m_peecContainer->CreateArrayApply( $1, token::EE_DIV, $5, $$ ); }
+	| array_var '.' EE_DIV '(' array_var ')'				{ m_peecContainer->CreateArrayApply( $1, token::EE_DIV, $5, $$ ); }
+	| array_var '.' EE_MAX '(' ')'							{ m_peecContainer->CreateArrayReduce( $1, token::EE_MAX, $$ ); }
+	| array_var '.' EE_MIN '(' ')'							{ m_peecContainer->CreateArrayReduce( $1, token::EE_MIN, $$ ); }
+	| array_var '.' EE_MUL '(' exp ')'						{ m_peecContainer->CreateArrayApply( $1, token::EE_MUL, $5, $$ ); }
+	| array_var '.' EE_MUL '(' array_var ')'				{ m_peecContainer->CreateArrayApply( $1, token::EE_MUL, $5, $$ ); }
+	| array_var '.' EE_RESAMPLE '(' exp ',' array_var ')'	{ m_peecContainer->CreateArrayResample( $1, $5, $7, $$ ); }
+	| array_var '.' EE_RMS '(' ')'							{ m_peecContainer->CreateArrayReduce( $1, token::EE_RMS, $$ ); }
+	| array_var '.' EE_SUB '(' exp ')'						{ m_peecContainer->CreateArrayApply( $1, token::EE_SUB, $5, $$ ); }
+	| array_var '.' EE_SUB '(' array_var ')'				{ m_peecContainer->CreateArrayApply( $1, token::EE_SUB, $5, $$ ); }
+	| array_var '.' EE_SUM '(' ')'							{ m_peecContainer->CreateArrayReduce( $1, token::EE_SUM, $$ ); }
 	| EE_TOKENIZE '(' exp ',' exp ',' exp ')'				{ m_peecContainer->CreateStringTokenize( $3, $5, $7, $$ ); }
 	| EE_TOKENIZE '(' string ',' exp ',' exp ')'			{ m_peecContainer->CreateStringTokenize( $3, $5, $7, $$ ); }
 	
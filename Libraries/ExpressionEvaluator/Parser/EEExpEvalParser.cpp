@@ -3095,221 +3095,291 @@ namespace yy {
 
   case 530:
 
-    { m_peecContainer->CreateStringTokenize( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_ADD, (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 531:
 
-    { m_peecContainer->CreateStringTokenize( (yysemantic_stack_[(8) - (3)].sStringIndex), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_ADD, (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
   case 532:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BARTHANN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayConvolve( (yysemantic_stack_[(8) - (1)].sStringIndex), (yysemantic_stack_[(8) - (5)].sStringIndex), (yysemantic_stack_[(8) - (7)].sStringIndex), (yyval.ndData) ); }
     break;
 
   case 533:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BARTLETT, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_DIV, (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 534:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BLACKMAN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_DIV, (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
   case 535:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BLACKMANHARRIS, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayReduce( (yysemantic_stack_[(5) - (1)].sStringIndex), token::EE_MAX, (yyval.ndData) ); }
     break;
 
   case 536:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BLACKMANNUTTAL, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayReduce( (yysemantic_stack_[(5) - (1)].sStringIndex), token::EE_MIN, (yyval.ndData) ); }
     break;
 
   case 537:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BOHMAN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_MUL, (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 538:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BOXCAR, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_MUL, (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
   case 539:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_CHEBWIN, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayResample( (yysemantic_stack_[(8) - (1)].sStringIndex), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].sStringIndex), (yyval.ndData) ); }
     break;
 
   case 540:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_COSINE, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayReduce( (yysemantic_stack_[(5) - (1)].sStringIndex), token::EE_RMS, (yyval.ndData) ); }
     break;
 
   case 541:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_EXPONENTIAL, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_SUB, (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 542:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_FLATTOP, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayApply( (yysemantic_stack_[(6) - (1)].sStringIndex), token::EE_SUB, (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
   case 543:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GAUSSIAN, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateArrayReduce( (yysemantic_stack_[(5) - (1)].sStringIndex), token::EE_SUM, (yyval.ndData) ); }
     break;
 
   case 544:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GENERAL_COSINE, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateStringTokenize( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
     break;
 
   case 545:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GENERAL_GAUSSIAN, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateStringTokenize( (yysemantic_stack_[(8) - (3)].sStringIndex), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
     break;
 
   case 546:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GENERAL_HAMMING, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BARTHANN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 547:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_HANN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BARTLETT, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 548:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_HAMMING, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BLACKMAN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 549:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_KAISER, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BLACKMANHARRIS, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 550:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_KAISER_BESSEL, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BLACKMANNUTTAL, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 551:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_LANCZOS, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BOHMAN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 552:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_NUTTAL, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_BOXCAR, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 553:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_PARZEN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_CHEBWIN, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 554:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_TAYLOR, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_COSINE, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 555:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_TRIANG, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_EXPONENTIAL, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
     break;
 
   case 556:
 
-    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_TUKEY, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_FLATTOP, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 557:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOID_1 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GAUSSIAN, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 558:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOID_2 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GENERAL_COSINE, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 559:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOIDSTRIDED_4 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GENERAL_GAUSSIAN, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
     break;
 
   case 560:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOIDSTRIDED_5 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_GENERAL_HAMMING, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 561:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(4) - (3)].ndData),(yyval.ndData), ee::EE_N_SIMPSON_1 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_HANN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 562:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData), ee::EE_N_SIMPSON_2 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_HAMMING, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 563:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), (yyval.ndData), ee::EE_N_SIMPSONSTRIDED_4 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_KAISER, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 564:
 
-    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ndData), (yyval.ndData), ee::EE_N_SIMPSONSTRIDED_5 ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_KAISER_BESSEL, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 565:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_2, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_LANCZOS, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 566:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_3, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_NUTTAL, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 567:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_4, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_PARZEN, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 568:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_2, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ui32Backing), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_TAYLOR, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), (yyval.ndData) ); }
     break;
 
   case 569:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_3, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ui32Backing), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_TRIANG, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
   case 570:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_4, ee::CVector>( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ui32Backing), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicObjectNode<ee::EE_N_TUKEY, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData) ); }
     break;
 
   case 571:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ARANGE, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ui32Backing), (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOID_1 ); }
     break;
 
   case 572:
 
-    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ARANGE, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOID_2 ); }
     break;
 
   case 573:
 
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOIDSTRIDED_4 ); }
+    break;
+
+  case 574:
+
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ndData), (yyval.ndData), ee::EE_N_TRAPEZOIDSTRIDED_5 ); }
+    break;
+
+  case 575:
+
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(4) - (3)].ndData),(yyval.ndData), ee::EE_N_SIMPSON_1 ); }
+    break;
+
+  case 576:
+
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), (yyval.ndData), ee::EE_N_SIMPSON_2 ); }
+    break;
+
+  case 577:
+
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), (yyval.ndData), ee::EE_N_SIMPSONSTRIDED_4 ); }
+    break;
+
+  case 578:
+
+    { m_peecContainer->CreateBasicNode( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ndData), (yyval.ndData), ee::EE_N_SIMPSONSTRIDED_5 ); }
+    break;
+
+  case 579:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_2, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    break;
+
+  case 580:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_3, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    break;
+
+  case 581:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_4, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    break;
+
+  case 582:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_2, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ui32Backing), (yyval.ndData) ); }
+    break;
+
+  case 583:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_3, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ui32Backing), (yyval.ndData) ); }
+    break;
+
+  case 584:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LINSPACE_4, ee::CVector>( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ui32Backing), (yyval.ndData) ); }
+    break;
+
+  case 585:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ARANGE, ee::CVector>( (yysemantic_stack_[(10) - (3)].ndData), (yysemantic_stack_[(10) - (5)].ndData), (yysemantic_stack_[(10) - (7)].ndData), (yysemantic_stack_[(10) - (9)].ui32Backing), (yyval.ndData) ); }
+    break;
+
+  case 586:
+
+    { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ARANGE, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
+    break;
+
+  case 587:
+
     {
 																YYSTYPE::EE_NODE_DATA ndStep;
 																m_peecContainer->CreateDouble( "1.0", ndStep );
@@ -3317,7 +3387,7 @@ namespace yy {
 															}
     break;
 
-  case 574:
+  case 588:
 
     {
 																YYSTYPE::EE_NODE_DATA ndStep;
@@ -3326,7 +3396,7 @@ namespace yy {
 															}
     break;
 
-  case 575:
+  case 589:
 
     {
 																YYSTYPE::EE_NODE_DATA ndStart;
@@ -3337,7 +3407,7 @@ namespace yy {
 															}
     break;
 
-  case 576:
+  case 590:
 
     {
 																YYSTYPE::EE_NODE_DATA ndStart;
@@ -3348,32 +3418,32 @@ namespace yy {
 															}
     break;
 
-  case 577:
+  case 591:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_FULL, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 578:
+  case 592:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_FULL, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 579:
+  case 593:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_FULL_LIKE, ee::CVector>( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (5)].ndData), (yysemantic_stack_[(8) - (7)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 580:
+  case 594:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_FULL_LIKE, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 581:
+  case 595:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_GEOMSPACE, ee::CVector>( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 582:
+  case 596:
 
     {
 																YYSTYPE::EE_NODE_DATA ndBase;
@@ -3382,7 +3452,7 @@ namespace yy {
 															}
     break;
 
-  case 583:
+  case 597:
 
     {
 																YYSTYPE::EE_NODE_DATA ndEndPoint;
@@ -3391,7 +3461,7 @@ namespace yy {
 															}
     break;
 
-  case 584:
+  case 598:
 
     {
 																YYSTYPE::EE_NODE_DATA ndEndPoint;
@@ -3400,7 +3470,7 @@ namespace yy {
 															}
     break;
 
-  case 585:
+  case 599:
 
     {
 																YYSTYPE::EE_NODE_DATA ndNum;
@@ -3411,7 +3481,7 @@ namespace yy {
 															}
     break;
 
-  case 586:
+  case 600:
 
     {
 																YYSTYPE::EE_NODE_DATA ndNum;
@@ -3422,17 +3492,17 @@ namespace yy {
 															}
     break;
 
-  case 587:
+  case 601:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LOGSPACE, ee::CVector>( (yysemantic_stack_[(14) - (3)].ndData), (yysemantic_stack_[(14) - (5)].ndData), (yysemantic_stack_[(14) - (7)].ndData), (yysemantic_stack_[(14) - (9)].ndData), (yysemantic_stack_[(14) - (11)].ndData), (yysemantic_stack_[(14) - (13)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 588:
+  case 602:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_LOGSPACE, ee::CVector>( (yysemantic_stack_[(12) - (3)].ndData), (yysemantic_stack_[(12) - (5)].ndData), (yysemantic_stack_[(12) - (7)].ndData), (yysemantic_stack_[(12) - (9)].ndData), (yysemantic_stack_[(12) - (11)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 589:
+  case 603:
 
     {
 																YYSTYPE::EE_NODE_DATA ndBase;
@@ -3441,7 +3511,7 @@ namespace yy {
 															}
     break;
 
-  case 590:
+  case 604:
 
     {
 																YYSTYPE::EE_NODE_DATA ndBase;
@@ -3450,7 +3520,7 @@ namespace yy {
 															}
     break;
 
-  case 591:
+  case 605:
 
     {
 																YYSTYPE::EE_NODE_DATA ndEndPoint;
@@ -3461,7 +3531,7 @@ namespace yy {
 															}
     break;
 
-  case 592:
+  case 606:
 
     {
 																YYSTYPE::EE_NODE_DATA ndEndPoint;
@@ -3472,7 +3542,7 @@ namespace yy {
 															}
     break;
 
-  case 593:
+  case 607:
 
     {
 																YYSTYPE::EE_NODE_DATA ndNum;
@@ -3485,7 +3555,7 @@ namespace yy {
 															}
     break;
 
-  case 594:
+  case 608:
 
     {
 																YYSTYPE::EE_NODE_DATA ndNum;
@@ -3498,172 +3568,172 @@ namespace yy {
 															}
     break;
 
-  case 595:
+  case 609:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ONES, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 596:
+  case 610:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ONES, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 597:
+  case 611:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ONES_LIKE, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 598:
+  case 612:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ONES_LIKE, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 599:
+  case 613:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ZEROS, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 600:
+  case 614:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ZEROS, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 601:
+  case 615:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ZEROS_LIKE, ee::CVector>( (yysemantic_stack_[(6) - (3)].ndData), (yysemantic_stack_[(6) - (5)].ui32Backing), (yyval.ndData) ); }
     break;
 
-  case 602:
+  case 616:
 
     { m_peecContainer->CreateBasicObjectNode_Ex1<ee::EE_N_ZEROS_LIKE, ee::CVector>( (yysemantic_stack_[(4) - (3)].ndData), CExpEvalParser::token::EE_DEFAULT, (yyval.ndData) ); }
     break;
 
-  case 603:
+  case 617:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 604:
+  case 618:
 
     { (yyval.ndData) = (yysemantic_stack_[(2) - (1)].ndData); }
     break;
 
-  case 605:
+  case 619:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 606:
+  case 620:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 607:
+  case 621:
 
     { (yyval.ndData) = (yysemantic_stack_[(2) - (1)].ndData); }
     break;
 
-  case 608:
+  case 622:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 609:
+  case 623:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 610:
+  case 624:
 
     { m_peecContainer->CreateCompoundStatement( (yysemantic_stack_[(2) - (1)].ndData), (yysemantic_stack_[(2) - (2)].ndData), (yyval.ndData) ); }
     break;
 
-  case 611:
+  case 625:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 612:
+  case 626:
 
     { (yyval.ndData) = (yysemantic_stack_[(1) - (1)].ndData); }
     break;
 
-  case 613:
+  case 627:
 
     { m_peecContainer->CreateCompoundStatement( (yysemantic_stack_[(2) - (1)].ndData), (yysemantic_stack_[(2) - (2)].ndData), (yyval.ndData) ); }
     break;
 
-  case 614:
+  case 628:
 
     { m_peecContainer->CreateForEachDecl( (yysemantic_stack_[(6) - (3)].sStringIndex), (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
-  case 615:
+  case 629:
 
     { m_peecContainer->CreateForEachCustomDecl( (yysemantic_stack_[(6) - (3)].sStringIndex), (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
-  case 616:
+  case 630:
 
     { m_peecContainer->CreateForEachStringDecl( (yysemantic_stack_[(6) - (3)].sStringIndex), (yysemantic_stack_[(6) - (5)].sStringIndex), (yyval.ndData) ); }
     break;
 
-  case 617:
+  case 631:
 
     { m_peecContainer->CreateWhileLoop( (yysemantic_stack_[(7) - (3)].ndData), (yysemantic_stack_[(7) - (6)].ndData), (yyval.ndData) ); }
     break;
 
-  case 618:
+  case 632:
 
     { m_peecContainer->CreateForLoop( (yysemantic_stack_[(8) - (3)].ndData), (yysemantic_stack_[(8) - (4)].ndData), (yysemantic_stack_[(8) - (7)].ndData), (yyval.ndData) ); }
     break;
 
-  case 619:
+  case 633:
 
     { m_peecContainer->CreateForLoop( (yysemantic_stack_[(9) - (3)].ndData), (yysemantic_stack_[(9) - (4)].ndData), (yysemantic_stack_[(9) - (5)].ndData), (yysemantic_stack_[(9) - (8)].ndData), (yyval.ndData) ); }
     break;
 
-  case 620:
+  case 634:
 
     { m_peecContainer->CreateDoWhileLoop( (yysemantic_stack_[(8) - (7)].ndData), (yysemantic_stack_[(8) - (3)].ndData), (yyval.ndData) ); }
     break;
 
-  case 621:
+  case 635:
 
     { m_peecContainer->CreateForEachLoop( (yysemantic_stack_[(4) - (1)].ndData), (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
-  case 622:
+  case 636:
 
     { m_peecContainer->CreateForEachObjLoop( (yysemantic_stack_[(4) - (1)].ndData), (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
-  case 623:
+  case 637:
 
     { m_peecContainer->CreateForEachStrLoop( (yysemantic_stack_[(4) - (1)].ndData), (yysemantic_stack_[(4) - (3)].ndData), (yyval.ndData) ); }
     break;
 
-  case 624:
+  case 638:
 
     { m_peecContainer->CreateSelectionStatement( (yysemantic_stack_[(7) - (3)].ndData), (yysemantic_stack_[(7) - (6)].ndData), (yyval.ndData) ); }
     break;
 
-  case 625:
+  case 639:
 
     { m_peecContainer->CreateSelectionStatement( (yysemantic_stack_[(11) - (3)].ndData), (yysemantic_stack_[(11) - (6)].ndData), (yysemantic_stack_[(11) - (10)].ndData), (yyval.ndData) ); }
     break;
 
-  case 626:
+  case 640:
 
     { m_peecContainer->CreateContinue( (yyval.ndData) ); }
     break;
 
-  case 627:
+  case 641:
 
     { m_peecContainer->CreateBreak( (yyval.ndData) ); }
     break;
 
-  case 628:
+  case 642:
 
     { m_peecContainer->SetTrans( (yysemantic_stack_[(1) - (1)].ndData) ); }
     break;
@@ -3874,172 +3944,176 @@ namespace yy {
 
   /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
      STATE-NUM.  */
-  const short int parser::yypact_ninf_ = -1160;
+  const short int parser::yypact_ninf_ = -1185;
   const short int
   parser::yypact_[] =
   {
-      1313,  -408,  -407,  -398,  -394,  -378, -1160, -1160,  -343, -1160,
-    -354, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160,    27, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160,   218,   218, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160,  -153,  -145,  -103,   -86,   -78,   -65,
-     -55,   -52,   -40,   -35,   -21,    21,    23,    50,    56,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    89,    90,    92,    93,    94,    96,    97,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   108,   109,
-     110,   111,   112,   113,   114,   116,   117,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,   129,
-     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141, -1160, -1160,   160,   161,   163,   164,   165,   166,
-     167,   168,   169,   170,   171,   172,   173,   174, -1160,   175,
-     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   192,   193,   194,   195,   199,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   219,   220,   224,   226,
-     228,   229,   231,   232,   233,   235,   236,   237,   238,   239,
-     241,   242,   243,   244,   245,   246,   251,   252,   254,   255,
-     256,   257,   258,   259,   262,   265,   266,   267,   270,   271,
-     281,   283,   286,   287,   288,   289,   290, -1160, -1160,   -79,
-    5429, -1160, -1160,  2138,   263,    10,  -146,  -389, -1160,   -43,
-   -1160, -1160,  6232,   -95,  -347,   115,   -48,   217,   -22,   234,
-     309,   282,   312,    37, -1160,  5429,   293, -1160,   284, -1160,
-   -1160,  1313, -1160,   291,   292,   295, -1160, -1160,   285,   536,
-    1313,  1313,    27,  5429,  5429,   433,  5429,   294, -1160, -1160,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-     301,   302,   303,   304,   315,   316,   317,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-     -19,   318, -1160, -1160, -1160,    11, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,  5429, -1160,
-      -2,  5429,  5429,  1727,  2962,   465,  6596,  3373,  -354,  5429,
-     -56,   221, -1160,  5429,  5840,  5840,  5840,  5840,  5840,  5840,
-    5840,  5840,  5840,  5840,  5840,  5840,  5840,  5840,  5840,  5840,
-    5840,  5840,  5429,   227,  5840, -1160,   284, -1160,  1313,  1313,
-    1313, -1160, -1160,   313,   284,  1313,   709,   320,   321, -1160,
-     338,   323,  5429,   324,   325,   326,   327,   328,   329,   331,
-     330,   332,   333,   339,   342,   345,   340,   350,   354,   355,
-     346,  -380,   349,   363,   364,   365,   366,   367,   369,   370,
-     371,   376,   373,   381,   382,   384,   386,   383,   388,   397,
-     398,   392,   393,   394,   395,   396,   401,   402,   403,   404,
-     405,   413,   407,   408,   417,   418,   419,   420,   423,   425,
-     426,   428,   429,   430,   431,   432,   434,  -374,   436,   437,
-     438,   441,   442,   440,   443,   444,   445,   446,   447,   448,
-     449,   450,   451,   459,   460,   461,   462,   463,   464,   466,
-     467,   468,   469, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-     470,   471,   472,   473,   474,   475,   476,   477,   478,   458,
-     479,   480,   481,   482,   483,   484,   485,   489,   486,   487,
-     490,   495,   496,   491,   497,   492,   493,   501,   498,   502,
-     503,   499,   504,   500,  -413,   505,   508,   509,   510,   513,
-     514,   515,   516,   511,   517,   512,   520,   518,   519,   522,
-     523,   521,   524,   525,   526,   527,   531,   534,   528,   537,
-     529,  -371,  -370,  -369,   532,   533,   535,   538,   540,  -359,
-    -357,  -126,  -124,   225,   334,  5840, -1160, -1160,  2550,   357,
-     539,   542,   544,   545,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561, -1160,   452,    14,
-   -1160,  5429,    28,   562, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160,  5429,    41,  5429,   488, -1160, -1160,
-   -1160,   -95,   -95,  -347,  -347,   115,   115,   115,   115,   -48,
-     -48,   217,   -22,   234,   309,   282,   435,   191,   563,   564,
-     565,   566,   852,  3784,   -27,   569,   570,   567, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160,  5429, -1160, -1160, -1160,
-   -1160, -1160, -1160,  5429,  5429,  5429,  5429, -1160, -1160,  5429,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160,  5429, -1160, -1160,
-    5429, -1160, -1160, -1160, -1160,  5429, -1160, -1160, -1160,  5429,
-    5429,  5429,  5429,  5429,  5429,  5429,  5429, -1160, -1160, -1160,
-    5429,  5429, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160,  5429, -1160, -1160, -1160,
-   -1160, -1160,  5429,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160,  5429,  5429,  5429,  5429, -1160, -1160,  5429,  5429, -1160,
-    5429,  5429, -1160, -1160, -1160,  5429, -1160,  5429,  5429, -1160,
-    5429, -1160, -1160,  5429, -1160,  5429,  5429,  5429, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160,  5429, -1160,  5429, -1160,  5429,
-    5429,  5429,  5429, -1160, -1160,  5429,  5429, -1160, -1160, -1160,
-    5429, -1160,  5429, -1160,  5429, -1160,  5429, -1160,  4196,  5429,
-    5429,  5429,  5429,  5429, -1160,   347, -1160,   347, -1160,   347,
-   -1160,   347, -1160, -1160, -1160, -1160, -1160,   191,  5429,  5429,
-     568,   576,   577,  5429,   580,   581,   582,   583,  5429,  5429,
-     584,  5429,   585,   586,  5429,   191, -1160, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160,  5429,   588,   572,
-   -1160,  4607,  5840,   595, -1160,  5018,   597, -1160,  5840,  5429,
-   -1160, -1160, -1160, -1160,   596,   591,   598,   599,   600,   601,
-    1313,  1313,  5840,   602,   590,   610,   611,   613,   603,   605,
-     621,   622,   623,   626,   627,   628,   629,   630,   633,   635,
-     631,   636,   632,   638,   640,   641,   643,   644,   645,   646,
-     647,   649,   653,   642,   661,   655,   663,   665,   666,   667,
-     662,   668,   670,   671,   672,   673,   674,   669,   675,   677,
-     676,   679,   680,   678,   681,   684,   686,   682,   687,  -123,
-    -121,   689,  -354,   691,   692,   693,   694,   695,   696,   697,
-     698,   699,  -120,  -118,  -115,  -110,  -109,   -82,   700,   701,
-     702,   703,  5429,   704,   705, -1160, -1160, -1160,   706, -1160,
-   -1160, -1160, -1160,   707,   708, -1160,   710, -1160, -1160,   711,
-    5429,   -67,  5429, -1160, -1160,   712,    37,   713,   714, -1160,
-   -1160,   715, -1160,   312, -1160,  5429,  1313,   716, -1160, -1160,
-   -1160,   634,   637,   718, -1160,  5429,  5429,  5429,  5429, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160,  5429, -1160,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429, -1160, -1160,  5429, -1160, -1160, -1160,
-   -1160,  5429, -1160, -1160, -1160, -1160, -1160, -1160,  5429,  5429,
-   -1160,  5429, -1160, -1160,  5429, -1160, -1160, -1160,  5429, -1160,
-   -1160,  5429, -1160,  5429, -1160, -1160,  4196, -1160,   347, -1160,
-     347, -1160,  4196, -1160,  4196, -1160,  4196, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160,   439,   -62, -1160,  5840, -1160, -1160,   719,   717,  1313,
-     861, -1160, -1160,   722,   724,   725,   726,   727,   721,   723,
-     740,   741,   743,   744,   745,   749,   750,   751,   752,   731,
-     732,   733,   734,   760,   761,   755,   757,   758,   767,   -61,
-     768,   770,   772,   -38,   773,   -37,   774,   -34, -1160, -1160,
-     -33, -1160,   439,    37, -1160, -1160,   769,   771, -1160, -1160,
-   -1160, -1160, -1160,  5429,  5429,  5429,  5429,  5429,  5429,  5429,
-    5429,  5429,  5429,  5429, -1160, -1160, -1160, -1160, -1160, -1160,
-    5429,  5429,  5429, -1160, -1160,   347, -1160, -1160, -1160, -1160,
-    4196, -1160, -1160,  4196, -1160, -1160,  4196, -1160,  5429,   -28,
-   -1160,  1313,   775,   777,   778,   779,   780,   781,   783,   784,
-     782,   785,   786,   787,   -25,   -24,   788,   790,   -23,   791,
-       3,   794,     4,     7, -1160,  5429,   789,  5429, -1160, -1160,
-   -1160, -1160, -1160, -1160, -1160,  5429,  5429,  5429, -1160, -1160,
-    5429, -1160,  5429, -1160, -1160, -1160,   347, -1160, -1160,   347,
-   -1160, -1160,  4196, -1160,  5429,     8, -1160,     9,   796,   797,
-     799,   801,   802,   803,   804,   806,    12,   807, -1160,  5429,
-   -1160,  5429, -1160, -1160, -1160, -1160, -1160, -1160, -1160, -1160,
-   -1160,   347, -1160,   811,   805,   814, -1160,  5429, -1160,   816,
-   -1160
+      1307,  -419,  -410,  -408,  -384,  -373, -1185, -1185,  -372, -1185,
+    -272, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185,   109, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185,   188,   188, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185,  -186,  -171,  -168,  -165,  -163,  -160,
+    -127,  -123,   -94,   -92,   -59,   -29,    -1,    25,    30,    39,
+      47,    80,    88,   100,   106,   107,   108,   110,   111,   112,
+     113,   114,   115,   117,   118,   119,   120,   121,   122,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   157,   158,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+     184,   185, -1185, -1185,   186,   187,   189,   190,   191,   192,
+     194,   196,   197,   198,   199,   200,   201,   202, -1185,   203,
+     204,   205,   208,   210,   211,   212,   213,   215,   216,   217,
+     219,   220,   221,   223,   224,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   236,   237,   238,   239,   240,   241,
+     246,   247,   249,   250,   251,   252,   254,   255,   257,   260,
+     261,   262,   263,   265,   266,   267,   277,   278,   281,   282,
+     283,   285,   286,   287,   290,   291,   292,   293,   296,   297,
+     298,   299,   300,   311,   312,   313,   314,   315,   316,   317,
+     319,   320,   321,   322,   323,   324,   325, -1185, -1185,  -181,
+    5463, -1185, -1185,  2140,   279,  -391,  -147,  -386, -1185,   -42,
+   -1185, -1185,  6274,   102,  -254,   280,   -48,   318,    43,   -40,
+     141,   207,    15,   105, -1185,  5463,   326, -1185,   243, -1185,
+   -1185,  1307, -1185,   328,   329,   332, -1185, -1185,   308,   634,
+    1307,  1307,   109,  5463,  5463,   466,  5463,   284, -1185, -1185,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+     327,   340,   341,   342,   344,   347,   350,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+      55,   352, -1185, -1185, -1185,    75, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,  5463, -1185,
+     123,  5463,  5463,    29,  1725,  2972,   605,  6636,  3387,  -272,
+    5463,   -55,  -170, -1185,  5463,  5878,  5878,  5878,  5878,  5878,
+    5878,  5878,  5878,  5878,  5878,  5878,  5878,  5878,  5878,  5878,
+    5878,  5878,  5878,  5463,   331,  5878, -1185,   243, -1185,  1307,
+    1307,  1307, -1185, -1185,   351,   243,  1307,   774,   358,   359,
+   -1185,   376,   361,  5463,   362,   364,   366,   371,   372,   375,
+     369,   377,   379,   381,   383,   385,   392,   386,   387,   388,
+     389,   397,  -412,   398,   399,   400,   401,   402,   403,   404,
+     405,   408,   409,   406,   410,   414,   415,   418,   413,   421,
+     425,   429,   423,   426,   427,   428,   430,   431,   432,   433,
+     436,   441,   442,   437,   439,   447,   448,   450,   451,   452,
+     454,   455,   456,   457,   458,   459,   460,   464,  -396,   467,
+     468,   469,   470,   471,   465,   472,   473,   474,   475,   476,
+     477,   479,   480,   481,   478,   489,   490,   492,   494,   495,
+     496,   497,   498,   499, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185,   500,   501,   502,   503,   504,   506,   507,   508,   509,
+     486,   505,   510,   512,   511,   513,   514,   515,   516,   517,
+     518,   520,   523,   526,   521,   527,   522,   524,   530,   525,
+     533,   534,   528,   537,   531,  -188,   532,   540,   541,   542,
+     543,   544,   545,   546,   548,   547,   549,   550,   551,   552,
+     553,   554,   557,   562,   556,   558,   564,   566,   567,   561,
+     569,   563,  -371,  -189,  -167,   565,   568,   570,   571,   573,
+    -142,   -99,   -66,   -57,   209,   555,  5878, -1185, -1185,  2556,
+     574,   575,   577,   582,   583,   584,   587,   588,   589,   590,
+     591,   592,   593,   594,   595,   596,   597,   599, -1185,   576,
+     601,   602,   603,   604,   606,   607,   612,   613,   614,   615,
+       2, -1185,  5463,   -39,   616, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185,  5463,    96,  5463,   619, -1185,
+   -1185, -1185,   102,   102,  -254,  -254,   280,   280,   280,   280,
+     -48,   -48,   318,    43,   -40,   141,   207,   407,   289,   617,
+     598,   618,   630,   890,  3802,   253,   632,   635,   620, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185,  5463, -1185, -1185,
+   -1185, -1185, -1185, -1185,  5463,  5463,  5463,  5463, -1185, -1185,
+    5463, -1185, -1185, -1185, -1185, -1185, -1185, -1185,  5463, -1185,
+   -1185,  5463, -1185, -1185, -1185, -1185,  5463, -1185, -1185, -1185,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463, -1185, -1185,
+   -1185,  5463,  5463, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185,  5463, -1185, -1185,
+   -1185, -1185, -1185,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463,  5463,  5463, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185,  5463,  5463,  5463,  5463, -1185, -1185,  5463,  5463,
+   -1185,  5463,  5463, -1185, -1185, -1185,  5463, -1185,  5463,  5463,
+   -1185,  5463, -1185, -1185,  5463, -1185,  5463,  5463,  5463, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185,  5463, -1185,  5463, -1185,
+    5463,  5463,  5463,  5463, -1185, -1185,  5463,  5463, -1185, -1185,
+   -1185,  5463, -1185,  5463, -1185,  5463, -1185,  5463, -1185,  4218,
+    5463,  5463,  5463,  5463,  5463, -1185,   264, -1185,   264, -1185,
+     264, -1185,   264, -1185, -1185, -1185, -1185, -1185,   289,  5463,
+    5463,   621,   622,   639,  5463,   641,   642,   644,   645,  5463,
+    5463,   646,  5463,   647,   648,  5463,   289,   649,   652,  5463,
+    5463,  5463,   654,   853,  5463,  5463,   655, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,  5463,   658,
+     623, -1185,  4633,  5878,   661, -1185,  5048,   662, -1185,  5878,
+    5463, -1185, -1185, -1185, -1185,   663,   656,   664,   667,   669,
+     670,  1307,  1307,  5878,   671,   611,   665,   666,   668,   677,
+     679,   680,   681,   682,   683,   684,   685,   686,   687,   688,
+     689,   690,   691,   692,   693,   694,   695,   696,   697,   698,
+     699,   700,   701,   702,   710,   711,   705,   713,   714,   715,
+     716,   712,   717,   718,   720,   721,   722,   723,   719,   724,
+     725,   727,   728,   729,   730,   732,   735,   738,   733,   739,
+     -56,   -52,   731,  -272,   743,   744,   745,   746,   748,   749,
+     750,   751,   753,   -44,   -43,   -38,   -11,   -10,    -8,   754,
+     755,   756,   757,  5463,   758,   759, -1185, -1185, -1185,   760,
+   -1185, -1185, -1185, -1185,   761,   763, -1185,   764, -1185, -1185,
+     765,  5463, -1185, -1185,  -376,   778,  -184,   779,   -97,   780,
+   -1185,   775,   -61,   781,   776, -1185,    -7,  5463, -1185, -1185,
+     790,   105,   782,   788, -1185, -1185,   793, -1185,    15, -1185,
+    5463,  1307,   786, -1185, -1185, -1185,   787,   789,   792, -1185,
+    5463,  5463,  5463,  5463, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185,  5463, -1185,  5463,  5463,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463, -1185,
+   -1185,  5463, -1185, -1185, -1185, -1185,  5463, -1185, -1185, -1185,
+   -1185, -1185, -1185,  5463,  5463, -1185,  5463, -1185, -1185,  5463,
+   -1185, -1185, -1185,  5463, -1185, -1185,  5463, -1185,  5463, -1185,
+   -1185,  4218, -1185,   264, -1185,   264, -1185,  4218, -1185,  4218,
+   -1185,  4218, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+   -1185,   853, -1185, -1185,   853, -1185,   493,    -5, -1185,  5878,
+   -1185, -1185,   796,   795,  1307,   897, -1185, -1185,   798,   799,
+     802,   803,   805,   800,   801,   804,   806,   807,   808,   809,
+     810,   811,   812,   813,   821,   822,   823,   824,   825,   826,
+     820,   827,   829,   828,     3,   830,   832,   837,     8,   838,
+       9,   839,    11,   840,   844, -1185, -1185,    12, -1185,   493,
+     105, -1185, -1185,   841,   845, -1185, -1185, -1185, -1185, -1185,
+    5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,  5463,
+    5463, -1185, -1185, -1185, -1185, -1185, -1185,  5463,  5463,  5463,
+   -1185, -1185,   264, -1185, -1185, -1185, -1185,  4218, -1185, -1185,
+    4218, -1185, -1185,  4218, -1185, -1185, -1185,  5463,    13, -1185,
+    1307,   842,   851,   852,   854,   855,   856,   857,   859,   846,
+     858,   860,   861,    14,    23,   862,   863,    27,   864,    32,
+     866,    67,    68, -1185,  5463,   865,  5463, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185,  5463,  5463,  5463, -1185, -1185,  5463,
+   -1185,  5463, -1185, -1185, -1185,   264, -1185, -1185,   264, -1185,
+   -1185,  4218, -1185,  5463,    69, -1185,    77,   868,   869,   870,
+     872,   873,   874,   876,   878,    78,   879, -1185,  5463, -1185,
+    5463, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185, -1185,
+     264, -1185,   880,   875,   881, -1185,  5463, -1185,   883, -1185
   };
 
   /* YYDEFACT[S] -- default rule to reduce with in state S when YYTABLE
@@ -4048,7 +4122,7 @@ namespace yy {
   const unsigned short int
   parser::yydefact_[] =
   {
-         0,     0,     0,     0,     0,     0,   627,   626,     0,   367,
+         0,     0,     0,     0,     0,     0,   641,   640,     0,   367,
      366,   368,   369,   370,   371,   358,   359,   360,   361,   362,
      363,   364,   365,     0,    26,    27,    19,    20,    21,     5,
       18,    22,    23,    25,    24,     4,     3,     2,     9,    17,
@@ -4085,8 +4159,8 @@ namespace yy {
        0,     0,     0,     0,     0,     0,     0,   270,   271,     0,
        0,   272,   273,     0,     7,     0,     0,     6,   155,   262,
      266,   274,     0,   278,   281,   284,   289,   292,   294,   296,
-     298,   300,   302,   315,   603,     0,     0,   154,   611,   608,
-     609,   612,   628,     0,     0,     0,   605,   606,     0,     0,
+     298,   300,   302,   315,   617,     0,     0,   154,   625,   622,
+     623,   626,   642,     0,     0,     0,   619,   620,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,   263,   264,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4108,10 +4182,12 @@ namespace yy {
        0,     0,   317,   333,   334,     0,   156,   157,   305,   306,
      307,   308,   309,   310,   311,   312,   313,   314,     0,   304,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       7,     0,   265,     0,     0,     0,     0,     0,     0,     0,
+       0,     7,     0,   265,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   618,   627,   624,     0,
+       0,     0,   621,     1,     0,     0,     0,     0,     0,     0,
+     366,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   604,   613,   610,     0,     0,
-       0,   607,     1,     0,     0,     0,     0,     0,     0,   366,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4119,108 +4195,110 @@ namespace yy {
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   470,   471,   472,   473,   474,   475,
+     476,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   470,   471,   472,   473,   474,   475,   476,
+       0,     0,     0,     0,     0,     6,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     6,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     7,     0,     0,   152,   316,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   320,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   319,     0,     0,     0,   160,   159,   158,   168,   180,
+     197,   170,   195,   181,   178,   190,   176,   175,   182,   186,
+     202,   161,   193,   166,   199,   165,   171,   163,   172,   192,
+     167,   183,   177,   200,   169,   174,   194,   173,   196,   162,
+     188,   191,   201,   179,   189,   198,   187,   184,   185,   164,
+     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,     0,     0,     0,     0,   275,
+     276,   277,   279,   280,   283,   282,   288,   287,   286,   285,
+     290,   291,   293,   295,   297,   299,   301,     0,   153,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   481,
+     321,   377,   378,   379,   380,   381,   382,     0,   384,   385,
+     386,   387,   388,   389,     0,     0,     0,     0,   394,   395,
+       0,   397,   398,   399,   400,   401,   402,   403,     0,   405,
+     406,     0,   408,   409,   410,   411,     0,   413,   414,   415,
+       0,     0,     0,     0,     0,     0,     0,     0,   424,   425,
+     426,     0,     0,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,     0,   443,   446,
+     447,   448,   449,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   460,   461,   462,   463,   464,   465,   466,
+     467,   468,   469,   477,   478,   479,   480,   482,   483,   484,
+     485,   486,     0,     0,     0,     0,   494,   496,     0,     0,
+     500,     0,     0,   505,   507,   509,     0,   512,     0,     0,
+     518,     0,   522,   524,     0,   527,     0,     0,     0,   546,
+     547,   548,   549,   550,   551,   552,     0,   554,     0,   556,
+       0,     0,     0,     0,   562,   561,     0,     0,   565,   566,
+     567,     0,   569,     0,   575,     0,   571,     0,   590,     0,
+       0,     0,     0,     0,     0,   610,     0,   612,     0,   614,
+       0,   616,     0,    10,    16,   267,   318,   335,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    11,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   357,   356,   355,
+     347,   348,   349,   350,   351,   352,   353,   354,     0,     0,
+       0,    12,     0,     0,     0,   258,     0,     0,   153,     0,
+       0,   268,   635,   636,   637,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     7,     0,     0,   152,   316,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   320,     0,     0,
-     319,     0,     0,     0,   160,   159,   158,   168,   180,   197,
-     170,   195,   181,   178,   190,   176,   175,   182,   186,   202,
-     161,   193,   166,   199,   165,   171,   163,   172,   192,   167,
-     183,   177,   200,   169,   174,   194,   173,   196,   162,   188,
-     191,   201,   179,   189,   198,   187,   184,   185,   164,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
-     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,     0,     0,     0,     0,   275,   276,
-     277,   279,   280,   283,   282,   288,   287,   286,   285,   290,
-     291,   293,   295,   297,   299,   301,     0,   153,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   481,   321,
-     377,   378,   379,   380,   381,   382,     0,   384,   385,   386,
-     387,   388,   389,     0,     0,     0,     0,   394,   395,     0,
-     397,   398,   399,   400,   401,   402,   403,     0,   405,   406,
-       0,   408,   409,   410,   411,     0,   413,   414,   415,     0,
-       0,     0,     0,     0,     0,     0,     0,   424,   425,   426,
-       0,     0,   429,   430,   431,   432,   433,   434,   435,   436,
-     437,   438,   439,   440,   441,   442,     0,   443,   446,   447,
-     448,   449,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   460,   461,   462,   463,   464,   465,   466,   467,
-     468,   469,   477,   478,   479,   480,   482,   483,   484,   485,
-     486,     0,     0,     0,     0,   494,   496,     0,     0,   500,
-       0,     0,   505,   507,   509,     0,   512,     0,     0,   518,
-       0,   522,   524,     0,   527,     0,     0,     0,   532,   533,
-     534,   535,   536,   537,   538,     0,   540,     0,   542,     0,
-       0,     0,     0,   548,   547,     0,     0,   551,   552,   553,
-       0,   555,     0,   561,     0,   557,     0,   576,     0,     0,
-       0,     0,     0,     0,   596,     0,   598,     0,   600,     0,
-     602,     0,    10,    16,   267,   318,   335,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    11,   357,   356,   355,   347,
-     348,   349,   350,   351,   352,   353,   354,     0,     0,     0,
-      12,     0,     0,     0,   258,     0,     0,   153,     0,     0,
-     268,   621,   622,   623,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   356,   355,   347,   348,   349,   350,   351,   352,
+     353,   354,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   495,   497,   501,     0,
+     506,   508,   510,   513,     0,     0,   519,     0,   523,   525,
+       0,     0,   535,   536,     0,     0,     0,     0,     0,     0,
+     543,     0,     0,     0,     0,   540,     0,     0,    15,    14,
+       0,   374,   376,     0,   261,   260,     0,    11,   303,   332,
+       0,     0,     0,   629,   628,   630,     0,     0,     0,   383,
+       0,     0,     0,     0,   396,   404,   407,   412,   416,   417,
+     418,   419,   420,   421,   422,   423,     0,   428,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   488,
+     489,     0,   492,   498,   499,   502,     0,   511,   514,   516,
+     520,   526,   528,     0,     0,   553,     0,   557,   558,     0,
+     560,   563,   564,     0,   570,   576,     0,   572,     0,   589,
+     588,     0,   592,     0,   594,     0,   600,     0,   579,     0,
+     608,     0,   609,   611,   613,   615,   330,   490,   493,   503,
+     515,   517,   521,   529,   331,   531,   530,   538,   537,   542,
+     541,     0,   534,   533,     0,   326,     0,     0,    13,     0,
+     487,   259,     0,     0,     0,   638,   631,   269,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   356,   355,   347,   348,   349,   350,   351,   352,   353,
-     354,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   495,   497,   501,     0,   506,
-     508,   510,   513,     0,     0,   519,     0,   523,   525,     0,
-       0,     0,     0,    15,    14,     0,   374,   376,     0,   261,
-     260,     0,    11,   303,   332,     0,     0,     0,   615,   614,
-     616,     0,     0,     0,   383,     0,     0,     0,     0,   396,
-     404,   407,   412,   416,   417,   418,   419,   420,   421,   422,
-     423,     0,   428,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   488,   489,     0,   492,   498,   499,
-     502,     0,   511,   514,   516,   520,   526,   528,     0,     0,
-     539,     0,   543,   544,     0,   546,   549,   550,     0,   556,
-     562,     0,   558,     0,   575,   574,     0,   578,     0,   580,
-       0,   586,     0,   565,     0,   594,     0,   595,   597,   599,
-     601,   330,   490,   493,   503,   515,   517,   521,   529,   331,
-     326,     0,     0,    13,     0,   487,   259,     0,     0,     0,
-     624,   617,   269,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   372,   373,     0,   322,     0,
+     375,   634,   632,     0,     0,   390,   391,   392,   393,   427,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   491,   504,   545,   544,   555,   559,     0,     0,     0,
+     587,   586,     0,   591,   593,   599,   598,     0,   582,   580,
+       0,   607,   606,     0,   532,   539,   327,     0,     0,   633,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   372,   373,
-       0,   322,     0,   375,   620,   618,     0,     0,   390,   391,
-     392,   393,   427,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   491,   504,   531,   530,   541,   545,
-       0,     0,     0,   573,   572,     0,   577,   579,   585,   584,
-       0,   568,   566,     0,   593,   592,     0,   327,     0,     0,
-     619,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   323,     0,     0,     0,   450,   451,
-     452,   453,   454,   455,   456,     0,     0,     0,   554,   563,
-       0,   559,     0,   571,   583,   582,     0,   569,   567,     0,
-     591,   590,     0,   328,     0,     0,   625,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   324,     0,
-     445,     0,   457,   458,   459,   564,   560,   581,   570,   589,
-     588,     0,   329,     0,     0,     0,   325,     0,   587,     0,
-     444
+       0,     0,     0,   323,     0,     0,     0,   450,   451,   452,
+     453,   454,   455,   456,     0,     0,     0,   568,   577,     0,
+     573,     0,   585,   597,   596,     0,   583,   581,     0,   605,
+     604,     0,   328,     0,     0,   639,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   324,     0,   445,
+       0,   457,   458,   459,   578,   574,   595,   584,   603,   602,
+       0,   329,     0,     0,     0,   325,     0,   601,     0,   444
   };
 
   /* YYPGOTO[NTERM-NUM].  */
   const short int
   parser::yypgoto_[] =
   {
-     -1160,   -41,  -197,   -16,  -529, -1160, -1160,   506,  -570, -1160,
-    -138,  -137,  -445,  -141,   250,   368,   589,   587,   280,  -296,
-   -1159,  -893,  -342,    85, -1160,  -112, -1123,  -338,  -566, -1160,
-   -1160, -1160,  -325,  -373,   608, -1160,  -382, -1160, -1160, -1160,
-   -1160, -1160, -1160, -1160
+     -1185,   -41,  -302,   -17,  -528, -1185, -1185,   578,  -583, -1185,
+     -85,   -84,  -221,   -87,   356,   636,   355,   529,   610,  -317,
+   -1184,  -933,  -351,    84, -1185,  -208, -1109,  -334,  -578, -1185,
+   -1185, -1185,  -337,  -380,   737, -1185,  -382, -1185, -1185, -1185,
+   -1185, -1185, -1185, -1185
   };
 
   /* YYDEFGOTO[NTERM-NUM].  */
@@ -4229,8 +4307,8 @@ namespace yy {
   {
         -1,   354,   355,   356,   357,   358,   359,   360,   361,   362,
      363,   364,   365,   366,   367,   368,   369,   370,   371,   372,
-     373,   591,   374,   574,   575,   375,  1188,   376,  1470,  1317,
-    1318,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+     373,   591,   374,   574,   575,   375,  1209,   376,  1517,  1352,
+    1353,   377,   378,   379,   380,   381,   382,   383,   384,   385,
      386,   387,   388,   389
   };
 
@@ -4241,181 +4319,139 @@ namespace yy {
   const short int
   parser::yytable_[] =
   {
-       398,   399,   774,   576,   577,   594,   596,   397,   633,   611,
-     612,   573,   570,    29,   391,  1281,  1106,   595,   635,   390,
-      36,    37,  1288,   392,  1289,   571,  1290,   393,  1291,   594,
-    1176,  1177,  1178,  1316,   948,   949,   950,  1179,  1180,  1181,
-    1182,   595,   998,   394,  1183,  1184,  1185,  1186,  1045,   999,
-     623,  1133,  1135,  1137,   968,  1046,   626,   640,  1134,  1136,
-    1138,   607,   608,  1144,   395,  1146,   634,   396,   637,   638,
-    1145,   641,  1147,    35,  1199,   643,   644,   645,   646,   647,
-     648,   649,   650,   651,   652,   653,   654,   655,   656,   657,
-     658,   659,   660,   661,   662,   663,   664,   665,   666,   667,
-     668,   669,   670,   671,   672,   673,   674,   675,   676,   677,
-     678,   679,   680,   681,   682,   683,   684,   685,   686,   687,
-     688,   689,   690,   691,   692,   693,   694,   695,   696,   697,
-     698,   699,   700,   701,   702,   703,   704,   705,   706,   707,
-     708,   709,   710,   711,   712,   713,   714,   715,   716,   717,
-     718,   719,   720,   721,   722,   723,   724,   725,   726,   727,
-     728,   729,   730,   731,   732,   601,   955,   956,   957,   958,
-     609,   610,   740,   741,   742,   743,   744,   745,   746,   747,
-     748,   749,   750,   751,   752,   753,   754,   755,   756,   757,
-     758,   759,   760,   761,   762,   763,   764,   765,   766,   767,
-     768,   769,   770,   771,   772,   773,   775,   776,   777,   778,
-     779,   780,   781,   782,   783,   784,   785,   786,   787,   788,
-     789,   790,   791,   792,   793,   794,   795,   796,   797,   798,
-     799,   800,   801,   802,   803,   804,   805,   806,   807,   808,
-     809,   810,   811,   812,   814,  1154,   969,   970,   971,   837,
-     603,   840,   578,   579,   580,   581,   582,   583,   584,   585,
-     586,   587,   973,   819,  1292,  1473,    37,   838,   400,   842,
-     615,   616,   945,  1458,   571,  1460,   401,  1461,   947,  1462,
-     593,  1464,  1310,  1466,   576,   577,   578,   579,   580,   581,
-     582,   583,   584,   585,   586,   587,  1148,   966,  1150,  1390,
-     979,  1392,  1395,  1149,  1397,  1151,  1391,  1399,  1393,  1396,
-     634,  1398,  1401,  1403,  1400,   604,   605,   606,   402,  1402,
-    1404,   600,   576,   577,   578,   579,   580,   581,   582,   583,
-     584,   585,   586,   587,   820,   403,   821,   822,   823,   569,
-    1405,   824,   825,   404,   826,   827,   828,  1406,   829,   830,
-     831,   832,   833,   834,   835,  1420,   405,   836,   613,   614,
-    1471,  1504,  1421,  1176,  1177,  1178,   406,  1472,  1505,   407,
-    1179,  1180,  1181,  1182,   590,   597,   636,  1183,  1184,  1185,
-    1186,   408,  1536,   617,  1509,  1512,   409,  1537,  1515,  1517,
-    1539,  1510,  1513,  1541,  1544,  1516,  1518,  1559,  1561,  1565,
-     410,  1545,   624,   815,  1560,  1562,  1566,   601,   601,   601,
+       398,   399,   573,   775,   576,   577,   397,   597,   634,   612,
+     613,   636,   390,   571,  1009,   391,   570,   392,  1197,  1198,
+    1199,  1010,   959,   960,   961,  1200,  1201,  1202,  1203,  1351,
+    1056,   592,  1204,  1205,  1206,  1207,   595,  1057,   624,   395,
+    1302,   393,   979,   593,   627,  1220,   592,  1309,   596,  1310,
+    1455,  1311,   394,  1312,   635,  1144,   638,   639,   593,   642,
+     602,   641,  1145,   644,   645,   646,   647,   648,   649,   650,
+     651,   652,   653,   654,   655,   656,   657,   658,   659,   660,
+     661,   662,   663,   664,   665,   666,   667,   668,   669,   670,
+     671,   672,   673,   674,   675,   676,   677,   678,   679,   680,
+     681,   682,   683,   684,   685,   686,   687,   688,   689,   690,
+     691,   692,   693,   694,   695,   696,   697,   698,   699,   700,
+     701,   702,   703,   704,   705,   706,   707,   708,   709,   710,
+     711,   712,   713,   714,   715,   716,   717,   718,   719,   720,
+     721,   722,   723,   724,   725,   726,   727,   728,   729,   730,
+     731,   732,   733,   396,   604,    35,   840,   841,   608,   609,
+     741,   742,   743,   744,   745,   746,   747,   748,   749,   750,
+     751,   752,   753,   754,   755,   756,   757,   758,   759,   760,
+     761,   762,   763,   764,   765,   766,   767,   768,   769,   770,
+     771,   772,   773,   774,   776,   777,   778,   779,   780,   781,
+     782,   783,   784,   785,   786,   787,   788,   789,   790,   791,
+     792,   793,   794,   795,   796,   797,   798,   799,   800,   801,
+     802,   803,   804,   805,   806,   807,   808,   809,   810,   811,
+     812,   813,   815,  1165,   595,  1313,    37,  1146,   592,   400,
+     838,   569,  1457,   851,  1147,  1117,   596,   980,   981,   982,
+     593,   820,   957,  1331,   401,   839,   984,   402,   853,  1148,
+     403,   956,   404,   571,   593,   405,  1149,   958,   576,   577,
+     578,   579,   580,   581,   582,   583,   584,   585,   586,   587,
+    1197,  1198,  1199,   594,  1155,  1520,   977,  1200,  1201,  1202,
+    1203,  1156,   990,    29,  1204,  1205,  1206,  1207,   406,   635,
+      36,    37,   407,   602,   602,   602,   602,   602,   602,   602,
+     602,   602,   602,   602,   602,   602,   602,   602,   602,   602,
+     602,   601,  1503,   602,  1505,   592,  1506,  1157,  1507,  1459,
+    1509,   408,  1511,   409,  1158,   610,   611,   593,   576,   577,
+     578,   579,   580,   581,   582,   583,   584,   585,   586,   587,
+     578,   579,   580,   581,   582,   583,   584,   585,   586,   587,
+    1159,   592,   614,   615,   842,  1462,   410,  1160,   619,  1161,
+    1425,   616,   617,   593,  1427,   637,  1162,  1426,   843,   590,
+     598,  1428,  1430,  1432,  1211,  1212,   844,   845,  1434,  1431,
+    1433,   966,   967,   968,   969,  1435,   411,   604,   604,   604,
+     604,   604,   604,   604,   604,   604,   604,   604,   604,   604,
+     604,   604,   604,   604,   604,  1436,  1438,   604,  1440,  1465,
+     622,  1518,  1437,  1439,   412,  1441,  1466,  1208,  1519,  1551,
+     846,   847,   848,   849,  1556,  1559,  1552,  1562,  1566,  1593,
+    1608,  1557,  1560,  1585,  1563,  1567,  1594,  1609,  1586,  1610,
+     413,  1588,   618,  1614,  1590,   414,  1611,  1230,  1617,   821,
+    1615,   822,   823,   824,   415,  1618,   825,   826,   573,   827,
+     828,   829,   416,   830,   831,   832,   833,   834,   835,   836,
+     625,   816,   837,     9,   640,    11,    12,    13,    14,    15,
+      16,    17,    18,  1620,  1622,  1637,    19,    20,    21,    22,
+    1621,  1623,  1638,  1639,  1649,   417,  1632,   818,   819,  1633,
+    1640,  1650,  1634,   418,   602,  1210,   605,   606,   607,  1215,
+    1216,  1515,  1516,   962,   963,   419,   964,   965,   814,   970,
+     971,   420,   421,   422,   623,   423,   424,   425,   426,   427,
+     428,  1654,   429,   430,   431,   432,   433,   434,   620,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   601,   601,   601,   601,   601,   601,
      601,   601,   601,   601,   601,   601,   601,   601,   601,   601,
-     601,   601,   601,   601,   601,  1568,  1571,   601,   592,  1573,
-    1588,  1590,  1569,  1572,  1600,  1187,  1574,  1589,  1591,   817,
-     818,  1601,   411,  1583,   412,  1209,  1584,  1190,  1191,  1585,
-       9,   639,    11,    12,    13,    14,    15,    16,    17,    18,
-    1194,  1195,   622,    19,    20,    21,    22,  1468,  1469,   951,
-     952,   413,   953,   954,   959,   960,   573,   414,  1605,   415,
-     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
-     426,   427,   603,   603,   603,   603,   603,   603,   603,   603,
-     603,   603,   603,   603,   603,   603,   603,   603,   603,   603,
-     428,   429,   603,   430,   431,   432,  1189,   433,   434,   435,
-     436,   437,   438,   439,   440,   441,   442,   443,   813,   444,
-     445,   446,   447,   448,   449,   450,   632,   451,   452,   453,
-     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
-     464,   465,   466,   467,   468,   469,   470,   471,   472,   473,
-     474,   475,   476,   600,   600,   600,   600,   600,   600,   600,
-     600,   600,   600,   600,   600,   600,   600,   600,   600,   600,
-     600,   477,   478,   600,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   843,   507,   508,   509,   510,   589,   601,  1193,
-     511,  1196,   512,   513,   514,   515,   516,   517,   518,   519,
-     520,   521,   522,   523,   524,   525,   526,   527,   618,   946,
-     528,   529,  1333,   588,  1152,   530,   967,   531,  1206,   532,
-     533,   589,   534,   535,   536,   590,   537,   538,   539,   540,
-     541,  1213,   542,   543,   544,   545,   546,   547,  1214,  1215,
-    1216,  1217,   548,   549,  1218,   550,   551,   552,   553,   554,
-     555,   588,  1219,   556,   620,  1220,   557,   558,   559,   589,
-    1221,   560,   561,   590,  1222,  1223,  1224,  1225,  1226,  1227,
-    1228,  1229,   562,   603,   563,  1230,  1231,   564,   565,   566,
-     567,   568,   619,   621,   624,   625,   631,   974,   628,   629,
-     642,  1232,   630,   733,   734,   735,   736,  1233,  1234,  1235,
-    1236,  1237,  1238,  1239,  1240,  1241,  1242,   737,   738,   739,
-     816,   972,   975,   976,   977,   978,   980,   981,   982,   983,
-     984,   985,   987,  1153,   988,   989,  1243,  1244,  1245,  1246,
-     986,   990,  1247,  1248,   991,  1249,  1250,   992,   997,   993,
-    1251,  1000,  1252,  1253,   600,  1254,  1157,  1208,  1255,   994,
-    1256,  1257,  1258,   995,   996,  1001,  1002,  1003,  1004,  1005,
-    1259,  1006,  1260,  1008,  1261,  1262,  1263,  1264,  1009,  1007,
-    1265,  1266,  1010,  1011,  1012,  1267,  1013,  1268,  1014,  1269,
-    1016,  1270,  1015,  1282,  1283,  1284,  1285,  1286,  1287,  1017,
-    1018,  1019,  1020,  1021,  1022,  1023,  1027,  1028,  1331,  1332,
-    1024,  1025,  1026,  1293,  1294,  1029,  1030,  1031,  1298,  1032,
-    1033,  1034,  1035,  1303,  1304,  1036,  1306,  1037,  1038,  1309,
-    1039,  1040,  1041,  1042,  1043,  1198,  1044,  1324,  1047,  1048,
-    1049,  1204,  1311,  1050,  1051,  1477,  1315,   961,   602,  1052,
-    1321,  1175,  1053,  1054,  1055,  1056,  1057,  1058,  1059,  1060,
-    1061,  1062,  1063,  1064,  1065,  1066,  1067,  1081,  1068,  1069,
-    1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
-    1080,   965,  1323,  1156,  1085,  1086,  1519,  1197,  1082,  1083,
-    1084,  1089,  1092,  1087,  1088,  1090,  1091,  1093,  1094,  1096,
-    1095,  1097,  1098,  1099,  1101,  1102,  1104,  1100,  1103,  1105,
-    1108,  1109,  1110,  1207,  1107,  1111,  1112,  1113,  1114,  1116,
-    1115,  1117,  1118,  1123,  1428,     0,  1124,  1119,  1120,  1127,
-    1411,  1121,  1122,  1128,  1125,  1126,  1129,  1130,  1132,  1131,
-    1158,  1139,  1140,  1159,  1141,  1160,  1161,  1142,  1419,  1143,
-    1162,  1163,  1164,  1165,  1166,  1167,  1168,  1169,  1170,  1171,
-    1172,  1173,  1174,  1192,     0,  1200,   962,  1422,  1212,   627,
-    1295,  1313,  1201,  1202,  1203,   601,  1210,  1211,  1296,  1297,
-    1427,   601,  1299,  1300,  1301,  1302,  1305,  1307,  1308,  1312,
-    1433,  1434,  1435,  1436,  1319,   601,  1322,  1325,  1326,  1335,
-    1327,  1328,  1329,  1330,  1334,  1339,  1437,  1340,  1438,  1439,
-    1440,  1441,  1442,  1443,  1444,  1445,  1446,  1447,  1448,  1336,
-    1337,  1449,  1338,  1341,  1342,  1343,  1450,  1476,  1344,  1345,
-    1346,  1347,  1348,  1451,  1452,  1349,  1453,  1350,  1352,  1454,
-    1351,  1353,  1430,  1455,  1364,  1431,  1456,  1354,  1457,  1355,
-    1356,  1459,  1357,  1358,  1359,  1360,  1361,  1463,  1362,  1465,
-     603,  1467,  1363,  1365,  1366,  1367,   603,  1368,  1369,  1370,
-    1372,  1371,  1373,  1374,  1375,  1376,  1377,     0,  1378,  1380,
-     603,  1382,  1383,  1385,  1379,  1381,  1386,  1384,  1387,  1389,
-    -367,  1388,  -358,  -359,  -360,  -361,  -362,  -363,  -364,  -365,
-       0,  1394,  1407,  1408,  1409,  1410,  1412,  1413,  1414,  1415,
-    1416,  1423,  1417,  1418,  1426,     0,  1425,     0,     0,  1546,
-    1432,  1474,  1424,  1429,  1478,  1475,  1479,  1480,  1481,  1482,
-    1483,   600,  1484,  1494,  1495,  1496,  1497,   600,  1522,  1523,
-    1524,  1525,  1526,  1527,  1528,  1529,  1530,  1531,  1532,  1485,
-    1486,   600,  1487,  1488,  1489,  1533,  1534,  1535,  1490,  1491,
-    1492,  1493,  1498,  1499,  1500,  1538,  1501,  1502,  1540,  1503,
-    1506,  1542,  1507,  1543,  1508,  1511,  1514,  1520,  1521,  1548,
-    1549,  1550,  1551,  1552,  1547,  1553,  1554,   964,   963,  1558,
-    1563,  1555,  1564,  1567,  1556,  1557,  1570,  1576,  1592,  1593,
-    1575,  1594,  1577,  1595,  1596,  1597,  1598,   601,  1599,  1602,
-    1578,  1579,  1580,  1606,  1607,  1581,  1608,  1582,  1610,     0,
-       0,     0,     0,     0,     0,     0,     0,  1586,     0,  1587,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,  1603,     0,  1604,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,  1609,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   603,     0,     0,     0,     1,     0,     2,     3,
-       4,     0,     5,     6,     7,     0,     0,     8,     0,     0,
-       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-       0,     0,     0,    19,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,     0,    38,    39,    40,     0,     0,     0,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   600,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
-      89,    90,    91,    92,     0,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
-     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
-     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
-     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
-     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
-     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   239,   240,     0,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
-     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
-     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
-     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
-     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
-     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   333,   334,     0,
-       0,     0,   335,   336,   337,   338,   339,   340,   341,   342,
-     343,   344,   345,   346,     0,     0,     0,     0,     0,     0,
-       0,   347,   348,     0,     0,     0,     0,     0,     0,     0,
-     349,     0,     0,     0,   350,     0,   351,   352,     0,   839,
-     353,     8,     0,     0,     9,    10,    11,    12,    13,    14,
+     601,   601,   450,   451,   601,   452,   453,   454,   455,   456,
+     457,   458,   459,   460,   461,   462,   463,   464,   465,   466,
+     467,   468,   469,   470,   471,   472,   473,   474,   604,   475,
+     476,   477,   478,   621,   479,   480,   481,   482,  1214,   483,
+    1217,   484,   485,   486,   487,   488,   489,   490,   491,   492,
+     493,   588,  1163,   494,   633,   495,   496,   497,   498,   589,
+     499,   500,   501,   590,   502,   503,   504,  1227,   505,   506,
+    1368,   507,   508,   509,   510,   511,   512,   513,   514,   515,
+    1234,   516,   517,   518,   519,   520,   521,  1235,  1236,  1237,
+    1238,   522,   523,  1239,   524,   525,   526,   527,   626,   528,
+     529,  1240,   530,  1229,  1241,   531,   532,   533,   534,  1242,
+     535,   536,   537,  1243,  1244,  1245,  1246,  1247,  1248,  1249,
+    1250,   588,   538,   539,  1251,  1252,   540,   541,   542,   589,
+     543,   544,   545,   590,   643,   546,   547,   548,   549,   589,
+    1253,   550,   551,   552,   553,   554,  1254,  1255,  1256,  1257,
+    1258,  1259,  1260,  1261,  1262,  1263,   555,   556,   557,   558,
+     559,   560,   561,   632,   562,   563,   564,   565,   566,   567,
+     568,   625,   854,   734,   978,  1264,  1265,  1266,  1267,   629,
+     630,  1268,  1269,   631,  1270,  1271,   735,   736,   737,  1272,
+     738,  1273,  1274,   739,  1275,   601,   740,  1276,   817,  1277,
+    1278,  1279,   985,   983,   986,   987,   988,   989,   991,  1280,
+     992,  1281,   993,  1282,  1283,  1284,  1285,   994,   995,  1286,
+    1287,   996,   997,   998,  1288,   999,  1289,  1000,  1290,  1001,
+    1291,  1002,  1303,  1304,  1305,  1306,  1307,  1308,  1003,  1004,
+    1005,  1006,  1007,  1008,  1011,  1012,  1013,  1014,  1015,  1016,
+    1017,  1219,  1314,  1315,  1019,  1020,  1022,  1319,  1018,  1021,
+    1023,  1024,  1324,  1325,  1025,  1327,  1026,  1027,  1330,  1366,
+    1367,  1028,  1335,  1337,  1339,  1029,  1030,  1343,  1344,  1031,
+    1032,  1033,  1038,  1034,  1035,  1036,  1037,  1039,  1040,  1359,
+    1041,  1346,  1042,  1043,  1044,  1350,  1045,  1046,  1047,  1356,
+    1048,  1049,  1050,  1051,  1052,  1053,  1054,  1334,  1336,  1338,
+    1055,  1341,  1342,  1058,  1059,  1060,  1061,  1062,  1063,  1225,
+      36,  1524,  1358,  1167,  1073,  1064,  1065,  1066,  1067,  1068,
+    1069,   602,  1070,  1071,  1072,  1074,  1075,   602,  1076,  1092,
+    1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+    1087,   602,  1088,  1089,  1090,  1091,     0,  1096,  1093,  1097,
+     603,  1568,  1100,  1094,  1228,  1095,  1103,  1098,  1099,  1104,
+    1101,  1102,  1105,  1107,  1106,  1108,  1110,  1109,  1111,  1112,
+    1113,  1114,  1446,  1115,  1116,  1118,  1119,  1120,  1121,  1122,
+    1123,  1124,  1125,  1127,   972,   974,  1129,     0,  1164,  1473,
+    1454,  1126,  1128,  1134,  1130,  1131,  1132,  1133,  1135,  1136,
+    1138,  1137,  1139,  1140,  1141,  1142,  1143,  1168,  1150,  1186,
+    1169,  1151,  1170,  1152,  1153,   604,  1154,  1171,  1172,  1173,
+    1467,   604,  1174,  1175,  1176,  1177,  1178,  1179,  1180,  1181,
+    1182,  1183,  1184,  1472,  1185,   604,  1187,  1188,  1189,  1190,
+    1222,  1191,  1192,  1478,  1479,  1480,  1481,  1193,  1194,  1195,
+    1196,  1213,  1218,  1221,  1370,  1233,  1348,  1316,  1317,  1482,
+    1223,  1483,  1484,  1485,  1486,  1487,  1488,  1489,  1490,  1491,
+    1492,  1493,  1224,  1231,  1494,  1318,  1232,  1320,  1321,  1495,
+    1322,  1323,  1326,  1328,  1329,  1332,  1496,  1497,  1333,  1498,
+    1340,  1345,  1499,  1347,  1354,  1357,  1500,  1361,  1360,  1501,
+    1362,  1502,  1523,  1363,  1504,  1364,  1365,  1369,  1371,  1372,
+    1508,  1373,  1510,  1374,  1512,  1375,  1376,  1377,  1378,  1379,
+    1380,  1381,  1382,  1383,  1384,  1385,     0,  1387,   628,     0,
+       0,     0,     0,  1386,     0,  1388,  1389,  1390,  1391,  1392,
+    1393,  1394,  1395,  1396,  1397,  1398,  1399,  1400,  1401,  1402,
+    1403,  1404,  1405,  1407,  1408,  1406,  1409,  1410,  1411,  1412,
+     975,  1415,  1413,     0,  1417,  1418,  -367,  1414,  1420,  1513,
+    1416,  1421,  1514,  1419,  1422,  1424,  1423,   602,  -358,  -359,
+    -360,  -361,   601,  -362,  -363,  -364,  -365,     0,   601,  1429,
+    1442,  1443,  1444,  1445,  1447,  1448,  1449,  1450,  1595,  1451,
+    1452,  1453,   601,  1571,  1572,  1573,  1574,  1575,  1576,  1577,
+    1578,  1579,  1580,  1581,  1456,  1458,  1460,  1463,  1461,  1464,
+    1582,  1583,  1584,  1468,  1470,  1469,  1471,  1474,  1477,  1475,
+    1587,  1476,  1521,  1589,  1525,  1526,  1591,  1522,  1527,  1528,
+    1592,  1529,   976,  1530,  1531,     0,     0,  1532,     0,  1533,
+    1534,  1535,  1536,  1537,  1538,  1539,  1540,  1541,  1542,  1543,
+    1544,  1545,  1546,  1547,  1550,   973,  1553,  1624,  1554,  1626,
+    1548,   604,  1549,  1555,  1558,  1561,  1564,  1627,  1628,  1629,
+    1565,     0,  1630,  1569,  1631,  1596,  1570,  1597,  1598,  1604,
+    1599,  1600,  1601,  1602,  1635,  1603,  1636,  1607,  1612,  1613,
+    1616,  1605,  1619,  1606,  1641,  1642,  1643,  1625,  1644,  1645,
+    1646,  1652,  1647,  1653,  1648,  1651,  1655,  1657,  1656,  1659,
+       1,     0,     2,     3,     4,     0,     5,     6,     7,  1658,
+       0,     8,     0,     0,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,     0,     0,     0,    19,    20,    21,
       22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
       32,    33,    34,    35,    36,    37,     0,    38,    39,    40,
@@ -4425,7 +4461,7 @@ namespace yy {
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,     0,    93,
+      85,    86,    87,    88,    89,    90,    91,    92,   601,    93,
       94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
      104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
      114,   115,   116,   117,     0,   118,   119,   120,   121,   122,
@@ -4454,50 +4490,51 @@ namespace yy {
      322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
      332,   333,   334,     0,     0,     0,   335,   336,   337,   338,
      339,   340,   341,   342,   343,   344,   345,   346,     0,     0,
-       0,     0,     0,     0,     0,   347,   348,     0,     0,     0,
-       0,     0,     0,     0,   349,     0,     0,     0,   350,     0,
-     351,   352,     8,     0,   353,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,     0,     0,     0,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,     0,    38,    39,
-      40,     0,     0,     0,     0,     0,     0,    41,    42,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    88,    89,    90,    91,    92,     0,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,     0,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
-     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
-     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
-     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
-     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
-     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
-     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   347,
+     348,     0,     0,     0,     0,     0,     0,     0,   349,     0,
+       0,     0,   350,     0,   351,   352,     0,   850,   353,     8,
+       0,     0,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,     0,     0,     0,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,     0,    38,    39,    40,     0,     0,
+       0,     0,     0,     0,    41,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,     0,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   239,   240,     0,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
-     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,   333,   334,     0,     0,     0,   335,   336,   337,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,     0,
-       0,     0,     0,     0,     0,     0,   347,   348,     0,     0,
-       0,     0,     0,     0,     0,   349,     0,     0,     0,   350,
-       0,   351,   352,     0,     8,   353,   572,     9,    10,    11,
+       0,     0,     0,     0,   239,   240,     0,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,   290,   291,   292,   293,
+     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
+     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
+     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,     0,     0,     0,   335,   336,   337,   338,   339,   340,
+     341,   342,   343,   344,   345,   346,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   347,   348,     0,
+       0,     0,     0,     0,     0,     0,   349,     0,     0,     0,
+     350,     0,   351,   352,     8,     0,   353,     9,    10,    11,
       12,    13,    14,    15,    16,    17,    18,     0,     0,     0,
       19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
       29,    30,    31,    32,    33,    34,    35,    36,    37,     0,
@@ -4536,9 +4573,51 @@ namespace yy {
      319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
      329,   330,   331,   332,   333,   334,     0,     0,     0,   335,
      336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
-     346,     0,     0,     0,     0,     0,     0,     0,   347,   348,
+     346,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   347,   348,     0,     0,     0,     0,     0,     0,
+       0,   349,     0,     0,     0,   350,     0,   351,   352,     0,
+       8,   353,   572,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,     0,     0,     0,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,     0,    38,    39,    40,     0,
+       0,     0,     0,     0,     0,    41,    42,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,     0,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,     0,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,   235,   236,   237,   238,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   239,   240,     0,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
+     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
+     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
+     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,     0,     0,     0,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   347,   348,
        0,     0,     0,     0,     0,     0,     0,   349,     0,     0,
-       0,   350,     0,   351,   352,     0,     8,   353,  1155,     9,
+       0,   350,     0,   351,   352,     0,     8,   353,  1166,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,     0,
        0,     0,    19,    20,    21,    22,    23,    24,    25,    26,
       27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
@@ -4578,157 +4657,34 @@ namespace yy {
      327,   328,   329,   330,   331,   332,   333,   334,     0,     0,
        0,   335,   336,   337,   338,   339,   340,   341,   342,   343,
      344,   345,   346,     0,     0,     0,     0,     0,     0,     0,
-     347,   348,     0,     0,     0,     0,     0,     0,     0,   349,
-       0,     0,   841,   350,     0,   351,   352,     8,     0,   353,
-       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-       0,     0,     0,    19,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,     0,    38,    39,    40,     0,     0,     0,     0,
-       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
-      89,    90,    91,    92,     0,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
-     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
-     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
-     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
-     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
-     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   239,   240,     0,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
-     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
-     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
-     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
-     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
-     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   333,   334,     0,
-       0,     0,   335,   336,   337,   338,   339,   340,   341,   342,
-     343,   344,   345,   346,     0,     0,     0,     0,     0,     0,
-       0,   347,   348,     0,     0,     0,     0,     0,     0,     0,
-     349,     0,     0,   944,   350,     0,   351,   352,     8,     0,
-     353,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-      18,     0,     0,     0,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,     0,    38,    39,    40,     0,     0,     0,
-       0,     0,     0,    41,    42,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,     0,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,     0,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
-     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
-     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
-     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   239,   240,     0,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-       0,     0,     0,   335,   336,   337,   338,   339,   340,   341,
-     342,   343,   344,   345,   346,     0,     0,     0,     0,     0,
-       0,     0,   347,   348,     0,     0,     0,     0,     0,     0,
-       0,   349,     0,     0,     0,   350,  1205,   351,   352,     0,
-       8,   353,  1176,  1271,  1272,    11,    12,    13,    14,  1273,
-    1274,  1275,  1276,     0,     0,     0,  1277,  1278,  1279,  1280,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,     0,    38,    39,    40,     0,
-       0,     0,     0,     0,     0,    41,    42,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,     0,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,     0,   118,   119,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
-     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   239,   240,     0,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
-     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
-     283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
-     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
-     333,   334,     0,     0,     0,   335,   336,   337,   338,   339,
-     340,   341,   342,   343,   344,   345,   346,     0,     0,     0,
-       0,     0,     0,     0,   347,   348,     0,     0,     0,     0,
-       0,     0,     0,   349,     0,     0,     0,   350,     0,   351,
-     352,     8,     0,   353,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,     0,     0,     0,    19,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,     0,    38,    39,    40,
-       0,     0,     0,     0,     0,     0,    41,    42,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,     0,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   117,     0,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
-     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
-     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
-     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
-     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
-     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,     0,     0,     0,     0,
+       0,     0,     0,     0,   347,   348,     0,     0,     0,     0,
+       0,     0,     0,   349,     0,     0,   852,   350,     0,   351,
+     352,     8,     0,   353,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,     0,     0,     0,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,     0,    38,    39,    40,
+       0,     0,     0,     0,     0,     0,    41,    42,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,     0,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,     0,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,   239,   240,     0,   241,
      242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
@@ -4742,133 +4698,12 @@ namespace yy {
      322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
      332,   333,   334,     0,     0,     0,   335,   336,   337,   338,
      339,   340,   341,   342,   343,   344,   345,   346,     0,     0,
-       0,     0,     0,     0,     0,   347,   348,     0,     0,     0,
-       0,     0,     0,     0,   349,     0,  1314,     0,   350,     0,
-     351,   352,     8,     0,   353,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,     0,     0,     0,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,     0,    38,    39,
-      40,     0,     0,     0,     0,     0,     0,    41,    42,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    88,    89,    90,    91,    92,     0,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,     0,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
-     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
-     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
-     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
-     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
-     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
-     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   239,   240,     0,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
-     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,   333,   334,     0,     0,     0,   335,   336,   337,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,     0,
-       0,     0,     0,     0,     0,     0,   347,   348,     0,     0,
-       0,     0,     0,     0,     0,   349,     0,  1320,     0,   350,
-       0,   351,   352,     8,     0,   353,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,     0,     0,     0,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,     0,    38,
-      39,    40,     0,     0,     0,     0,     0,     0,    41,    42,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
-       0,    93,    94,    95,    96,    97,    98,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,   117,     0,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
-     171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
-     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
-     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   239,   240,
-       0,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
-     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
-     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
-     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
-     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,   333,   334,     0,     0,     0,   335,   336,
-     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
-       0,     0,     0,     0,     0,     0,     0,   347,   348,     0,
-       0,     0,     0,     0,     0,     0,   349,     0,     0,     0,
-     350,     0,   351,   352,     8,     0,   353,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,    18,     0,     0,     0,
-      19,    20,    21,    22,     0,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,     0,    36,    37,     0,
-      38,    39,    40,     0,     0,     0,     0,     0,     0,    41,
-      42,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,     0,    93,    94,    95,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,     0,   118,   119,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   239,
-     240,     0,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
-     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
-     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
-     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
-     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
-     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
-     329,   330,   331,   332,   333,   334,     0,     0,     0,   335,
-     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
-     346,     0,     0,     0,     0,     0,     0,     0,   347,   348,
-     598,     0,     0,     0,     0,     0,     0,   349,     0,     0,
-       0,   350,     0,   351,   352,     0,     0,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,     0,    36,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   347,
+     348,     0,     0,     0,     0,     0,     0,     0,   349,     0,
+       0,   955,   350,     0,   351,   352,     8,     0,   353,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,     0,
+       0,     0,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
       37,     0,    38,    39,    40,     0,     0,     0,     0,     0,
        0,    41,    42,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    43,    44,    45,    46,    47,    48,    49,
@@ -4904,188 +4739,68 @@ namespace yy {
      317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
      327,   328,   329,   330,   331,   332,   333,   334,     0,     0,
        0,   335,   336,   337,   338,   339,   340,   341,   342,   343,
-     344,   345,   346,     0,     0,   844,   845,     0,     0,     0,
-     347,   348,   846,     0,     0,     0,     0,     0,     0,   349,
-       0,     0,     0,   599,     0,   351,   352,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   847,   848,   849,   850,   851,   852,
-     853,   854,   855,   856,   857,   858,   859,   860,   861,   862,
-     863,   864,   865,   866,   867,   868,   869,   870,   871,   872,
-     873,   874,   875,   876,   877,   878,   879,   880,   881,   882,
-     883,   884,   885,   886,   887,   888,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   889,
-     890,   891,   892,   893,   894,   895,   896,   897,   898,   899,
-     900,   901,   902,   903,   904,   905,   906,   907,   908,   909,
-     910,   911,   912,   913,   914,   915,   916,   917,   918,   919,
-     920,   921,   922,   923,   924,   925,   926,   927,   928,   929,
-     930,   931,   932,   933,   934,   935,   936,   937,   938,   939,
-     940,   941,   942,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     344,   345,   346,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   347,   348,     0,     0,     0,     0,
+       0,     0,     0,   349,     0,     0,     0,   350,  1226,   351,
+     352,     0,     8,   353,  1197,  1292,  1293,    11,    12,    13,
+      14,  1294,  1295,  1296,  1297,     0,     0,     0,  1298,  1299,
+    1300,  1301,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,     0,    38,    39,
+      40,     0,     0,     0,     0,     0,     0,    41,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,     0,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   239,   240,     0,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
+     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
+     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
+     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,     0,     0,     0,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   943
-  };
-
-  /* YYCHECK.  */
-  const short int
-  parser::yycheck_[] =
-  {
-        41,    42,   531,    59,    60,   418,    49,    23,   390,    57,
-      58,   353,   350,    40,   421,  1138,   429,   430,   391,   427,
-      47,    48,  1145,   421,  1147,   350,  1149,   421,  1151,   418,
-      16,    17,    18,  1192,   604,   605,   606,    23,    24,    25,
-      26,   430,   422,   421,    30,    31,    32,    33,   422,   429,
-     375,   422,   422,   422,   624,   429,   381,   395,   429,   429,
-     429,   408,   409,   422,   407,   422,   391,   421,   393,   394,
-     429,   396,   429,    46,   967,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   362,   611,   612,   613,   614,
-      55,    56,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
-     565,   566,   567,   568,   569,   815,   628,   629,   630,   591,
-     362,   593,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,   635,   588,  1157,  1424,    48,   592,   421,   594,
-      53,    54,   597,  1396,   599,  1398,   421,  1400,   603,  1402,
-     426,  1404,  1175,  1406,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,   422,   622,   422,   422,
-     642,   422,   422,   429,   422,   429,   429,   422,   429,   429,
-     635,   429,   422,   422,   429,   410,   411,   412,   421,   429,
-     429,   362,    59,    60,    61,    62,    63,    64,    65,    66,
-      67,    68,    69,    70,   336,   421,   338,   339,   340,   418,
-     422,   343,   344,   421,   346,   347,   348,   429,   350,   351,
-     352,   353,   354,   355,   356,   422,   421,   359,   406,   407,
-     422,   422,   429,    16,    17,    18,   421,   429,   429,   421,
-      23,    24,    25,    26,   430,   418,   392,    30,    31,    32,
-      33,   421,  1505,   405,   422,   422,   421,  1510,   422,   422,
-    1513,   429,   429,  1516,   422,   429,   429,   422,   422,   422,
-     421,   429,   421,   422,   429,   429,   429,   604,   605,   606,
-     607,   608,   609,   610,   611,   612,   613,   614,   615,   616,
-     617,   618,   619,   620,   621,   422,   422,   624,   418,   422,
-     422,   422,   429,   429,   422,   421,   429,   429,   429,   428,
-     429,   429,   421,  1566,   421,   974,  1569,   419,   420,  1572,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-     419,   420,   425,    30,    31,    32,    33,    28,    29,   607,
-     608,   421,   609,   610,   615,   616,   818,   421,  1601,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   604,   605,   606,   607,   608,   609,   610,   611,
-     612,   613,   614,   615,   616,   617,   618,   619,   620,   621,
-     421,   421,   624,   421,   421,   421,   841,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   569,   421,
-     421,   421,   421,   421,   421,   421,     0,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   604,   605,   606,   607,   608,   609,   610,
-     611,   612,   613,   614,   615,   616,   617,   618,   619,   620,
-     621,   421,   421,   624,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   147,   421,   421,   421,   421,   426,   815,   944,
-     421,   946,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   404,   418,
-     421,   421,  1212,   418,   419,   421,   419,   421,   973,   421,
-     421,   426,   421,   421,   421,   430,   421,   421,   421,   421,
-     421,   986,   421,   421,   421,   421,   421,   421,   993,   994,
-     995,   996,   421,   421,   999,   421,   421,   421,   421,   421,
-     421,   418,  1007,   421,   402,  1010,   421,   421,   421,   426,
-    1015,   421,   421,   430,  1019,  1020,  1021,  1022,  1023,  1024,
-    1025,  1026,   421,   815,   421,  1030,  1031,   421,   421,   421,
-     421,   421,   403,   401,   421,   431,   431,     8,   427,   427,
-     426,  1046,   427,   422,   422,   422,   422,  1052,  1053,  1054,
-    1055,  1056,  1057,  1058,  1059,  1060,  1061,   422,   422,   422,
-     422,   428,   422,   422,   406,   422,   422,   422,   422,   422,
-     422,   422,   422,   419,   422,   422,  1081,  1082,  1083,  1084,
-     429,   422,  1087,  1088,   422,  1090,  1091,   422,   422,   429,
-    1095,   422,  1097,  1098,   815,  1100,   419,   974,  1103,   429,
-    1105,  1106,  1107,   429,   429,   422,   422,   422,   422,   422,
-    1115,   422,  1117,   422,  1119,  1120,  1121,  1122,   422,   429,
-    1125,  1126,   429,   422,   422,  1130,   422,  1132,   422,  1134,
-     422,  1136,   429,  1138,  1139,  1140,  1141,  1142,  1143,   422,
-     422,   429,   429,   429,   429,   429,   422,   422,  1210,  1211,
-     429,   429,   429,  1158,  1159,   422,   429,   429,  1163,   422,
-     422,   422,   422,  1168,  1169,   422,  1171,   422,   422,  1174,
-     422,   422,   422,   422,   422,   420,   422,  1199,   422,   422,
-     422,     9,  1187,   422,   422,     4,  1191,   617,   362,   429,
-    1195,   419,   429,   429,   429,   429,   429,   429,   429,   429,
-     429,   422,   422,   422,   422,   422,   422,   429,   422,   422,
-     422,   422,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   621,  1198,   818,   422,   422,  1472,   419,   429,   429,
-     429,   422,   422,   429,   429,   429,   429,   422,   422,   422,
-     429,   429,   429,   422,   422,   422,   422,   429,   429,   429,
-     422,   422,   422,   974,   429,   422,   422,   422,   422,   422,
-     429,   429,   422,   422,  1326,    -1,   422,   429,   429,   422,
-    1292,   429,   429,   422,   429,   429,   422,   429,   429,   422,
-     421,   429,   429,   421,   429,   421,   421,   429,  1310,   429,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,    -1,   422,   618,  1312,   421,   381,
-     422,   419,   428,   428,   428,  1192,   427,   427,   422,   422,
-    1325,  1198,   422,   422,   422,   422,   422,   422,   422,   421,
-    1335,  1336,  1337,  1338,   419,  1212,   419,   421,   427,   429,
-     422,   422,   422,   422,   422,   422,  1351,   422,  1353,  1354,
-    1355,  1356,  1357,  1358,  1359,  1360,  1361,  1362,  1363,   429,
-     429,  1366,   429,   422,   422,   422,  1371,  1429,   422,   422,
-     422,   422,   422,  1378,  1379,   422,  1381,   422,   422,  1384,
-     429,   429,   428,  1388,   422,   428,  1391,   429,  1393,   429,
-     429,  1396,   429,   429,   429,   429,   429,  1402,   429,  1404,
-    1192,  1406,   429,   422,   429,   422,  1198,   422,   422,   422,
-     422,   429,   422,   422,   422,   422,   422,    -1,   429,   422,
-    1212,   422,   422,   422,   429,   429,   422,   429,   422,   422,
-     421,   429,   421,   421,   421,   421,   421,   421,   421,   421,
-      -1,   422,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   419,   422,   422,   419,    -1,   422,    -1,    -1,  1521,
-     422,   422,   429,   427,   422,   428,   422,   422,   422,   422,
-     429,  1192,   429,   422,   422,   422,   422,  1198,  1483,  1484,
-    1485,  1486,  1487,  1488,  1489,  1490,  1491,  1492,  1493,   429,
-     429,  1212,   429,   429,   429,  1500,  1501,  1502,   429,   429,
-     429,   429,   422,   422,   429,  1510,   429,   429,  1513,   422,
-     422,  1516,   422,  1518,   422,   422,   422,   428,   427,   422,
-     422,   422,   422,   422,   429,   422,   422,   620,   619,   422,
-     422,   429,   422,   422,   429,   429,   422,   428,   422,   422,
-    1545,   422,  1547,   422,   422,   422,   422,  1424,   422,   422,
-    1555,  1556,  1557,   422,   429,  1560,   422,  1562,   422,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1572,    -1,  1574,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,  1589,    -1,  1591,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,  1607,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,  1424,    -1,    -1,    -1,     3,    -1,     5,     6,
-       7,    -1,     9,    10,    11,    -1,    -1,    14,    -1,    -1,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    -1,    50,    51,    52,    -1,    -1,    -1,    -1,
-      -1,    -1,    59,    60,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,  1424,    71,    72,    73,    74,    75,    76,
-      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,    -1,   122,   123,   124,   125,   126,
+     347,   348,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,     0,     0,   350,     0,   351,   352,     8,     0,   353,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,     0,     0,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,     0,    38,    39,    40,     0,     0,     0,     0,
+       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,     0,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
      127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
      137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-      -1,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
      157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
      167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
      177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
@@ -5094,26 +4809,559 @@ namespace yy {
      207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
      217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
      227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
-     267,   268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     237,   238,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   239,   240,     0,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,     0,
+       0,     0,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   347,   348,     0,     0,     0,
+       0,     0,     0,     0,   349,     0,  1349,     0,   350,     0,
+     351,   352,     8,     0,   353,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,     0,     0,     0,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,     0,    38,    39,
+      40,     0,     0,     0,     0,     0,     0,    41,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,     0,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   239,   240,     0,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
+     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
+     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
+     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,     0,     0,     0,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     347,   348,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,  1355,     0,   350,     0,   351,   352,     8,     0,   353,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,     0,     0,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,     0,    38,    39,    40,     0,     0,     0,     0,
+       0,     0,    41,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,     0,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   239,   240,     0,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,     0,
+       0,     0,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   347,   348,     0,     0,     0,
+       0,     0,     0,     0,   349,     0,     0,     0,   350,     0,
+     351,   352,     8,     0,   353,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,     0,     0,     0,    19,    20,
+      21,    22,     0,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,     0,    36,    37,     0,    38,    39,
+      40,     0,     0,     0,     0,     0,     0,    41,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,     0,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   239,   240,     0,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
+     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
+     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
+     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,     0,     0,     0,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     347,   348,   599,     0,     0,     0,     0,     0,     0,   349,
+       0,     0,     0,   350,     0,   351,   352,     0,     0,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+       0,    36,    37,     0,    38,    39,    40,     0,     0,     0,
+       0,     0,     0,    41,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,     0,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
+     236,   237,   238,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   239,   240,     0,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+       0,     0,     0,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   855,   856,     0,     0,     0,
+       0,     0,   857,     0,     0,     0,   347,   348,     0,     0,
+       0,     0,     0,     0,     0,   349,     0,     0,     0,   600,
+       0,   351,   352,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   858,   859,   860,   861,   862,   863,
+     864,   865,   866,   867,   868,   869,   870,   871,   872,   873,
+     874,   875,   876,   877,   878,   879,   880,   881,   882,   883,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,   899,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   900,
+     901,   902,   903,   904,   905,   906,   907,   908,   909,   910,
+     911,   912,   913,   914,   915,   916,   917,   918,   919,   920,
+     921,   922,   923,   924,   925,   926,   927,   928,   929,   930,
+     931,   932,   933,   934,   935,   936,   937,   938,   939,   940,
+     941,   942,   943,   944,   945,   946,   947,   948,   949,   950,
+     951,   952,   953,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   954
+  };
+
+  /* YYCHECK.  */
+  const short int
+  parser::yycheck_[] =
+  {
+        41,    42,   353,   531,    59,    60,    23,    49,   390,    57,
+      58,   391,   431,   350,   426,   425,   350,   425,    16,    17,
+      18,   433,   605,   606,   607,    23,    24,    25,    26,  1213,
+     426,   422,    30,    31,    32,    33,   422,   433,   375,   411,
+    1149,   425,   625,   434,   381,   978,   422,  1156,   434,  1158,
+     426,  1160,   425,  1162,   391,   426,   393,   394,   434,   396,
+     362,   395,   433,   400,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   458,   459,   460,   461,   462,   463,   464,   465,   466,
+     467,   468,   469,   470,   471,   472,   473,   474,   475,   476,
+     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
+     487,   488,   489,   425,   362,    46,   127,   128,   412,   413,
+     497,   498,   499,   500,   501,   502,   503,   504,   505,   506,
+     507,   508,   509,   510,   511,   512,   513,   514,   515,   516,
+     517,   518,   519,   520,   521,   522,   523,   524,   525,   526,
+     527,   528,   529,   530,   531,   532,   533,   534,   535,   536,
+     537,   538,   539,   540,   541,   542,   543,   544,   545,   546,
+     547,   548,   549,   550,   551,   552,   553,   554,   555,   556,
+     557,   558,   559,   560,   561,   562,   563,   564,   565,   566,
+     567,   568,   569,   816,   422,  1168,    48,   426,   422,   425,
+     591,   422,   426,   594,   433,   433,   434,   629,   630,   631,
+     434,   588,   422,  1186,   425,   592,   636,   425,   595,   426,
+     425,   598,   425,   600,   434,   425,   433,   604,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      16,    17,    18,   430,   426,  1469,   623,    23,    24,    25,
+      26,   433,   643,    40,    30,    31,    32,    33,   425,   636,
+      47,    48,   425,   605,   606,   607,   608,   609,   610,   611,
+     612,   613,   614,   615,   616,   617,   618,   619,   620,   621,
+     622,   362,  1431,   625,  1433,   422,  1435,   426,  1437,   426,
+    1439,   425,  1441,   425,   433,    55,    56,   434,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+     426,   422,   410,   411,   335,   426,   425,   433,   408,   426,
+     426,    53,    54,   434,   426,   392,   433,   433,   349,   434,
+     422,   433,   426,   426,   423,   424,   357,   358,   426,   433,
+     433,   612,   613,   614,   615,   433,   425,   605,   606,   607,
+     608,   609,   610,   611,   612,   613,   614,   615,   616,   617,
+     618,   619,   620,   621,   622,   426,   426,   625,   426,   426,
+     405,   426,   433,   433,   425,   433,   433,   425,   433,   426,
+     401,   402,   403,   404,   426,   426,   433,   426,   426,   426,
+     426,   433,   433,  1552,   433,   433,   433,   433,  1557,   426,
+     425,  1560,   409,   426,  1563,   425,   433,   985,   426,   336,
+     433,   338,   339,   340,   425,   433,   343,   344,   819,   346,
+     347,   348,   425,   350,   351,   352,   353,   354,   355,   356,
+     425,   426,   359,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,   426,   426,   426,    30,    31,    32,    33,
+     433,   433,   433,   426,   426,   425,  1615,   432,   433,  1618,
+     433,   433,  1621,   425,   816,   852,   414,   415,   416,   423,
+     424,    28,    29,   608,   609,   425,   610,   611,   569,   616,
+     617,   425,   425,   425,   429,   425,   425,   425,   425,   425,
+     425,  1650,   425,   425,   425,   425,   425,   425,   407,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   605,   606,   607,   608,   609,   610,
+     611,   612,   613,   614,   615,   616,   617,   618,   619,   620,
+     621,   622,   425,   425,   625,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   816,   425,
+     425,   425,   425,   406,   425,   425,   425,   425,   955,   425,
+     957,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   422,   423,   425,     0,   425,   425,   425,   425,   430,
+     425,   425,   425,   434,   425,   425,   425,   984,   425,   425,
+    1233,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     997,   425,   425,   425,   425,   425,   425,  1004,  1005,  1006,
+    1007,   425,   425,  1010,   425,   425,   425,   425,   435,   425,
+     425,  1018,   425,   985,  1021,   425,   425,   425,   425,  1026,
+     425,   425,   425,  1030,  1031,  1032,  1033,  1034,  1035,  1036,
+    1037,   422,   425,   425,  1041,  1042,   425,   425,   425,   430,
+     425,   425,   425,   434,   430,   425,   425,   425,   425,   430,
+    1057,   425,   425,   425,   425,   425,  1063,  1064,  1065,  1066,
+    1067,  1068,  1069,  1070,  1071,  1072,   425,   425,   425,   425,
+     425,   425,   425,   435,   425,   425,   425,   425,   425,   425,
+     425,   425,   147,   426,   423,  1092,  1093,  1094,  1095,   431,
+     431,  1098,  1099,   431,  1101,  1102,   426,   426,   426,  1106,
+     426,  1108,  1109,   426,  1111,   816,   426,  1114,   426,  1116,
+    1117,  1118,     8,   432,   426,   426,   410,   426,   426,  1126,
+     426,  1128,   426,  1130,  1131,  1132,  1133,   426,   426,  1136,
+    1137,   426,   433,   426,  1141,   426,  1143,   426,  1145,   426,
+    1147,   426,  1149,  1150,  1151,  1152,  1153,  1154,   426,   433,
+     433,   433,   433,   426,   426,   426,   426,   426,   426,   426,
+     426,   424,  1169,  1170,   426,   426,   426,  1174,   433,   433,
+     426,   426,  1179,  1180,   426,  1182,   433,   426,  1185,  1231,
+    1232,   426,  1189,  1190,  1191,   426,   433,  1194,  1195,   433,
+     433,   433,   426,   433,   433,   433,   433,   426,   426,  1220,
+     433,  1208,   433,   426,   426,  1212,   426,   426,   426,  1216,
+     426,   426,   426,   426,   426,   426,   426,  1189,  1190,  1191,
+     426,  1193,  1194,   426,   426,   426,   426,   426,   433,     9,
+      47,     4,  1219,   819,   426,   433,   433,   433,   433,   433,
+     433,  1213,   433,   433,   433,   426,   426,  1219,   426,   433,
+     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
+     426,  1233,   426,   426,   426,   426,    -1,   426,   433,   426,
+     362,  1519,   426,   433,   985,   433,   426,   433,   433,   426,
+     433,   433,   426,   426,   433,   433,   426,   433,   433,   426,
+     426,   433,  1313,   426,   433,   433,   426,   426,   426,   426,
+     426,   426,   426,   426,   618,   620,   426,    -1,   423,  1361,
+    1331,   433,   433,   426,   433,   433,   433,   433,   426,   433,
+     426,   433,   426,   426,   433,   426,   433,   423,   433,   423,
+     425,   433,   425,   433,   433,  1213,   433,   425,   425,   425,
+    1347,  1219,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,  1360,   425,  1233,   425,   425,   425,   425,
+     432,   425,   425,  1370,  1371,  1372,  1373,   425,   425,   425,
+     425,   425,   423,   426,   433,   425,   423,   426,   426,  1386,
+     432,  1388,  1389,  1390,  1391,  1392,  1393,  1394,  1395,  1396,
+    1397,  1398,   432,   431,  1401,   426,   431,   426,   426,  1406,
+     426,   426,   426,   426,   426,   426,  1413,  1414,   426,  1416,
+     426,   426,  1419,   425,   423,   423,  1423,   431,   425,  1426,
+     426,  1428,  1474,   426,  1431,   426,   426,   426,   433,   433,
+    1437,   433,  1439,   426,  1441,   426,   426,   426,   426,   426,
+     426,   426,   426,   426,   426,   426,    -1,   426,   381,    -1,
+      -1,    -1,    -1,   433,    -1,   433,   433,   433,   433,   433,
+     433,   433,   433,   433,   433,   433,   426,   426,   433,   426,
+     426,   426,   426,   426,   426,   433,   426,   426,   426,   426,
+     621,   426,   433,    -1,   426,   426,   425,   433,   426,  1461,
+     433,   426,  1464,   433,   426,   426,   433,  1469,   425,   425,
+     425,   425,  1213,   425,   425,   425,   425,    -1,  1219,   426,
+     426,   426,   426,   426,   426,   426,   426,   426,  1570,   426,
+     426,   426,  1233,  1530,  1531,  1532,  1533,  1534,  1535,  1536,
+    1537,  1538,  1539,  1540,   426,   426,   426,   426,   433,   433,
+    1547,  1548,  1549,   423,   426,   433,   423,   431,   426,   432,
+    1557,   432,   426,  1560,   426,   426,  1563,   432,   426,   426,
+    1567,   426,   622,   433,   433,    -1,    -1,   433,    -1,   433,
+     433,   433,   433,   433,   433,   433,   433,   426,   426,   426,
+     426,   426,   426,   433,   426,   619,   426,  1594,   426,  1596,
+     433,  1469,   433,   426,   426,   426,   426,  1604,  1605,  1606,
+     426,    -1,  1609,   432,  1611,   433,   431,   426,   426,   433,
+     426,   426,   426,   426,  1621,   426,  1623,   426,   426,   426,
+     426,   433,   426,   433,   426,   426,   426,   432,   426,   426,
+     426,  1638,   426,  1640,   426,   426,   426,   426,   433,   426,
+       3,    -1,     5,     6,     7,    -1,     9,    10,    11,  1656,
+      -1,    14,    -1,    -1,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    -1,    -1,    -1,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    50,    51,    52,
+      -1,    -1,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,  1469,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,    -1,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,   267,   268,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   289,   290,    -1,   292,
+     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
+     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
+     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,   358,   359,   360,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,   380,   381,   382,
+     383,   384,   385,    -1,    -1,    -1,   389,   390,   391,   392,
+     393,   394,   395,   396,   397,   398,   399,   400,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   412,
+     413,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   421,    -1,
+      -1,    -1,   425,    -1,   427,   428,    -1,    12,   431,    14,
+      -1,    -1,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    -1,    50,    51,    52,    -1,    -1,
+      -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,    -1,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,    -1,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   289,   290,    -1,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
+     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
+     385,    -1,    -1,    -1,   389,   390,   391,   392,   393,   394,
+     395,   396,   397,   398,   399,   400,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   412,   413,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   421,    -1,    -1,    -1,
+     425,    -1,   427,   428,    14,    -1,   431,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    -1,    -1,    -1,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
+      50,    51,    52,    -1,    -1,    -1,    -1,    -1,    -1,    59,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,    -1,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,    -1,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,
+     290,    -1,   292,   293,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
+     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   385,    -1,    -1,    -1,   389,
+     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
+     400,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   412,   413,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   421,    -1,    -1,    -1,   425,    -1,   427,   428,    -1,
+      14,   431,   432,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    -1,    -1,    -1,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    -1,    50,    51,    52,    -1,
+      -1,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,    -1,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,    -1,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   289,   290,    -1,   292,   293,
+     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
+     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
+     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,   358,   359,   360,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
+     384,   385,    -1,    -1,    -1,   389,   390,   391,   392,   393,
+     394,   395,   396,   397,   398,   399,   400,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   412,   413,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   421,    -1,    -1,
+      -1,   425,    -1,   427,   428,    -1,    14,   431,   432,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    50,    51,    52,    -1,    -1,    -1,    -1,    -1,
+      -1,    59,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,    -1,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,    -1,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
+     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   289,   290,    -1,   292,   293,   294,   295,   296,
-     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
-     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
-     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
-     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
-     367,   368,   369,   370,   371,   372,   373,   374,   375,   376,
-     377,   378,   379,   380,   381,   382,   383,   384,   385,    -1,
-      -1,    -1,   389,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   408,   409,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     417,    -1,    -1,    -1,   421,    -1,   423,   424,    -1,    12,
-     427,    14,    -1,    -1,    17,    18,    19,    20,    21,    22,
+      -1,   289,   290,    -1,   292,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
+     358,   359,   360,   361,   362,   363,   364,   365,   366,   367,
+     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,   380,   381,   382,   383,   384,   385,    -1,    -1,
+      -1,   389,   390,   391,   392,   393,   394,   395,   396,   397,
+     398,   399,   400,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   412,   413,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   421,    -1,    -1,   424,   425,    -1,   427,
+     428,    14,    -1,   431,    17,    18,    19,    20,    21,    22,
       23,    24,    25,    26,    -1,    -1,    -1,    30,    31,    32,
       33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
       43,    44,    45,    46,    47,    48,    -1,    50,    51,    52,
@@ -5152,91 +5400,9 @@ namespace yy {
      373,   374,   375,   376,   377,   378,   379,   380,   381,   382,
      383,   384,   385,    -1,    -1,    -1,   389,   390,   391,   392,
      393,   394,   395,   396,   397,   398,   399,   400,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   408,   409,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   417,    -1,    -1,    -1,   421,    -1,
-     423,   424,    14,    -1,   427,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,    -1,    -1,    -1,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    -1,    50,    51,
-      52,    -1,    -1,    -1,    -1,    -1,    -1,    59,    60,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,
-      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   146,    -1,   148,   149,   150,   151,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
-     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
-     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
-     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
-     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
-     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
-     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-     262,   263,   264,   265,   266,   267,   268,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,   290,    -1,
-     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
-     312,   313,   314,   315,   316,   317,   318,   319,   320,   321,
-     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
-     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
-     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
-     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
-     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
-     382,   383,   384,   385,    -1,    -1,    -1,   389,   390,   391,
-     392,   393,   394,   395,   396,   397,   398,   399,   400,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   408,   409,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   417,    -1,    -1,    -1,   421,
-      -1,   423,   424,    -1,    14,   427,   428,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    -1,    -1,    -1,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
-      50,    51,    52,    -1,    -1,    -1,    -1,    -1,    -1,    59,
-      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,    -1,   148,   149,
-     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   267,   268,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,
-     290,    -1,   292,   293,   294,   295,   296,   297,   298,   299,
-     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
-     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
-     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
-     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
-     380,   381,   382,   383,   384,   385,    -1,    -1,    -1,   389,
-     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-     400,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   408,   409,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   417,    -1,    -1,
-      -1,   421,    -1,   423,   424,    -1,    14,   427,   428,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   412,
+     413,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   421,    -1,
+      -1,   424,   425,    -1,   427,   428,    14,    -1,   431,    17,
       18,    19,    20,    21,    22,    23,    24,    25,    26,    -1,
       -1,    -1,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
@@ -5276,8 +5442,50 @@ namespace yy {
      378,   379,   380,   381,   382,   383,   384,   385,    -1,    -1,
       -1,   389,   390,   391,   392,   393,   394,   395,   396,   397,
      398,   399,   400,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     408,   409,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   417,
-      -1,    -1,   420,   421,    -1,   423,   424,    14,    -1,   427,
+      -1,    -1,    -1,    -1,   412,   413,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   421,    -1,    -1,    -1,   425,   426,   427,
+     428,    -1,    14,   431,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    -1,    -1,    -1,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    50,    51,
+      52,    -1,    -1,    -1,    -1,    -1,    -1,    59,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,    -1,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,   290,    -1,
+     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     312,   313,   314,   315,   316,   317,   318,   319,   320,   321,
+     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+     382,   383,   384,   385,    -1,    -1,    -1,   389,   390,   391,
+     392,   393,   394,   395,   396,   397,   398,   399,   400,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     412,   413,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   421,
+      -1,    -1,    -1,   425,    -1,   427,   428,    14,    -1,   431,
       17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
       -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
       37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
@@ -5312,137 +5520,14 @@ namespace yy {
      327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
      337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
      347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
-     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
-     367,   368,   369,   370,   371,   372,   373,   374,   375,   376,
-     377,   378,   379,   380,   381,   382,   383,   384,   385,    -1,
-      -1,    -1,   389,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   408,   409,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     417,    -1,    -1,   420,   421,    -1,   423,   424,    14,    -1,
-     427,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    -1,    50,    51,    52,    -1,    -1,    -1,
-      -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,    -1,   148,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
-     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
-     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
-     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-     266,   267,   268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   289,   290,    -1,   292,   293,   294,   295,
-     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
-     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
-     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
-     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
-     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
-     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
-     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
-     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
-      -1,    -1,    -1,   389,   390,   391,   392,   393,   394,   395,
-     396,   397,   398,   399,   400,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   408,   409,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   417,    -1,    -1,    -1,   421,   422,   423,   424,    -1,
-      14,   427,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,    -1,    -1,    -1,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    -1,    50,    51,    52,    -1,
-      -1,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,    72,    73,
-      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,    -1,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
-     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
-     264,   265,   266,   267,   268,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   289,   290,    -1,   292,   293,
-     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
-     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
-     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
-     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
-     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
-     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
-     354,   355,   356,   357,   358,   359,   360,   361,   362,   363,
-     364,   365,   366,   367,   368,   369,   370,   371,   372,   373,
-     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
-     384,   385,    -1,    -1,    -1,   389,   390,   391,   392,   393,
-     394,   395,   396,   397,   398,   399,   400,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   408,   409,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   417,    -1,    -1,    -1,   421,    -1,   423,
-     424,    14,    -1,   427,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    -1,    -1,    -1,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    48,    -1,    50,    51,    52,
-      -1,    -1,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,    72,
-      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,    -1,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,    -1,   148,   149,   150,   151,   152,
-     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
-     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
-     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
-     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
-     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   289,   290,    -1,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
-     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
-     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
-     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
-     353,   354,   355,   356,   357,   358,   359,   360,   361,   362,
-     363,   364,   365,   366,   367,   368,   369,   370,   371,   372,
-     373,   374,   375,   376,   377,   378,   379,   380,   381,   382,
-     383,   384,   385,    -1,    -1,    -1,   389,   390,   391,   392,
-     393,   394,   395,   396,   397,   398,   399,   400,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   408,   409,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   417,    -1,   419,    -1,   421,    -1,
-     423,   424,    14,    -1,   427,    17,    18,    19,    20,    21,
+     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,   371,   372,   373,   374,   375,   376,
+     377,   378,   379,   380,   381,   382,   383,   384,   385,    -1,
+      -1,    -1,   389,   390,   391,   392,   393,   394,   395,   396,
+     397,   398,   399,   400,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   412,   413,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   421,    -1,   423,    -1,   425,    -1,
+     427,   428,    14,    -1,   431,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    26,    -1,    -1,    -1,    30,    31,
       32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
       42,    43,    44,    45,    46,    47,    48,    -1,    50,    51,
@@ -5481,131 +5566,132 @@ namespace yy {
      372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
      382,   383,   384,   385,    -1,    -1,    -1,   389,   390,   391,
      392,   393,   394,   395,   396,   397,   398,   399,   400,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   408,   409,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   417,    -1,   419,    -1,   421,
-      -1,   423,   424,    14,    -1,   427,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    -1,    -1,    -1,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    -1,    50,
-      51,    52,    -1,    -1,    -1,    -1,    -1,    -1,    59,    60,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
-      -1,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,    -1,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
-     171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
-     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
-     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   266,   267,   268,    -1,    -1,
+     412,   413,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   421,
+      -1,   423,    -1,   425,    -1,   427,   428,    14,    -1,   431,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    50,    51,    52,    -1,    -1,    -1,    -1,
+      -1,    -1,    59,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,    -1,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+      -1,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,   290,
-      -1,   292,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
-     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
-     351,   352,   353,   354,   355,   356,   357,   358,   359,   360,
-     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
-     371,   372,   373,   374,   375,   376,   377,   378,   379,   380,
-     381,   382,   383,   384,   385,    -1,    -1,    -1,   389,   390,
-     391,   392,   393,   394,   395,   396,   397,   398,   399,   400,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   408,   409,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   417,    -1,    -1,    -1,
-     421,    -1,   423,   424,    14,    -1,   427,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    -1,    -1,    -1,
-      30,    31,    32,    33,    -1,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    -1,    47,    48,    -1,
-      50,    51,    52,    -1,    -1,    -1,    -1,    -1,    -1,    59,
-      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,    -1,   148,   149,
-     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   267,   268,    -1,
+      -1,    -1,   289,   290,    -1,   292,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,   371,   372,   373,   374,   375,   376,
+     377,   378,   379,   380,   381,   382,   383,   384,   385,    -1,
+      -1,    -1,   389,   390,   391,   392,   393,   394,   395,   396,
+     397,   398,   399,   400,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   412,   413,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   421,    -1,    -1,    -1,   425,    -1,
+     427,   428,    14,    -1,   431,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    -1,    -1,    -1,    30,    31,
+      32,    33,    -1,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    -1,    47,    48,    -1,    50,    51,
+      52,    -1,    -1,    -1,    -1,    -1,    -1,    59,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,    -1,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,
-     290,    -1,   292,   293,   294,   295,   296,   297,   298,   299,
-     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
-     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
-     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
-     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
-     380,   381,   382,   383,   384,   385,    -1,    -1,    -1,   389,
-     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-     400,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   408,   409,
-      18,    -1,    -1,    -1,    -1,    -1,    -1,   417,    -1,    -1,
-      -1,   421,    -1,   423,   424,    -1,    -1,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    -1,    47,
-      48,    -1,    50,    51,    52,    -1,    -1,    -1,    -1,    -1,
-      -1,    59,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    71,    72,    73,    74,    75,    76,    77,
-      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
-     138,   139,   140,   141,   142,   143,   144,   145,   146,    -1,
-     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
-     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
-     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
-     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
-     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
-     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
-     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
-     268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,   290,    -1,
+     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     312,   313,   314,   315,   316,   317,   318,   319,   320,   321,
+     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+     382,   383,   384,   385,    -1,    -1,    -1,   389,   390,   391,
+     392,   393,   394,   395,   396,   397,   398,   399,   400,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   289,   290,    -1,   292,   293,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
-     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
-     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
-     358,   359,   360,   361,   362,   363,   364,   365,   366,   367,
-     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
-     378,   379,   380,   381,   382,   383,   384,   385,    -1,    -1,
-      -1,   389,   390,   391,   392,   393,   394,   395,   396,   397,
-     398,   399,   400,    -1,    -1,    39,    40,    -1,    -1,    -1,
-     408,   409,    46,    -1,    -1,    -1,    -1,    -1,    -1,   417,
-      -1,    -1,    -1,   421,    -1,   423,   424,    -1,    -1,    -1,
+     412,   413,    18,    -1,    -1,    -1,    -1,    -1,    -1,   421,
+      -1,    -1,    -1,   425,    -1,   427,   428,    -1,    -1,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      -1,    47,    48,    -1,    50,    51,    52,    -1,    -1,    -1,
+      -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,    -1,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,    -1,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   289,   290,    -1,   292,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+      -1,    -1,    -1,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   398,   399,   400,    39,    40,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,   412,   413,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   421,    -1,    -1,    -1,   425,
+      -1,   427,   428,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
@@ -5672,134 +5758,138 @@ namespace yy {
      361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
      371,   372,   373,   374,   375,   376,   377,   378,   379,   380,
      381,   382,   383,   384,   385,   389,   390,   391,   392,   393,
-     394,   395,   396,   397,   398,   399,   400,   408,   409,   417,
-     421,   423,   424,   427,   433,   434,   435,   436,   437,   438,
-     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
-     449,   450,   451,   452,   454,   457,   459,   463,   464,   465,
-     466,   467,   468,   469,   470,   471,   472,   473,   474,   475,
-     427,   421,   421,   421,   421,   407,   421,   435,   433,   433,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   418,
-     459,   464,   428,   454,   455,   456,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    70,   418,   426,
-     430,   453,   418,   426,   418,   430,    49,   418,    18,   421,
-     433,   434,   439,   457,   410,   411,   412,   408,   409,    55,
-      56,    57,    58,   406,   407,    53,    54,   405,   404,   403,
-     402,   401,   425,   464,   421,   431,   464,   466,   427,   427,
-     427,   431,     0,   468,   464,   465,   435,   464,   464,    18,
-     459,   464,   426,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   422,   422,   422,   422,   422,   422,   422,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   436,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   433,   464,   422,   422,   428,   429,   464,
-     336,   338,   339,   340,   343,   344,   346,   347,   348,   350,
-     351,   352,   353,   354,   355,   356,   359,   454,   464,    12,
-     454,   420,   464,   147,    39,    40,    46,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
-     171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
-     181,   182,   183,   184,   185,   186,   187,   188,   189,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
-     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   319,   420,   464,   418,   464,   440,   440,
-     440,   442,   442,   443,   443,   444,   444,   444,   444,   445,
-     445,   446,   447,   448,   449,   450,   464,   419,   440,   468,
-     468,   468,   428,   465,     8,   422,   422,   406,   422,   454,
-     422,   422,   422,   422,   422,   422,   429,   422,   422,   422,
-     422,   422,   422,   429,   429,   429,   429,   422,   422,   429,
-     422,   422,   422,   422,   422,   422,   422,   429,   422,   422,
-     429,   422,   422,   422,   422,   429,   422,   422,   422,   429,
-     429,   429,   429,   429,   429,   429,   429,   422,   422,   422,
-     429,   429,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   422,   422,   422,   422,   422,   429,   422,   422,   422,
-     422,   422,   429,   429,   429,   429,   429,   429,   429,   429,
-     429,   429,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   422,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   429,   429,   429,   429,   422,   422,   429,   429,   422,
-     429,   429,   422,   422,   422,   429,   422,   429,   429,   422,
-     429,   422,   422,   429,   422,   429,   429,   429,   422,   422,
-     422,   422,   422,   422,   422,   429,   422,   429,   422,   429,
-     429,   429,   429,   422,   422,   429,   429,   422,   422,   422,
-     429,   422,   429,   422,   429,   422,   429,   422,   429,   429,
-     429,   429,   429,   429,   422,   429,   422,   429,   422,   429,
-     422,   429,   419,   419,   440,   428,   455,   419,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   419,    16,    17,    18,    23,
-      24,    25,    26,    30,    31,    32,    33,   421,   458,   464,
-     419,   420,   421,   464,   419,   420,   464,   419,   420,   453,
-     422,   428,   428,   428,     9,   422,   464,   433,   434,   436,
-     427,   427,   421,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,    17,    18,    23,    24,    25,    26,    30,    31,    32,
-      33,   458,   464,   464,   464,   464,   464,   464,   458,   458,
-     458,   458,   453,   464,   464,   422,   422,   422,   464,   422,
-     422,   422,   422,   464,   464,   422,   464,   422,   422,   464,
-     453,   464,   421,   419,   419,   464,   452,   461,   462,   419,
-     419,   464,   419,   451,   454,   421,   427,   422,   422,   422,
-     422,   468,   468,   440,   422,   429,   429,   429,   429,   422,
-     422,   422,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   429,   422,   429,   429,   429,   429,   429,   429,   429,
-     429,   429,   429,   429,   422,   422,   429,   422,   422,   422,
-     422,   429,   422,   422,   422,   422,   422,   422,   429,   429,
-     422,   429,   422,   422,   429,   422,   422,   422,   429,   422,
-     422,   429,   422,   429,   422,   422,   429,   422,   429,   422,
-     429,   422,   429,   422,   429,   422,   429,   422,   422,   422,
-     422,   454,   422,   422,   422,   422,   422,   422,   422,   454,
-     422,   429,   464,   419,   429,   422,   419,   464,   468,   427,
-     428,   428,   422,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   464,   464,   458,   464,
-     458,   458,   458,   464,   458,   464,   458,   464,    28,    29,
-     460,   422,   429,   452,   422,   428,   468,     4,   422,   422,
-     422,   422,   422,   429,   429,   429,   429,   429,   429,   429,
-     429,   429,   429,   429,   422,   422,   422,   422,   422,   422,
-     429,   429,   429,   422,   422,   429,   422,   422,   422,   422,
-     429,   422,   422,   429,   422,   422,   429,   422,   429,   460,
-     428,   427,   464,   464,   464,   464,   464,   464,   464,   464,
-     464,   464,   464,   464,   464,   464,   458,   458,   464,   458,
-     464,   458,   464,   464,   422,   429,   468,   429,   422,   422,
-     422,   422,   422,   422,   422,   429,   429,   429,   422,   422,
-     429,   422,   429,   422,   422,   422,   429,   422,   422,   429,
-     422,   422,   429,   422,   429,   464,   428,   464,   464,   464,
-     464,   464,   464,   458,   458,   458,   464,   464,   422,   429,
-     422,   429,   422,   422,   422,   422,   422,   422,   422,   422,
-     422,   429,   422,   464,   464,   458,   422,   429,   422,   464,
-     422
+     394,   395,   396,   397,   398,   399,   400,   412,   413,   421,
+     425,   427,   428,   431,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   458,   461,   463,   467,   468,   469,
+     470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
+     431,   425,   425,   425,   425,   411,   425,   439,   437,   437,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   422,
+     463,   468,   432,   458,   459,   460,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,   422,   430,
+     434,   457,   422,   434,   430,   422,   434,    49,   422,    18,
+     425,   437,   438,   443,   461,   414,   415,   416,   412,   413,
+      55,    56,    57,    58,   410,   411,    53,    54,   409,   408,
+     407,   406,   405,   429,   468,   425,   435,   468,   470,   431,
+     431,   431,   435,     0,   472,   468,   469,   439,   468,   468,
+      18,   463,   468,   430,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   426,   426,   426,   426,   426,   426,
+     426,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   440,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   437,   468,   426,   426,   432,   433,
+     468,   336,   338,   339,   340,   343,   344,   346,   347,   348,
+     350,   351,   352,   353,   354,   355,   356,   359,   458,   468,
+     127,   128,   335,   349,   357,   358,   401,   402,   403,   404,
+      12,   458,   424,   468,   147,    39,    40,    46,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   319,   424,   468,   422,   468,   444,
+     444,   444,   446,   446,   447,   447,   448,   448,   448,   448,
+     449,   449,   450,   451,   452,   453,   454,   468,   423,   444,
+     472,   472,   472,   432,   469,     8,   426,   426,   410,   426,
+     458,   426,   426,   426,   426,   426,   426,   433,   426,   426,
+     426,   426,   426,   426,   433,   433,   433,   433,   426,   426,
+     433,   426,   426,   426,   426,   426,   426,   426,   433,   426,
+     426,   433,   426,   426,   426,   426,   433,   426,   426,   426,
+     433,   433,   433,   433,   433,   433,   433,   433,   426,   426,
+     426,   433,   433,   426,   426,   426,   426,   426,   426,   426,
+     426,   426,   426,   426,   426,   426,   426,   433,   426,   426,
+     426,   426,   426,   433,   433,   433,   433,   433,   433,   433,
+     433,   433,   433,   426,   426,   426,   426,   426,   426,   426,
+     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
+     426,   426,   433,   433,   433,   433,   426,   426,   433,   433,
+     426,   433,   433,   426,   426,   426,   433,   426,   433,   433,
+     426,   433,   426,   426,   433,   426,   433,   433,   433,   426,
+     426,   426,   426,   426,   426,   426,   433,   426,   433,   426,
+     433,   433,   433,   433,   426,   426,   433,   433,   426,   426,
+     426,   433,   426,   433,   426,   433,   426,   433,   426,   433,
+     433,   433,   433,   433,   433,   426,   433,   426,   433,   426,
+     433,   426,   433,   423,   423,   444,   432,   459,   423,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   423,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   425,    16,    17,    18,
+      23,    24,    25,    26,    30,    31,    32,    33,   425,   462,
+     468,   423,   424,   425,   468,   423,   424,   468,   423,   424,
+     457,   426,   432,   432,   432,     9,   426,   468,   437,   438,
+     440,   431,   431,   425,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,    17,    18,    23,    24,    25,    26,    30,    31,
+      32,    33,   462,   468,   468,   468,   468,   468,   468,   462,
+     462,   462,   462,   457,   468,   468,   426,   426,   426,   468,
+     426,   426,   426,   426,   468,   468,   426,   468,   426,   426,
+     468,   457,   426,   426,   438,   468,   438,   468,   438,   468,
+     426,   438,   438,   468,   468,   426,   468,   425,   423,   423,
+     468,   456,   465,   466,   423,   423,   468,   423,   455,   458,
+     425,   431,   426,   426,   426,   426,   472,   472,   444,   426,
+     433,   433,   433,   433,   426,   426,   426,   426,   426,   426,
+     426,   426,   426,   426,   426,   426,   433,   426,   433,   433,
+     433,   433,   433,   433,   433,   433,   433,   433,   433,   426,
+     426,   433,   426,   426,   426,   426,   433,   426,   426,   426,
+     426,   426,   426,   433,   433,   426,   433,   426,   426,   433,
+     426,   426,   426,   433,   426,   426,   433,   426,   433,   426,
+     426,   433,   426,   433,   426,   433,   426,   433,   426,   433,
+     426,   433,   426,   426,   426,   426,   458,   426,   426,   426,
+     426,   426,   426,   426,   458,   426,   426,   426,   426,   426,
+     426,   433,   426,   426,   433,   426,   433,   468,   423,   433,
+     426,   423,   468,   472,   431,   432,   432,   426,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   462,   468,   462,   462,   462,   468,   462,
+     468,   462,   468,   438,   438,    28,    29,   464,   426,   433,
+     456,   426,   432,   472,     4,   426,   426,   426,   426,   426,
+     433,   433,   433,   433,   433,   433,   433,   433,   433,   433,
+     433,   426,   426,   426,   426,   426,   426,   433,   433,   433,
+     426,   426,   433,   426,   426,   426,   426,   433,   426,   426,
+     433,   426,   426,   433,   426,   426,   426,   433,   464,   432,
+     431,   468,   468,   468,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   468,   468,   462,   462,   468,   462,   468,
+     462,   468,   468,   426,   433,   472,   433,   426,   426,   426,
+     426,   426,   426,   426,   433,   433,   433,   426,   426,   433,
+     426,   433,   426,   426,   426,   433,   426,   426,   433,   426,
+     426,   433,   426,   433,   468,   432,   468,   468,   468,   468,
+     468,   468,   462,   462,   462,   468,   468,   426,   433,   426,
+     433,   426,   426,   426,   426,   426,   426,   426,   426,   426,
+     433,   426,   468,   468,   462,   426,   433,   426,   468,   426
   };
 
 #if YYDEBUG
@@ -5848,10 +5938,10 @@ namespace yy {
      625,   626,   627,   628,   629,   630,   631,   632,   633,   634,
      635,   636,   637,   638,   639,   640,   641,   642,   643,   644,
      645,   646,   647,   648,   649,   650,   651,   652,   653,   654,
-     655,   656,   657,   124,    94,    38,    62,    60,    43,    45,
-      42,    47,    37,   658,   659,   660,   661,    36,    91,    93,
-      58,    40,    41,   126,    33,    63,    61,   123,   125,    44,
-      46,    59
+     655,   656,   657,   658,   659,   660,   661,   124,    94,    38,
+      62,    60,    43,    45,    42,    47,    37,   662,   663,   664,
+     665,    36,    91,    93,    58,    40,    41,   126,    33,    63,
+      61,   123,   125,    44,    46,    59
   };
 #endif
 
@@ -5859,69 +5949,71 @@ namespace yy {
   const unsigned short int
   parser::yyr1_[] =
   {
-         0,   432,   433,   434,   435,   436,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
-     437,   437,   437,   437,   437,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   438,   438,   438,   438,   438,   438,   438,   438,
-     438,   438,   439,   439,   439,   439,   440,   440,   440,   440,
-     441,   441,   441,   441,   442,   442,   442,   442,   443,   443,
-     443,   444,   444,   444,   445,   445,   445,   445,   445,   446,
-     446,   446,   447,   447,   448,   448,   449,   449,   450,   450,
-     451,   451,   452,   452,   453,   453,   453,   453,   453,   453,
-     453,   453,   453,   453,   453,   454,   454,   454,   454,   454,
-     454,   454,   454,   454,   454,   454,   454,   454,   454,   454,
-     454,   454,   454,   455,   456,   456,   457,   457,   457,   457,
-     457,   457,   457,   457,   457,   457,   457,   458,   458,   458,
-     458,   458,   458,   458,   458,   458,   458,   458,   459,   459,
-     459,   459,   459,   459,   459,   459,   459,   459,   459,   459,
-     459,   459,   460,   460,   461,   461,   462,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
+         0,   436,   437,   438,   439,   440,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   441,   441,   441,   441,   441,
+     441,   441,   441,   441,   441,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   442,   442,   442,   442,   442,   442,   442,   442,
+     442,   442,   443,   443,   443,   443,   444,   444,   444,   444,
+     445,   445,   445,   445,   446,   446,   446,   446,   447,   447,
+     447,   448,   448,   448,   449,   449,   449,   449,   449,   450,
+     450,   450,   451,   451,   452,   452,   453,   453,   454,   454,
+     455,   455,   456,   456,   457,   457,   457,   457,   457,   457,
+     457,   457,   457,   457,   457,   458,   458,   458,   458,   458,
+     458,   458,   458,   458,   458,   458,   458,   458,   458,   458,
+     458,   458,   458,   459,   460,   460,   461,   461,   461,   461,
+     461,   461,   461,   461,   461,   461,   461,   462,   462,   462,
+     462,   462,   462,   462,   462,   462,   462,   462,   463,   463,
      463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
-     463,   463,   463,   464,   465,   465,   465,   465,   466,   467,
-     467,   468,   468,   468,   469,   470,   471,   472,   472,   472,
-     472,   472,   472,   472,   473,   473,   474,   474,   475
+     463,   463,   464,   464,   465,   465,   466,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
+     467,   467,   467,   467,   467,   467,   467,   468,   469,   469,
+     469,   469,   470,   471,   471,   472,   472,   472,   473,   474,
+     475,   476,   476,   476,   476,   476,   476,   476,   477,   477,
+     478,   478,   479
   };
 
   /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -5981,16 +6073,18 @@ namespace yy {
        4,     5,     6,     6,     8,     4,     5,     4,     5,     4,
        5,     6,     4,     5,     6,     6,     6,     6,     4,     5,
        6,     6,     4,     5,     4,     5,     6,     4,     6,     6,
-       8,     8,     4,     4,     4,     4,     4,     4,     4,     6,
-       4,     8,     4,     6,     6,     8,     6,     4,     4,     6,
-       6,     4,     4,     4,    10,     4,     6,     4,     6,    10,
-      12,     4,     6,    10,    12,     6,     8,    10,     8,    10,
-      12,    10,     8,     8,     6,     6,     4,     8,     6,     8,
-       6,    12,    10,    10,     8,     8,     6,    14,    12,    12,
-      10,    10,     8,     8,     6,     6,     4,     6,     4,     6,
-       4,     6,     4,     1,     2,     1,     1,     2,     1,     1,
-       2,     1,     1,     2,     6,     6,     6,     7,     8,     9,
-       8,     4,     4,     4,     7,    11,     1,     1,     1
+       6,     6,     8,     6,     6,     5,     5,     6,     6,     8,
+       5,     6,     6,     5,     8,     8,     4,     4,     4,     4,
+       4,     4,     4,     6,     4,     8,     4,     6,     6,     8,
+       6,     4,     4,     6,     6,     4,     4,     4,    10,     4,
+       6,     4,     6,    10,    12,     4,     6,    10,    12,     6,
+       8,    10,     8,    10,    12,    10,     8,     8,     6,     6,
+       4,     8,     6,     8,     6,    12,    10,    10,     8,     8,
+       6,    14,    12,    12,    10,    10,     8,     8,     6,     6,
+       4,     6,     4,     6,     4,     6,     4,     1,     2,     1,
+       1,     2,     1,     1,     2,     1,     1,     2,     6,     6,
+       6,     7,     8,     9,     8,     4,     4,     4,     7,    11,
+       1,     1,     1
   };
 
 #if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
@@ -6090,17 +6184,18 @@ namespace yy {
   "EE_CUM_SIMPSON", "EE_CUM_TRAPEZOID", "EE_ROMB", "EE_SIMPSON",
   "EE_TRAPEZOID", "EE_ARANGE", "EE_FULL", "EE_FULL_LIKE", "EE_GEOMSPACE",
   "EE_LINSPACE", "EE_LOGSPACE", "EE_ONES", "EE_ONES_LIKE", "EE_ZEROS",
-  "EE_ZEROS_LIKE", "EE_OR", "EE_AND", "'|'", "'^'", "'&'", "'>'", "'<'",
-  "'+'", "'-'", "'*'", "'/'", "'%'", "EE_LOG_NOT", "EE_UNARY_1SCOMPL",
-  "EE_UPLUS", "EE_UMINUS", "'$'", "'['", "']'", "':'", "'('", "')'", "'~'",
-  "'!'", "'?'", "'='", "'{'", "'}'", "','", "'.'", "';'", "$accept",
-  "custom_var", "array_var", "identifier", "string", "basic_expr",
-  "postfix_exp", "unary_exp", "cast_exp", "unary_operator",
-  "multiplicative_exp", "additive_exp", "shift_exp", "relational_exp",
-  "equality_exp", "logical_and_exp", "logical_xor_exp", "logical_or_exp",
-  "and_exp", "or_exp", "conditional_exp", "assignment_op",
-  "assignment_exp", "initializer", "initializer_list", "address_type",
-  "backing_type", "cast_type", "backing_persistence", "argument_exp_entry",
+  "EE_ZEROS_LIKE", "EE_CONVOLVE", "EE_DIV", "EE_RESAMPLE", "EE_RMS",
+  "EE_OR", "EE_AND", "'|'", "'^'", "'&'", "'>'", "'<'", "'+'", "'-'",
+  "'*'", "'/'", "'%'", "EE_LOG_NOT", "EE_UNARY_1SCOMPL", "EE_UPLUS",
+  "EE_UMINUS", "'$'", "'['", "']'", "':'", "'('", "')'", "'~'", "'!'",
+  "'?'", "'='", "'{'", "'}'", "','", "'.'", "';'", "$accept", "custom_var",
+  "array_var", "identifier", "string", "basic_expr", "postfix_exp",
+  "unary_exp", "cast_exp", "unary_operator", "multiplicative_exp",
+  "additive_exp", "shift_exp", "relational_exp", "equality_exp",
+  "logical_and_exp", "logical_xor_exp", "logical_or_exp", "and_exp",
+  "or_exp", "conditional_exp", "assignment_op", "assignment_exp",
+  "initializer", "initializer_list", "address_type", "backing_type",
+  "cast_type", "backing_persistence", "argument_exp_entry",
   "argument_exp_list", "intrinsic", "exp", "exp_statement", "statement",
   "compound_statement", "statement_list", "foreach_decl0", "foreach_decl1",
   "foreach_decl2", "iteration_exp", "selection_exp", "jump_exp",
@@ -6113,12 +6208,12 @@ namespace yy {
   const parser::rhs_number_type
   parser::yyrhs_[] =
   {
-       475,     0,    -1,    48,    -1,    47,    -1,    46,    -1,    40,
-      -1,   436,    -1,   433,    -1,    52,    -1,    50,    -1,   417,
-     418,   433,   419,    -1,   434,   418,   464,   419,    -1,   436,
-     418,   464,   419,    -1,   436,   418,   464,   420,   464,   419,
-      -1,   436,   418,   464,   420,   419,    -1,   436,   418,   420,
-     464,   419,    -1,   417,   418,   464,   419,    -1,    51,    -1,
+       479,     0,    -1,    48,    -1,    47,    -1,    46,    -1,    40,
+      -1,   440,    -1,   437,    -1,    52,    -1,    50,    -1,   421,
+     422,   437,   423,    -1,   438,   422,   468,   423,    -1,   440,
+     422,   468,   423,    -1,   440,   422,   468,   424,   468,   423,
+      -1,   440,   422,   468,   424,   423,    -1,   440,   422,   424,
+     468,   423,    -1,   421,   422,   468,   423,    -1,    51,    -1,
       41,    -1,    37,    -1,    38,    -1,    39,    -1,    42,    -1,
       43,    -1,    45,    -1,    44,    -1,    35,    -1,    36,    -1,
      179,    -1,   167,    -1,   161,    -1,   189,    -1,   165,    -1,
@@ -6145,81 +6240,81 @@ namespace yy {
      253,    -1,   254,    -1,   255,    -1,   256,    -1,   257,    -1,
      258,    -1,   259,    -1,   260,    -1,   261,    -1,   262,    -1,
      263,    -1,   264,    -1,   265,    -1,   266,    -1,   267,    -1,
-     268,    -1,   319,    -1,   303,    -1,   304,    -1,   421,   464,
-     422,    -1,   457,   464,   419,    -1,   463,    -1,   437,    -1,
-     433,    59,    -1,   433,    60,    -1,   438,    49,    46,    -1,
-     438,    49,    40,    -1,   438,    49,    39,    -1,   438,    49,
-     161,    -1,   438,    49,   179,    -1,   438,    49,   167,    -1,
-     438,    49,   189,    -1,   438,    49,   165,    -1,   438,    49,
-     163,    -1,   438,    49,   170,    -1,   438,    49,   148,    -1,
-     438,    49,   174,    -1,   438,    49,   151,    -1,   438,    49,
-     166,    -1,   438,    49,   168,    -1,   438,    49,   177,    -1,
-     438,    49,   175,    -1,   438,    49,   157,    -1,   438,    49,
-     156,    -1,   438,    49,   172,    -1,   438,    49,   154,    -1,
-     438,    49,   183,    -1,   438,    49,   149,    -1,   438,    49,
-     153,    -1,   438,    49,   158,    -1,   438,    49,   171,    -1,
-     438,    49,   187,    -1,   438,    49,   188,    -1,   438,    49,
-     159,    -1,   438,    49,   186,    -1,   438,    49,   180,    -1,
-     438,    49,   184,    -1,   438,    49,   155,    -1,   438,    49,
-     181,    -1,   438,    49,   169,    -1,   438,    49,   162,    -1,
-     438,    49,   176,    -1,   438,    49,   152,    -1,   438,    49,
-     178,    -1,   438,    49,   150,    -1,   438,    49,   185,    -1,
-     438,    49,   164,    -1,   438,    49,   173,    -1,   438,    49,
-     182,    -1,   438,    49,   160,    -1,   438,    49,   203,    -1,
-     438,    49,   204,    -1,   438,    49,   205,    -1,   438,    49,
-     206,    -1,   438,    49,   207,    -1,   438,    49,   208,    -1,
-     438,    49,   209,    -1,   438,    49,   210,    -1,   438,    49,
-     211,    -1,   438,    49,   212,    -1,   438,    49,   213,    -1,
-     438,    49,   214,    -1,   438,    49,   215,    -1,   438,    49,
-     216,    -1,   438,    49,   217,    -1,   438,    49,   218,    -1,
-     438,    49,   219,    -1,   438,    49,   220,    -1,   438,    49,
-     221,    -1,   438,    49,   222,    -1,   438,    49,   223,    -1,
-     438,    49,   224,    -1,   438,    49,   225,    -1,   438,    49,
-     226,    -1,   438,    49,   227,    -1,   438,    49,   228,    -1,
-     438,    49,   229,    -1,   438,    49,   230,    -1,   438,    49,
-     231,    -1,   438,    49,   232,    -1,   438,    49,   233,    -1,
-     438,    49,   234,    -1,   438,    49,   235,    -1,   438,    49,
-     236,    -1,   438,    49,   237,    -1,   438,    49,   238,    -1,
-     438,    49,   239,    -1,   438,    49,   240,    -1,   438,    49,
-     241,    -1,   438,    49,   242,    -1,   438,    49,   243,    -1,
-     438,    49,   244,    -1,   438,    49,   245,    -1,   438,    49,
-     246,    -1,   438,    49,   247,    -1,   438,    49,   248,    -1,
-     438,    49,   249,    -1,   438,    49,   250,    -1,   438,    49,
-     251,    -1,   438,    49,   252,    -1,   438,    49,   253,    -1,
-     438,    49,   254,    -1,   438,    49,   255,    -1,   438,    49,
-     256,    -1,   438,    49,   319,    -1,   438,   418,   464,   419,
-      -1,   438,   418,   464,   420,   464,   419,    -1,   438,   418,
-     464,   420,   419,    -1,   438,   418,   420,   464,   419,    -1,
-     438,    -1,    59,   433,    -1,    60,   433,    -1,   441,   439,
-      -1,   439,    -1,   421,   459,   422,   440,    -1,   459,   421,
-     440,   422,    -1,    14,   407,   459,   406,   421,   440,   422,
-      -1,   408,    -1,   409,    -1,   423,    -1,   424,    -1,   440,
-      -1,   442,   410,   440,    -1,   442,   411,   440,    -1,   442,
-     412,   440,    -1,   442,    -1,   443,   408,   442,    -1,   443,
-     409,   442,    -1,   443,    -1,   444,    56,   443,    -1,   444,
-      55,   443,    -1,   444,    -1,   445,   407,   444,    -1,   445,
-     406,   444,    -1,   445,    58,   444,    -1,   445,    57,   444,
-      -1,   445,    -1,   446,    53,   445,    -1,   446,    54,   445,
-      -1,   446,    -1,   447,   405,   446,    -1,   447,    -1,   448,
-     404,   447,    -1,   448,    -1,   449,   403,   448,    -1,   449,
-      -1,   450,   402,   449,    -1,   450,    -1,   451,   401,   450,
-      -1,   451,    -1,   452,   425,   464,   420,   451,    -1,   426,
+     268,    -1,   319,    -1,   303,    -1,   304,    -1,   425,   468,
+     426,    -1,   461,   468,   423,    -1,   467,    -1,   441,    -1,
+     437,    59,    -1,   437,    60,    -1,   442,    49,    46,    -1,
+     442,    49,    40,    -1,   442,    49,    39,    -1,   442,    49,
+     161,    -1,   442,    49,   179,    -1,   442,    49,   167,    -1,
+     442,    49,   189,    -1,   442,    49,   165,    -1,   442,    49,
+     163,    -1,   442,    49,   170,    -1,   442,    49,   148,    -1,
+     442,    49,   174,    -1,   442,    49,   151,    -1,   442,    49,
+     166,    -1,   442,    49,   168,    -1,   442,    49,   177,    -1,
+     442,    49,   175,    -1,   442,    49,   157,    -1,   442,    49,
+     156,    -1,   442,    49,   172,    -1,   442,    49,   154,    -1,
+     442,    49,   183,    -1,   442,    49,   149,    -1,   442,    49,
+     153,    -1,   442,    49,   158,    -1,   442,    49,   171,    -1,
+     442,    49,   187,    -1,   442,    49,   188,    -1,   442,    49,
+     159,    -1,   442,    49,   186,    -1,   442,    49,   180,    -1,
+     442,    49,   184,    -1,   442,    49,   155,    -1,   442,    49,
+     181,    -1,   442,    49,   169,    -1,   442,    49,   162,    -1,
+     442,    49,   176,    -1,   442,    49,   152,    -1,   442,    49,
+     178,    -1,   442,    49,   150,    -1,   442,    49,   185,    -1,
+     442,    49,   164,    -1,   442,    49,   173,    -1,   442,    49,
+     182,    -1,   442,    49,   160,    -1,   442,    49,   203,    -1,
+     442,    49,   204,    -1,   442,    49,   205,    -1,   442,    49,
+     206,    -1,   442,    49,   207,    -1,   442,    49,   208,    -1,
+     442,    49,   209,    -1,   442,    49,   210,    -1,   442,    49,
+     211,    -1,   442,    49,   212,    -1,   442,    49,   213,    -1,
+     442,    49,   214,    -1,   442,    49,   215,    -1,   442,    49,
+     216,    -1,   442,    49,   217,    -1,   442,    49,   218,    -1,
+     442,    49,   219,    -1,   442,    49,   220,    -1,   442,    49,
+     221,    -1,   442,    49,   222,    -1,   442,    49,   223,    -1,
+     442,    49,   224,    -1,   442,    49,   225,    -1,   442,    49,
+     226,    -1,   442,    49,   227,    -1,   442,    49,   228,    -1,
+     442,    49,   229,    -1,   442,    49,   230,    -1,   442,    49,
+     231,    -1,   442,    49,   232,    -1,   442,    49,   233,    -1,
+     442,    49,   234,    -1,   442,    49,   235,    -1,   442,    49,
+     236,    -1,   442,    49,   237,    -1,   442,    49,   238,    -1,
+     442,    49,   239,    -1,   442,    49,   240,    -1,   442,    49,
+     241,    -1,   442,    49,   242,    -1,   442,    49,   243,    -1,
+     442,    49,   244,    -1,   442,    49,   245,    -1,   442,    49,
+     246,    -1,   442,    49,   247,    -1,   442,    49,   248,    -1,
+     442,    49,   249,    -1,   442,    49,   250,    -1,   442,    49,
+     251,    -1,   442,    49,   252,    -1,   442,    49,   253,    -1,
+     442,    49,   254,    -1,   442,    49,   255,    -1,   442,    49,
+     256,    -1,   442,    49,   319,    -1,   442,   422,   468,   423,
+      -1,   442,   422,   468,   424,   468,   423,    -1,   442,   422,
+     468,   424,   423,    -1,   442,   422,   424,   468,   423,    -1,
+     442,    -1,    59,   437,    -1,    60,   437,    -1,   445,   443,
+      -1,   443,    -1,   425,   463,   426,   444,    -1,   463,   425,
+     444,   426,    -1,    14,   411,   463,   410,   425,   444,   426,
+      -1,   412,    -1,   413,    -1,   427,    -1,   428,    -1,   444,
+      -1,   446,   414,   444,    -1,   446,   415,   444,    -1,   446,
+     416,   444,    -1,   446,    -1,   447,   412,   446,    -1,   447,
+     413,   446,    -1,   447,    -1,   448,    56,   447,    -1,   448,
+      55,   447,    -1,   448,    -1,   449,   411,   448,    -1,   449,
+     410,   448,    -1,   449,    58,   448,    -1,   449,    57,   448,
+      -1,   449,    -1,   450,    53,   449,    -1,   450,    54,   449,
+      -1,   450,    -1,   451,   409,   450,    -1,   451,    -1,   452,
+     408,   451,    -1,   452,    -1,   453,   407,   452,    -1,   453,
+      -1,   454,   406,   453,    -1,   454,    -1,   455,   405,   454,
+      -1,   455,    -1,   456,   429,   468,   424,   455,    -1,   430,
       -1,    61,    -1,    62,    -1,    63,    -1,    64,    -1,    65,
       -1,    66,    -1,    67,    -1,    68,    -1,    69,    -1,    70,
-      -1,   452,    -1,   427,   456,   428,    -1,   427,   428,    -1,
-     427,   456,   429,   428,    -1,   435,   426,   454,    -1,   433,
-     453,   454,    -1,    34,   435,   426,   454,    -1,   435,   426,
-      12,   458,   421,   464,   422,    -1,   435,   426,    12,   458,
-     421,   464,   429,   460,   422,    -1,   435,   426,    12,   458,
-     421,   464,   429,   460,   429,   464,   422,    -1,   435,   426,
-      12,   458,   421,   464,   429,   460,   429,   464,   429,   464,
-     422,    -1,   435,   426,    12,   421,   464,   422,    -1,   435,
-     426,    12,   421,   464,   429,   460,   422,    -1,   435,   426,
-      12,   421,   464,   429,   460,   429,   464,   422,    -1,   435,
-     426,    12,   421,   464,   429,   460,   429,   464,   429,   464,
-     422,    -1,   433,   418,   464,   419,   453,   454,    -1,   434,
-     418,   464,   419,   453,   454,    -1,   457,   464,   419,   453,
-     454,    -1,   454,    -1,   455,    -1,   456,   429,   455,    -1,
+      -1,   456,    -1,   431,   460,   432,    -1,   431,   432,    -1,
+     431,   460,   433,   432,    -1,   439,   430,   458,    -1,   437,
+     457,   458,    -1,    34,   439,   430,   458,    -1,   439,   430,
+      12,   462,   425,   468,   426,    -1,   439,   430,    12,   462,
+     425,   468,   433,   464,   426,    -1,   439,   430,    12,   462,
+     425,   468,   433,   464,   433,   468,   426,    -1,   439,   430,
+      12,   462,   425,   468,   433,   464,   433,   468,   433,   468,
+     426,    -1,   439,   430,    12,   425,   468,   426,    -1,   439,
+     430,    12,   425,   468,   433,   464,   426,    -1,   439,   430,
+      12,   425,   468,   433,   464,   433,   468,   426,    -1,   439,
+     430,    12,   425,   468,   433,   464,   433,   468,   433,   468,
+     426,    -1,   437,   422,   468,   423,   457,   458,    -1,   438,
+     422,   468,   423,   457,   458,    -1,   461,   468,   423,   457,
+     458,    -1,   458,    -1,   459,    -1,   460,   433,   459,    -1,
       79,    -1,    71,    -1,    73,    -1,    75,    -1,    80,    -1,
       72,    -1,    74,    -1,    76,    -1,    77,    -1,    81,    -1,
       78,    -1,    23,    -1,    24,    -1,    25,    -1,    26,    -1,
@@ -6227,173 +6322,183 @@ namespace yy {
       17,    -1,    16,    -1,    23,    -1,    24,    -1,    25,    -1,
       26,    -1,    30,    -1,    31,    -1,    32,    -1,    33,    -1,
       18,    -1,    17,    -1,    19,    -1,    20,    -1,    21,    -1,
-      22,    -1,    28,    -1,    29,    -1,   452,    -1,   461,   429,
-     452,    -1,   461,    -1,    82,   421,   464,   422,    -1,    83,
-     421,   464,   422,    -1,    84,   421,   464,   422,    -1,    85,
-     421,   464,   422,    -1,    86,   421,   464,   422,    -1,    87,
-     421,   464,   422,    -1,    88,   421,   464,   429,   464,   422,
-      -1,    89,   421,   464,   422,    -1,    90,   421,   464,   422,
-      -1,    91,   421,   464,   422,    -1,    92,   421,   464,   422,
-      -1,    93,   421,   464,   422,    -1,    94,   421,   464,   422,
-      -1,    95,   421,   464,   429,   464,   429,   464,   422,    -1,
-      96,   421,   464,   429,   464,   429,   464,   422,    -1,    97,
-     421,   464,   429,   464,   429,   464,   422,    -1,    98,   421,
-     464,   429,   464,   429,   464,   422,    -1,    99,   421,   464,
-     422,    -1,   100,   421,   464,   422,    -1,   100,   421,   464,
-     429,   464,   422,    -1,   101,   421,   464,   422,    -1,   102,
-     421,   464,   422,    -1,   103,   421,   464,   422,    -1,   104,
-     421,   464,   422,    -1,   105,   421,   464,   422,    -1,   106,
-     421,   464,   422,    -1,   107,   421,   464,   422,    -1,   108,
-     421,   464,   429,   464,   422,    -1,   109,   421,   464,   422,
-      -1,   110,   421,   464,   422,    -1,   111,   421,   464,   429,
-     464,   422,    -1,   112,   421,   464,   422,    -1,   113,   421,
-     464,   422,    -1,   114,   421,   464,   422,    -1,   115,   421,
-     464,   422,    -1,   116,   421,   464,   429,   464,   422,    -1,
-     117,   421,   464,   422,    -1,   118,   421,   464,   422,    -1,
-     119,   421,   464,   422,    -1,   120,   421,   464,   429,   464,
-     422,    -1,   122,   421,   464,   429,   464,   422,    -1,   123,
-     421,   464,   429,   464,   422,    -1,   124,   421,   464,   429,
-     464,   422,    -1,   125,   421,   464,   429,   464,   422,    -1,
-     126,   421,   464,   429,   464,   422,    -1,   127,   421,   464,
-     429,   464,   422,    -1,   128,   421,   464,   429,   464,   422,
-      -1,   129,   421,   464,   422,    -1,   130,   421,   464,   422,
-      -1,   131,   421,   464,   422,    -1,   132,   421,   464,   429,
-     464,   429,   464,   422,    -1,   133,   421,   464,   429,   464,
-     422,    -1,   134,   421,   464,   422,    -1,   135,   421,   464,
-     422,    -1,   136,   421,   464,   422,    -1,   137,   421,   464,
-     422,    -1,   138,   421,   464,   422,    -1,   139,   421,   464,
-     422,    -1,   140,   421,   464,   422,    -1,   141,   421,   464,
-     422,    -1,   142,   421,   464,   422,    -1,   143,   421,   464,
-     422,    -1,   144,   421,   464,   422,    -1,   145,   421,   464,
-     422,    -1,   146,   421,   464,   422,    -1,   289,   421,   464,
-     422,    -1,   290,   421,   464,   422,    -1,   289,   421,   464,
-     429,   464,   429,   464,   429,   464,   429,   464,   429,   464,
-     429,   464,   422,    -1,   289,   421,   464,   429,   464,   429,
-     464,   429,   464,   429,   464,   422,    -1,   292,   421,   464,
-     422,    -1,   293,   421,   464,   422,    -1,   294,   421,   464,
-     422,    -1,   295,   421,   464,   422,    -1,   296,   421,   464,
-     429,   464,   429,   464,   429,   464,   422,    -1,   297,   421,
-     464,   429,   464,   429,   464,   429,   464,   422,    -1,   298,
-     421,   464,   429,   464,   429,   464,   429,   464,   422,    -1,
-     299,   421,   464,   429,   464,   429,   464,   429,   464,   422,
-      -1,   300,   421,   464,   429,   464,   429,   464,   429,   464,
-     422,    -1,   301,   421,   464,   429,   464,   429,   464,   429,
-     464,   422,    -1,   302,   421,   464,   429,   464,   429,   464,
-     429,   464,   422,    -1,   305,   421,   464,   429,   464,   429,
-     464,   429,   464,   429,   464,   422,    -1,   306,   421,   464,
-     429,   464,   429,   464,   429,   464,   429,   464,   422,    -1,
-     307,   421,   464,   429,   464,   429,   464,   429,   464,   429,
-     464,   422,    -1,   308,   421,   464,   422,    -1,   309,   421,
-     464,   422,    -1,   310,   421,   464,   422,    -1,   311,   421,
-     464,   422,    -1,   312,   421,   464,   422,    -1,   313,   421,
-     464,   422,    -1,   314,   421,   464,   422,    -1,   315,   421,
-     464,   422,    -1,   316,   421,   464,   422,    -1,   317,   421,
-     464,   422,    -1,   318,   421,   422,    -1,   320,   421,   422,
-      -1,   321,   421,   422,    -1,   322,   421,   422,    -1,   323,
-     421,   422,    -1,   324,   421,   422,    -1,   325,   421,   422,
-      -1,   326,   421,   464,   422,    -1,   327,   421,   464,   422,
-      -1,   328,   421,   464,   422,    -1,   329,   421,   464,   422,
-      -1,    18,   421,   464,   422,    -1,   330,   421,   464,   422,
-      -1,   331,   421,   464,   422,    -1,   332,   421,   464,   422,
-      -1,   333,   421,   464,   422,    -1,   334,   421,   464,   422,
-      -1,   436,   430,   147,   421,   462,   422,    -1,   335,   421,
-     464,   429,   464,   422,    -1,   336,   421,   464,   429,   464,
-     422,    -1,   433,   430,   336,   421,   464,   422,    -1,   337,
-     421,   464,   429,   464,   429,   464,   422,    -1,   338,   421,
-     464,   429,   464,   422,    -1,   433,   430,   338,   421,   464,
-     422,    -1,   339,   421,   464,   422,    -1,   433,   430,   339,
-     421,   422,    -1,   340,   421,   464,   422,    -1,   433,   430,
-     340,   421,   422,    -1,   341,   421,   464,   429,   464,   422,
-      -1,   342,   421,   464,   429,   464,   422,    -1,   343,   421,
-     464,   422,    -1,   433,   430,   343,   421,   422,    -1,   344,
-     421,   464,   429,   464,   422,    -1,   433,   430,   344,   421,
-     464,   422,    -1,   345,   421,   464,   429,   464,   429,   464,
-     422,    -1,   346,   421,   464,   422,    -1,   433,   430,   346,
-     421,   422,    -1,   347,   421,   464,   422,    -1,   433,   430,
-     347,   421,   422,    -1,   348,   421,   464,   422,    -1,   433,
-     430,   348,   421,   422,    -1,   349,   421,   464,   429,   464,
-     422,    -1,   350,   421,   464,   422,    -1,   433,   430,   350,
-     421,   422,    -1,   351,   421,   464,   429,   464,   422,    -1,
-     433,   430,   351,   421,   464,   422,    -1,   352,   421,   464,
-     429,   464,   422,    -1,   433,   430,   352,   421,   464,   422,
-      -1,   353,   421,   464,   422,    -1,   433,   430,   353,   421,
-     422,    -1,   354,   421,   464,   429,   464,   422,    -1,   433,
-     430,   354,   421,   464,   422,    -1,   355,   421,   464,   422,
-      -1,   433,   430,   355,   421,   422,    -1,   356,   421,   464,
-     422,    -1,   433,   430,   356,   421,   422,    -1,   357,   421,
-     464,   429,   464,   422,    -1,   358,   421,   464,   422,    -1,
-     359,   421,   464,   429,   464,   422,    -1,   433,   430,   359,
-     421,   464,   422,    -1,   360,   421,   464,   429,   464,   429,
-     464,   422,    -1,   360,   421,   436,   429,   464,   429,   464,
-     422,    -1,   361,   421,   464,   422,    -1,   362,   421,   464,
-     422,    -1,   363,   421,   464,   422,    -1,   364,   421,   464,
-     422,    -1,   365,   421,   464,   422,    -1,   366,   421,   464,
-     422,    -1,   367,   421,   464,   422,    -1,   368,   421,   464,
-     429,   464,   422,    -1,   369,   421,   464,   422,    -1,   370,
-     421,   464,   429,   464,   429,   464,   422,    -1,   371,   421,
-     464,   422,    -1,   372,   421,   464,   429,   464,   422,    -1,
-     373,   421,   464,   429,   464,   422,    -1,   374,   421,   464,
-     429,   464,   429,   464,   422,    -1,   375,   421,   464,   429,
-     464,   422,    -1,   377,   421,   464,   422,    -1,   376,   421,
-     464,   422,    -1,   378,   421,   464,   429,   464,   422,    -1,
-     379,   421,   464,   429,   464,   422,    -1,   380,   421,   464,
-     422,    -1,   381,   421,   464,   422,    -1,   382,   421,   464,
-     422,    -1,   383,   421,   464,   429,   464,   429,   464,   429,
-     464,   422,    -1,   384,   421,   464,   422,    -1,   385,   421,
-     464,   429,   464,   422,    -1,   390,   421,   464,   422,    -1,
-     390,   421,   464,   429,   464,   422,    -1,   390,   421,   464,
-     429,   464,   429,   464,   429,   464,   422,    -1,   390,   421,
-     464,   429,   464,   429,   464,   429,   464,   429,   464,   422,
-      -1,   389,   421,   464,   422,    -1,   389,   421,   464,   429,
-     464,   422,    -1,   389,   421,   464,   429,   464,   429,   464,
-     429,   464,   422,    -1,   389,   421,   464,   429,   464,   429,
-     464,   429,   464,   429,   464,   422,    -1,   395,   421,   464,
-     429,   464,   422,    -1,   395,   421,   464,   429,   464,   429,
-     464,   422,    -1,   395,   421,   464,   429,   464,   429,   464,
-     429,   464,   422,    -1,   395,   421,   464,   429,   464,   429,
-     458,   422,    -1,   395,   421,   464,   429,   464,   429,   464,
-     429,   458,   422,    -1,   395,   421,   464,   429,   464,   429,
-     464,   429,   464,   429,   458,   422,    -1,   391,   421,   464,
-     429,   464,   429,   464,   429,   458,   422,    -1,   391,   421,
-     464,   429,   464,   429,   464,   422,    -1,   391,   421,   464,
-     429,   464,   429,   458,   422,    -1,   391,   421,   464,   429,
-     464,   422,    -1,   391,   421,   464,   429,   458,   422,    -1,
-     391,   421,   464,   422,    -1,   392,   421,   464,   429,   464,
-     429,   458,   422,    -1,   392,   421,   464,   429,   464,   422,
-      -1,   393,   421,   464,   429,   464,   429,   458,   422,    -1,
-     393,   421,   464,   429,   464,   422,    -1,   394,   421,   464,
-     429,   464,   429,   464,   429,   464,   429,   458,   422,    -1,
-     394,   421,   464,   429,   464,   429,   464,   429,   464,   422,
-      -1,   394,   421,   464,   429,   464,   429,   464,   429,   458,
-     422,    -1,   394,   421,   464,   429,   464,   429,   464,   422,
-      -1,   394,   421,   464,   429,   464,   429,   458,   422,    -1,
-     394,   421,   464,   429,   464,   422,    -1,   396,   421,   464,
-     429,   464,   429,   464,   429,   464,   429,   464,   429,   458,
-     422,    -1,   396,   421,   464,   429,   464,   429,   464,   429,
-     464,   429,   464,   422,    -1,   396,   421,   464,   429,   464,
-     429,   464,   429,   464,   429,   458,   422,    -1,   396,   421,
-     464,   429,   464,   429,   464,   429,   464,   422,    -1,   396,
-     421,   464,   429,   464,   429,   464,   429,   458,   422,    -1,
-     396,   421,   464,   429,   464,   429,   464,   422,    -1,   396,
-     421,   464,   429,   464,   429,   458,   422,    -1,   396,   421,
-     464,   429,   464,   422,    -1,   397,   421,   464,   429,   458,
-     422,    -1,   397,   421,   464,   422,    -1,   398,   421,   464,
-     429,   458,   422,    -1,   398,   421,   464,   422,    -1,   399,
-     421,   464,   429,   458,   422,    -1,   399,   421,   464,   422,
-      -1,   400,   421,   464,   429,   458,   422,    -1,   400,   421,
-     464,   422,    -1,   454,    -1,   464,   431,    -1,   472,    -1,
-     473,    -1,   474,   431,    -1,   465,    -1,   466,    -1,   467,
-     466,    -1,   464,    -1,   467,    -1,   467,   464,    -1,     6,
-     421,   435,     8,   434,   422,    -1,     6,   421,   435,     8,
-     433,   422,    -1,     6,   421,   435,     8,   436,   422,    -1,
-       9,   421,   464,   422,   427,   468,   428,    -1,     5,   421,
-     465,   465,   422,   427,   468,   428,    -1,     5,   421,   465,
-     465,   464,   422,   427,   468,   428,    -1,     3,   427,   468,
-     428,     9,   421,   464,   422,    -1,   469,   427,   468,   428,
-      -1,   470,   427,   468,   428,    -1,   471,   427,   468,   428,
-      -1,     7,   421,   464,   422,   427,   468,   428,    -1,     7,
-     421,   464,   422,   427,   468,   428,     4,   427,   468,   428,
-      -1,    11,    -1,    10,    -1,   468,    -1
+      22,    -1,    28,    -1,    29,    -1,   456,    -1,   465,   433,
+     456,    -1,   465,    -1,    82,   425,   468,   426,    -1,    83,
+     425,   468,   426,    -1,    84,   425,   468,   426,    -1,    85,
+     425,   468,   426,    -1,    86,   425,   468,   426,    -1,    87,
+     425,   468,   426,    -1,    88,   425,   468,   433,   468,   426,
+      -1,    89,   425,   468,   426,    -1,    90,   425,   468,   426,
+      -1,    91,   425,   468,   426,    -1,    92,   425,   468,   426,
+      -1,    93,   425,   468,   426,    -1,    94,   425,   468,   426,
+      -1,    95,   425,   468,   433,   468,   433,   468,   426,    -1,
+      96,   425,   468,   433,   468,   433,   468,   426,    -1,    97,
+     425,   468,   433,   468,   433,   468,   426,    -1,    98,   425,
+     468,   433,   468,   433,   468,   426,    -1,    99,   425,   468,
+     426,    -1,   100,   425,   468,   426,    -1,   100,   425,   468,
+     433,   468,   426,    -1,   101,   425,   468,   426,    -1,   102,
+     425,   468,   426,    -1,   103,   425,   468,   426,    -1,   104,
+     425,   468,   426,    -1,   105,   425,   468,   426,    -1,   106,
+     425,   468,   426,    -1,   107,   425,   468,   426,    -1,   108,
+     425,   468,   433,   468,   426,    -1,   109,   425,   468,   426,
+      -1,   110,   425,   468,   426,    -1,   111,   425,   468,   433,
+     468,   426,    -1,   112,   425,   468,   426,    -1,   113,   425,
+     468,   426,    -1,   114,   425,   468,   426,    -1,   115,   425,
+     468,   426,    -1,   116,   425,   468,   433,   468,   426,    -1,
+     117,   425,   468,   426,    -1,   118,   425,   468,   426,    -1,
+     119,   425,   468,   426,    -1,   120,   425,   468,   433,   468,
+     426,    -1,   122,   425,   468,   433,   468,   426,    -1,   123,
+     425,   468,   433,   468,   426,    -1,   124,   425,   468,   433,
+     468,   426,    -1,   125,   425,   468,   433,   468,   426,    -1,
+     126,   425,   468,   433,   468,   426,    -1,   127,   425,   468,
+     433,   468,   426,    -1,   128,   425,   468,   433,   468,   426,
+      -1,   129,   425,   468,   426,    -1,   130,   425,   468,   426,
+      -1,   131,   425,   468,   426,    -1,   132,   425,   468,   433,
+     468,   433,   468,   426,    -1,   133,   425,   468,   433,   468,
+     426,    -1,   134,   425,   468,   426,    -1,   135,   425,   468,
+     426,    -1,   136,   425,   468,   426,    -1,   137,   425,   468,
+     426,    -1,   138,   425,   468,   426,    -1,   139,   425,   468,
+     426,    -1,   140,   425,   468,   426,    -1,   141,   425,   468,
+     426,    -1,   142,   425,   468,   426,    -1,   143,   425,   468,
+     426,    -1,   144,   425,   468,   426,    -1,   145,   425,   468,
+     426,    -1,   146,   425,   468,   426,    -1,   289,   425,   468,
+     426,    -1,   290,   425,   468,   426,    -1,   289,   425,   468,
+     433,   468,   433,   468,   433,   468,   433,   468,   433,   468,
+     433,   468,   426,    -1,   289,   425,   468,   433,   468,   433,
+     468,   433,   468,   433,   468,   426,    -1,   292,   425,   468,
+     426,    -1,   293,   425,   468,   426,    -1,   294,   425,   468,
+     426,    -1,   295,   425,   468,   426,    -1,   296,   425,   468,
+     433,   468,   433,   468,   433,   468,   426,    -1,   297,   425,
+     468,   433,   468,   433,   468,   433,   468,   426,    -1,   298,
+     425,   468,   433,   468,   433,   468,   433,   468,   426,    -1,
+     299,   425,   468,   433,   468,   433,   468,   433,   468,   426,
+      -1,   300,   425,   468,   433,   468,   433,   468,   433,   468,
+     426,    -1,   301,   425,   468,   433,   468,   433,   468,   433,
+     468,   426,    -1,   302,   425,   468,   433,   468,   433,   468,
+     433,   468,   426,    -1,   305,   425,   468,   433,   468,   433,
+     468,   433,   468,   433,   468,   426,    -1,   306,   425,   468,
+     433,   468,   433,   468,   433,   468,   433,   468,   426,    -1,
+     307,   425,   468,   433,   468,   433,   468,   433,   468,   433,
+     468,   426,    -1,   308,   425,   468,   426,    -1,   309,   425,
+     468,   426,    -1,   310,   425,   468,   426,    -1,   311,   425,
+     468,   426,    -1,   312,   425,   468,   426,    -1,   313,   425,
+     468,   426,    -1,   314,   425,   468,   426,    -1,   315,   425,
+     468,   426,    -1,   316,   425,   468,   426,    -1,   317,   425,
+     468,   426,    -1,   318,   425,   426,    -1,   320,   425,   426,
+      -1,   321,   425,   426,    -1,   322,   425,   426,    -1,   323,
+     425,   426,    -1,   324,   425,   426,    -1,   325,   425,   426,
+      -1,   326,   425,   468,   426,    -1,   327,   425,   468,   426,
+      -1,   328,   425,   468,   426,    -1,   329,   425,   468,   426,
+      -1,    18,   425,   468,   426,    -1,   330,   425,   468,   426,
+      -1,   331,   425,   468,   426,    -1,   332,   425,   468,   426,
+      -1,   333,   425,   468,   426,    -1,   334,   425,   468,   426,
+      -1,   440,   434,   147,   425,   466,   426,    -1,   335,   425,
+     468,   433,   468,   426,    -1,   336,   425,   468,   433,   468,
+     426,    -1,   437,   434,   336,   425,   468,   426,    -1,   337,
+     425,   468,   433,   468,   433,   468,   426,    -1,   338,   425,
+     468,   433,   468,   426,    -1,   437,   434,   338,   425,   468,
+     426,    -1,   339,   425,   468,   426,    -1,   437,   434,   339,
+     425,   426,    -1,   340,   425,   468,   426,    -1,   437,   434,
+     340,   425,   426,    -1,   341,   425,   468,   433,   468,   426,
+      -1,   342,   425,   468,   433,   468,   426,    -1,   343,   425,
+     468,   426,    -1,   437,   434,   343,   425,   426,    -1,   344,
+     425,   468,   433,   468,   426,    -1,   437,   434,   344,   425,
+     468,   426,    -1,   345,   425,   468,   433,   468,   433,   468,
+     426,    -1,   346,   425,   468,   426,    -1,   437,   434,   346,
+     425,   426,    -1,   347,   425,   468,   426,    -1,   437,   434,
+     347,   425,   426,    -1,   348,   425,   468,   426,    -1,   437,
+     434,   348,   425,   426,    -1,   349,   425,   468,   433,   468,
+     426,    -1,   350,   425,   468,   426,    -1,   437,   434,   350,
+     425,   426,    -1,   351,   425,   468,   433,   468,   426,    -1,
+     437,   434,   351,   425,   468,   426,    -1,   352,   425,   468,
+     433,   468,   426,    -1,   437,   434,   352,   425,   468,   426,
+      -1,   353,   425,   468,   426,    -1,   437,   434,   353,   425,
+     426,    -1,   354,   425,   468,   433,   468,   426,    -1,   437,
+     434,   354,   425,   468,   426,    -1,   355,   425,   468,   426,
+      -1,   437,   434,   355,   425,   426,    -1,   356,   425,   468,
+     426,    -1,   437,   434,   356,   425,   426,    -1,   357,   425,
+     468,   433,   468,   426,    -1,   358,   425,   468,   426,    -1,
+     359,   425,   468,   433,   468,   426,    -1,   437,   434,   359,
+     425,   468,   426,    -1,   438,   434,   335,   425,   468,   426,
+      -1,   438,   434,   335,   425,   438,   426,    -1,   438,   434,
+     401,   425,   438,   433,   438,   426,    -1,   438,   434,   402,
+     425,   468,   426,    -1,   438,   434,   402,   425,   438,   426,
+      -1,   438,   434,   127,   425,   426,    -1,   438,   434,   128,
+     425,   426,    -1,   438,   434,   349,   425,   468,   426,    -1,
+     438,   434,   349,   425,   438,   426,    -1,   438,   434,   403,
+     425,   468,   433,   438,   426,    -1,   438,   434,   404,   425,
+     426,    -1,   438,   434,   357,   425,   468,   426,    -1,   438,
+     434,   357,   425,   438,   426,    -1,   438,   434,   358,   425,
+     426,    -1,   360,   425,   468,   433,   468,   433,   468,   426,
+      -1,   360,   425,   440,   433,   468,   433,   468,   426,    -1,
+     361,   425,   468,   426,    -1,   362,   425,   468,   426,    -1,
+     363,   425,   468,   426,    -1,   364,   425,   468,   426,    -1,
+     365,   425,   468,   426,    -1,   366,   425,   468,   426,    -1,
+     367,   425,   468,   426,    -1,   368,   425,   468,   433,   468,
+     426,    -1,   369,   425,   468,   426,    -1,   370,   425,   468,
+     433,   468,   433,   468,   426,    -1,   371,   425,   468,   426,
+      -1,   372,   425,   468,   433,   468,   426,    -1,   373,   425,
+     468,   433,   468,   426,    -1,   374,   425,   468,   433,   468,
+     433,   468,   426,    -1,   375,   425,   468,   433,   468,   426,
+      -1,   377,   425,   468,   426,    -1,   376,   425,   468,   426,
+      -1,   378,   425,   468,   433,   468,   426,    -1,   379,   425,
+     468,   433,   468,   426,    -1,   380,   425,   468,   426,    -1,
+     381,   425,   468,   426,    -1,   382,   425,   468,   426,    -1,
+     383,   425,   468,   433,   468,   433,   468,   433,   468,   426,
+      -1,   384,   425,   468,   426,    -1,   385,   425,   468,   433,
+     468,   426,    -1,   390,   425,   468,   426,    -1,   390,   425,
+     468,   433,   468,   426,    -1,   390,   425,   468,   433,   468,
+     433,   468,   433,   468,   426,    -1,   390,   425,   468,   433,
+     468,   433,   468,   433,   468,   433,   468,   426,    -1,   389,
+     425,   468,   426,    -1,   389,   425,   468,   433,   468,   426,
+      -1,   389,   425,   468,   433,   468,   433,   468,   433,   468,
+     426,    -1,   389,   425,   468,   433,   468,   433,   468,   433,
+     468,   433,   468,   426,    -1,   395,   425,   468,   433,   468,
+     426,    -1,   395,   425,   468,   433,   468,   433,   468,   426,
+      -1,   395,   425,   468,   433,   468,   433,   468,   433,   468,
+     426,    -1,   395,   425,   468,   433,   468,   433,   462,   426,
+      -1,   395,   425,   468,   433,   468,   433,   468,   433,   462,
+     426,    -1,   395,   425,   468,   433,   468,   433,   468,   433,
+     468,   433,   462,   426,    -1,   391,   425,   468,   433,   468,
+     433,   468,   433,   462,   426,    -1,   391,   425,   468,   433,
+     468,   433,   468,   426,    -1,   391,   425,   468,   433,   468,
+     433,   462,   426,    -1,   391,   425,   468,   433,   468,   426,
+      -1,   391,   425,   468,   433,   462,   426,    -1,   391,   425,
+     468,   426,    -1,   392,   425,   468,   433,   468,   433,   462,
+     426,    -1,   392,   425,   468,   433,   468,   426,    -1,   393,
+     425,   468,   433,   468,   433,   462,   426,    -1,   393,   425,
+     468,   433,   468,   426,    -1,   394,   425,   468,   433,   468,
+     433,   468,   433,   468,   433,   462,   426,    -1,   394,   425,
+     468,   433,   468,   433,   468,   433,   468,   426,    -1,   394,
+     425,   468,   433,   468,   433,   468,   433,   462,   426,    -1,
+     394,   425,   468,   433,   468,   433,   468,   426,    -1,   394,
+     425,   468,   433,   468,   433,   462,   426,    -1,   394,   425,
+     468,   433,   468,   426,    -1,   396,   425,   468,   433,   468,
+     433,   468,   433,   468,   433,   468,   433,   462,   426,    -1,
+     396,   425,   468,   433,   468,   433,   468,   433,   468,   433,
+     468,   426,    -1,   396,   425,   468,   433,   468,   433,   468,
+     433,   468,   433,   462,   426,    -1,   396,   425,   468,   433,
+     468,   433,   468,   433,   468,   426,    -1,   396,   425,   468,
+     433,   468,   433,   468,   433,   462,   426,    -1,   396,   425,
+     468,   433,   468,   433,   468,   426,    -1,   396,   425,   468,
+     433,   468,   433,   462,   426,    -1,   396,   425,   468,   433,
+     468,   426,    -1,   397,   425,   468,   433,   462,   426,    -1,
+     397,   425,   468,   426,    -1,   398,   425,   468,   433,   462,
+     426,    -1,   398,   425,   468,   426,    -1,   399,   425,   468,
+     433,   462,   426,    -1,   399,   425,   468,   426,    -1,   400,
+     425,   468,   433,   462,   426,    -1,   400,   425,   468,   426,
+      -1,   458,    -1,   468,   435,    -1,   476,    -1,   477,    -1,
+     478,   435,    -1,   469,    -1,   470,    -1,   471,   470,    -1,
+     468,    -1,   471,    -1,   471,   468,    -1,     6,   425,   439,
+       8,   438,   426,    -1,     6,   425,   439,     8,   437,   426,
+      -1,     6,   425,   439,     8,   440,   426,    -1,     9,   425,
+     468,   426,   431,   472,   432,    -1,     5,   425,   469,   469,
+     426,   431,   472,   432,    -1,     5,   425,   469,   469,   468,
+     426,   431,   472,   432,    -1,     3,   431,   472,   432,     9,
+     425,   468,   426,    -1,   473,   431,   472,   432,    -1,   474,
+     431,   472,   432,    -1,   475,   431,   472,   432,    -1,     7,
+     425,   468,   426,   431,   472,   432,    -1,     7,   425,   468,
+     426,   431,   472,   432,     4,   431,   472,   432,    -1,    11,
+      -1,    10,    -1,   472,    -1
   };
 
   /* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
@@ -6454,85 +6559,89 @@ namespace yy {
     1918,  1923,  1929,  1936,  1943,  1952,  1957,  1963,  1968,  1974,
     1979,  1985,  1992,  1997,  2003,  2010,  2017,  2024,  2031,  2036,
     2042,  2049,  2056,  2061,  2067,  2072,  2078,  2085,  2090,  2097,
-    2104,  2113,  2122,  2127,  2132,  2137,  2142,  2147,  2152,  2157,
-    2164,  2169,  2178,  2183,  2190,  2197,  2206,  2213,  2218,  2223,
-    2230,  2237,  2242,  2247,  2252,  2263,  2268,  2275,  2280,  2287,
-    2298,  2311,  2316,  2323,  2334,  2347,  2354,  2363,  2374,  2383,
-    2394,  2407,  2418,  2427,  2436,  2443,  2450,  2455,  2464,  2471,
-    2480,  2487,  2500,  2511,  2522,  2531,  2540,  2547,  2562,  2575,
-    2588,  2599,  2610,  2619,  2628,  2635,  2642,  2647,  2654,  2659,
-    2666,  2671,  2678,  2683,  2685,  2688,  2690,  2692,  2695,  2697,
-    2699,  2702,  2704,  2706,  2709,  2716,  2723,  2730,  2738,  2747,
-    2757,  2766,  2771,  2776,  2781,  2789,  2801,  2803,  2805
+    2104,  2111,  2118,  2127,  2134,  2141,  2147,  2153,  2160,  2167,
+    2176,  2182,  2189,  2196,  2202,  2211,  2220,  2225,  2230,  2235,
+    2240,  2245,  2250,  2255,  2262,  2267,  2276,  2281,  2288,  2295,
+    2304,  2311,  2316,  2321,  2328,  2335,  2340,  2345,  2350,  2361,
+    2366,  2373,  2378,  2385,  2396,  2409,  2414,  2421,  2432,  2445,
+    2452,  2461,  2472,  2481,  2492,  2505,  2516,  2525,  2534,  2541,
+    2548,  2553,  2562,  2569,  2578,  2585,  2598,  2609,  2620,  2629,
+    2638,  2645,  2660,  2673,  2686,  2697,  2708,  2717,  2726,  2733,
+    2740,  2745,  2752,  2757,  2764,  2769,  2776,  2781,  2783,  2786,
+    2788,  2790,  2793,  2795,  2797,  2800,  2802,  2804,  2807,  2814,
+    2821,  2828,  2836,  2845,  2855,  2864,  2869,  2874,  2879,  2887,
+    2899,  2901,  2903
   };
 
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
   const unsigned short int
   parser::yyrline_[] =
   {
-         0,   169,   169,   173,   177,   181,   185,   186,   187,   188,
-     189,   190,   191,   192,   193,   194,   195,   196,   200,   201,
-     202,   203,   204,   205,   213,   214,   215,   216,   224,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
-     277,   278,   279,   281,   282,   283,   284,   285,   286,   287,
-     288,   289,   290,   291,   292,   293,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
-     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
-     348,   349,   350,   352,   353,   357,   358,   359,   360,   361,
-     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
-     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
-     382,   383,   384,   385,   386,   387,   388,   389,   390,   391,
-     392,   393,   394,   395,   396,   397,   398,   399,   400,   401,
-     402,   403,   404,   405,   406,   407,   408,   409,   410,   411,
-     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
-     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
-     432,   433,   434,   435,   436,   437,   438,   439,   440,   441,
-     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
-     452,   453,   454,   455,   456,   457,   458,   459,   460,   461,
-     462,   463,   467,   468,   469,   470,   474,   475,   476,   477,
-     481,   482,   483,   484,   488,   489,   490,   491,   495,   496,
-     497,   501,   502,   503,   507,   508,   509,   510,   511,   515,
-     516,   517,   521,   522,   526,   527,   531,   532,   536,   537,
-     541,   542,   546,   547,   551,   552,   553,   554,   555,   556,
-     557,   558,   559,   560,   561,   565,   566,   567,   568,   569,
-     570,   571,   572,   574,   576,   578,   580,   582,   584,   586,
-     588,   589,   592,   596,   600,   601,   605,   606,   607,   608,
-     609,   610,   611,   612,   613,   614,   615,   619,   620,   621,
-     622,   623,   624,   625,   626,   627,   628,   629,   633,   634,
-     635,   636,   637,   638,   639,   640,   641,   642,   643,   644,
-     645,   646,   650,   651,   655,   656,   660,   664,   665,   666,
-     667,   668,   669,   670,   671,   672,   673,   674,   675,   676,
-     677,   678,   679,   680,   681,   682,   683,   684,   685,   686,
-     687,   688,   689,   690,   691,   692,   693,   694,   695,   696,
-     697,   698,   699,   700,   701,   702,   703,   704,   705,   706,
-     707,   708,   709,   710,   711,   712,   713,   714,   715,   716,
-     717,   718,   719,   720,   721,   722,   723,   724,   725,   726,
-     727,   728,   729,   730,   731,   733,   735,   736,   737,   738,
-     739,   740,   741,   743,   744,   745,   747,   748,   750,   752,
-     754,   755,   756,   757,   758,   759,   760,   761,   762,   763,
-     764,   765,   766,   767,   768,   769,   770,   771,   772,   773,
-     774,   775,   776,   777,   778,   779,   780,   781,   782,   783,
-     784,   785,   786,   787,   788,   789,   790,   791,   792,   793,
-     794,   795,   796,   797,   798,   799,   800,   801,   802,   803,
-     804,   805,   806,   807,   808,   809,   810,   811,   812,   813,
-     814,   815,   816,   817,   818,   819,   820,   821,   822,   823,
-     824,   825,   827,   828,   829,   830,   831,   832,   833,   834,
-     835,   836,   837,   838,   839,   840,   841,   842,   843,   844,
-     845,   846,   847,   848,   849,   850,   851,   853,   854,   855,
-     857,   859,   860,   861,   863,   866,   867,   868,   869,   870,
-     872,   875,   877,   879,   884,   889,   896,   905,   906,   907,
-     908,   910,   912,   918,   924,   929,   936,   943,   945,   947,
-     953,   959,   967,   974,   983,   992,   993,   994,   995,   996,
-     997,   998,   999,  1003,  1010,  1011,  1012,  1013,  1017,  1021,
-    1022,  1026,  1027,  1028,  1032,  1036,  1040,  1044,  1045,  1047,
-    1049,  1050,  1051,  1052,  1056,  1057,  1062,  1063,  1067
+         0,   171,   171,   175,   179,   183,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,   196,   197,   198,   202,   203,
+     204,   205,   206,   207,   215,   216,   217,   218,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   354,   355,   359,   360,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
+     384,   385,   386,   387,   388,   389,   390,   391,   392,   393,
+     394,   395,   396,   397,   398,   399,   400,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
+     464,   465,   469,   470,   471,   472,   476,   477,   478,   479,
+     483,   484,   485,   486,   490,   491,   492,   493,   497,   498,
+     499,   503,   504,   505,   509,   510,   511,   512,   513,   517,
+     518,   519,   523,   524,   528,   529,   533,   534,   538,   539,
+     543,   544,   548,   549,   553,   554,   555,   556,   557,   558,
+     559,   560,   561,   562,   563,   567,   568,   569,   570,   571,
+     572,   573,   574,   576,   578,   580,   582,   584,   586,   588,
+     590,   591,   594,   598,   602,   603,   607,   608,   609,   610,
+     611,   612,   613,   614,   615,   616,   617,   621,   622,   623,
+     624,   625,   626,   627,   628,   629,   630,   631,   635,   636,
+     637,   638,   639,   640,   641,   642,   643,   644,   645,   646,
+     647,   648,   652,   653,   657,   658,   662,   666,   667,   668,
+     669,   670,   671,   672,   673,   674,   675,   676,   677,   678,
+     679,   680,   681,   682,   683,   684,   685,   686,   687,   688,
+     689,   690,   691,   692,   693,   694,   695,   696,   697,   698,
+     699,   700,   701,   702,   703,   704,   705,   706,   707,   708,
+     709,   710,   711,   712,   713,   714,   715,   716,   717,   718,
+     719,   720,   721,   722,   723,   724,   725,   726,   727,   728,
+     729,   730,   731,   732,   733,   735,   737,   738,   739,   740,
+     741,   742,   743,   745,   746,   747,   749,   750,   752,   754,
+     756,   757,   758,   759,   760,   761,   762,   763,   764,   765,
+     766,   767,   768,   769,   770,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,   783,   784,   785,
+     786,   787,   788,   789,   790,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,   801,   802,   803,   804,   805,
+     806,   807,   808,   809,   810,   811,   812,   813,   814,   815,
+     816,   817,   818,   819,   820,   821,   822,   823,   824,   825,
+     826,   827,   828,   829,   830,   831,   832,   833,   834,   835,
+     836,   837,   838,   839,   840,   841,   843,   844,   845,   846,
+     847,   848,   849,   850,   851,   852,   853,   854,   855,   856,
+     857,   858,   859,   860,   861,   862,   863,   864,   865,   866,
+     867,   869,   870,   871,   873,   875,   876,   877,   879,   882,
+     883,   884,   885,   886,   888,   891,   893,   895,   900,   905,
+     912,   921,   922,   923,   924,   926,   928,   934,   940,   945,
+     952,   959,   961,   963,   969,   975,   983,   990,   999,  1008,
+    1009,  1010,  1011,  1012,  1013,  1014,  1015,  1019,  1026,  1027,
+    1028,  1029,  1033,  1037,  1038,  1042,  1043,  1044,  1048,  1052,
+    1056,  1060,  1061,  1063,  1065,  1066,  1067,  1068,  1072,  1073,
+    1078,  1079,  1083
   };
 
   // Print the state stack on the debug stream.
@@ -6575,16 +6684,16 @@ namespace yy {
            0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   424,     2,     2,   417,   412,   405,     2,
-     421,   422,   410,   408,   429,   409,   430,   411,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   420,   431,
-     407,   426,   406,   425,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   428,     2,     2,   421,   416,   409,     2,
+     425,   426,   414,   412,   433,   413,   434,   415,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   424,   435,
+     411,   430,   410,   429,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,   418,     2,   419,   404,     2,     2,     2,     2,     2,
+       2,   422,     2,   423,   408,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   427,   403,   428,   423,     2,     2,     2,
+       2,     2,     2,   431,   407,   432,   427,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -6637,8 +6746,8 @@ namespace yy {
      365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
      375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   413,   414,
-     415,   416
+     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
+     405,   406,   417,   418,   419,   420
     };
     if ((unsigned int) t <= yyuser_token_number_max_)
       return translate_table[t];
@@ -6647,15 +6756,15 @@ namespace yy {
   }
 
   const int parser::yyeof_ = 0;
-  const int parser::yylast_ = 6915;
+  const int parser::yylast_ = 6955;
   const int parser::yynnts_ = 44;
   const int parser::yyempty_ = -2;
-  const int parser::yyfinal_ = 632;
+  const int parser::yyfinal_ = 633;
   const int parser::yyterror_ = 1;
   const int parser::yyerrcode_ = 256;
-  const int parser::yyntokens_ = 432;
+  const int parser::yyntokens_ = 436;
 
-  const unsigned int parser::yyuser_token_number_max_ = 661;
+  const unsigned int parser::yyuser_token_number_max_ = 665;
   const parser::token_number_type parser::yyundef_token_ = 2;
 
 
@@ -513,12 +513,16 @@ namespace yy {
      EE_ONES_LIKE = 653,
      EE_ZEROS = 654,
      EE_ZEROS_LIKE = 655,
-     EE_OR = 656,
-     EE_AND = 657,
-     EE_LOG_NOT = 658,
-     EE_UNARY_1SCOMPL = 659,
-     EE_UPLUS = 660,
-     EE_UMINUS = 661
+     EE_CONVOLVE = 656,
+     EE_DIV = 657,
+     EE_RESAMPLE = 658,
+     EE_RMS = 659,
+     EE_OR = 660,
+     EE_AND = 661,
+     EE_LOG_NOT = 662,
+     EE_UNARY_1SCOMPL = 663,
+     EE_UPLUS = 664,
+     EE_UMINUS = 665
    };
 
     };
@@ -3,5 +3,237 @@
 
 namespace ee {
 
+	/** The number of elements the generic bulk operations move through a double buffer at a time. */
+	static constexpr size_t							EE_ARRAY_BLOCK = 4096;
+
+	// == Functions.
+	/**
+	 * \brief Reads a run of elements as doubles.
+	 *
+	 * \param _sStart The index of the first element to read.
+	 * \param _sTotal The number of elements to read.
+	 * \param _pdDst Receives the elements.
+	 * \return Returns true if the read succeeded; false otherwise.
+	 *
+	 * \note The default implementation goes through ReadValue(); primitive arrays convert their storage directly.
+	 */
+	bool CArrayBase::ReadDoubles( size_t _sStart, size_t _sTotal, double * _pdDst ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			CExpEvalContainer::EE_RESULT rTemp;
+			if ( !ReadValue( _sStart + I, rTemp ) ) { return false; }
+			rTemp = m_peecContainer->ConvertResultOrObject( rTemp, EE_NC_FLOATING );
+			if ( rTemp.ncType == EE_NC_INVALID ) { return false; }
+			_pdDst[I] = rTemp.u.dVal;
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Writes a run of elements from doubles.
+	 *
+	 * \param _sStart The index of the first element to write.
+	 * \param _sTotal The number of elements to write.
+	 * \param _pdSrc The values to write.
+	 * \return Returns true if the write succeeded; false otherwise.
+	 *
+	 * \note The default implementation goes through WriteValue(); primitive arrays convert into their storage directly.
+	 */
+	bool CArrayBase::WriteDoubles( size_t _sStart, size_t _sTotal, const double * _pdSrc ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			CExpEvalContainer::EE_RESULT rTemp;
+			rTemp.ncType = EE_NC_FLOATING;
+			rTemp.u.dVal = _pdSrc[I];
+			if ( !WriteValue( _sStart + I, rTemp ) ) { return false; }
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Applies an operation between every element and a scalar, in place.
+	 *
+	 * \param _aoOp The operation.
+	 * \param _dValue The right-hand operand.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note Integer arrays convert \p _dValue to their element type first and fail on integer division by 0.
+	 */
+	bool CArrayBase::ApplyScalar( EE_ARRAY_OP _aoOp, double _dValue ) {
+		double dBuffer[EE_ARRAY_BLOCK];
+		size_t sSize = GetSize();
+		for ( size_t I = 0; I < sSize; I += EE_ARRAY_BLOCK ) {
+			size_t sTotal = std::min( EE_ARRAY_BLOCK, sSize - I );
+			if ( !ReadDoubles( I, sTotal, dBuffer ) ) { return false; }
+			CArrayKernels::ApplyScalar( dBuffer, sTotal, _aoOp, _dValue );
+			if ( !WriteDoubles( I, sTotal, dBuffer ) ) { return false; }
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Applies an operation between every element and the matching element of another array, in place.
+	 *
+	 * \param _aoOp The operation.
+	 * \param _abOther The right-hand array.  Must be the same size as this array.  Can be this array.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note Integer arrays fail on integer division by 0.
+	 */
+	bool CArrayBase::Apply( EE_ARRAY_OP _aoOp, CArrayBase &_abOther ) {
+		size_t sSize = GetSize();
+		if ( _abOther.GetSize() != sSize ) { return false; }
+		double dLeft[EE_ARRAY_BLOCK];
+		double dRight[EE_ARRAY_BLOCK];
+		for ( size_t I = 0; I < sSize; I += EE_ARRAY_BLOCK ) {
+			size_t sTotal = std::min( EE_ARRAY_BLOCK, sSize - I );
+			if ( !ReadDoubles( I, sTotal, dLeft ) ) { return false; }
+			if ( !_abOther.ReadDoubles( I, sTotal, dRight ) ) { return false; }
+			CArrayKernels::Apply( dLeft, dRight, sTotal, _aoOp );
+			if ( !WriteDoubles( I, sTotal, dLeft ) ) { return false; }
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Sums the elements.
+	 *
+	 * \param _dRet Receives the sum.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note The sum is accumulated in double.
+	 */
+	bool CArrayBase::Sum( double &_dRet ) {
+		double dBuffer[EE_ARRAY_BLOCK];
+		size_t sSize = GetSize();
+		_dRet = 0.0;
+		for ( size_t I = 0; I < sSize; I += EE_ARRAY_BLOCK ) {
+			size_t sTotal = std::min( EE_ARRAY_BLOCK, sSize - I );
+			if ( !ReadDoubles( I, sTotal, dBuffer ) ) { return false; }
+			_dRet += CArrayKernels::Sum( dBuffer, sTotal );
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Finds the smallest element.
+	 *
+	 * \param _dRet Receives the smallest element.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note Returns false if the array is empty.
+	 */
+	bool CArrayBase::Min( double &_dRet ) {
+		double dBuffer[EE_ARRAY_BLOCK];
+		size_t sSize = GetSize();
+		if ( !sSize ) { return false; }
+		_dRet = std::numeric_limits<double>::infinity();
+		for ( size_t I = 0; I < sSize; I += EE_ARRAY_BLOCK ) {
+			size_t sTotal = std::min( EE_ARRAY_BLOCK, sSize - I );
+			if ( !ReadDoubles( I, sTotal, dBuffer ) ) { return false; }
+			_dRet = std::min( _dRet, CArrayKernels::MinMax( dBuffer, sTotal, false ) );
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Finds the largest element.
+	 *
+	 * \param _dRet Receives the largest element.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note Returns false if the array is empty.
+	 */
+	bool CArrayBase::Max( double &_dRet ) {
+		double dBuffer[EE_ARRAY_BLOCK];
+		size_t sSize = GetSize();
+		if ( !sSize ) { return false; }
+		_dRet = -std::numeric_limits<double>::infinity();
+		for ( size_t I = 0; I < sSize; I += EE_ARRAY_BLOCK ) {
+			size_t sTotal = std::min( EE_ARRAY_BLOCK, sSize - I );
+			if ( !ReadDoubles( I, sTotal, dBuffer ) ) { return false; }
+			_dRet = std::max( _dRet, CArrayKernels::MinMax( dBuffer, sTotal, true ) );
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Gets the root-mean-square of the elements.
+	 *
+	 * \param _dRet Receives the RMS.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note Returns false if the array is empty.
+	 */
+	bool CArrayBase::Rms( double &_dRet ) {
+		double dBuffer[EE_ARRAY_BLOCK];
+		size_t sSize = GetSize();
+		if ( !sSize ) { return false; }
+		double dSum = 0.0;
+		for ( size_t I = 0; I < sSize; I += EE_ARRAY_BLOCK ) {
+			size_t sTotal = std::min( EE_ARRAY_BLOCK, sSize - I );
+			if ( !ReadDoubles( I, sTotal, dBuffer ) ) { return false; }
+			dSum += CArrayKernels::Sum( dBuffer, sTotal, true );
+		}
+		_dRet = std::sqrt( dSum / static_cast<double>(sSize) );
+		return true;
+	}
+
+	/**
+	 * \brief Convolves this array with a kernel (full convolution).
+	 *
+	 * \param _abKernel The kernel.
+	 * \param _abDst Receives GetSize() + _abKernel.GetSize() - 1 elements.  Can be this array or the kernel.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note Returns false if either this array or the kernel is empty.
+	 */
+	bool CArrayBase::Convolve( CArrayBase &_abKernel, CArrayBase &_abDst ) {
+		try {
+			std::vector<double> vSignal, vKernel, vDst;
+			if ( !ReadAll( vSignal ) || !_abKernel.ReadAll( vKernel ) ) { return false; }
+			if ( vSignal.empty() || vKernel.empty() ) { return false; }
+			if ( !CArrayKernels::Convolve( vSignal.data(), vSignal.size(), vKernel.data(), vKernel.size(), vDst ) ) { return false; }
+			if ( !_abDst.SetSize( vDst.size() ) ) { return false; }
+			return _abDst.WriteDoubles( 0, vDst.size(), vDst.data() );
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * \brief Resamples this array to a new length with linear interpolation.
+	 *
+	 * \param _sNewSize The new number of elements.
+	 * \param _abDst Receives the resampled elements.  Can be this array.
+	 * \return Returns true if the operation succeeded; false otherwise.
+	 *
+	 * \note The first and last elements map onto the first and last resampled elements.
+	 * \note Returns false if this array is empty.
+	 */
+	bool CArrayBase::Resample( size_t _sNewSize, CArrayBase &_abDst ) {
+		try {
+			std::vector<double> vSrc;
+			if ( !ReadAll( vSrc ) || vSrc.empty() ) { return false; }
+			std::vector<double> vDst( _sNewSize );
+			if ( _sNewSize ) { CArrayKernels::Resample( vSrc.data(), vSrc.size(), vDst.data(), vDst.size() ); }
+			if ( !_abDst.SetSize( vDst.size() ) ) { return false; }
+			return _abDst.WriteDoubles( 0, vDst.size(), vDst.data() );
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * \brief Reads the whole array as doubles.
+	 *
+	 * \param _vDst Receives the elements.
+	 * \return Returns true if the read succeeded; false otherwise.
+	 */
+	bool CArrayBase::ReadAll( std::vector<double> &_vDst ) {
+		try {
+			_vDst.resize( GetSize() );
+		}
+		catch ( const std::bad_alloc /*& _eE*/ ) {
+			return false;
+		}
+		return ReadDoubles( 0, _vDst.size(), _vDst.data() );
+	}
 
 }	// namespace ee
@@ -2,6 +2,7 @@
 
 #include "../EEExpEval.h"
 #include "../EEExpEvalContainer.h"
+#include "EEArrayKernels.h"
 #include <vector>
 
 namespace ee {
@@ -159,10 +160,136 @@ namespace ee {
 		 */
 		virtual bool								AndEquals( size_t _sIdx, CExpEvalContainer::EE_RESULT &_rRet ) = 0;
 
+		/**
+		 * \brief Reads a run of elements as doubles.
+		 *
+		 * \param _sStart The index of the first element to read.
+		 * \param _sTotal The number of elements to read.
+		 * \param _pdDst Receives the elements.
+		 * \return Returns true if the read succeeded; false otherwise.
+		 *
+		 * \note The default implementation goes through ReadValue(); primitive arrays convert their storage directly.
+		 */
+		virtual bool								ReadDoubles( size_t _sStart, size_t _sTotal, double * _pdDst );
+
+		/**
+		 * \brief Writes a run of elements from doubles.
+		 *
+		 * \param _sStart The index of the first element to write.
+		 * \param _sTotal The number of elements to write.
+		 * \param _pdSrc The values to write.
+		 * \return Returns true if the write succeeded; false otherwise.
+		 *
+		 * \note The default implementation goes through WriteValue(); primitive arrays convert into their storage directly.
+		 */
+		virtual bool								WriteDoubles( size_t _sStart, size_t _sTotal, const double * _pdSrc );
+
+		/**
+		 * \brief Applies an operation between every element and a scalar, in place.
+		 *
+		 * \param _aoOp The operation.
+		 * \param _dValue The right-hand operand.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Integer arrays convert \p _dValue to their element type first and fail on integer division by 0.
+		 */
+		virtual bool								ApplyScalar( EE_ARRAY_OP _aoOp, double _dValue );
+
+		/**
+		 * \brief Applies an operation between every element and the matching element of another array, in place.
+		 *
+		 * \param _aoOp The operation.
+		 * \param _abOther The right-hand array.  Must be the same size as this array.  Can be this array.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Integer arrays fail on integer division by 0.
+		 */
+		virtual bool								Apply( EE_ARRAY_OP _aoOp, CArrayBase &_abOther );
+
+		/**
+		 * \brief Sums the elements.
+		 *
+		 * \param _dRet Receives the sum.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note The sum is accumulated in double.
+		 */
+		virtual bool								Sum( double &_dRet );
+
+		/**
+		 * \brief Finds the smallest element.
+		 *
+		 * \param _dRet Receives the smallest element.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if the array is empty.
+		 */
+		virtual bool								Min( double &_dRet );
+
+		/**
+		 * \brief Finds the largest element.
+		 *
+		 * \param _dRet Receives the largest element.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if the array is empty.
+		 */
+		virtual bool								Max( double &_dRet );
+
+		/**
+		 * \brief Gets the root-mean-square of the elements.
+		 *
+		 * \param _dRet Receives the RMS.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if the array is empty.
+		 */
+		virtual bool								Rms( double &_dRet );
+
+		/**
+		 * \brief Convolves this array with a kernel (full convolution).
+		 *
+		 * \param _abKernel The kernel.
+		 * \param _abDst Receives GetSize() + _abKernel.GetSize() - 1 elements.  Can be this array or the kernel.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if either this array or the kernel is empty.
+		 */
+		virtual bool								Convolve( CArrayBase &_abKernel, CArrayBase &_abDst );
+
+		/**
+		 * \brief Resamples this array to a new length with linear interpolation.
+		 *
+		 * \param _sNewSize The new number of elements.
+		 * \param _abDst Receives the resampled elements.  Can be this array.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note The first and last elements map onto the first and last resampled elements.
+		 * \note Returns false if this array is empty.
+		 */
+		virtual bool								Resample( size_t _sNewSize, CArrayBase &_abDst );
+
+		/**
+		 * \brief Gets a value unique to the array's class, so bulk operations can recognize arrays whose storage matches their own.
+		 *
+		 * \return Returns the class's tag, or nullptr for arrays without contiguous native storage.
+		 */
+		virtual const void *						TypeTag() const { return nullptr; }
+
 
 	protected :
 		// == Members.
 		CExpEvalContainer *							m_peecContainer;
+
+
+		// == Functions.
+		/**
+		 * \brief Reads the whole array as doubles.
+		 *
+		 * \param _vDst Receives the elements.
+		 * \return Returns true if the read succeeded; false otherwise.
+		 */
+		bool										ReadAll( std::vector<double> &_vDst );
 	};
 
 }	// namespace ee
@@ -0,0 +1,203 @@
+#include "EEArrayKernels.h"
+
+#if defined( EE_ARRAY_KERNELS_X86 ) && defined( _MSC_VER )
+#include <intrin.h>
+#include <immintrin.h>
+#endif	// #if defined( EE_ARRAY_KERNELS_X86 ) && defined( _MSC_VER )
+
+
+namespace ee {
+
+	// == Functions.
+	/**
+	 * \brief Applies an operation between each double and a scalar, in place, one element at a time.
+	 *
+	 * \param _pdDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 * \param _dValue The right-hand operand.
+	 */
+	static void										ApplyScalarF64( double * _pdDst, size_t _sTotal, EE_ARRAY_OP _aoOp, double _dValue ) {
+		CArrayKernels::ApplyScalarRange( _pdDst, _sTotal, _aoOp, _dValue );
+	}
+
+	/**
+	 * \brief Applies an operation between each float and a scalar, in place, one element at a time.
+	 *
+	 * \param _pfDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 * \param _fValue The right-hand operand.
+	 */
+	static void										ApplyScalarF32( float * _pfDst, size_t _sTotal, EE_ARRAY_OP _aoOp, float _fValue ) {
+		CArrayKernels::ApplyScalarRange( _pfDst, _sTotal, _aoOp, _fValue );
+	}
+
+	/**
+	 * \brief Applies an operation between each double and the matching double of another run, in place, one element at a time.
+	 *
+	 * \param _pdDst The left-hand elements, which receive the results.
+	 * \param _pdSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 */
+	static void										ApplyF64( double * _pdDst, const double * _pdSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+		CArrayKernels::ApplyRange( _pdDst, _pdSrc, _sTotal, _aoOp );
+	}
+
+	/**
+	 * \brief Applies an operation between each float and the matching float of another run, in place, one element at a time.
+	 *
+	 * \param _pfDst The left-hand elements, which receive the results.
+	 * \param _pfSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 */
+	static void										ApplyF32( float * _pfDst, const float * _pfSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+		CArrayKernels::ApplyRange( _pfDst, _pfSrc, _sTotal, _aoOp );
+	}
+
+	/**
+	 * \brief Sums doubles, or the squares of doubles, one element at a time.
+	 *
+	 * \param _pdSrc The elements.
+	 * \param _sTotal The number of elements.
+	 * \param _bSquares If true, the squares of the elements are summed.
+	 * \return Returns the sum.
+	 */
+	static double									SumF64( const double * _pdSrc, size_t _sTotal, bool _bSquares ) {
+		return CArrayKernels::SumRange( _pdSrc, _sTotal, _bSquares );
+	}
+
+	/**
+	 * \brief Sums floats, or the squares of floats, in double, one element at a time.
+	 *
+	 * \param _pfSrc The elements.
+	 * \param _sTotal The number of elements.
+	 * \param _bSquares If true, the squares of the elements are summed.
+	 * \return Returns the sum.
+	 */
+	static double									SumF32( const float * _pfSrc, size_t _sTotal, bool _bSquares ) {
+		return CArrayKernels::SumRange( _pfSrc, _sTotal, _bSquares );
+	}
+
+	/**
+	 * \brief Finds the smallest or largest double, one element at a time.
+	 *
+	 * \param _pdSrc The elements.  Must not be empty.
+	 * \param _sTotal The number of elements.  Must not be 0.
+	 * \param _bMax If true, the largest element is found, otherwise the smallest.
+	 * \return Returns the smallest or largest element.
+	 */
+	static double									MinMaxF64( const double * _pdSrc, size_t _sTotal, bool _bMax ) {
+		return CArrayKernels::MinMaxRange( _pdSrc, _sTotal, _bMax );
+	}
+
+	/**
+	 * \brief Finds the smallest or largest float, one element at a time.
+	 *
+	 * \param _pfSrc The elements.  Must not be empty.
+	 * \param _sTotal The number of elements.  Must not be 0.
+	 * \param _bMax If true, the largest element is found, otherwise the smallest.
+	 * \return Returns the smallest or largest element.
+	 */
+	static float									MinMaxF32( const float * _pfSrc, size_t _sTotal, bool _bMax ) {
+		return CArrayKernels::MinMaxRange( _pfSrc, _sTotal, _bMax );
+	}
+
+	/**
+	 * \brief Gets the dot product of two runs of doubles, one element at a time.
+	 *
+	 * \param _pdA The first run.
+	 * \param _pdB The second run.
+	 * \param _sTotal The number of elements in each run.
+	 * \return Returns the dot product.
+	 */
+	static double									DotF64( const double * _pdA, const double * _pdB, size_t _sTotal ) {
+		double dSum = 0.0;
+		for ( size_t I = 0; I < _sTotal; ++I ) { dSum += _pdA[I] * _pdB[I]; }
+		return dSum;
+	}
+
+	/**
+	 * \brief Gets the kernel table for the current processor.  Selected on the first call.
+	 *
+	 * \return Returns the kernel table for the current processor.
+	 */
+	const CArrayKernels::EE_KERNELS & CArrayKernels::Kernels() {
+		static const EE_KERNELS kTable = Select();
+		return kTable;
+	}
+
+	/**
+	 * \brief Gets the dot product of two runs of doubles.
+	 *
+	 * \param _pdA The first run.
+	 * \param _pdB The second run.
+	 * \param _sTotal The number of elements in each run.
+	 * \return Returns the dot product.
+	 */
+	double CArrayKernels::Dot( const double * _pdA, const double * _pdB, size_t _sTotal ) {
+		return Kernels().pfDot( _pdA, _pdB, _sTotal );
+	}
+
+	/**
+	 * \brief Selects the kernel table for the current processor.
+	 *
+	 * \return Returns the kernel table for the current processor.
+	 */
+	CArrayKernels::EE_KERNELS CArrayKernels::Select() {
+#ifdef EE_ARRAY_KERNELS_X86
+		if ( AvxSupported() ) {
+			return { ApplyScalarF64_AVX, ApplyScalarF32_AVX, ApplyF64_AVX, ApplyF32_AVX, SumF64_AVX, SumF32_AVX,
+				MinMaxF64_AVX, MinMaxF32_AVX, Dot_AVX };
+		}
+		if ( Sse2Supported() ) {
+			return { ApplyScalarF64_SSE2, ApplyScalarF32_SSE2, ApplyF64_SSE2, ApplyF32_SSE2, SumF64_SSE2, SumF32_SSE2,
+				MinMaxF64_SSE2, MinMaxF32_SSE2, Dot_SSE2 };
+		}
+#endif	// #ifdef EE_ARRAY_KERNELS_X86
+		return { ApplyScalarF64, ApplyScalarF32, ApplyF64, ApplyF32, SumF64, SumF32,
+			MinMaxF64, MinMaxF32, DotF64 };
+	}
+
+	/**
+	 * \brief Determines whether the processor and operating system support AVX.
+	 *
+	 * \return Returns true if AVX instructions can be used.
+	 */
+	bool CArrayKernels::AvxSupported() {
+#if defined( EE_ARRAY_KERNELS_X86 ) && defined( _MSC_VER )
+		int iInfo[4];
+		::__cpuid( iInfo, 1 );
+		// AVX, and the OS saves the YMM registers (OSXSAVE, then XCR0 bits 1 and 2).
+		if ( (iInfo[2] & (1 << 28)) == 0 || (iInfo[2] & (1 << 27)) == 0 ) { return false; }
+		return (::_xgetbv( 0 ) & 0x6) == 0x6;
+#elif defined( EE_ARRAY_KERNELS_X86 )
+		// Also checks that the OS saves the YMM registers.
+		return __builtin_cpu_supports( "avx" ) != 0;
+#else
+		return false;
+#endif	// #if defined( EE_ARRAY_KERNELS_X86 ) && defined( _MSC_VER )
+	}
+
+	/**
+	 * \brief Determines whether the processor supports SSE 2.
+	 *
+	 * \return Returns true if SSE 2 instructions can be used.
+	 */
+	bool CArrayKernels::Sse2Supported() {
+#if defined( __x86_64__ ) || defined( _M_X64 )
+		return true;
+#elif defined( EE_ARRAY_KERNELS_X86 ) && defined( _MSC_VER )
+		int iInfo[4];
+		::__cpuid( iInfo, 1 );
+		return (iInfo[3] & (1 << 26)) != 0;
+#elif defined( EE_ARRAY_KERNELS_X86 )
+		return __builtin_cpu_supports( "sse2" ) != 0;
+#else
+		return false;
+#endif	// #if defined( __x86_64__ ) || defined( _M_X64 )
+	}
+
+}	// namespace ee
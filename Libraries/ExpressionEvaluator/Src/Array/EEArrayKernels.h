@@ -0,0 +1,439 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+// MSVC emits any intrinsic regardless of /arch.
+#define EE_TARGET_SSE2
+#define EE_TARGET_AVX
+#else
+// GCC and Clang only emit intrinsics for enabled instruction sets, which these enable per-function.
+#define EE_TARGET_SSE2								__attribute__(( target( "sse2" ) ))
+#define EE_TARGET_AVX								__attribute__(( target( "avx" ) ))
+#endif	// #if defined( _MSC_VER ) && !defined( __clang__ )
+
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _M_IX86 ) || defined( _M_X64 )
+#define EE_ARRAY_KERNELS_X86
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _M_IX86 ) || defined( _M_X64 )
+
+#ifndef EE_ARRAY_PARALLEL_MIN
+/** The number of elements each worker thread must have before a bulk array operation is split across threads. */
+#define EE_ARRAY_PARALLEL_MIN				(1 << 18)
+#endif	// #ifndef EE_ARRAY_PARALLEL_MIN
+
+
+namespace ee {
+
+	/** Bulk elementwise array operations. */
+	enum EE_ARRAY_OP {
+		EE_AO_ADD,
+		EE_AO_SUB,
+		EE_AO_MUL,
+		EE_AO_DIV,
+	};
+
+	/**
+	 * Class CArrayKernels
+	 * \brief Native-typed kernels behind the bulk array operations.
+	 *
+	 * Description: Native-typed kernels behind the bulk array operations.  Each kernel works on raw element pointers and splits
+	 *	large arrays across threads.  The float and double loops are compiled once per instruction set (EEArrayKernels_SSE2.cpp,
+	 *	EEArrayKernels_AVX.cpp) without depending on the instruction sets the library is built for, and the fastest set the host
+	 *	supports is chosen the first time Kernels() is called.
+	 */
+	class CArrayKernels {
+	public :
+		// == Types.
+		/** Applies an operation between each double and a scalar, in place. */
+		typedef void (*								PfApplyScalarF64)( double * _pdDst, size_t _sTotal, EE_ARRAY_OP _aoOp, double _dValue );
+		/** Applies an operation between each float and a scalar, in place. */
+		typedef void (*								PfApplyScalarF32)( float * _pfDst, size_t _sTotal, EE_ARRAY_OP _aoOp, float _fValue );
+		/** Applies an operation between each double and the matching double of another run, in place. */
+		typedef void (*								PfApplyF64)( double * _pdDst, const double * _pdSrc, size_t _sTotal, EE_ARRAY_OP _aoOp );
+		/** Applies an operation between each float and the matching float of another run, in place. */
+		typedef void (*								PfApplyF32)( float * _pfDst, const float * _pfSrc, size_t _sTotal, EE_ARRAY_OP _aoOp );
+		/** Sums doubles, or the squares of doubles. */
+		typedef double (*							PfSumF64)( const double * _pdSrc, size_t _sTotal, bool _bSquares );
+		/** Sums floats, or the squares of floats, in double. */
+		typedef double (*							PfSumF32)( const float * _pfSrc, size_t _sTotal, bool _bSquares );
+		/** Finds the smallest or largest double. */
+		typedef double (*							PfMinMaxF64)( const double * _pdSrc, size_t _sTotal, bool _bMax );
+		/** Finds the smallest or largest float. */
+		typedef float (*							PfMinMaxF32)( const float * _pfSrc, size_t _sTotal, bool _bMax );
+		/** Gets the dot product of two runs of doubles. */
+		typedef double (*							PfDot)( const double * _pdA, const double * _pdB, size_t _sTotal );
+
+		/** The kernel table. */
+		struct EE_KERNELS {
+			PfApplyScalarF64						pfApplyScalarF64;							/**< Applies a scalar to doubles. */
+			PfApplyScalarF32						pfApplyScalarF32;							/**< Applies a scalar to floats. */
+			PfApplyF64								pfApplyF64;									/**< Applies doubles to doubles. */
+			PfApplyF32								pfApplyF32;									/**< Applies floats to floats. */
+			PfSumF64								pfSumF64;									/**< Sums doubles. */
+			PfSumF32								pfSumF32;									/**< Sums floats. */
+			PfMinMaxF64								pfMinMaxF64;								/**< Finds the smallest or largest double. */
+			PfMinMaxF32								pfMinMaxF32;								/**< Finds the smallest or largest float. */
+			PfDot									pfDot;										/**< Gets a dot product of doubles. */
+		};
+
+
+		// == Functions.
+		/**
+		 * \brief Gets the kernel table for the current processor.  Selected on the first call.
+		 *
+		 * \return Returns the kernel table for the current processor.
+		 */
+		static const EE_KERNELS &					Kernels();
+
+		/**
+		 * \brief Gets the number of threads a bulk operation over a given number of elements will use.
+		 *
+		 * \param _sTotal The number of elements.
+		 * \return Returns the number of threads (at least 1).
+		 */
+		static size_t								ThreadCount( size_t _sTotal ) {
+			size_t sThreads = _sTotal / EE_ARRAY_PARALLEL_MIN;
+			size_t sHw = std::thread::hardware_concurrency();
+			if ( sThreads > sHw ) { sThreads = sHw; }
+			return sThreads ? sThreads : 1;
+		}
+
+		/**
+		 * \brief Calls a function over contiguous ranges of [0, _sTotal), one range per thread.
+		 *
+		 * \param _sTotal The number of elements.
+		 * \param _sThreads The number of ranges, as returned by ThreadCount().
+		 * \param _fFunc The function, called as _fFunc( sStart, sEnd, sRange ).
+		 *
+		 * \note Ranges that cannot be given to a new thread are run on the calling thread.
+		 */
+		template <typename _tFunc>
+		static void									ParallelFor( size_t _sTotal, size_t _sThreads, const _tFunc &_fFunc ) {
+			if ( _sThreads <= 1 ) {
+				_fFunc( size_t( 0 ), _sTotal, size_t( 0 ) );
+				return;
+			}
+			size_t sPer = (_sTotal + _sThreads - 1) / _sThreads;
+			std::vector<std::thread> vThreads;
+			size_t sStarted = 1;
+			try {
+				vThreads.reserve( _sThreads - 1 );
+				for ( ; sStarted < _sThreads; ++sStarted ) {
+					size_t sStart = std::min( sStarted * sPer, _sTotal );
+					vThreads.emplace_back( [&_fFunc, sStart, sPer, _sTotal, sStarted]() {
+						_fFunc( sStart, std::min( sStart + sPer, _sTotal ), sStarted );
+					} );
+				}
+			}
+			catch ( ... ) {}
+			_fFunc( size_t( 0 ), std::min( sPer, _sTotal ), size_t( 0 ) );
+			for ( size_t I = sStarted; I < _sThreads; ++I ) {
+				size_t sStart = std::min( I * sPer, _sTotal );
+				_fFunc( sStart, std::min( sStart + sPer, _sTotal ), I );
+			}
+			for ( auto & tThis : vThreads ) { tThis.join(); }
+		}
+
+		/**
+		 * \brief Applies an operation between each element and a scalar, in place.
+		 *
+		 * \param _ptDst The elements to modify.
+		 * \param _sTotal The number of elements.
+		 * \param _aoOp The operation.
+		 * \param _tValue The right-hand operand.
+		 * \return Returns false if _aoOp is EE_AO_DIV, the elements are integers, and _tValue is 0.
+		 */
+		template <typename _tType>
+		static bool									ApplyScalar( _tType * _ptDst, size_t _sTotal, EE_ARRAY_OP _aoOp, _tType _tValue ) {
+			if constexpr ( std::is_integral_v<_tType> ) {
+				if ( _aoOp == EE_AO_DIV && _tValue == _tType( 0 ) ) { return false; }
+			}
+			const EE_KERNELS & kTable = Kernels();
+			ParallelFor( _sTotal, ThreadCount( _sTotal ), [&]( size_t _sStart, size_t _sEnd, size_t ) {
+				if constexpr ( std::is_same_v<_tType, double> ) { kTable.pfApplyScalarF64( _ptDst + _sStart, _sEnd - _sStart, _aoOp, _tValue ); }
+				else if constexpr ( std::is_same_v<_tType, float> ) { kTable.pfApplyScalarF32( _ptDst + _sStart, _sEnd - _sStart, _aoOp, _tValue ); }
+				else { ApplyScalarRange( _ptDst + _sStart, _sEnd - _sStart, _aoOp, _tValue ); }
+			} );
+			return true;
+		}
+
+		/**
+		 * \brief Applies an operation between each element and the matching element of another array, in place.
+		 *
+		 * \param _ptDst The left-hand elements, which receive the results.
+		 * \param _ptSrc The right-hand elements.
+		 * \param _sTotal The number of elements.
+		 * \param _aoOp The operation.
+		 * \return Returns false if _aoOp is EE_AO_DIV, the elements are integers, and any right-hand element is 0.
+		 */
+		template <typename _tType>
+		static bool									Apply( _tType * _ptDst, const _tType * _ptSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+			if constexpr ( std::is_integral_v<_tType> ) {
+				if ( _aoOp == EE_AO_DIV && std::find( _ptSrc, _ptSrc + _sTotal, _tType( 0 ) ) != _ptSrc + _sTotal ) { return false; }
+			}
+			const EE_KERNELS & kTable = Kernels();
+			ParallelFor( _sTotal, ThreadCount( _sTotal ), [&]( size_t _sStart, size_t _sEnd, size_t ) {
+				if constexpr ( std::is_same_v<_tType, double> ) { kTable.pfApplyF64( _ptDst + _sStart, _ptSrc + _sStart, _sEnd - _sStart, _aoOp ); }
+				else if constexpr ( std::is_same_v<_tType, float> ) { kTable.pfApplyF32( _ptDst + _sStart, _ptSrc + _sStart, _sEnd - _sStart, _aoOp ); }
+				else { ApplyRange( _ptDst + _sStart, _ptSrc + _sStart, _sEnd - _sStart, _aoOp ); }
+			} );
+			return true;
+		}
+
+		/**
+		 * \brief Sums elements, or the squares of elements.
+		 *
+		 * \param _ptSrc The elements.
+		 * \param _sTotal The number of elements.
+		 * \param _bSquares If true, the squares of the elements are summed.
+		 * \return Returns the sum, accumulated in double.
+		 */
+		template <typename _tType>
+		static double								Sum( const _tType * _ptSrc, size_t _sTotal, bool _bSquares = false ) {
+			size_t sThreads = ThreadCount( _sTotal );
+			std::vector<double> vPartial( sThreads );
+			const EE_KERNELS & kTable = Kernels();
+			ParallelFor( _sTotal, sThreads, [&]( size_t _sStart, size_t _sEnd, size_t _sRange ) {
+				if constexpr ( std::is_same_v<_tType, double> ) { vPartial[_sRange] = kTable.pfSumF64( _ptSrc + _sStart, _sEnd - _sStart, _bSquares ); }
+				else if constexpr ( std::is_same_v<_tType, float> ) { vPartial[_sRange] = kTable.pfSumF32( _ptSrc + _sStart, _sEnd - _sStart, _bSquares ); }
+				else { vPartial[_sRange] = SumRange( _ptSrc + _sStart, _sEnd - _sStart, _bSquares ); }
+			} );
+			double dSum = 0.0;
+			for ( auto dThis : vPartial ) { dSum += dThis; }
+			return dSum;
+		}
+
+		/**
+		 * \brief Finds the smallest or largest element.
+		 *
+		 * \param _ptSrc The elements.  Must not be empty.
+		 * \param _sTotal The number of elements.  Must not be 0.
+		 * \param _bMax If true, the largest element is found, otherwise the smallest.
+		 * \return Returns the smallest or largest element.
+		 */
+		template <typename _tType>
+		static _tType								MinMax( const _tType * _ptSrc, size_t _sTotal, bool _bMax ) {
+			size_t sThreads = ThreadCount( _sTotal );
+			std::vector<_tType> vPartial( sThreads, _ptSrc[0] );
+			const EE_KERNELS & kTable = Kernels();
+			ParallelFor( _sTotal, sThreads, [&]( size_t _sStart, size_t _sEnd, size_t _sRange ) {
+				if ( _sEnd == _sStart ) { return; }
+				if constexpr ( std::is_same_v<_tType, double> ) { vPartial[_sRange] = kTable.pfMinMaxF64( _ptSrc + _sStart, _sEnd - _sStart, _bMax ); }
+				else if constexpr ( std::is_same_v<_tType, float> ) { vPartial[_sRange] = kTable.pfMinMaxF32( _ptSrc + _sStart, _sEnd - _sStart, _bMax ); }
+				else { vPartial[_sRange] = MinMaxRange( _ptSrc + _sStart, _sEnd - _sStart, _bMax ); }
+			} );
+			_tType tRet = vPartial[0];
+			for ( auto tThis : vPartial ) { tRet = _bMax ? std::max( tRet, tThis ) : std::min( tRet, tThis ); }
+			return tRet;
+		}
+
+		/**
+		 * \brief Gets the dot product of two runs of doubles.
+		 *
+		 * \param _pdA The first run.
+		 * \param _pdB The second run.
+		 * \param _sTotal The number of elements in each run.
+		 * \return Returns the dot product.
+		 */
+		static double								Dot( const double * _pdA, const double * _pdB, size_t _sTotal );
+
+		/**
+		 * \brief Convolves a signal with a kernel (full convolution).
+		 *
+		 * \param _pdSignal The signal.
+		 * \param _sSignal The number of samples in the signal.  Must not be 0.
+		 * \param _pdKernel The kernel.
+		 * \param _sKernel The number of taps in the kernel.  Must not be 0.
+		 * \param _vDst Receives the _sSignal + _sKernel - 1 output samples.
+		 * \return Returns false if memory could not be allocated.
+		 */
+		static bool									Convolve( const double * _pdSignal, size_t _sSignal, const double * _pdKernel, size_t _sKernel, std::vector<double> &_vDst ) {
+			try {
+				// Reversing the kernel and zero-padding the signal turns every output sample into a straight dot product.
+				std::vector<double> vKernel( _pdKernel, _pdKernel + _sKernel );
+				std::reverse( vKernel.begin(), vKernel.end() );
+				std::vector<double> vPadded( _sSignal + (_sKernel - 1) * 2 );
+				std::copy( _pdSignal, _pdSignal + _sSignal, vPadded.begin() + (_sKernel - 1) );
+				_vDst.resize( _sSignal + _sKernel - 1 );
+
+				size_t sTotal = _vDst.size();
+				PfDot pfDot = Kernels().pfDot;
+				ParallelFor( sTotal, ThreadCount( sTotal * _sKernel / 16 ), [&]( size_t _sStart, size_t _sEnd, size_t ) {
+					for ( size_t I = _sStart; I < _sEnd; ++I ) {
+						_vDst[I] = pfDot( vPadded.data() + I, vKernel.data(), _sKernel );
+					}
+				} );
+				return true;
+			}
+			catch ( ... ) { return false; }
+		}
+
+		/**
+		 * \brief Resamples a signal to a new length with linear interpolation.  The first and last samples map onto the first and
+		 *	last output samples.
+		 *
+		 * \param _pdSrc The signal.
+		 * \param _sSrc The number of samples in the signal.  Must not be 0.
+		 * \param _pdDst Receives the resampled signal.
+		 * \param _sDst The number of output samples.
+		 */
+		static void									Resample( const double * _pdSrc, size_t _sSrc, double * _pdDst, size_t _sDst ) {
+			if ( _sDst == 1 || _sSrc == 1 ) {
+				std::fill( _pdDst, _pdDst + _sDst, _pdSrc[0] );
+				return;
+			}
+			double dStep = static_cast<double>(_sSrc - 1) / static_cast<double>(_sDst - 1);
+			ParallelFor( _sDst, ThreadCount( _sDst ), [&]( size_t _sStart, size_t _sEnd, size_t ) {
+				for ( size_t I = _sStart; I < _sEnd; ++I ) {
+					double dPos = I * dStep;
+					size_t sIdx = std::min( static_cast<size_t>(dPos), _sSrc - 2 );
+					double dFrac = dPos - static_cast<double>(sIdx);
+					_pdDst[I] = _pdSrc[sIdx] + (_pdSrc[sIdx+1] - _pdSrc[sIdx]) * dFrac;
+				}
+			} );
+		}
+
+		/**
+		 * \brief Applies a scalar operation over a range on the calling thread, one element at a time.  Used by every version
+		 *	for the elements that do not fill a vector.
+		 *
+		 * \param _ptDst The elements to modify.
+		 * \param _sTotal The number of elements.
+		 * \param _aoOp The operation.
+		 * \param _tValue The right-hand operand.
+		 */
+		template <typename _tType>
+		static void									ApplyScalarRange( _tType * _ptDst, size_t _sTotal, EE_ARRAY_OP _aoOp, _tType _tValue ) {
+			switch ( _aoOp ) {
+				case EE_AO_ADD : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_ADD>( _ptDst[I], _tValue ); } break; }
+				case EE_AO_SUB : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_SUB>( _ptDst[I], _tValue ); } break; }
+				case EE_AO_MUL : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_MUL>( _ptDst[I], _tValue ); } break; }
+				case EE_AO_DIV : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_DIV>( _ptDst[I], _tValue ); } break; }
+			}
+		}
+
+		/**
+		 * \brief Applies an elementwise operation over a range on the calling thread, one element at a time.  Used by every
+		 *	version for the elements that do not fill a vector.
+		 *
+		 * \param _ptDst The left-hand elements, which receive the results.
+		 * \param _ptSrc The right-hand elements.
+		 * \param _sTotal The number of elements.
+		 * \param _aoOp The operation.
+		 */
+		template <typename _tType>
+		static void									ApplyRange( _tType * _ptDst, const _tType * _ptSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+			switch ( _aoOp ) {
+				case EE_AO_ADD : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_ADD>( _ptDst[I], _ptSrc[I] ); } break; }
+				case EE_AO_SUB : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_SUB>( _ptDst[I], _ptSrc[I] ); } break; }
+				case EE_AO_MUL : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_MUL>( _ptDst[I], _ptSrc[I] ); } break; }
+				case EE_AO_DIV : { for ( size_t I = 0; I < _sTotal; ++I ) { _ptDst[I] = Op<EE_AO_DIV>( _ptDst[I], _ptSrc[I] ); } break; }
+			}
+		}
+
+		/**
+		 * \brief Sums a range (or the squares of a range) on the calling thread, one element at a time.  Used by every version
+		 *	for the elements that do not fill a vector.
+		 *
+		 * \param _ptSrc The elements.
+		 * \param _sTotal The number of elements.
+		 * \param _bSquares If true, the squares of the elements are summed.
+		 * \param _dSum The sum to which to add.
+		 * \return Returns the sum.
+		 */
+		template <typename _tType>
+		static double								SumRange( const _tType * _ptSrc, size_t _sTotal, bool _bSquares, double _dSum = 0.0 ) {
+			for ( size_t I = 0; I < _sTotal; ++I ) {
+				double dVal = static_cast<double>(_ptSrc[I]);
+				_dSum += _bSquares ? dVal * dVal : dVal;
+			}
+			return _dSum;
+		}
+
+		/**
+		 * \brief Finds the smallest or largest element of a range on the calling thread, one element at a time.  Used by every
+		 *	version for the elements that do not fill a vector.
+		 *
+		 * \param _ptSrc The elements.  Must not be empty.
+		 * \param _sTotal The number of elements.  Must not be 0.
+		 * \param _bMax If true, the largest element is found, otherwise the smallest.
+		 * \return Returns the smallest or largest element.
+		 */
+		template <typename _tType>
+		static _tType								MinMaxRange( const _tType * _ptSrc, size_t _sTotal, bool _bMax ) {
+			_tType tRet = _ptSrc[0];
+			for ( size_t I = 1; I < _sTotal; ++I ) { tRet = _bMax ? std::max( tRet, _ptSrc[I] ) : std::min( tRet, _ptSrc[I] ); }
+			return tRet;
+		}
+
+		/**
+		 * \brief Applies an operation to a pair of scalars.
+		 *
+		 * \param _tA The left operand.
+		 * \param _tB The right operand.
+		 * \return Returns the result of the operation.
+		 */
+		template <EE_ARRAY_OP _aoOp, typename _tType>
+		static inline _tType						Op( _tType _tA, _tType _tB ) {
+			if constexpr ( _aoOp == EE_AO_ADD ) { return static_cast<_tType>(_tA + _tB); }
+			else if constexpr ( _aoOp == EE_AO_SUB ) { return static_cast<_tType>(_tA - _tB); }
+			else if constexpr ( _aoOp == EE_AO_MUL ) { return static_cast<_tType>(_tA * _tB); }
+			else { return static_cast<_tType>(_tA / _tB); }
+		}
+
+#ifdef EE_ARRAY_KERNELS_X86
+		// SSE 2.
+		static void									ApplyScalarF64_SSE2( double * _pdDst, size_t _sTotal, EE_ARRAY_OP _aoOp, double _dValue );
+		static void									ApplyScalarF32_SSE2( float * _pfDst, size_t _sTotal, EE_ARRAY_OP _aoOp, float _fValue );
+		static void									ApplyF64_SSE2( double * _pdDst, const double * _pdSrc, size_t _sTotal, EE_ARRAY_OP _aoOp );
+		static void									ApplyF32_SSE2( float * _pfDst, const float * _pfSrc, size_t _sTotal, EE_ARRAY_OP _aoOp );
+		static double								SumF64_SSE2( const double * _pdSrc, size_t _sTotal, bool _bSquares );
+		static double								SumF32_SSE2( const float * _pfSrc, size_t _sTotal, bool _bSquares );
+		static double								MinMaxF64_SSE2( const double * _pdSrc, size_t _sTotal, bool _bMax );
+		static float								MinMaxF32_SSE2( const float * _pfSrc, size_t _sTotal, bool _bMax );
+		static double								Dot_SSE2( const double * _pdA, const double * _pdB, size_t _sTotal );
+
+		// AVX.
+		static void									ApplyScalarF64_AVX( double * _pdDst, size_t _sTotal, EE_ARRAY_OP _aoOp, double _dValue );
+		static void									ApplyScalarF32_AVX( float * _pfDst, size_t _sTotal, EE_ARRAY_OP _aoOp, float _fValue );
+		static void									ApplyF64_AVX( double * _pdDst, const double * _pdSrc, size_t _sTotal, EE_ARRAY_OP _aoOp );
+		static void									ApplyF32_AVX( float * _pfDst, const float * _pfSrc, size_t _sTotal, EE_ARRAY_OP _aoOp );
+		static double								SumF64_AVX( const double * _pdSrc, size_t _sTotal, bool _bSquares );
+		static double								SumF32_AVX( const float * _pfSrc, size_t _sTotal, bool _bSquares );
+		static double								MinMaxF64_AVX( const double * _pdSrc, size_t _sTotal, bool _bMax );
+		static float								MinMaxF32_AVX( const float * _pfSrc, size_t _sTotal, bool _bMax );
+		static double								Dot_AVX( const double * _pdA, const double * _pdB, size_t _sTotal );
+#endif	// #ifdef EE_ARRAY_KERNELS_X86
+
+
+	protected :
+		// == Functions.
+		/**
+		 * \brief Selects the kernel table for the current processor.
+		 *
+		 * \return Returns the kernel table for the current processor.
+		 */
+		static EE_KERNELS							Select();
+
+		/**
+		 * \brief Determines whether the processor and operating system support AVX.
+		 *
+		 * \return Returns true if AVX instructions can be used.
+		 */
+		static bool									AvxSupported();
+
+		/**
+		 * \brief Determines whether the processor supports SSE 2.
+		 *
+		 * \return Returns true if SSE 2 instructions can be used.
+		 */
+		static bool									Sse2Supported();
+	};
+
+}	// namespace ee
@@ -0,0 +1,304 @@
+#include "EEArrayKernels.h"
+
+#ifdef EE_ARRAY_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace ee {
+
+	// == Functions.
+	/**
+	 * \brief Applies an operation to 4 pairs of doubles.
+	 *
+	 * \param _mA The left operands.
+	 * \param _mB The right operands.
+	 * \return Returns the results of the operation.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static inline EE_TARGET_AVX __m256d					Op_AVX( __m256d _mA, __m256d _mB ) {
+		if constexpr ( _aoOp == EE_AO_ADD ) { return _mm256_add_pd( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_SUB ) { return _mm256_sub_pd( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_MUL ) { return _mm256_mul_pd( _mA, _mB ); }
+		else { return _mm256_div_pd( _mA, _mB ); }
+	}
+
+	/**
+	 * \brief Applies an operation to 8 pairs of floats.
+	 *
+	 * \param _mA The left operands.
+	 * \param _mB The right operands.
+	 * \return Returns the results of the operation.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static inline EE_TARGET_AVX __m256					Op_AVX( __m256 _mA, __m256 _mB ) {
+		if constexpr ( _aoOp == EE_AO_ADD ) { return _mm256_add_ps( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_SUB ) { return _mm256_sub_ps( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_MUL ) { return _mm256_mul_ps( _mA, _mB ); }
+		else { return _mm256_div_ps( _mA, _mB ); }
+	}
+
+	/**
+	 * \brief Adds the 4 doubles in a register.
+	 *
+	 * \param _mVal The register.
+	 * \return Returns the sum of the lanes.
+	 */
+	static inline EE_TARGET_AVX double					HorizontalSum_AVX( __m256d _mVal ) {
+		__m128d mSum = _mm_add_pd( _mm256_castpd256_pd128( _mVal ), _mm256_extractf128_pd( _mVal, 1 ) );
+		return _mm_cvtsd_f64( _mm_add_sd( mSum, _mm_unpackhi_pd( mSum, mSum ) ) );
+	}
+
+	/**
+	 * \brief Applies a scalar operation to the doubles that fill whole registers.
+	 *
+	 * \param _pdDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _dValue The right-hand operand.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_AVX size_t							ApplyScalarF64Vec_AVX( double * _pdDst, size_t _sTotal, double _dValue ) {
+		__m256d mVal = _mm256_set1_pd( _dValue );
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) { _mm256_storeu_pd( _pdDst + I, Op_AVX<_aoOp>( _mm256_loadu_pd( _pdDst + I ), mVal ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies a scalar operation to the floats that fill whole registers.
+	 *
+	 * \param _pfDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _fValue The right-hand operand.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_AVX size_t							ApplyScalarF32Vec_AVX( float * _pfDst, size_t _sTotal, float _fValue ) {
+		__m256 mVal = _mm256_set1_ps( _fValue );
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) { _mm256_storeu_ps( _pfDst + I, Op_AVX<_aoOp>( _mm256_loadu_ps( _pfDst + I ), mVal ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies an elementwise operation to the doubles that fill whole registers.
+	 *
+	 * \param _pdDst The left-hand elements, which receive the results.
+	 * \param _pdSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_AVX size_t							ApplyF64Vec_AVX( double * _pdDst, const double * _pdSrc, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) { _mm256_storeu_pd( _pdDst + I, Op_AVX<_aoOp>( _mm256_loadu_pd( _pdDst + I ), _mm256_loadu_pd( _pdSrc + I ) ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies an elementwise operation to the floats that fill whole registers.
+	 *
+	 * \param _pfDst The left-hand elements, which receive the results.
+	 * \param _pfSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_AVX size_t							ApplyF32Vec_AVX( float * _pfDst, const float * _pfSrc, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) { _mm256_storeu_ps( _pfDst + I, Op_AVX<_aoOp>( _mm256_loadu_ps( _pfDst + I ), _mm256_loadu_ps( _pfSrc + I ) ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies an operation between each double and a scalar, in place, using AVX.
+	 *
+	 * \param _pdDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 * \param _dValue The right-hand operand.
+	 */
+	EE_TARGET_AVX void CArrayKernels::ApplyScalarF64_AVX( double * _pdDst, size_t _sTotal, EE_ARRAY_OP _aoOp, double _dValue ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyScalarF64Vec_AVX<EE_AO_ADD>( _pdDst, _sTotal, _dValue ); break; }
+			case EE_AO_SUB : { I = ApplyScalarF64Vec_AVX<EE_AO_SUB>( _pdDst, _sTotal, _dValue ); break; }
+			case EE_AO_MUL : { I = ApplyScalarF64Vec_AVX<EE_AO_MUL>( _pdDst, _sTotal, _dValue ); break; }
+			case EE_AO_DIV : { I = ApplyScalarF64Vec_AVX<EE_AO_DIV>( _pdDst, _sTotal, _dValue ); break; }
+		}
+		ApplyScalarRange( _pdDst + I, _sTotal - I, _aoOp, _dValue );
+	}
+
+	/**
+	 * \brief Applies an operation between each float and a scalar, in place, using AVX.
+	 *
+	 * \param _pfDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 * \param _fValue The right-hand operand.
+	 */
+	EE_TARGET_AVX void CArrayKernels::ApplyScalarF32_AVX( float * _pfDst, size_t _sTotal, EE_ARRAY_OP _aoOp, float _fValue ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyScalarF32Vec_AVX<EE_AO_ADD>( _pfDst, _sTotal, _fValue ); break; }
+			case EE_AO_SUB : { I = ApplyScalarF32Vec_AVX<EE_AO_SUB>( _pfDst, _sTotal, _fValue ); break; }
+			case EE_AO_MUL : { I = ApplyScalarF32Vec_AVX<EE_AO_MUL>( _pfDst, _sTotal, _fValue ); break; }
+			case EE_AO_DIV : { I = ApplyScalarF32Vec_AVX<EE_AO_DIV>( _pfDst, _sTotal, _fValue ); break; }
+		}
+		ApplyScalarRange( _pfDst + I, _sTotal - I, _aoOp, _fValue );
+	}
+
+	/**
+	 * \brief Applies an operation between each double and the matching double of another run, in place, using AVX.
+	 *
+	 * \param _pdDst The left-hand elements, which receive the results.
+	 * \param _pdSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 */
+	EE_TARGET_AVX void CArrayKernels::ApplyF64_AVX( double * _pdDst, const double * _pdSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyF64Vec_AVX<EE_AO_ADD>( _pdDst, _pdSrc, _sTotal ); break; }
+			case EE_AO_SUB : { I = ApplyF64Vec_AVX<EE_AO_SUB>( _pdDst, _pdSrc, _sTotal ); break; }
+			case EE_AO_MUL : { I = ApplyF64Vec_AVX<EE_AO_MUL>( _pdDst, _pdSrc, _sTotal ); break; }
+			case EE_AO_DIV : { I = ApplyF64Vec_AVX<EE_AO_DIV>( _pdDst, _pdSrc, _sTotal ); break; }
+		}
+		ApplyRange( _pdDst + I, _pdSrc + I, _sTotal - I, _aoOp );
+	}
+
+	/**
+	 * \brief Applies an operation between each float and the matching float of another run, in place, using AVX.
+	 *
+	 * \param _pfDst The left-hand elements, which receive the results.
+	 * \param _pfSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 */
+	EE_TARGET_AVX void CArrayKernels::ApplyF32_AVX( float * _pfDst, const float * _pfSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyF32Vec_AVX<EE_AO_ADD>( _pfDst, _pfSrc, _sTotal ); break; }
+			case EE_AO_SUB : { I = ApplyF32Vec_AVX<EE_AO_SUB>( _pfDst, _pfSrc, _sTotal ); break; }
+			case EE_AO_MUL : { I = ApplyF32Vec_AVX<EE_AO_MUL>( _pfDst, _pfSrc, _sTotal ); break; }
+			case EE_AO_DIV : { I = ApplyF32Vec_AVX<EE_AO_DIV>( _pfDst, _pfSrc, _sTotal ); break; }
+		}
+		ApplyRange( _pfDst + I, _pfSrc + I, _sTotal - I, _aoOp );
+	}
+
+	/**
+	 * \brief Sums doubles, or the squares of doubles, using AVX.
+	 *
+	 * \param _pdSrc The elements.
+	 * \param _sTotal The number of elements.
+	 * \param _bSquares If true, the squares of the elements are summed.
+	 * \return Returns the sum.
+	 */
+	EE_TARGET_AVX double CArrayKernels::SumF64_AVX( const double * _pdSrc, size_t _sTotal, bool _bSquares ) {
+		__m256d mSum = _mm256_setzero_pd();
+		size_t I = 0;
+		if ( _bSquares ) {
+			for ( ; I + 4 <= _sTotal; I += 4 ) {
+				__m256d mVal = _mm256_loadu_pd( _pdSrc + I );
+				mSum = _mm256_add_pd( mSum, _mm256_mul_pd( mVal, mVal ) );
+			}
+		}
+		else {
+			for ( ; I + 4 <= _sTotal; I += 4 ) { mSum = _mm256_add_pd( mSum, _mm256_loadu_pd( _pdSrc + I ) ); }
+		}
+		return SumRange( _pdSrc + I, _sTotal - I, _bSquares, HorizontalSum_AVX( mSum ) );
+	}
+
+	/**
+	 * \brief Sums floats, or the squares of floats, in double, using AVX.
+	 *
+	 * \param _pfSrc The elements.
+	 * \param _sTotal The number of elements.
+	 * \param _bSquares If true, the squares of the elements are summed.
+	 * \return Returns the sum.
+	 */
+	EE_TARGET_AVX double CArrayKernels::SumF32_AVX( const float * _pfSrc, size_t _sTotal, bool _bSquares ) {
+		// Floats are widened so that long runs do not lose precision.
+		__m256d mSum = _mm256_setzero_pd();
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			__m256d mVal = _mm256_cvtps_pd( _mm_loadu_ps( _pfSrc + I ) );
+			mSum = _mm256_add_pd( mSum, _bSquares ? _mm256_mul_pd( mVal, mVal ) : mVal );
+		}
+		return SumRange( _pfSrc + I, _sTotal - I, _bSquares, HorizontalSum_AVX( mSum ) );
+	}
+
+	/**
+	 * \brief Finds the smallest or largest double using AVX.
+	 *
+	 * \param _pdSrc The elements.  Must not be empty.
+	 * \param _sTotal The number of elements.  Must not be 0.
+	 * \param _bMax If true, the largest element is found, otherwise the smallest.
+	 * \return Returns the smallest or largest element.
+	 */
+	EE_TARGET_AVX double CArrayKernels::MinMaxF64_AVX( const double * _pdSrc, size_t _sTotal, bool _bMax ) {
+		if ( _sTotal < 4 ) { return MinMaxRange( _pdSrc, _sTotal, _bMax ); }
+		__m256d mRet = _mm256_loadu_pd( _pdSrc );
+		size_t I = 4;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			__m256d mVal = _mm256_loadu_pd( _pdSrc + I );
+			mRet = _bMax ? _mm256_max_pd( mRet, mVal ) : _mm256_min_pd( mRet, mVal );
+		}
+		double dTmp[4];
+		_mm256_storeu_pd( dTmp, mRet );
+		double dRet = MinMaxRange( dTmp, 4, _bMax );
+		if ( I < _sTotal ) {
+			double dTail = MinMaxRange( _pdSrc + I, _sTotal - I, _bMax );
+			dRet = _bMax ? std::max( dRet, dTail ) : std::min( dRet, dTail );
+		}
+		return dRet;
+	}
+
+	/**
+	 * \brief Finds the smallest or largest float using AVX.
+	 *
+	 * \param _pfSrc The elements.  Must not be empty.
+	 * \param _sTotal The number of elements.  Must not be 0.
+	 * \param _bMax If true, the largest element is found, otherwise the smallest.
+	 * \return Returns the smallest or largest element.
+	 */
+	EE_TARGET_AVX float CArrayKernels::MinMaxF32_AVX( const float * _pfSrc, size_t _sTotal, bool _bMax ) {
+		if ( _sTotal < 8 ) { return MinMaxRange( _pfSrc, _sTotal, _bMax ); }
+		__m256 mRet = _mm256_loadu_ps( _pfSrc );
+		size_t I = 8;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			__m256 mVal = _mm256_loadu_ps( _pfSrc + I );
+			mRet = _bMax ? _mm256_max_ps( mRet, mVal ) : _mm256_min_ps( mRet, mVal );
+		}
+		float fTmp[8];
+		_mm256_storeu_ps( fTmp, mRet );
+		float fRet = MinMaxRange( fTmp, 8, _bMax );
+		if ( I < _sTotal ) {
+			float fTail = MinMaxRange( _pfSrc + I, _sTotal - I, _bMax );
+			fRet = _bMax ? std::max( fRet, fTail ) : std::min( fRet, fTail );
+		}
+		return fRet;
+	}
+
+	/**
+	 * \brief Gets the dot product of two runs of doubles using AVX.
+	 *
+	 * \param _pdA The first run.
+	 * \param _pdB The second run.
+	 * \param _sTotal The number of elements in each run.
+	 * \return Returns the dot product.
+	 */
+	EE_TARGET_AVX double CArrayKernels::Dot_AVX( const double * _pdA, const double * _pdB, size_t _sTotal ) {
+		__m256d mSum = _mm256_setzero_pd();
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			mSum = _mm256_add_pd( mSum, _mm256_mul_pd( _mm256_loadu_pd( _pdA + I ), _mm256_loadu_pd( _pdB + I ) ) );
+		}
+		double dSum = HorizontalSum_AVX( mSum );
+		for ( ; I < _sTotal; ++I ) { dSum += _pdA[I] * _pdB[I]; }
+		return dSum;
+	}
+
+}	// namespace ee
+
+#endif	// #ifdef EE_ARRAY_KERNELS_X86
@@ -0,0 +1,303 @@
+#include "EEArrayKernels.h"
+
+#ifdef EE_ARRAY_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace ee {
+
+	// == Functions.
+	/**
+	 * \brief Applies an operation to 2 pairs of doubles.
+	 *
+	 * \param _mA The left operands.
+	 * \param _mB The right operands.
+	 * \return Returns the results of the operation.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static inline EE_TARGET_SSE2 __m128d				Op_SSE2( __m128d _mA, __m128d _mB ) {
+		if constexpr ( _aoOp == EE_AO_ADD ) { return _mm_add_pd( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_SUB ) { return _mm_sub_pd( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_MUL ) { return _mm_mul_pd( _mA, _mB ); }
+		else { return _mm_div_pd( _mA, _mB ); }
+	}
+
+	/**
+	 * \brief Applies an operation to 4 pairs of floats.
+	 *
+	 * \param _mA The left operands.
+	 * \param _mB The right operands.
+	 * \return Returns the results of the operation.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static inline EE_TARGET_SSE2 __m128					Op_SSE2( __m128 _mA, __m128 _mB ) {
+		if constexpr ( _aoOp == EE_AO_ADD ) { return _mm_add_ps( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_SUB ) { return _mm_sub_ps( _mA, _mB ); }
+		else if constexpr ( _aoOp == EE_AO_MUL ) { return _mm_mul_ps( _mA, _mB ); }
+		else { return _mm_div_ps( _mA, _mB ); }
+	}
+
+	/**
+	 * \brief Adds the 2 doubles in a register.
+	 *
+	 * \param _mVal The register.
+	 * \return Returns the sum of the lanes.
+	 */
+	static inline EE_TARGET_SSE2 double					HorizontalSum_SSE2( __m128d _mVal ) {
+		return _mm_cvtsd_f64( _mm_add_sd( _mVal, _mm_unpackhi_pd( _mVal, _mVal ) ) );
+	}
+
+	/**
+	 * \brief Applies a scalar operation to the doubles that fill whole registers.
+	 *
+	 * \param _pdDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _dValue The right-hand operand.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_SSE2 size_t						ApplyScalarF64Vec_SSE2( double * _pdDst, size_t _sTotal, double _dValue ) {
+		__m128d mVal = _mm_set1_pd( _dValue );
+		size_t I = 0;
+		for ( ; I + 2 <= _sTotal; I += 2 ) { _mm_storeu_pd( _pdDst + I, Op_SSE2<_aoOp>( _mm_loadu_pd( _pdDst + I ), mVal ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies a scalar operation to the floats that fill whole registers.
+	 *
+	 * \param _pfDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _fValue The right-hand operand.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_SSE2 size_t						ApplyScalarF32Vec_SSE2( float * _pfDst, size_t _sTotal, float _fValue ) {
+		__m128 mVal = _mm_set1_ps( _fValue );
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) { _mm_storeu_ps( _pfDst + I, Op_SSE2<_aoOp>( _mm_loadu_ps( _pfDst + I ), mVal ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies an elementwise operation to the doubles that fill whole registers.
+	 *
+	 * \param _pdDst The left-hand elements, which receive the results.
+	 * \param _pdSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_SSE2 size_t						ApplyF64Vec_SSE2( double * _pdDst, const double * _pdSrc, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 2 <= _sTotal; I += 2 ) { _mm_storeu_pd( _pdDst + I, Op_SSE2<_aoOp>( _mm_loadu_pd( _pdDst + I ), _mm_loadu_pd( _pdSrc + I ) ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies an elementwise operation to the floats that fill whole registers.
+	 *
+	 * \param _pfDst The left-hand elements, which receive the results.
+	 * \param _pfSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \return Returns the number of elements processed.
+	 */
+	template <EE_ARRAY_OP _aoOp>
+	static EE_TARGET_SSE2 size_t						ApplyF32Vec_SSE2( float * _pfDst, const float * _pfSrc, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) { _mm_storeu_ps( _pfDst + I, Op_SSE2<_aoOp>( _mm_loadu_ps( _pfDst + I ), _mm_loadu_ps( _pfSrc + I ) ) ); }
+		return I;
+	}
+
+	/**
+	 * \brief Applies an operation between each double and a scalar, in place, using SSE 2.
+	 *
+	 * \param _pdDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 * \param _dValue The right-hand operand.
+	 */
+	EE_TARGET_SSE2 void CArrayKernels::ApplyScalarF64_SSE2( double * _pdDst, size_t _sTotal, EE_ARRAY_OP _aoOp, double _dValue ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyScalarF64Vec_SSE2<EE_AO_ADD>( _pdDst, _sTotal, _dValue ); break; }
+			case EE_AO_SUB : { I = ApplyScalarF64Vec_SSE2<EE_AO_SUB>( _pdDst, _sTotal, _dValue ); break; }
+			case EE_AO_MUL : { I = ApplyScalarF64Vec_SSE2<EE_AO_MUL>( _pdDst, _sTotal, _dValue ); break; }
+			case EE_AO_DIV : { I = ApplyScalarF64Vec_SSE2<EE_AO_DIV>( _pdDst, _sTotal, _dValue ); break; }
+		}
+		ApplyScalarRange( _pdDst + I, _sTotal - I, _aoOp, _dValue );
+	}
+
+	/**
+	 * \brief Applies an operation between each float and a scalar, in place, using SSE 2.
+	 *
+	 * \param _pfDst The elements to modify.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 * \param _fValue The right-hand operand.
+	 */
+	EE_TARGET_SSE2 void CArrayKernels::ApplyScalarF32_SSE2( float * _pfDst, size_t _sTotal, EE_ARRAY_OP _aoOp, float _fValue ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyScalarF32Vec_SSE2<EE_AO_ADD>( _pfDst, _sTotal, _fValue ); break; }
+			case EE_AO_SUB : { I = ApplyScalarF32Vec_SSE2<EE_AO_SUB>( _pfDst, _sTotal, _fValue ); break; }
+			case EE_AO_MUL : { I = ApplyScalarF32Vec_SSE2<EE_AO_MUL>( _pfDst, _sTotal, _fValue ); break; }
+			case EE_AO_DIV : { I = ApplyScalarF32Vec_SSE2<EE_AO_DIV>( _pfDst, _sTotal, _fValue ); break; }
+		}
+		ApplyScalarRange( _pfDst + I, _sTotal - I, _aoOp, _fValue );
+	}
+
+	/**
+	 * \brief Applies an operation between each double and the matching double of another run, in place, using SSE 2.
+	 *
+	 * \param _pdDst The left-hand elements, which receive the results.
+	 * \param _pdSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 */
+	EE_TARGET_SSE2 void CArrayKernels::ApplyF64_SSE2( double * _pdDst, const double * _pdSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyF64Vec_SSE2<EE_AO_ADD>( _pdDst, _pdSrc, _sTotal ); break; }
+			case EE_AO_SUB : { I = ApplyF64Vec_SSE2<EE_AO_SUB>( _pdDst, _pdSrc, _sTotal ); break; }
+			case EE_AO_MUL : { I = ApplyF64Vec_SSE2<EE_AO_MUL>( _pdDst, _pdSrc, _sTotal ); break; }
+			case EE_AO_DIV : { I = ApplyF64Vec_SSE2<EE_AO_DIV>( _pdDst, _pdSrc, _sTotal ); break; }
+		}
+		ApplyRange( _pdDst + I, _pdSrc + I, _sTotal - I, _aoOp );
+	}
+
+	/**
+	 * \brief Applies an operation between each float and the matching float of another run, in place, using SSE 2.
+	 *
+	 * \param _pfDst The left-hand elements, which receive the results.
+	 * \param _pfSrc The right-hand elements.
+	 * \param _sTotal The number of elements.
+	 * \param _aoOp The operation.
+	 */
+	EE_TARGET_SSE2 void CArrayKernels::ApplyF32_SSE2( float * _pfDst, const float * _pfSrc, size_t _sTotal, EE_ARRAY_OP _aoOp ) {
+		size_t I = 0;
+		switch ( _aoOp ) {
+			case EE_AO_ADD : { I = ApplyF32Vec_SSE2<EE_AO_ADD>( _pfDst, _pfSrc, _sTotal ); break; }
+			case EE_AO_SUB : { I = ApplyF32Vec_SSE2<EE_AO_SUB>( _pfDst, _pfSrc, _sTotal ); break; }
+			case EE_AO_MUL : { I = ApplyF32Vec_SSE2<EE_AO_MUL>( _pfDst, _pfSrc, _sTotal ); break; }
+			case EE_AO_DIV : { I = ApplyF32Vec_SSE2<EE_AO_DIV>( _pfDst, _pfSrc, _sTotal ); break; }
+		}
+		ApplyRange( _pfDst + I, _pfSrc + I, _sTotal - I, _aoOp );
+	}
+
+	/**
+	 * \brief Sums doubles, or the squares of doubles, using SSE 2.
+	 *
+	 * \param _pdSrc The elements.
+	 * \param _sTotal The number of elements.
+	 * \param _bSquares If true, the squares of the elements are summed.
+	 * \return Returns the sum.
+	 */
+	EE_TARGET_SSE2 double CArrayKernels::SumF64_SSE2( const double * _pdSrc, size_t _sTotal, bool _bSquares ) {
+		__m128d mSum = _mm_setzero_pd();
+		size_t I = 0;
+		if ( _bSquares ) {
+			for ( ; I + 2 <= _sTotal; I += 2 ) {
+				__m128d mVal = _mm_loadu_pd( _pdSrc + I );
+				mSum = _mm_add_pd( mSum, _mm_mul_pd( mVal, mVal ) );
+			}
+		}
+		else {
+			for ( ; I + 2 <= _sTotal; I += 2 ) { mSum = _mm_add_pd( mSum, _mm_loadu_pd( _pdSrc + I ) ); }
+		}
+		return SumRange( _pdSrc + I, _sTotal - I, _bSquares, HorizontalSum_SSE2( mSum ) );
+	}
+
+	/**
+	 * \brief Sums floats, or the squares of floats, in double, using SSE 2.
+	 *
+	 * \param _pfSrc The elements.
+	 * \param _sTotal The number of elements.
+	 * \param _bSquares If true, the squares of the elements are summed.
+	 * \return Returns the sum.
+	 */
+	EE_TARGET_SSE2 double CArrayKernels::SumF32_SSE2( const float * _pfSrc, size_t _sTotal, bool _bSquares ) {
+		// Floats are widened so that long runs do not lose precision.
+		__m128d mSum = _mm_setzero_pd();
+		size_t I = 0;
+		for ( ; I + 2 <= _sTotal; I += 2 ) {
+			__m128d mVal = _mm_cvtps_pd( _mm_castpd_ps( _mm_load_sd( reinterpret_cast<const double *>(_pfSrc + I) ) ) );
+			mSum = _mm_add_pd( mSum, _bSquares ? _mm_mul_pd( mVal, mVal ) : mVal );
+		}
+		return SumRange( _pfSrc + I, _sTotal - I, _bSquares, HorizontalSum_SSE2( mSum ) );
+	}
+
+	/**
+	 * \brief Finds the smallest or largest double using SSE 2.
+	 *
+	 * \param _pdSrc The elements.  Must not be empty.
+	 * \param _sTotal The number of elements.  Must not be 0.
+	 * \param _bMax If true, the largest element is found, otherwise the smallest.
+	 * \return Returns the smallest or largest element.
+	 */
+	EE_TARGET_SSE2 double CArrayKernels::MinMaxF64_SSE2( const double * _pdSrc, size_t _sTotal, bool _bMax ) {
+		if ( _sTotal < 2 ) { return _pdSrc[0]; }
+		__m128d mRet = _mm_loadu_pd( _pdSrc );
+		size_t I = 2;
+		for ( ; I + 2 <= _sTotal; I += 2 ) {
+			__m128d mVal = _mm_loadu_pd( _pdSrc + I );
+			mRet = _bMax ? _mm_max_pd( mRet, mVal ) : _mm_min_pd( mRet, mVal );
+		}
+		double dTmp[2];
+		_mm_storeu_pd( dTmp, mRet );
+		double dRet = _bMax ? std::max( dTmp[0], dTmp[1] ) : std::min( dTmp[0], dTmp[1] );
+		if ( I < _sTotal ) {
+			double dTail = MinMaxRange( _pdSrc + I, _sTotal - I, _bMax );
+			dRet = _bMax ? std::max( dRet, dTail ) : std::min( dRet, dTail );
+		}
+		return dRet;
+	}
+
+	/**
+	 * \brief Finds the smallest or largest float using SSE 2.
+	 *
+	 * \param _pfSrc The elements.  Must not be empty.
+	 * \param _sTotal The number of elements.  Must not be 0.
+	 * \param _bMax If true, the largest element is found, otherwise the smallest.
+	 * \return Returns the smallest or largest element.
+	 */
+	EE_TARGET_SSE2 float CArrayKernels::MinMaxF32_SSE2( const float * _pfSrc, size_t _sTotal, bool _bMax ) {
+		if ( _sTotal < 4 ) { return MinMaxRange( _pfSrc, _sTotal, _bMax ); }
+		__m128 mRet = _mm_loadu_ps( _pfSrc );
+		size_t I = 4;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			__m128 mVal = _mm_loadu_ps( _pfSrc + I );
+			mRet = _bMax ? _mm_max_ps( mRet, mVal ) : _mm_min_ps( mRet, mVal );
+		}
+		float fTmp[4];
+		_mm_storeu_ps( fTmp, mRet );
+		float fRet = MinMaxRange( fTmp, 4, _bMax );
+		if ( I < _sTotal ) {
+			float fTail = MinMaxRange( _pfSrc + I, _sTotal - I, _bMax );
+			fRet = _bMax ? std::max( fRet, fTail ) : std::min( fRet, fTail );
+		}
+		return fRet;
+	}
+
+	/**
+	 * \brief Gets the dot product of two runs of doubles using SSE 2.
+	 *
+	 * \param _pdA The first run.
+	 * \param _pdB The second run.
+	 * \param _sTotal The number of elements in each run.
+	 * \return Returns the dot product.
+	 */
+	EE_TARGET_SSE2 double CArrayKernels::Dot_SSE2( const double * _pdA, const double * _pdB, size_t _sTotal ) {
+		__m128d mSum = _mm_setzero_pd();
+		size_t I = 0;
+		for ( ; I + 2 <= _sTotal; I += 2 ) {
+			mSum = _mm_add_pd( mSum, _mm_mul_pd( _mm_loadu_pd( _pdA + I ), _mm_loadu_pd( _pdB + I ) ) );
+		}
+		double dSum = HorizontalSum_SSE2( mSum );
+		for ( ; I < _sTotal; ++I ) { dSum += _pdA[I] * _pdB[I]; }
+		return dSum;
+	}
+
+}	// namespace ee
+
+#endif	// #ifdef EE_ARRAY_KERNELS_X86
@@ -315,6 +315,143 @@ namespace ee {
 			return false;
 		}
 
+		/**
+		 * \brief Reads a run of elements as doubles.
+		 *
+		 * \param _sStart The index of the first element to read.
+		 * \param _sTotal The number of elements to read.
+		 * \param _pdDst Receives the elements.
+		 * \return Returns true if the read succeeded; false otherwise.
+		 *
+		 * \note Returns false if the run extends past the end of the array.
+		 */
+		virtual bool								ReadDoubles( size_t _sStart, size_t _sTotal, double * _pdDst ) {
+			if ( _sStart > m_vArray.size() || m_vArray.size() - _sStart < _sTotal ) { return false; }
+			const _tnBaseType * ptSrc = m_vArray.data() + _sStart;
+			for ( size_t I = 0; I < _sTotal; ++I ) { _pdDst[I] = static_cast<double>(ptSrc[I]); }
+			return true;
+		}
+
+		/**
+		 * \brief Writes a run of elements from doubles.
+		 *
+		 * \param _sStart The index of the first element to write.
+		 * \param _sTotal The number of elements to write.
+		 * \param _pdSrc The values to write.
+		 * \return Returns true if the write succeeded; false otherwise.
+		 *
+		 * \note Each value is static_cast to the array element type (_tnBaseType).
+		 * \note Returns false if the run extends past the end of the array.
+		 */
+		virtual bool								WriteDoubles( size_t _sStart, size_t _sTotal, const double * _pdSrc ) {
+			if ( _sStart > m_vArray.size() || m_vArray.size() - _sStart < _sTotal ) { return false; }
+			_tnBaseType * ptDst = m_vArray.data() + _sStart;
+			for ( size_t I = 0; I < _sTotal; ++I ) { ptDst[I] = static_cast<_tnBaseType>(_pdSrc[I]); }
+			return true;
+		}
+
+		/**
+		 * \brief Applies an operation between every element and a scalar, in place, in the element type.
+		 *
+		 * \param _aoOp The operation.
+		 * \param _dValue The right-hand operand.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 */
+		virtual bool								ApplyScalar( EE_ARRAY_OP _aoOp, double _dValue ) {
+			return CArrayKernels::ApplyScalar( m_vArray.data(), m_vArray.size(), _aoOp, static_cast<_tnBaseType>(_dValue) );
+		}
+
+		/**
+		 * \brief Applies an operation between every element and the matching element of another array, in place, in the element type.
+		 *
+		 * \param _aoOp The operation.
+		 * \param _abOther The right-hand array.  Must be the same size as this array.  Can be this array.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Arrays of the same type are read directly; others are converted through doubles a block at a time.
+		 */
+		virtual bool								Apply( EE_ARRAY_OP _aoOp, CArrayBase &_abOther ) {
+			if ( _abOther.GetSize() != m_vArray.size() ) { return false; }
+			if ( _abOther.TypeTag() == TypeTag() ) {
+				return CArrayKernels::Apply( m_vArray.data(), static_cast<CPrimitiveArrayFloat<_tnBaseType> &>(_abOther).m_vArray.data(), m_vArray.size(), _aoOp );
+			}
+			constexpr size_t sBlock = 4096;
+			double dBuffer[sBlock];
+			_tnBaseType tBuffer[sBlock];
+			for ( size_t I = 0; I < m_vArray.size(); I += sBlock ) {
+				size_t sTotal = std::min( sBlock, m_vArray.size() - I );
+				if ( !_abOther.ReadDoubles( I, sTotal, dBuffer ) ) { return false; }
+				for ( size_t J = 0; J < sTotal; ++J ) { tBuffer[J] = static_cast<_tnBaseType>(dBuffer[J]); }
+				if ( !CArrayKernels::Apply( m_vArray.data() + I, tBuffer, sTotal, _aoOp ) ) { return false; }
+			}
+			return true;
+		}
+
+		/**
+		 * \brief Sums the elements.
+		 *
+		 * \param _dRet Receives the sum.
+		 * \return Returns true.
+		 *
+		 * \note The sum is accumulated in double.
+		 */
+		virtual bool								Sum( double &_dRet ) {
+			_dRet = CArrayKernels::Sum( m_vArray.data(), m_vArray.size() );
+			return true;
+		}
+
+		/**
+		 * \brief Finds the smallest element.
+		 *
+		 * \param _dRet Receives the smallest element.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if the array is empty.
+		 */
+		virtual bool								Min( double &_dRet ) {
+			if ( m_vArray.empty() ) { return false; }
+			_dRet = static_cast<double>(CArrayKernels::MinMax( m_vArray.data(), m_vArray.size(), false ));
+			return true;
+		}
+
+		/**
+		 * \brief Finds the largest element.
+		 *
+		 * \param _dRet Receives the largest element.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if the array is empty.
+		 */
+		virtual bool								Max( double &_dRet ) {
+			if ( m_vArray.empty() ) { return false; }
+			_dRet = static_cast<double>(CArrayKernels::MinMax( m_vArray.data(), m_vArray.size(), true ));
+			return true;
+		}
+
+		/**
+		 * \brief Gets the root-mean-square of the elements.
+		 *
+		 * \param _dRet Receives the RMS.
+		 * \return Returns true if the operation succeeded; false otherwise.
+		 *
+		 * \note Returns false if the array is empty.
+		 */
+		virtual bool								Rms( double &_dRet ) {
+			if ( m_vArray.empty() ) { return false; }
+			_dRet = std::sqrt( CArrayKernels::Sum( m_vArray.data(), m_vArray.size(), true ) / static_cast<double>(m_vArray.size()) );
+			return true;
+		}
+
+		/**
+		 * \brief Gets a value unique to this array class.
+		 *
+		 * \return Returns the class's tag.
+		 */
+		virtual const void *						TypeTag() const {
+			static const char cTag = 0;
+			return &cTag;
+		}
+
 	protected :
 		// == Members.
 		std::vector<_tnBaseType>					m_vArray;
@@ -57,6 +57,12 @@ namespace ee {
 		_rRes.ncType = EE_NC_INVALID;
 		try {
 			EE_ERROR_CODES ecError;
+#ifdef EE_COMPILE_TO_BYTECODE
+			if ( m_psProgramState == EE_PS_UNCOMPILED ) { CompileProgram(); }
+			if ( m_psProgramState == EE_PS_COMPILED ) {
+				return RunProgram( _rRes, ecError );
+			}
+#endif	// #ifdef EE_COMPILE_TO_BYTECODE
 			if ( !ResolveNode_ExplicitStack( m_sTrans, _rRes, ecError ) ) {
 				return false;
 			}
@@ -1694,6 +1700,89 @@ namespace ee {
 		AddNode( _ndNode );
 	}
 
+	/**
+	 * \brief Creates a node that applies an operation between every element of an array and a scalar, in place.
+	 *
+	 * \param _sArrayIdx Index of the array to modify.
+	 * \param _ui32Token The parser token of the operation (\c EE_ADD, \c EE_SUB, \c EE_MUL, or \c EE_DIV).
+	 * \param _ndExp The scalar expression node data.
+	 * \param _ndNode Receives the resulting node data.
+	 */
+	void CExpEvalContainer::CreateArrayApply( size_t _sArrayIdx, uint32_t _ui32Token, const YYSTYPE::EE_NODE_DATA &_ndExp, YYSTYPE::EE_NODE_DATA &_ndNode ) {
+		_ndNode.nType = EE_N_ARRAY_APPLY;
+		_ndNode.u.sStringIndex = _sArrayIdx;
+		_ndNode.v.ui32Op = ArrayOpFromToken( _ui32Token );
+		_ndNode.w.sNodeIndex = _ndExp.sNodeIndex;
+		AddNode( _ndNode );
+	}
+
+	/**
+	 * \brief Creates a node that applies an operation between every element of an array and the matching element of another array, in place.
+	 *
+	 * \param _sArrayIdx Index of the array to modify.
+	 * \param _ui32Token The parser token of the operation (\c EE_ADD, \c EE_SUB, \c EE_MUL, or \c EE_DIV).
+	 * \param _sOtherIdx Index of the right-hand array.
+	 * \param _ndNode Receives the resulting node data.
+	 */
+	void CExpEvalContainer::CreateArrayApply( size_t _sArrayIdx, uint32_t _ui32Token, size_t _sOtherIdx, YYSTYPE::EE_NODE_DATA &_ndNode ) {
+		_ndNode.nType = EE_N_ARRAY_APPLY_ARRAY;
+		_ndNode.u.sStringIndex = _sArrayIdx;
+		_ndNode.v.ui32Op = ArrayOpFromToken( _ui32Token );
+		_ndNode.w.sNodeIndex = _sOtherIdx;
+		AddNode( _ndNode );
+	}
+
+	/**
+	 * \brief Creates an \c array.convolve( kernel, dst ) node.
+	 *
+	 * \param _sArrayIdx Index of the signal array.
+	 * \param _sKernelIdx Index of the kernel array.
+	 * \param _sDstIdx Index of the array that receives the full convolution.
+	 * \param _ndNode Receives the resulting node data.
+	 */
+	void CExpEvalContainer::CreateArrayConvolve( size_t _sArrayIdx, size_t _sKernelIdx, size_t _sDstIdx, YYSTYPE::EE_NODE_DATA &_ndNode ) {
+		_ndNode.nType = EE_N_ARRAY_CONVOLVE;
+		_ndNode.u.sStringIndex = _sArrayIdx;
+		_ndNode.v.sStringIndex = _sKernelIdx;
+		_ndNode.w.sNodeIndex = _sDstIdx;
+		AddNode( _ndNode );
+	}
+
+	/**
+	 * \brief Creates an \c array.resample( size, dst ) node.
+	 *
+	 * \param _sArrayIdx Index of the source array.
+	 * \param _ndSize The new-size expression node data.
+	 * \param _sDstIdx Index of the array that receives the resampled elements.
+	 * \param _ndNode Receives the resulting node data.
+	 */
+	void CExpEvalContainer::CreateArrayResample( size_t _sArrayIdx, const YYSTYPE::EE_NODE_DATA &_ndSize, size_t _sDstIdx, YYSTYPE::EE_NODE_DATA &_ndNode ) {
+		_ndNode.nType = EE_N_ARRAY_RESAMPLE;
+		_ndNode.u.sStringIndex = _sArrayIdx;
+		_ndNode.v.sNodeIndex = _ndSize.sNodeIndex;
+		_ndNode.w.sNodeIndex = _sDstIdx;
+		AddNode( _ndNode );
+	}
+
+	/**
+	 * \brief Creates an \c array.sum(), \c array.min(), \c array.max(), or \c array.rms() node.
+	 *
+	 * \param _sArrayIdx Index of the array.
+	 * \param _ui32Token The parser token of the reduction (\c EE_SUM, \c EE_MIN, \c EE_MAX, or \c EE_RMS).
+	 * \param _ndNode Receives the resulting node data.
+	 */
+	void CExpEvalContainer::CreateArrayReduce( size_t _sArrayIdx, uint32_t _ui32Token, YYSTYPE::EE_NODE_DATA &_ndNode ) {
+		switch ( _ui32Token ) {
+			case CExpEvalParser::token::EE_SUM : { _ndNode.nType = EE_N_ARRAY_SUM; break; }
+			case CExpEvalParser::token::EE_MIN : { _ndNode.nType = EE_N_ARRAY_MIN; break; }
+			case CExpEvalParser::token::EE_MAX : { _ndNode.nType = EE_N_ARRAY_MAX; break; }
+			case CExpEvalParser::token::EE_RMS : { _ndNode.nType = EE_N_ARRAY_RMS; break; }
+			default : { throw EE_EC_PROCESSINGERROR; }
+		}
+		_ndNode.u.sStringIndex = _sArrayIdx;
+		AddNode( _ndNode );
+	}
+
 	/**
 	 * \brief Creates a string array/slice access expression node with one index expression.
 	 *
@@ -4695,6 +4784,7 @@ namespace ee {
 		_ndNode.sNodeIndex = m_vNodes.size();
 		// Since the function returns void, try/catch here makes no sense.
 		m_vNodes.push_back( _ndNode );
+		m_psProgramState = EE_PS_UNCOMPILED;
 	}
 
 	/**
@@ -4711,6 +4801,579 @@ namespace ee {
 		return m_vStrings.size() - 1;
 	}
 
+	/**
+	 * \brief Compiles the node tree to register bytecode.
+	 *
+	 * Only pure expressions (constants, variables, parameters, address reads, unary/binary/cast operators, ?:, and
+	 *	intrinsics) are compiled.  Constant sub-expressions are folded.  If any other node is found, the program is marked
+	 *	EE_PS_UNSUPPORTED and Resolve() keeps using the tree walker.
+	 *
+	 * \return Returns true if the program was compiled.
+	 */
+	bool CExpEvalContainer::CompileProgram() {
+		m_vProgram.clear();
+		m_vRegisters.clear();
+		m_psProgramState = EE_PS_UNSUPPORTED;
+		if ( !m_vNodes.size() ) { return false; }
+		try {
+			EE_REG_INFO riRes;
+			// The tree walker starts from the last node added.
+			if ( !CompileNode( m_vNodes.size() - 1, 0, riRes ) ) {
+				m_vProgram.clear();
+				m_vRegisters.clear();
+				return false;
+			}
+			m_ui32ResultReg = riRes.ui32Reg;
+			m_psProgramState = EE_PS_COMPILED;
+			return true;
+		}
+		catch ( const std::bad_alloc & ) {
+			m_vProgram.clear();
+			m_vRegisters.clear();
+			return false;
+		}
+	}
+
+	/**
+	 * \brief Compiles a node and its children to register bytecode.
+	 *
+	 * \param _sNode Index of the node to compile.
+	 * \param _ui32Depth Current recursion depth.
+	 * \param _riReg Receives the register holding the node's value.
+	 * \return Returns true if the node could be compiled.
+	 */
+	bool CExpEvalContainer::CompileNode( size_t _sNode, uint32_t _ui32Depth, EE_REG_INFO &_riReg ) {
+		if ( _ui32Depth >= EE_MAX_BYTECODE_DEPTH || _sNode >= m_vNodes.size() ) { return false; }
+		const YYSTYPE::EE_NODE_DATA & ndExp = m_vNodes[_sNode];
+		_riReg.ncType = EE_NC_INVALID;
+		_riReg.bConst = false;
+		switch ( ndExp.nType ) {
+			case EE_N_NUMERICCONSTANT : {
+				EE_RESULT rVal;
+				rVal.ncType = ndExp.v.ncConstType;
+				rVal.u.ui64Val = ndExp.u.ui64Val;
+				AddConstRegister( rVal, _riReg );
+				return true;
+			}
+			case EE_N_CUSTOM_VAR : {
+				EE_RESULT rVal;
+				if ( IsConst( ndExp, rVal ) && IsNumber( rVal ) ) {
+					AddConstRegister( rVal, _riReg );
+					return true;
+				}
+				auto aFind = m_mCustomVariables.find( ndExp.u.sStringIndex );
+				// Let the tree walker report the error.
+				if ( aFind == m_mCustomVariables.end() ) { return false; }
+				_riReg.ui32Reg = AddRegister();
+				m_vProgram[AddInstruction( EE_BC_VAR, _riReg.ui32Reg )].prVar = &aFind->second.rRes;
+				return true;
+			}
+			case EE_N_USER_VAR : {
+				_riReg.ui32Reg = AddRegister();
+				AddInstruction( EE_BC_USER, _riReg.ui32Reg );
+				return true;
+			}
+			case EE_N_NUMBERED_PARM : {
+				_riReg.ui32Reg = AddRegister();
+				m_vProgram[AddInstruction( EE_BC_PARM, _riReg.ui32Reg )].rConst.u.ui64Val = ndExp.u.ui64Val;
+				return true;
+			}
+			case EE_N_NUMBERED_PARM_TOTAL : {
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = EE_NC_UNSIGNED;
+				AddInstruction( EE_BC_PARM_TOTAL, _riReg.ui32Reg );
+				return true;
+			}
+			case EE_N_ADDRESS : {
+				EE_REG_INFO riAddr;
+				if ( !CompileNode( ndExp.u.sNodeIndex, _ui32Depth + 1, riAddr ) ) { return false; }
+				_riReg.ui32Reg = AddRegister();
+				AddInstruction( EE_BC_ADDRESS, _riReg.ui32Reg, riAddr.ui32Reg, uint32_t( ndExp.v.ctCast ) );
+				return true;
+			}
+			case EE_N_UNARY : {
+				EE_REG_INFO riExp;
+				if ( !CompileNode( ndExp.u.sNodeIndex, _ui32Depth + 1, riExp ) ) { return false; }
+				if ( riExp.bConst ) {
+					EE_RESULT rVal;
+					if ( PerformUnary( m_vRegisters[riExp.ui32Reg], ndExp.v.ui32Op, rVal ) != EE_EC_SUCCESS ) { return false; }
+					AddConstRegister( rVal, _riReg );
+					return true;
+				}
+				_riReg.ui32Reg = AddRegister();
+				AddInstruction( EE_BC_UNARY, _riReg.ui32Reg, riExp.ui32Reg, ndExp.v.ui32Op );
+				// Result types from PerformUnary(), for operands whose type is known.
+				if ( riExp.ncType != EE_NC_INVALID ) {
+					switch ( ndExp.v.ui32Op ) {
+						case '+' : { _riReg.ncType = riExp.ncType; break; }
+						case '-' : { _riReg.ncType = riExp.ncType == EE_NC_UNSIGNED ? EE_NC_SIGNED : riExp.ncType; break; }
+						case '~' : { _riReg.ncType = riExp.ncType == EE_NC_FLOATING ? EE_NC_INVALID : riExp.ncType; break; }
+						case '!' : { _riReg.ncType = riExp.ncType == EE_NC_FLOATING ? EE_NC_UNSIGNED : riExp.ncType; break; }
+						default : {}
+					}
+				}
+				return true;
+			}
+			case EE_N_CAST : {
+				switch ( ndExp.v.ctCast ) {
+					case EE_CT_INT8 : {}
+					case EE_CT_INT16 : {}
+					case EE_CT_INT32 : {}
+					case EE_CT_INT64 : {}
+					case EE_CT_UINT8 : {}
+					case EE_CT_UINT16 : {}
+					case EE_CT_UINT32 : {}
+					case EE_CT_UINT64 : {}
+					case EE_CT_FLOAT : {}
+					case EE_CT_DOUBLE : { break; }
+					default : { return false; }
+				}
+				EE_REG_INFO riExp;
+				if ( !CompileNode( ndExp.u.sNodeIndex, _ui32Depth + 1, riExp ) ) { return false; }
+				EE_RESULT rVal;
+				if ( riExp.bConst ) {
+					if ( PerformCast( m_vRegisters[riExp.ui32Reg], ndExp.v.ctCast, rVal ) != EE_EC_SUCCESS ) { return false; }
+					AddConstRegister( rVal, _riReg );
+					return true;
+				}
+				// Get the resulting type by casting a dummy value.
+				PerformCast( DefaultResult(), ndExp.v.ctCast, rVal );
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = rVal.ncType;
+				AddInstruction( EE_BC_CAST, _riReg.ui32Reg, riExp.ui32Reg, uint32_t( ndExp.v.ctCast ) );
+				return true;
+			}
+			case EE_N_OP : {
+				const uint32_t uiOp = ndExp.v.ui32Op;
+				EE_REG_INFO riLeft, riRight;
+				if ( !CompileNode( ndExp.u.sNodeIndex, _ui32Depth + 1, riLeft ) ) { return false; }
+				if ( uiOp == CExpEvalParser::token::EE_AND || uiOp == CExpEvalParser::token::EE_OR ) {
+					const bool bAnd = uiOp == CExpEvalParser::token::EE_AND;
+					if ( riLeft.bConst ) {
+						const EE_RESULT & rLeft = m_vRegisters[riLeft.ui32Reg];
+						if ( IsNumber( rLeft ) && IsTrue( rLeft ) != bAnd ) {
+							// Short-circuited at compile time.
+							EE_RESULT rVal;
+							rVal.ncType = EE_NC_UNSIGNED;
+							rVal.u.ui64Val = !bAnd;
+							AddConstRegister( rVal, _riReg );
+							return true;
+						}
+						if ( !CompileNode( ndExp.w.sNodeIndex, _ui32Depth + 1, riRight ) ) { return false; }
+						if ( riRight.bConst ) {
+							EE_RESULT rVal;
+							if ( PerformOp_S( m_vRegisters[riLeft.ui32Reg], uiOp, m_vRegisters[riRight.ui32Reg], rVal ) != EE_EC_SUCCESS ) { return false; }
+							AddConstRegister( rVal, _riReg );
+							return true;
+						}
+						_riReg.ui32Reg = AddRegister();
+						_riReg.ncType = EmitOp( uiOp, riLeft, riRight, _riReg.ui32Reg );
+						return true;
+					}
+					_riReg.ui32Reg = AddRegister();
+					size_t sSkip = AddInstruction( bAnd ? EE_BC_AND_SKIP : EE_BC_OR_SKIP, _riReg.ui32Reg, riLeft.ui32Reg );
+					if ( !CompileNode( ndExp.w.sNodeIndex, _ui32Depth + 1, riRight ) ) { return false; }
+					EE_NUM_CONSTANTS ncType = EmitOp( uiOp, riLeft, riRight, _riReg.ui32Reg );
+					m_vProgram[sSkip].ui32Param = uint32_t( m_vProgram.size() );
+					// The short-circuit path produces EE_NC_UNSIGNED.
+					_riReg.ncType = ncType == EE_NC_UNSIGNED ? EE_NC_UNSIGNED : EE_NC_INVALID;
+					return true;
+				}
+				if ( !CompileNode( ndExp.w.sNodeIndex, _ui32Depth + 1, riRight ) ) { return false; }
+				if ( riLeft.bConst && riRight.bConst ) {
+					EE_RESULT rVal;
+					if ( PerformOp_S( m_vRegisters[riLeft.ui32Reg], uiOp, m_vRegisters[riRight.ui32Reg], rVal ) != EE_EC_SUCCESS ) { return false; }
+					AddConstRegister( rVal, _riReg );
+					return true;
+				}
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = EmitOp( uiOp, riLeft, riRight, _riReg.ui32Reg );
+				return true;
+			}
+			case EE_N_CONDITIONAL : {
+				EE_REG_INFO riCond, riTrue, riFalse;
+				if ( !CompileNode( ndExp.u.sNodeIndex, _ui32Depth + 1, riCond ) ) { return false; }
+				if ( riCond.bConst ) {
+					const EE_RESULT & rCond = m_vRegisters[riCond.ui32Reg];
+					if ( !IsNumber( rCond ) ) { return false; }
+					return CompileNode( IsTrue( rCond ) ? ndExp.v.sNodeIndex : ndExp.w.sNodeIndex, _ui32Depth + 1, _riReg );
+				}
+				size_t sJumpFalse = AddInstruction( EE_BC_JUMP_IF_FALSE, 0, riCond.ui32Reg );
+				if ( !CompileNode( ndExp.v.sNodeIndex, _ui32Depth + 1, riTrue ) ) { return false; }
+				_riReg.ui32Reg = AddRegister();
+				AddInstruction( EE_BC_MOVE, _riReg.ui32Reg, riTrue.ui32Reg );
+				size_t sJumpEnd = AddInstruction( EE_BC_JUMP, 0 );
+				m_vProgram[sJumpFalse].ui32Param = uint32_t( m_vProgram.size() );
+				if ( !CompileNode( ndExp.w.sNodeIndex, _ui32Depth + 1, riFalse ) ) { return false; }
+				AddInstruction( EE_BC_MOVE, _riReg.ui32Reg, riFalse.ui32Reg );
+				m_vProgram[sJumpEnd].ui32Param = uint32_t( m_vProgram.size() );
+				_riReg.ncType = riTrue.ncType == riFalse.ncType ? riTrue.ncType : EE_NC_INVALID;
+				return true;
+			}
+			case EE_N_INTRINSIC_0_SIGNED : {
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = EE_NC_SIGNED;
+				m_vProgram[AddInstruction( EE_BC_CLOCK, _riReg.ui32Reg )].uFuncPtr = ndExp.uFuncPtr;
+				return true;
+			}
+			case EE_N_INTRINSIC_0_UNSIGNED_DIVISOR : {
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = EE_NC_UNSIGNED;
+				EE_INSTRUCTION & iIns = m_vProgram[AddInstruction( EE_BC_INTRINSIC_0_DIV, _riReg.ui32Reg )];
+				iIns.uFuncPtr = ndExp.uFuncPtr;
+				iIns.rConst.u.ui64Val = ndExp.u.ui64Val;
+				return true;
+			}
+			case EE_N_INTRINSIC_1 : {}
+			case EE_N_INTRINSIC_1_FLOAT_FLOAT : {
+				EE_REG_INFO riExp;
+				if ( !CompileNode( ndExp.v.sNodeIndex, _ui32Depth + 1, riExp ) ) { return false; }
+				const bool bFloat = ndExp.nType == EE_N_INTRINSIC_1_FLOAT_FLOAT;
+				if ( riExp.bConst ) {
+					// Same folding the parser does with constant parameters.
+					EE_RESULT rVal;
+					if ( bFloat ) {
+						rVal = ConvertResult( m_vRegisters[riExp.ui32Reg], EE_NC_FLOATING );
+						if ( rVal.ncType == EE_NC_INVALID ) { return false; }
+						rVal.u.dVal = ndExp.uFuncPtr.pfIntrins1Float_Float( rVal.u.dVal );
+					}
+					else if ( PerformIntrinsic( m_vRegisters[riExp.ui32Reg], ndExp.u.ui32Intrinsic, rVal ) != EE_EC_SUCCESS ) { return false; }
+					AddConstRegister( rVal, _riReg );
+					return true;
+				}
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = bFloat ? EE_NC_FLOATING : EE_NC_INVALID;
+				EE_INSTRUCTION & iIns = m_vProgram[AddInstruction( bFloat ? EE_BC_F_F : EE_BC_INTRINSIC_1, _riReg.ui32Reg, riExp.ui32Reg, ndExp.u.ui32Intrinsic )];
+				iIns.uFuncPtr = ndExp.uFuncPtr;
+				return true;
+			}
+			case EE_N_INTRINSIC_2 : {}
+			case EE_N_INTRINSIC_2_FLOAT_FLOAT_FLOAT : {
+				EE_REG_INFO riExp0, riExp1;
+				if ( !CompileNode( ndExp.v.sNodeIndex, _ui32Depth + 1, riExp0 ) ) { return false; }
+				if ( !CompileNode( ndExp.w.sNodeIndex, _ui32Depth + 1, riExp1 ) ) { return false; }
+				const bool bFloat = ndExp.nType == EE_N_INTRINSIC_2_FLOAT_FLOAT_FLOAT;
+				if ( riExp0.bConst && riExp1.bConst ) {
+					EE_RESULT rVal;
+					if ( bFloat ) {
+						EE_RESULT rVal0 = ConvertResult( m_vRegisters[riExp0.ui32Reg], EE_NC_FLOATING );
+						EE_RESULT rVal1 = ConvertResult( m_vRegisters[riExp1.ui32Reg], EE_NC_FLOATING );
+						if ( rVal0.ncType == EE_NC_INVALID || rVal1.ncType == EE_NC_INVALID ) { return false; }
+						rVal.ncType = EE_NC_FLOATING;
+						rVal.u.dVal = ndExp.uFuncPtr.pfIntrins2Float_Float_Float( rVal0.u.dVal, rVal1.u.dVal );
+						AddConstRegister( rVal, _riReg );
+						return true;
+					}
+					// Non-constant intrinsics (rand()) are excluded, as in the parser.
+					if ( PerformIntrinsic( m_vRegisters[riExp0.ui32Reg], m_vRegisters[riExp1.ui32Reg], ndExp.u.ui32Intrinsic, rVal, false ) == EE_EC_SUCCESS ) {
+						AddConstRegister( rVal, _riReg );
+						return true;
+					}
+				}
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = bFloat ? EE_NC_FLOATING : EE_NC_INVALID;
+				EE_INSTRUCTION & iIns = m_vProgram[AddInstruction( bFloat ? EE_BC_F_FF : EE_BC_INTRINSIC_2, _riReg.ui32Reg, riExp0.ui32Reg, ndExp.u.ui32Intrinsic )];
+				iIns.ui32B = riExp1.ui32Reg;
+				iIns.uFuncPtr = ndExp.uFuncPtr;
+				return true;
+			}
+			case EE_N_INTRINSIC_3 : {}
+			case EE_N_INTRINSIC_3_FLOAT_FLOAT_FLOAT_FLOAT : {
+				EE_REG_INFO riExp0, riExp1, riExp2;
+				if ( !CompileNode( ndExp.v.sNodeIndex, _ui32Depth + 1, riExp0 ) ) { return false; }
+				if ( !CompileNode( ndExp.w.sNodeIndex, _ui32Depth + 1, riExp1 ) ) { return false; }
+				if ( !CompileNode( ndExp.x.sNodeIndex, _ui32Depth + 1, riExp2 ) ) { return false; }
+				const bool bFloat = ndExp.nType == EE_N_INTRINSIC_3_FLOAT_FLOAT_FLOAT_FLOAT;
+				if ( riExp0.bConst && riExp1.bConst && riExp2.bConst ) {
+					EE_RESULT rVal;
+					if ( bFloat ) {
+						EE_RESULT rVal0 = ConvertResult( m_vRegisters[riExp0.ui32Reg], EE_NC_FLOATING );
+						EE_RESULT rVal1 = ConvertResult( m_vRegisters[riExp1.ui32Reg], EE_NC_FLOATING );
+						EE_RESULT rVal2 = ConvertResult( m_vRegisters[riExp2.ui32Reg], EE_NC_FLOATING );
+						if ( rVal0.ncType == EE_NC_INVALID || rVal1.ncType == EE_NC_INVALID || rVal2.ncType == EE_NC_INVALID ) { return false; }
+						rVal.ncType = EE_NC_FLOATING;
+						rVal.u.dVal = ndExp.uFuncPtr.pfIntrins3Float_Float_Float_Float( rVal0.u.dVal, rVal1.u.dVal, rVal2.u.dVal );
+						AddConstRegister( rVal, _riReg );
+						return true;
+					}
+					if ( PerformIntrinsic( m_vRegisters[riExp0.ui32Reg], m_vRegisters[riExp1.ui32Reg], m_vRegisters[riExp2.ui32Reg], ndExp.u.ui32Intrinsic, rVal ) == EE_EC_SUCCESS ) {
+						AddConstRegister( rVal, _riReg );
+						return true;
+					}
+				}
+				_riReg.ui32Reg = AddRegister();
+				_riReg.ncType = bFloat ? EE_NC_FLOATING : EE_NC_INVALID;
+				EE_INSTRUCTION & iIns = m_vProgram[AddInstruction( bFloat ? EE_BC_F_FFF : EE_BC_INTRINSIC_3, _riReg.ui32Reg, riExp0.ui32Reg, ndExp.u.ui32Intrinsic )];
+				iIns.ui32B = riExp1.ui32Reg;
+				iIns.ui32C = riExp2.ui32Reg;
+				iIns.uFuncPtr = ndExp.uFuncPtr;
+				return true;
+			}
+			default : {}
+		}
+		return false;
+	}
+
+	/**
+	 * \brief Emits a binary operation, choosing a typed operation when both operand types are known.
+	 *
+	 * \param _uiOp The operator.
+	 * \param _riLeft The left operand.
+	 * \param _riRight The right operand.
+	 * \param _ui32Dst The destination register.
+	 * \return Returns the type of the result, or EE_NC_INVALID if it is only known at run-time.
+	 */
+	EE_NUM_CONSTANTS CExpEvalContainer::EmitOp( uint32_t _uiOp, const EE_REG_INFO &_riLeft, const EE_REG_INFO &_riRight, uint32_t _ui32Dst ) {
+		EE_BYTECODE_OPS bcOp = EE_BC_OP;
+		EE_NUM_CONSTANTS ncType = EE_NC_INVALID;
+		if ( _riLeft.ncType != EE_NC_INVALID && _riRight.ncType != EE_NC_INVALID ) {
+			ncType = IsBoolOp( _uiOp ) ? EE_NC_UNSIGNED : GetCastType( _riLeft.ncType, _riRight.ncType );
+			if ( _riLeft.ncType == _riRight.ncType ) {
+				switch ( _riLeft.ncType ) {
+					case EE_NC_SIGNED : { bcOp = EE_BC_OP_I64; break; }
+					case EE_NC_UNSIGNED : { bcOp = EE_BC_OP_U64; break; }
+					case EE_NC_FLOATING : { bcOp = EE_BC_OP_F64; break; }
+					default : {}
+				}
+			}
+		}
+		m_vProgram[AddInstruction( bcOp, _ui32Dst, _riLeft.ui32Reg, _uiOp )].ui32B = _riRight.ui32Reg;
+		return ncType;
+	}
+
+	/**
+	 * \brief Runs the compiled bytecode.
+	 *
+	 * \param _rFinalResult Receives the resolved value.
+	 * \param _ecError Receives a specific error code when evaluation fails.
+	 * \return Returns true if evaluation succeeded; false otherwise.
+	 */
+	bool CExpEvalContainer::RunProgram( EE_RESULT &_rFinalResult, EE_ERROR_CODES &_ecError ) {
+		// Remove run-time-allocated objects.
+		while ( m_vsCompileTimeObjects != m_vObjects.size() ) {
+			delete m_vObjects[m_vObjects.size()-1];
+			m_vObjects.pop_back();
+		}
+
+#define EE_BC_ERROR( IDX )							_ecError = IDX; return false
+#define EE_BC_CHECK( EXP )							{ EE_ERROR_CODES ecRet = EXP; if ( ecRet != EE_EC_SUCCESS ) { EE_BC_ERROR( ecRet ); } }
+		EE_RESULT * prRegs = m_vRegisters.data();
+		const EE_INSTRUCTION * piProgram = m_vProgram.data();
+		const size_t sTotal = m_vProgram.size();
+		size_t sPc = 0;
+		while ( sPc < sTotal ) {
+			const EE_INSTRUCTION & iThis = piProgram[sPc++];
+			EE_RESULT & rDst = prRegs[iThis.ui32Dst];
+			switch ( iThis.bcOp ) {
+				case EE_BC_VAR : {
+					rDst = (*iThis.prVar);
+					if ( rDst.ncType == EE_NC_INVALID ) { EE_BC_ERROR( EE_EC_VARHASBADTYPE ); }
+					break;
+				}
+				case EE_BC_USER : {
+					if ( !m_pfUser ) { EE_BC_ERROR( EE_EC_NOUSERHANDLER ); }
+					if ( !m_pfUser( m_uiptrUserData, this, rDst ) ) { EE_BC_ERROR( EE_EC_USERHANDLERFAILED ); }
+					break;
+				}
+				case EE_BC_PARM : {
+					rDst = GetNumberedParm( static_cast<size_t>(iThis.rConst.u.ui64Val) );
+					break;
+				}
+				case EE_BC_PARM_TOTAL : {
+					rDst.ncType = EE_NC_UNSIGNED;
+					rDst.u.ui64Val = m_vNumberedParms.size();
+					break;
+				}
+				case EE_BC_ADDRESS : {
+					if ( !m_pfahAddressHandler ) { EE_BC_ERROR( EE_EC_NOADDRESSHANDLER ); }
+					EE_RESULT rAddr = ConvertResultOrObject( prRegs[iThis.ui32A], EE_NC_UNSIGNED );
+					if ( rAddr.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					if ( !m_pfahAddressHandler( rAddr.u.ui64Val, static_cast<EE_CAST_TYPES>(iThis.ui32Param), m_uiptrAddressData, this, rDst ) ) { EE_BC_ERROR( EE_EC_ADDRESSHANDLERFAILED ); }
+					break;
+				}
+				case EE_BC_UNARY : {
+					EE_BC_CHECK( PerformUnary( prRegs[iThis.ui32A], iThis.ui32Param, rDst ) );
+					break;
+				}
+				case EE_BC_CAST : {
+					EE_BC_CHECK( PerformCast( prRegs[iThis.ui32A], static_cast<EE_CAST_TYPES>(iThis.ui32Param), rDst ) );
+					break;
+				}
+				case EE_BC_OP : {
+					const EE_RESULT & rLeft = prRegs[iThis.ui32A];
+					const EE_RESULT & rRight = prRegs[iThis.ui32B];
+					// Types only known at run-time still take the typed path when they match.
+					if ( rLeft.ncType == rRight.ncType ) {
+						switch ( rLeft.ncType ) {
+							case EE_NC_SIGNED : {
+								EE_BC_CHECK( PerformIntOp<int64_t>( rLeft.u.i64Val, iThis.ui32Param, rRight.u.i64Val, EE_NC_SIGNED, rDst ) );
+								continue;
+							}
+							case EE_NC_UNSIGNED : {
+								EE_BC_CHECK( PerformIntOp<uint64_t>( rLeft.u.ui64Val, iThis.ui32Param, rRight.u.ui64Val, EE_NC_UNSIGNED, rDst ) );
+								continue;
+							}
+							case EE_NC_FLOATING : {
+								EE_BC_CHECK( PerformFloatOp( rLeft.u.dVal, iThis.ui32Param, rRight.u.dVal, rDst ) );
+								continue;
+							}
+							default : {}
+						}
+					}
+					EE_BC_CHECK( PerformOp( rLeft, iThis.ui32Param, rRight, rDst ) );
+					break;
+				}
+				case EE_BC_OP_I64 : {
+					EE_BC_CHECK( PerformIntOp<int64_t>( prRegs[iThis.ui32A].u.i64Val, iThis.ui32Param, prRegs[iThis.ui32B].u.i64Val, EE_NC_SIGNED, rDst ) );
+					break;
+				}
+				case EE_BC_OP_U64 : {
+					EE_BC_CHECK( PerformIntOp<uint64_t>( prRegs[iThis.ui32A].u.ui64Val, iThis.ui32Param, prRegs[iThis.ui32B].u.ui64Val, EE_NC_UNSIGNED, rDst ) );
+					break;
+				}
+				case EE_BC_OP_F64 : {
+					EE_BC_CHECK( PerformFloatOp( prRegs[iThis.ui32A].u.dVal, iThis.ui32Param, prRegs[iThis.ui32B].u.dVal, rDst ) );
+					break;
+				}
+				case EE_BC_AND_SKIP : {
+					const EE_RESULT & rLeft = prRegs[iThis.ui32A];
+					if ( IsNumber( rLeft ) && !IsTrue( rLeft ) ) {
+						rDst.ncType = EE_NC_UNSIGNED;
+						rDst.u.ui64Val = false;
+						sPc = iThis.ui32Param;
+					}
+					break;
+				}
+				case EE_BC_OR_SKIP : {
+					const EE_RESULT & rLeft = prRegs[iThis.ui32A];
+					if ( IsNumber( rLeft ) && IsTrue( rLeft ) ) {
+						rDst.ncType = EE_NC_UNSIGNED;
+						rDst.u.ui64Val = true;
+						sPc = iThis.ui32Param;
+					}
+					break;
+				}
+				case EE_BC_JUMP_IF_FALSE : {
+					const EE_RESULT & rExp = prRegs[iThis.ui32A];
+					if ( !IsNumber( rExp ) ) { EE_BC_ERROR( EE_EC_INVALIDTREE ); }
+					if ( !IsTrue( rExp ) ) { sPc = iThis.ui32Param; }
+					break;
+				}
+				case EE_BC_JUMP : {
+					sPc = iThis.ui32Param;
+					break;
+				}
+				case EE_BC_MOVE : {
+					rDst = prRegs[iThis.ui32A];
+					break;
+				}
+				case EE_BC_CLOCK : {
+					rDst.ncType = EE_NC_SIGNED;
+					rDst.u.i64Val = iThis.uFuncPtr.pfClock();
+					break;
+				}
+				case EE_BC_INTRINSIC_0_DIV : {
+					rDst.ncType = EE_NC_UNSIGNED;
+					rDst.u.ui64Val = iThis.uFuncPtr.pfIntrins0Unsigned( ee::CExpEval::Time() ) / iThis.rConst.u.ui64Val;
+					break;
+				}
+				case EE_BC_INTRINSIC_1 : {
+					EE_BC_CHECK( PerformIntrinsic( prRegs[iThis.ui32A], iThis.ui32Param, rDst ) );
+					break;
+				}
+				case EE_BC_INTRINSIC_2 : {
+					EE_BC_CHECK( PerformIntrinsic( prRegs[iThis.ui32A], prRegs[iThis.ui32B], iThis.ui32Param, rDst, true ) );
+					break;
+				}
+				case EE_BC_INTRINSIC_3 : {
+					EE_BC_CHECK( PerformIntrinsic( prRegs[iThis.ui32A], prRegs[iThis.ui32B], prRegs[iThis.ui32C], iThis.ui32Param, rDst ) );
+					break;
+				}
+				case EE_BC_F_F : {
+					const EE_RESULT & rExp = prRegs[iThis.ui32A];
+					if ( rExp.ncType == EE_NC_FLOATING ) {
+						rDst.ncType = EE_NC_FLOATING;
+						rDst.u.dVal = iThis.uFuncPtr.pfIntrins1Float_Float( rExp.u.dVal );
+						break;
+					}
+					if ( rExp.ncType == EE_NC_OBJECT && rExp.u.poObj && (rExp.u.poObj->Type() & CObject::EE_BIT_VECTOR) ) {
+						ee::CVector * pvThis = static_cast<ee::CVector *>(rExp.u.poObj);
+						for ( auto I = pvThis->GetBacking().size(); I--; ) {
+							EE_RESULT rNode = ConvertResultOrObject( pvThis->GetBacking()[I], EE_NC_FLOATING );
+							if ( rNode.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+							pvThis->GetBacking()[I].ncType = EE_NC_FLOATING;
+							pvThis->GetBacking()[I].u.dVal = iThis.uFuncPtr.pfIntrins1Float_Float( rNode.u.dVal );
+						}
+						rDst = pvThis->CreateResult();
+						break;
+					}
+					EE_RESULT rNode = ConvertResultOrObject( rExp, EE_NC_FLOATING );
+					if ( rNode.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					rDst.ncType = EE_NC_FLOATING;
+					rDst.u.dVal = iThis.uFuncPtr.pfIntrins1Float_Float( rNode.u.dVal );
+					break;
+				}
+				case EE_BC_F_FF : {
+					EE_RESULT rNode0 = ConvertResultOrObject( prRegs[iThis.ui32A], EE_NC_FLOATING );
+					if ( rNode0.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					EE_RESULT rNode1 = ConvertResultOrObject( prRegs[iThis.ui32B], EE_NC_FLOATING );
+					if ( rNode1.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					rDst.ncType = EE_NC_FLOATING;
+					rDst.u.dVal = iThis.uFuncPtr.pfIntrins2Float_Float_Float( rNode0.u.dVal, rNode1.u.dVal );
+					break;
+				}
+				case EE_BC_F_FFF : {
+					EE_RESULT rNode0 = ConvertResultOrObject( prRegs[iThis.ui32A], EE_NC_FLOATING );
+					if ( rNode0.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					EE_RESULT rNode1 = ConvertResultOrObject( prRegs[iThis.ui32B], EE_NC_FLOATING );
+					if ( rNode1.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					EE_RESULT rNode2 = ConvertResultOrObject( prRegs[iThis.ui32C], EE_NC_FLOATING );
+					if ( rNode2.ncType == EE_NC_INVALID ) { rDst.ncType = EE_NC_INVALID; EE_BC_ERROR( EE_EC_INVALIDCAST ); }
+					rDst.ncType = EE_NC_FLOATING;
+					rDst.u.dVal = iThis.uFuncPtr.pfIntrins3Float_Float_Float_Float( rNode0.u.dVal, rNode1.u.dVal, rNode2.u.dVal );
+					break;
+				}
+				default : { EE_BC_ERROR( EE_EC_INVALIDTREE ); }
+			}
+		}
+#undef EE_BC_CHECK
+#undef EE_BC_ERROR
+
+		_rFinalResult = prRegs[m_ui32ResultReg];
+		return true;
+	}
+
+	/**
+	 * \brief Casts a result to one of the basic cast types (EE_CT_INT8 through EE_CT_DOUBLE).
+	 *
+	 * \param _rExp The value to cast.
+	 * \param _ctCast The type to which to cast.
+	 * \param _rResult Receives the cast value.
+	 * \return Returns an \c EE_ERROR_CODES value describing success or failure.
+	 */
+	CExpEvalContainer::EE_ERROR_CODES CExpEvalContainer::PerformCast( const EE_RESULT &_rExp, EE_CAST_TYPES _ctCast, EE_RESULT &_rResult ) {
+		switch ( _ctCast ) {
+#define EE_CAST( TYPE, CASTTYPE, MEMBER )																									\
+	_rResult.ncType = TYPE;																													\
+	_rResult.u.MEMBER = static_cast<CASTTYPE>(ConvertResultOrObject( _rExp, TYPE ).u.MEMBER);												\
+	return EE_EC_SUCCESS;
+			case EE_CT_INT8 : { EE_CAST( EE_NC_SIGNED, int8_t, i64Val ) }
+			case EE_CT_INT16 : { EE_CAST( EE_NC_SIGNED, int16_t, i64Val ) }
+			case EE_CT_INT32 : { EE_CAST( EE_NC_SIGNED, int32_t, i64Val ) }
+			case EE_CT_INT64 : { EE_CAST( EE_NC_SIGNED, int64_t, i64Val ) }
+			case EE_CT_UINT8 : { EE_CAST( EE_NC_UNSIGNED, uint8_t, ui64Val ) }
+			case EE_CT_UINT16 : { EE_CAST( EE_NC_UNSIGNED, uint16_t, ui64Val ) }
+			case EE_CT_UINT32 : { EE_CAST( EE_NC_UNSIGNED, uint32_t, ui64Val ) }
+			case EE_CT_UINT64 : { EE_CAST( EE_NC_UNSIGNED, uint64_t, ui64Val ) }
+			case EE_CT_FLOAT : { EE_CAST( EE_NC_FLOATING, float, dVal ) }
+			case EE_CT_DOUBLE : { EE_CAST( EE_NC_FLOATING, double, dVal ) }
+#undef EE_CAST
+			default : {}
+		}
+		_rResult.ncType = EE_NC_INVALID;
+		return EE_EC_INVALIDTREE;
+	}
+
 	/**
 	 * \brief Resolves (evaluates) a node using an explicit evaluation stack.
 	 *
@@ -5597,6 +6260,14 @@ namespace ee {
 						EE_PUSH( _ndExp.w.sNodeIndex );		// soProcessMe.sSubResults[2] = INCLUDE_EMPTY.
 						continue;
 					}
+					case EE_N_ARRAY_APPLY : {
+						EE_PUSH( _ndExp.w.sNodeIndex );		// soProcessMe.sSubResults[0] = VAL.
+						continue;
+					}
+					case EE_N_ARRAY_RESAMPLE : {
+						EE_PUSH( _ndExp.v.sNodeIndex );		// soProcessMe.sSubResults[0] = SIZE.
+						continue;
+					}
 
 					case EE_N_BARTHANN : {}					EE_FALLTHROUGH
 					case EE_N_BARTLETT : {}					EE_FALLTHROUGH
@@ -7576,6 +8247,72 @@ namespace ee {
 						else { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_INVALID_OBJECT ); }
 						break;
 					}
+					case EE_N_ARRAY_APPLY : {
+						CArrayBase * pabThis = m_vArrayData[_ndExp.u.sStringIndex].m_pabBase;
+						if ( !pabThis ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						EE_RESULT rVal = ConvertResultOrObject( soProcessMe.sSubResults[0], EE_NC_FLOATING );
+						if ( rVal.ncType == EE_NC_INVALID ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_INVALIDCAST ); }
+						if ( !pabThis->ApplyScalar( static_cast<EE_ARRAY_OP>(_ndExp.v.ui32Op), rVal.u.dVal ) ) {
+							(*soProcessMe.prResult).ncType = EE_NC_INVALID;
+							EE_ERROR( _ndExp.v.ui32Op == EE_AO_DIV ? EE_EC_OPMUSTNOTBEZERO : EE_EC_PROCESSINGERROR );
+						}
+						(*soProcessMe.prResult).ncType = EE_NC_UNSIGNED;
+						(*soProcessMe.prResult).u.ui64Val = pabThis->GetSize();
+						break;
+					}
+					case EE_N_ARRAY_APPLY_ARRAY : {
+						CArrayBase * pabThis = m_vArrayData[_ndExp.u.sStringIndex].m_pabBase;
+						CArrayBase * pabOther = m_vArrayData[_ndExp.w.sNodeIndex].m_pabBase;
+						if ( !pabThis || !pabOther ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						if ( pabThis->GetSize() != pabOther->GetSize() ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_BADARRAYIDX ); }
+						if ( !pabThis->Apply( static_cast<EE_ARRAY_OP>(_ndExp.v.ui32Op), (*pabOther) ) ) {
+							(*soProcessMe.prResult).ncType = EE_NC_INVALID;
+							EE_ERROR( _ndExp.v.ui32Op == EE_AO_DIV ? EE_EC_OPMUSTNOTBEZERO : EE_EC_PROCESSINGERROR );
+						}
+						(*soProcessMe.prResult).ncType = EE_NC_UNSIGNED;
+						(*soProcessMe.prResult).u.ui64Val = pabThis->GetSize();
+						break;
+					}
+					case EE_N_ARRAY_CONVOLVE : {
+						CArrayBase * pabThis = m_vArrayData[_ndExp.u.sStringIndex].m_pabBase;
+						CArrayBase * pabKernel = m_vArrayData[_ndExp.v.sStringIndex].m_pabBase;
+						CArrayBase * pabDst = m_vArrayData[_ndExp.w.sNodeIndex].m_pabBase;
+						if ( !pabThis || !pabKernel || !pabDst ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						if ( !pabThis->Convolve( (*pabKernel), (*pabDst) ) ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						(*soProcessMe.prResult).ncType = EE_NC_UNSIGNED;
+						(*soProcessMe.prResult).u.ui64Val = pabDst->GetSize();
+						break;
+					}
+					case EE_N_ARRAY_RESAMPLE : {
+						CArrayBase * pabThis = m_vArrayData[_ndExp.u.sStringIndex].m_pabBase;
+						CArrayBase * pabDst = m_vArrayData[_ndExp.w.sNodeIndex].m_pabBase;
+						if ( !pabThis || !pabDst ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						EE_RESULT rSize = ConvertResultOrObject( soProcessMe.sSubResults[0], EE_NC_UNSIGNED );
+						if ( rSize.ncType == EE_NC_INVALID ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_INVALIDCAST ); }
+						if ( !pabThis->Resample( static_cast<size_t>(rSize.u.ui64Val), (*pabDst) ) ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						(*soProcessMe.prResult).ncType = EE_NC_UNSIGNED;
+						(*soProcessMe.prResult).u.ui64Val = pabDst->GetSize();
+						break;
+					}
+					case EE_N_ARRAY_SUM : {}				EE_FALLTHROUGH
+					case EE_N_ARRAY_MIN : {}				EE_FALLTHROUGH
+					case EE_N_ARRAY_MAX : {}				EE_FALLTHROUGH
+					case EE_N_ARRAY_RMS : {
+						CArrayBase * pabThis = m_vArrayData[_ndExp.u.sStringIndex].m_pabBase;
+						if ( !pabThis ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						double dRet = 0.0;
+						bool bRet = false;
+						switch ( _ndExp.nType ) {
+							case EE_N_ARRAY_SUM : { bRet = pabThis->Sum( dRet ); break; }
+							case EE_N_ARRAY_MIN : { bRet = pabThis->Min( dRet ); break; }
+							case EE_N_ARRAY_MAX : { bRet = pabThis->Max( dRet ); break; }
+							default : { bRet = pabThis->Rms( dRet ); }
+						}
+						if ( !bRet ) { (*soProcessMe.prResult).ncType = EE_NC_INVALID; EE_ERROR( EE_EC_PROCESSINGERROR ); }
+						(*soProcessMe.prResult).ncType = EE_NC_FLOATING;
+						(*soProcessMe.prResult).u.dVal = dRet;
+						break;
+					}
 #define EE_WINDOW_FUNC( CASE, FUNC )																																						\
 	case CASE : {																																											\
 		auto aRet = ConvertResultOrObject( soProcessMe.sSubResults[0], EE_NC_UNSIGNED );																									\
@@ -8750,6 +9487,22 @@ namespace ee {
 		return nullptr;
 	}
 
+	/**
+	 * \brief Converts the parser token of a bulk array operation to its \c EE_ARRAY_OP value.
+	 *
+	 * \param _ui32Token The parser token (\c EE_ADD, \c EE_SUB, \c EE_MUL, or \c EE_DIV).
+	 * \return Returns the \c EE_ARRAY_OP value.  Throws \c EE_EC_PROCESSINGERROR for any other token.
+	 */
+	uint32_t CExpEvalContainer::ArrayOpFromToken( uint32_t _ui32Token ) {
+		switch ( _ui32Token ) {
+			case CExpEvalParser::token::EE_ADD : { return EE_AO_ADD; }
+			case CExpEvalParser::token::EE_SUB : { return EE_AO_SUB; }
+			case CExpEvalParser::token::EE_MUL : { return EE_AO_MUL; }
+			case CExpEvalParser::token::EE_DIV : { return EE_AO_DIV; }
+		}
+		throw EE_EC_PROCESSINGERROR;
+	}
+
 	/**
 	 * \brief Creates a string reference object from a string-table index.
 	 *
@@ -13,6 +13,8 @@
 
 #define EE_MAX_SUB_EXPRESSIONS				7
 #define EE_OPTIMIZE_FOR_RUNTIME
+#define EE_COMPILE_TO_BYTECODE										// Pure expressions are compiled to register bytecode on the first Resolve().
+#define EE_MAX_BYTECODE_DEPTH				256						// Deeper expressions are left to the explicit-stack tree walker.
 
 namespace ee {
 
@@ -935,6 +937,55 @@ namespace ee {
 		 */
 		void								CreateArrayVar( size_t _sStrIndex, const YYSTYPE::EE_NODE_DATA &_ndExp, YYSTYPE::EE_NODE_DATA &_ndNode );
 
+		/**
+		 * \brief Creates a node that applies an operation between every element of an array and a scalar, in place.
+		 *
+		 * \param _sArrayIdx Index of the array to modify.
+		 * \param _ui32Token The parser token of the operation (\c EE_ADD, \c EE_SUB, \c EE_MUL, or \c EE_DIV).
+		 * \param _ndExp The scalar expression node data.
+		 * \param _ndNode Receives the resulting node data.
+		 */
+		void								CreateArrayApply( size_t _sArrayIdx, uint32_t _ui32Token, const YYSTYPE::EE_NODE_DATA &_ndExp, YYSTYPE::EE_NODE_DATA &_ndNode );
+
+		/**
+		 * \brief Creates a node that applies an operation between every element of an array and the matching element of another array, in place.
+		 *
+		 * \param _sArrayIdx Index of the array to modify.
+		 * \param _ui32Token The parser token of the operation (\c EE_ADD, \c EE_SUB, \c EE_MUL, or \c EE_DIV).
+		 * \param _sOtherIdx Index of the right-hand array.
+		 * \param _ndNode Receives the resulting node data.
+		 */
+		void								CreateArrayApply( size_t _sArrayIdx, uint32_t _ui32Token, size_t _sOtherIdx, YYSTYPE::EE_NODE_DATA &_ndNode );
+
+		/**
+		 * \brief Creates an \c array.convolve( kernel, dst ) node.
+		 *
+		 * \param _sArrayIdx Index of the signal array.
+		 * \param _sKernelIdx Index of the kernel array.
+		 * \param _sDstIdx Index of the array that receives the full convolution.
+		 * \param _ndNode Receives the resulting node data.
+		 */
+		void								CreateArrayConvolve( size_t _sArrayIdx, size_t _sKernelIdx, size_t _sDstIdx, YYSTYPE::EE_NODE_DATA &_ndNode );
+
+		/**
+		 * \brief Creates an \c array.resample( size, dst ) node.
+		 *
+		 * \param _sArrayIdx Index of the source array.
+		 * \param _ndSize The new-size expression node data.
+		 * \param _sDstIdx Index of the array that receives the resampled elements.
+		 * \param _ndNode Receives the resulting node data.
+		 */
+		void								CreateArrayResample( size_t _sArrayIdx, const YYSTYPE::EE_NODE_DATA &_ndSize, size_t _sDstIdx, YYSTYPE::EE_NODE_DATA &_ndNode );
+
+		/**
+		 * \brief Creates an \c array.sum(), \c array.min(), \c array.max(), or \c array.rms() node.
+		 *
+		 * \param _sArrayIdx Index of the array.
+		 * \param _ui32Token The parser token of the reduction (\c EE_SUM, \c EE_MIN, \c EE_MAX, or \c EE_RMS).
+		 * \param _ndNode Receives the resulting node data.
+		 */
+		void								CreateArrayReduce( size_t _sArrayIdx, uint32_t _ui32Token, YYSTYPE::EE_NODE_DATA &_ndNode );
+
 		/**
 		 * \brief Creates a string array/slice access expression node with one index expression.
 		 *
@@ -2659,6 +2710,62 @@ namespace ee {
 			bool							bPassThrough;
 		};
 
+		/** The state of the compiled bytecode program. */
+		enum EE_PROGRAM_STATE : uint8_t {
+			EE_PS_UNCOMPILED,										/**< Not yet compiled (or the node tree changed). */
+			EE_PS_COMPILED,											/**< m_vProgram evaluates the expression. */
+			EE_PS_UNSUPPORTED,										/**< The expression uses nodes the bytecode does not support; use the tree walker. */
+		};
+
+		/** Bytecode operations.  Registers are indices into m_vRegisters. */
+		enum EE_BYTECODE_OPS : uint8_t {
+			EE_BC_VAR,												/**< Dst = *prVar. */
+			EE_BC_USER,												/**< Dst = user variable (??). */
+			EE_BC_PARM,												/**< Dst = numbered parameter rConst.u.ui64Val. */
+			EE_BC_PARM_TOTAL,										/**< Dst = total numbered parameters. */
+			EE_BC_ADDRESS,											/**< Dst = address handler( A ) with cast ui32Param. */
+			EE_BC_UNARY,											/**< Dst = ui32Param A. */
+			EE_BC_CAST,												/**< Dst = (ui32Param)A. */
+			EE_BC_OP,												/**< Dst = A ui32Param B, any types. */
+			EE_BC_OP_I64,											/**< Dst = A ui32Param B, both known to be signed. */
+			EE_BC_OP_U64,											/**< Dst = A ui32Param B, both known to be unsigned. */
+			EE_BC_OP_F64,											/**< Dst = A ui32Param B, both known to be floating. */
+			EE_BC_AND_SKIP,											/**< If A is false, Dst = 0 and jump to ui32Param. */
+			EE_BC_OR_SKIP,											/**< If A is true, Dst = 1 and jump to ui32Param. */
+			EE_BC_JUMP_IF_FALSE,									/**< If A is false, jump to ui32Param. */
+			EE_BC_JUMP,												/**< Jump to ui32Param. */
+			EE_BC_MOVE,												/**< Dst = A. */
+			EE_BC_CLOCK,											/**< Dst = uFuncPtr.pfClock(). */
+			EE_BC_INTRINSIC_0_DIV,									/**< Dst = uFuncPtr.pfIntrins0Unsigned( Time() ) / rConst.u.ui64Val. */
+			EE_BC_INTRINSIC_1,										/**< Dst = intrinsic ui32Param( A ). */
+			EE_BC_INTRINSIC_2,										/**< Dst = intrinsic ui32Param( A, B ). */
+			EE_BC_INTRINSIC_3,										/**< Dst = intrinsic ui32Param( A, B, C ). */
+			EE_BC_F_F,												/**< Dst = uFuncPtr.pfIntrins1Float_Float( A ). */
+			EE_BC_F_FF,												/**< Dst = uFuncPtr.pfIntrins2Float_Float_Float( A, B ). */
+			EE_BC_F_FFF,											/**< Dst = uFuncPtr.pfIntrins3Float_Float_Float_Float( A, B, C ). */
+		};
+
+		/** A bytecode instruction. */
+		struct EE_INSTRUCTION {
+			EE_BYTECODE_OPS					bcOp;					/**< The operation. */
+			uint32_t						ui32Dst;				/**< Destination register. */
+			uint32_t						ui32A;					/**< First source register. */
+			uint32_t						ui32B;					/**< Second source register. */
+			uint32_t						ui32C;					/**< Third source register. */
+			uint32_t						ui32Param;				/**< Operator, intrinsic, cast type, or jump target. */
+			EE_RESULT						rConst;					/**< Immediate value. */
+			EE_RESULT *						prVar;					/**< Custom variable (the map never moves its values). */
+			decltype(YYSTYPE::EE_NODE_DATA::uFuncPtr)
+											uFuncPtr;				/**< Intrinsic function. */
+		};
+
+		/** What the compiler knows about a register. */
+		struct EE_REG_INFO {
+			uint32_t						ui32Reg;				/**< The register. */
+			EE_NUM_CONSTANTS				ncType;					/**< The type the register always holds, or EE_NC_INVALID if it is only known at run-time. */
+			bool							bConst;					/**< The register holds a constant filled in at compile time. */
+		};
+
 
 		// == Members.
 		CExpEvalLexer *						m_peelLexer;											/**< The lexer. */
@@ -2671,6 +2778,10 @@ namespace ee {
 		std::vector<EE_ARRAY_DATA>			m_vArrayData;											/**< The actual array data. */
 		std::vector<EE_LOOP_STACK>			m_vLoopStack;											/**< The stack of loop scopes. */
 		std::vector<EE_STACK_OBJ>			m_vStack;												/**< The explicit resolve stack. */
+		std::vector<EE_INSTRUCTION>			m_vProgram;												/**< The compiled bytecode. */
+		std::vector<EE_RESULT>				m_vRegisters;											/**< Bytecode registers.  Constant registers are filled once during compilation. */
+		uint32_t							m_ui32ResultReg = 0;									/**< The register holding the final result of the bytecode. */
+		EE_PROGRAM_STATE					m_psProgramState = EE_PS_UNCOMPILED;					/**< Whether m_vProgram can be used. */
 		std::vector<EE_RESULT>				m_vNumberedParms;										/**< Numbered parameters. */
 		std::vector<std::vector<EE_RESULT>>	m_vFuncParms;											/**< Function parameters. */
 		std::set<size_t>					m_sNumberedParmsAccessed;								/**< Referenced numbered parameters. */
@@ -2726,6 +2837,202 @@ namespace ee {
 		 */
 		bool								ResolveNode_ExplicitStack( size_t _sNode, EE_RESULT &_rFinalResult, EE_ERROR_CODES &_ecError );
 
+		/**
+		 * \brief Compiles the node tree to register bytecode.
+		 *
+		 * Only pure expressions (constants, variables, parameters, address reads, unary/binary/cast operators, ?:, and
+		 *	intrinsics) are compiled.  Constant sub-expressions are folded.  If any other node is found, the program is marked
+		 *	EE_PS_UNSUPPORTED and Resolve() keeps using the tree walker.
+		 *
+		 * \return Returns true if the program was compiled.
+		 */
+		bool								CompileProgram();
+
+		/**
+		 * \brief Compiles a node and its children to register bytecode.
+		 *
+		 * \param _sNode Index of the node to compile.
+		 * \param _ui32Depth Current recursion depth.
+		 * \param _riReg Receives the register holding the node's value.
+		 * \return Returns true if the node could be compiled.
+		 */
+		bool								CompileNode( size_t _sNode, uint32_t _ui32Depth, EE_REG_INFO &_riReg );
+
+		/**
+		 * \brief Emits a binary operation, choosing a typed operation when both operand types are known.
+		 *
+		 * \param _uiOp The operator.
+		 * \param _riLeft The left operand.
+		 * \param _riRight The right operand.
+		 * \param _ui32Dst The destination register.
+		 * \return Returns the type of the result, or EE_NC_INVALID if it is only known at run-time.
+		 */
+		EE_NUM_CONSTANTS					EmitOp( uint32_t _uiOp, const EE_REG_INFO &_riLeft, const EE_REG_INFO &_riRight, uint32_t _ui32Dst );
+
+		/**
+		 * \brief Adds a register.
+		 *
+		 * \return Returns the index of the new register.
+		 */
+		uint32_t							AddRegister() {
+			m_vRegisters.push_back( DefaultResult() );
+			return uint32_t( m_vRegisters.size() - 1 );
+		}
+
+		/**
+		 * \brief Adds a register holding a constant.
+		 *
+		 * \param _rVal The constant.
+		 * \param _riReg Receives the register.
+		 */
+		void								AddConstRegister( const EE_RESULT &_rVal, EE_REG_INFO &_riReg ) {
+			_riReg.ui32Reg = AddRegister();
+			m_vRegisters[_riReg.ui32Reg] = _rVal;
+			_riReg.ncType = _rVal.ncType;
+			_riReg.bConst = true;
+		}
+
+		/**
+		 * \brief Adds an instruction.
+		 *
+		 * \param _bcOp The operation.
+		 * \param _ui32Dst The destination register.
+		 * \param _ui32A The first source register.
+		 * \param _ui32Param The operator, intrinsic, cast type, or jump target.
+		 * \return Returns the index of the new instruction.
+		 */
+		size_t								AddInstruction( EE_BYTECODE_OPS _bcOp, uint32_t _ui32Dst, uint32_t _ui32A = 0, uint32_t _ui32Param = 0 ) {
+			EE_INSTRUCTION iIns = {};
+			iIns.bcOp = _bcOp;
+			iIns.ui32Dst = _ui32Dst;
+			iIns.ui32A = _ui32A;
+			iIns.ui32Param = _ui32Param;
+			m_vProgram.push_back( iIns );
+			return m_vProgram.size() - 1;
+		}
+
+		/**
+		 * \brief Runs the compiled bytecode.
+		 *
+		 * \param _rFinalResult Receives the resolved value.
+		 * \param _ecError Receives a specific error code when evaluation fails.
+		 * \return Returns true if evaluation succeeded; false otherwise.
+		 */
+		bool								RunProgram( EE_RESULT &_rFinalResult, EE_ERROR_CODES &_ecError );
+
+		/**
+		 * \brief Casts a result to one of the basic cast types (EE_CT_INT8 through EE_CT_DOUBLE).
+		 *
+		 * \param _rExp The value to cast.
+		 * \param _ctCast The type to which to cast.
+		 * \param _rResult Receives the cast value.
+		 * \return Returns an \c EE_ERROR_CODES value describing success or failure.
+		 */
+		EE_ERROR_CODES						PerformCast( const EE_RESULT &_rExp, EE_CAST_TYPES _ctCast, EE_RESULT &_rResult );
+
+		/**
+		 * \brief Determines whether a result is a number (signed, unsigned, or floating).
+		 *
+		 * \param _rRes The result to test.
+		 * \return Returns true if _rRes is a number.
+		 */
+		static inline bool					IsNumber( const EE_RESULT &_rRes ) {
+			return _rRes.ncType == EE_NC_SIGNED || _rRes.ncType == EE_NC_UNSIGNED || _rRes.ncType == EE_NC_FLOATING;
+		}
+
+		/**
+		 * \brief Determines whether a numeric result is non-zero.  Only valid if IsNumber() is true.
+		 *
+		 * \param _rRes The result to test.
+		 * \return Returns true if _rRes is non-zero.
+		 */
+		static inline bool					IsTrue( const EE_RESULT &_rRes ) {
+			return _rRes.ncType == EE_NC_FLOATING ? _rRes.u.dVal != 0.0 : _rRes.u.ui64Val != 0;
+		}
+
+		/**
+		 * \brief Determines whether an operator produces a boolean (EE_NC_UNSIGNED) result.
+		 *
+		 * \param _uiOp The operator.
+		 * \return Returns true for comparisons, && and ||.
+		 */
+		static inline bool					IsBoolOp( uint32_t _uiOp ) {
+			return _uiOp == '<' || _uiOp == '>' ||
+				_uiOp == CExpEvalParser::token::EE_REL_LE || _uiOp == CExpEvalParser::token::EE_REL_GE ||
+				_uiOp == CExpEvalParser::token::EE_EQU_E || _uiOp == CExpEvalParser::token::EE_EQU_NE ||
+				_uiOp == CExpEvalParser::token::EE_AND || _uiOp == CExpEvalParser::token::EE_OR;
+		}
+
+		/**
+		 * \brief Performs an operation on two integers of the same type.  Matches PerformOp() for EE_NC_SIGNED and EE_NC_UNSIGNED.
+		 *
+		 * \param _tLeft The left operand.
+		 * \param _uiOp The operator.
+		 * \param _tRight The right operand.
+		 * \param _ncType The type of the operands.
+		 * \param _rResult Receives the operation result.
+		 * \return Returns an \c EE_ERROR_CODES value describing success or failure.
+		 */
+		template <typename _tType>
+		static inline EE_ERROR_CODES		PerformIntOp( _tType _tLeft, uint32_t _uiOp, _tType _tRight, EE_NUM_CONSTANTS _ncType, EE_RESULT &_rResult ) {
+			_rResult.ncType = _ncType;
+			switch ( _uiOp ) {
+				case '*' : { _rResult.u.ui64Val = uint64_t( _tLeft * _tRight ); break; }
+				case '/' : { _rResult.u.ui64Val = _tRight ? uint64_t( _tLeft / _tRight ) : 0; break; }
+				case '%' : { _rResult.u.ui64Val = _tRight ? uint64_t( _tLeft % _tRight ) : 0; break; }
+				case '+' : { _rResult.u.ui64Val = uint64_t( _tLeft + _tRight ); break; }
+				case '-' : { _rResult.u.ui64Val = uint64_t( _tLeft - _tRight ); break; }
+				case CExpEvalParser::token::EE_RIGHT_OP : { _rResult.u.ui64Val = uint64_t( _tLeft >> _tRight ); break; }
+				case CExpEvalParser::token::EE_LEFT_OP : { _rResult.u.ui64Val = uint64_t( _tLeft << _tRight ); break; }
+				case '&' : { _rResult.u.ui64Val = uint64_t( _tLeft & _tRight ); break; }
+				case '^' : { _rResult.u.ui64Val = uint64_t( _tLeft ^ _tRight ); break; }
+				case '|' : { _rResult.u.ui64Val = uint64_t( _tLeft | _tRight ); break; }
+				case '<' : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft < _tRight; break; }
+				case '>' : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft > _tRight; break; }
+				case CExpEvalParser::token::EE_REL_LE : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft <= _tRight; break; }
+				case CExpEvalParser::token::EE_REL_GE : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft >= _tRight; break; }
+				case CExpEvalParser::token::EE_EQU_E : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft == _tRight; break; }
+				case CExpEvalParser::token::EE_EQU_NE : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft != _tRight; break; }
+				case CExpEvalParser::token::EE_AND : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft && _tRight; break; }
+				case CExpEvalParser::token::EE_OR : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _tLeft || _tRight; break; }
+				default : { return EE_EC_ERRORPROCESSINGOP; }
+			}
+			return EE_EC_SUCCESS;
+		}
+
+		/**
+		 * \brief Performs an operation on two doubles.  Matches PerformOp() for EE_NC_FLOATING.
+		 *
+		 * \param _dLeft The left operand.
+		 * \param _uiOp The operator.
+		 * \param _dRight The right operand.
+		 * \param _rResult Receives the operation result.
+		 * \return Returns an \c EE_ERROR_CODES value describing success or failure.
+		 */
+		static inline EE_ERROR_CODES		PerformFloatOp( double _dLeft, uint32_t _uiOp, double _dRight, EE_RESULT &_rResult ) {
+			_rResult.ncType = EE_NC_FLOATING;
+			switch ( _uiOp ) {
+				case '*' : { _rResult.u.dVal = _dLeft * _dRight; break; }
+				case '/' : { _rResult.u.dVal = _dLeft / _dRight; break; }
+				case '+' : { _rResult.u.dVal = _dLeft + _dRight; break; }
+				case '-' : { _rResult.u.dVal = _dLeft - _dRight; break; }
+				case '<' : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft < _dRight; break; }
+				case '>' : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft > _dRight; break; }
+				case CExpEvalParser::token::EE_REL_LE : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft <= _dRight; break; }
+				case CExpEvalParser::token::EE_REL_GE : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft >= _dRight; break; }
+				case CExpEvalParser::token::EE_EQU_E : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft == _dRight; break; }
+				case CExpEvalParser::token::EE_EQU_NE : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft != _dRight; break; }
+				case CExpEvalParser::token::EE_AND : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft && _dRight; break; }
+				case CExpEvalParser::token::EE_OR : { _rResult.ncType = EE_NC_UNSIGNED; _rResult.u.ui64Val = _dLeft || _dRight; break; }
+				case CExpEvalParser::token::EE_RIGHT_OP : { _rResult.u.dVal = RShift( _dLeft, _dRight ); break; }
+				case CExpEvalParser::token::EE_LEFT_OP : { _rResult.u.dVal = LShift( _dLeft, _dRight ); break; }
+				case '%' : { _rResult.u.dVal = std::fmod( _dLeft, _dRight ); break; }
+				case '^' : { _rResult.u.dVal = std::pow( _dLeft, _dRight ); break; }
+				default : { return EE_EC_INVALIDTREE; }
+			}
+			return EE_EC_SUCCESS;
+		}
+
 		/**
 		 * \brief Creates an array instance based on a type identifier.
 		 *
@@ -2734,6 +3041,14 @@ namespace ee {
 		 */
 		CArrayBase *						CreateArrayFromType( uint32_t _ui32Type );
 
+		/**
+		 * \brief Converts the parser token of a bulk array operation to its \c EE_ARRAY_OP value.
+		 *
+		 * \param _ui32Token The parser token (\c EE_ADD, \c EE_SUB, \c EE_MUL, or \c EE_DIV).
+		 * \return Returns the \c EE_ARRAY_OP value.  Throws \c EE_EC_PROCESSINGERROR for any other token.
+		 */
+		static uint32_t						ArrayOpFromToken( uint32_t _ui32Token );
+
 		/**
 		 * \brief Creates a string reference object from a string-table index.
 		 *
@@ -162,6 +162,14 @@ namespace ee {
 		EE_N_VECTOR_SWAP,
 		EE_N_STRING_TOKENIZE_IDENT,
 		EE_N_STRING_TOKENIZE,
+		EE_N_ARRAY_APPLY,
+		EE_N_ARRAY_APPLY_ARRAY,
+		EE_N_ARRAY_CONVOLVE,
+		EE_N_ARRAY_RESAMPLE,
+		EE_N_ARRAY_SUM,
+		EE_N_ARRAY_MIN,
+		EE_N_ARRAY_MAX,
+		EE_N_ARRAY_RMS,
 
 		EE_N_BARTHANN,
 		EE_N_BARTLETT,
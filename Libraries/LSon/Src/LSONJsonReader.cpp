@@ -0,0 +1,559 @@
+#include "LSONJsonReader.h"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#define LSON_AVX2
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || (defined( _M_IX86_FP ) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LSON_SSE2
+#endif	// #if defined( __AVX2__ )
+
+
+namespace lson {
+
+	namespace {
+
+		/** Character classes for the scalar classifier. */
+		enum LSON_CLASS : uint8_t {
+			LSON_C_QUOTE			= 1 << 0,
+			LSON_C_BACKSLASH		= 1 << 1,
+			LSON_C_OP				= 1 << 2,
+			LSON_C_SPACE			= 1 << 3,
+		};
+
+		/** The class of every byte. */
+		constexpr std::array<uint8_t, 256> s_aClasses = []() {
+			std::array<uint8_t, 256> aRet = {};
+			aRet['"'] = LSON_C_QUOTE;
+			aRet['\\'] = LSON_C_BACKSLASH;
+			aRet['{'] = aRet['}'] = aRet['['] = aRet[']'] = aRet[':'] = aRet[','] = LSON_C_OP;
+			aRet[' '] = aRet['\t'] = aRet['\r'] = aRet['\n'] = LSON_C_SPACE;
+			return aRet;
+		}();
+
+		/**
+		 * Gets the prefix XOR of a mask: bit N of the result is the XOR of bits 0 through N.  Applied to the quote mask, this gives the mask of
+		 *	bytes inside strings (including the opening quote but not the closing quote).
+		 *
+		 * \param _ui64Mask The mask.
+		 * \return Returns the prefix XOR of the mask.
+		 */
+		inline uint64_t PrefixXor( uint64_t _ui64Mask ) {
+			_ui64Mask ^= _ui64Mask << 1;
+			_ui64Mask ^= _ui64Mask << 2;
+			_ui64Mask ^= _ui64Mask << 4;
+			_ui64Mask ^= _ui64Mask << 8;
+			_ui64Mask ^= _ui64Mask << 16;
+			_ui64Mask ^= _ui64Mask << 32;
+			return _ui64Mask;
+		}
+
+		/**
+		 * Determines if a character is JSON whitespace.
+		 *
+		 * \param _cChar The character to check.
+		 * \return Returns true if the character is a space, tab, carriage return, or new line.
+		 */
+		inline bool IsSpace( char _cChar ) {
+			return (s_aClasses[uint8_t( _cChar )] & LSON_C_SPACE) != 0;
+		}
+
+		/**
+		 * Converts a hexadecimal digit.
+		 *
+		 * \param _cChar The character to convert.
+		 * \return Returns the value of the digit or -1 if the character is not a hexadecimal digit.
+		 */
+		inline int32_t HexDigit( char _cChar ) {
+			if ( _cChar >= '0' && _cChar <= '9' ) { return _cChar - '0'; }
+			if ( _cChar >= 'a' && _cChar <= 'f' ) { return _cChar - 'a' + 10; }
+			if ( _cChar >= 'A' && _cChar <= 'F' ) { return _cChar - 'A' + 10; }
+			return -1;
+		}
+
+	}	// namespace
+
+	CJsonReader::CJsonReader() :
+		m_pcJson( nullptr ),
+		m_sLen( 0 ),
+		m_sPos( 0 ),
+		m_sOffset( 0 ),
+		m_sState( LSON_S_VALUE ),
+		m_bError( false ) {
+	}
+
+	// == Functions.
+	/**
+	 * Sets the JSON data to read and scans it for structural characters.  Reading starts at the first token.
+	 *
+	 * \param _pcJson The JSON data.  Need not be NULL-terminated.
+	 * \param _sLen The number of bytes to which _pcJson points.
+	 * \return Returns false if the data is too large, contains an unterminated string, or memory could not be allocated.
+	 */
+	bool CJsonReader::SetJson( const char * _pcJson, size_t _sLen ) {
+		m_pcJson = _pcJson;
+		m_sLen = _sLen;
+		m_sPos = 0;
+		m_vStack.clear();
+		m_sOffset = 0;
+		m_sState = LSON_S_VALUE;
+		m_bError = false;
+		try {
+			if ( !ScanStructurals( _pcJson, _sLen, m_vIndices ) ) {
+				m_vIndices.clear();
+				return Fail( _sLen );
+			}
+		}
+		catch ( ... ) {
+			m_vIndices.clear();
+			return Fail( 0 );
+		}
+		return true;
+	}
+
+	/**
+	 * Reads the next token.
+	 *
+	 * \param _tToken Holds the token upon success.
+	 * \return Returns true if a token was read.  Returns false at the end of the data or on a syntax error (see Error()).
+	 */
+	bool CJsonReader::Next( LSON_TOKEN &_tToken ) {
+		if ( m_bError ) { return false; }
+		while ( true ) {
+			if ( m_sPos >= m_vIndices.size() ) {
+				if ( m_sState == LSON_S_DONE ) { return false; }
+				return Fail( m_sLen );
+			}
+			size_t sIdx = m_vIndices[m_sPos];
+			char cChar = m_pcJson[sIdx];
+			m_sOffset = sIdx;
+			switch ( m_sState ) {
+				case LSON_S_VALUE_OR_END : {
+					if ( cChar == ']' ) {
+						++m_sPos;
+						m_vStack.pop_back();
+						m_sState = AfterValue();
+						_tToken.ttType = LSON_TT_END_ARRAY;
+						return true;
+					}
+					return ReadValue( _tToken );
+				}
+				case LSON_S_VALUE : {
+					return ReadValue( _tToken );
+				}
+				case LSON_S_KEY_OR_END : {
+					if ( cChar == '}' ) {
+						++m_sPos;
+						m_vStack.pop_back();
+						m_sState = AfterValue();
+						_tToken.ttType = LSON_TT_END_OBJECT;
+						return true;
+					}
+					[[fallthrough]];
+				}
+				case LSON_S_KEY : {
+					if ( cChar != '"' ) { return Fail( sIdx ); }
+					if ( !ReadString( _tToken.svString ) ) { return false; }
+					if ( m_sPos >= m_vIndices.size() || m_pcJson[m_vIndices[m_sPos]] != ':' ) {
+						return Fail( m_sPos >= m_vIndices.size() ? m_sLen : m_vIndices[m_sPos] );
+					}
+					++m_sPos;
+					m_sState = LSON_S_VALUE;
+					_tToken.ttType = LSON_TT_KEY;
+					return true;
+				}
+				case LSON_S_COMMA_OR_END : {
+					if ( cChar == ',' ) {
+						++m_sPos;
+						m_sState = m_vStack.back() == '{' ? LSON_S_KEY : LSON_S_VALUE;
+						continue;
+					}
+					if ( (cChar == '}' || cChar == ']') && m_vStack.back() == (cChar == '}' ? '{' : '[') ) {
+						++m_sPos;
+						m_vStack.pop_back();
+						m_sState = AfterValue();
+						_tToken.ttType = cChar == '}' ? LSON_TT_END_OBJECT : LSON_TT_END_ARRAY;
+						return true;
+					}
+					return Fail( sIdx );
+				}
+				default : {
+					// Data after the root value.
+					return Fail( sIdx );
+				}
+			}
+		}
+	}
+
+	/**
+	 * Skips the next value (including all of its members if it is an object or array).  Call after reading a key or inside an array.
+	 *
+	 * \return Returns true if a value was skipped.
+	 */
+	bool CJsonReader::Skip() {
+		// Do not consume the end of an array when there is no value to skip.
+		if ( m_sState == LSON_S_VALUE_OR_END && m_sPos < m_vIndices.size() && m_pcJson[m_vIndices[m_sPos]] == ']' ) { return false; }
+		if ( m_sState != LSON_S_VALUE && m_sState != LSON_S_VALUE_OR_END ) {
+			if ( m_sState != LSON_S_COMMA_OR_END || m_sPos >= m_vIndices.size() || m_pcJson[m_vIndices[m_sPos]] != ',' || m_vStack.back() != '[' ) { return false; }
+		}
+		size_t sDepth = m_vStack.size();
+		LSON_TOKEN tToken;
+		if ( !Next( tToken ) ) { return false; }
+		if ( tToken.ttType == LSON_TT_START_OBJECT || tToken.ttType == LSON_TT_START_ARRAY ) {
+			while ( m_vStack.size() > sDepth ) {
+				if ( !Next( tToken ) ) { return false; }
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Reads every token, passing each to a handler.
+	 *
+	 * \param _hHandler The handler to receive the tokens.
+	 * \return Returns true if the whole document was read without error and the handler did not stop it.
+	 */
+	bool CJsonReader::Parse( CHandler &_hHandler ) {
+		LSON_TOKEN tToken;
+		while ( Next( tToken ) ) {
+			bool bContinue;
+			switch ( tToken.ttType ) {
+				case LSON_TT_START_OBJECT : { bContinue = _hHandler.StartObject(); break; }
+				case LSON_TT_END_OBJECT : { bContinue = _hHandler.EndObject(); break; }
+				case LSON_TT_START_ARRAY : { bContinue = _hHandler.StartArray(); break; }
+				case LSON_TT_END_ARRAY : { bContinue = _hHandler.EndArray(); break; }
+				case LSON_TT_KEY : { bContinue = _hHandler.Key( tToken.svString ); break; }
+				case LSON_TT_STRING : { bContinue = _hHandler.String( tToken.svString ); break; }
+				case LSON_TT_NUMBER : { bContinue = _hHandler.Number( tToken.dNumber ); break; }
+				case LSON_TT_TRUE : { bContinue = _hHandler.Bool( true ); break; }
+				case LSON_TT_FALSE : { bContinue = _hHandler.Bool( false ); break; }
+				default : { bContinue = _hHandler.Null(); }
+			}
+			if ( !bContinue ) { return false; }
+		}
+		return !m_bError && m_sState == LSON_S_DONE;
+	}
+
+	/**
+	 * Sets the error flag at the given offset.
+	 *
+	 * \param _sOffset The byte offset of the error.
+	 * \return Returns false.
+	 */
+	bool CJsonReader::Fail( size_t _sOffset ) {
+		m_bError = true;
+		m_sOffset = _sOffset;
+		return false;
+	}
+
+	/**
+	 * Reads a value starting at the current index.
+	 *
+	 * \param _tToken Holds the token upon success.
+	 * \return Returns true if the value was read.
+	 */
+	bool CJsonReader::ReadValue( LSON_TOKEN &_tToken ) {
+		size_t sIdx = m_vIndices[m_sPos];
+		switch ( m_pcJson[sIdx] ) {
+			case '{' : {
+				++m_sPos;
+				m_vStack.push_back( '{' );
+				m_sState = LSON_S_KEY_OR_END;
+				_tToken.ttType = LSON_TT_START_OBJECT;
+				return true;
+			}
+			case '[' : {
+				++m_sPos;
+				m_vStack.push_back( '[' );
+				m_sState = LSON_S_VALUE_OR_END;
+				_tToken.ttType = LSON_TT_START_ARRAY;
+				return true;
+			}
+			case '"' : {
+				if ( !ReadString( _tToken.svString ) ) { return false; }
+				m_sState = AfterValue();
+				_tToken.ttType = LSON_TT_STRING;
+				return true;
+			}
+			case '}' : {}	[[fallthrough]];
+			case ']' : {}	[[fallthrough]];
+			case ':' : {}	[[fallthrough]];
+			case ',' : {
+				return Fail( sIdx );
+			}
+			default : {
+				if ( !ReadScalar( _tToken ) ) { return false; }
+				m_sState = AfterValue();
+				return true;
+			}
+		}
+	}
+
+	/**
+	 * Reads a string starting at the opening quote at the current index.
+	 *
+	 * \param _svString Holds the string upon success.
+	 * \return Returns true if the string was read.
+	 */
+	bool CJsonReader::ReadString( std::string_view &_svString ) {
+		// The scanner records both quotes and guarantees that every string is terminated, so the closing quote is the next index.
+		const char * pcStart = m_pcJson + m_vIndices[m_sPos] + 1;
+		const char * pcEnd = m_pcJson + m_vIndices[m_sPos+1];
+		m_sPos += 2;
+		if ( !std::memchr( pcStart, '\\', size_t( pcEnd - pcStart ) ) ) {
+			_svString = std::string_view( pcStart, size_t( pcEnd - pcStart ) );
+			return true;
+		}
+		try {
+			if ( !Unescape( pcStart, pcEnd, m_sScratch ) ) { return Fail( size_t( pcStart - m_pcJson ) ); }
+		}
+		catch ( ... ) { return Fail( size_t( pcStart - m_pcJson ) ); }
+		_svString = m_sScratch;
+		return true;
+	}
+
+	/**
+	 * Reads a number or literal starting at the current index.
+	 *
+	 * \param _tToken Holds the token upon success.
+	 * \return Returns true if the number or literal was read.
+	 */
+	bool CJsonReader::ReadScalar( LSON_TOKEN &_tToken ) {
+		size_t sStart = m_vIndices[m_sPos++];
+		size_t sEnd = m_sPos < m_vIndices.size() ? m_vIndices[m_sPos] : m_sLen;
+		while ( sEnd > sStart && IsSpace( m_pcJson[sEnd-1] ) ) { --sEnd; }
+		std::string_view svText( m_pcJson + sStart, sEnd - sStart );
+
+		char cFirst = svText[0];
+		if ( cFirst == '-' || (cFirst >= '0' && cFirst <= '9') ) {
+			if ( svText.back() < '0' || svText.back() > '9' ) { return Fail( sStart ); }
+			auto aRes = std::from_chars( svText.data(), svText.data() + svText.size(), _tToken.dNumber );
+			if ( aRes.ec != std::errc() || aRes.ptr != svText.data() + svText.size() ) { return Fail( sStart ); }
+			_tToken.ttType = LSON_TT_NUMBER;
+			return true;
+		}
+		if ( svText == "true" ) { _tToken.ttType = LSON_TT_TRUE; return true; }
+		if ( svText == "false" ) { _tToken.ttType = LSON_TT_FALSE; return true; }
+		if ( svText == "null" ) { _tToken.ttType = LSON_TT_NULL; return true; }
+		return Fail( sStart );
+	}
+
+	/**
+	 * Finds the offsets of every structural character, unescaped quote, and number/literal start outside of strings.
+	 *
+	 * \param _pcJson The JSON data.
+	 * \param _sLen The number of bytes to which _pcJson points.
+	 * \param _vIndices Holds the offsets.
+	 * \return Returns false if a string is not terminated.
+	 */
+	bool CJsonReader::ScanStructurals( const char * _pcJson, size_t _sLen, std::vector<uint32_t> &_vIndices ) {
+		if ( _sLen > UINT32_MAX ) { return false; }
+		_vIndices.clear();
+		// Typical JSON has a structural position every 4-8 bytes.
+		_vIndices.resize( _sLen / 4 + 64 );
+		size_t sTotal = 0;
+
+		uint64_t ui64EscapeCarry = 0;				// Bit 0 set if the first byte of the next block is escaped.
+		uint64_t ui64StringCarry = 0;				// All bits set if the next block starts inside a string.
+		uint64_t ui64BoundaryCarry = 1;				// Bit 0 set if the byte before the next block ends a scalar (or the data begins).
+		const uint8_t * pui8Src = reinterpret_cast<const uint8_t *>(_pcJson);
+		for ( size_t I = 0; I < _sLen; I += 64 ) {
+			uint64_t ui64Quotes, ui64Backslashes, ui64Ops, ui64Spaces;
+			size_t sThis = _sLen - I;
+			if ( sThis >= 64 ) {
+				ClassifyBlock( pui8Src + I, ui64Quotes, ui64Backslashes, ui64Ops, ui64Spaces );
+			}
+			else {
+				// Pad the last block with spaces.
+				uint8_t ui8Tail[64];
+				std::memset( ui8Tail, ' ', sizeof( ui8Tail ) );
+				std::memcpy( ui8Tail, pui8Src + I, sThis );
+				ClassifyBlock( ui8Tail, ui64Quotes, ui64Backslashes, ui64Ops, ui64Spaces );
+			}
+
+			// Find escaped bytes.  Backslashes are rare, so they are walked one at a time.
+			uint64_t ui64Escaped = ui64EscapeCarry;
+			uint64_t ui64Escapers = ui64Backslashes & ~ui64EscapeCarry;
+			ui64EscapeCarry = 0;
+			while ( ui64Escapers ) {
+				int iBit = std::countr_zero( ui64Escapers );
+				ui64Escapers &= ui64Escapers - 1;
+				if ( iBit == 63 ) {
+					ui64EscapeCarry = 1;
+				}
+				else {
+					uint64_t ui64Next = 1ULL << (iBit + 1);
+					ui64Escaped |= ui64Next;
+					ui64Escapers &= ~ui64Next;		// An escaped backslash escapes nothing.
+				}
+			}
+			ui64Quotes &= ~ui64Escaped;
+
+			uint64_t ui64InString = PrefixXor( ui64Quotes ) ^ ui64StringCarry;
+			ui64StringCarry = uint64_t( int64_t( ui64InString ) >> 63 );
+
+			// Numbers and literals start at any other byte outside of a string that follows a structural character, quote, or whitespace.
+			uint64_t ui64NonScalar = ui64Ops | ui64Spaces | ui64Quotes;
+			uint64_t ui64Starts = ~ui64NonScalar & ~ui64InString & ((ui64NonScalar << 1) | ui64BoundaryCarry);
+			ui64BoundaryCarry = ui64NonScalar >> 63;
+
+			uint64_t ui64Bits = (ui64Ops & ~ui64InString) | ui64Quotes | ui64Starts;
+			if ( sThis < 64 ) { ui64Bits &= (1ULL << sThis) - 1; }
+
+			// Flatten the bits into offsets.
+			if ( sTotal + 64 > _vIndices.size() ) {
+				_vIndices.resize( _vIndices.size() * 2 + 64 );
+			}
+			uint32_t * pui32Dst = _vIndices.data() + sTotal;
+			sTotal += size_t( std::popcount( ui64Bits ) );
+			while ( ui64Bits ) {
+				(*pui32Dst++) = uint32_t( I + std::countr_zero( ui64Bits ) );
+				ui64Bits &= ui64Bits - 1;
+			}
+		}
+		_vIndices.resize( sTotal );
+		return ui64StringCarry == 0;
+	}
+
+	/**
+	 * Classifies 64 bytes.  Bit N of each mask corresponds to byte N.
+	 *
+	 * \param _pui8Block The 64 bytes to classify.
+	 * \param _ui64Quotes Holds the mask of '"' characters.
+	 * \param _ui64Backslashes Holds the mask of '\' characters.
+	 * \param _ui64Ops Holds the mask of '{', '}', '[', ']', ':', and ',' characters.
+	 * \param _ui64Spaces Holds the mask of ' ', '\t', '\r', and '\n' characters.
+	 */
+	void CJsonReader::ClassifyBlock( const uint8_t * _pui8Block, uint64_t &_ui64Quotes, uint64_t &_ui64Backslashes, uint64_t &_ui64Ops, uint64_t &_ui64Spaces ) {
+#if defined( LSON_AVX2 )
+		_ui64Quotes = _ui64Backslashes = _ui64Ops = _ui64Spaces = 0;
+		for ( size_t I = 0; I < 64; I += 32 ) {
+			__m256i mBytes = _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui8Block + I) );
+			// '[' and ']' differ from '{' and '}' only by bit 5.
+			__m256i mLower = _mm256_or_si256( mBytes, _mm256_set1_epi8( 0x20 ) );
+#define LSON_EQ( VAL, CHAR )		_mm256_cmpeq_epi8( VAL, _mm256_set1_epi8( CHAR ) )
+#define LSON_MASK( VAL )			uint64_t( uint32_t( _mm256_movemask_epi8( VAL ) ) )
+			_ui64Quotes |= LSON_MASK( LSON_EQ( mBytes, '"' ) ) << I;
+			_ui64Backslashes |= LSON_MASK( LSON_EQ( mBytes, '\\' ) ) << I;
+			_ui64Ops |= LSON_MASK( _mm256_or_si256( _mm256_or_si256( LSON_EQ( mLower, '{' ), LSON_EQ( mLower, '}' ) ),
+				_mm256_or_si256( LSON_EQ( mBytes, ':' ), LSON_EQ( mBytes, ',' ) ) ) ) << I;
+			_ui64Spaces |= LSON_MASK( _mm256_or_si256( _mm256_or_si256( LSON_EQ( mBytes, ' ' ), LSON_EQ( mBytes, '\t' ) ),
+				_mm256_or_si256( LSON_EQ( mBytes, '\r' ), LSON_EQ( mBytes, '\n' ) ) ) ) << I;
+#undef LSON_MASK
+#undef LSON_EQ
+		}
+#elif defined( LSON_SSE2 )
+		_ui64Quotes = _ui64Backslashes = _ui64Ops = _ui64Spaces = 0;
+		for ( size_t I = 0; I < 64; I += 16 ) {
+			__m128i mBytes = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Block + I) );
+			// '[' and ']' differ from '{' and '}' only by bit 5.
+			__m128i mLower = _mm_or_si128( mBytes, _mm_set1_epi8( 0x20 ) );
+#define LSON_EQ( VAL, CHAR )		_mm_cmpeq_epi8( VAL, _mm_set1_epi8( CHAR ) )
+#define LSON_MASK( VAL )			uint64_t( uint32_t( _mm_movemask_epi8( VAL ) ) )
+			_ui64Quotes |= LSON_MASK( LSON_EQ( mBytes, '"' ) ) << I;
+			_ui64Backslashes |= LSON_MASK( LSON_EQ( mBytes, '\\' ) ) << I;
+			_ui64Ops |= LSON_MASK( _mm_or_si128( _mm_or_si128( LSON_EQ( mLower, '{' ), LSON_EQ( mLower, '}' ) ),
+				_mm_or_si128( LSON_EQ( mBytes, ':' ), LSON_EQ( mBytes, ',' ) ) ) ) << I;
+			_ui64Spaces |= LSON_MASK( _mm_or_si128( _mm_or_si128( LSON_EQ( mBytes, ' ' ), LSON_EQ( mBytes, '\t' ) ),
+				_mm_or_si128( LSON_EQ( mBytes, '\r' ), LSON_EQ( mBytes, '\n' ) ) ) ) << I;
+#undef LSON_MASK
+#undef LSON_EQ
+		}
+#else
+		_ui64Quotes = _ui64Backslashes = _ui64Ops = _ui64Spaces = 0;
+		for ( size_t I = 0; I < 64; ++I ) {
+			uint64_t ui64Bit = 1ULL << I;
+			uint8_t ui8Class = s_aClasses[_pui8Block[I]];
+			if ( ui8Class & LSON_C_QUOTE ) { _ui64Quotes |= ui64Bit; }
+			if ( ui8Class & LSON_C_BACKSLASH ) { _ui64Backslashes |= ui64Bit; }
+			if ( ui8Class & LSON_C_OP ) { _ui64Ops |= ui64Bit; }
+			if ( ui8Class & LSON_C_SPACE ) { _ui64Spaces |= ui64Bit; }
+		}
+#endif	// #if defined( LSON_AVX2 )
+	}
+
+	/**
+	 * Decodes a string containing escapes.
+	 *
+	 * \param _pcStart The first character after the opening quote.
+	 * \param _pcEnd The closing quote.
+	 * \param _sResult Holds the decoded UTF-8 string.
+	 * \return Returns false if an escape is invalid.
+	 */
+	bool CJsonReader::Unescape( const char * _pcStart, const char * _pcEnd, std::string &_sResult ) {
+		_sResult.clear();
+		_sResult.reserve( size_t( _pcEnd - _pcStart ) );
+		auto ReadHex4 = [&]( const char * _pcHex, uint32_t &_ui32Val ) {
+			if ( _pcEnd - _pcHex < 4 ) { return false; }
+			_ui32Val = 0;
+			for ( size_t I = 0; I < 4; ++I ) {
+				int32_t i32Digit = HexDigit( _pcHex[I] );
+				if ( i32Digit < 0 ) { return false; }
+				_ui32Val = (_ui32Val << 4) | uint32_t( i32Digit );
+			}
+			return true;
+		};
+		while ( _pcStart < _pcEnd ) {
+			const char * pcSlash = static_cast<const char *>(std::memchr( _pcStart, '\\', size_t( _pcEnd - _pcStart ) ));
+			if ( !pcSlash ) {
+				_sResult.append( _pcStart, _pcEnd );
+				break;
+			}
+			_sResult.append( _pcStart, pcSlash );
+			if ( pcSlash + 1 >= _pcEnd ) { return false; }
+			_pcStart = pcSlash + 2;
+			switch ( pcSlash[1] ) {
+				case '"' : { _sResult.push_back( '"' ); break; }
+				case '\\' : { _sResult.push_back( '\\' ); break; }
+				case '/' : { _sResult.push_back( '/' ); break; }
+				case 'b' : { _sResult.push_back( '\b' ); break; }
+				case 'f' : { _sResult.push_back( '\f' ); break; }
+				case 'n' : { _sResult.push_back( '\n' ); break; }
+				case 'r' : { _sResult.push_back( '\r' ); break; }
+				case 't' : { _sResult.push_back( '\t' ); break; }
+				case 'u' : {
+					uint32_t ui32Code;
+					if ( !ReadHex4( _pcStart, ui32Code ) ) { return false; }
+					_pcStart += 4;
+					if ( ui32Code >= 0xD800 && ui32Code <= 0xDBFF ) {
+						// A high surrogate must be followed by an escaped low surrogate.
+						uint32_t ui32Low;
+						if ( _pcEnd - _pcStart < 6 || _pcStart[0] != '\\' || _pcStart[1] != 'u' || !ReadHex4( _pcStart + 2, ui32Low ) ||
+							ui32Low < 0xDC00 || ui32Low > 0xDFFF ) { return false; }
+						_pcStart += 6;
+						ui32Code = 0x10000 + ((ui32Code - 0xD800) << 10) + (ui32Low - 0xDC00);
+					}
+					else if ( ui32Code >= 0xDC00 && ui32Code <= 0xDFFF ) { return false; }
+
+					if ( ui32Code < 0x80 ) {
+						_sResult.push_back( char( ui32Code ) );
+					}
+					else if ( ui32Code < 0x800 ) {
+						_sResult.push_back( char( 0xC0 | (ui32Code >> 6) ) );
+						_sResult.push_back( char( 0x80 | (ui32Code & 0x3F) ) );
+					}
+					else if ( ui32Code < 0x10000 ) {
+						_sResult.push_back( char( 0xE0 | (ui32Code >> 12) ) );
+						_sResult.push_back( char( 0x80 | ((ui32Code >> 6) & 0x3F) ) );
+						_sResult.push_back( char( 0x80 | (ui32Code & 0x3F) ) );
+					}
+					else {
+						_sResult.push_back( char( 0xF0 | (ui32Code >> 18) ) );
+						_sResult.push_back( char( 0x80 | ((ui32Code >> 12) & 0x3F) ) );
+						_sResult.push_back( char( 0x80 | ((ui32Code >> 6) & 0x3F) ) );
+						_sResult.push_back( char( 0x80 | (ui32Code & 0x3F) ) );
+					}
+					break;
+				}
+				default : { return false; }
+			}
+		}
+		return true;
+	}
+
+}	// namespace lson
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace lson {
+
+	/**
+	 * Class CJsonReader
+	 * \brief A streaming (pull or SAX) JSON reader.
+	 *
+	 * Description: A streaming JSON reader that does not build a DOM.  SetJson() first classifies the input in 64-byte blocks (SIMD where
+	 *	available) to find every structural character, quote, and the start of every number or literal outside of strings.  Next() then
+	 *	walks those positions, returning one token at a time, and Parse() forwards the same tokens to a CHandler.
+	 *
+	 * Strings without escapes are returned as views into the input; escaped strings are decoded into a scratch buffer that is valid until
+	 *	the next call to Next().  The input must stay valid for as long as the reader is used.
+	 */
+	class CJsonReader {
+	public :
+		CJsonReader();
+
+
+		// == Enumerations.
+		/** Token types. */
+		enum LSON_TOKEN_TYPE {
+			LSON_TT_START_OBJECT,																/**< "{". */
+			LSON_TT_END_OBJECT,																	/**< "}". */
+			LSON_TT_START_ARRAY,																/**< "[". */
+			LSON_TT_END_ARRAY,																	/**< "]". */
+			LSON_TT_KEY,																		/**< An object member name.  The value follows. */
+			LSON_TT_STRING,																		/**< A string value. */
+			LSON_TT_NUMBER,																		/**< A number value. */
+			LSON_TT_TRUE,																		/**< "true". */
+			LSON_TT_FALSE,																		/**< "false". */
+			LSON_TT_NULL,																		/**< "null". */
+		};
+
+
+		// == Types.
+		/** A token. */
+		struct LSON_TOKEN {
+			LSON_TOKEN_TYPE								ttType;									/**< The type of the token. */
+			std::string_view							svString;								/**< The text if ttType is LSON_TT_KEY or LSON_TT_STRING. */
+			double										dNumber;								/**< The value if ttType is LSON_TT_NUMBER. */
+		};
+
+		/** Receives the tokens of Parse().  Return false from any function to stop parsing. */
+		class CHandler {
+		public :
+			virtual ~CHandler() {}
+
+
+			// == Functions.
+			/** Called on "{". */
+			virtual bool								StartObject() { return true; }
+
+			/** Called on "}". */
+			virtual bool								EndObject() { return true; }
+
+			/** Called on "[". */
+			virtual bool								StartArray() { return true; }
+
+			/** Called on "]". */
+			virtual bool								EndArray() { return true; }
+
+			/**
+			 * Called on an object member name.
+			 *
+			 * \param _svKey The name, valid only for the duration of the call.
+			 */
+			virtual bool								Key( std::string_view /*_svKey*/ ) { return true; }
+
+			/**
+			 * Called on a string value.
+			 *
+			 * \param _svString The string, valid only for the duration of the call.
+			 */
+			virtual bool								String( std::string_view /*_svString*/ ) { return true; }
+
+			/**
+			 * Called on a number value.
+			 *
+			 * \param _dNumber The number.
+			 */
+			virtual bool								Number( double /*_dNumber*/ ) { return true; }
+
+			/**
+			 * Called on "true" or "false".
+			 *
+			 * \param _bValue The value.
+			 */
+			virtual bool								Bool( bool /*_bValue*/ ) { return true; }
+
+			/** Called on "null". */
+			virtual bool								Null() { return true; }
+		};
+
+
+		// == Functions.
+		/**
+		 * Sets the JSON data to read and scans it for structural characters.  Reading starts at the first token.
+		 *
+		 * \param _pcJson The JSON data.  Need not be NULL-terminated.
+		 * \param _sLen The number of bytes to which _pcJson points.
+		 * \return Returns false if the data is too large, contains an unterminated string, or memory could not be allocated.
+		 */
+		bool											SetJson( const char * _pcJson, size_t _sLen );
+
+		/**
+		 * Reads the next token.
+		 *
+		 * \param _tToken Holds the token upon success.
+		 * \return Returns true if a token was read.  Returns false at the end of the data or on a syntax error (see Error()).
+		 */
+		bool											Next( LSON_TOKEN &_tToken );
+
+		/**
+		 * Skips the next value (including all of its members if it is an object or array).  Call after reading a key or inside an array.
+		 *
+		 * \return Returns true if a value was skipped.
+		 */
+		bool											Skip();
+
+		/**
+		 * Reads every token, passing each to a handler.
+		 *
+		 * \param _hHandler The handler to receive the tokens.
+		 * \return Returns true if the whole document was read without error and the handler did not stop it.
+		 */
+		bool											Parse( CHandler &_hHandler );
+
+		/**
+		 * Determines whether a syntax error was found.
+		 *
+		 * \return Returns true if a syntax error was found.
+		 */
+		inline bool										Error() const { return m_bError; }
+
+		/**
+		 * Gets the byte offset at which the last token started (or at which the error was found).
+		 *
+		 * \return Returns the byte offset of the last token.
+		 */
+		inline size_t									Offset() const { return m_sOffset; }
+
+		/**
+		 * Gets the current nesting depth.
+		 *
+		 * \return Returns the number of objects and arrays that are open.
+		 */
+		inline size_t									Depth() const { return m_vStack.size(); }
+
+
+	protected :
+		// == Enumerations.
+		/** What the reader expects next. */
+		enum LSON_STATE : uint8_t {
+			LSON_S_VALUE,																		/**< A value. */
+			LSON_S_VALUE_OR_END,																/**< A value or "]" (just after "["). */
+			LSON_S_KEY,																			/**< A key (after "," in an object). */
+			LSON_S_KEY_OR_END,																	/**< A key or "}" (just after "{"). */
+			LSON_S_COMMA_OR_END,																/**< "," or the end of the current object or array. */
+			LSON_S_DONE,																		/**< The root value has been read. */
+		};
+
+
+		// == Members.
+		/** The JSON data. */
+		const char *									m_pcJson;
+		/** The size of the JSON data. */
+		size_t											m_sLen;
+		/** The offsets of every structural character, quote, and number/literal start, in order. */
+		std::vector<uint32_t>							m_vIndices;
+		/** The next index into m_vIndices. */
+		size_t											m_sPos;
+		/** The stack of open containers ("{" or "["). */
+		std::vector<char>								m_vStack;
+		/** Decoded escaped strings. */
+		std::string										m_sScratch;
+		/** The byte offset of the last token. */
+		size_t											m_sOffset;
+		/** What the reader expects next. */
+		LSON_STATE										m_sState;
+		/** Set when a syntax error is found. */
+		bool											m_bError;
+
+
+		// == Functions.
+		/**
+		 * Sets the error flag at the given offset.
+		 *
+		 * \param _sOffset The byte offset of the error.
+		 * \return Returns false.
+		 */
+		bool											Fail( size_t _sOffset );
+
+		/**
+		 * Reads a value starting at the current index.
+		 *
+		 * \param _tToken Holds the token upon success.
+		 * \return Returns true if the value was read.
+		 */
+		bool											ReadValue( LSON_TOKEN &_tToken );
+
+		/**
+		 * Reads a string starting at the opening quote at the current index.
+		 *
+		 * \param _svString Holds the string upon success.
+		 * \return Returns true if the string was read.
+		 */
+		bool											ReadString( std::string_view &_svString );
+
+		/**
+		 * Reads a number or literal starting at the current index.
+		 *
+		 * \param _tToken Holds the token upon success.
+		 * \return Returns true if the number or literal was read.
+		 */
+		bool											ReadScalar( LSON_TOKEN &_tToken );
+
+		/**
+		 * Gets the state that follows a completed value.
+		 *
+		 * \return Returns LSON_S_DONE at the root or LSON_S_COMMA_OR_END inside an object or array.
+		 */
+		inline LSON_STATE								AfterValue() const { return m_vStack.empty() ? LSON_S_DONE : LSON_S_COMMA_OR_END; }
+
+		/**
+		 * Finds the offsets of every structural character, unescaped quote, and number/literal start outside of strings.
+		 *
+		 * \param _pcJson The JSON data.
+		 * \param _sLen The number of bytes to which _pcJson points.
+		 * \param _vIndices Holds the offsets.
+		 * \return Returns false if a string is not terminated.
+		 */
+		static bool										ScanStructurals( const char * _pcJson, size_t _sLen, std::vector<uint32_t> &_vIndices );
+
+		/**
+		 * Classifies 64 bytes.  Bit N of each mask corresponds to byte N.
+		 *
+		 * \param _pui8Block The 64 bytes to classify.
+		 * \param _ui64Quotes Holds the mask of '"' characters.
+		 * \param _ui64Backslashes Holds the mask of '\' characters.
+		 * \param _ui64Ops Holds the mask of '{', '}', '[', ']', ':', and ',' characters.
+		 * \param _ui64Spaces Holds the mask of ' ', '\t', '\r', and '\n' characters.
+		 */
+		static void										ClassifyBlock( const uint8_t * _pui8Block, uint64_t &_ui64Quotes, uint64_t &_ui64Backslashes, uint64_t &_ui64Ops, uint64_t &_ui64Spaces );
+
+		/**
+		 * Decodes a string containing escapes.
+		 *
+		 * \param _pcStart The first character after the opening quote.
+		 * \param _pcEnd The closing quote.
+		 * \param _sResult Holds the decoded UTF-8 string.
+		 * \return Returns false if an escape is invalid.
+		 */
+		static bool										Unescape( const char * _pcStart, const char * _pcEnd, std::string &_sResult );
+	};
+
+}	// namespace lson
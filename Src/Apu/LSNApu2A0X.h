@@ -481,8 +481,15 @@ namespace lsn {
 				}
 
 				if LSN_UNLIKELY( m_pwfRawStream ) {
+					if LSN_UNLIKELY( m_bRegModified ) {
+						// Samples before this one are tested against the registers as they were before the write.
+						m_pwfRawStream->ConditionMemoryChanged();
+					}
 					m_pwfRawStream->AddStreamSample( fFinal );
 				}
+				if LSN_UNLIKELY( m_pwfOutStream && m_bRegModified ) {
+					m_pwfOutStream->ConditionMemoryChanged();
+				}
 
 				fFinal = float( m_pfLpf.Process( fFinal ) );
 				{
@@ -492,9 +499,10 @@ namespace lsn {
 				}
 
 				CAudio::AddSample( fFinal );
+				// Only cleared once the streams have been told, so a change made while audio is disabled is not lost.
+				m_bRegModified = false;
 			}
 
-			m_bRegModified = false;
 			++m_ui64Cycles;
 		}
 
@@ -520,7 +528,8 @@ namespace lsn {
 				m_dvRegisters3_4017.SetValue( m_ui8Last4017 | 0b01000000 );
 			}
 
-			m_bRegModified = false;
+			// The registers were reset.
+			m_bRegModified = true;
 
 			m_ChannelOutputtingStatus[LSN_C_PULSE_0] = m_pPulse1.ProducingSound( LSN_PULSE1_ENABLED( this ) );
 			m_ChannelOutputtingStatus[LSN_C_PULSE_1] = m_pPulse1.ProducingSound( LSN_PULSE2_ENABLED( this ) );
@@ -680,7 +689,9 @@ namespace lsn {
 		 * \param _pfStream The pointer to set for streaming the raw signal to a file.
 		 **/
 		inline void										SetRawStream( CWavFile * _pfStream ) {
+			if ( m_pwfRawStream && m_pwfRawStream != _pfStream ) { m_pwfRawStream->SetConditionMemory( nullptr, 0, 0 ); }
 			m_pwfRawStream = _pfStream;
+			if ( m_pwfRawStream ) { m_pwfRawStream->SetConditionMemory( m_ui8Registers, 0x4000, sizeof( m_ui8Registers ) ); }
 		}
 
 		/**
@@ -689,14 +700,17 @@ namespace lsn {
 		 * \param _pfStream The pointer to set for streaming the output signal to a file.
 		 **/
 		inline void										SetOutStream( CWavFile * _pfStream ) {
+			if ( m_pwfOutStream && m_pwfOutStream != _pfStream ) { m_pwfOutStream->SetConditionMemory( nullptr, 0, 0 ); }
 			m_pwfOutStream = _pfStream;
+			if ( m_pwfOutStream ) { m_pwfOutStream->SetConditionMemory( m_ui8Registers, 0x4000, sizeof( m_ui8Registers ) ); }
 		}
 
 		/**
 		 * Sets as inactive (another system is being played).
 		 **/
 		virtual void									SetAsInactive() {
-			m_pwfOutStream = m_pwfRawStream = nullptr;
+			SetRawStream( nullptr );
+			SetOutStream( nullptr );
 		}
 
 		/**
@@ -1007,7 +1021,7 @@ namespace lsn {
 		bool											m_bModeSwitch;
 		/** Audio setting: Enabled. */
 		bool											m_bEnabled = true;
-		/** Register was written this cycle. */
+		/** Set by anything that changes m_ui8Registers, cleared once the condition streams have been told. */
 		bool											m_bRegModified = false;
 		/** The old letterless buggy RP2A03 version. */
 		bool											m_bLetterless = false;
@@ -1862,6 +1876,7 @@ namespace lsn {
 			else {
 				paApu->m_ui8Registers[_uReg] &= ~_ui8Flag;
 			}
+			paApu->m_bRegModified = true;
 		}
 	};
 	
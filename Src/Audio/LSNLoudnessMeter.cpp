@@ -0,0 +1,402 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Incremental loudness analysis of a single channel: ITU-R BS.1770/EBU R128 K-weighted gated loudness, 4x-oversampled
+ *	true peak, sample peak, and the DC mean needed by the gated-RMS evaluation.
+ */
+
+
+#include "LSNLoudnessMeter.h"
+#include "../Utilities/LSNUtilities.h"
+
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numbers>
+#include <thread>
+
+#if defined( __AVX__ ) || defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_AMD64 )
+#include <immintrin.h>
+#define LSN_LOUDNESS_SSE2
+#endif	// #if defined( __AVX__ ) || defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_AMD64 )
+
+
+namespace lsn {
+
+	// == Members.
+	/** The BS.1770-4 Annex 2 interpolation filter, one row per phase. */
+	const double CLoudnessMeter::m_dTpFilter[LSN_TP_PHASES][LSN_TP_TAPS] = {
+		{ 0.0017089843750, 0.0109863281250, -0.0196533203125, 0.0332031250000, -0.0594482421875, 0.1373291015625,
+			0.9721679687500, -0.1022949218750, 0.0476074218750, -0.0266113281250, 0.0148925781250, -0.0083007812500 },
+		{ -0.0291748046875, 0.0292968750000, -0.0517578125000, 0.0891113281250, -0.1665039062500, 0.4650878906250,
+			0.7797851562500, -0.2003173828125, 0.1015625000000, -0.0582275390625, 0.0330810546875, -0.0189208984375 },
+		{ -0.0189208984375, 0.0330810546875, -0.0582275390625, 0.1015625000000, -0.2003173828125, 0.7797851562500,
+			0.4650878906250, -0.1665039062500, 0.0891113281250, -0.0517578125000, 0.0292968750000, -0.0291748046875 },
+		{ -0.0083007812500, 0.0148925781250, -0.0266113281250, 0.0476074218750, -0.1022949218750, 0.9721679687500,
+			0.1373291015625, -0.0594482421875, 0.0332031250000, -0.0196533203125, 0.0109863281250, 0.0017089843750 },
+	};
+
+	CLoudnessMeter::CLoudnessMeter() {
+		Reset( 48000.0 );
+	}
+
+	// == Functions.
+	/**
+	 * Resets the meter for a new signal.
+	 *
+	 * \param _dHz The sample rate.
+	 */
+	void CLoudnessMeter::Reset( double _dHz ) {
+		// K-weighting: the BS.1770 pre-filter (high shelf) followed by the RLB high-pass, re-derived for the sample rate.
+		{
+			constexpr double dF0 = 1681.974450955533;
+			constexpr double dG = 3.999843853973347;
+			constexpr double dQ = 0.7071752369554196;
+			double dK = std::tan( std::numbers::pi * dF0 / _dHz );
+			double dVh = std::pow( 10.0, dG / 20.0 );
+			double dVb = std::pow( dVh, 0.4996667741545416 );
+			double dA0 = 1.0 + dK / dQ + dK * dK;
+			m_dKb[0][0] = (dVh + dVb * dK / dQ + dK * dK) / dA0;
+			m_dKb[0][1] = 2.0 * (dK * dK - dVh) / dA0;
+			m_dKb[0][2] = (dVh - dVb * dK / dQ + dK * dK) / dA0;
+			m_dKa[0][0] = 2.0 * (dK * dK - 1.0) / dA0;
+			m_dKa[0][1] = (1.0 - dK / dQ + dK * dK) / dA0;
+		}
+		{
+			constexpr double dF0 = 38.13547087602444;
+			constexpr double dQ = 0.5003270373238773;
+			double dK = std::tan( std::numbers::pi * dF0 / _dHz );
+			double dA0 = 1.0 + dK / dQ + dK * dK;
+			m_dKb[1][0] = 1.0;
+			m_dKb[1][1] = -2.0;
+			m_dKb[1][2] = 1.0;
+			m_dKa[1][0] = 2.0 * (dK * dK - 1.0) / dA0;
+			m_dKa[1][1] = (1.0 - dK / dQ + dK * dK) / dA0;
+		}
+		std::memset( m_dKz, 0, sizeof( m_dKz ) );
+		std::memset( m_dHistory, 0, sizeof( m_dHistory ) );
+		m_vSubBlocks.clear();
+		m_dSubBlockSum = 0.0;
+		m_sSubBlockLen = std::max<size_t>( size_t( std::round( _dHz * 0.1 ) ), 1 );
+		m_sSubBlockPos = 0;
+		m_dSamplePeak = 0.0;
+		m_dTruePeak = 0.0;
+		m_dSum = 0.0;
+		m_ui64Samples = 0;
+	}
+
+	/**
+	 * Adds samples to the analysis.
+	 *
+	 * \param _pdSamples The samples.
+	 * \param _sTotal The number of samples.
+	 * \return Returns false if memory could not be allocated.
+	 */
+	bool CLoudnessMeter::Process( const double * _pdSamples, size_t _sTotal ) {
+		if ( !_sTotal ) { return true; }
+		try {
+			constexpr size_t sHist = LSN_TP_TAPS - 1;
+			// The first samples need the previous call's history, so they go through a small joined buffer.
+			{
+				double dHead[sHist*2];
+				size_t sHead = std::min( _sTotal, sHist );
+				std::memcpy( dHead, m_dHistory, sizeof( m_dHistory ) );
+				std::memcpy( dHead + sHist, _pdSamples, sHead * sizeof( double ) );
+				LSN_PEAKS pPeaks;
+				PeakRange( dHead, sHist, sHist + sHead, pPeaks );
+				m_dSamplePeak = std::max( m_dSamplePeak, pPeaks.dSamplePeak );
+				m_dTruePeak = std::max( m_dTruePeak, pPeaks.dTruePeak );
+				m_dSum += pPeaks.dSum;
+				// Update the history for the next call.
+				std::memcpy( m_dHistory, dHead + sHead, sizeof( m_dHistory ) );
+			}
+			if ( _sTotal > sHist ) {
+				std::memcpy( m_dHistory, _pdSamples + _sTotal - sHist, sizeof( m_dHistory ) );
+
+				// The rest is split across threads while this thread runs the (serial) K-weighting filters.
+				size_t sRemaining = _sTotal - sHist;
+				size_t sThreads = std::min<size_t>( sRemaining / LSN_LOUDNESS_PARALLEL_MIN, std::thread::hardware_concurrency() );
+				std::vector<LSN_PEAKS> vPeaks( std::max<size_t>( sThreads, 1 ) );
+				std::vector<std::thread> vThreads;
+				if ( sThreads ) {
+					size_t sPer = (sRemaining + sThreads - 1) / sThreads;
+					try {
+						vThreads.reserve( sThreads );
+						for ( size_t I = 0; I < sThreads; ++I ) {
+							size_t sStart = sHist + std::min( I * sPer, sRemaining );
+							size_t sEnd = sHist + std::min( (I + 1) * sPer, sRemaining );
+							vThreads.emplace_back( &CLoudnessMeter::PeakRange, _pdSamples, sStart, sEnd, std::ref( vPeaks[I] ) );
+						}
+					}
+					catch ( ... ) {
+						// Whatever could not be handed to a thread runs here after the K-weighting.
+					}
+				}
+				KWeight( _pdSamples, _sTotal );
+				if ( !sThreads ) {
+					PeakRange( _pdSamples, sHist, _sTotal, vPeaks[0] );
+				}
+				else {
+					size_t sPer = (sRemaining + sThreads - 1) / sThreads;
+					for ( size_t I = vThreads.size(); I < sThreads; ++I ) {
+						PeakRange( _pdSamples, sHist + std::min( I * sPer, sRemaining ), sHist + std::min( (I + 1) * sPer, sRemaining ), vPeaks[I] );
+					}
+				}
+				for ( auto & tThis : vThreads ) { tThis.join(); }
+				for ( const auto & pThis : vPeaks ) {
+					m_dSamplePeak = std::max( m_dSamplePeak, pThis.dSamplePeak );
+					m_dTruePeak = std::max( m_dTruePeak, pThis.dTruePeak );
+					m_dSum += pThis.dSum;
+				}
+			}
+			else {
+				KWeight( _pdSamples, _sTotal );
+			}
+			m_ui64Samples += _sTotal;
+			return true;
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * Gets the integrated (gated) loudness of a program made of several channels.  All channel weights are 1 (no surround
+	 *	channels).
+	 *
+	 * \param _plmChannels The meters for the channels, all reset with the same sample rate.
+	 * \param _sTotal The number of channels.
+	 * \return Returns the integrated loudness in LUFS, or -infinity if every block is below the absolute gate.
+	 */
+	double CLoudnessMeter::IntegratedLoudness( const CLoudnessMeter * _plmChannels, size_t _sTotal ) {
+		constexpr double dNegInf = -std::numeric_limits<double>::infinity();
+		if ( !_sTotal ) { return dNegInf; }
+		size_t sSubBlocks = _plmChannels[0].m_vSubBlocks.size();
+		for ( size_t I = 1; I < _sTotal; ++I ) { sSubBlocks = std::min( sSubBlocks, _plmChannels[I].m_vSubBlocks.size() ); }
+		// Gating blocks are 400 milliseconds (4 sub-blocks) with 75% overlap.
+		if ( sSubBlocks < 4 ) { return dNegInf; }
+		size_t sBlocks = sSubBlocks - 3;
+		double dBlockLen = double( _plmChannels[0].m_sSubBlockLen * 4 );
+
+		auto Loudness = []( double _dPower ) { return -0.691 + 10.0 * std::log10( _dPower ); };
+		auto BlockPower = [&]( size_t _sBlock ) {
+			double dPower = 0.0;
+			for ( size_t C = 0; C < _sTotal; ++C ) {
+				const auto & vSub = _plmChannels[C].m_vSubBlocks;
+				dPower += (vSub[_sBlock] + vSub[_sBlock+1] + vSub[_sBlock+2] + vSub[_sBlock+3]) / dBlockLen;
+			}
+			return dPower;
+		};
+
+		// Absolute gate at -70 LUFS.
+		double dSum = 0.0;
+		size_t sCount = 0;
+		for ( size_t I = 0; I < sBlocks; ++I ) {
+			double dPower = BlockPower( I );
+			if ( dPower > 0.0 && Loudness( dPower ) > -70.0 ) {
+				dSum += dPower;
+				++sCount;
+			}
+		}
+		if ( !sCount ) { return dNegInf; }
+
+		// Relative gate 10 LU below the absolute-gated loudness.
+		double dRelGate = Loudness( dSum / double( sCount ) ) - 10.0;
+		dSum = 0.0;
+		sCount = 0;
+		for ( size_t I = 0; I < sBlocks; ++I ) {
+			double dPower = BlockPower( I );
+			if ( dPower > 0.0 ) {
+				double dLoud = Loudness( dPower );
+				if ( dLoud > -70.0 && dLoud > dRelGate ) {
+					dSum += dPower;
+					++sCount;
+				}
+			}
+		}
+		if ( !sCount ) { return dNegInf; }
+		return Loudness( dSum / double( sCount ) );
+	}
+
+	/**
+	 * Accumulates the squares of the centered samples that lie at least a given distance from the mean.
+	 *
+	 * \param _pdSamples The samples.
+	 * \param _sTotal The number of samples.
+	 * \param _dMean The mean of the whole signal.
+	 * \param _dThreshold The absolute amplitude gate; samples with |x - _dMean| < _dThreshold are ignored.
+	 * \param _dSumSq Accumulates the sum of the squared centered samples that pass the gate.
+	 * \param _ui64Count Accumulates the number of samples that pass the gate.
+	 */
+	void CLoudnessMeter::AccumulateRmsGated( const double * _pdSamples, size_t _sTotal, double _dMean, double _dThreshold,
+		double &_dSumSq, uint64_t &_ui64Count ) {
+		size_t I = 0;
+#ifdef __AVX__
+		if LSN_LIKELY( CUtilities::IsAvxSupported() ) {
+			__m256d mMean = _mm256_set1_pd( _dMean );
+			__m256d mThresh = _mm256_set1_pd( _dThreshold );
+			__m256d mSign = _mm256_set1_pd( -0.0 );
+			__m256d mOne = _mm256_set1_pd( 1.0 );
+			__m256d mSum = _mm256_setzero_pd();
+			__m256d mCount = _mm256_setzero_pd();
+			for ( ; I + 4 <= _sTotal; I += 4 ) {
+				__m256d mCentered = _mm256_sub_pd( _mm256_loadu_pd( _pdSamples + I ), mMean );
+				__m256d mPass = _mm256_cmp_pd( _mm256_andnot_pd( mSign, mCentered ), mThresh, _CMP_GE_OQ );
+				mSum = _mm256_add_pd( mSum, _mm256_and_pd( mPass, _mm256_mul_pd( mCentered, mCentered ) ) );
+				mCount = _mm256_add_pd( mCount, _mm256_and_pd( mPass, mOne ) );
+			}
+			alignas( 32 ) double dSum[4], dCount[4];
+			_mm256_store_pd( dSum, mSum );
+			_mm256_store_pd( dCount, mCount );
+			_dSumSq += (dSum[0] + dSum[1]) + (dSum[2] + dSum[3]);
+			_ui64Count += uint64_t( (dCount[0] + dCount[1]) + (dCount[2] + dCount[3]) );
+		}
+#endif	// #ifdef __AVX__
+
+#ifdef LSN_LOUDNESS_SSE2
+		{
+			__m128d mMean = _mm_set1_pd( _dMean );
+			__m128d mThresh = _mm_set1_pd( _dThreshold );
+			__m128d mSign = _mm_set1_pd( -0.0 );
+			__m128d mOne = _mm_set1_pd( 1.0 );
+			__m128d mSum = _mm_setzero_pd();
+			__m128d mCount = _mm_setzero_pd();
+			for ( ; I + 2 <= _sTotal; I += 2 ) {
+				__m128d mCentered = _mm_sub_pd( _mm_loadu_pd( _pdSamples + I ), mMean );
+				__m128d mPass = _mm_cmpge_pd( _mm_andnot_pd( mSign, mCentered ), mThresh );
+				mSum = _mm_add_pd( mSum, _mm_and_pd( mPass, _mm_mul_pd( mCentered, mCentered ) ) );
+				mCount = _mm_add_pd( mCount, _mm_and_pd( mPass, mOne ) );
+			}
+			alignas( 16 ) double dSum[2], dCount[2];
+			_mm_store_pd( dSum, mSum );
+			_mm_store_pd( dCount, mCount );
+			_dSumSq += dSum[0] + dSum[1];
+			_ui64Count += uint64_t( dCount[0] + dCount[1] );
+		}
+#endif	// #ifdef LSN_LOUDNESS_SSE2
+		for ( ; I < _sTotal; ++I ) {
+			double dCentered = _pdSamples[I] - _dMean;
+			if ( std::abs( dCentered ) >= _dThreshold ) {
+				_dSumSq += dCentered * dCentered;
+				++_ui64Count;
+			}
+		}
+	}
+
+	/**
+	 * Runs the K-weighting filters and fills the 100-millisecond sub-blocks.
+	 *
+	 * \param _pdSamples The samples.
+	 * \param _sTotal The number of samples.
+	 */
+	void CLoudnessMeter::KWeight( const double * _pdSamples, size_t _sTotal ) {
+		// Locals keep the recursive filters in registers.
+		double dZ00 = m_dKz[0][0], dZ01 = m_dKz[0][1], dZ10 = m_dKz[1][0], dZ11 = m_dKz[1][1];
+		const double dB00 = m_dKb[0][0], dB01 = m_dKb[0][1], dB02 = m_dKb[0][2], dA00 = m_dKa[0][0], dA01 = m_dKa[0][1];
+		const double dB10 = m_dKb[1][0], dB11 = m_dKb[1][1], dB12 = m_dKb[1][2], dA10 = m_dKa[1][0], dA11 = m_dKa[1][1];
+		double dSubSum = m_dSubBlockSum;
+		size_t sPos = m_sSubBlockPos;
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			double dIn = _pdSamples[I];
+			double dY0 = dB00 * dIn + dZ00;
+			dZ00 = dB01 * dIn - dA00 * dY0 + dZ01;
+			dZ01 = dB02 * dIn - dA01 * dY0;
+			double dY1 = dB10 * dY0 + dZ10;
+			dZ10 = dB11 * dY0 - dA10 * dY1 + dZ11;
+			dZ11 = dB12 * dY0 - dA11 * dY1;
+			dSubSum += dY1 * dY1;
+			if ( ++sPos == m_sSubBlockLen ) {
+				m_vSubBlocks.push_back( dSubSum );
+				dSubSum = 0.0;
+				sPos = 0;
+			}
+		}
+		m_dKz[0][0] = dZ00; m_dKz[0][1] = dZ01; m_dKz[1][0] = dZ10; m_dKz[1][1] = dZ11;
+		m_dSubBlockSum = dSubSum;
+		m_sSubBlockPos = sPos;
+	}
+
+	/**
+	 * Finds the sample peak, oversampled peak, and sum over a range whose every sample has LSN_TP_TAPS-1 samples before it in
+	 *	the same buffer.
+	 *
+	 * \param _pdSamples The buffer.
+	 * \param _sStart The first sample to analyze.  Must be at least LSN_TP_TAPS-1.
+	 * \param _sEnd One past the last sample to analyze.
+	 * \param _pPeaks Receives the results.
+	 */
+	void CLoudnessMeter::PeakRange( const double * _pdSamples, size_t _sStart, size_t _sEnd, LSN_PEAKS &_pPeaks ) {
+		size_t I = _sStart;
+		double dPeak = 0.0, dTrue = 0.0, dSum = 0.0;
+#ifdef __AVX__
+		if LSN_LIKELY( CUtilities::IsAvxSupported() ) {
+			// 4 output positions at a time; each tap is broadcast and multiplied against 4 neighboring inputs.
+			__m256d mSign = _mm256_set1_pd( -0.0 );
+			__m256d mPeak = _mm256_setzero_pd(), mTrue = _mm256_setzero_pd(), mSum = _mm256_setzero_pd();
+			for ( ; I + 4 <= _sEnd; I += 4 ) {
+				__m256d mX = _mm256_loadu_pd( _pdSamples + I );
+				mPeak = _mm256_max_pd( mPeak, _mm256_andnot_pd( mSign, mX ) );
+				mSum = _mm256_add_pd( mSum, mX );
+				for ( size_t P = 0; P < LSN_TP_PHASES; ++P ) {
+					__m256d mAcc = _mm256_setzero_pd();
+					for ( size_t K = 0; K < LSN_TP_TAPS; ++K ) {
+						mAcc = _mm256_add_pd( mAcc, _mm256_mul_pd( _mm256_set1_pd( m_dTpFilter[P][K] ), _mm256_loadu_pd( _pdSamples + I - K ) ) );
+					}
+					mTrue = _mm256_max_pd( mTrue, _mm256_andnot_pd( mSign, mAcc ) );
+				}
+			}
+			alignas( 32 ) double dTmp[3][4];
+			_mm256_store_pd( dTmp[0], mPeak );
+			_mm256_store_pd( dTmp[1], mTrue );
+			_mm256_store_pd( dTmp[2], mSum );
+			for ( size_t J = 0; J < 4; ++J ) {
+				dPeak = std::max( dPeak, dTmp[0][J] );
+				dTrue = std::max( dTrue, dTmp[1][J] );
+				dSum += dTmp[2][J];
+			}
+		}
+#endif	// #ifdef __AVX__
+
+#ifdef LSN_LOUDNESS_SSE2
+		{
+			__m128d mSign = _mm_set1_pd( -0.0 );
+			__m128d mPeak = _mm_setzero_pd(), mTrue = _mm_setzero_pd(), mSum = _mm_setzero_pd();
+			for ( ; I + 2 <= _sEnd; I += 2 ) {
+				__m128d mX = _mm_loadu_pd( _pdSamples + I );
+				mPeak = _mm_max_pd( mPeak, _mm_andnot_pd( mSign, mX ) );
+				mSum = _mm_add_pd( mSum, mX );
+				for ( size_t P = 0; P < LSN_TP_PHASES; ++P ) {
+					__m128d mAcc = _mm_setzero_pd();
+					for ( size_t K = 0; K < LSN_TP_TAPS; ++K ) {
+						mAcc = _mm_add_pd( mAcc, _mm_mul_pd( _mm_set1_pd( m_dTpFilter[P][K] ), _mm_loadu_pd( _pdSamples + I - K ) ) );
+					}
+					mTrue = _mm_max_pd( mTrue, _mm_andnot_pd( mSign, mAcc ) );
+				}
+			}
+			alignas( 16 ) double dTmp[3][2];
+			_mm_store_pd( dTmp[0], mPeak );
+			_mm_store_pd( dTmp[1], mTrue );
+			_mm_store_pd( dTmp[2], mSum );
+			dPeak = std::max( dPeak, std::max( dTmp[0][0], dTmp[0][1] ) );
+			dTrue = std::max( dTrue, std::max( dTmp[1][0], dTmp[1][1] ) );
+			dSum += dTmp[2][0] + dTmp[2][1];
+		}
+#endif	// #ifdef LSN_LOUDNESS_SSE2
+		for ( ; I < _sEnd; ++I ) {
+			double dX = _pdSamples[I];
+			dPeak = std::max( dPeak, std::abs( dX ) );
+			dSum += dX;
+			for ( size_t P = 0; P < LSN_TP_PHASES; ++P ) {
+				double dAcc = 0.0;
+				for ( size_t K = 0; K < LSN_TP_TAPS; ++K ) {
+					dAcc += m_dTpFilter[P][K] * _pdSamples[I-K];
+				}
+				dTrue = std::max( dTrue, std::abs( dAcc ) );
+			}
+		}
+		_pPeaks.dSamplePeak = std::max( _pPeaks.dSamplePeak, dPeak );
+		_pPeaks.dTruePeak = std::max( _pPeaks.dTruePeak, dTrue );
+		_pPeaks.dSum += dSum;
+	}
+
+}	// namespace lsn
@@ -0,0 +1,197 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Incremental loudness analysis of a single channel: ITU-R BS.1770/EBU R128 K-weighted gated loudness, 4x-oversampled
+ *	true peak, sample peak, and the DC mean needed by the gated-RMS evaluation.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+#ifndef LSN_LOUDNESS_PARALLEL_MIN
+/** The number of samples a call to CLoudnessMeter::Process() must have before the peak analysis is split across threads. */
+#define LSN_LOUDNESS_PARALLEL_MIN				(1 << 16)
+#endif	// #ifndef LSN_LOUDNESS_PARALLEL_MIN
+
+
+namespace lsn {
+
+	/**
+	 * Class CLoudnessMeter
+	 * \brief Incremental loudness analysis of a single channel.
+	 *
+	 * Description: Incremental loudness analysis of a single channel.  Samples are fed in blocks as they are produced, so the
+	 *	measurements are ready as soon as the last stage that touches the samples finishes.  The K-weighting filters run on the
+	 *	calling thread while the oversampled true-peak search runs vectorized on worker threads.
+	 */
+	class CLoudnessMeter {
+	public :
+		CLoudnessMeter();
+
+
+		// == Functions.
+		/**
+		 * Resets the meter for a new signal.
+		 *
+		 * \param _dHz The sample rate.
+		 */
+		void									Reset( double _dHz );
+
+		/**
+		 * Adds samples to the analysis.
+		 *
+		 * \param _pdSamples The samples.
+		 * \param _sTotal The number of samples.
+		 * \return Returns false if memory could not be allocated.
+		 */
+		bool									Process( const double * _pdSamples, size_t _sTotal );
+
+		/**
+		 * Gets the largest absolute sample value.
+		 *
+		 * \return Returns the sample peak.
+		 */
+		inline double							SamplePeak() const { return m_dSamplePeak; }
+
+		/**
+		 * Gets the largest absolute value of the 4x-oversampled signal (BS.1770-4 Annex 2).  Never less than SamplePeak().
+		 *
+		 * \return Returns the true peak.
+		 */
+		inline double							TruePeak() const { return std::max( m_dTruePeak, m_dSamplePeak ); }
+
+		/**
+		 * Gets the mean (DC offset) of the samples.
+		 *
+		 * \return Returns the mean of the samples.
+		 */
+		inline double							Mean() const { return m_ui64Samples ? m_dSum / double( m_ui64Samples ) : 0.0; }
+
+		/**
+		 * Gets the number of samples analyzed.
+		 *
+		 * \return Returns the number of samples passed to Process() since the last Reset().
+		 */
+		inline uint64_t							Samples() const { return m_ui64Samples; }
+
+		/**
+		 * Gets the integrated (gated) loudness of this channel alone.
+		 *
+		 * \return Returns the integrated loudness in LUFS, or -infinity if every block is below the absolute gate.
+		 */
+		inline double							IntegratedLoudness() const { return IntegratedLoudness( this, 1 ); }
+
+		/**
+		 * Gets the integrated (gated) loudness of a program made of several channels.  All channel weights are 1 (no surround
+		 *	channels).
+		 *
+		 * \param _plmChannels The meters for the channels, all reset with the same sample rate.
+		 * \param _sTotal The number of channels.
+		 * \return Returns the integrated loudness in LUFS, or -infinity if every block is below the absolute gate.
+		 */
+		static double							IntegratedLoudness( const CLoudnessMeter * _plmChannels, size_t _sTotal );
+
+		/**
+		 * Accumulates the squares of the centered samples that lie at least a given distance from the mean.
+		 *
+		 * \param _pdSamples The samples.
+		 * \param _sTotal The number of samples.
+		 * \param _dMean The mean of the whole signal.
+		 * \param _dThreshold The absolute amplitude gate; samples with |x - _dMean| < _dThreshold are ignored.
+		 * \param _dSumSq Accumulates the sum of the squared centered samples that pass the gate.
+		 * \param _ui64Count Accumulates the number of samples that pass the gate.
+		 */
+		static void								AccumulateRmsGated( const double * _pdSamples, size_t _sTotal, double _dMean, double _dThreshold,
+			double &_dSumSq, uint64_t &_ui64Count );
+
+		/**
+		 * Gets the DC-removed RMS of a signal, ignoring samples within _dThreshold of the mean.  Matches
+		 *	ee::CExpEval::CalcRmsGated() but needs only 1 pass because the mean is already known.
+		 *
+		 * \param _vSamples The samples.
+		 * \param _dMean The mean of the samples (see Mean()).
+		 * \param _dThreshold The absolute amplitude gate.
+		 * \return Returns the gated RMS, or 0.0 if no samples pass the gate.
+		 */
+		template <typename _tType>
+		static double							CalcRmsGated( const _tType &_vSamples, double _dMean, double _dThreshold ) {
+			double dSumSq = 0.0;
+			uint64_t ui64Count = 0;
+			// Copying in blocks lets the gate run vectorized over containers that do not expose contiguous storage.
+			std::vector<double> vBlock( std::min<size_t>( _vSamples.size(), LSN_BLOCK ) );
+			for ( size_t I = 0; I < _vSamples.size(); I += LSN_BLOCK ) {
+				size_t sTotal = std::min<size_t>( LSN_BLOCK, _vSamples.size() - I );
+				for ( size_t J = 0; J < sTotal; ++J ) { vBlock[J] = double( _vSamples[I+J] ); }
+				AccumulateRmsGated( vBlock.data(), sTotal, _dMean, _dThreshold, dSumSq, ui64Count );
+			}
+			return ui64Count ? std::sqrt( dSumSq / double( ui64Count ) ) : 0.0;
+		}
+
+
+	protected :
+		// == Enumerations.
+		enum : size_t {
+			LSN_TP_TAPS							= 12,										/**< Taps per true-peak polyphase branch. */
+			LSN_TP_PHASES						= 4,										/**< True-peak oversampling factor. */
+			LSN_BLOCK							= 1 << 20,									/**< Samples copied at a time by CalcRmsGated(). */
+		};
+
+
+		// == Types.
+		/** Per-range results of the peak analysis. */
+		struct LSN_PEAKS {
+			double								dSamplePeak = 0.0;							/**< Largest absolute sample. */
+			double								dTruePeak = 0.0;							/**< Largest absolute oversampled value. */
+			double								dSum = 0.0;									/**< Sum of the samples. */
+		};
+
+
+		// == Members.
+		double									m_dKb[2][3];								/**< K-weighting feed-forward coefficients (shelf, high-pass). */
+		double									m_dKa[2][2];								/**< K-weighting feedback coefficients (a1, a2). */
+		double									m_dKz[2][2];								/**< K-weighting DF2T state. */
+		double									m_dHistory[LSN_TP_TAPS-1];					/**< The last samples of the previous call, oldest first. */
+		std::vector<double>						m_vSubBlocks;								/**< Sum of squared K-weighted samples in each 100-millisecond sub-block. */
+		double									m_dSubBlockSum;								/**< The sum for the sub-block being filled. */
+		size_t									m_sSubBlockLen;								/**< Samples per sub-block. */
+		size_t									m_sSubBlockPos;								/**< Samples so far in the current sub-block. */
+		double									m_dSamplePeak;								/**< Largest absolute sample. */
+		double									m_dTruePeak;								/**< Largest absolute oversampled value. */
+		double									m_dSum;										/**< Sum of all samples. */
+		uint64_t								m_ui64Samples;								/**< Number of samples analyzed. */
+
+		/** The BS.1770-4 Annex 2 interpolation filter, one row per phase. */
+		static const double						m_dTpFilter[LSN_TP_PHASES][LSN_TP_TAPS];
+
+
+		// == Functions.
+		/**
+		 * Runs the K-weighting filters and fills the 100-millisecond sub-blocks.
+		 *
+		 * \param _pdSamples The samples.
+		 * \param _sTotal The number of samples.
+		 */
+		void									KWeight( const double * _pdSamples, size_t _sTotal );
+
+		/**
+		 * Finds the sample peak, oversampled peak, and sum over a range whose every sample has LSN_TP_TAPS-1 samples before it in
+		 *	the same buffer.
+		 *
+		 * \param _pdSamples The buffer.
+		 * \param _sStart The first sample to analyze.  Must be at least LSN_TP_TAPS-1.
+		 * \param _sEnd One past the last sample to analyze.
+		 * \param _pPeaks Receives the results.
+		 */
+		static void								PeakRange( const double * _pdSamples, size_t _sStart, size_t _sEnd, LSN_PEAKS &_pPeaks );
+	};
+
+}	// namespace lsn
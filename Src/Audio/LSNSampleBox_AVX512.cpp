@@ -0,0 +1,400 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX-512 versions of the CSampleBox kernels.  Built without depending on the project-wide instruction set
+ *	so that CSampleBox::SetFeatureSet() can select them at run-time.
+ */
+
+#include "LSNSampleBox.h"
+
+#ifdef LSN_SAMPLE_BOX_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Convolves the given weights with the given samples.  Neither the weights nor the samples need be aligned.
+	 *
+	 * \param _pfWeights The pointer to the 16 weights.
+	 * \param _pfSamples Pointer to the samples to convolve.
+	 * \param _mSum Maintains the sum of convolution over many iterations.
+	 **/
+	static inline LSN_SAMPLE_BOX_TARGET( "avx512f" ) void				Convolve_AVX512_Single( const float * _pfWeights, const float * _pfSamples, __m512 &_mSum ) {
+		__m512 mWeights = _mm512_loadu_ps( _pfWeights );
+		__m512 mSamples = _mm512_loadu_ps( _pfSamples );
+		_mSum = _mm512_add_ps( _mSum, _mm512_mul_ps( mWeights, mSamples ) );
+	}
+
+	/**
+	 * Convolves the given weights with the given samples.  Neither the weights nor the samples need be aligned.
+	 *
+	 * \param _pfWeights The pointer to the 16 weights.
+	 * \param _pfSamples Pointer to the samples to convolve.
+	 * \param _mSum Maintains the sum of convolution over many iterations.
+	 **/
+	static inline LSN_SAMPLE_BOX_TARGET( "avx512f,fma" ) void				Convolve_AVX512_FMA_Single( const float * _pfWeights, const float * _pfSamples, __m512 &_mSum ) {
+		__m512 mWeights = _mm512_loadu_ps( _pfWeights );
+		__m512 mSamples = _mm512_loadu_ps( _pfSamples );
+		_mSum = _mm512_fmadd_ps( mWeights, mSamples, _mSum );
+	}
+
+	/**
+	 * Horizontally adds all the floats in a given AVX-512 register.
+	 *
+	 * \param _mReg The register containing all of the values to sum.
+	 * \return Returns the sum of all the floats in the given register.
+	 **/
+	static inline LSN_SAMPLE_BOX_TARGET( "avx512f" ) float				HorizontalSum( const __m512 _mReg ) {
+		return _mm512_reduce_add_ps( _mReg );
+	}
+
+	/**
+	 * Performs convolution on the given sample (indexed into m_sSinc.vRing).
+	 *
+	 * \param _sIdx The index of the sample to convolvify.
+	 * \return Returns the convolved sample.
+	 **/
+	LSN_SAMPLE_BOX_TARGET( "avx512f" ) float CSampleBox::Convolve_AVX512( size_t _sIdx ) {
+		const float * pfFilter = m_sSinc.vCeof.data();
+		const float * pfSamples = m_sSinc.vRing.data();
+		size_t sMod = m_sSinc.vRing.size();
+		_sIdx += sMod * 2 - m_sSinc.sM;
+		size_t sTotal = m_sSinc.vCeof.size() - 1;
+		__m512 mSum = _mm512_set1_ps( 0.0f );
+		for ( size_t I = 0; I < sTotal; ) {
+			size_t sIdx = (_sIdx + I) % sMod;
+			if LSN_UNLIKELY( (sMod - sIdx) < (sizeof( __m512 ) / sizeof( float )) ) {
+				// Copy into a temporary.
+				LSN_ALN
+				float fTmp[(sizeof(__m512)/sizeof(float))];
+				for ( size_t J = 0; J < (sizeof( __m512 ) / sizeof( float )); ++J ) {
+					fTmp[J] = pfSamples[(_sIdx+I+J)%sMod];
+				}
+				Convolve_AVX512_Single( &pfFilter[I], fTmp, mSum );
+			}
+			else {
+				Convolve_AVX512_Single( &pfFilter[I], &pfSamples[sIdx], mSum );
+			}
+			I += (sizeof( __m512 ) / sizeof( float ));
+		}
+		return HorizontalSum( mSum );
+	}
+
+	/**
+	 * Performs convolution on the given sample (indexed into m_sSinc.vRing).
+	 *
+	 * \param _sIdx The index of the sample to convolvify.
+	 * \return Returns the convolved sample.
+	 **/
+	LSN_SAMPLE_BOX_TARGET( "avx512f,fma" ) float CSampleBox::Convolve_AVX512_FMA( size_t _sIdx ) {
+		const float * pfFilter = m_sSinc.vCeof.data();
+		const float * pfSamples = m_sSinc.vRing.data();
+		size_t sMod = m_sSinc.vRing.size();
+		_sIdx += sMod * 2 - m_sSinc.sM;
+		size_t sTotal = m_sSinc.vCeof.size() - 1;
+		__m512 mSum = _mm512_set1_ps( 0.0f );
+		for ( size_t I = 0; I < sTotal; ) {
+			size_t sIdx = (_sIdx + I) % sMod;
+			if LSN_UNLIKELY( (sMod - sIdx) < (sizeof( __m512 ) / sizeof( float )) ) {
+				// Copy into a temporary.
+				LSN_ALN
+				float fTmp[(sizeof(__m512)/sizeof(float))];
+				for ( size_t J = 0; J < (sizeof( __m512 ) / sizeof( float )); ++J ) {
+					fTmp[J] = pfSamples[(_sIdx+I+J)%sMod];
+				}
+				Convolve_AVX512_FMA_Single( &pfFilter[I], fTmp, mSum );
+			}
+			else {
+				Convolve_AVX512_FMA_Single( &pfFilter[I], &pfSamples[sIdx], mSum );
+			}
+			I += (sizeof( __m512 ) / sizeof( float ));
+		}
+		return HorizontalSum( mSum );
+	}
+
+	/**
+	 * 4-point, 2nd-order parabolic 2x x-form sampling.
+	 *
+	 * \param _pfsSamples0 The 64-byte-aligned pointer to the 8 1st points.
+	 * \param _pfsSamples1 The 64-byte-aligned pointer to the 8 2nd points.
+	 * \param _pfsSamples2 The 64-byte-aligned pointer to the 8 3rd points.
+	 * \param _pfsSamples3 The 64-byte-aligned pointer to the 8 4th points.
+	 * \param _pfsSamples4 The 64-byte-aligned pointer to the 8 5th points.
+	 * \param _pfsSamples5 The 64-byte-aligned pointer to the 8 6th points.
+	 * \param _pfFrac The interpolation amounts (array of 8 fractions).  Must be aligned to 64 bytes.
+	 * \param _pfOut The output pointer.
+	 */
+	LSN_SAMPLE_BOX_TARGET( "avx512f" ) void CSampleBox::Sample_4Point_2ndOrder_Parabolic_2X_X_AVX512( const float * /*_pfsSamples0*/, const float * _pfsSamples1,
+		const float * _pfsSamples2, const float * _pfsSamples3,
+		const float * _pfsSamples4, const float * /*_pfsSamples5*/,
+		const float * _pfFrac,
+		float * _pfOut ) {
+		// _pfsSamples[1+2] = _pfsSamples3.
+		// _pfsSamples[-1+2] = _pfsSamples1.
+		// _pfsSamples[0+2] = _pfsSamples2.
+		// _pfsSamples[2+2] = _pfsSamples4.
+
+		// Load the inputs/constants.
+		__m512 mS_1p2 = _mm512_load_ps( _pfsSamples3 );
+		__m512 m1o2 = _mm512_set1_ps( 1.0f / 2.0f );
+		__m512 mS_n1p2 = _mm512_load_ps( _pfsSamples1 );
+		__m512 m1o4 = _mm512_set1_ps( 1.0f / 4.0f );
+
+		// float fY1mM1 = _pfsSamples[1+2] - _pfsSamples[-1+2];
+		__m512 mY1mM1 = _mm512_sub_ps( mS_1p2, mS_n1p2 );
+
+		// Load the inputs.
+		__m512 mS_0p2 = _mm512_load_ps( _pfsSamples2 );
+
+		// float fC0 = (1.0f / 2.0f) * _pfsSamples[0+2] + (1.0f / 4.0f) * (_pfsSamples[-1+2] + _pfsSamples[1+2]);
+		__m512 mC0 = _mm512_add_ps( _mm512_mul_ps( m1o2, mS_0p2 ), _mm512_mul_ps( m1o4, _mm512_add_ps( mS_n1p2, mS_1p2 ) ) );
+
+		// Load the inputs.
+		__m512 mS_2p2 = _mm512_load_ps( _pfsSamples4 );
+
+		// float fC1 = (1.0f / 2.0f) * fY1mM1;
+		__m512 mC1 = _mm512_mul_ps( m1o2, mY1mM1 );
+
+		// Load the inputs.
+		__m512 mFrac = _mm512_load_ps( _pfFrac );
+
+		// float fC2 = (1.0f / 4.0f) * (_pfsSamples[2+2] - _pfsSamples[0+2] - fY1mM1);
+		__m512 mC2 = _mm512_mul_ps( m1o4, _mm512_sub_ps( _mm512_sub_ps( mS_2p2, mS_0p2 ), mY1mM1 ) );
+
+		// return (fC2 * _fFrac + fC1) * _fFrac + fC0;
+		__m512 mRet = _mm512_add_ps( _mm512_mul_ps( _mm512_add_ps( _mm512_mul_ps( mC2, mFrac ), mC1 ), mFrac ), mC0 );
+		_mm512_store_ps( _pfOut, mRet );
+	}
+
+	/**
+	 * 4-point, 2nd-order parabolic 2x x-form sampling.
+	 *
+	 * \param _pfsSamples0 The 64-byte-aligned pointer to the 8 1st points.
+	 * \param _pfsSamples1 The 64-byte-aligned pointer to the 8 2nd points.
+	 * \param _pfsSamples2 The 64-byte-aligned pointer to the 8 3rd points.
+	 * \param _pfsSamples3 The 64-byte-aligned pointer to the 8 4th points.
+	 * \param _pfsSamples4 The 64-byte-aligned pointer to the 8 5th points.
+	 * \param _pfsSamples5 The 64-byte-aligned pointer to the 8 6th points.
+	 * \param _pfFrac The interpolation amounts (array of 8 fractions).  Must be aligned to 64 bytes.
+	 * \param _pfOut The output pointer.
+	 */
+	LSN_SAMPLE_BOX_TARGET( "avx512f,fma" ) void CSampleBox::Sample_4Point_2ndOrder_Parabolic_2X_X_AVX512_FMA( const float * /*_pfsSamples0*/, const float * _pfsSamples1,
+		const float * _pfsSamples2, const float * _pfsSamples3,
+		const float * _pfsSamples4, const float * /*_pfsSamples5*/,
+		const float * _pfFrac,
+		float * _pfOut ) {
+		// _pfsSamples[1+2] = _pfsSamples3.
+		// _pfsSamples[-1+2] = _pfsSamples1.
+		// _pfsSamples[0+2] = _pfsSamples2.
+		// _pfsSamples[2+2] = _pfsSamples4.
+
+		// Load the inputs/constants.
+		__m512 mS_1p2 = _mm512_load_ps( _pfsSamples3 );
+		__m512 m1o2 = _mm512_set1_ps( 1.0f / 2.0f );
+		__m512 mS_n1p2 = _mm512_load_ps( _pfsSamples1 );
+		__m512 m1o4 = _mm512_set1_ps( 1.0f / 4.0f );
+
+		// float fY1mM1 = _pfsSamples[1+2] - _pfsSamples[-1+2];
+		__m512 mY1mM1 = _mm512_sub_ps( mS_1p2, mS_n1p2 );
+
+		// Load the inputs.
+		__m512 mS_0p2 = _mm512_load_ps( _pfsSamples2 );
+
+		// float fC0 = (1.0f / 2.0f) * _pfsSamples[0+2] + (1.0f / 4.0f) * (_pfsSamples[-1+2] + _pfsSamples[1+2]);
+		__m512 mC0 = _mm512_add_ps( _mm512_mul_ps( m1o2, mS_0p2 ), _mm512_mul_ps( m1o4, _mm512_add_ps( mS_n1p2, mS_1p2 ) ) );
+
+		// Load the inputs.
+		__m512 mS_2p2 = _mm512_load_ps( _pfsSamples4 );
+
+		// float fC1 = (1.0f / 2.0f) * fY1mM1;
+		__m512 mC1 = _mm512_mul_ps( m1o2, mY1mM1 );
+
+		// Load the inputs.
+		__m512 mFrac = _mm512_load_ps( _pfFrac );
+
+		// float fC2 = (1.0f / 4.0f) * (_pfsSamples[2+2] - _pfsSamples[0+2] - fY1mM1);
+		__m512 mC2 = _mm512_mul_ps( m1o4, _mm512_sub_ps( _mm512_sub_ps( mS_2p2, mS_0p2 ), mY1mM1 ) );
+
+		// return (fC2 * _fFrac + fC1) * _fFrac + fC0;
+		__m512 mRet = _mm512_fmadd_ps( _mm512_fmadd_ps( mC2, mFrac, mC1 ), mFrac, mC0 );
+		_mm512_store_ps( _pfOut, mRet );
+	}
+
+	/**
+	 * 6-point, 5th-order Hermite X-form sampling.
+	 *
+	 * \param _pfsSamples0 The 64-byte-aligned pointer to the 8 1st points.
+	 * \param _pfsSamples1 The 64-byte-aligned pointer to the 8 2nd points.
+	 * \param _pfsSamples2 The 64-byte-aligned pointer to the 8 3rd points.
+	 * \param _pfsSamples3 The 64-byte-aligned pointer to the 8 4th points.
+	 * \param _pfsSamples4 The 64-byte-aligned pointer to the 8 5th points.
+	 * \param _pfsSamples5 The 64-byte-aligned pointer to the 8 6th points.
+	 * \param _pfFrac The interpolation amounts (array of 8 fractions).  Must be aligned to 64 bytes.
+	 * \param _pfOut The output pointer.
+	 */
+	LSN_SAMPLE_BOX_TARGET( "avx512f" ) void CSampleBox::Sample_6Point_5thOrder_Hermite_X_AVX512( const float * _pfsSamples0, const float * _pfsSamples1,
+		const float * _pfsSamples2, const float * _pfsSamples3,
+		const float * _pfsSamples4, const float * _pfsSamples5,
+		const float * _pfFrac,
+		float * _pfOut ) {
+		// 6-point, 5th-order Hermite (X-form).
+		// _pfsSamples[-2+2] = _pfsSamples0.
+		// _pfsSamples[-1+2] = _pfsSamples1.
+		// _pfsSamples[0+2] = _pfsSamples2.
+		// _pfsSamples[1+2] = _pfsSamples3.
+		// _pfsSamples[2+2] = _pfsSamples4.
+		// _pfsSamples[3+2] = _pfsSamples5.
+
+		// Load the inputs/constants.
+		__m512 mS_n2p2 = _mm512_load_ps( _pfsSamples0 );
+		__m512 m1o8 = _mm512_set1_ps( 1.0f / 8.0f );
+		__m512 mS_2p2 = _mm512_load_ps( _pfsSamples4 );
+		__m512 m11o24 = _mm512_set1_ps( 11.0f / 24.0f );
+
+		// float fEightThym2 = 1.0f / 8.0f * _pfsSamples[-2+2];
+		__m512 mEightThym2 = _mm512_mul_ps( m1o8, mS_n2p2 );
+
+		// Load the inputs/constants.
+		__m512 mS_3p2 = _mm512_load_ps( _pfsSamples5 );
+		__m512 m1o12 = _mm512_set1_ps( 1.0f / 12.0f );
+
+		// float fElevenTwentyFourThy2 = 11.0f / 24.0f * _pfsSamples[2+2];
+		__m512 mElevenTwentyFourThy2 = _mm512_mul_ps( m11o24, mS_2p2 );
+
+		// float fTwelvThy3 = 1.0f / 12.0f * _pfsSamples[3+2];
+		__m512 mTwelvThy3 = _mm512_mul_ps( m1o12, mS_3p2 );
+
+		// float fC0 = _pfsSamples[0+2];
+		__m512 mC0 = _mm512_load_ps( _pfsSamples2 );
+
+		// float fC1 = 1.0f / 12.0f * (_pfsSamples[-2+2] - _pfsSamples[2+2]) + 2.0f / 3.0f * (_pfsSamples[1+2] - _pfsSamples[-1+2]);
+		__m512 mS_1p2 = _mm512_load_ps( _pfsSamples3 );
+		__m512 mS_n1p2 = _mm512_load_ps( _pfsSamples1 );
+		__m512 mC1 = _mm512_add_ps( _mm512_mul_ps( m1o12, _mm512_sub_ps( mS_n2p2, mS_2p2 ) ), _mm512_mul_ps( _mm512_set1_ps( 2.0f / 3.0f ), _mm512_sub_ps( mS_1p2, mS_n1p2 ) ) );
+
+		// float fC2 = 13.0f / 12.0f * _pfsSamples[-1+2] - 25.0f / 12.0f * _pfsSamples[0+2] + 3.0f / 2.0f * _pfsSamples[1+2] -
+		//    fElevenTwentyFourThy2 + fTwelvThy3 - fEightThym2;
+		__m512 m13o12 = _mm512_set1_ps( 13.0f / 12.0f );
+		__m512 mC2 = _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_mul_ps( m13o12, mS_n1p2 ), _mm512_mul_ps( _mm512_set1_ps( 25.0f / 12.0f ), mC0 ) ), _mm512_mul_ps( _mm512_set1_ps( 3.0f / 2.0f ), mS_1p2 ) ),
+			mElevenTwentyFourThy2 ), mTwelvThy3 ), mEightThym2 );
+
+		// float fC3 = 5.0f / 12.0f * _pfsSamples[0+2] - 7.0f / 12.0f * _pfsSamples[1+2] + 7.0f / 24.0f * _pfsSamples[2+2] -
+		//    1.0f / 24.0f * (_pfsSamples[-2+2] + _pfsSamples[-1+2] + _pfsSamples[3+2]);
+		__m512 m5o12 = _mm512_set1_ps( 5.0f / 12.0f );
+		__m512 m7o12 = _mm512_set1_ps( 7.0f / 12.0f );
+		__m512 m1o24 = _mm512_set1_ps( 1.0f / 24.0f );
+		__m512 mC3 = _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_mul_ps( m5o12, mC0 ), _mm512_mul_ps( m7o12, mS_1p2 ) ), _mm512_mul_ps( _mm512_set1_ps( 7.0f / 24.0f ), mS_2p2 ) ), _mm512_mul_ps( m1o24, _mm512_add_ps( _mm512_add_ps( mS_n2p2, mS_n1p2 ), mS_3p2 ) ) );
+
+		// float fC4 = fEightThym2 - 7.0f / 12.0f * _pfsSamples[-1+2] + 13.0f / 12.0f * _pfsSamples[0+2] - _pfsSamples[1+2] +
+		//    fElevenTwentyFourThy2 - fTwelvThy3;
+		__m512 mC4 = _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( mEightThym2, _mm512_mul_ps( m7o12, mS_n1p2 ) ), _mm512_mul_ps( m13o12, mC0 ) ), mS_1p2 ), mElevenTwentyFourThy2 ), mTwelvThy3 );
+
+		// Load the inputs.
+		__m512 mFrac = _mm512_load_ps( _pfFrac );
+
+		// float fC5 = 1.0f / 24.0f * (_pfsSamples[3+2] - _pfsSamples[-2+2]) + 5.0f / 24.0f * (_pfsSamples[-1+2] - _pfsSamples[2+2]) +
+		//    5.0f / 12.0f * (_pfsSamples[1+2] - _pfsSamples[0+2]);
+		__m512 mC5 = _mm512_add_ps( _mm512_add_ps( _mm512_mul_ps( m1o24, _mm512_sub_ps( mS_3p2, mS_n2p2 ) ), _mm512_mul_ps( _mm512_set1_ps( 5.0f / 24.0f ), _mm512_sub_ps( mS_n1p2, mS_2p2 ) ) ), _mm512_mul_ps( m5o12, _mm512_sub_ps( mS_1p2, mC0 ) ) );
+
+		// return ((((fC5 * _fFrac + fC4) * _fFrac + fC3) * _fFrac + fC2) * _fFrac + fC1) * _fFrac + fC0;
+		__m512 mRet = _mm512_add_ps( _mm512_mul_ps(
+			_mm512_add_ps( _mm512_mul_ps(
+			_mm512_add_ps( _mm512_mul_ps(
+			_mm512_add_ps( _mm512_mul_ps(
+			_mm512_add_ps( _mm512_mul_ps( mC5,
+				mFrac ), mC4 ),
+				mFrac ), mC3 ),
+				mFrac ), mC2 ),
+				mFrac ), mC1 ),
+				mFrac ), mC0 );
+		_mm512_store_ps( _pfOut, mRet );
+	}
+
+	/**
+	 * 6-point, 5th-order Hermite X-form sampling.
+	 *
+	 * \param _pfsSamples0 The 64-byte-aligned pointer to the 8 1st points.
+	 * \param _pfsSamples1 The 64-byte-aligned pointer to the 8 2nd points.
+	 * \param _pfsSamples2 The 64-byte-aligned pointer to the 8 3rd points.
+	 * \param _pfsSamples3 The 64-byte-aligned pointer to the 8 4th points.
+	 * \param _pfsSamples4 The 64-byte-aligned pointer to the 8 5th points.
+	 * \param _pfsSamples5 The 64-byte-aligned pointer to the 8 6th points.
+	 * \param _pfFrac The interpolation amounts (array of 8 fractions).  Must be aligned to 64 bytes.
+	 * \param _pfOut The output pointer.
+	 */
+	LSN_SAMPLE_BOX_TARGET( "avx512f,fma" ) void CSampleBox::Sample_6Point_5thOrder_Hermite_X_AVX512_FMA( const float * _pfsSamples0, const float * _pfsSamples1,
+		const float * _pfsSamples2, const float * _pfsSamples3,
+		const float * _pfsSamples4, const float * _pfsSamples5,
+		const float * _pfFrac,
+		float * _pfOut ) {
+		// 6-point, 5th-order Hermite (X-form).
+		// _pfsSamples[-2+2] = _pfsSamples0.
+		// _pfsSamples[-1+2] = _pfsSamples1.
+		// _pfsSamples[0+2] = _pfsSamples2.
+		// _pfsSamples[1+2] = _pfsSamples3.
+		// _pfsSamples[2+2] = _pfsSamples4.
+		// _pfsSamples[3+2] = _pfsSamples5.
+
+		// Load the inputs/constants.
+		__m512 mS_n2p2 = _mm512_load_ps( _pfsSamples0 );
+		__m512 m1o8 = _mm512_set1_ps( 1.0f / 8.0f );
+		__m512 mS_2p2 = _mm512_load_ps( _pfsSamples4 );
+		__m512 m11o24 = _mm512_set1_ps( 11.0f / 24.0f );
+
+		// float fEightThym2 = 1.0f / 8.0f * _pfsSamples[-2+2];
+		__m512 mEightThym2 = _mm512_mul_ps( m1o8, mS_n2p2 );
+
+		// Load the inputs/constants.
+		__m512 mS_3p2 = _mm512_load_ps( _pfsSamples5 );
+		__m512 m1o12 = _mm512_set1_ps( 1.0f / 12.0f );
+
+		// float fElevenTwentyFourThy2 = 11.0f / 24.0f * _pfsSamples[2+2];
+		__m512 mElevenTwentyFourThy2 = _mm512_mul_ps( m11o24, mS_2p2 );
+
+		// float fTwelvThy3 = 1.0f / 12.0f * _pfsSamples[3+2];
+		__m512 mTwelvThy3 = _mm512_mul_ps( m1o12, mS_3p2 );
+
+		// float fC0 = _pfsSamples[0+2];
+		__m512 mC0 = _mm512_load_ps( _pfsSamples2 );
+
+		// float fC1 = 1.0f / 12.0f * (_pfsSamples[-2+2] - _pfsSamples[2+2]) + 2.0f / 3.0f * (_pfsSamples[1+2] - _pfsSamples[-1+2]);
+		__m512 mS_1p2 = _mm512_load_ps( _pfsSamples3 );
+		__m512 mS_n1p2 = _mm512_load_ps( _pfsSamples1 );
+		__m512 mC1 = _mm512_add_ps( _mm512_mul_ps( m1o12, _mm512_sub_ps( mS_n2p2, mS_2p2 ) ), _mm512_mul_ps( _mm512_set1_ps( 2.0f / 3.0f ), _mm512_sub_ps( mS_1p2, mS_n1p2 ) ) );
+
+		// float fC2 = 13.0f / 12.0f * _pfsSamples[-1+2] - 25.0f / 12.0f * _pfsSamples[0+2] + 3.0f / 2.0f * _pfsSamples[1+2] -
+		//    fElevenTwentyFourThy2 + fTwelvThy3 - fEightThym2;
+		__m512 m13o12 = _mm512_set1_ps( 13.0f / 12.0f );
+		__m512 mC2 = _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_mul_ps( m13o12, mS_n1p2 ), _mm512_mul_ps( _mm512_set1_ps( 25.0f / 12.0f ), mC0 ) ), _mm512_mul_ps( _mm512_set1_ps( 3.0f / 2.0f ), mS_1p2 ) ),
+			mElevenTwentyFourThy2 ), mTwelvThy3 ), mEightThym2 );
+
+		// float fC3 = 5.0f / 12.0f * _pfsSamples[0+2] - 7.0f / 12.0f * _pfsSamples[1+2] + 7.0f / 24.0f * _pfsSamples[2+2] -
+		//    1.0f / 24.0f * (_pfsSamples[-2+2] + _pfsSamples[-1+2] + _pfsSamples[3+2]);
+		__m512 m5o12 = _mm512_set1_ps( 5.0f / 12.0f );
+		__m512 m7o12 = _mm512_set1_ps( 7.0f / 12.0f );
+		__m512 m1o24 = _mm512_set1_ps( 1.0f / 24.0f );
+		__m512 mC3 = _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_mul_ps( m5o12, mC0 ), _mm512_mul_ps( m7o12, mS_1p2 ) ), _mm512_mul_ps( _mm512_set1_ps( 7.0f / 24.0f ), mS_2p2 ) ), _mm512_mul_ps( m1o24, _mm512_add_ps( _mm512_add_ps( mS_n2p2, mS_n1p2 ), mS_3p2 ) ) );
+
+		// float fC4 = fEightThym2 - 7.0f / 12.0f * _pfsSamples[-1+2] + 13.0f / 12.0f * _pfsSamples[0+2] - _pfsSamples[1+2] +
+		//    fElevenTwentyFourThy2 - fTwelvThy3;
+		__m512 mC4 = _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( _mm512_add_ps( _mm512_sub_ps( mEightThym2, _mm512_mul_ps( m7o12, mS_n1p2 ) ), _mm512_mul_ps( m13o12, mC0 ) ), mS_1p2 ), mElevenTwentyFourThy2 ), mTwelvThy3 );
+
+		// Load the inputs.
+		__m512 mFrac = _mm512_load_ps( _pfFrac );
+
+		// float fC5 = 1.0f / 24.0f * (_pfsSamples[3+2] - _pfsSamples[-2+2]) + 5.0f / 24.0f * (_pfsSamples[-1+2] - _pfsSamples[2+2]) +
+		//    5.0f / 12.0f * (_pfsSamples[1+2] - _pfsSamples[0+2]);
+		__m512 mC5 = _mm512_add_ps( _mm512_add_ps( _mm512_mul_ps( m1o24, _mm512_sub_ps( mS_3p2, mS_n2p2 ) ), _mm512_mul_ps( _mm512_set1_ps( 5.0f / 24.0f ), _mm512_sub_ps( mS_n1p2, mS_2p2 ) ) ), _mm512_mul_ps( m5o12, _mm512_sub_ps( mS_1p2, mC0 ) ) );
+
+		// return ((((fC5 * _fFrac + fC4) * _fFrac + fC3) * _fFrac + fC2) * _fFrac + fC1) * _fFrac + fC0;
+		__m512 mRet = _mm512_fmadd_ps( _mm512_fmadd_ps( _mm512_fmadd_ps( _mm512_fmadd_ps( _mm512_fmadd_ps( mC5, mFrac, mC4 ), mFrac, mC3 ), mFrac, mC2 ), mFrac, mC1 ), mFrac, mC0 );
+		_mm512_store_ps( _pfOut, mRet );
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_SAMPLE_BOX_X86
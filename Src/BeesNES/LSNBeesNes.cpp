@@ -7,7 +7,9 @@
  */
 
 #include "LSNBeesNes.h"
+#include "../Database/LSNDatabase.h"
 #include "../File/LSNStdFile.h"
+#include "../File/LSNZipFile.h"
 #include "../Filters/LSNGpuFilterBase.h"
 
 #include <filesystem>
@@ -364,13 +366,21 @@ namespace lsn {
 		}
 
 
+		// Appended after the API filters, whose rows depend on the build.
+		for ( size_t I = 0; I < LSN_PM_CONSOLE_TOTAL; ++I ) {
+			pfbTmp[CFilterBase::LSN_F_NTSC_CRT_FAST][I] = &m_ncfEmmirNtscFastFilter;
+		}
 		std::memcpy( m_pfbFilterTable, pfbTmp, sizeof( pfbTmp ) );
 
 		m_pppbPostTable[CPostProcessBase::LSN_PP_NONE] = &m_ppbNoPostProcessing;
 		m_pppbPostTable[CPostProcessBase::LSN_PP_BLEED] = &m_bppBleedPostProcessing;
 		m_pppbPostTable[CPostProcessBase::LSN_PP_BILINEAR] = &m_blppBiLinearPost;
 		m_pppbPostTable[CPostProcessBase::LSN_PP_SRGB] = &m_sppLinearTosRGBPost;
+		m_pppbPostTable[CPostProcessBase::LSN_PP_RESAMPLE] = &m_rppResamplePost;
+		m_pppbPostTable[CPostProcessBase::LSN_PP_PHOSPHOR] = &m_pppPhosphorPost;
 		//m_vPostProcesses.push_back( CPostProcessBase::LSN_PP_BLEED );
+		// Before scaling, so that it runs on the fewest pixels.
+		//m_vPostProcesses.push_back( CPostProcessBase::LSN_PP_PHOSPHOR );
 		m_vPostProcesses.push_back( CPostProcessBase::LSN_PP_BILINEAR );
 		//m_vPostProcesses.push_back( CPostProcessBase::LSN_PP_SRGB );
 
@@ -399,6 +409,7 @@ namespace lsn {
 		m_nbfBlarggNtscFilter.Init( stBuffers, uint16_t( RenderTargetWidth() ), uint16_t( RenderTargetHeight() ) );
 		m_nbfBlarggPalFilter.Init( stBuffers, uint16_t( RenderTargetWidth() ), uint16_t( RenderTargetHeight() ) );
 		m_ncfEmmirNtscFullFilter.Init( stBuffers, uint16_t( RenderTargetWidth() ), uint16_t( RenderTargetHeight() ) );
+		m_ncfEmmirNtscFastFilter.Init( stBuffers, uint16_t( RenderTargetWidth() ), uint16_t( RenderTargetHeight() ) );
 		m_ncfEmmirPalFullFilter.Init( stBuffers, uint16_t( RenderTargetWidth() ), uint16_t( RenderTargetHeight() ) );
 
 #ifdef LSN_DX9
@@ -454,6 +465,7 @@ namespace lsn {
 	 * \return Returns true if the settings file was loaded.
 	 */
 	bool CBeesNes::LoadSettings() {
+		bool bRet = false;
 		std::wstring wsPath = m_wsFolder + L"Settings.lsn";
 		CStdFile sfFile;
 		if ( sfFile.Open( reinterpret_cast<const char16_t *>(wsPath.c_str()) ) ) {
@@ -461,10 +473,15 @@ namespace lsn {
 			if ( sfFile.LoadToMemory( vFile ) ) {
 				sfFile.Close();
 				CStream sStream( vFile );
-				return LoadSettings( sStream );
+				bRet = LoadSettings( sStream );
 			}
 		}
-		return false;
+
+		// The ROM library is refreshed in the background from the folders the user loads ROM's from.
+		std::wstring wsLibrary = m_wsFolder + L"RomLibrary.lsn";
+		m_rlLibrary.Load( reinterpret_cast<const char16_t *>(wsLibrary.c_str()) );
+		ScanRomLibrary();
+		return bRet;
 	}
 
 	/**
@@ -617,6 +634,21 @@ namespace lsn {
 			}
 			else {
 				// Pure software rendering.
+				if ( RenderIsRedundant() && m_lrLastRender.ui32FinalW == _ui32FinalW && m_lrLastRender.ui32FinalH == _ui32FinalH ) {
+					// The PPU produced the same frame again (pause, menu, lag frame, etc.)  The last result is still correct.  A pass-through
+					//	result lived in a PPU buffer that has since been handed back to the PPU, but the queued buffer holds the same pixels.
+					m_cfartCurFilterAndTargets.pui8LastFilteredResult = m_lrLastRender.bIsSource ? m_cfartCurFilterAndTargets.pui8CurRenderTarget : m_lrLastRender.pui8Result;
+					m_cfartCurFilterAndTargets.ui32Width = m_lrLastRender.ui32Width;
+					m_cfartCurFilterAndTargets.ui32Height = m_lrLastRender.ui32Height;
+					m_cfartCurFilterAndTargets.ui32Stride = m_lrLastRender.ui32Stride;
+					m_cfartCurFilterAndTargets.ui16Bits = m_lrLastRender.ui16Bits;
+					m_cfartCurFilterAndTargets.bMirrored = m_lrLastRender.bMirrored;
+					return;
+				}
+
+				bool bTemporal = m_cfartCurFilterAndTargets.pfbPrevFilter->IsTemporal();
+				m_cfartCurFilterAndTargets.pfbPrevFilter->SetRowVersions( m_cfartCurFilterAndTargets.vRowVersions.size() ? m_cfartCurFilterAndTargets.vRowVersions.data() : nullptr,
+					m_cfartCurFilterAndTargets.vRowVersions.size(), m_cfartCurFilterAndTargets.ui64FrameVersion );
 				m_cfartCurFilterAndTargets.pui8LastFilteredResult = m_cfartCurFilterAndTargets.pfbPrevFilter->ApplyFilter( m_cfartCurFilterAndTargets.pui8CurRenderTarget,
 					m_cfartCurFilterAndTargets.ui32Width, m_cfartCurFilterAndTargets.ui32Height, m_cfartCurFilterAndTargets.ui16Bits, m_cfartCurFilterAndTargets.ui32Stride,
 					m_cfartCurFilterAndTargets.ui64Frame, m_cfartCurFilterAndTargets.ui64RenderStartCycle );
@@ -627,7 +659,24 @@ namespace lsn {
 						_ui32FinalW, _ui32FinalH, m_cfartCurFilterAndTargets.bMirrored,
 						m_cfartCurFilterAndTargets.ui32Width, m_cfartCurFilterAndTargets.ui32Height, m_cfartCurFilterAndTargets.ui16Bits, m_cfartCurFilterAndTargets.ui32Stride,
 						m_cfartCurFilterAndTargets.ui64Frame, m_cfartCurFilterAndTargets.ui64RenderStartCycle );
+					bTemporal = bTemporal || m_pppbPostTable[m_vPostProcesses[I]]->IsTemporal();
 				}
+
+				// A result that is still the PPU's render target will be overwritten by the PPU, so only the fact that it was a
+				//	pass-through is kept.
+				m_lrLastRender.pdcClient = GetDisplayClient();
+				m_lrLastRender.pfbFilter = m_cfartCurFilterAndTargets.pfbPrevFilter;
+				m_lrLastRender.ui64FrameVersion = m_cfartCurFilterAndTargets.ui64FrameVersion;
+				m_lrLastRender.pui8Result = m_cfartCurFilterAndTargets.pui8LastFilteredResult;
+				m_lrLastRender.ui32FinalW = _ui32FinalW;
+				m_lrLastRender.ui32FinalH = _ui32FinalH;
+				m_lrLastRender.ui32Width = m_cfartCurFilterAndTargets.ui32Width;
+				m_lrLastRender.ui32Height = m_cfartCurFilterAndTargets.ui32Height;
+				m_lrLastRender.ui32Stride = m_cfartCurFilterAndTargets.ui32Stride;
+				m_lrLastRender.ui16Bits = m_cfartCurFilterAndTargets.ui16Bits;
+				m_lrLastRender.bMirrored = m_cfartCurFilterAndTargets.bMirrored;
+				m_lrLastRender.bIsSource = m_lrLastRender.pui8Result == m_cfartCurFilterAndTargets.pui8CurRenderTarget;
+				m_lrLastRender.bValid = !bTemporal;
 			}
 		}
 	}
@@ -649,6 +698,7 @@ namespace lsn {
 		m_cfartCurFilterAndTargets.ui32Stride = uint32_t( m_cfartCurFilterAndTargets.pfbCurFilter->OutputStride() );
 		m_cfartCurFilterAndTargets.ui64Frame = GetDisplayClient()->FrameCount();
 		m_cfartCurFilterAndTargets.ui64RenderStartCycle = GetDisplayClient()->GetRenderStartCycle();
+		CaptureFrameVersions();
 		m_cfartCurFilterAndTargets.bDirty = true;
 		m_cfartCurFilterAndTargets.bMirrored = m_cfartCurFilterAndTargets.pfbCurFilter->FlipInput();
 
@@ -670,6 +720,21 @@ namespace lsn {
 		GetDisplayClient()->SetRenderTarget( m_cfartCurFilterAndTargets.pfbCurFilter->CurTarget(), m_cfartCurFilterAndTargets.pfbCurFilter->OutputStride(), m_cfartCurFilterAndTargets.pfbCurFilter->InputFormat(), m_cfartCurFilterAndTargets.pfbCurFilter->FlipInput() );
 	}
 
+	/**
+	 * Determines if rendering the frame queued by Swap() would reproduce the last software render exactly.  This is the case when
+	 *	the PPU produced a frame identical to the one last rendered and neither the filter nor any post-process is temporal.
+	 *	Should be called inside the same citical section/mutex as Render().
+	 * 
+	 * \return Returns true if the last render can be reused for the queued frame.
+	 **/
+	bool CBeesNes::RenderIsRedundant() const {
+		const LSN_CUR_FILTER_AND_RENDER_TARGET & cfartCur = m_cfartCurFilterAndTargets;
+		if ( !m_lrLastRender.bValid || !cfartCur.pfbPrevFilter || cfartCur.pfbPrevFilter->IsGpuFilter() ) { return false; }
+		return cfartCur.pfbPrevFilter == m_lrLastRender.pfbFilter &&
+			cfartCur.ui64FrameVersion == m_lrLastRender.ui64FrameVersion &&
+			GetDisplayClient() == m_lrLastRender.pdcClient;
+	}
+
 	/**
 	 * Determines if swapping is safe (the new filter has all of the same inputs as the current filter).
 	 * 
@@ -692,43 +757,44 @@ namespace lsn {
 	 * \return Returns true if the ROM was loaded successfully.
 	 */
 	bool CBeesNes::LoadRom( const std::vector<uint8_t> &_vRom, const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion ) {
-		CloseRom();
+		BeginLoadRom();
 		LSN_ROM rTmp;
-		if ( m_u16PerGameSettings.size() ) {
-			SavePerGameSettings( m_u16PerGameSettings );
-			m_u16PerGameSettings.clear();
-		}
 		if ( CSystemBase::LoadRom( _vRom, rTmp, _s16Path ) ) {
-			//m_psbSystem.reset();
-			LSN_PPU_METRICS pmReg = _pmRegion;
-			m_pmSystem = pmReg;
-			if ( m_pmSystem == LSN_PPU_METRICS::LSN_PM_UNKNOWN ) {
-				m_pmSystem = rTmp.riInfo.pmConsoleRegion;
-			}
-			if ( m_pmSystem == LSN_PPU_METRICS::LSN_PM_UNKNOWN ) {
-				m_pmSystem = LSN_PPU_METRICS::LSN_PM_NTSC;
-			}
-			for ( auto I = std::size( m_psbSystems ); I--; ) {
-				if ( I != size_t( m_pmSystem ) ) {
-					m_psbSystems[I]->SetAsInactive();
-				}
-			}
-			m_psbSystem = m_psbSystems[m_pmSystem];
-			rTmp.wsSaveFolder = m_wsFolder + L"GameSettings\\";
-			rTmp.u16SaveFilePrefix = CUtilities::PerRomSettingsPath( rTmp.wsSaveFolder, rTmp.riInfo.ui32Crc, rTmp.riInfo.s16RomName );
-			m_u16PerGameSettings = rTmp.u16SaveFilePrefix;
-			if ( rTmp.u16SaveFilePrefix.size() ) {
-				std::filesystem::path pPath( rTmp.u16SaveFilePrefix );
-				rTmp.u16SaveFilePrefix = pPath.replace_extension( "" ).generic_u16string();
-			}
-			
-			LoadPerGameSettings( m_u16PerGameSettings );
-			UpdateCurrentSystem();
-			if ( m_psbSystem->LoadRom( rTmp ) ) {
-				//m_psbSystem->ResetState( false );
-				AddPath( _s16Path );
-				return true;
-			}
+			return FinishLoadRom( rTmp, _s16Path, _pmRegion );
+		}
+		return false;
+	}
+
+	/**
+	 * Loads a ROM file by mapping it into memory and reading it in place.
+	 *
+	 * \param _s16Path The full path to the ROM.
+	 * \param _pmRegion The region to use when loading the ROM.  If LSN_PM_UNKNOWN, the ROM data is used to determine the region.
+	 * \return Returns true if the ROM was loaded successfully.
+	 */
+	bool CBeesNes::LoadRomFile( const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion ) {
+		BeginLoadRom();
+		LSN_ROM rTmp;
+		if ( CSystemBase::LoadRomFile( _s16Path, rTmp ) ) {
+			return FinishLoadRom( rTmp, _s16Path, _pmRegion );
+		}
+		return false;
+	}
+
+	/**
+	 * Loads a ROM from inside an opened ZIP file, decompressing it directly into the ROM buffers.
+	 *
+	 * \param _zfFile The opened ZIP file.
+	 * \param _s16File The name of the file inside the ZIP to load.
+	 * \param _s16Path The full path to the ROM (the ZIP path followed by the file name in {}).
+	 * \param _pmRegion The region to use when loading the ROM.  If LSN_PM_UNKNOWN, the ROM data is used to determine the region.
+	 * \return Returns true if the ROM was loaded successfully.
+	 */
+	bool CBeesNes::LoadZipRom( const CZipFile &_zfFile, const std::u16string &_s16File, const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion ) {
+		BeginLoadRom();
+		LSN_ROM rTmp;
+		if ( CSystemBase::LoadZipRom( _zfFile, _s16File, rTmp, _s16Path ) ) {
+			return FinishLoadRom( rTmp, _s16Path, _pmRegion );
 		}
 		return false;
 	}
@@ -884,6 +950,10 @@ namespace lsn {
 			if ( ppPal ) {
 				if ( !m_npPalette.FillSoftwarePalette( ppPal, m_gCrtGamma, m_gMonitorGamma ) ) { bRet = false; }
 			}
+			// The same palette indices now produce different colors.
+			if ( GetDisplayClient() ) { GetDisplayClient()->PaletteChanged(); }
+			InvalidateFilters();
+			m_lrLastRender.bValid = false;
 
 			return bRet;
 		}
@@ -943,6 +1013,8 @@ namespace lsn {
 	void CBeesNes::ShutDown() {
 		if ( m_psbSystem && !m_psbSystem->CloseRom() ) {
 		}
+		m_rlLibrary.StopScan();
+		m_rlLibrary.Save();
 		auto pfbThis = m_pfbFilterTable[m_oOptions.fFilter][GetCurPpuRegion()];
 		// If something was queued for deactivation, destroy it.
 		m_cfartCurFilterAndTargets.DeActivate();
@@ -951,11 +1023,67 @@ namespace lsn {
 		pfbThis->DeActivate();
 	}
 
+	/**
+	 * Closes the current ROM and saves its per-game settings in preparation for loading a new ROM.
+	 **/
+	void CBeesNes::BeginLoadRom() {
+		CloseRom();
+		if ( m_u16PerGameSettings.size() ) {
+			SavePerGameSettings( m_u16PerGameSettings );
+			m_u16PerGameSettings.clear();
+		}
+	}
+
+	/**
+	 * Sets up the system for a ROM that has been loaded into an LSN_ROM object and hands the ROM to it.
+	 *
+	 * \param _rRom The loaded ROM.  Its contents are moved into the system.
+	 * \param _s16Path The full path to the ROM.
+	 * \param _pmRegion The region to use when loading the ROM.  If LSN_PM_UNKNOWN, the ROM data is used to determine the region.
+	 * \return Returns true if the ROM was loaded successfully.
+	 */
+	bool CBeesNes::FinishLoadRom( LSN_ROM &_rRom, const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion ) {
+		//m_psbSystem.reset();
+		LSN_PPU_METRICS pmReg = _pmRegion;
+		m_pmSystem = pmReg;
+		if ( m_pmSystem == LSN_PPU_METRICS::LSN_PM_UNKNOWN ) {
+			m_pmSystem = _rRom.riInfo.pmConsoleRegion;
+		}
+		if ( m_pmSystem == LSN_PPU_METRICS::LSN_PM_UNKNOWN ) {
+			m_pmSystem = LSN_PPU_METRICS::LSN_PM_NTSC;
+		}
+		for ( auto I = std::size( m_psbSystems ); I--; ) {
+			if ( I != size_t( m_pmSystem ) ) {
+				m_psbSystems[I]->SetAsInactive();
+			}
+		}
+		m_psbSystem = m_psbSystems[m_pmSystem];
+		_rRom.wsSaveFolder = m_wsFolder + L"GameSettings\\";
+		_rRom.u16SaveFilePrefix = CUtilities::PerRomSettingsPath( _rRom.wsSaveFolder, _rRom.riInfo.ui32Crc, _rRom.riInfo.s16RomName );
+		m_u16PerGameSettings = _rRom.u16SaveFilePrefix;
+		if ( _rRom.u16SaveFilePrefix.size() ) {
+			std::filesystem::path pPath( _rRom.u16SaveFilePrefix );
+			_rRom.u16SaveFilePrefix = pPath.replace_extension( "" ).generic_u16string();
+		}
+		
+		LoadPerGameSettings( m_u16PerGameSettings );
+		UpdateCurrentSystem();
+		m_rlLibrary.Add( _rRom.riInfo, CDatabase::Find( _rRom.riInfo.ui32Crc, &_rRom.riInfo.mhHeaderlessMd5 ) != nullptr );
+		if ( m_psbSystem->LoadRom( _rRom ) ) {
+			//m_psbSystem->ResetState( false );
+			AddPath( _s16Path );
+			return true;
+		}
+		return false;
+	}
+
 	/**
 	 * Updates the current system with render information, display hosts, etc.
 	 */
 	void CBeesNes::UpdateCurrentSystem() {
 		if ( !GetDisplayClient() ) { return; }
+		// The new system's frame versions do not continue the old one's.
+		InvalidateFilters();
 		GetDisplayClient()->SetDisplayHost( m_pdhDisplayHost );
 
 		// Set ratios.
@@ -996,9 +1124,11 @@ namespace lsn {
 		m_cfartCurFilterAndTargets.ui32Stride = uint32_t( m_cfartCurFilterAndTargets.pfbCurFilter->OutputStride() );
 		m_cfartCurFilterAndTargets.ui64Frame = GetDisplayClient()->FrameCount();
 		m_cfartCurFilterAndTargets.ui64RenderStartCycle = GetDisplayClient()->GetRenderStartCycle();
+		CaptureFrameVersions();
 		m_cfartCurFilterAndTargets.bDirty = true;
 		m_cfartCurFilterAndTargets.bMirrored = m_cfartCurFilterAndTargets.pfbCurFilter->FlipInput();
 		m_cfartCurFilterAndTargets.pui8LastFilteredResult = nullptr;
+		m_lrLastRender.bValid = false;
 
 		m_cfartCurFilterAndTargets.pfbNextFilter = m_cfartCurFilterAndTargets.pfbCurFilter;
 		m_cfartCurFilterAndTargets.pfbPrevFilter = m_cfartCurFilterAndTargets.pfbCurFilter;
@@ -1013,6 +1143,31 @@ namespace lsn {
 		ApplyPaletteOptions();
 	}
 
+	/**
+	 * Copies the display client's frame version and per-scanline change versions into the current render information.
+	 */
+	void CBeesNes::CaptureFrameVersions() {
+		m_cfartCurFilterAndTargets.ui64FrameVersion = GetDisplayClient()->GetFrameVersion();
+		const uint64_t * pui64RowVersions = GetDisplayClient()->RowVersions();
+		if ( pui64RowVersions ) {
+			m_cfartCurFilterAndTargets.vRowVersions.assign( pui64RowVersions, pui64RowVersions + GetDisplayClient()->DisplayHeight() );
+		}
+		else {
+			m_cfartCurFilterAndTargets.vRowVersions.clear();
+		}
+	}
+
+	/**
+	 * Discards the output every filter has cached from earlier frames.
+	 */
+	void CBeesNes::InvalidateFilters() {
+		for ( size_t I = 0; I < CFilterBase::LSN_F_TOTAL; ++I ) {
+			for ( size_t J = 0; J < LSN_PM_CONSOLE_TOTAL; ++J ) {
+				if ( m_pfbFilterTable[I][J] ) { m_pfbFilterTable[I][J]->Invalidate(); }
+			}
+		}
+	}
+
 	/**
 	 * Loads the settings file.
 	 *
@@ -1319,7 +1474,7 @@ namespace lsn {
 	 * \param _stfoAudioOptions The audio options into which to load the settings data.
 	 * \return Returns true if the settings data was loaded.
 	 */
-	bool CBeesNes::LoadAudioStreamSettings( uint32_t /*_ui32Version*/, CStream &_sFile, CWavFile::LSN_STREAM_TO_FILE_OPTIONS &_stfoAudioOptions ) {
+	bool CBeesNes::LoadAudioStreamSettings( uint32_t _ui32Version, CStream &_sFile, CWavFile::LSN_STREAM_TO_FILE_OPTIONS &_stfoAudioOptions ) {
 		_stfoAudioOptions = CWavFile::LSN_STREAM_TO_FILE_OPTIONS();
 		if ( !_sFile.ReadStringU16( _stfoAudioOptions.wsPath ) ) { return false; }
 		if ( !_sFile.Read( _stfoAudioOptions.bEnabled ) ) { return false; }
@@ -1339,6 +1494,11 @@ namespace lsn {
 		if ( !_sFile.Read( _stfoAudioOptions.ui64MetaParm ) ) { return false; }
 		if ( !_sFile.Read( _stfoAudioOptions.i32MetaFormat ) ) { return false; }
 		if ( !_sFile.Read( _stfoAudioOptions.bMetaEnabled ) ) { return false; }
+
+		if ( _ui32Version >= 1 ) {
+			if ( !_sFile.ReadString( _stfoAudioOptions.sStartExp ) ) { return false; }
+			if ( !_sFile.ReadString( _stfoAudioOptions.sEndExp ) ) { return false; }
+		}
 		return true;
 	}
 
@@ -1367,6 +1527,9 @@ namespace lsn {
 		if ( !_sFile.Write( _stfoAudioOptions.ui64MetaParm ) ) { return false; }
 		if ( !_sFile.Write( _stfoAudioOptions.i32MetaFormat ) ) { return false; }
 		if ( !_sFile.Write( _stfoAudioOptions.bMetaEnabled ) ) { return false; }
+
+		if ( !_sFile.WriteString( std::u8string( _stfoAudioOptions.sStartExp.begin(), _stfoAudioOptions.sStartExp.end() ) ) ) { return false; }
+		if ( !_sFile.WriteString( std::u8string( _stfoAudioOptions.sEndExp.begin(), _stfoAudioOptions.sEndExp.end() ) ) ) { return false; }
 		return true;
 	}
 
@@ -1651,4 +1814,34 @@ namespace lsn {
 		while ( m_vRecentFiles.size() > m_ui32RecentLimit ) { m_vRecentFiles.pop_back(); }
 	}
 
+	/**
+	 * Starts refreshing the ROM library in the background from the default ROM folder and the folders of the recent files.
+	 **/
+	void CBeesNes::ScanRomLibrary() {
+		try {
+			std::vector<std::u16string> vFolders;
+			auto AddFolder = [&]( const std::filesystem::path &_pFolder ) {
+				if ( _pFolder.empty() ) { return; }
+				std::u16string u16Folder = CUtilities::ToLower( CUtilities::Replace( _pFolder.u16string(), u'/', u'\\' ) );
+				if ( CUtilities::LastChar( u16Folder ) == u'\\' ) { u16Folder.pop_back(); }
+				for ( size_t I = 0; I < vFolders.size(); ++I ) {
+					if ( CUtilities::ToLower( vFolders[I] ) == u16Folder ) { return; }
+				}
+				vFolders.push_back( _pFolder.u16string() );
+			};
+			AddFolder( std::filesystem::path( m_oOptions.wsDefaultRomPath ) );
+			for ( size_t I = 0; I < m_vRecentFiles.size(); ++I ) {
+				std::u16string u16File = m_vRecentFiles[I];
+				// "Zip{File}" paths live in the folder of the ZIP file.
+				if ( CUtilities::LastChar( u16File ) == u'}' ) {
+					size_t sPos = u16File.rfind( u'{' );
+					if ( sPos != std::u16string::npos ) { u16File.resize( sPos ); }
+				}
+				AddFolder( std::filesystem::path( u16File ).parent_path() );
+			}
+			m_rlLibrary.StartScan( vFolders );
+		}
+		catch ( ... ) {}
+	}
+
 }	// namespace lsn
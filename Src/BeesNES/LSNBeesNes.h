@@ -29,11 +29,14 @@
 #endif	// #ifdef LSN_DX9
 #include "../Filters/LSNNesPalette.h"
 #include "../Filters/LSNNtscBlarggFilter.h"
+#include "../Filters/LSNNtscCrtFastFilter.h"
 #include "../Filters/LSNNtscCrtFullFilter.h"
 #include "../Filters/LSNNtscLSpiroFilter.h"
 #include "../Filters/LSNPalBlarggFilter.h"
 #include "../Filters/LSNPalCrtFullFilter.h"
 #include "../Filters/LSNPalLSpiroFilter.h"
+#include "../Filters/LSNPhosphorPostProcess.h"
+#include "../Filters/LSNResamplerPostProcess.h"
 #include "../Filters/LSNRgb24Filter.h"
 #include "../Filters/LSNSrgbPostProcess.h"
 #ifdef LSN_VULKAN1
@@ -45,11 +48,12 @@
 //#include "../Filters/LSNVulkanPalLSpiroFilter.h"
 #endif	// #ifdef LSN_VULKAN1
 #include "../Options/LSNOptions.h"
+#include "../Roms/LSNRomLibrary.h"
 #include "../System/LSNSystem.h"
 #include "../Utilities/LSNStream.h"
 
 
-#define LSN_BEESNES_SETTINGS_VERSION			0
+#define LSN_BEESNES_SETTINGS_VERSION			1
 
 namespace lsn {
 
@@ -72,6 +76,8 @@ namespace lsn {
 		struct LSN_CUR_FILTER_AND_RENDER_TARGET {
 			uint64_t							ui64Frame = 0;								/**< The PPU frame count associated with the render target. */
 			uint64_t							ui64RenderStartCycle = 0;					/**< The cycle at which rendering began. */
+			uint64_t							ui64FrameVersion = 0;						/**< The PPU frame version associated with the render target.  Frames with the same version are identical. */
+			std::vector<uint64_t>				vRowVersions;								/**< The PPU frame version at which each scanline of the render target last changed.  Empty if the PPU does not track them. */
 			CFilterBase *						pfbCurFilter = nullptr;						/**< The current filter. */
 			CFilterBase *						pfbNextFilter = nullptr;					/**< The next filter. */
 			CFilterBase *						pfbPrevFilter = nullptr;					/**< The previous filter. */
@@ -113,6 +119,23 @@ namespace lsn {
 			}
 		};
 
+		/** The result of the last software render, reused while the PPU keeps producing the same frame. */
+		struct LSN_LAST_RENDER {
+			const CDisplayClient *				pdcClient = nullptr;						/**< The PPU that produced the frame. */
+			const CFilterBase *					pfbFilter = nullptr;						/**< The filter that rendered the frame. */
+			uint64_t							ui64FrameVersion = 0;						/**< The PPU frame version that was rendered. */
+			uint8_t *							pui8Result = nullptr;						/**< The final filtered result. */
+			uint32_t							ui32FinalW = 0;								/**< The final display width passed to the post-processes. */
+			uint32_t							ui32FinalH = 0;								/**< The final display height passed to the post-processes. */
+			uint32_t							ui32Width = 0;								/**< The result's width in pixels. */
+			uint32_t							ui32Height = 0;								/**< The result's height in pixels. */
+			uint32_t							ui32Stride = 0;								/**< The result's stride in bytes. */
+			uint16_t							ui16Bits = 0;								/**< The result's bit depth. */
+			bool								bMirrored = false;							/**< The result's mirrored state. */
+			bool								bIsSource = false;							/**< The result was the PPU's render target itself (a pass-through filter such as RGB24). */
+			bool								bValid = false;								/**< If false, the result can't be reused. */
+		};
+
 
 		// == Functions.
 		/**
@@ -294,6 +317,15 @@ namespace lsn {
 		 */
 		void									Swap( bool _bActuallySwap = true );
 
+		/**
+		 * Determines if rendering the frame queued by Swap() would reproduce the last software render exactly.  This is the case when
+		 *	the PPU produced a frame identical to the one last rendered and neither the filter nor any post-process is temporal.
+		 *	Should be called inside the same citical section/mutex as Render().
+		 * 
+		 * \return Returns true if the last render can be reused for the queued frame.
+		 **/
+		bool									RenderIsRedundant() const;
+
 		/**
 		 * Determines if swapping is safe (the new filter has all of the same inputs as the current filter).
 		 * 
@@ -310,6 +342,8 @@ namespace lsn {
 			m_cfartCurFilterAndTargets.ui32Height = m_cfartCurFilterAndTargets.pfbCurFilter->OutputHeight();
 			m_cfartCurFilterAndTargets.ui32Stride = uint32_t( m_cfartCurFilterAndTargets.pfbCurFilter->OutputStride() );
 			m_cfartCurFilterAndTargets.bDirty = true;
+			m_lrLastRender.bValid = false;
+			InvalidateFilters();
 		}
 
 		/**
@@ -322,6 +356,26 @@ namespace lsn {
 		 */
 		bool									LoadRom( const std::vector<uint8_t> &_vRom, const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion = LSN_PM_UNKNOWN );
 
+		/**
+		 * Loads a ROM file by mapping it into memory and reading it in place.
+		 *
+		 * \param _s16Path The full path to the ROM.
+		 * \param _pmRegion The region to use when loading the ROM.  If LSN_PM_UNKNOWN, the ROM data is used to determine the region.
+		 * \return Returns true if the ROM was loaded successfully.
+		 */
+		bool									LoadRomFile( const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion = LSN_PM_UNKNOWN );
+
+		/**
+		 * Loads a ROM from inside an opened ZIP file, decompressing it directly into the ROM buffers.
+		 *
+		 * \param _zfFile The opened ZIP file.
+		 * \param _s16File The name of the file inside the ZIP to load.
+		 * \param _s16Path The full path to the ROM (the ZIP path followed by the file name in {}).
+		 * \param _pmRegion The region to use when loading the ROM.  If LSN_PM_UNKNOWN, the ROM data is used to determine the region.
+		 * \return Returns true if the ROM was loaded successfully.
+		 */
+		bool									LoadZipRom( const CZipFile &_zfFile, const std::u16string &_s16File, const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion = LSN_PM_UNKNOWN );
+
 		/**
 		 * Closes the current ROM.
 		 **/
@@ -387,6 +441,13 @@ namespace lsn {
 		 **/
 		const std::vector<std::u16string> &		RecentFiles() const { return m_vRecentFiles; }
 
+		/**
+		 * Gets the ROM library.
+		 * 
+		 * \return Returns a reference to the index of known ROM files.
+		 **/
+		CRomLibrary &							RomLibrary() { return m_rlLibrary; }
+
 		/**
 		 * Applies the current audio options.
 		 **/
@@ -482,6 +543,8 @@ namespace lsn {
 		double									m_dRatioActual;
 		/** The current/next filter/render target. */
 		LSN_CUR_FILTER_AND_RENDER_TARGET		m_cfartCurFilterAndTargets;
+		/** The last software render. */
+		LSN_LAST_RENDER							m_lrLastRender;
 		/** The standard RGB filter. */
 		CRgb24Filter							m_r24fRgb24Filter;
 		/** L. Spiro's NTSC filter. */
@@ -498,6 +561,8 @@ namespace lsn {
 		CNtscBlarggFilter						m_nbfBlarggNtscFilter;
 		/** EMMIR (LMP88959)'s NTSC-CRT filter. */
 		CNtscCrtFullFilter						m_ncfEmmirNtscFullFilter;
+		/** EMMIR (LMP88959)'s fast NTSC-CRT filter. */
+		CNtscCrtFastFilter						m_ncfEmmirNtscFastFilter;
 		/** EMMIR (LMP88959)'s PAL-CRT filter. */
 		CPalCrtFullFilter						m_ncfEmmirPalFullFilter;
 		/** Blargg's NTSC filter (ad-hoc PAL-inated). */
@@ -581,6 +646,10 @@ namespace lsn {
 		CBiLinearPostProcess					m_blppBiLinearPost;
 		/** Linear -> sRGB conversion. */
 		CSrgbPostProcess						m_sppLinearTosRGBPost;
+		/** A kernel-based (CResamplerBase) scaling post-process filter. */
+		CResamplerPostProcess					m_rppResamplePost;
+		/** Phosphor persistence/frame blending. */
+		CPhosphorPostProcess					m_pppPhosphorPost;
 		/** A post-processing table. */
 		CPostProcessBase *						m_pppbPostTable[CPostProcessBase::LSN_PP_TOTAL];
 		/** The display host. */
@@ -625,6 +694,8 @@ namespace lsn {
 		std::vector<std::u16string>				m_vRecentFiles;
 		/** The total number of recently opened to allow. */
 		uint32_t								m_ui32RecentLimit;
+		/** The index of known ROM files. */
+		CRomLibrary								m_rlLibrary;
 
 		/** The raw WAV stream. */
 		static CWavFile							m_wfRawStream;
@@ -638,6 +709,31 @@ namespace lsn {
 		 */
 		void									UpdateCurrentSystem();
 
+		/**
+		 * Copies the display client's frame version and per-scanline change versions into the current render information.
+		 */
+		void									CaptureFrameVersions();
+
+		/**
+		 * Discards the output every filter has cached from earlier frames.
+		 */
+		void									InvalidateFilters();
+
+		/**
+		 * Closes the current ROM and saves its per-game settings in preparation for loading a new ROM.
+		 **/
+		void									BeginLoadRom();
+
+		/**
+		 * Sets up the system for a ROM that has been loaded into an LSN_ROM object and hands the ROM to it.
+		 *
+		 * \param _rRom The loaded ROM.  Its contents are moved into the system.
+		 * \param _s16Path The full path to the ROM.
+		 * \param _pmRegion The region to use when loading the ROM.  If LSN_PM_UNKNOWN, the ROM data is used to determine the region.
+		 * \return Returns true if the ROM was loaded successfully.
+		 */
+		bool									FinishLoadRom( LSN_ROM &_rRom, const std::u16string &_s16Path, LSN_PPU_METRICS _pmRegion );
+
 		/**
 		 * Sets the stream-to-file options.
 		 * 
@@ -825,6 +921,11 @@ namespace lsn {
 		 * \param _s16Path The file path to add or move to the top.
 		 **/
 		void									AddPath( const std::u16string &_s16Path );
+
+		/**
+		 * Starts refreshing the ROM library in the background from the default ROM folder and the folders of the recent files.
+		 **/
+		void									ScanRomLibrary();
 	};
 
 }	// namespace lsn
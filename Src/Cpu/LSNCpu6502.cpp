@@ -49,7 +49,7 @@ namespace lsn {
 		//m_bNmiStatusPhi1Flag = m_bDetectedNmi;
 
 #ifndef LSN_CPU_VERIFY
-		m_pmbMapper->Tick();
+		if ( m_bTickMapper ) { m_pmbMapper->Tick(); }
 #endif	// #ifndef LSN_CPU_VERIFY
 		(this->*m_pfTickFunc)();
 	}
@@ -224,31 +224,48 @@ namespace lsn {
 		LSN_CPU_VERIFY_OBJ cvoVerifyMe;
 		if ( !GetTest( _jJson, _jvTest, cvoVerifyMe ) ) { return -1; }
 
-		// Create the initial state.
+		LSN_CPU_VERIFY_RESULT cvrResult;
+		RunTest( cvoVerifyMe, cvrResult );
+		if ( cvrResult.bPollingMismatch ) {
+			lsn::DebugA( "\r\nDouble-check polling.\r\n" );
+		}
+		for ( size_t I = 0; I < cvrResult.vFailures.size(); ++I ) {
+			lsn::DebugA( cvoVerifyMe.sName.c_str() );
+			lsn::DebugA( ("\r\n" + cvrResult.vFailures[I] + "\r\n\r\n").c_str() );
+		}
+		return cvrResult.i32Cycles;
+	}
+
+	/**
+	 * Runs a test.  The bus must have had its default map applied (CCpuBus::ApplyMap()) once before the first test.
+	 *
+	 * \param _cvoTest The test to run.
+	 * \param _cvrResult Holds the cycle count and any mismatches.
+	 * \return Returns true if the final state and cycle trace matched the test.
+	 */
+	bool CCpu6502::RunTest( const LSN_CPU_VERIFY_OBJ &_cvoTest, LSN_CPU_VERIFY_RESULT &_cvrResult ) {
+		_cvrResult.i32Cycles = 0;
+		_cvrResult.bPollingMismatch = false;
+		_cvrResult.vFailures.clear();
+
+		// Create the initial state.  Tests only use the default read/write functions, so rather than re-applying the whole 64 KB map for
+		//	every test, only the log of the RAM set-up writes is cleared.
 		ResetToKnown();
-		m_pbBus->ApplyMap();				// Set default read/write functions.
 		m_ui64CycleCount = 0;
-		m_fsState.rRegs.ui8A = cvoVerifyMe.cvsStart.cvrRegisters.ui8A;
-		m_fsState.rRegs.ui8S = cvoVerifyMe.cvsStart.cvrRegisters.ui8S;
-		m_fsState.rRegs.ui8X = cvoVerifyMe.cvsStart.cvrRegisters.ui8X;
-		m_fsState.rRegs.ui8Y = cvoVerifyMe.cvsStart.cvrRegisters.ui8Y;
-		m_fsState.rRegs.ui8Status = cvoVerifyMe.cvsStart.cvrRegisters.ui8Status;
-		m_fsState.rRegs.ui16Pc = cvoVerifyMe.cvsStart.cvrRegisters.ui16Pc;
+		m_fsState.rRegs.ui8A = _cvoTest.cvsStart.cvrRegisters.ui8A;
+		m_fsState.rRegs.ui8S = _cvoTest.cvsStart.cvrRegisters.ui8S;
+		m_fsState.rRegs.ui8X = _cvoTest.cvsStart.cvrRegisters.ui8X;
+		m_fsState.rRegs.ui8Y = _cvoTest.cvsStart.cvrRegisters.ui8Y;
+		m_fsState.rRegs.ui8Status = _cvoTest.cvsStart.cvrRegisters.ui8Status;
+		m_fsState.rRegs.ui16Pc = _cvoTest.cvsStart.cvrRegisters.ui16Pc;
 
-		for ( auto I = cvoVerifyMe.cvsStart.vRam.size(); I--; ) {
-			m_pbBus->Write( cvoVerifyMe.cvsStart.vRam[I].ui16Addr, cvoVerifyMe.cvsStart.vRam[I].ui8Value );
+		for ( auto I = _cvoTest.cvsStart.vRam.size(); I--; ) {
+			m_pbBus->Write( _cvoTest.cvsStart.vRam[I].ui16Addr, _cvoTest.cvsStart.vRam[I].ui8Value );
 		}
-		m_pbBus->ApplyMap();				// Set default read/write functions.
+		m_pbBus->ReadWriteLog().clear();
 
-		/*if ( "10 91 3e" == cvoVerifyMe.sName ) {
-			volatile int ghg = 0;
-		}*/
 		int32_t i32Cnt = 0;
-#ifdef LSN_CYCLES_DOC
-		
-		std::string sLine;
-#endif	// #ifdef LSN_CYCLES_DOC
-		for ( auto I = cvoVerifyMe.vCycles.size(); I--; ) {
+		for ( auto I = _cvoTest.vCycles.size(); I--; ) {
 #ifdef LSN_CYCLES_DOC
 			if ( i32Cnt ) {
 				lsn::DebugA( (std::to_string( i32Cnt ) + ".1\t").c_str() );
@@ -274,7 +291,7 @@ namespace lsn {
 				m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BPL && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BNE && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BVC && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BVS &&
 				m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BCC && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BCS && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BEQ && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_BMI ) {
 				if ( m_bHandleNmi != (I <= 0) ) {
-					::OutputDebugStringA( "\r\nDouble-check polling.\r\n" );
+					_cvrResult.bPollingMismatch = true;
 				}
 			}
 		}
@@ -286,16 +303,17 @@ namespace lsn {
 		lsn::DebugA( (std::string( "\r\n" ) + std::to_string( i32Cnt ) + ".2\tRead PC\tStore as OpCode.\r\n").c_str() );
 		lsn::DebugA( " +X.1\t\t\r\n\r\n\r\n" );
 #endif	// #ifdef LSN_CYCLES_DOC
+		_cvrResult.i32Cycles = i32Cnt;
 		
 		// Verify.
+		auto Mismatch = [&]( const char * _pcWhat, uint64_t _ui64Expected, uint64_t _ui64Got ) {
+			_cvrResult.vFailures.push_back( std::string( "CPU Failure: " ) + _pcWhat + "\r\nExpected: " + std::to_string( _ui64Expected ) +
+				" (" + ee::CExpEval::ToHex( _ui64Expected ) + ") Got: " + std::to_string( _ui64Got ) +
+				" (" + ee::CExpEval::ToHex( _ui64Got ) + ")" );
+		};
 #define LSN_VURIFFY( REG )																																												\
-	if ( m_fsState.rRegs. ## REG != cvoVerifyMe.cvsEnd.cvrRegisters. ## REG ) {																																	\
-		::OutputDebugStringA( cvoVerifyMe.sName.c_str() );																																				\
-		::OutputDebugStringA( "\r\nCPU Failure: " # REG "\r\n" );																																		\
-		::OutputDebugStringA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.cvsEnd.cvrRegisters. ## REG ) +																					\
-			std::string( " (" ) + ee::CExpEval::ToHex( uint64_t( cvoVerifyMe.cvsEnd.cvrRegisters. ## REG ) ) + std::string( ") Got: " ) + std::to_string( m_fsState.rRegs. ## REG ) +							\
-			std::string( " (" ) + ee::CExpEval::ToHex( uint64_t( m_fsState.rRegs. ## REG ) ) + std::string( ")" )).c_str() );																					\
-		::OutputDebugStringA( "\r\n\r\n" );																																								\
+	if ( m_fsState.rRegs.REG != _cvoTest.cvsEnd.cvrRegisters.REG ) {																																	\
+		Mismatch( # REG, uint64_t( _cvoTest.cvsEnd.cvrRegisters.REG ), uint64_t( m_fsState.rRegs.REG ) );																								\
 	}
 
 		LSN_VURIFFY( ui8A );
@@ -306,45 +324,35 @@ namespace lsn {
 		LSN_VURIFFY( ui16Pc );
 #undef LSN_VURIFFY
 
+		for ( size_t I = 0; I < _cvoTest.cvsEnd.vRam.size(); ++I ) {
+			uint8_t ui8Got = m_pbBus->DBG_Inspect( _cvoTest.cvsEnd.vRam[I].ui16Addr );
+			if ( ui8Got != _cvoTest.cvsEnd.vRam[I].ui8Value ) {
+				Mismatch( ("RAM " + ee::CExpEval::ToHex( uint64_t( _cvoTest.cvsEnd.vRam[I].ui16Addr ) )).c_str(), _cvoTest.cvsEnd.vRam[I].ui8Value, ui8Got );
+			}
+		}
+
 		if ( m_fsState.ui8FuncIndex != 0 && m_iInstructionSet[m_fsState.ui16OpCode].iInstruction != LSN_I_JAM ) {
-			::OutputDebugStringA( cvoVerifyMe.sName.c_str() );
-			::OutputDebugStringA( "\r\nDidn't read the end of cycle functions.\r\n" );
-			::OutputDebugStringA( "\r\n\r\n" );
+			_cvrResult.vFailures.push_back( "Didn't read the end of cycle functions." );
 		}
 
-		if ( m_pbBus->ReadWriteLog().size() != cvoVerifyMe.vCycles.size() ) {
-			::OutputDebugStringA( cvoVerifyMe.sName.c_str() );
-			::OutputDebugStringA( "\r\nInternal Error\r\n" );
-			::OutputDebugStringA( "\r\n\r\n" );
+		if ( m_pbBus->ReadWriteLog().size() != _cvoTest.vCycles.size() ) {
+			_cvrResult.vFailures.push_back( "Internal Error: expected " + std::to_string( _cvoTest.vCycles.size() ) + " bus accesses, got " + std::to_string( m_pbBus->ReadWriteLog().size() ) + "." );
 		}
 		else {
-			//if ( m_pbBus->ReadWriteLog().size() != m_iInstructionSet[ui16LastInstr].
 			for ( size_t I = 0; I < m_pbBus->ReadWriteLog().size(); ++I ) {
-				if ( m_pbBus->ReadWriteLog()[I].ui16Address != cvoVerifyMe.vCycles[I].ui16Addr ) {
-					::OutputDebugStringA( cvoVerifyMe.sName.c_str() );
-					::OutputDebugStringA( "\r\nCPU Failure: Cycle Address Wrong\r\n" );
-					::OutputDebugStringA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].ui16Addr ) +
-						std::string( " (" ) + ee::CExpEval::ToHex( uint64_t( cvoVerifyMe.vCycles[I].ui16Addr ) ) + std::string( ") Got: " ) + std::to_string( m_pbBus->ReadWriteLog()[I].ui16Address ) +
-						std::string( " (" ) + ee::CExpEval::ToHex( uint64_t( m_pbBus->ReadWriteLog()[I].ui16Address ) ) + std::string( ")" ) ).c_str() );
-					::OutputDebugStringA( "\r\n\r\n" );
+				std::string sCycle = "Cycle " + std::to_string( I ) + " ";
+				if ( m_pbBus->ReadWriteLog()[I].ui16Address != _cvoTest.vCycles[I].ui16Addr ) {
+					Mismatch( (sCycle + "Address Wrong").c_str(), _cvoTest.vCycles[I].ui16Addr, m_pbBus->ReadWriteLog()[I].ui16Address );
 				}
-				if ( m_pbBus->ReadWriteLog()[I].ui8Value != cvoVerifyMe.vCycles[I].ui8Value ) {
-					::OutputDebugStringA( cvoVerifyMe.sName.c_str() );
-					::OutputDebugStringA( "\r\nCPU Failure: Cycle Value Wrong\r\n" );
-					::OutputDebugStringA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].ui8Value ) +
-						std::string( " (" ) + ee::CExpEval::ToHex( uint64_t( cvoVerifyMe.vCycles[I].ui8Value ) ) + std::string( ") Got: " ) + std::to_string( m_pbBus->ReadWriteLog()[I].ui8Value ) +
-						std::string( " (" ) + ee::CExpEval::ToHex( uint64_t( m_pbBus->ReadWriteLog()[I].ui8Value ) ) + std::string( ")" ) ).c_str() );
-					::OutputDebugStringA( "\r\n\r\n" );
+				if ( m_pbBus->ReadWriteLog()[I].ui8Value != _cvoTest.vCycles[I].ui8Value ) {
+					Mismatch( (sCycle + "Value Wrong").c_str(), _cvoTest.vCycles[I].ui8Value, m_pbBus->ReadWriteLog()[I].ui8Value );
 				}
-				if ( m_pbBus->ReadWriteLog()[I].bRead != cvoVerifyMe.vCycles[I].bRead ) {
-					::OutputDebugStringA( cvoVerifyMe.sName.c_str() );
-					::OutputDebugStringA( "\r\nCPU Failure: Cycle Read/Write Wrong\r\n" );
-					::OutputDebugStringA( (std::string( "Expected: ") + std::to_string( cvoVerifyMe.vCycles[I].bRead ) + std::string( " Got: " ) + std::to_string( m_pbBus->ReadWriteLog()[I].bRead ) ).c_str() );
-					::OutputDebugStringA( "\r\n\r\n" );
+				if ( m_pbBus->ReadWriteLog()[I].bRead != _cvoTest.vCycles[I].bRead ) {
+					Mismatch( (sCycle + "Read/Write Wrong").c_str(), _cvoTest.vCycles[I].bRead, m_pbBus->ReadWriteLog()[I].bRead );
 				}
 			}
 		}
-		return i32Cnt;
+		return _cvrResult.vFailures.empty();
 	}
 #endif	// #ifdef LSN_CPU_VERIFY
 
@@ -298,6 +298,43 @@ namespace lsn {
 
 
 #ifdef LSN_CPU_VERIFY
+		// == Types.
+		/** A RAM value in a test state. */
+		struct LSN_CPU_VERIFY_RAM {
+			uint16_t										ui16Addr;
+			uint8_t											ui8Value;
+		};
+
+		/** The registers and RAM before or after a test. */
+		struct LSN_CPU_VERIFY_STATE {
+			LSN_REGISTERS									cvrRegisters;
+			std::vector<LSN_CPU_VERIFY_RAM>					vRam;
+		};
+
+		/** A single bus access made by a test. */
+		struct LSN_CPU_VERIFY_CYCLE {
+			uint16_t										ui16Addr;
+			uint8_t											ui8Value;
+			bool											bRead;
+		};
+
+		/** A test. */
+		struct LSN_CPU_VERIFY_OBJ {
+			std::string										sName;
+			LSN_CPU_VERIFY_STATE							cvsStart;
+			LSN_CPU_VERIFY_STATE							cvsEnd;
+			std::vector<LSN_CPU_VERIFY_CYCLE>				vCycles;
+		};
+
+		/** The result of running a test. */
+		struct LSN_CPU_VERIFY_RESULT {
+			int32_t											i32Cycles = 0;											/**< The number of cycles the test ran. */
+			bool											bPollingMismatch = false;								/**< Set if interrupt polling happened on an unexpected cycle. */
+			std::vector<std::string>						vFailures;												/**< Descriptions of every mismatch against the expected final state and cycle trace. */
+		};
+
+
+		// == Functions.
 		/**
 		 * Runs a test given a JSON's value representing the test to run.
 		 *
@@ -307,6 +344,35 @@ namespace lsn {
 		 */
 		int32_t												RunJsonTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest );
 
+		/**
+		 * Runs a test.  The bus must have had its default map applied (CCpuBus::ApplyMap()) once before the first test.
+		 *
+		 * \param _cvoTest The test to run.
+		 * \param _cvrResult Holds the cycle count and any mismatches.
+		 * \return Returns true if the final state and cycle trace matched the test.
+		 */
+		bool												RunTest( const LSN_CPU_VERIFY_OBJ &_cvoTest, LSN_CPU_VERIFY_RESULT &_cvrResult );
+
+		/**
+		 * Given a JSON object and the value for the test to run, this loads the test and fills a LSN_CPU_VERIFY structure.
+		 *
+		 * \param _jJson The JSON file.
+		 * \param _jvTest The test to run.
+		 * \param _cvoTest The test structure to fill out.
+		 * \return Returns true if the JSON data was successfully extracted and the test created.
+		 */
+		static bool											GetTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest, LSN_CPU_VERIFY_OBJ &_cvoTest );
+
+		/**
+		 * Fills out a LSN_CPU_VERIFY_STATE structure given a JSON "initial" or "final" member.
+		 *
+		 * \param _jJson The JSON file.
+		 * \param _jvState The bject member representing the state to load.
+		 * \param _cvsState The state structure to fill.
+		 * \return Returns true if the state was loaded.
+		 */
+		static bool											LoadState( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvState, LSN_CPU_VERIFY_STATE &_cvsState );
+
 		/**
 		 * Gets the instruction table.
 		 * 
@@ -328,9 +394,11 @@ namespace lsn {
 		 * Sets the mapper.
 		 *
 		 * \param _pmbMapper A pointer to the mapper to be ticked with each CPU cycle.
+		 * \param _bTick If false, the mapper does not need to be ticked.
 		 */
-		void												SetMapper( CMapperBase * _pmbMapper ) {
+		void												SetMapper( CMapperBase * _pmbMapper, bool _bTick = true ) {
 			m_pmbMapper = _pmbMapper;
+			m_bTickMapper = _pmbMapper && _bTick;
 		}
 
 
@@ -379,6 +447,7 @@ namespace lsn {
 		PfTicks												m_pfDmcDmaFuncs[2]{};																/**< DMC DMA function backups. */
 		CInputPoller *										m_pipPoller = nullptr;																/**< The input poller. */
 		CMapperBase *										m_pmbMapper = nullptr;																/**< The mapper, which gets ticked on each CPU cycle. */
+		bool												m_bTickMapper = false;																/**< Whether the mapper needs to be ticked. */
 		CSystemBase *										m_psbSystem = nullptr;																/**< Pointer to the system.  Allows access to the APU
 
 		//const PfCycle *										m_pfCurInstruction;
@@ -424,56 +493,6 @@ namespace lsn {
 		static LSN_INSTR									m_iInstructionSet[256];																/**< The instruction set. */
 		
 
-
-#ifdef LSN_CPU_VERIFY
-		// == Types.
-		struct LSN_CPU_VERIFY_RAM {
-			uint16_t										ui16Addr;
-			uint8_t											ui8Value;
-		};
-
-		struct LSN_CPU_VERIFY_STATE {
-			LSN_REGISTERS									cvrRegisters;
-			std::vector<LSN_CPU_VERIFY_RAM>					vRam;
-		};
-
-		struct LSN_CPU_VERIFY_CYCLE {
-			uint16_t										ui16Addr;
-			uint8_t											ui8Value;
-			bool											bRead;
-		};
-
-		struct LSN_CPU_VERIFY_OBJ {
-			std::string										sName;
-			LSN_CPU_VERIFY_STATE							cvsStart;
-			LSN_CPU_VERIFY_STATE							cvsEnd;
-			std::vector<LSN_CPU_VERIFY_CYCLE>				vCycles;
-		};
-
-
-		// == Functions.
-		/**
-		 * Given a JSON object and the value for the test to run, this loads the test and fills a LSN_CPU_VERIFY structure.
-		 *
-		 * \param _jJson The JSON file.
-		 * \param _jvTest The test to run.
-		 * \param _cvoTest The test structure to fill out.
-		 * \return Returns true if the JSON data was successfully extracted and the test created.
-		 */
-		bool												GetTest( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvTest, LSN_CPU_VERIFY_OBJ &_cvoTest );
-
-		/**
-		 * Fills out a LSN_CPU_VERIFY_STATE structure given a JSON "initial" or "final" member.
-		 *
-		 * \param _jJson The JSON file.
-		 * \param _jvState The bject member representing the state to load.
-		 * \param _cvsState The state structure to fill.
-		 * \return Returns true if the state was loaded.
-		 */
-		bool												LoadState( lson::CJson &_jJson, const lson::CJsonContainer::LSON_JSON_VALUE &_jvState, LSN_CPU_VERIFY_STATE &_cvsState );
-#endif	// #ifdef LSN_CPU_VERIFY
-
-
 		// == Functions.
 		/** Fetches the next opcode and begins the next instruction. */
 		inline void											Tick_NextInstructionStd();
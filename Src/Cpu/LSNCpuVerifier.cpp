@@ -0,0 +1,541 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Runs the SingleStepTests 6502 corpus against the CPU across multiple threads.  The JSON tests are converted once into a
+ *	compact binary cache that is reloaded on later runs.
+ */
+
+
+#ifdef LSN_CPU_VERIFY
+
+#include "LSNCpuVerifier.h"
+#include "../File/LSNStdFile.h"
+#include "../Utilities/LSNStream.h"
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <thread>
+
+
+#define LSN_CPU_VERIFIER_CACHE_VERSION						0
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Runs every opcode's tests.
+	 *
+	 * \param _pJsonFolder The folder containing the "XX.json" test files.
+	 * \param _pCacheFolder The folder in which to keep the binary cache.  Created if it does not exist.
+	 * \param _rResults Holds the results of each opcode.
+	 * \param _stThreads The number of threads to use, or 0 to use one per hardware thread.
+	 * \param _stMaxFailures The maximum number of failing tests to record per opcode.
+	 * \return Returns true if every test that was loaded passed.
+	 */
+	bool CCpuVerifier::Run( const std::filesystem::path &_pJsonFolder, const std::filesystem::path &_pCacheFolder, LSN_RESULTS &_rResults,
+		size_t _stThreads, size_t _stMaxFailures ) {
+		for ( auto & orResult : _rResults ) { orResult = LSN_OPCODE_RESULT(); }
+		std::error_code ecErr;
+		std::filesystem::create_directories( _pCacheFolder, ecErr );
+
+		if ( !_stThreads ) { _stThreads = std::max<size_t>( std::thread::hardware_concurrency(), 1 ); }
+		_stThreads = std::min<size_t>( _stThreads, _rResults.size() );
+
+		// Opcodes are handed out one at a time; each worker has its own bus and CPU so that no state is shared.
+		std::atomic<size_t> aNext = 0;
+		auto Worker = [&]() {
+			try {
+				std::unique_ptr<CCpuBus> pbBus = std::make_unique<CCpuBus>();
+				pbBus->ApplyMap();
+				std::unique_ptr<CCpu6502> pcCpu = std::make_unique<CCpu6502>( pbBus.get(), nullptr );
+				std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> vTests;
+				CCpu6502::LSN_CPU_VERIFY_RESULT cvrResult;
+				for ( size_t I = aNext++; I < _rResults.size(); I = aNext++ ) {
+					LSN_OPCODE_RESULT & orThis = _rResults[I];
+					if ( !LoadTests( _pJsonFolder, _pCacheFolder, uint8_t( I ), vTests ) ) { continue; }
+					orThis.bLoaded = true;
+					for ( size_t J = 0; J < vTests.size(); ++J ) {
+						++orThis.ui32Tests;
+						bool bPassed = pcCpu->RunTest( vTests[J], cvrResult );
+						if ( cvrResult.bPollingMismatch ) { ++orThis.ui32PollingMismatches; }
+						if ( cvrResult.i32Cycles > 0 ) {
+							orThis.i32MinCycles = std::min( orThis.i32MinCycles, cvrResult.i32Cycles );
+							orThis.i32MaxCycles = std::max( orThis.i32MaxCycles, cvrResult.i32Cycles );
+						}
+						if ( bPassed ) {
+							++orThis.ui32Passed;
+						}
+						else if ( orThis.vFailures.size() < _stMaxFailures ) {
+							std::string sFailure = vTests[J].sName;
+							for ( size_t K = 0; K < cvrResult.vFailures.size(); ++K ) {
+								sFailure += "\r\n\t" + CUtilities::Replace( cvrResult.vFailures[K], std::string( "\r\n" ), std::string( "\r\n\t" ) );
+							}
+							orThis.vFailures.push_back( std::move( sFailure ) );
+						}
+					}
+				}
+			}
+			catch ( ... ) {}
+		};
+
+		std::vector<std::thread> vThreads;
+		for ( size_t I = 1; I < _stThreads; ++I ) {
+			vThreads.emplace_back( Worker );
+		}
+		Worker();
+		for ( auto & tThread : vThreads ) { tThread.join(); }
+
+		for ( size_t I = 0; I < _rResults.size(); ++I ) {
+			if ( _rResults[I].ui32Passed != _rResults[I].ui32Tests ) { return false; }
+		}
+		return true;
+	}
+
+	/**
+	 * Creates a human-readable report of the results.
+	 *
+	 * \param _rResults The results to report.
+	 * \param _bFailuresOnly If true, only opcodes with failures or cycle-count discrepancies are listed.
+	 * \return Returns the report.
+	 */
+	std::string CCpuVerifier::Report( const LSN_RESULTS &_rResults, bool _bFailuresOnly ) {
+		std::string sRet;
+		uint64_t ui64Tests = 0, ui64Passed = 0;
+		uint32_t ui32Missing = 0, ui32FailedOps = 0;
+		for ( size_t I = 0; I < _rResults.size(); ++I ) {
+			const LSN_OPCODE_RESULT & orThis = _rResults[I];
+			if ( !orThis.bLoaded ) {
+				++ui32Missing;
+				continue;
+			}
+			ui64Tests += orThis.ui32Tests;
+			ui64Passed += orThis.ui32Passed;
+			if ( orThis.ui32Passed != orThis.ui32Tests ) { ++ui32FailedOps; }
+
+			const CCpu6502::LSN_INSTR & iInstr = CCpu6502::InstrTable()[I];
+			bool bCycleMismatch = orThis.ui32Tests && iInstr.iInstruction != CCpu6502::LSN_I_JAM && orThis.i32MinCycles != iInstr.ui8TotalCycles;
+			if ( _bFailuresOnly && orThis.ui32Passed == orThis.ui32Tests && !bCycleMismatch && !orThis.ui32PollingMismatches ) { continue; }
+
+			sRet += std::format( "{:02X} {}\t{}\t{}/{} passed\tCycles: {}", I, CCpu6502::m_smdInstMetaData[iInstr.iInstruction].pcName, iInstr.pcTypeString,
+				orThis.ui32Passed, orThis.ui32Tests, orThis.i32MinCycles );
+			if ( orThis.i32MaxCycles != orThis.i32MinCycles ) {
+				sRet += std::format( "-{}", orThis.i32MaxCycles );
+			}
+			sRet += "\r\n";
+			if ( bCycleMismatch ) {
+				sRet += std::format( "\t*** CHECK CYCLE COUNT {} -> {} ***\r\n", iInstr.ui8TotalCycles, orThis.i32MinCycles );
+			}
+			if ( orThis.ui32PollingMismatches ) {
+				sRet += std::format( "\tDouble-check polling ({} tests).\r\n", orThis.ui32PollingMismatches );
+			}
+			for ( size_t J = 0; J < orThis.vFailures.size(); ++J ) {
+				sRet += "\t" + CUtilities::Replace( orThis.vFailures[J], std::string( "\r\n" ), std::string( "\r\n\t" ) ) + "\r\n";
+			}
+		}
+		sRet += std::format( "{}/{} tests passed; {} opcode(s) failed; {} opcode(s) not found.\r\n", ui64Passed, ui64Tests, ui32FailedOps, ui32Missing );
+		return sRet;
+	}
+
+	/**
+	 * Loads the tests for an opcode, from the binary cache if it is up-to-date or else from the JSON file (updating the cache).
+	 *
+	 * \param _pJsonFolder The folder containing the "XX.json" test files.
+	 * \param _pCacheFolder The folder containing the binary cache.
+	 * \param _ui8Opcode The opcode whose tests are to be loaded.
+	 * \param _vTests Holds the loaded tests.
+	 * \return Returns true if the tests were loaded.
+	 */
+	bool CCpuVerifier::LoadTests( const std::filesystem::path &_pJsonFolder, const std::filesystem::path &_pCacheFolder, uint8_t _ui8Opcode,
+		std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests ) {
+		try {
+			std::filesystem::path pJson = _pJsonFolder / std::format( "{:02X}.json", _ui8Opcode );
+			std::filesystem::path pCache = _pCacheFolder / std::format( "{:02X}.bin", _ui8Opcode );
+
+			std::error_code ecErr;
+			uint64_t ui64Size = uint64_t( std::filesystem::file_size( pJson, ecErr ) );
+			if ( ecErr ) {
+				// No JSON file; use the cache alone if there is one (for machines that only have the cache).
+				return LoadCache( pCache, 0, 0, _vTests );
+			}
+			uint64_t ui64Time = uint64_t( std::filesystem::last_write_time( pJson, ecErr ).time_since_epoch().count() );
+			if ( ecErr ) { return false; }
+
+			if ( LoadCache( pCache, ui64Size, ui64Time, _vTests ) ) { return true; }
+			if ( !LoadJson( pJson, _vTests ) ) { return false; }
+			SaveCache( pCache, ui64Size, ui64Time, _vTests );
+			return true;
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * Times loading every "XX.json" file with the DOM parser (lson::CJson) against the streaming reader (lson::CJsonReader).  Only parsing
+	 *	and conversion into tests are timed; each file is read into memory beforehand.
+	 *
+	 * \param _pJsonFolder The folder containing the "XX.json" test files.
+	 * \return Returns a human-readable report of the timings.
+	 */
+	std::string CCpuVerifier::Benchmark( const std::filesystem::path &_pJsonFolder ) {
+		std::string sRet;
+		uint64_t ui64Bytes = 0;
+		double dDomTime = 0.0, dStreamTime = 0.0;
+		size_t stFiles = 0;
+		try {
+			std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> vTests;
+			for ( size_t I = 0; I < 256; ++I ) {
+				std::vector<uint8_t> vBytes;
+				{
+					CStdFile sfFile;
+					if ( !sfFile.Open( _pJsonFolder / std::format( "{:02X}.json", I ) ) ) { continue; }
+					if ( !sfFile.LoadToMemory( vBytes ) ) { continue; }
+				}
+				vBytes.push_back( 0 );
+				const char * pcJson = reinterpret_cast<const char *>(vBytes.data());
+				size_t stLen = vBytes.size() - 1;
+
+				auto tStart = std::chrono::steady_clock::now();
+				bool bDom = ParseDom( pcJson, vTests );
+				size_t stDomTests = vTests.size();
+				auto tMid = std::chrono::steady_clock::now();
+				bool bStream = ParseStream( pcJson, stLen, vTests );
+				auto tEnd = std::chrono::steady_clock::now();
+
+				double dDom = std::chrono::duration<double>( tMid - tStart ).count();
+				double dStream = std::chrono::duration<double>( tEnd - tMid ).count();
+				if ( !bDom || !bStream || stDomTests != vTests.size() ) {
+					sRet += std::format( "{:02X}.json: DOM {}, stream {} ({} vs. {} tests).\r\n", I, bDom ? "succeeded" : "failed", bStream ? "succeeded" : "failed",
+						stDomTests, vTests.size() );
+				}
+				ui64Bytes += stLen;
+				dDomTime += dDom;
+				dStreamTime += dStream;
+				++stFiles;
+			}
+		}
+		catch ( ... ) { sRet += "Out of memory.\r\n"; }
+
+		double dMb = double( ui64Bytes ) / (1024.0 * 1024.0);
+		sRet += std::format( "{} file(s), {:.1f} MB.\r\n", stFiles, dMb );
+		sRet += std::format( "DOM (lson::CJson):\t\t{:.3f} s\t{:.1f} MB/s\r\n", dDomTime, dDomTime ? dMb / dDomTime : 0.0 );
+		sRet += std::format( "Stream (lson::CJsonReader):\t{:.3f} s\t{:.1f} MB/s\r\n", dStreamTime, dStreamTime ? dMb / dStreamTime : 0.0 );
+		if ( dStreamTime ) {
+			sRet += std::format( "Speed-up: {:.2f}x\r\n", dDomTime / dStreamTime );
+		}
+		return sRet;
+	}
+
+	/**
+	 * Loads tests from a JSON file.
+	 *
+	 * \param _pFile The JSON file to load.
+	 * \param _vTests Holds the loaded tests.
+	 * \return Returns true if the file was loaded and every test in it was valid.
+	 */
+	bool CCpuVerifier::LoadJson( const std::filesystem::path &_pFile, std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests ) {
+		_vTests.clear();
+		try {
+			std::vector<uint8_t> vBytes;
+			{
+				CStdFile sfFile;
+				if ( !sfFile.Open( _pFile ) ) { return false; }
+				if ( !sfFile.LoadToMemory( vBytes ) ) { return false; }
+			}
+			return ParseStream( reinterpret_cast<const char *>(vBytes.data()), vBytes.size(), _vTests );
+		}
+		catch ( ... ) {
+			_vTests.clear();
+			return false;
+		}
+	}
+
+	/**
+	 * Converts JSON text into tests by building a lson::CJson DOM.
+	 *
+	 * \param _pcJson The NULL-terminated JSON text.
+	 * \param _vTests Holds the loaded tests.
+	 * \return Returns true if the text was parsed and every test in it was valid.
+	 */
+	bool CCpuVerifier::ParseDom( const char * _pcJson, std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests ) {
+		_vTests.clear();
+		try {
+			lson::CJson jSon;
+			if ( !jSon.SetJson( _pcJson ) ) { return false; }
+			const lson::CJsonContainer::LSON_JSON_VALUE & jvRoot = jSon.GetContainer()->GetValue( jSon.GetContainer()->GetRoot() );
+			if ( jvRoot.vtType != lson::CJsonContainer::LSON_VT_ARRAY ) { return false; }
+			_vTests.resize( jvRoot.vArray.size() );
+			for ( size_t I = 0; I < jvRoot.vArray.size(); ++I ) {
+				if ( !CCpu6502::GetTest( jSon, jSon.GetContainer()->GetValue( jvRoot.vArray[I] ), _vTests[I] ) ) {
+					_vTests.clear();
+					return false;
+				}
+			}
+			return true;
+		}
+		catch ( ... ) {
+			_vTests.clear();
+			return false;
+		}
+	}
+
+	/**
+	 * Converts JSON text into tests with the streaming reader, without building a DOM.
+	 *
+	 * \param _pcJson The JSON text.
+	 * \param _stLen The number of bytes to which _pcJson points.
+	 * \param _vTests Holds the loaded tests.
+	 * \return Returns true if the text was parsed and every test in it was valid.
+	 */
+	bool CCpuVerifier::ParseStream( const char * _pcJson, size_t _stLen, std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests ) {
+		_vTests.clear();
+		try {
+			lson::CJsonReader jrReader;
+			if ( !jrReader.SetJson( _pcJson, _stLen ) ) { return false; }
+			lson::CJsonReader::LSON_TOKEN tToken;
+			if ( !jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_START_ARRAY ) { return false; }
+			while ( jrReader.Next( tToken ) ) {
+				if ( tToken.ttType == lson::CJsonReader::LSON_TT_END_ARRAY ) { return true; }
+				if ( tToken.ttType != lson::CJsonReader::LSON_TT_START_OBJECT ) { break; }
+				_vTests.emplace_back();
+				if ( !ReadTest( jrReader, _vTests.back() ) ) { break; }
+			}
+			_vTests.clear();
+			return false;
+		}
+		catch ( ... ) {
+			_vTests.clear();
+			return false;
+		}
+	}
+
+	/**
+	 * Reads a test object from a streaming reader.  The object's "{" must already have been read.
+	 *
+	 * \param _jrReader The reader.
+	 * \param _cvoTest Holds the test.
+	 * \return Returns true if the test was read and had every required member.
+	 */
+	bool CCpuVerifier::ReadTest( lson::CJsonReader &_jrReader, CCpu6502::LSN_CPU_VERIFY_OBJ &_cvoTest ) {
+		lson::CJsonReader::LSON_TOKEN tToken;
+		uint32_t ui32Found = 0;
+		while ( _jrReader.Next( tToken ) ) {
+			if ( tToken.ttType == lson::CJsonReader::LSON_TT_END_OBJECT ) { return ui32Found == 0xF; }
+			if ( tToken.ttType != lson::CJsonReader::LSON_TT_KEY ) { return false; }
+			if ( tToken.svString == "name" ) {
+				if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_STRING ) { return false; }
+				_cvoTest.sName = tToken.svString;
+				ui32Found |= 0x1;
+			}
+			else if ( tToken.svString == "initial" || tToken.svString == "final" ) {
+				bool bInitial = tToken.svString == "initial";
+				if ( !ReadState( _jrReader, bInitial ? _cvoTest.cvsStart : _cvoTest.cvsEnd ) ) { return false; }
+				ui32Found |= bInitial ? 0x2 : 0x4;
+			}
+			else if ( tToken.svString == "cycles" ) {
+				if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_START_ARRAY ) { return false; }
+				while ( _jrReader.Next( tToken ) && tToken.ttType == lson::CJsonReader::LSON_TT_START_ARRAY ) {
+					double dAddr, dValue;
+					if ( !ReadNumber( _jrReader, dAddr ) || !ReadNumber( _jrReader, dValue ) ) { return false; }
+					if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_STRING ) { return false; }
+					CCpu6502::LSN_CPU_VERIFY_CYCLE cvcCycle = {
+						.ui16Addr = uint16_t( dAddr ),
+						.ui8Value = uint8_t( dValue ),
+						.bRead = tToken.svString == "read",
+					};
+					_cvoTest.vCycles.push_back( cvcCycle );
+					if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_END_ARRAY ) { return false; }
+				}
+				if ( tToken.ttType != lson::CJsonReader::LSON_TT_END_ARRAY ) { return false; }
+				ui32Found |= 0x8;
+			}
+			else if ( !_jrReader.Skip() ) { return false; }
+		}
+		return false;
+	}
+
+	/**
+	 * Reads an "initial" or "final" state object from a streaming reader, starting at its "{".
+	 *
+	 * \param _jrReader The reader.
+	 * \param _cvsState Holds the state.
+	 * \return Returns true if the state was read and had every required member.
+	 */
+	bool CCpuVerifier::ReadState( lson::CJsonReader &_jrReader, CCpu6502::LSN_CPU_VERIFY_STATE &_cvsState ) {
+		lson::CJsonReader::LSON_TOKEN tToken;
+		if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_START_OBJECT ) { return false; }
+		uint32_t ui32Found = 0;
+		while ( _jrReader.Next( tToken ) ) {
+			if ( tToken.ttType == lson::CJsonReader::LSON_TT_END_OBJECT ) { return ui32Found == 0x7F; }
+			if ( tToken.ttType != lson::CJsonReader::LSON_TT_KEY ) { return false; }
+			if ( tToken.svString == "ram" ) {
+				if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_START_ARRAY ) { return false; }
+				while ( _jrReader.Next( tToken ) && tToken.ttType == lson::CJsonReader::LSON_TT_START_ARRAY ) {
+					double dAddr, dValue;
+					if ( !ReadNumber( _jrReader, dAddr ) || !ReadNumber( _jrReader, dValue ) ) { return false; }
+					CCpu6502::LSN_CPU_VERIFY_RAM cvrRam = {
+						.ui16Addr = uint16_t( dAddr ),
+						.ui8Value = uint8_t( dValue ),
+					};
+					_cvsState.vRam.push_back( cvrRam );
+					if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_END_ARRAY ) { return false; }
+				}
+				if ( tToken.ttType != lson::CJsonReader::LSON_TT_END_ARRAY ) { return false; }
+				ui32Found |= 0x40;
+				continue;
+			}
+
+			std::string_view svKey = tToken.svString;
+			double dValue;
+			if ( svKey == "pc" || svKey == "s" || svKey == "a" || svKey == "x" || svKey == "y" || svKey == "p" ) {
+				if ( !ReadNumber( _jrReader, dValue ) ) { return false; }
+			}
+			else {
+				if ( !_jrReader.Skip() ) { return false; }
+				continue;
+			}
+			if ( svKey == "pc" ) { _cvsState.cvrRegisters.ui16Pc = uint16_t( dValue ); ui32Found |= 0x01; }
+			else if ( svKey == "s" ) { _cvsState.cvrRegisters.ui8S = uint8_t( dValue ); ui32Found |= 0x02; }
+			else if ( svKey == "a" ) { _cvsState.cvrRegisters.ui8A = uint8_t( dValue ); ui32Found |= 0x04; }
+			else if ( svKey == "x" ) { _cvsState.cvrRegisters.ui8X = uint8_t( dValue ); ui32Found |= 0x08; }
+			else if ( svKey == "y" ) { _cvsState.cvrRegisters.ui8Y = uint8_t( dValue ); ui32Found |= 0x10; }
+			else { _cvsState.cvrRegisters.ui8Status = uint8_t( dValue ); ui32Found |= 0x20; }
+		}
+		return false;
+	}
+
+	/**
+	 * Reads a number from a streaming reader.
+	 *
+	 * \param _jrReader The reader.
+	 * \param _dValue Holds the number.
+	 * \return Returns true if the next token was a number.
+	 */
+	bool CCpuVerifier::ReadNumber( lson::CJsonReader &_jrReader, double &_dValue ) {
+		lson::CJsonReader::LSON_TOKEN tToken;
+		if ( !_jrReader.Next( tToken ) || tToken.ttType != lson::CJsonReader::LSON_TT_NUMBER ) { return false; }
+		_dValue = tToken.dNumber;
+		return true;
+	}
+
+	/**
+	 * Loads tests from a binary cache file.  Fails if the file was made from a different JSON file.
+	 *
+	 * \param _pFile The cache file to load.
+	 * \param _ui64SourceSize The size of the JSON file from which the cache must have been made.
+	 * \param _ui64SourceTime The modification time of the JSON file from which the cache must have been made.
+	 * \param _vTests Holds the loaded tests.
+	 * \return Returns true if the cache file was loaded.
+	 */
+	bool CCpuVerifier::LoadCache( const std::filesystem::path &_pFile, uint64_t _ui64SourceSize, uint64_t _ui64SourceTime,
+		std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests ) {
+		_vTests.clear();
+		try {
+			std::vector<uint8_t> vBytes;
+			{
+				CStdFile sfFile;
+				if ( !sfFile.Open( _pFile ) ) { return false; }
+				if ( !sfFile.LoadToMemory( vBytes ) ) { return false; }
+			}
+			CStream sStream( vBytes );
+
+			uint32_t ui32Version, ui32Total;
+			uint64_t ui64Size, ui64Time;
+			if ( !sStream.Read( ui32Version ) || ui32Version != LSN_CPU_VERIFIER_CACHE_VERSION ) { return false; }
+			if ( !sStream.Read( ui64Size ) || !sStream.Read( ui64Time ) ) { return false; }
+			// A source size of 0 accepts any cache (used when the JSON file is absent).
+			if ( _ui64SourceSize && (ui64Size != _ui64SourceSize || ui64Time != _ui64SourceTime) ) { return false; }
+			if ( !sStream.Read( ui32Total ) ) { return false; }
+
+			auto ReadState = [&]( CCpu6502::LSN_CPU_VERIFY_STATE &_cvsState ) {
+				uint32_t ui32Ram;
+				if ( !sStream.Read( _cvsState.cvrRegisters.ui8A ) || !sStream.Read( _cvsState.cvrRegisters.ui8X ) || !sStream.Read( _cvsState.cvrRegisters.ui8Y ) ||
+					!sStream.Read( _cvsState.cvrRegisters.ui8S ) || !sStream.Read( _cvsState.cvrRegisters.ui8Status ) || !sStream.Read( _cvsState.cvrRegisters.ui16Pc ) ) { return false; }
+				if ( !sStream.Read( ui32Ram ) || ui32Ram > sStream.Remaining() / 3 ) { return false; }
+				_cvsState.vRam.resize( ui32Ram );
+				for ( uint32_t I = 0; I < ui32Ram; ++I ) {
+					if ( !sStream.Read( _cvsState.vRam[I].ui16Addr ) || !sStream.Read( _cvsState.vRam[I].ui8Value ) ) { return false; }
+				}
+				return true;
+			};
+
+			_vTests.resize( ui32Total );
+			for ( uint32_t I = 0; I < ui32Total; ++I ) {
+				CCpu6502::LSN_CPU_VERIFY_OBJ & cvoThis = _vTests[I];
+				if ( !sStream.ReadString( cvoThis.sName ) ) { _vTests.clear(); return false; }
+				if ( !ReadState( cvoThis.cvsStart ) || !ReadState( cvoThis.cvsEnd ) ) { _vTests.clear(); return false; }
+				uint32_t ui32Cycles;
+				if ( !sStream.Read( ui32Cycles ) || ui32Cycles > sStream.Remaining() / 4 ) { _vTests.clear(); return false; }
+				cvoThis.vCycles.resize( ui32Cycles );
+				for ( uint32_t J = 0; J < ui32Cycles; ++J ) {
+					uint8_t ui8Read;
+					if ( !sStream.Read( cvoThis.vCycles[J].ui16Addr ) || !sStream.Read( cvoThis.vCycles[J].ui8Value ) || !sStream.Read( ui8Read ) ) { _vTests.clear(); return false; }
+					cvoThis.vCycles[J].bRead = ui8Read != 0;
+				}
+			}
+			return true;
+		}
+		catch ( ... ) {
+			_vTests.clear();
+			return false;
+		}
+	}
+
+	/**
+	 * Saves tests to a binary cache file.
+	 *
+	 * \param _pFile The cache file to create.
+	 * \param _ui64SourceSize The size of the JSON file from which the tests were loaded.
+	 * \param _ui64SourceTime The modification time of the JSON file from which the tests were loaded.
+	 * \param _vTests The tests to save.
+	 * \return Returns true if the cache file was saved.
+	 */
+	bool CCpuVerifier::SaveCache( const std::filesystem::path &_pFile, uint64_t _ui64SourceSize, uint64_t _ui64SourceTime,
+		const std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests ) {
+		try {
+			std::vector<uint8_t> vBytes;
+			CStream sStream( vBytes );
+			sStream.Write( uint32_t( LSN_CPU_VERIFIER_CACHE_VERSION ) );
+			sStream.Write( _ui64SourceSize );
+			sStream.Write( _ui64SourceTime );
+			sStream.Write( uint32_t( _vTests.size() ) );
+
+			auto WriteState = [&]( const CCpu6502::LSN_CPU_VERIFY_STATE &_cvsState ) {
+				sStream.Write( _cvsState.cvrRegisters.ui8A );
+				sStream.Write( _cvsState.cvrRegisters.ui8X );
+				sStream.Write( _cvsState.cvrRegisters.ui8Y );
+				sStream.Write( _cvsState.cvrRegisters.ui8S );
+				sStream.Write( _cvsState.cvrRegisters.ui8Status );
+				sStream.Write( _cvsState.cvrRegisters.ui16Pc );
+				sStream.Write( uint32_t( _cvsState.vRam.size() ) );
+				for ( size_t I = 0; I < _cvsState.vRam.size(); ++I ) {
+					sStream.Write( _cvsState.vRam[I].ui16Addr );
+					sStream.Write( _cvsState.vRam[I].ui8Value );
+				}
+			};
+
+			for ( size_t I = 0; I < _vTests.size(); ++I ) {
+				const CCpu6502::LSN_CPU_VERIFY_OBJ & cvoThis = _vTests[I];
+				sStream.WriteString( std::u8string( cvoThis.sName.begin(), cvoThis.sName.end() ) );
+				WriteState( cvoThis.cvsStart );
+				WriteState( cvoThis.cvsEnd );
+				sStream.Write( uint32_t( cvoThis.vCycles.size() ) );
+				for ( size_t J = 0; J < cvoThis.vCycles.size(); ++J ) {
+					sStream.Write( cvoThis.vCycles[J].ui16Addr );
+					sStream.Write( cvoThis.vCycles[J].ui8Value );
+					sStream.Write( uint8_t( cvoThis.vCycles[J].bRead ) );
+				}
+			}
+
+			CStdFile sfFile;
+			if ( !sfFile.Create( _pFile ) ) { return false; }
+			return sfFile.WriteToFile( vBytes );
+		}
+		catch ( ... ) { return false; }
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_CPU_VERIFY
@@ -0,0 +1,181 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Runs the SingleStepTests 6502 corpus against the CPU across multiple threads.  The JSON tests are converted once into a
+ *	compact binary cache that is reloaded on later runs.
+ */
+
+
+#pragma once
+
+#ifdef LSN_CPU_VERIFY
+
+#include "LSNCpu6502.h"
+#include "LSONJsonReader.h"
+
+#include <array>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CCpuVerifier
+	 * \brief Runs the SingleStepTests 6502 corpus against the CPU across multiple threads.
+	 *
+	 * Description: Runs the SingleStepTests 6502 corpus (one "XX.json" file per opcode) against the CPU.  Opcodes are handed out to worker
+	 *	threads, each of which owns its own bus and CPU.  Each JSON file is converted once into a binary cache file holding the same tests,
+	 *	which is reloaded as long as the JSON file has not changed.
+	 */
+	class CCpuVerifier {
+	public :
+		// == Types.
+		/** The results of one opcode. */
+		struct LSN_OPCODE_RESULT {
+			bool											bLoaded = false;						/**< Set if the tests for the opcode were found and loaded. */
+			uint32_t										ui32Tests = 0;							/**< The number of tests run. */
+			uint32_t										ui32Passed = 0;							/**< The number of tests that passed. */
+			uint32_t										ui32PollingMismatches = 0;				/**< The number of tests that polled interrupts on an unexpected cycle. */
+			int32_t											i32MinCycles = INT32_MAX;				/**< The fewest cycles any test took. */
+			int32_t											i32MaxCycles = 0;						/**< The most cycles any test took. */
+			std::vector<std::string>						vFailures;								/**< The names and mismatches of the first failing tests. */
+		};
+
+		/** The results of every opcode. */
+		typedef std::array<LSN_OPCODE_RESULT, 256>			LSN_RESULTS;
+
+
+		// == Functions.
+		/**
+		 * Runs every opcode's tests.
+		 *
+		 * \param _pJsonFolder The folder containing the "XX.json" test files.
+		 * \param _pCacheFolder The folder in which to keep the binary cache.  Created if it does not exist.
+		 * \param _rResults Holds the results of each opcode.
+		 * \param _stThreads The number of threads to use, or 0 to use one per hardware thread.
+		 * \param _stMaxFailures The maximum number of failing tests to record per opcode.
+		 * \return Returns true if every test that was loaded passed.
+		 */
+		static bool											Run( const std::filesystem::path &_pJsonFolder, const std::filesystem::path &_pCacheFolder, LSN_RESULTS &_rResults,
+			size_t _stThreads = 0, size_t _stMaxFailures = 8 );
+
+		/**
+		 * Creates a human-readable report of the results.
+		 *
+		 * \param _rResults The results to report.
+		 * \param _bFailuresOnly If true, only opcodes with failures or cycle-count discrepancies are listed.
+		 * \return Returns the report.
+		 */
+		static std::string									Report( const LSN_RESULTS &_rResults, bool _bFailuresOnly = false );
+
+		/**
+		 * Times loading every "XX.json" file with the DOM parser (lson::CJson) against the streaming reader (lson::CJsonReader).  Only parsing
+		 *	and conversion into tests are timed; each file is read into memory beforehand.
+		 *
+		 * \param _pJsonFolder The folder containing the "XX.json" test files.
+		 * \return Returns a human-readable report of the timings.
+		 */
+		static std::string									Benchmark( const std::filesystem::path &_pJsonFolder );
+
+		/**
+		 * Loads the tests for an opcode, from the binary cache if it is up-to-date or else from the JSON file (updating the cache).
+		 *
+		 * \param _pJsonFolder The folder containing the "XX.json" test files.
+		 * \param _pCacheFolder The folder containing the binary cache.
+		 * \param _ui8Opcode The opcode whose tests are to be loaded.
+		 * \param _vTests Holds the loaded tests.
+		 * \return Returns true if the tests were loaded.
+		 */
+		static bool											LoadTests( const std::filesystem::path &_pJsonFolder, const std::filesystem::path &_pCacheFolder, uint8_t _ui8Opcode,
+			std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests );
+
+
+	protected :
+		// == Functions.
+		/**
+		 * Loads tests from a JSON file.
+		 *
+		 * \param _pFile The JSON file to load.
+		 * \param _vTests Holds the loaded tests.
+		 * \return Returns true if the file was loaded and every test in it was valid.
+		 */
+		static bool											LoadJson( const std::filesystem::path &_pFile, std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests );
+
+		/**
+		 * Converts JSON text into tests by building a lson::CJson DOM.
+		 *
+		 * \param _pcJson The NULL-terminated JSON text.
+		 * \param _vTests Holds the loaded tests.
+		 * \return Returns true if the text was parsed and every test in it was valid.
+		 */
+		static bool											ParseDom( const char * _pcJson, std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests );
+
+		/**
+		 * Converts JSON text into tests with the streaming reader, without building a DOM.
+		 *
+		 * \param _pcJson The JSON text.
+		 * \param _stLen The number of bytes to which _pcJson points.
+		 * \param _vTests Holds the loaded tests.
+		 * \return Returns true if the text was parsed and every test in it was valid.
+		 */
+		static bool											ParseStream( const char * _pcJson, size_t _stLen, std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests );
+
+		/**
+		 * Reads a test object from a streaming reader.  The object's "{" must already have been read.
+		 *
+		 * \param _jrReader The reader.
+		 * \param _cvoTest Holds the test.
+		 * \return Returns true if the test was read and had every required member.
+		 */
+		static bool											ReadTest( lson::CJsonReader &_jrReader, CCpu6502::LSN_CPU_VERIFY_OBJ &_cvoTest );
+
+		/**
+		 * Reads an "initial" or "final" state object from a streaming reader, starting at its "{".
+		 *
+		 * \param _jrReader The reader.
+		 * \param _cvsState Holds the state.
+		 * \return Returns true if the state was read and had every required member.
+		 */
+		static bool											ReadState( lson::CJsonReader &_jrReader, CCpu6502::LSN_CPU_VERIFY_STATE &_cvsState );
+
+		/**
+		 * Reads a number from a streaming reader.
+		 *
+		 * \param _jrReader The reader.
+		 * \param _dValue Holds the number.
+		 * \return Returns true if the next token was a number.
+		 */
+		static bool											ReadNumber( lson::CJsonReader &_jrReader, double &_dValue );
+
+		/**
+		 * Loads tests from a binary cache file.  Fails if the file was made from a different JSON file.
+		 *
+		 * \param _pFile The cache file to load.
+		 * \param _ui64SourceSize The size of the JSON file from which the cache must have been made.
+		 * \param _ui64SourceTime The modification time of the JSON file from which the cache must have been made.
+		 * \param _vTests Holds the loaded tests.
+		 * \return Returns true if the cache file was loaded.
+		 */
+		static bool											LoadCache( const std::filesystem::path &_pFile, uint64_t _ui64SourceSize, uint64_t _ui64SourceTime,
+			std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests );
+
+		/**
+		 * Saves tests to a binary cache file.
+		 *
+		 * \param _pFile The cache file to create.
+		 * \param _ui64SourceSize The size of the JSON file from which the tests were loaded.
+		 * \param _ui64SourceTime The modification time of the JSON file from which the tests were loaded.
+		 * \param _vTests The tests to save.
+		 * \return Returns true if the cache file was saved.
+		 */
+		static bool											SaveCache( const std::filesystem::path &_pFile, uint64_t _ui64SourceSize, uint64_t _ui64SourceTime,
+			const std::vector<CCpu6502::LSN_CPU_VERIFY_OBJ> &_vTests );
+	};
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_CPU_VERIFY
@@ -8,9 +8,72 @@
 
 
 #include "LSNCrc.h"
+#include "../Utilities/LSNUtilities.h"
+
+#include <cstring>
+
+#ifdef __SSE4_1__
+#include <immintrin.h>
+#include <wmmintrin.h>
+#endif	// #ifdef __SSE4_1__
 
 namespace lsn {
 
+	namespace {
+
+		/**
+		 * Builds the slice-by-16 tables for the standard key at compile time.
+		 *
+		 * \return Returns the 16 tables.  Table 0 is the standard byte-at-a-time table.
+		 */
+		constexpr std::array<std::array<uint32_t, 256>, 16> MakeSliceTables() {
+			std::array<std::array<uint32_t, 256>, 16> aTables{};
+			for ( uint32_t I = 0; I < 256; ++I ) {
+				uint32_t ui32Crc = I;
+				for ( uint32_t J = 8; J--; ) {
+					ui32Crc = (ui32Crc & 1) ? ((ui32Crc >> 1) ^ 0xEDB88320) : (ui32Crc >> 1);
+				}
+				aTables[0][I] = ui32Crc;
+			}
+			for ( size_t T = 1; T < aTables.size(); ++T ) {
+				for ( uint32_t I = 0; I < 256; ++I ) {
+					aTables[T][I] = (aTables[T-1][I] >> 8) ^ aTables[0][aTables[T-1][I]&0xFF];
+				}
+			}
+			return aTables;
+		}
+
+		/**
+		 * Multiplies a 32-bit vector by a 32x32 matrix over GF(2).
+		 *
+		 * \param _pui32Mat The matrix.
+		 * \param _ui32Vec The vector.
+		 * \return Returns the product.
+		 */
+		inline uint32_t Gf2MatrixTimes( const uint32_t * _pui32Mat, uint32_t _ui32Vec ) {
+			uint32_t ui32Sum = 0;
+			while ( _ui32Vec ) {
+				if ( _ui32Vec & 1 ) { ui32Sum ^= (*_pui32Mat); }
+				_ui32Vec >>= 1;
+				++_pui32Mat;
+			}
+			return ui32Sum;
+		}
+
+		/**
+		 * Squares a 32x32 matrix over GF(2).
+		 *
+		 * \param _pui32Square Holds the squared matrix.
+		 * \param _pui32Mat The matrix to square.
+		 */
+		inline void Gf2MatrixSquare( uint32_t * _pui32Square, const uint32_t * _pui32Mat ) {
+			for ( size_t I = 0; I < 32; ++I ) {
+				_pui32Square[I] = Gf2MatrixTimes( _pui32Mat, _pui32Mat[I] );
+			}
+		}
+
+	}
+
 	// == Members.
 	/**
 	 * Standard table of codes.
@@ -23,9 +86,9 @@ namespace lsn {
 	uint32_t CCrc::m_ui32AltTable[256] = { 0 };
 
 	/**
-	 * Has the table been initialized?
+	 * Slice-by-16 tables for the standard key.  m_aSliceTable[0] is the standard table.
 	 */
-	bool CCrc::m_bInit = false;
+	const std::array<std::array<uint32_t, 256>, 16> CCrc::m_aSliceTable = MakeSliceTables();
 
 	// == Functions.
 	/**
@@ -36,14 +99,66 @@ namespace lsn {
 	 * \return Returns the standard 32-bit CRC value for the given data
 	 */
 	uint32_t CCrc::GetCrc( const uint8_t * _pui8Data, uintptr_t _uiptrLen ) {
-		Init();
+		return Update( 0, _pui8Data, _uiptrLen );
+	}
 
-		uint32_t ui32Crc = UINT32_MAX;
-		for ( uintptr_t I = 0; I < _uiptrLen; ++I ) {
-			GetCrc( m_ui32StdTable, (*_pui8Data++), ui32Crc );
+	/**
+	 * Continues a standard 32-bit CRC calculation with more data.  Pass 0 as _ui32Crc to begin a new calculation.
+	 *
+	 * \param _ui32Crc The CRC of the data before _pui8Data.
+	 * \param _pui8Data The data to add to the CRC calculation.
+	 * \param _uiptrLen Length of the data.
+	 * \return Returns the standard 32-bit CRC of the previous data followed by the given data.
+	 */
+	uint32_t CCrc::Update( uint32_t _ui32Crc, const uint8_t * _pui8Data, uintptr_t _uiptrLen ) {
+		uint32_t ui32Crc = ~_ui32Crc;
+#ifdef __SSE4_1__
+		static const bool bPclmul = CUtilities::IsPclmulSupported() && CUtilities::IsSse4Supported();
+		if ( bPclmul && _uiptrLen >= 64 ) {
+			uintptr_t uiptrBulk = _uiptrLen & ~uintptr_t( 15 );
+			ui32Crc = UpdatePclmul( ui32Crc, _pui8Data, uiptrBulk );
+			_pui8Data += uiptrBulk;
+			_uiptrLen -= uiptrBulk;
 		}
+#endif	// #ifdef __SSE4_1__
+		return ~UpdateSlice16( ui32Crc, _pui8Data, _uiptrLen );
+	}
 
-		return ~ui32Crc;
+	/**
+	 * Combines the standard 32-bit CRC values of 2 consecutive blocks of data into the CRC of the concatenated data.
+	 *
+	 * \param _ui32Crc0 The CRC of the first block.
+	 * \param _ui32Crc1 The CRC of the second block.
+	 * \param _ui64Len1 The length of the second block.
+	 * \return Returns the standard 32-bit CRC value of the first block followed by the second block.
+	 */
+	uint32_t CCrc::Combine( uint32_t _ui32Crc0, uint32_t _ui32Crc1, uint64_t _ui64Len1 ) {
+		if ( !_ui64Len1 ) { return _ui32Crc0; }
+
+		// Applies _ui64Len1 zero bytes to _ui32Crc0 by repeatedly squaring the one-zero-bit operator (the method zlib uses).
+		uint32_t ui32Even[32];
+		uint32_t ui32Odd[32];
+		ui32Odd[0] = 0xEDB88320;
+		uint32_t ui32Row = 1;
+		for ( size_t I = 1; I < 32; ++I ) {
+			ui32Odd[I] = ui32Row;
+			ui32Row <<= 1;
+		}
+		Gf2MatrixSquare( ui32Even, ui32Odd );	// 2 zero bits.
+		Gf2MatrixSquare( ui32Odd, ui32Even );	// 4 zero bits.
+
+		do {
+			Gf2MatrixSquare( ui32Even, ui32Odd );
+			if ( _ui64Len1 & 1 ) { _ui32Crc0 = Gf2MatrixTimes( ui32Even, _ui32Crc0 ); }
+			_ui64Len1 >>= 1;
+			if ( !_ui64Len1 ) { break; }
+
+			Gf2MatrixSquare( ui32Odd, ui32Even );
+			if ( _ui64Len1 & 1 ) { _ui32Crc0 = Gf2MatrixTimes( ui32Odd, _ui32Crc0 ); }
+			_ui64Len1 >>= 1;
+		} while ( _ui64Len1 );
+
+		return _ui32Crc0 ^ _ui32Crc1;
 	}
 
 	/**
@@ -69,11 +184,12 @@ namespace lsn {
 	 * Initialize the table.
 	 */
 	void CCrc::Init() {
-		if ( !m_bInit ) {
+		static const bool bInit = []() {
 			Init( m_ui32StdTable, 0xEDB88320 );
 			Init( m_ui32AltTable, 0x04C11DB7 );
-			m_bInit = true;
-		}		
+			return true;
+		}();
+		static_cast<void>(bInit);
 	}
 
 	/**
@@ -97,6 +213,118 @@ namespace lsn {
 		}
 	}
 
+	/**
+	 * Advances a raw (non-inverted) standard CRC over a block of data 16 bytes at a time.
+	 *
+	 * \param _ui32Crc The raw CRC to update.
+	 * \param _pui8Data The data to add to the CRC calculation.
+	 * \param _uiptrLen Length of the data.
+	 * \return Returns the updated raw CRC.
+	 */
+	uint32_t CCrc::UpdateSlice16( uint32_t _ui32Crc, const uint8_t * _pui8Data, uintptr_t _uiptrLen ) {
+		const auto & aT = m_aSliceTable;
+		while ( _uiptrLen >= 16 ) {
+			uint32_t ui32A, ui32B, ui32C, ui32D;
+			std::memcpy( &ui32A, _pui8Data, sizeof( ui32A ) );
+			std::memcpy( &ui32B, _pui8Data + 4, sizeof( ui32B ) );
+			std::memcpy( &ui32C, _pui8Data + 8, sizeof( ui32C ) );
+			std::memcpy( &ui32D, _pui8Data + 12, sizeof( ui32D ) );
+			ui32A ^= _ui32Crc;
+			_ui32Crc = aT[15][ui32A&0xFF] ^ aT[14][(ui32A>>8)&0xFF] ^ aT[13][(ui32A>>16)&0xFF] ^ aT[12][ui32A>>24] ^
+				aT[11][ui32B&0xFF] ^ aT[10][(ui32B>>8)&0xFF] ^ aT[9][(ui32B>>16)&0xFF] ^ aT[8][ui32B>>24] ^
+				aT[7][ui32C&0xFF] ^ aT[6][(ui32C>>8)&0xFF] ^ aT[5][(ui32C>>16)&0xFF] ^ aT[4][ui32C>>24] ^
+				aT[3][ui32D&0xFF] ^ aT[2][(ui32D>>8)&0xFF] ^ aT[1][(ui32D>>16)&0xFF] ^ aT[0][ui32D>>24];
+			_pui8Data += 16;
+			_uiptrLen -= 16;
+		}
+		while ( _uiptrLen-- ) {
+			_ui32Crc = (_ui32Crc >> 8) ^ aT[0][((*_pui8Data++))^(_ui32Crc&0xFF)];
+		}
+		return _ui32Crc;
+	}
+
+#ifdef __SSE4_1__
+	/**
+	 * Advances a raw (non-inverted) standard CRC over a block of data using carry-less multiplication.  _uiptrLen must be at least 64 and a multiple of 16.
+	 *	Folds 4 lanes of 128 bits in parallel, then reduces with a Barrett reduction (Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ").
+	 *
+	 * \param _ui32Crc The raw CRC to update.
+	 * \param _pui8Data The data to add to the CRC calculation.
+	 * \param _uiptrLen Length of the data.
+	 * \return Returns the updated raw CRC.
+	 */
+	uint32_t CCrc::UpdatePclmul( uint32_t _ui32Crc, const uint8_t * _pui8Data, uintptr_t _uiptrLen ) {
+		// Bit-reflected constants for polynomial 0x04C11DB7.
+		alignas( 16 ) static const uint64_t ui64K1K2[] = { 0x0154442BD4, 0x01C6E41596 };
+		alignas( 16 ) static const uint64_t ui64K3K4[] = { 0x01751997D0, 0x00CCAA009E };
+		alignas( 16 ) static const uint64_t ui64K5K0[] = { 0x0163CD6124, 0x0000000000 };
+		alignas( 16 ) static const uint64_t ui64Poly[] = { 0x01DB710641, 0x01F7011641 };
+
+		__m128i mX1 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x00) );
+		__m128i mX2 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x10) );
+		__m128i mX3 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x20) );
+		__m128i mX4 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x30) );
+		mX1 = _mm_xor_si128( mX1, _mm_cvtsi32_si128( int( _ui32Crc ) ) );
+		__m128i mK = _mm_load_si128( reinterpret_cast<const __m128i *>(ui64K1K2) );
+		_pui8Data += 64;
+		_uiptrLen -= 64;
+
+		// Fold 64 bytes at a time.
+		while ( _uiptrLen >= 64 ) {
+			__m128i mX5 = _mm_clmulepi64_si128( mX1, mK, 0x00 );
+			__m128i mX6 = _mm_clmulepi64_si128( mX2, mK, 0x00 );
+			__m128i mX7 = _mm_clmulepi64_si128( mX3, mK, 0x00 );
+			__m128i mX8 = _mm_clmulepi64_si128( mX4, mK, 0x00 );
+			mX1 = _mm_clmulepi64_si128( mX1, mK, 0x11 );
+			mX2 = _mm_clmulepi64_si128( mX2, mK, 0x11 );
+			mX3 = _mm_clmulepi64_si128( mX3, mK, 0x11 );
+			mX4 = _mm_clmulepi64_si128( mX4, mK, 0x11 );
+			mX1 = _mm_xor_si128( _mm_xor_si128( mX1, mX5 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x00) ) );
+			mX2 = _mm_xor_si128( _mm_xor_si128( mX2, mX6 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x10) ) );
+			mX3 = _mm_xor_si128( _mm_xor_si128( mX3, mX7 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x20) ) );
+			mX4 = _mm_xor_si128( _mm_xor_si128( mX4, mX8 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data + 0x30) ) );
+			_pui8Data += 64;
+			_uiptrLen -= 64;
+		}
+
+		// Fold the 4 lanes into 1.
+		mK = _mm_load_si128( reinterpret_cast<const __m128i *>(ui64K3K4) );
+		__m128i mX5 = _mm_clmulepi64_si128( mX1, mK, 0x00 );
+		mX1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( mX1, mK, 0x11 ), mX2 ), mX5 );
+		mX5 = _mm_clmulepi64_si128( mX1, mK, 0x00 );
+		mX1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( mX1, mK, 0x11 ), mX3 ), mX5 );
+		mX5 = _mm_clmulepi64_si128( mX1, mK, 0x00 );
+		mX1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( mX1, mK, 0x11 ), mX4 ), mX5 );
+
+		// Fold 16 bytes at a time.
+		while ( _uiptrLen >= 16 ) {
+			mX2 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Data) );
+			mX5 = _mm_clmulepi64_si128( mX1, mK, 0x00 );
+			mX1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( mX1, mK, 0x11 ), mX2 ), mX5 );
+			_pui8Data += 16;
+			_uiptrLen -= 16;
+		}
+
+		// Fold 128 bits to 64.
+		mX2 = _mm_clmulepi64_si128( mX1, mK, 0x10 );
+		mX3 = _mm_setr_epi32( ~0, 0, ~0, 0 );
+		mX1 = _mm_xor_si128( _mm_srli_si128( mX1, 8 ), mX2 );
+		mK = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(ui64K5K0) );
+		mX2 = _mm_srli_si128( mX1, 4 );
+		mX1 = _mm_and_si128( mX1, mX3 );
+		mX1 = _mm_xor_si128( _mm_clmulepi64_si128( mX1, mK, 0x00 ), mX2 );
+
+		// Barrett reduction to 32 bits.
+		mK = _mm_load_si128( reinterpret_cast<const __m128i *>(ui64Poly) );
+		mX2 = _mm_and_si128( mX1, mX3 );
+		mX2 = _mm_clmulepi64_si128( mX2, mK, 0x10 );
+		mX2 = _mm_and_si128( mX2, mX3 );
+		mX2 = _mm_clmulepi64_si128( mX2, mK, 0x00 );
+		mX1 = _mm_xor_si128( mX1, mX2 );
+		return uint32_t( _mm_extract_epi32( mX1, 1 ) );
+	}
+#endif	// #ifdef __SSE4_1__
+
 	/**
 	 * Calculates the CRC of a given byte, modifying the previous CRC value in-place.
 	 *
@@ -8,6 +8,7 @@
 
 
 #pragma once
+#include <array>
 #include <cinttypes>
 
 
@@ -31,6 +32,26 @@ namespace lsn {
 		 */
 		static uint32_t 				GetCrc( const uint8_t * _pui8Data, uintptr_t _uiptrLen );
 
+		/**
+		 * Continues a standard 32-bit CRC calculation with more data.  Pass 0 as _ui32Crc to begin a new calculation.
+		 *
+		 * \param _ui32Crc The CRC of the data before _pui8Data.
+		 * \param _pui8Data The data to add to the CRC calculation.
+		 * \param _uiptrLen Length of the data.
+		 * \return Returns the standard 32-bit CRC of the previous data followed by the given data.
+		 */
+		static uint32_t 				Update( uint32_t _ui32Crc, const uint8_t * _pui8Data, uintptr_t _uiptrLen );
+
+		/**
+		 * Combines the standard 32-bit CRC values of 2 consecutive blocks of data into the CRC of the concatenated data.
+		 *
+		 * \param _ui32Crc0 The CRC of the first block.
+		 * \param _ui32Crc1 The CRC of the second block.
+		 * \param _ui64Len1 The length of the second block.
+		 * \return Returns the standard 32-bit CRC value of the first block followed by the second block.
+		 */
+		static uint32_t 				Combine( uint32_t _ui32Crc0, uint32_t _ui32Crc1, uint64_t _ui64Len1 );
+
 		/**
 		 * Calculate the alternative 32-bit CRC value for a given set of bytes.
 		 *
@@ -54,9 +75,10 @@ namespace lsn {
 		static uint32_t					m_ui32AltTable[256];
 
 		/**
-		 * Has the table been initialized?
+		 * Slice-by-16 tables for the standard key.  m_aSliceTable[0] is the standard table.
 		 */
-		static bool						m_bInit;
+		static const std::array<std::array<uint32_t, 256>, 16>
+										m_aSliceTable;
 
 
 		// == Functions.
@@ -73,6 +95,28 @@ namespace lsn {
 		 */
 		static void 					Init( uint32_t * _pui32Table, uint32_t _ui32Key );
 
+		/**
+		 * Advances a raw (non-inverted) standard CRC over a block of data 16 bytes at a time.
+		 *
+		 * \param _ui32Crc The raw CRC to update.
+		 * \param _pui8Data The data to add to the CRC calculation.
+		 * \param _uiptrLen Length of the data.
+		 * \return Returns the updated raw CRC.
+		 */
+		static uint32_t 				UpdateSlice16( uint32_t _ui32Crc, const uint8_t * _pui8Data, uintptr_t _uiptrLen );
+
+#ifdef __SSE4_1__
+		/**
+		 * Advances a raw (non-inverted) standard CRC over a block of data using carry-less multiplication.  _uiptrLen must be at least 64 and a multiple of 16.
+		 *
+		 * \param _ui32Crc The raw CRC to update.
+		 * \param _pui8Data The data to add to the CRC calculation.
+		 * \param _uiptrLen Length of the data.
+		 * \return Returns the updated raw CRC.
+		 */
+		static uint32_t 				UpdatePclmul( uint32_t _ui32Crc, const uint8_t * _pui8Data, uintptr_t _uiptrLen );
+#endif	// #ifdef __SSE4_1__
+
 		/**
 		 * Calculates the CRC of a given byte, modifying the previous CRC value in-place.
 		 *
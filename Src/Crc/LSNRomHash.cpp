@@ -0,0 +1,69 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Computes every hash needed to identify a ROM image in a single pass over its data.
+ */
+
+
+#include "LSNRomHash.h"
+#include "LSNCrc.h"
+
+#include <algorithm>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Computes all hashes of an image in one pass.
+	 *
+	 * \param _pui8Data The image.
+	 * \param _sSize The size of the image in bytes.
+	 * \param _sHeaderSize The size of the header at the start of the image.  Clamped to _sSize.
+	 * \param _sPrefixLen The number of bytes following the header whose CRC32 is stored in ui32PrefixCrc.  Clamped to the available data.
+	 * \param _hHashes Holds the computed hashes.
+	 */
+	void CRomHash::Compute( const uint8_t * _pui8Data, size_t _sSize, size_t _sHeaderSize, size_t _sPrefixLen, LSN_HASHES &_hHashes ) {
+		_hHashes = LSN_HASHES();
+		const size_t sHeader = std::min( _sHeaderSize, _sSize );
+		const uint8_t * pui8Body = _pui8Data + sHeader;
+		const size_t sBodyLen = _sSize - sHeader;
+		const size_t sPrefix = std::min( _sPrefixLen, sBodyLen );
+
+		CMd5 mFull, mBody;
+		mFull.Init();
+		mBody.Init();
+
+		// The CRC trails the MD5 by at most one chunk so that it reads data that is still in cache.
+		uint32_t ui32Crc = 0;
+		size_t sCrcPos = 0;
+		auto CrcTo = [&]( size_t _sEnd ) {
+			if ( sCrcPos < sPrefix && _sEnd >= sPrefix ) {
+				ui32Crc = CCrc::Update( ui32Crc, pui8Body + sCrcPos, sPrefix - sCrcPos );
+				sCrcPos = sPrefix;
+				_hHashes.ui32PrefixCrc = ui32Crc;
+			}
+			ui32Crc = CCrc::Update( ui32Crc, pui8Body + sCrcPos, _sEnd - sCrcPos );
+			sCrcPos = _sEnd;
+		};
+
+		// The full image and the body both start on a block boundary, so whole blocks of each can be transformed together.
+		const size_t sPairBlocks = sBodyLen / 64;
+		for ( size_t I = 0; I < sPairBlocks; I += LSN_BLOCKS_PER_CHUNK ) {
+			size_t sBlocks = std::min<size_t>( LSN_BLOCKS_PER_CHUNK, sPairBlocks - I );
+			CMd5::UpdatePair( mFull, _pui8Data + I * 64, mBody, pui8Body + I * 64, sBlocks );
+			CrcTo( (I + sBlocks) * 64 );
+		}
+		mFull.Update( _pui8Data + sPairBlocks * 64, _sSize - sPairBlocks * 64 );
+		mBody.Update( pui8Body + sPairBlocks * 64, sBodyLen - sPairBlocks * 64 );
+		CrcTo( sBodyLen );
+
+		_hHashes.ui32Crc = ui32Crc;
+		_hHashes.ui32FullCrc = CCrc::Combine( CCrc::GetCrc( _pui8Data, sHeader ), ui32Crc, sBodyLen );
+		_hHashes.mhMd5 = mFull.Final();
+		_hHashes.mhHeaderlessMd5 = mBody.Final();
+	}
+
+}	// namespace lsn
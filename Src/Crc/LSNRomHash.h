@@ -0,0 +1,61 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Computes every hash needed to identify a ROM image in a single pass over its data.
+ */
+
+
+#pragma once
+
+#include "../Utilities/LSNMd5.h"
+
+#include <cinttypes>
+
+
+namespace lsn {
+
+	/**
+	 * Class CRomHash
+	 * \brief Computes every hash needed to identify a ROM image in a single pass over its data.
+	 *
+	 * Description: Computes the CRC32 of the image after its header, the CRC32 of the full image, the CRC32 of a prefix of the data after
+	 *	the header, and the MD5 digests of the full image and of the data after the header.  The image is walked once in cache-sized chunks
+	 *	and both MD5 digests are computed with interleaved transforms.
+	 */
+	class CRomHash {
+	public :
+		// == Types.
+		/** The computed hashes. */
+		struct LSN_HASHES {
+			uint32_t										ui32Crc = 0;							/**< CRC32 of the data following the header. */
+			uint32_t										ui32FullCrc = 0;						/**< CRC32 of the full image. */
+			uint32_t										ui32PrefixCrc = 0;						/**< CRC32 of the first _sPrefixLen bytes following the header. */
+			CMd5::LSN_MD5_HASH								mhMd5;									/**< MD5 of the full image. */
+			CMd5::LSN_MD5_HASH								mhHeaderlessMd5;						/**< MD5 of the data following the header. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Computes all hashes of an image in one pass.
+		 *
+		 * \param _pui8Data The image.
+		 * \param _sSize The size of the image in bytes.
+		 * \param _sHeaderSize The size of the header at the start of the image.  Clamped to _sSize.
+		 * \param _sPrefixLen The number of bytes following the header whose CRC32 is stored in ui32PrefixCrc.  Clamped to the available data.
+		 * \param _hHashes Holds the computed hashes.
+		 */
+		static void											Compute( const uint8_t * _pui8Data, size_t _sSize, size_t _sHeaderSize, size_t _sPrefixLen, LSN_HASHES &_hHashes );
+
+
+	protected :
+		// == Enumerations.
+		/** Constants. */
+		enum LSN_CONSTANTS : size_t {
+			LSN_BLOCKS_PER_CHUNK							= 256,									/**< The number of 64-byte MD5 blocks hashed per chunk (16 kilobytes, so each chunk is read from cache by the CRC). */
+		};
+	};
+
+}	// namespace lsn
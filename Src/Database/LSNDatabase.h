@@ -10,7 +10,7 @@
 #pragma once
 
 #include "../LSNLSpiroNes.h"
-#include <map>
+#include "../Utilities/LSNMd5.h"
 
 
 namespace lsn {
@@ -111,24 +111,65 @@ namespace lsn {
 			uint16_t							ui16Mapper = uint16_t( -1 );							/**< The mapper. */
 			uint16_t							ui16SubMapper = uint16_t( -1 );							/**< The sub-mapper. */
 			bool								bBusConflicts = true;									/**< Allow bus conflicts? */
+			CMd5::LSN_MD5_HASH					mhMd5 = {};												/**< Optional headerless MD5 that distinguishes entries sharing a CRC.  All zeros if unused. */
 		};
 
 
 		// == Functions.
 		/**
-		 * Initializes the database with known ROMs.
+		 * Finds a ROM in the database.  When several entries share the CRC, the one with a matching MD5 is preferred, then the one
+		 *	without an MD5.
+		 *
+		 * \param _ui32Crc The CRC of the ROM's PRG data.
+		 * \param _pmhMd5 The optional headerless MD5 of the ROM.
+		 * \return Returns the database entry for the ROM, or nullptr if the ROM is not in the database.
 		 */
-		static void								Init();
+		static const LSN_ENTRY *				Find( uint32_t _ui32Crc, const CMd5::LSN_MD5_HASH * _pmhMd5 = nullptr );
 
+
+	protected :
+		// == Functions.
 		/**
-		 * Frees all memory associated with this class.
+		 * Determines whether an entry has an MD5 key.
+		 *
+		 * \param _eEntry The entry to check.
+		 * \return Returns true if any byte of the entry's MD5 is non-zero.
 		 */
-		static void								Reset();
+		static constexpr bool					HasMd5( const LSN_ENTRY &_eEntry ) {
+			for ( auto I = std::size( _eEntry.mhMd5.ui8Bytes ); I--; ) {
+				if ( _eEntry.mhMd5.ui8Bytes[I] ) { return true; }
+			}
+			return false;
+		}
 
+		/**
+		 * Determines whether one entry sorts before another (by CRC, then MD5).
+		 *
+		 * \param _eLeft The left operand.
+		 * \param _eRight The right operand.
+		 * \return Returns true if _eLeft sorts before _eRight.
+		 */
+		static constexpr bool					Less( const LSN_ENTRY &_eLeft, const LSN_ENTRY &_eRight ) {
+			if ( _eLeft.ui32Crc != _eRight.ui32Crc ) { return _eLeft.ui32Crc < _eRight.ui32Crc; }
+			for ( size_t I = 0; I < std::size( _eLeft.mhMd5.ui8Bytes ); ++I ) {
+				if ( _eLeft.mhMd5.ui8Bytes[I] != _eRight.mhMd5.ui8Bytes[I] ) { return _eLeft.mhMd5.ui8Bytes[I] < _eRight.mhMd5.ui8Bytes[I]; }
+			}
+			return false;
+		}
 
-		// == Members.
-		/** The database map.  CRC is the key. */
-		static std::map<uint32_t, LSN_ENTRY>	m_mDatabase;
+		/**
+		 * Determines whether a table is strictly sorted (sorted with no duplicate keys).
+		 *
+		 * \param _peTable The table to check.
+		 * \param _sTotal The number of entries in the table.
+		 * \return Returns true if every entry sorts before the next.
+		 */
+		static constexpr bool					IsSorted( const LSN_ENTRY * _peTable, size_t _sTotal ) {
+			for ( size_t I = 1; I < _sTotal; ++I ) {
+				if ( !Less( _peTable[I-1], _peTable[I] ) ) { return false; }
+			}
+			return true;
+		}
 	};
 
 }	// namespace lsn
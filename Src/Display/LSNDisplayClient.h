@@ -26,6 +26,7 @@ namespace lsn {
 		// == Various constructors.
 		CDisplayClient() :
 			m_ui64RenderStartCycle( 0 ),
+			m_ui64FrameVersion( 0 ),
 			m_pdhHost( nullptr ),
 			m_pui8RenderTarget( nullptr ),
 			m_pofOutFormat( LSN_POF_RGB ),
@@ -97,6 +98,12 @@ namespace lsn {
 			m_bFlipOutput = _bFlip;
 		}
 
+		/**
+		 * Informs the client that the colors of its palette have changed, so that the same palette indices no longer produce the
+		 *	same output.
+		 */
+		virtual void							PaletteChanged() {}
+
 		/**
 		 * Gets the frame count.
 		 *
@@ -125,11 +132,30 @@ namespace lsn {
 		 */
 		inline uint64_t							GetRenderStartCycle() const { return m_ui64RenderStartCycle; }
 
+		/**
+		 * Gets the version of the rendered output.  The version changes only when a frame differs from the one before it, so two
+		 *	swapped frames with the same version hold identical pixels.
+		 *
+		 * \return Returns the version of the rendered output.
+		 */
+		inline uint64_t							GetFrameVersion() const { return m_ui64FrameVersion; }
+
+		/**
+		 * Gets the frame version (GetFrameVersion()) at which each scanline last changed, so that filters can refilter only the
+		 *	scanlines that changed since the frame they last filtered.  Scanlines are indexed from the top of the display, before any
+		 *	flip.
+		 *
+		 * \return Returns DisplayHeight() versions, or nullptr if the client does not track them.
+		 */
+		virtual const uint64_t *				RowVersions() const { return nullptr; }
+
 
 	protected :
 		// == Members.
 		/** The cycle at the first pixel of the 256×240 output image ([0,0]). */
 		uint64_t								m_ui64RenderStartCycle;
+		/** Incremented at the end of each frame that differs from the previous frame. */
+		uint64_t								m_ui64FrameVersion;
 		/** The host pointr. */
 		CDisplayHost *							m_pdhHost;
 		/** The render target. */
@@ -28,6 +28,7 @@ namespace lsn {
 		 */
 		CI2cEeprom157() :
 			m_vStorage( 128, 0 ),
+			m_pui8Storage( nullptr ),
 			m_bSdaOut( true ),
 			m_bScl( true ),
 			m_bDevDriveLow( false ),
@@ -43,6 +44,7 @@ namespace lsn {
 			m_ui8DevAddr7( 0x50 ),
 			m_ui8MaskAddr( 0x7F )
 		{
+			m_pui8Storage = m_vStorage.data();
 		}
 
 
@@ -104,12 +106,37 @@ namespace lsn {
 		 * \param _vData Source buffer.
 		 */
 		void                            SetData( const std::vector<uint8_t> &_vData ) {
-			std::fill( m_vStorage.begin(), m_vStorage.end(), 0 );
-			for ( size_t I = 0; I < _vData.size() && I < m_vStorage.size(); ++I ) {
-				m_vStorage[I] = _vData[I];
+			std::fill( m_pui8Storage, m_pui8Storage + StorageSize(), 0 );
+			for ( size_t I = 0; I < _vData.size() && I < StorageSize(); ++I ) {
+				m_pui8Storage[I] = _vData[I];
 			}
 		}
 
+		/**
+		 * \brief Gets the EEPROM array in use (internal or external).
+		 *
+		 * \return Pointer to StorageSize() bytes.
+		 */
+		uint8_t *                       Storage() const { return m_pui8Storage; }
+
+		/**
+		 * \brief Gets the size of the EEPROM array.
+		 *
+		 * \return Size in bytes.
+		 */
+		size_t                          StorageSize() const { return m_vStorage.size(); }
+
+		/**
+		 * \brief Redirects the EEPROM array to external memory (such as a memory-mapped save file).
+		 *
+		 * The external memory must hold StorageSize() bytes and outlive its use here.  Pass nullptr to return to the internal array.
+		 *
+		 * \param _pui8Storage The external array or nullptr.
+		 */
+		void                            SetStorage( uint8_t * _pui8Storage ) {
+			m_pui8Storage = _pui8Storage ? _pui8Storage : m_vStorage.data();
+		}
+
 
 	protected :
 		// == Types.
@@ -144,6 +171,7 @@ namespace lsn {
 
 		// == Members.
 		std::vector<uint8_t>            m_vStorage;        /**< 128-byte EEPROM array. */
+		uint8_t *                       m_pui8Storage;     /**< The EEPROM array in use (m_vStorage or external). */
 
 		bool                            m_bSdaOut;         /**< CPU-driven SDA ($6000). */
 		bool                            m_bScl;            /**< CPU-driven SCL ($6001). */
@@ -219,7 +247,7 @@ namespace lsn {
 			}
 
 			if ( m_ePhase == LSN_P_READ_DATA && m_eAck == LSN_A_NONE ) {
-				const uint8_t ui8Byte = m_vStorage[m_ui8AddrPtr];
+				const uint8_t ui8Byte = m_pui8Storage[m_ui8AddrPtr];
 				const uint8_t ui8Bit  = static_cast<uint8_t>((ui8Byte >> (7 - m_ui8BitPos)) & 1U);
 				m_bDevDriveLow = (ui8Bit == 0U);
 			}
@@ -287,7 +315,7 @@ namespace lsn {
 							break;
 						}
 						case LSN_P_WRITE_DATA : {
-							m_vStorage[m_ui8AddrPtr] = m_ui8Shift;
+							m_pui8Storage[m_ui8AddrPtr] = m_ui8Shift;
 							m_ui8AddrPtr = static_cast<uint8_t>((m_ui8AddrPtr + 1) & m_ui8MaskAddr);
 							m_eAck       = LSN_A_DEV;
 							break;
@@ -8,6 +8,13 @@
 
 #include "LSNFileMap.h"
 
+#ifndef LSN_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif	// #ifndef LSN_WINDOWS
+
 
 namespace lsn {
 
@@ -15,8 +22,8 @@ namespace lsn {
 		m_hFile( FileMap_Null ),
 		m_hMap( FileMap_Null ),
 		m_pbMapBuffer( nullptr ),
-		m_bIsEmpty( TRUE ),
-		m_bWritable( TRUE ),
+		m_bIsEmpty( true ),
+		m_bWritable( true ),
 		m_ui64Size( 0 ),
 		m_ui64MapStart( std::numeric_limits<uint64_t>::max() ),
 		m_ui32MapSize( 0 ) {
@@ -51,6 +58,55 @@ namespace lsn {
 		return CreateFileMap();
 	}
 
+	/**
+	 * Opens a file for reading only.  Other processes may keep reading the file while it is opened.
+	 *
+	 * \param _pFile Path to the file to open.
+	 * \return Returns true if the file was opened, false otherwise.
+	 */
+	bool CFileMap::OpenReadOnly( const std::filesystem::path &_pFile ) {
+		Close();
+		m_hFile = ::CreateFileW( _pFile.native().c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			NULL,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+			NULL );
+
+		if ( !(m_hFile && m_hFile != FileMap_Null) ) {
+			Close();
+			return false;
+		}
+		m_bWritable = false;
+		return CreateFileMap();
+	}
+
+	/**
+	 * Opens a file for reading and writing, creating it empty only if it does not exist.  An existing file is never truncated.
+	 *	Other handles may keep reading and writing the file while it is opened.
+	 *
+	 * \param _pFile Path to the file to open or create.
+	 * \return Returns true if the file was opened or created, false otherwise.
+	 */
+	bool CFileMap::OpenOrCreate( const std::filesystem::path &_pFile ) {
+		Close();
+		m_hFile = ::CreateFileW( _pFile.native().c_str(),
+			GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE,
+			NULL,
+			OPEN_ALWAYS,
+			FILE_ATTRIBUTE_NORMAL,
+			NULL );
+
+		if ( !(m_hFile && m_hFile != FileMap_Null) ) {
+			Close();
+			return false;
+		}
+		m_bWritable = true;
+		return CreateFileMap();
+	}
+
 	/**
 	 * Creates a file.
 	 *
@@ -100,7 +156,7 @@ namespace lsn {
 			::CloseHandle( m_hFile );
 			m_hFile = NULL;
 		}
-		m_bIsEmpty = TRUE;
+		m_bIsEmpty = true;
 		m_ui64Size = 0;
 		m_ui64MapStart = std::numeric_limits<uint64_t>::max();
 		m_ui32MapSize = 0;
@@ -154,6 +210,113 @@ namespace lsn {
 		m_ui32MapSize = 0;
 		return true;
 	}
+
+	/**
+	 * Sets the size of the file.  All views of the file must be unmapped before the file can be shrunk.  New bytes are 0.
+	 * 
+	 * \param _ui64Size The new size of the file in bytes.
+	 * \return Returns true if the file was resized and remapped.
+	 **/
+	bool CFileMap::Resize( uint64_t _ui64Size ) {
+		if ( !(m_hFile && m_hFile != FileMap_Null) || !m_bWritable ) { return false; }
+		// The mapping object has a fixed size, so it must be recreated.
+		if ( m_pbMapBuffer ) {
+			::UnmapViewOfFile( m_pbMapBuffer );
+			m_pbMapBuffer = nullptr;
+		}
+		if ( (m_hMap && m_hMap != FileMap_Null) ) {
+			::CloseHandle( m_hMap );
+			m_hMap = NULL;
+		}
+		LARGE_INTEGER liSize;
+		liSize.QuadPart = static_cast<LONGLONG>(_ui64Size);
+		if ( !::SetFilePointerEx( m_hFile, liSize, NULL, FILE_BEGIN ) || !::SetEndOfFile( m_hFile ) ) {
+			return false;
+		}
+		m_ui64Size = 0;
+		return CreateFileMap();
+	}
+
+	/**
+	 * Maps a view of part of the file.  The view must be released with UnmapView().
+	 * 
+	 * \param _ui64Offset The offset of the first byte to map.
+	 * \param _sSize The number of bytes to map.
+	 * \param _vView Holds the mapped view upon success.
+	 * \return Returns true if the view was mapped.  The range must be inside the file.
+	 **/
+	bool CFileMap::MapView( uint64_t _ui64Offset, size_t _sSize, LSN_VIEW &_vView ) const {
+		_vView = LSN_VIEW();
+		if ( m_bIsEmpty || !(m_hMap && m_hMap != FileMap_Null) || !_sSize ) { return false; }
+		if ( _ui64Offset > Size() || Size() - _ui64Offset < _sSize ) { return false; }
+
+		const uint64_t ui64Gran = Granularity();
+		uint64_t ui64Start = _ui64Offset / ui64Gran * ui64Gran;
+		size_t sAdjust = static_cast<size_t>(_ui64Offset - ui64Start);
+		void * pvMap = ::MapViewOfFile( m_hMap,
+			m_bWritable ? (FILE_MAP_READ | FILE_MAP_WRITE) : FILE_MAP_READ,
+			static_cast<DWORD>(ui64Start >> 32),
+			static_cast<DWORD>(ui64Start),
+			_sSize + sAdjust );
+		if ( !pvMap ) { return false; }
+
+		_vView.pui8Base = static_cast<uint8_t *>(pvMap);
+		_vView.pui8Data = _vView.pui8Base + sAdjust;
+		_vView.ui64Offset = _ui64Offset;
+		_vView.sSize = _sSize;
+		_vView.sMapSize = _sSize + sAdjust;
+		return true;
+	}
+
+	/**
+	 * Unmaps a view created by MapView().
+	 * 
+	 * \param _vView The view to unmap.  Cleared upon return.
+	 **/
+	void CFileMap::UnmapView( LSN_VIEW &_vView ) {
+		if ( _vView.pui8Base ) {
+			::UnmapViewOfFile( _vView.pui8Base );
+		}
+		_vView = LSN_VIEW();
+	}
+
+	/**
+	 * Starts writing the dirty pages in a view back to the file.  Does not wait for the writes to complete.
+	 * 
+	 * \param _vView The view to flush.
+	 * \return Returns true if the flush was started.
+	 **/
+	bool CFileMap::FlushView( const LSN_VIEW &_vView ) {
+		if ( !_vView.pui8Base ) { return false; }
+		return ::FlushViewOfFile( _vView.pui8Base, _vView.sMapSize ) != FALSE;
+	}
+
+	/**
+	 * Hints to the OS that a view will soon be accessed so its pages can be read ahead.
+	 * 
+	 * \param _vView The view to prefetch.
+	 **/
+	void CFileMap::PrefetchView( const LSN_VIEW &_vView ) {
+		// PrefetchVirtualMemory() requires Windows 8; touching a byte per page faults the pages in on any version.
+		const volatile uint8_t * pui8Page = _vView.pui8Base;
+		for ( size_t I = 0; I < _vView.sMapSize; I += 4096 ) {
+			static_cast<void>(pui8Page[I]);
+		}
+	}
+
+	/**
+	 * Gets the alignment required of view offsets (the allocation granularity on Windows, the page size elsewhere).
+	 * 
+	 * \return Returns the view-offset alignment in bytes.
+	 **/
+	size_t CFileMap::Granularity() {
+		static const size_t sGranularity = []() {
+			SYSTEM_INFO siInfo;
+			::GetSystemInfo( &siInfo );
+			return static_cast<size_t>(siInfo.dwAllocationGranularity);
+		}();
+		return sGranularity;
+	}
 #else
 	/**
 	 * Opens a file.
@@ -162,6 +325,28 @@ namespace lsn {
 	 * \return Returns true if the file was opened, false otherwise.
 	 */
 	bool CFileMap::Open( const std::filesystem::path &_pFile ) {
+		Close();
+		try {
+			auto sPath = _pFile.native();
+			m_hFile = ::open( sPath.c_str(), O_RDWR );
+			if ( m_hFile == FileMap_Null ) {
+				Close();
+				return false;
+			}
+			m_bWritable = true;
+		}
+		catch ( ... ) { return false; }		// _pFile.native() can fail if out of memory.
+
+		return CreateFileMap();
+	}
+
+	/**
+	 * Opens a file for reading only.  Other processes may keep reading the file while it is opened.
+	 *
+	 * \param _pFile Path to the file to open.
+	 * \return Returns true if the file was opened, false otherwise.
+	 */
+	bool CFileMap::OpenReadOnly( const std::filesystem::path &_pFile ) {
 		Close();
 		try {
 			auto sPath = _pFile.native();
@@ -177,6 +362,29 @@ namespace lsn {
 		return CreateFileMap();
 	}
 
+	/**
+	 * Opens a file for reading and writing, creating it empty only if it does not exist.  An existing file is never truncated.
+	 *	Other handles may keep reading and writing the file while it is opened.
+	 *
+	 * \param _pFile Path to the file to open or create.
+	 * \return Returns true if the file was opened or created, false otherwise.
+	 */
+	bool CFileMap::OpenOrCreate( const std::filesystem::path &_pFile ) {
+		Close();
+		try {
+			auto sPath = _pFile.native();
+			m_hFile = ::open( sPath.c_str(), O_RDWR | O_CREAT, 0644 );
+			if ( m_hFile == FileMap_Null ) {
+				Close();
+				return false;
+			}
+			m_bWritable = true;
+		}
+		catch ( ... ) { return false; }		// _pFile.native() can fail if out of memory.
+
+		return CreateFileMap();
+	}
+
 	/**
 	 * Creates a file.
 	 *
@@ -231,7 +439,7 @@ namespace lsn {
 	 *
 	 * \return Returns the size of the file.
 	 **/
-	uint64_t FileMap::Size() const {
+	uint64_t CFileMap::Size() const {
 		if ( !m_ui64Size ) {
 			struct stat sStat;
 			if ( ::fstat( m_hFile, &sStat ) == 0 ) { m_ui64Size = static_cast<uint64_t>(sStat.st_size); }
@@ -248,7 +456,7 @@ namespace lsn {
 		if ( m_hFile == FileMap_Null ) { return false; }
 		// Can't open 0-sized files.
 		m_bIsEmpty = Size() == 0;
-		if ( m_bIsEmpty ) { return LSN_E_FILE_TOO_SMALL; }
+		if ( m_bIsEmpty ) { return true; }
 		m_hMap = ::dup( m_hFile );
 		if ( m_hMap == FileMap_Null ) {
 			Close();
@@ -259,6 +467,102 @@ namespace lsn {
 		return true;
 	}
 
+	/**
+	 * Sets the size of the file.  All views of the file must be unmapped before the file can be shrunk.  New bytes are 0.
+	 * 
+	 * \param _ui64Size The new size of the file in bytes.
+	 * \return Returns true if the file was resized and remapped.
+	 **/
+	bool CFileMap::Resize( uint64_t _ui64Size ) {
+		if ( m_hFile == FileMap_Null || !m_bWritable ) { return false; }
+		if ( m_pbMapBuffer ) {
+			if ( m_ui32MapSize ) { ::munmap( m_pbMapBuffer, static_cast<size_t>(m_ui32MapSize) ); }
+			m_pbMapBuffer = nullptr;
+		}
+		if ( ::ftruncate( m_hFile, static_cast<off_t>(_ui64Size) ) != 0 ) { return false; }
+		m_ui64Size = 0;
+		m_ui64MapStart = std::numeric_limits<uint64_t>::max();
+		m_ui32MapSize = 0;
+		if ( m_hMap == FileMap_Null ) { return CreateFileMap(); }
+		m_bIsEmpty = Size() == 0;
+		return true;
+	}
+
+	/**
+	 * Maps a view of part of the file.  The view must be released with UnmapView().
+	 * 
+	 * \param _ui64Offset The offset of the first byte to map.
+	 * \param _sSize The number of bytes to map.
+	 * \param _vView Holds the mapped view upon success.
+	 * \return Returns true if the view was mapped.  The range must be inside the file.
+	 **/
+	bool CFileMap::MapView( uint64_t _ui64Offset, size_t _sSize, LSN_VIEW &_vView ) const {
+		_vView = LSN_VIEW();
+		if ( m_bIsEmpty || m_hMap == FileMap_Null || !_sSize ) { return false; }
+		if ( _ui64Offset > Size() || Size() - _ui64Offset < _sSize ) { return false; }
+
+		const uint64_t ui64Gran = Granularity();
+		uint64_t ui64Start = _ui64Offset / ui64Gran * ui64Gran;
+		size_t sAdjust = static_cast<size_t>(_ui64Offset - ui64Start);
+		void * pvMap = ::mmap( nullptr, _sSize + sAdjust,
+			m_bWritable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+			MAP_SHARED,
+			m_hMap,
+			static_cast<off_t>(ui64Start) );
+		if ( pvMap == MAP_FAILED ) { return false; }
+
+		_vView.pui8Base = static_cast<uint8_t *>(pvMap);
+		_vView.pui8Data = _vView.pui8Base + sAdjust;
+		_vView.ui64Offset = _ui64Offset;
+		_vView.sSize = _sSize;
+		_vView.sMapSize = _sSize + sAdjust;
+		return true;
+	}
+
+	/**
+	 * Unmaps a view created by MapView().
+	 * 
+	 * \param _vView The view to unmap.  Cleared upon return.
+	 **/
+	void CFileMap::UnmapView( LSN_VIEW &_vView ) {
+		if ( _vView.pui8Base ) {
+			::munmap( _vView.pui8Base, _vView.sMapSize );
+		}
+		_vView = LSN_VIEW();
+	}
+
+	/**
+	 * Starts writing the dirty pages in a view back to the file.  Does not wait for the writes to complete.
+	 * 
+	 * \param _vView The view to flush.
+	 * \return Returns true if the flush was started.
+	 **/
+	bool CFileMap::FlushView( const LSN_VIEW &_vView ) {
+		if ( !_vView.pui8Base ) { return false; }
+		return ::msync( _vView.pui8Base, _vView.sMapSize, MS_ASYNC ) == 0;
+	}
+
+	/**
+	 * Hints to the OS that a view will soon be accessed so its pages can be read ahead.
+	 * 
+	 * \param _vView The view to prefetch.
+	 **/
+	void CFileMap::PrefetchView( const LSN_VIEW &_vView ) {
+		if ( _vView.pui8Base ) {
+			::madvise( _vView.pui8Base, _vView.sMapSize, MADV_WILLNEED );
+		}
+	}
+
+	/**
+	 * Gets the alignment required of view offsets (the allocation granularity on Windows, the page size elsewhere).
+	 * 
+	 * \return Returns the view-offset alignment in bytes.
+	 **/
+	size_t CFileMap::Granularity() {
+		static const size_t sGranularity = static_cast<size_t>(::sysconf( _SC_PAGESIZE ));
+		return sGranularity;
+	}
+
 #endif	// #ifdef LSN_WINDOWS
 
 }	// namespace lsn
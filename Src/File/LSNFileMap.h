@@ -39,6 +39,15 @@ namespace lsn {
 #define FileMap_Null										(-1)
 #endif	// #ifdef _WIN32
 
+		/** A mapped view of part of the file.  Views are independent of each other and of the file object's lifetime once mapped. */
+		struct LSN_VIEW {
+			uint8_t *										pui8Base = nullptr;											/**< The start of the mapping (aligned to Granularity()). */
+			uint8_t *										pui8Data = nullptr;											/**< Pointer to the requested offset inside the mapping. */
+			uint64_t										ui64Offset = 0;												/**< The requested file offset. */
+			size_t											sSize = 0;													/**< The requested size. */
+			size_t											sMapSize = 0;												/**< The number of bytes actually mapped from pui8Base. */
+		};
+
 
 		// == Functions.
 		/**
@@ -49,6 +58,23 @@ namespace lsn {
 		 */
 		virtual bool										Open( const std::filesystem::path &_pFile ) override;
 
+		/**
+		 * Opens a file for reading only.  Other processes may keep reading the file while it is opened.
+		 *
+		 * \param _pFile Path to the file to open.
+		 * \return Returns true if the file was opened, false otherwise.
+		 */
+		bool												OpenReadOnly( const std::filesystem::path &_pFile );
+
+		/**
+		 * Opens a file for reading and writing, creating it empty only if it does not exist.  An existing file is never truncated.
+		 *	Other handles may keep reading and writing the file while it is opened.
+		 *
+		 * \param _pFile Path to the file to open or create.
+		 * \return Returns true if the file was opened or created, false otherwise.
+		 */
+		bool												OpenOrCreate( const std::filesystem::path &_pFile );
+
 		/**
 		 * Creates a file.
 		 *
@@ -69,6 +95,60 @@ namespace lsn {
 		 **/
 		virtual uint64_t									Size() const override;
 
+		/**
+		 * Determines if the file was opened/created with write access.
+		 * 
+		 * \return Returns true if views of the file can be written.
+		 **/
+		inline bool											Writable() const { return m_bWritable; }
+
+		/**
+		 * Sets the size of the file.  All views of the file must be unmapped before the file can be shrunk.  New bytes are 0.
+		 * 
+		 * \param _ui64Size The new size of the file in bytes.
+		 * \return Returns true if the file was resized and remapped.
+		 **/
+		bool												Resize( uint64_t _ui64Size );
+
+		/**
+		 * Maps a view of part of the file.  The view must be released with UnmapView().
+		 * 
+		 * \param _ui64Offset The offset of the first byte to map.
+		 * \param _sSize The number of bytes to map.
+		 * \param _vView Holds the mapped view upon success.
+		 * \return Returns true if the view was mapped.  The range must be inside the file.
+		 **/
+		bool												MapView( uint64_t _ui64Offset, size_t _sSize, LSN_VIEW &_vView ) const;
+
+		/**
+		 * Unmaps a view created by MapView().
+		 * 
+		 * \param _vView The view to unmap.  Cleared upon return.
+		 **/
+		static void											UnmapView( LSN_VIEW &_vView );
+
+		/**
+		 * Starts writing the dirty pages in a view back to the file.  Does not wait for the writes to complete.
+		 * 
+		 * \param _vView The view to flush.
+		 * \return Returns true if the flush was started.
+		 **/
+		static bool											FlushView( const LSN_VIEW &_vView );
+
+		/**
+		 * Hints to the OS that a view will soon be accessed so its pages can be read ahead.
+		 * 
+		 * \param _vView The view to prefetch.
+		 **/
+		static void											PrefetchView( const LSN_VIEW &_vView );
+
+		/**
+		 * Gets the alignment required of view offsets (the allocation granularity on Windows, the page size elsewhere).
+		 * 
+		 * \return Returns the view-offset alignment in bytes.
+		 **/
+		static size_t										Granularity();
+
 
 	protected :
 		// == Members.
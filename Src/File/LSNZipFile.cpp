@@ -121,17 +121,21 @@ namespace lsn {
 			bool bError;
 			std::u8string sUtf8 = CUtilities::Utf16ToUtf8( _s16File.c_str(), &bError );
 			if ( bError ) { return false; }
-			size_t stSize;
-			void * pvData = ::mz_zip_reader_extract_file_to_heap( const_cast<mz_zip_archive *>(&m_zaArchive), reinterpret_cast<const char *>(sUtf8.c_str()), &stSize, 0 );
-			if ( pvData == nullptr ) { return false; }
+			// Decompress straight into the result rather than into a heap block that then has to be copied.
+			int iIdx = ::mz_zip_reader_locate_file( const_cast<mz_zip_archive *>(&m_zaArchive), reinterpret_cast<const char *>(sUtf8.c_str()), nullptr, 0 );
+			if ( iIdx < 0 ) { return false; }
+			::mz_zip_archive_file_stat zafsStat;
+			if ( !::mz_zip_reader_file_stat( const_cast<mz_zip_archive *>(&m_zaArchive), mz_uint( iIdx ), &zafsStat ) ) { return false; }
+			if ( zafsStat.m_uncomp_size > SIZE_MAX ) { return false; }
 			try {
-				_vResult = std::vector<uint8_t>( static_cast<uint8_t *>(pvData), static_cast<uint8_t *>(pvData) + stSize );
+				_vResult.resize( size_t( zafsStat.m_uncomp_size ) );
 			}
-			catch ( ... ) {
-				::mz_free( pvData );
+			catch ( ... ) { return false; }
+			if ( !_vResult.size() ) { return true; }
+			if ( !::mz_zip_reader_extract_to_mem( const_cast<mz_zip_archive *>(&m_zaArchive), mz_uint( iIdx ), _vResult.data(), _vResult.size(), 0 ) ) {
+				_vResult.clear();
 				return false;
 			}
-			::mz_free( pvData );
 			return true;
 		}
 		return false;
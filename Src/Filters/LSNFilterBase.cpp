@@ -13,7 +13,10 @@ namespace lsn {
 
 	CFilterBase::CFilterBase() :
 		m_stBufferIdx( 0 ),
-		m_stStride( 0 ) {
+		m_stStride( 0 ),
+		m_pui64RowVersions( nullptr ),
+		m_sRowVersions( 0 ),
+		m_ui64FrameVersion( 0 ) {
 	}
 	CFilterBase::~CFilterBase() {
 	}
@@ -86,6 +86,8 @@ namespace lsn {
 			LSN_F_AUTO_CRT_FULL_US_VULKAN1,					/**< NTSC-CRT (full) for NTSC and PAL up-scaled Direct3D 12. */
 			LSN_F_LSPIRO_AUTO_US_VULKAN1,					/**< L. Spiro auto up-scaled Direct3D 12. */
 #endif	// #ifdef LSN_VULKAN1
+			// Filter IDs are saved in the settings file; new filters go here.
+			LSN_F_NTSC_CRT_FAST,							/**< EMMIR (LMP88959)'s NTSC-CRT (fast) filter. */
 
 			LSN_F_TOTAL,									/**< The total number of filters.  Must be last. */
 		};
@@ -210,6 +212,14 @@ namespace lsn {
 		 **/
 		virtual LSN_GRAPHICS_API							GpuApi() const { return LSN_GA_NONE; }
 
+		/**
+		 * If true, the filter's output can change even when its input pixels do not (phase, noise, phosphor decay, etc.), so it must
+		 *	run on every frame.  Otherwise the previous output is reused when the PPU produces a frame identical to the last one.
+		 * 
+		 * \return Returns false.
+		 **/
+		virtual bool										IsTemporal() const { return false; }
+
 
 		/**
 		 * Called when the filter is about to become active.
@@ -225,6 +235,24 @@ namespace lsn {
 			//::OutputDebugStringA( "\r\n* * * * * DeActivate() * * * * *\r\n\r\n" );
 		}
 
+		/**
+		 * Discards any output the filter has cached from earlier frames.  Called when a setting, the palette, or the system changes.
+		 */
+		virtual void										Invalidate() {}
+
+		/**
+		 * Sets the per-scanline change versions of the next frame passed to ApplyFilter().
+		 *
+		 * \param _pui64RowVersions The frame version at which each scanline last changed (CDisplayClient::RowVersions()), or nullptr if unknown.
+		 * \param _sRows The number of versions to which _pui64RowVersions points.
+		 * \param _ui64FrameVersion The version of the frame (CDisplayClient::GetFrameVersion()).
+		 */
+		inline void											SetRowVersions( const uint64_t * _pui64RowVersions, size_t _sRows, uint64_t _ui64FrameVersion ) {
+			m_pui64RowVersions = _pui64RowVersions;
+			m_sRowVersions = _sRows;
+			m_ui64FrameVersion = _ui64FrameVersion;
+		}
+
 		/**
 		 * Gets a BITMAP stride given its row width in bytes.
 		 *
@@ -249,6 +277,12 @@ namespace lsn {
 		uint32_t											m_ui32OutputWidth;
 		/** The render-target height in pixels. */
 		uint32_t											m_ui32OutputHeight;
+		/** The frame version at which each scanline of the input last changed. */
+		const uint64_t *									m_pui64RowVersions;
+		/** The number of versions in m_pui64RowVersions. */
+		size_t												m_sRowVersions;
+		/** The version of the input frame. */
+		uint64_t											m_ui64FrameVersion;
 	};
 
 }	// namespace lsn
@@ -0,0 +1,175 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The hot inner loops of the CPU video filters, compiled once per instruction set (each in its own translation unit)
+ *	and selected at run-time from the processor's feature set.
+ */
+
+#include "LSNFilterKernels.h"
+#include "../Utilities/LSNUtilities.h"
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Gets the kernel table for the current processor.  Selected on the first call.
+	 *
+	 * \return Returns the kernel table for the current processor.
+	 **/
+	const CFilterKernels::LSN_KERNELS & CFilterKernels::Kernels() {
+		static const LSN_KERNELS kTable = Select();
+		return kTable;
+	}
+
+	/**
+	 * Convolves a run of signals into one Y, I and Q value.  Y = sum(S*FY), I = sum(S*F*C), Q = sum(S*F*S).
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _pfFilter The chroma filter weights, one per signal.
+	 * \param _pfFilterY The luma filter weights, one per signal.
+	 * \param _pfCos The cosine for each signal.
+	 * \param _pfSin The sine for each signal.
+	 * \param _sTotal The number of signals.
+	 * \param _fY Receives the Y value.
+	 * \param _fI Receives the I value.
+	 * \param _fQ Receives the Q value.
+	 **/
+	void CFilterKernels::ConvolveYiq( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+		const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ ) {
+		float fY = 0.0f, fI = 0.0f, fQ = 0.0f;
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			float fLevel = _pfSignals[I] * _pfFilter[I];
+			fY += _pfSignals[I] * _pfFilterY[I];
+			fI += _pfCos[I] * fLevel;
+			fQ += _pfSin[I] * fLevel;
+		}
+		_fY = fY;
+		_fI = fI;
+		_fQ = fQ;
+	}
+
+	/**
+	 * Adds three source rows to three destination rows.
+	 *
+	 * \param _pfDstY The Y row to which to add.
+	 * \param _pfDstI The I row to which to add.
+	 * \param _pfDstQ The Q row to which to add.
+	 * \param _pfSrcY The Y values to add.
+	 * \param _pfSrcI The I values to add.
+	 * \param _pfSrcQ The Q values to add.
+	 * \param _sTotal The number of values in each row.
+	 **/
+	void CFilterKernels::AddRows3( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+		const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			_pfDstY[I] += _pfSrcY[I];
+			_pfDstI[I] += _pfSrcI[I];
+			_pfDstQ[I] += _pfSrcQ[I];
+		}
+	}
+
+	/**
+	 * Decodes a Bisqwit NTSC scanline to RGB32 with running sums over sliding Y, I and Q windows.
+	 *
+	 * \param _blLine The scanline to decode.
+	 **/
+	void CFilterKernels::BisqwitDecode( const LSN_BISQWIT_LINE &_blLine ) {
+		int32_t i32SumY = _blLine.i32Brightness, i32SumI = 0, i32SumQ = 0;
+		BisqwitSamples( _blLine, 0, _blLine.i32Width + LSN_BISQWIT_OFFSET, i32SumY, i32SumI, i32SumQ );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to RGB32.  Each table entry holds the bytes to write for that index.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui32Dst Receives _sTotal RGB32 values.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	void CFilterKernels::PaletteToRgb32( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			_pui32Dst[I] = _pui32Palette[_pui16Indices[I]];
+		}
+	}
+
+	/**
+	 * Converts 9-bit palette indices to packed 24-bit RGB.  The first 3 bytes of each table entry are written for that index.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui8Dst Receives _sTotal * 3 bytes.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	void CFilterKernels::PaletteToRgb24( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			uint32_t ui32Rgb = _pui32Palette[_pui16Indices[I]];
+			_pui8Dst[I*3+0] = uint8_t( ui32Rgb );
+			_pui8Dst[I*3+1] = uint8_t( ui32Rgb >> 8 );
+			_pui8Dst[I*3+2] = uint8_t( ui32Rgb >> 16 );
+		}
+	}
+
+	/**
+	 * Decays a row of 8.8 fixed-point phosphor levels and lights them with a row of 8-bit channels.  Each output is the brighter of
+	 *	the input and the decayed level, and each level becomes the brighter of the decayed level and the input scaled by _ui16Level.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The phosphor levels, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 * \param _ui16Decay The 0.16 fixed-point multiplier applied to each level.
+	 * \param _ui16Level The 0.16 fixed-point multiplier applied to each input before it is stored as a level.
+	 **/
+	void CFilterKernels::PhosphorRow( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+		uint16_t _ui16Decay, uint16_t _ui16Level ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			uint16_t ui16Old = uint16_t( (uint32_t( _pui16Accum[I] ) * _ui16Decay) >> 16 );
+			uint16_t ui16New = uint16_t( _pui8Src[I] << 8 );
+			_pui8Dst[I] = uint8_t( std::max( ui16Old, ui16New ) >> 8 );
+			_pui16Accum[I] = std::max( ui16Old, uint16_t( (uint32_t( ui16New ) * _ui16Level) >> 16 ) );
+		}
+	}
+
+	/**
+	 * Averages a row of 8-bit channels with the previous frame's row (rounding up) and stores the new row as the previous frame.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The previous frame's channels in 8.8 fixed point, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 **/
+	void CFilterKernels::FrameBlendRow( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal ) {
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			_pui8Dst[I] = uint8_t( (_pui8Src[I] + (_pui16Accum[I] >> 8) + 1) >> 1 );
+			_pui16Accum[I] = uint16_t( _pui8Src[I] << 8 );
+		}
+	}
+
+	/**
+	 * Selects the kernel table for the current processor.
+	 *
+	 * \return Returns the kernel table for the current processor.
+	 **/
+	CFilterKernels::LSN_KERNELS CFilterKernels::Select() {
+#ifdef LSN_FILTER_KERNELS_X86
+		if ( CUtilities::IsAvx512FSupported() && CUtilities::IsAvx512BWSupported() && CUtilities::IsAvx2Supported() && CUtilities::IsFmaSupported() ) {
+			return { ConvolveYiq_AVX512, AddRows3_AVX512, AddNoise_AVX512, BisqwitDecode_AVX512, PaletteToRgb32_AVX512, PaletteToRgb24_AVX512,
+				PhosphorRow_AVX512, FrameBlendRow_AVX512 };
+		}
+		if ( CUtilities::IsAvx2Supported() && CUtilities::IsFmaSupported() ) {
+			return { ConvolveYiq_AVX2, AddRows3_AVX2, AddNoise_AVX2, BisqwitDecode_AVX2, PaletteToRgb32_AVX2, PaletteToRgb24_AVX2,
+				PhosphorRow_AVX2, FrameBlendRow_AVX2 };
+		}
+		if ( CUtilities::IsSse4Supported() ) {
+			return { ConvolveYiq_SSE4, AddRows3_SSE4, AddNoise_SSE4, BisqwitDecode_SSE4, PaletteToRgb32_SSE4, PaletteToRgb24_SSE4,
+				PhosphorRow_SSE4, FrameBlendRow_SSE4 };
+		}
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
+		return { ConvolveYiq, AddRows3, nullptr, BisqwitDecode, PaletteToRgb32, PaletteToRgb24,
+			PhosphorRow, FrameBlendRow };
+	}
+
+}	// namespace lsn
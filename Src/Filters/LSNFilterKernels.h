@@ -0,0 +1,318 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The hot inner loops of the CPU video filters, compiled once per instruction set (each in its own translation unit)
+ *	and selected at run-time from the processor's feature set.
+ */
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+
+#include <algorithm>
+
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+// MSVC emits any intrinsic regardless of /arch.
+#define LSN_TARGET_SSE4
+#define LSN_TARGET_AVX2
+#define LSN_TARGET_AVX512
+#else
+// GCC and Clang only emit intrinsics for enabled instruction sets, which these enable per-function.
+#define LSN_TARGET_SSE4										__attribute__(( target( "sse4.1" ) ))
+#define LSN_TARGET_AVX2										__attribute__(( target( "avx2,fma" ) ))
+#define LSN_TARGET_AVX512									__attribute__(( target( "avx512f,avx512bw,avx2,fma" ) ))
+#endif	// #if defined( _MSC_VER ) && !defined( __clang__ )
+
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+#define LSN_FILTER_KERNELS_X86
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+
+
+namespace lsn {
+
+	/**
+	 * Class CFilterKernels
+	 * \brief The hot inner loops of the CPU video filters.
+	 *
+	 * Description: The hot inner loops of the CPU video filters.  Each instruction-set level lives in its own translation unit
+	 *	(LSNFilterKernels_SSE4.cpp, LSNFilterKernels_AVX2.cpp, LSNFilterKernels_AVX512.cpp) and does not depend on the
+	 *	instruction sets the rest of the program is built for, so one binary runs the fastest path each host supports.
+	 *	The table is chosen once, the first time Kernels() is called.
+	 */
+	class CFilterKernels {
+	public :
+		// == Enumerations.
+		/** Bisqwit decoder metrics. */
+		enum {
+			LSN_BISQWIT_OFFSET								= 5,												/**< The number of leading signal samples that produce no output. */
+			LSN_BISQWIT_PAD									= 64,												/**< The number of zero samples required on both sides of a Bisqwit signal. */
+			LSN_BISQWIT_PHASE_ROW							= 12 + 16,											/**< The number of entries in a Bisqwit cosine/sine row. */
+		};
+
+
+		// == Types.
+		/** A scanline for the Bisqwit NTSC decoder. */
+		struct LSN_BISQWIT_LINE {
+			const int8_t *									pi8Signal;											/**< i32Width signal samples, with LSN_BISQWIT_PAD zeros before and after. */
+			uint32_t *										pui32Output;										/**< Receives i32Width RGB32 samples. */
+			const int32_t *									pi32Cos;											/**< LSN_BISQWIT_PHASE_ROW cosines, repeating every 12, starting at the line's phase. */
+			const int32_t *									pi32Sin;											/**< LSN_BISQWIT_PHASE_ROW sines, repeating every 12, starting at the line's phase. */
+			int32_t											i32Width;											/**< The number of signal samples. */
+			int32_t											i32WidthY;											/**< The Y window width.  At most 36. */
+			int32_t											i32WidthI;											/**< The I window width.  At most 36. */
+			int32_t											i32WidthQ;											/**< The Q window width.  At most 36. */
+			int32_t											i32Brightness;										/**< The initial Y sum. */
+			int32_t											i32Y;												/**< The Y-to-RGB factor. */
+			int32_t											i32Ir, i32Ig, i32Ib;								/**< The I-to-RGB factors. */
+			int32_t											i32Qr, i32Qg, i32Qb;								/**< The Q-to-RGB factors. */
+		};
+
+		/** Convolves a run of signals into one Y, I and Q value. */
+		typedef void (*										PfConvolveYiq)( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+			const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ );
+		/** Adds three source rows to three destination rows. */
+		typedef void (*										PfAddRows3)( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+			const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal );
+		/** Adds a noise buffer to each block of 16 signals. */
+		typedef void (*										PfAddNoise)( float * _pfSignals, size_t _sTotal );
+		/** Decodes a Bisqwit NTSC scanline to RGB32. */
+		typedef void (*										PfBisqwitDecode)( const LSN_BISQWIT_LINE &_blLine );
+		/** Converts 9-bit palette indices to RGB32 through a 512-entry table. */
+		typedef void (*										PfPaletteToRgb32)( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal );
+		/** Converts 9-bit palette indices to packed 24-bit RGB through a 512-entry table. */
+		typedef void (*										PfPaletteToRgb24)( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal );
+		/** Decays a row of 8.8 fixed-point phosphor levels and lights them with a row of 8-bit channels. */
+		typedef void (*										PfPhosphorRow)( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+			uint16_t _ui16Decay, uint16_t _ui16Level );
+		/** Averages a row of 8-bit channels with the previous frame's row and stores the new row as the previous frame. */
+		typedef void (*										PfFrameBlendRow)( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal );
+
+		/** The kernel table. */
+		struct LSN_KERNELS {
+			PfConvolveYiq									pfConvolveYiq;										/**< Convolves signals into YIQ. */
+			PfAddRows3										pfAddRows3;											/**< Adds rows of YIQ. */
+			PfAddNoise										pfAddNoise;											/**< Adds noise to signals.  nullptr when there is no vector unit to do it, in which case no noise is added. */
+			PfBisqwitDecode									pfBisqwitDecode;									/**< Decodes a Bisqwit NTSC scanline. */
+			PfPaletteToRgb32								pfPaletteToRgb32;									/**< Converts palette indices to RGB32. */
+			PfPaletteToRgb24								pfPaletteToRgb24;									/**< Converts palette indices to 24-bit RGB. */
+			PfPhosphorRow									pfPhosphorRow;										/**< Applies phosphor persistence to a row. */
+			PfFrameBlendRow									pfFrameBlendRow;									/**< Blends a row with the previous frame. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Gets the kernel table for the current processor.  Selected on the first call.
+		 *
+		 * \return Returns the kernel table for the current processor.
+		 **/
+		static const LSN_KERNELS &							Kernels();
+
+		/**
+		 * Convolves a run of signals into one Y, I and Q value.  Y = sum(S*FY), I = sum(S*F*C), Q = sum(S*F*S).
+		 *
+		 * \param _pfSignals The signals.
+		 * \param _pfFilter The chroma filter weights, one per signal.
+		 * \param _pfFilterY The luma filter weights, one per signal.
+		 * \param _pfCos The cosine for each signal.
+		 * \param _pfSin The sine for each signal.
+		 * \param _sTotal The number of signals.
+		 * \param _fY Receives the Y value.
+		 * \param _fI Receives the I value.
+		 * \param _fQ Receives the Q value.
+		 **/
+		static void											ConvolveYiq( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+			const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ );
+
+		/**
+		 * Adds three source rows to three destination rows.
+		 *
+		 * \param _pfDstY The Y row to which to add.
+		 * \param _pfDstI The I row to which to add.
+		 * \param _pfDstQ The Q row to which to add.
+		 * \param _pfSrcY The Y values to add.
+		 * \param _pfSrcI The I values to add.
+		 * \param _pfSrcQ The Q values to add.
+		 * \param _sTotal The number of values in each row.
+		 **/
+		static void											AddRows3( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+			const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal );
+
+		/**
+		 * Decodes a Bisqwit NTSC scanline to RGB32 with running sums over sliding Y, I and Q windows.
+		 *
+		 * \param _blLine The scanline to decode.
+		 **/
+		static void											BisqwitDecode( const LSN_BISQWIT_LINE &_blLine );
+
+		/**
+		 * Converts 9-bit palette indices to RGB32.  Each table entry holds the bytes to write for that index.
+		 *
+		 * \param _pui16Indices The palette indices.  Each must be below 512.
+		 * \param _pui32Palette The 512 RGB32 values.
+		 * \param _pui32Dst Receives _sTotal RGB32 values.
+		 * \param _sTotal The number of indices to convert.
+		 **/
+		static void											PaletteToRgb32( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal );
+
+		/**
+		 * Converts 9-bit palette indices to packed 24-bit RGB.  The first 3 bytes of each table entry are written for that index.
+		 *
+		 * \param _pui16Indices The palette indices.  Each must be below 512.
+		 * \param _pui32Palette The 512 RGB32 values.
+		 * \param _pui8Dst Receives _sTotal * 3 bytes.
+		 * \param _sTotal The number of indices to convert.
+		 **/
+		static void											PaletteToRgb24( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal );
+
+		/**
+		 * Decays a row of 8.8 fixed-point phosphor levels and lights them with a row of 8-bit channels.  Each output is the brighter of
+		 *	the input and the decayed level, and each level becomes the brighter of the decayed level and the input scaled by _ui16Level.
+		 *
+		 * \param _pui8Src The input channels.
+		 * \param _pui16Accum The phosphor levels, updated on return.
+		 * \param _pui8Dst Receives _sTotal output channels.
+		 * \param _sTotal The number of channels.
+		 * \param _ui16Decay The 0.16 fixed-point multiplier applied to each level.
+		 * \param _ui16Level The 0.16 fixed-point multiplier applied to each input before it is stored as a level.
+		 **/
+		static void											PhosphorRow( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+			uint16_t _ui16Decay, uint16_t _ui16Level );
+
+		/**
+		 * Averages a row of 8-bit channels with the previous frame's row (rounding up) and stores the new row as the previous frame.
+		 *
+		 * \param _pui8Src The input channels.
+		 * \param _pui16Accum The previous frame's channels in 8.8 fixed point, updated on return.
+		 * \param _pui8Dst Receives _sTotal output channels.
+		 * \param _sTotal The number of channels.
+		 **/
+		static void											FrameBlendRow( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal );
+
+		/**
+		 * Runs the Bisqwit decoder one sample at a time over a range of samples.  Used by every version for the samples that do
+		 *	not fill a vector.
+		 *
+		 * \param _blLine The scanline to decode.
+		 * \param _i32From The first sample to decode.
+		 * \param _i32To The end of the samples to decode.
+		 * \param _i32SumY The running Y sum, updated on return.
+		 * \param _i32SumI The running I sum, updated on return.
+		 * \param _i32SumQ The running Q sum, updated on return.
+		 **/
+		static inline void									BisqwitSamples( const LSN_BISQWIT_LINE &_blLine, int32_t _i32From, int32_t _i32To,
+			int32_t &_i32SumY, int32_t &_i32SumI, int32_t &_i32SumQ );
+
+		/**
+		 * Converts Bisqwit Y, I and Q sums to an RGB32 value.
+		 *
+		 * \param _blLine The scanline being decoded.
+		 * \param _i32SumY The Y sum.
+		 * \param _i32SumI The I sum.
+		 * \param _i32SumQ The Q sum.
+		 * \return Returns the RGB32 value.
+		 **/
+		static inline uint32_t								BisqwitRgb( const LSN_BISQWIT_LINE &_blLine, int32_t _i32SumY, int32_t _i32SumI, int32_t _i32SumQ );
+
+#ifdef LSN_FILTER_KERNELS_X86
+		// SSE 4.1.
+		static void											ConvolveYiq_SSE4( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+			const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ );
+		static void											AddRows3_SSE4( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+			const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal );
+		static void											AddNoise_SSE4( float * _pfSignals, size_t _sTotal );
+		static void											BisqwitDecode_SSE4( const LSN_BISQWIT_LINE &_blLine );
+		static void											PaletteToRgb32_SSE4( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal );
+		static void											PaletteToRgb24_SSE4( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal );
+		static void											PhosphorRow_SSE4( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+			uint16_t _ui16Decay, uint16_t _ui16Level );
+		static void											FrameBlendRow_SSE4( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal );
+
+		// AVX 2 and FMA.
+		static void											ConvolveYiq_AVX2( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+			const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ );
+		static void											AddRows3_AVX2( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+			const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal );
+		static void											AddNoise_AVX2( float * _pfSignals, size_t _sTotal );
+		static void											BisqwitDecode_AVX2( const LSN_BISQWIT_LINE &_blLine );
+		static void											PaletteToRgb32_AVX2( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal );
+		static void											PaletteToRgb24_AVX2( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal );
+		static void											PhosphorRow_AVX2( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+			uint16_t _ui16Decay, uint16_t _ui16Level );
+		static void											FrameBlendRow_AVX2( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal );
+
+		// AVX-512F and AVX-512BW.
+		static void											ConvolveYiq_AVX512( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+			const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ );
+		static void											AddRows3_AVX512( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+			const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal );
+		static void											AddNoise_AVX512( float * _pfSignals, size_t _sTotal );
+		static void											BisqwitDecode_AVX512( const LSN_BISQWIT_LINE &_blLine );
+		static void											PaletteToRgb32_AVX512( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal );
+		static void											PaletteToRgb24_AVX512( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal );
+		static void											PhosphorRow_AVX512( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+			uint16_t _ui16Decay, uint16_t _ui16Level );
+		static void											FrameBlendRow_AVX512( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal );
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
+
+
+	protected :
+		// == Functions.
+		/**
+		 * Selects the kernel table for the current processor.
+		 *
+		 * \return Returns the kernel table for the current processor.
+		 **/
+		static LSN_KERNELS									Select();
+	};
+
+
+	// == Functions.
+	/**
+	 * Runs the Bisqwit decoder one sample at a time over a range of samples.  Used by every version for the samples that do
+	 *	not fill a vector.
+	 *
+	 * \param _blLine The scanline to decode.
+	 * \param _i32From The first sample to decode.
+	 * \param _i32To The end of the samples to decode.
+	 * \param _i32SumY The running Y sum, updated on return.
+	 * \param _i32SumI The running I sum, updated on return.
+	 * \param _i32SumQ The running Q sum, updated on return.
+	 **/
+	inline void CFilterKernels::BisqwitSamples( const LSN_BISQWIT_LINE &_blLine, int32_t _i32From, int32_t _i32To,
+		int32_t &_i32SumY, int32_t &_i32SumI, int32_t &_i32SumQ ) {
+		const int8_t * pi8Sig = _blLine.pi8Signal;
+		for ( int32_t I = _i32From; I < _i32To; ++I ) {
+			// Samples before the line are padding zeros and the phase rows start 36 samples back, so neither index goes negative.
+			int32_t i32Sample = pi8Sig[I];
+			int32_t i32I = I - _blLine.i32WidthI, i32Q = I - _blLine.i32WidthQ;
+			_i32SumY += i32Sample - pi8Sig[I-_blLine.i32WidthY];
+			_i32SumI += i32Sample * _blLine.pi32Cos[(I+36)%12] - pi8Sig[i32I] * _blLine.pi32Cos[(i32I+36)%12];
+			_i32SumQ += i32Sample * _blLine.pi32Sin[(I+36)%12] - pi8Sig[i32Q] * _blLine.pi32Sin[(i32Q+36)%12];
+			if ( I >= LSN_BISQWIT_OFFSET ) {
+				_blLine.pui32Output[I-LSN_BISQWIT_OFFSET] = BisqwitRgb( _blLine, _i32SumY, _i32SumI, _i32SumQ );
+			}
+		}
+	}
+
+	/**
+	 * Converts Bisqwit Y, I and Q sums to an RGB32 value.
+	 *
+	 * \param _blLine The scanline being decoded.
+	 * \param _i32SumY The Y sum.
+	 * \param _i32SumI The I sum.
+	 * \param _i32SumQ The Q sum.
+	 * \return Returns the RGB32 value.
+	 **/
+	inline uint32_t CFilterKernels::BisqwitRgb( const LSN_BISQWIT_LINE &_blLine, int32_t _i32SumY, int32_t _i32SumI, int32_t _i32SumQ ) {
+		int32_t i32Y = _i32SumY * _blLine.i32Y;
+		int32_t i32R = std::min( 255, std::max( 0, (i32Y + _i32SumI * _blLine.i32Ir + _i32SumQ * _blLine.i32Qr) / 65536 ) );
+		int32_t i32G = std::min( 255, std::max( 0, (i32Y + _i32SumI * _blLine.i32Ig + _i32SumQ * _blLine.i32Qg) / 65536 ) );
+		int32_t i32B = std::min( 255, std::max( 0, (i32Y + _i32SumI * _blLine.i32Ib + _i32SumQ * _blLine.i32Qb) / 65536 ) );
+		return 0xFF000000 | (uint32_t( i32R ) << 16) | (uint32_t( i32G ) << 8) | uint32_t( i32B );
+	}
+
+}	// namespace lsn
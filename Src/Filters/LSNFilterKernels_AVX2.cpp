@@ -0,0 +1,288 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX 2 versions of the CPU video filter kernels.  Built without depending on the project-wide instruction set
+ *	so that CFilterKernels can select them at run-time.
+ */
+
+#include "LSNFilterKernels.h"
+#include "../Utilities/LSNUtilities.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Horizontally adds all the floats in a given register.
+	 *
+	 * \param _mReg The register containing all of the values to sum.
+	 * \return Returns the sum of all the floats in the given register.
+	 **/
+	static inline LSN_TARGET_AVX2 float						HorizontalSum_AVX2( __m256 _mReg ) {
+		__m128 mSum = _mm_add_ps( _mm256_castps256_ps128( _mReg ), _mm256_extractf128_ps( _mReg, 1 ) );
+		__m128 mShuf = _mm_movehdup_ps( mSum );
+		mSum = _mm_add_ps( mSum, mShuf );
+		mShuf = _mm_movehl_ps( mShuf, mSum );
+		mSum = _mm_add_ss( mSum, mShuf );
+		return _mm_cvtss_f32( mSum );
+	}
+
+	/**
+	 * Convolves a run of signals into one Y, I and Q value using AVX 2 and FMA.
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _pfFilter The chroma filter weights, one per signal.
+	 * \param _pfFilterY The luma filter weights, one per signal.
+	 * \param _pfCos The cosine for each signal.
+	 * \param _pfSin The sine for each signal.
+	 * \param _sTotal The number of signals.
+	 * \param _fY Receives the Y value.
+	 * \param _fI Receives the I value.
+	 * \param _fQ Receives the Q value.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::ConvolveYiq_AVX2( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+		const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ ) {
+		__m256 mY = _mm256_setzero_ps(), mI = _mm256_setzero_ps(), mQ = _mm256_setzero_ps();
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			__m256 mSignals = _mm256_loadu_ps( _pfSignals + I );
+			__m256 mLevels = _mm256_mul_ps( mSignals, _mm256_loadu_ps( _pfFilter + I ) );
+			mY = _mm256_fmadd_ps( mSignals, _mm256_loadu_ps( _pfFilterY + I ), mY );
+			mI = _mm256_fmadd_ps( mLevels, _mm256_loadu_ps( _pfCos + I ), mI );
+			mQ = _mm256_fmadd_ps( mLevels, _mm256_loadu_ps( _pfSin + I ), mQ );
+		}
+		float fY = HorizontalSum_AVX2( mY ), fI = HorizontalSum_AVX2( mI ), fQ = HorizontalSum_AVX2( mQ );
+		for ( ; I < _sTotal; ++I ) {
+			float fLevel = _pfSignals[I] * _pfFilter[I];
+			fY += _pfSignals[I] * _pfFilterY[I];
+			fI += _pfCos[I] * fLevel;
+			fQ += _pfSin[I] * fLevel;
+		}
+		_fY = fY;
+		_fI = fI;
+		_fQ = fQ;
+	}
+
+	/**
+	 * Adds three source rows to three destination rows using AVX 2.
+	 *
+	 * \param _pfDstY The Y row to which to add.
+	 * \param _pfDstI The I row to which to add.
+	 * \param _pfDstQ The Q row to which to add.
+	 * \param _pfSrcY The Y values to add.
+	 * \param _pfSrcI The I values to add.
+	 * \param _pfSrcQ The Q values to add.
+	 * \param _sTotal The number of values in each row.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::AddRows3_AVX2( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+		const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			_mm256_storeu_ps( _pfDstY + I, _mm256_add_ps( _mm256_loadu_ps( _pfDstY + I ), _mm256_loadu_ps( _pfSrcY + I ) ) );
+			_mm256_storeu_ps( _pfDstI + I, _mm256_add_ps( _mm256_loadu_ps( _pfDstI + I ), _mm256_loadu_ps( _pfSrcI + I ) ) );
+			_mm256_storeu_ps( _pfDstQ + I, _mm256_add_ps( _mm256_loadu_ps( _pfDstQ + I ), _mm256_loadu_ps( _pfSrcQ + I ) ) );
+		}
+		for ( ; I < _sTotal; ++I ) {
+			_pfDstY[I] += _pfSrcY[I];
+			_pfDstI[I] += _pfSrcI[I];
+			_pfDstQ[I] += _pfSrcQ[I];
+		}
+	}
+
+	/**
+	 * Adds a randomly selected noise buffer to each block of 16 signals using AVX 2.  The last block is written in full, so the
+	 *	signal buffer must be padded to a multiple of 16.
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _sTotal The number of signals.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::AddNoise_AVX2( float * _pfSignals, size_t _sTotal ) {
+		for ( float * pfEnd = _pfSignals + _sTotal; _pfSignals < pfEnd; _pfSignals += 16 ) {
+			const float * pfNoise = CUtilities::m_fNoiseBuffers[LSN_NOISE_BUFFER(CUtilities::Rand())];
+			_mm256_storeu_ps( _pfSignals, _mm256_add_ps( _mm256_loadu_ps( _pfSignals ), _mm256_loadu_ps( pfNoise ) ) );
+			_mm256_storeu_ps( _pfSignals + 8, _mm256_add_ps( _mm256_loadu_ps( _pfSignals + 8 ), _mm256_loadu_ps( pfNoise + 8 ) ) );
+		}
+	}
+
+	/**
+	 * Computes the inclusive prefix sum of the 8 integers in a register.
+	 *
+	 * \param _mVal The values to sum.
+	 * \return Returns the prefix sums.
+	 **/
+	static inline LSN_TARGET_AVX2 __m256i					PrefixSum_AVX2( __m256i _mVal ) {
+		// Within each 128-bit lane.
+		_mVal = _mm256_add_epi32( _mVal, _mm256_slli_si256( _mVal, 4 ) );
+		_mVal = _mm256_add_epi32( _mVal, _mm256_slli_si256( _mVal, 8 ) );
+		// Carry the low lane's total into the high lane.
+		__m256i mLow = _mm256_permutevar8x32_epi32( _mVal, _mm256_set1_epi32( 3 ) );
+		return _mm256_add_epi32( _mVal, _mm256_blend_epi32( _mm256_setzero_si256(), mLow, 0xF0 ) );
+	}
+
+	/**
+	 * Loads 8 signed bytes and widens them to 32-bit integers.
+	 *
+	 * \param _pi8Src The bytes to load.
+	 * \return Returns the widened values.
+	 **/
+	static inline LSN_TARGET_AVX2 __m256i					Load8_AVX2( const int8_t * _pi8Src ) {
+		return _mm256_cvtepi8_epi32( _mm_loadl_epi64( reinterpret_cast<const __m128i *>(_pi8Src) ) );
+	}
+
+	/**
+	 * Decodes a Bisqwit NTSC scanline to RGB32 using AVX 2.  The sliding-window sums are formed from per-sample differences with
+	 *	an in-register prefix sum, carrying the last lane into the next vector.
+	 *
+	 * \param _blLine The scanline to decode.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::BisqwitDecode_AVX2( const LSN_BISQWIT_LINE &_blLine ) {
+		int32_t i32SumY = _blLine.i32Brightness, i32SumI = 0, i32SumQ = 0;
+		const int32_t i32End = _blLine.i32Width + LSN_BISQWIT_OFFSET;
+		// The first vector would straddle the leading samples that produce no output.
+		int32_t I = std::min<int32_t>( 8, i32End );
+		BisqwitSamples( _blLine, 0, I, i32SumY, i32SumI, i32SumQ );
+
+		const int8_t * pi8Sig = _blLine.pi8Signal;
+		__m256i mSumY = _mm256_set1_epi32( i32SumY ), mSumI = _mm256_set1_epi32( i32SumI ), mSumQ = _mm256_set1_epi32( i32SumQ );
+		const __m256i mY = _mm256_set1_epi32( _blLine.i32Y );
+		const __m256i mIr = _mm256_set1_epi32( _blLine.i32Ir ), mIg = _mm256_set1_epi32( _blLine.i32Ig ), mIb = _mm256_set1_epi32( _blLine.i32Ib );
+		const __m256i mQr = _mm256_set1_epi32( _blLine.i32Qr ), mQg = _mm256_set1_epi32( _blLine.i32Qg ), mQb = _mm256_set1_epi32( _blLine.i32Qb );
+		const __m256i mZero = _mm256_setzero_si256(), m255 = _mm256_set1_epi32( 255 ), mAlpha = _mm256_set1_epi32( int32_t( 0xFF000000 ) );
+		const __m256i mLast = _mm256_set1_epi32( 7 );
+		for ( ; I + 8 <= i32End; I += 8 ) {
+			int32_t i32I = I - _blLine.i32WidthI, i32Q = I - _blLine.i32WidthQ;
+			__m256i mSig = Load8_AVX2( pi8Sig + I );
+			__m256i mDy = _mm256_sub_epi32( mSig, Load8_AVX2( pi8Sig + I - _blLine.i32WidthY ) );
+			__m256i mDi = _mm256_sub_epi32( _mm256_mullo_epi32( mSig, _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_blLine.pi32Cos + (I + 36) % 12) ) ),
+				_mm256_mullo_epi32( Load8_AVX2( pi8Sig + i32I ), _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_blLine.pi32Cos + (i32I + 36) % 12) ) ) );
+			__m256i mDq = _mm256_sub_epi32( _mm256_mullo_epi32( mSig, _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_blLine.pi32Sin + (I + 36) % 12) ) ),
+				_mm256_mullo_epi32( Load8_AVX2( pi8Sig + i32Q ), _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_blLine.pi32Sin + (i32Q + 36) % 12) ) ) );
+			mSumY = _mm256_add_epi32( PrefixSum_AVX2( mDy ), mSumY );
+			mSumI = _mm256_add_epi32( PrefixSum_AVX2( mDi ), mSumI );
+			mSumQ = _mm256_add_epi32( PrefixSum_AVX2( mDq ), mSumQ );
+
+			__m256i mYy = _mm256_mullo_epi32( mSumY, mY );
+			__m256i mR = _mm256_add_epi32( mYy, _mm256_add_epi32( _mm256_mullo_epi32( mSumI, mIr ), _mm256_mullo_epi32( mSumQ, mQr ) ) );
+			__m256i mG = _mm256_add_epi32( mYy, _mm256_add_epi32( _mm256_mullo_epi32( mSumI, mIg ), _mm256_mullo_epi32( mSumQ, mQg ) ) );
+			__m256i mB = _mm256_add_epi32( mYy, _mm256_add_epi32( _mm256_mullo_epi32( mSumI, mIb ), _mm256_mullo_epi32( mSumQ, mQb ) ) );
+			// Flooring instead of truncating only changes negative values, which clamp to 0 either way.
+			mR = _mm256_min_epi32( _mm256_max_epi32( _mm256_srai_epi32( mR, 16 ), mZero ), m255 );
+			mG = _mm256_min_epi32( _mm256_max_epi32( _mm256_srai_epi32( mG, 16 ), mZero ), m255 );
+			mB = _mm256_min_epi32( _mm256_max_epi32( _mm256_srai_epi32( mB, 16 ), mZero ), m255 );
+			__m256i mRgb = _mm256_or_si256( _mm256_or_si256( mAlpha, _mm256_slli_epi32( mR, 16 ) ), _mm256_or_si256( _mm256_slli_epi32( mG, 8 ), mB ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_blLine.pui32Output + I - LSN_BISQWIT_OFFSET), mRgb );
+
+			mSumY = _mm256_permutevar8x32_epi32( mSumY, mLast );
+			mSumI = _mm256_permutevar8x32_epi32( mSumI, mLast );
+			mSumQ = _mm256_permutevar8x32_epi32( mSumQ, mLast );
+		}
+		i32SumY = _mm_cvtsi128_si32( _mm256_castsi256_si128( mSumY ) );
+		i32SumI = _mm_cvtsi128_si32( _mm256_castsi256_si128( mSumI ) );
+		i32SumQ = _mm_cvtsi128_si32( _mm256_castsi256_si128( mSumQ ) );
+		BisqwitSamples( _blLine, I, i32End, i32SumY, i32SumI, i32SumQ );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to RGB32 using AVX 2 gathers.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui32Dst Receives _sTotal RGB32 values.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::PaletteToRgb32_AVX2( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal ) {
+		const int * piPalette = reinterpret_cast<const int *>(_pui32Palette);
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			__m256i mIdx = _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui16Indices + I) ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui32Dst + I), _mm256_i32gather_epi32( piPalette, mIdx, 4 ) );
+		}
+		PaletteToRgb32( _pui16Indices + I, _pui32Palette, _pui32Dst + I, _sTotal - I );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to packed 24-bit RGB using AVX 2 gathers.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui8Dst Receives _sTotal * 3 bytes.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::PaletteToRgb24_AVX2( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal ) {
+		const int * piPalette = reinterpret_cast<const int *>(_pui32Palette);
+		// Drops the 4th byte of each pixel within each lane, then moves the 2 lanes' 12 bytes together.
+		const __m256i mPack = _mm256_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+			0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 );
+		const __m256i mJoin = _mm256_setr_epi32( 0, 1, 2, 4, 5, 6, 7, 7 );
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			__m256i mIdx = _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui16Indices + I) ) );
+			__m256i mRgb = _mm256_permutevar8x32_epi32( _mm256_shuffle_epi8( _mm256_i32gather_epi32( piPalette, mIdx, 4 ), mPack ), mJoin );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui8Dst + I * 3), _mm256_castsi256_si128( mRgb ) );
+			_mm_storel_epi64( reinterpret_cast<__m128i *>(_pui8Dst + I * 3 + 16), _mm256_extracti128_si256( mRgb, 1 ) );
+		}
+		PaletteToRgb24( _pui16Indices + I, _pui32Palette, _pui8Dst + I * 3, _sTotal - I );
+	}
+
+	/**
+	 * Decays a row of 8.8 fixed-point phosphor levels and lights them with a row of 8-bit channels using AVX 2.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The phosphor levels, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 * \param _ui16Decay The 0.16 fixed-point multiplier applied to each level.
+	 * \param _ui16Level The 0.16 fixed-point multiplier applied to each input before it is stored as a level.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::PhosphorRow_AVX2( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+		uint16_t _ui16Decay, uint16_t _ui16Level ) {
+		const __m256i mDecay = _mm256_set1_epi16( int16_t( _ui16Decay ) );
+		const __m256i mLevel = _mm256_set1_epi16( int16_t( _ui16Level ) );
+		size_t I = 0;
+		for ( ; I + 32 <= _sTotal; I += 32 ) {
+			__m256i mNew0 = _mm256_slli_epi16( _mm256_cvtepu8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Src + I) ) ), 8 );
+			__m256i mNew1 = _mm256_slli_epi16( _mm256_cvtepu8_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Src + I + 16) ) ), 8 );
+			__m256i mOld0 = _mm256_mulhi_epu16( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui16Accum + I) ), mDecay );
+			__m256i mOld1 = _mm256_mulhi_epu16( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui16Accum + I + 16) ), mDecay );
+			// The pack works within each lane, so the middle 2 quarters are swapped back afterwards.
+			__m256i mOut = _mm256_packus_epi16(
+				_mm256_srli_epi16( _mm256_max_epu16( mOld0, mNew0 ), 8 ),
+				_mm256_srli_epi16( _mm256_max_epu16( mOld1, mNew1 ), 8 ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui8Dst + I), _mm256_permute4x64_epi64( mOut, 0xD8 ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui16Accum + I), _mm256_max_epu16( mOld0, _mm256_mulhi_epu16( mNew0, mLevel ) ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui16Accum + I + 16), _mm256_max_epu16( mOld1, _mm256_mulhi_epu16( mNew1, mLevel ) ) );
+		}
+		PhosphorRow( _pui8Src + I, _pui16Accum + I, _pui8Dst + I, _sTotal - I, _ui16Decay, _ui16Level );
+	}
+
+	/**
+	 * Averages a row of 8-bit channels with the previous frame's row using AVX 2.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The previous frame's channels in 8.8 fixed point, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 **/
+	LSN_TARGET_AVX2 void CFilterKernels::FrameBlendRow_AVX2( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 32 <= _sTotal; I += 32 ) {
+			__m128i mSrc0 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Src + I) );
+			__m128i mSrc1 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Src + I + 16) );
+			__m256i mPrev = _mm256_permute4x64_epi64( _mm256_packus_epi16(
+				_mm256_srli_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui16Accum + I) ), 8 ),
+				_mm256_srli_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui16Accum + I + 16) ), 8 ) ), 0xD8 );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui8Dst + I), _mm256_avg_epu8( _mm256_set_m128i( mSrc1, mSrc0 ), mPrev ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui16Accum + I), _mm256_slli_epi16( _mm256_cvtepu8_epi16( mSrc0 ), 8 ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui16Accum + I + 16), _mm256_slli_epi16( _mm256_cvtepu8_epi16( mSrc1 ), 8 ) );
+		}
+		FrameBlendRow( _pui8Src + I, _pui16Accum + I, _pui8Dst + I, _sTotal - I );
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
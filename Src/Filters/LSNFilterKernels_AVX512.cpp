@@ -0,0 +1,260 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX-512 versions of the CPU video filter kernels.  Built without depending on the project-wide instruction set
+ *	so that CFilterKernels can select them at run-time.
+ */
+
+#include "LSNFilterKernels.h"
+#include "../Utilities/LSNUtilities.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Convolves a run of signals into one Y, I and Q value using AVX-512F.
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _pfFilter The chroma filter weights, one per signal.
+	 * \param _pfFilterY The luma filter weights, one per signal.
+	 * \param _pfCos The cosine for each signal.
+	 * \param _pfSin The sine for each signal.
+	 * \param _sTotal The number of signals.
+	 * \param _fY Receives the Y value.
+	 * \param _fI Receives the I value.
+	 * \param _fQ Receives the Q value.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::ConvolveYiq_AVX512( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+		const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ ) {
+		__m512 mY = _mm512_setzero_ps(), mI = _mm512_setzero_ps(), mQ = _mm512_setzero_ps();
+		size_t I = 0;
+		for ( ; I + 16 <= _sTotal; I += 16 ) {
+			__m512 mSignals = _mm512_loadu_ps( _pfSignals + I );
+			__m512 mLevels = _mm512_mul_ps( mSignals, _mm512_loadu_ps( _pfFilter + I ) );
+			mY = _mm512_fmadd_ps( mSignals, _mm512_loadu_ps( _pfFilterY + I ), mY );
+			mI = _mm512_fmadd_ps( mLevels, _mm512_loadu_ps( _pfCos + I ), mI );
+			mQ = _mm512_fmadd_ps( mLevels, _mm512_loadu_ps( _pfSin + I ), mQ );
+		}
+		if ( I < _sTotal ) {
+			// The tail is done with a mask rather than a scalar loop.
+			__mmask16 mMask = __mmask16( (1U << (_sTotal - I)) - 1U );
+			__m512 mSignals = _mm512_maskz_loadu_ps( mMask, _pfSignals + I );
+			__m512 mLevels = _mm512_mul_ps( mSignals, _mm512_maskz_loadu_ps( mMask, _pfFilter + I ) );
+			mY = _mm512_fmadd_ps( mSignals, _mm512_maskz_loadu_ps( mMask, _pfFilterY + I ), mY );
+			mI = _mm512_fmadd_ps( mLevels, _mm512_maskz_loadu_ps( mMask, _pfCos + I ), mI );
+			mQ = _mm512_fmadd_ps( mLevels, _mm512_maskz_loadu_ps( mMask, _pfSin + I ), mQ );
+		}
+		_fY = _mm512_reduce_add_ps( mY );
+		_fI = _mm512_reduce_add_ps( mI );
+		_fQ = _mm512_reduce_add_ps( mQ );
+	}
+
+	/**
+	 * Adds three source rows to three destination rows using AVX-512F.
+	 *
+	 * \param _pfDstY The Y row to which to add.
+	 * \param _pfDstI The I row to which to add.
+	 * \param _pfDstQ The Q row to which to add.
+	 * \param _pfSrcY The Y values to add.
+	 * \param _pfSrcI The I values to add.
+	 * \param _pfSrcQ The Q values to add.
+	 * \param _sTotal The number of values in each row.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::AddRows3_AVX512( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+		const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 16 <= _sTotal; I += 16 ) {
+			_mm512_storeu_ps( _pfDstY + I, _mm512_add_ps( _mm512_loadu_ps( _pfDstY + I ), _mm512_loadu_ps( _pfSrcY + I ) ) );
+			_mm512_storeu_ps( _pfDstI + I, _mm512_add_ps( _mm512_loadu_ps( _pfDstI + I ), _mm512_loadu_ps( _pfSrcI + I ) ) );
+			_mm512_storeu_ps( _pfDstQ + I, _mm512_add_ps( _mm512_loadu_ps( _pfDstQ + I ), _mm512_loadu_ps( _pfSrcQ + I ) ) );
+		}
+		if ( I < _sTotal ) {
+			__mmask16 mMask = __mmask16( (1U << (_sTotal - I)) - 1U );
+			_mm512_mask_storeu_ps( _pfDstY + I, mMask, _mm512_add_ps( _mm512_maskz_loadu_ps( mMask, _pfDstY + I ), _mm512_maskz_loadu_ps( mMask, _pfSrcY + I ) ) );
+			_mm512_mask_storeu_ps( _pfDstI + I, mMask, _mm512_add_ps( _mm512_maskz_loadu_ps( mMask, _pfDstI + I ), _mm512_maskz_loadu_ps( mMask, _pfSrcI + I ) ) );
+			_mm512_mask_storeu_ps( _pfDstQ + I, mMask, _mm512_add_ps( _mm512_maskz_loadu_ps( mMask, _pfDstQ + I ), _mm512_maskz_loadu_ps( mMask, _pfSrcQ + I ) ) );
+		}
+	}
+
+	/**
+	 * Adds a randomly selected noise buffer to each block of 16 signals using AVX-512F.  The last block is written in full, so the
+	 *	signal buffer must be padded to a multiple of 16.
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _sTotal The number of signals.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::AddNoise_AVX512( float * _pfSignals, size_t _sTotal ) {
+		for ( float * pfEnd = _pfSignals + _sTotal; _pfSignals < pfEnd; _pfSignals += 16 ) {
+			const float * pfNoise = CUtilities::m_fNoiseBuffers[LSN_NOISE_BUFFER(CUtilities::Rand())];
+			_mm512_storeu_ps( _pfSignals, _mm512_add_ps( _mm512_loadu_ps( _pfSignals ), _mm512_loadu_ps( pfNoise ) ) );
+		}
+	}
+
+	/**
+	 * Computes the inclusive prefix sum of the 16 integers in a register.
+	 *
+	 * \param _mVal The values to sum.
+	 * \return Returns the prefix sums.
+	 **/
+	static inline LSN_TARGET_AVX512 __m512i					PrefixSum_AVX512( __m512i _mVal ) {
+		// Each step adds the register shifted up by 1, 2, 4 and 8 lanes, shifting in zeros.
+		const __m512i mZero = _mm512_setzero_si512();
+		_mVal = _mm512_add_epi32( _mVal, _mm512_alignr_epi32( _mVal, mZero, 15 ) );
+		_mVal = _mm512_add_epi32( _mVal, _mm512_alignr_epi32( _mVal, mZero, 14 ) );
+		_mVal = _mm512_add_epi32( _mVal, _mm512_alignr_epi32( _mVal, mZero, 12 ) );
+		return _mm512_add_epi32( _mVal, _mm512_alignr_epi32( _mVal, mZero, 8 ) );
+	}
+
+	/**
+	 * Loads 16 signed bytes and widens them to 32-bit integers.
+	 *
+	 * \param _pi8Src The bytes to load.
+	 * \return Returns the widened values.
+	 **/
+	static inline LSN_TARGET_AVX512 __m512i					Load16_AVX512( const int8_t * _pi8Src ) {
+		return _mm512_cvtepi8_epi32( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pi8Src) ) );
+	}
+
+	/**
+	 * Decodes a Bisqwit NTSC scanline to RGB32 using AVX-512F.  The sliding-window sums are formed from per-sample differences with
+	 *	an in-register prefix sum, carrying the last lane into the next vector.
+	 *
+	 * \param _blLine The scanline to decode.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::BisqwitDecode_AVX512( const LSN_BISQWIT_LINE &_blLine ) {
+		int32_t i32SumY = _blLine.i32Brightness, i32SumI = 0, i32SumQ = 0;
+		const int32_t i32End = _blLine.i32Width + LSN_BISQWIT_OFFSET;
+		// The first vector would straddle the leading samples that produce no output.
+		int32_t I = std::min<int32_t>( 8, i32End );
+		BisqwitSamples( _blLine, 0, I, i32SumY, i32SumI, i32SumQ );
+
+		const int8_t * pi8Sig = _blLine.pi8Signal;
+		__m512i mSumY = _mm512_set1_epi32( i32SumY ), mSumI = _mm512_set1_epi32( i32SumI ), mSumQ = _mm512_set1_epi32( i32SumQ );
+		const __m512i mY = _mm512_set1_epi32( _blLine.i32Y );
+		const __m512i mIr = _mm512_set1_epi32( _blLine.i32Ir ), mIg = _mm512_set1_epi32( _blLine.i32Ig ), mIb = _mm512_set1_epi32( _blLine.i32Ib );
+		const __m512i mQr = _mm512_set1_epi32( _blLine.i32Qr ), mQg = _mm512_set1_epi32( _blLine.i32Qg ), mQb = _mm512_set1_epi32( _blLine.i32Qb );
+		const __m512i mZero = _mm512_setzero_si512(), m255 = _mm512_set1_epi32( 255 ), mAlpha = _mm512_set1_epi32( int32_t( 0xFF000000 ) );
+		const __m512i mLast = _mm512_set1_epi32( 15 );
+		for ( ; I + 16 <= i32End; I += 16 ) {
+			int32_t i32I = I - _blLine.i32WidthI, i32Q = I - _blLine.i32WidthQ;
+			__m512i mSig = Load16_AVX512( pi8Sig + I );
+			__m512i mDy = _mm512_sub_epi32( mSig, Load16_AVX512( pi8Sig + I - _blLine.i32WidthY ) );
+			__m512i mDi = _mm512_sub_epi32( _mm512_mullo_epi32( mSig, _mm512_loadu_si512( _blLine.pi32Cos + (I + 36) % 12 ) ),
+				_mm512_mullo_epi32( Load16_AVX512( pi8Sig + i32I ), _mm512_loadu_si512( _blLine.pi32Cos + (i32I + 36) % 12 ) ) );
+			__m512i mDq = _mm512_sub_epi32( _mm512_mullo_epi32( mSig, _mm512_loadu_si512( _blLine.pi32Sin + (I + 36) % 12 ) ),
+				_mm512_mullo_epi32( Load16_AVX512( pi8Sig + i32Q ), _mm512_loadu_si512( _blLine.pi32Sin + (i32Q + 36) % 12 ) ) );
+			mSumY = _mm512_add_epi32( PrefixSum_AVX512( mDy ), mSumY );
+			mSumI = _mm512_add_epi32( PrefixSum_AVX512( mDi ), mSumI );
+			mSumQ = _mm512_add_epi32( PrefixSum_AVX512( mDq ), mSumQ );
+
+			__m512i mYy = _mm512_mullo_epi32( mSumY, mY );
+			__m512i mR = _mm512_add_epi32( mYy, _mm512_add_epi32( _mm512_mullo_epi32( mSumI, mIr ), _mm512_mullo_epi32( mSumQ, mQr ) ) );
+			__m512i mG = _mm512_add_epi32( mYy, _mm512_add_epi32( _mm512_mullo_epi32( mSumI, mIg ), _mm512_mullo_epi32( mSumQ, mQg ) ) );
+			__m512i mB = _mm512_add_epi32( mYy, _mm512_add_epi32( _mm512_mullo_epi32( mSumI, mIb ), _mm512_mullo_epi32( mSumQ, mQb ) ) );
+			// Flooring instead of truncating only changes negative values, which clamp to 0 either way.
+			mR = _mm512_min_epi32( _mm512_max_epi32( _mm512_srai_epi32( mR, 16 ), mZero ), m255 );
+			mG = _mm512_min_epi32( _mm512_max_epi32( _mm512_srai_epi32( mG, 16 ), mZero ), m255 );
+			mB = _mm512_min_epi32( _mm512_max_epi32( _mm512_srai_epi32( mB, 16 ), mZero ), m255 );
+			__m512i mRgb = _mm512_or_si512( _mm512_or_si512( mAlpha, _mm512_slli_epi32( mR, 16 ) ), _mm512_or_si512( _mm512_slli_epi32( mG, 8 ), mB ) );
+			_mm512_storeu_si512( _blLine.pui32Output + I - LSN_BISQWIT_OFFSET, mRgb );
+
+			mSumY = _mm512_permutexvar_epi32( mLast, mSumY );
+			mSumI = _mm512_permutexvar_epi32( mLast, mSumI );
+			mSumQ = _mm512_permutexvar_epi32( mLast, mSumQ );
+		}
+		i32SumY = _mm_cvtsi128_si32( _mm512_castsi512_si128( mSumY ) );
+		i32SumI = _mm_cvtsi128_si32( _mm512_castsi512_si128( mSumI ) );
+		i32SumQ = _mm_cvtsi128_si32( _mm512_castsi512_si128( mSumQ ) );
+		BisqwitSamples( _blLine, I, i32End, i32SumY, i32SumI, i32SumQ );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to RGB32 using AVX-512 gathers.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui32Dst Receives _sTotal RGB32 values.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::PaletteToRgb32_AVX512( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 16 <= _sTotal; I += 16 ) {
+			__m512i mIdx = _mm512_cvtepu16_epi32( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui16Indices + I) ) );
+			_mm512_storeu_si512( _pui32Dst + I, _mm512_i32gather_epi32( mIdx, _pui32Palette, 4 ) );
+		}
+		PaletteToRgb32( _pui16Indices + I, _pui32Palette, _pui32Dst + I, _sTotal - I );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to packed 24-bit RGB using AVX-512 gathers.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui8Dst Receives _sTotal * 3 bytes.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::PaletteToRgb24_AVX512( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal ) {
+		// Drops the 4th byte of each pixel within each lane, then moves the 4 lanes' 12 bytes together.
+		const __m512i mPack = _mm512_broadcast_i32x4( _mm_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 ) );
+		const __m512i mJoin = _mm512_setr_epi32( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15 );
+		size_t I = 0;
+		for ( ; I + 16 <= _sTotal; I += 16 ) {
+			__m512i mIdx = _mm512_cvtepu16_epi32( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui16Indices + I) ) );
+			__m512i mRgb = _mm512_permutexvar_epi32( mJoin, _mm512_shuffle_epi8( _mm512_i32gather_epi32( mIdx, _pui32Palette, 4 ), mPack ) );
+			_mm512_mask_storeu_epi32( _pui8Dst + I * 3, __mmask16( 0x0FFF ), mRgb );
+		}
+		PaletteToRgb24( _pui16Indices + I, _pui32Palette, _pui8Dst + I * 3, _sTotal - I );
+	}
+
+	/**
+	 * Decays a row of 8.8 fixed-point phosphor levels and lights them with a row of 8-bit channels using AVX-512.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The phosphor levels, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 * \param _ui16Decay The 0.16 fixed-point multiplier applied to each level.
+	 * \param _ui16Level The 0.16 fixed-point multiplier applied to each input before it is stored as a level.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::PhosphorRow_AVX512( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+		uint16_t _ui16Decay, uint16_t _ui16Level ) {
+		const __m512i mDecay = _mm512_set1_epi16( int16_t( _ui16Decay ) );
+		const __m512i mLevel = _mm512_set1_epi16( int16_t( _ui16Level ) );
+		size_t I = 0;
+		for ( ; I + 32 <= _sTotal; I += 32 ) {
+			__m512i mNew = _mm512_slli_epi16( _mm512_cvtepu8_epi16( _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui8Src + I) ) ), 8 );
+			__m512i mOld = _mm512_mulhi_epu16( _mm512_loadu_si512( _pui16Accum + I ), mDecay );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui8Dst + I), _mm512_cvtepi16_epi8( _mm512_srli_epi16( _mm512_max_epu16( mOld, mNew ), 8 ) ) );
+			_mm512_storeu_si512( _pui16Accum + I, _mm512_max_epu16( mOld, _mm512_mulhi_epu16( mNew, mLevel ) ) );
+		}
+		PhosphorRow( _pui8Src + I, _pui16Accum + I, _pui8Dst + I, _sTotal - I, _ui16Decay, _ui16Level );
+	}
+
+	/**
+	 * Averages a row of 8-bit channels with the previous frame's row using AVX-512.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The previous frame's channels in 8.8 fixed point, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 **/
+	LSN_TARGET_AVX512 void CFilterKernels::FrameBlendRow_AVX512( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 32 <= _sTotal; I += 32 ) {
+			__m256i mSrc = _mm256_loadu_si256( reinterpret_cast<const __m256i *>(_pui8Src + I) );
+			__m256i mPrev = _mm512_cvtepi16_epi8( _mm512_srli_epi16( _mm512_loadu_si512( _pui16Accum + I ), 8 ) );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui8Dst + I), _mm256_avg_epu8( mSrc, mPrev ) );
+			_mm512_storeu_si512( _pui16Accum + I, _mm512_slli_epi16( _mm512_cvtepu8_epi16( mSrc ), 8 ) );
+		}
+		FrameBlendRow( _pui8Src + I, _pui16Accum + I, _pui8Dst + I, _sTotal - I );
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
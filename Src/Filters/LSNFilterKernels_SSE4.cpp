@@ -0,0 +1,282 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The SSE 4.1 versions of the CPU video filter kernels.  Built without depending on the project-wide instruction set
+ *	so that CFilterKernels can select them at run-time.
+ */
+
+#include "LSNFilterKernels.h"
+#include "../Utilities/LSNUtilities.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <cstring>
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Horizontally adds all the floats in a given register.
+	 *
+	 * \param _mReg The register containing all of the values to sum.
+	 * \return Returns the sum of all the floats in the given register.
+	 **/
+	static inline LSN_TARGET_SSE4 float						HorizontalSum_SSE4( __m128 _mReg ) {
+		__m128 mShuf = _mm_movehdup_ps( _mReg );
+		__m128 mSums = _mm_add_ps( _mReg, mShuf );
+		mShuf = _mm_movehl_ps( mShuf, mSums );
+		mSums = _mm_add_ss( mSums, mShuf );
+		return _mm_cvtss_f32( mSums );
+	}
+
+	/**
+	 * Convolves a run of signals into one Y, I and Q value using SSE 4.1.
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _pfFilter The chroma filter weights, one per signal.
+	 * \param _pfFilterY The luma filter weights, one per signal.
+	 * \param _pfCos The cosine for each signal.
+	 * \param _pfSin The sine for each signal.
+	 * \param _sTotal The number of signals.
+	 * \param _fY Receives the Y value.
+	 * \param _fI Receives the I value.
+	 * \param _fQ Receives the Q value.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::ConvolveYiq_SSE4( const float * _pfSignals, const float * _pfFilter, const float * _pfFilterY,
+		const float * _pfCos, const float * _pfSin, size_t _sTotal, float &_fY, float &_fI, float &_fQ ) {
+		__m128 mY = _mm_setzero_ps(), mI = _mm_setzero_ps(), mQ = _mm_setzero_ps();
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			__m128 mSignals = _mm_loadu_ps( _pfSignals + I );
+			__m128 mLevels = _mm_mul_ps( mSignals, _mm_loadu_ps( _pfFilter + I ) );
+			mY = _mm_add_ps( mY, _mm_mul_ps( mSignals, _mm_loadu_ps( _pfFilterY + I ) ) );
+			mI = _mm_add_ps( mI, _mm_mul_ps( mLevels, _mm_loadu_ps( _pfCos + I ) ) );
+			mQ = _mm_add_ps( mQ, _mm_mul_ps( mLevels, _mm_loadu_ps( _pfSin + I ) ) );
+		}
+		float fY = HorizontalSum_SSE4( mY ), fI = HorizontalSum_SSE4( mI ), fQ = HorizontalSum_SSE4( mQ );
+		for ( ; I < _sTotal; ++I ) {
+			float fLevel = _pfSignals[I] * _pfFilter[I];
+			fY += _pfSignals[I] * _pfFilterY[I];
+			fI += _pfCos[I] * fLevel;
+			fQ += _pfSin[I] * fLevel;
+		}
+		_fY = fY;
+		_fI = fI;
+		_fQ = fQ;
+	}
+
+	/**
+	 * Adds three source rows to three destination rows using SSE 4.1.
+	 *
+	 * \param _pfDstY The Y row to which to add.
+	 * \param _pfDstI The I row to which to add.
+	 * \param _pfDstQ The Q row to which to add.
+	 * \param _pfSrcY The Y values to add.
+	 * \param _pfSrcI The I values to add.
+	 * \param _pfSrcQ The Q values to add.
+	 * \param _sTotal The number of values in each row.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::AddRows3_SSE4( float * _pfDstY, float * _pfDstI, float * _pfDstQ,
+		const float * _pfSrcY, const float * _pfSrcI, const float * _pfSrcQ, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			_mm_storeu_ps( _pfDstY + I, _mm_add_ps( _mm_loadu_ps( _pfDstY + I ), _mm_loadu_ps( _pfSrcY + I ) ) );
+			_mm_storeu_ps( _pfDstI + I, _mm_add_ps( _mm_loadu_ps( _pfDstI + I ), _mm_loadu_ps( _pfSrcI + I ) ) );
+			_mm_storeu_ps( _pfDstQ + I, _mm_add_ps( _mm_loadu_ps( _pfDstQ + I ), _mm_loadu_ps( _pfSrcQ + I ) ) );
+		}
+		for ( ; I < _sTotal; ++I ) {
+			_pfDstY[I] += _pfSrcY[I];
+			_pfDstI[I] += _pfSrcI[I];
+			_pfDstQ[I] += _pfSrcQ[I];
+		}
+	}
+
+	/**
+	 * Adds a randomly selected noise buffer to each block of 16 signals using SSE 4.1.  The last block is written in full, so the
+	 *	signal buffer must be padded to a multiple of 16.
+	 *
+	 * \param _pfSignals The signals.
+	 * \param _sTotal The number of signals.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::AddNoise_SSE4( float * _pfSignals, size_t _sTotal ) {
+		for ( float * pfEnd = _pfSignals + _sTotal; _pfSignals < pfEnd; _pfSignals += 16 ) {
+			const float * pfNoise = CUtilities::m_fNoiseBuffers[LSN_NOISE_BUFFER(CUtilities::Rand())];
+			for ( size_t I = 0; I < 16; I += 4 ) {
+				_mm_storeu_ps( _pfSignals + I, _mm_add_ps( _mm_loadu_ps( _pfSignals + I ), _mm_loadu_ps( pfNoise + I ) ) );
+			}
+		}
+	}
+
+	/**
+	 * Computes the inclusive prefix sum of the 4 integers in a register.
+	 *
+	 * \param _mVal The values to sum.
+	 * \return Returns the prefix sums.
+	 **/
+	static inline LSN_TARGET_SSE4 __m128i					PrefixSum_SSE4( __m128i _mVal ) {
+		_mVal = _mm_add_epi32( _mVal, _mm_slli_si128( _mVal, 4 ) );
+		return _mm_add_epi32( _mVal, _mm_slli_si128( _mVal, 8 ) );
+	}
+
+	/**
+	 * Loads 4 signed bytes and widens them to 32-bit integers.
+	 *
+	 * \param _pi8Src The bytes to load.
+	 * \return Returns the widened values.
+	 **/
+	static inline LSN_TARGET_SSE4 __m128i					Load4_SSE4( const int8_t * _pi8Src ) {
+		int32_t i32Tmp;
+		std::memcpy( &i32Tmp, _pi8Src, sizeof( i32Tmp ) );
+		return _mm_cvtepi8_epi32( _mm_cvtsi32_si128( i32Tmp ) );
+	}
+
+	/**
+	 * Decodes a Bisqwit NTSC scanline to RGB32 using SSE 4.1.  The sliding-window sums are formed from per-sample differences with
+	 *	an in-register prefix sum, carrying the last lane into the next vector.
+	 *
+	 * \param _blLine The scanline to decode.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::BisqwitDecode_SSE4( const LSN_BISQWIT_LINE &_blLine ) {
+		int32_t i32SumY = _blLine.i32Brightness, i32SumI = 0, i32SumQ = 0;
+		const int32_t i32End = _blLine.i32Width + LSN_BISQWIT_OFFSET;
+		// The first vector would straddle the leading samples that produce no output.
+		int32_t I = std::min<int32_t>( 8, i32End );
+		BisqwitSamples( _blLine, 0, I, i32SumY, i32SumI, i32SumQ );
+
+		const int8_t * pi8Sig = _blLine.pi8Signal;
+		__m128i mSumY = _mm_set1_epi32( i32SumY ), mSumI = _mm_set1_epi32( i32SumI ), mSumQ = _mm_set1_epi32( i32SumQ );
+		const __m128i mY = _mm_set1_epi32( _blLine.i32Y );
+		const __m128i mIr = _mm_set1_epi32( _blLine.i32Ir ), mIg = _mm_set1_epi32( _blLine.i32Ig ), mIb = _mm_set1_epi32( _blLine.i32Ib );
+		const __m128i mQr = _mm_set1_epi32( _blLine.i32Qr ), mQg = _mm_set1_epi32( _blLine.i32Qg ), mQb = _mm_set1_epi32( _blLine.i32Qb );
+		const __m128i mZero = _mm_setzero_si128(), m255 = _mm_set1_epi32( 255 ), mAlpha = _mm_set1_epi32( int32_t( 0xFF000000 ) );
+		for ( ; I + 4 <= i32End; I += 4 ) {
+			int32_t i32I = I - _blLine.i32WidthI, i32Q = I - _blLine.i32WidthQ;
+			__m128i mSig = Load4_SSE4( pi8Sig + I );
+			__m128i mDy = _mm_sub_epi32( mSig, Load4_SSE4( pi8Sig + I - _blLine.i32WidthY ) );
+			__m128i mDi = _mm_sub_epi32( _mm_mullo_epi32( mSig, _mm_loadu_si128( reinterpret_cast<const __m128i *>(_blLine.pi32Cos + (I + 36) % 12) ) ),
+				_mm_mullo_epi32( Load4_SSE4( pi8Sig + i32I ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(_blLine.pi32Cos + (i32I + 36) % 12) ) ) );
+			__m128i mDq = _mm_sub_epi32( _mm_mullo_epi32( mSig, _mm_loadu_si128( reinterpret_cast<const __m128i *>(_blLine.pi32Sin + (I + 36) % 12) ) ),
+				_mm_mullo_epi32( Load4_SSE4( pi8Sig + i32Q ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(_blLine.pi32Sin + (i32Q + 36) % 12) ) ) );
+			mSumY = _mm_add_epi32( PrefixSum_SSE4( mDy ), mSumY );
+			mSumI = _mm_add_epi32( PrefixSum_SSE4( mDi ), mSumI );
+			mSumQ = _mm_add_epi32( PrefixSum_SSE4( mDq ), mSumQ );
+
+			__m128i mYy = _mm_mullo_epi32( mSumY, mY );
+			__m128i mR = _mm_add_epi32( mYy, _mm_add_epi32( _mm_mullo_epi32( mSumI, mIr ), _mm_mullo_epi32( mSumQ, mQr ) ) );
+			__m128i mG = _mm_add_epi32( mYy, _mm_add_epi32( _mm_mullo_epi32( mSumI, mIg ), _mm_mullo_epi32( mSumQ, mQg ) ) );
+			__m128i mB = _mm_add_epi32( mYy, _mm_add_epi32( _mm_mullo_epi32( mSumI, mIb ), _mm_mullo_epi32( mSumQ, mQb ) ) );
+			// Flooring instead of truncating only changes negative values, which clamp to 0 either way.
+			mR = _mm_min_epi32( _mm_max_epi32( _mm_srai_epi32( mR, 16 ), mZero ), m255 );
+			mG = _mm_min_epi32( _mm_max_epi32( _mm_srai_epi32( mG, 16 ), mZero ), m255 );
+			mB = _mm_min_epi32( _mm_max_epi32( _mm_srai_epi32( mB, 16 ), mZero ), m255 );
+			__m128i mRgb = _mm_or_si128( _mm_or_si128( mAlpha, _mm_slli_epi32( mR, 16 ) ), _mm_or_si128( _mm_slli_epi32( mG, 8 ), mB ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_blLine.pui32Output + I - LSN_BISQWIT_OFFSET), mRgb );
+
+			mSumY = _mm_shuffle_epi32( mSumY, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+			mSumI = _mm_shuffle_epi32( mSumI, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+			mSumQ = _mm_shuffle_epi32( mSumQ, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+		}
+		i32SumY = _mm_cvtsi128_si32( mSumY );
+		i32SumI = _mm_cvtsi128_si32( mSumI );
+		i32SumQ = _mm_cvtsi128_si32( mSumQ );
+		BisqwitSamples( _blLine, I, i32End, i32SumY, i32SumI, i32SumQ );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to RGB32 using SSE 4.1.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui32Dst Receives _sTotal RGB32 values.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::PaletteToRgb32_SSE4( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint32_t * _pui32Dst, size_t _sTotal ) {
+		size_t I = 0;
+		for ( ; I + 4 <= _sTotal; I += 4 ) {
+			__m128i mRgb = _mm_setr_epi32( int( _pui32Palette[_pui16Indices[I+0]] ), int( _pui32Palette[_pui16Indices[I+1]] ),
+				int( _pui32Palette[_pui16Indices[I+2]] ), int( _pui32Palette[_pui16Indices[I+3]] ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui32Dst + I), mRgb );
+		}
+		PaletteToRgb32( _pui16Indices + I, _pui32Palette, _pui32Dst + I, _sTotal - I );
+	}
+
+	/**
+	 * Converts 9-bit palette indices to packed 24-bit RGB using SSE 4.1.
+	 *
+	 * \param _pui16Indices The palette indices.  Each must be below 512.
+	 * \param _pui32Palette The 512 RGB32 values.
+	 * \param _pui8Dst Receives _sTotal * 3 bytes.
+	 * \param _sTotal The number of indices to convert.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::PaletteToRgb24_SSE4( const uint16_t * _pui16Indices, const uint32_t * _pui32Palette, uint8_t * _pui8Dst, size_t _sTotal ) {
+		// Drops the 4th byte of each pixel, packing 4 pixels into the low 12 bytes.
+		const __m128i mPack = _mm_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 );
+		size_t I = 0;
+		// Each store writes 16 bytes of which 12 are used, so stop while the next pixels can still overwrite the spare 4.
+		for ( ; I + 6 <= _sTotal; I += 4 ) {
+			__m128i mRgb = _mm_setr_epi32( int( _pui32Palette[_pui16Indices[I+0]] ), int( _pui32Palette[_pui16Indices[I+1]] ),
+				int( _pui32Palette[_pui16Indices[I+2]] ), int( _pui32Palette[_pui16Indices[I+3]] ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui8Dst + I * 3), _mm_shuffle_epi8( mRgb, mPack ) );
+		}
+		PaletteToRgb24( _pui16Indices + I, _pui32Palette, _pui8Dst + I * 3, _sTotal - I );
+	}
+
+	/**
+	 * Decays a row of 8.8 fixed-point phosphor levels and lights them with a row of 8-bit channels using SSE 4.1.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The phosphor levels, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 * \param _ui16Decay The 0.16 fixed-point multiplier applied to each level.
+	 * \param _ui16Level The 0.16 fixed-point multiplier applied to each input before it is stored as a level.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::PhosphorRow_SSE4( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal,
+		uint16_t _ui16Decay, uint16_t _ui16Level ) {
+		const __m128i mDecay = _mm_set1_epi16( int16_t( _ui16Decay ) );
+		const __m128i mLevel = _mm_set1_epi16( int16_t( _ui16Level ) );
+		size_t I = 0;
+		for ( ; I + 16 <= _sTotal; I += 16 ) {
+			__m128i mNew0 = _mm_slli_epi16( _mm_cvtepu8_epi16( _mm_loadl_epi64( reinterpret_cast<const __m128i *>(_pui8Src + I) ) ), 8 );
+			__m128i mNew1 = _mm_slli_epi16( _mm_cvtepu8_epi16( _mm_loadl_epi64( reinterpret_cast<const __m128i *>(_pui8Src + I + 8) ) ), 8 );
+			__m128i mOld0 = _mm_mulhi_epu16( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui16Accum + I) ), mDecay );
+			__m128i mOld1 = _mm_mulhi_epu16( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui16Accum + I + 8) ), mDecay );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui8Dst + I), _mm_packus_epi16(
+				_mm_srli_epi16( _mm_max_epu16( mOld0, mNew0 ), 8 ),
+				_mm_srli_epi16( _mm_max_epu16( mOld1, mNew1 ), 8 ) ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui16Accum + I), _mm_max_epu16( mOld0, _mm_mulhi_epu16( mNew0, mLevel ) ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui16Accum + I + 8), _mm_max_epu16( mOld1, _mm_mulhi_epu16( mNew1, mLevel ) ) );
+		}
+		PhosphorRow( _pui8Src + I, _pui16Accum + I, _pui8Dst + I, _sTotal - I, _ui16Decay, _ui16Level );
+	}
+
+	/**
+	 * Averages a row of 8-bit channels with the previous frame's row using SSE 4.1.
+	 *
+	 * \param _pui8Src The input channels.
+	 * \param _pui16Accum The previous frame's channels in 8.8 fixed point, updated on return.
+	 * \param _pui8Dst Receives _sTotal output channels.
+	 * \param _sTotal The number of channels.
+	 **/
+	LSN_TARGET_SSE4 void CFilterKernels::FrameBlendRow_SSE4( const uint8_t * _pui8Src, uint16_t * _pui16Accum, uint8_t * _pui8Dst, size_t _sTotal ) {
+		const __m128i mZero = _mm_setzero_si128();
+		size_t I = 0;
+		for ( ; I + 16 <= _sTotal; I += 16 ) {
+			__m128i mSrc = _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui8Src + I) );
+			__m128i mPrev = _mm_packus_epi16(
+				_mm_srli_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui16Accum + I) ), 8 ),
+				_mm_srli_epi16( _mm_loadu_si128( reinterpret_cast<const __m128i *>(_pui16Accum + I + 8) ), 8 ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui8Dst + I), _mm_avg_epu8( mSrc, mPrev ) );
+			// Interleaving with 0 as the low byte is the same as widening and shifting left by 8.
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui16Accum + I), _mm_unpacklo_epi8( mZero, mSrc ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui16Accum + I + 8), _mm_unpackhi_epi8( mZero, mSrc ) );
+		}
+		FrameBlendRow( _pui8Src + I, _pui16Accum + I, _pui8Dst + I, _sTotal - I );
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
@@ -11,6 +11,7 @@
 #include "../Utilities/LSNScopedNoSubnormals.h"
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <memory>
 #include <numbers>
@@ -84,6 +85,7 @@ namespace lsn {
 			if ( !AllocYiqBuffers( m_ui16Width, m_ui16Height, _ui16WidthScale ) ) { return false; }
 			m_ui16WidthScale = _ui16WidthScale;
 			m_ui16ScaledWidth = m_ui16Width * m_ui16WidthScale;
+			++m_ui32LutVersion;
 		}
 		return true;
 	}
@@ -213,8 +215,15 @@ namespace lsn {
 	 * \param _pui16Pixels The start of the 9-bit PPU output for this scanline.
 	 * \param _ui16Cycle The cycle count at the start of the scanline.
 	 * \param _sRowIdx The scanline index.
+	 * \param _plLut The look-up tables from PrepareLut(), or nullptr to convolve the signals directly.
 	 **/
-	void CLSpiroNtscFilterBase::ScanlineToYiq( float * _pfDstY, float * _pfDstI, float * _pfDstQ, const uint16_t * _pui16Pixels, uint16_t _ui16Cycle, size_t _sRowIdx ) {
+	void CLSpiroNtscFilterBase::ScanlineToYiq( float * _pfDstY, float * _pfDstI, float * _pfDstQ, const uint16_t * _pui16Pixels, uint16_t _ui16Cycle, size_t _sRowIdx,
+		const LSN_LUT * _plLut ) {
+		// The tables hold phases in steps of 4, which is all the PPU produces.
+		if LSN_LIKELY( _plLut && (_ui16Cycle & 3) == 0 ) {
+			ScanlineToYiqLut( _pfDstY, _pfDstI, _pfDstQ, _pui16Pixels, _ui16Cycle, (*_plLut) );
+			return;
+		}
 		float * pfSignalStart = m_vSignalStart[_sRowIdx];
 		float * pfSignals = pfSignalStart;
 		for ( uint16_t I = 0; I < m_ui16Width; ++I ) {
@@ -222,40 +231,11 @@ namespace lsn {
 			pfSignals += 8;
 		}
 
+		const CFilterKernels::LSN_KERNELS & kKernels = CFilterKernels::Kernels();
 		// Add noise.
-		pfSignals = pfSignalStart;
-		float * pfSignalEnd = pfSignals + m_ui16Width * 8;
-		// Prefetch the middle of the buffer.
-		LSN_PREFETCH_LINE( pfSignals + m_ui16Width * 4 );
-#ifdef __AVX512F__
-		if ( CUtilities::IsAvx512FSupported() ) {
-			while ( pfSignals < pfSignalEnd ) {
-				__m512 vNoise = _mm512_load_ps( CUtilities::m_fNoiseBuffers[LSN_NOISE_BUFFER(CUtilities::Rand())] );
-				__m512 vSig = _mm512_loadu_ps( pfSignals );
-				vSig = _mm512_add_ps( vSig, vNoise );
-				_mm512_storeu_ps( pfSignals, vSig );
-				pfSignals += 16;
-			}
-		}
-#endif	// #ifdef __AVX512F__
-#ifdef __AVX__
-		if LSN_LIKELY( CUtilities::IsAvxSupported() ) {
-			while ( pfSignals < pfSignalEnd ) {
-				size_t sIdx = LSN_NOISE_BUFFER( CUtilities::Rand() );
-				__m256 vNoise = _mm256_load_ps( CUtilities::m_fNoiseBuffers[sIdx] );
-				__m256 vSig = _mm256_loadu_ps( pfSignals );
-				vSig = _mm256_add_ps( vSig, vNoise );
-				_mm256_storeu_ps( pfSignals, vSig );
-				pfSignals += 8;
-
-				vNoise = _mm256_load_ps( CUtilities::m_fNoiseBuffers[sIdx] + 8 );
-				vSig = _mm256_loadu_ps( pfSignals );
-				vSig = _mm256_add_ps( vSig, vNoise );
-				_mm256_storeu_ps( pfSignals, vSig );
-				pfSignals += 8;
-			}
+		if LSN_LIKELY( kKernels.pfAddNoise ) {
+			kKernels.pfAddNoise( pfSignalStart, m_ui16Width * 8 );
 		}
-#endif	// #ifdef __AVX__
 
 		float fBrightness = LSN_FINAL_BRIGHT;
 		for ( uint16_t I = 0; I < m_ui16ScaledWidth; ++I ) {
@@ -265,60 +245,189 @@ namespace lsn {
 			int16_t i16Start = i16Center - int16_t( std::floorf( m_ui32FilterKernelSize / 2.0f ) );
 			int16_t i16End = i16Center + int16_t( std::ceilf( m_ui32FilterKernelSize / 2.0f ) );
 
-			(*_pfDstY) = (*_pfDstI) = (*_pfDstQ) = 0.0f;
-			int16_t J = i16Start;
-#ifdef __AVX512F__
-			if ( CUtilities::IsAvx512FSupported() ) {
-				__m512 mSin = _mm512_set1_ps( 0.0f ), mCos = _mm512_set1_ps( 0.0f ), mSig = _mm512_set1_ps( 0.0f );
-				while ( i16End - J >= 16 ) {
-					// Can do 16 at a time.
-					Convolution16( &pfSignalStart[J], J - i16Start, (_ui16Cycle + (12 * 4) + J) % 12, mCos, mSin, mSig );
-					J += 16;
-				}
-				(*_pfDstI) += CUtilities::HorizontalSum( mCos );
-				(*_pfDstQ) += CUtilities::HorizontalSum( mSin );
-				(*_pfDstY) += CUtilities::HorizontalSum( mSig );
+			size_t sCosSinIdx = size_t( (int32_t( _ui16Cycle ) + (12 * 4) + i16Start) % 12 + 12 ) % 12;
+			kKernels.pfConvolveYiq( &pfSignalStart[i16Start], m_fFilter, m_fFilterY, &m_fPhaseCosRow[sCosSinIdx], &m_fPhaseSinRow[sCosSinIdx],
+				size_t( i16End - i16Start ), (*_pfDstY), (*_pfDstI), (*_pfDstQ) );
+			(*_pfDstY++) *= fBrightness;
+			++_pfDstI;
+			++_pfDstQ;
+		}
+	}
+
+	/**
+	 * Creates a single scanline from 9-bit PPU output to a float buffer of YIQ values by summing the precomputed footprints of
+	 *	each pixel (and noise block).
+	 * 
+	 * \param _pfDstY The destination for where to begin storing the YIQ Y values.
+	 * \param _pfDstI The destination for where to begin storing the YIQ I values.
+	 * \param _pfDstQ The destination for where to begin storing the YIQ Q values.
+	 * \param _pui16Pixels The start of the 9-bit PPU output for this scanline.
+	 * \param _ui16Cycle The cycle count at the start of the scanline.  Must be a multiple of 4.
+	 * \param _lLut The look-up tables.
+	 **/
+	void CLSpiroNtscFilterBase::ScanlineToYiqLut( float * _pfDstY, float * _pfDstI, float * _pfDstQ, const uint16_t * _pui16Pixels, uint16_t _ui16Cycle,
+		const LSN_LUT &_lLut ) {
+		size_t sTotal = m_ui16ScaledWidth;
+		std::fill( _pfDstY, _pfDstY + sTotal, 0.0f );
+		std::fill( _pfDstI, _pfDstI + sTotal, 0.0f );
+		std::fill( _pfDstQ, _pfDstQ + sTotal, 0.0f );
+
+		int32_t i32Scale = m_ui16WidthScale;
+		for ( uint16_t I = 0; I < m_ui16Width; ++I ) {
+			size_t sPhase = ((_ui16Cycle + I * 8) % 12) >> 2;
+			const float * pfFootprint = _lLut.vLut.data() + ((_pui16Pixels[I] & 0x1FF) * 3 + sPhase) * 3 * _lLut.sLutLen;
+			AddFootprint( _pfDstY, _pfDstI, _pfDstQ, sTotal, (int32_t( I ) - _lLut.i32LutOffset) * i32Scale, pfFootprint, _lLut.sLutLen );
+		}
+
+		// Noise is added in blocks of 16 samples (2 pixels), consuming random numbers exactly as the convolution path does.
+		if LSN_LIKELY( CFilterKernels::Kernels().pfAddNoise ) {
+			size_t sBlocks = (size_t( m_ui16Width ) * 8 + 15) / 16;
+			for ( size_t I = 0; I < sBlocks; ++I ) {
+				size_t sIdx = LSN_NOISE_BUFFER( CUtilities::Rand() );
+				size_t sPhase = ((_ui16Cycle + I * 16) % 12) >> 2;
+				const float * pfFootprint = _lLut.vNoiseLut.data() + (sIdx * 3 + sPhase) * 3 * _lLut.sNoiseLutLen;
+				AddFootprint( _pfDstY, _pfDstI, _pfDstQ, sTotal, (int32_t( I * 2 ) - _lLut.i32NoiseLutOffset) * i32Scale, pfFootprint, _lLut.sNoiseLutLen );
 			}
-#endif	// #ifdef __AVX512F__
-#ifdef __AVX__
-			if LSN_LIKELY( CUtilities::IsAvxSupported() ) {
-				__m256 mSin = _mm256_set1_ps( 0.0f ), mCos = _mm256_set1_ps( 0.0f ), mSig = _mm256_set1_ps( 0.0f );
-				while ( i16End - J >= 8 ) {
-					// Can do 8 at a time.
-					Convolution8( &pfSignalStart[J], J - i16Start, (_ui16Cycle + (12 * 4) + J) % 12, mCos, mSin, mSig );
-					J += 8;
-				}
-				(*_pfDstI) += CUtilities::HorizontalSum( mCos );
-				(*_pfDstQ) += CUtilities::HorizontalSum( mSin );
-				(*_pfDstY) += CUtilities::HorizontalSum( mSig );
+		}
+	}
+
+	/**
+	 * Rebuilds the look-up tables if any setting they depend on has changed.  Called once per scanline range.
+	 * 
+	 * \return Returns the look-up tables for the current settings, or nullptr if table-driven decoding is off or the tables could
+	 *	not be built.  The caller keeps them alive for the rest of its scanline range.
+	 **/
+	std::shared_ptr<const CLSpiroNtscFilterBase::LSN_LUT> CLSpiroNtscFilterBase::PrepareLut() {
+		if ( !m_bLutDecode ) { return nullptr; }
+		std::shared_ptr<const LSN_LUT> plLut;
+		{
+			std::lock_guard<std::mutex> lgLock( m_mLutPublishMutex );
+			plLut = m_plLut;
+		}
+		if LSN_LIKELY( plLut && plLut->ui32Version == m_ui32LutVersion &&
+			plLut->fNoiseParm == CUtilities::m_fLastNoiseParm && plLut->bNoiseIsGaussian == CUtilities::m_bNoiseIsGaussian ) { return plLut; }
+
+		// Threads rendering other ranges of the same frame wait here until the tables are complete.
+		std::lock_guard<std::mutex> lgLock( m_mLutMutex );
+		{
+			std::lock_guard<std::mutex> lgPublishLock( m_mLutPublishMutex );
+			plLut = m_plLut;
+		}
+		if ( plLut && plLut->ui32Version == m_ui32LutVersion &&
+			plLut->fNoiseParm == CUtilities::m_fLastNoiseParm && plLut->bNoiseIsGaussian == CUtilities::m_bNoiseIsGaussian ) { return plLut; }
+
+		// Built into new tables so that threads still using the old ones are not disturbed.
+		std::shared_ptr<LSN_LUT> plNew;
+		try {
+			plNew = std::make_shared<LSN_LUT>();
+		}
+		catch ( ... ) { return nullptr; }
+		plNew->ui32Version = m_ui32LutVersion;
+		plNew->fNoiseParm = CUtilities::m_fLastNoiseParm;
+		plNew->bNoiseIsGaussian = CUtilities::m_bNoiseIsGaussian;
+		if ( !GenLut( (*plNew) ) ) { return nullptr; }
+
+		std::lock_guard<std::mutex> lgPublishLock( m_mLutPublishMutex );
+		m_plLut = plNew;
+		return plNew;
+	}
+
+	/**
+	 * Builds the look-up tables from the current phase tables, levels, filter kernels, and width scale.
+	 * 
+	 * \param _lLut The tables to fill.
+	 * \return Returns true if the tables were allocated.
+	 **/
+	bool CLSpiroNtscFilterBase::GenLut( LSN_LUT &_lLut ) {
+		if ( !m_ui16WidthScale || !m_ui32FilterKernelSize ) { return false; }
+		LutRange( 8, _lLut.i32LutOffset, _lLut.sLutLen );
+		LutRange( 16, _lLut.i32NoiseLutOffset, _lLut.sNoiseLutLen );
+		try {
+			_lLut.vLut.resize( 512 * 3 * 3 * _lLut.sLutLen );
+			_lLut.vNoiseLut.resize( LSN_NOISE_BUFFERS * 3 * 3 * _lLut.sNoiseLutLen );
+		}
+		catch ( ... ) { return false; }
+
+		// Every 9-bit pixel at each of the 3 phases at which a pixel can start.
+		float fSignals[8];
+		for ( uint16_t P = 0; P < 512; ++P ) {
+			for ( uint16_t H = 0; H < 3; ++H ) {
+				PixelToNtscSignals( fSignals, P, uint16_t( H * 4 ) );
+				GenLutFootprint( fSignals, 8, uint16_t( H * 4 ), _lLut.i32LutOffset, _lLut.sLutLen, _lLut.vLut.data() + (P * 3 + H) * 3 * _lLut.sLutLen );
 			}
-#endif	// #ifdef __AVX__
-#ifdef __SSE4_1__
-			if ( CUtilities::IsSse4Supported() ) {
-				__m128 mSin = _mm_set1_ps( 0.0f ), mCos = _mm_set1_ps( 0.0f ), mSig = _mm_set1_ps( 0.0f );
-				while ( i16End - J >= 4 ) {
-					// Can do 4 at a time.
-					Convolution4( &pfSignalStart[J], J - i16Start, (_ui16Cycle + (12 * 4) + J) % 12, mCos, mSin, mSig );
-					J += 4;
-				}
-				(*_pfDstI) += CUtilities::HorizontalSum( mCos );
-				(*_pfDstQ) += CUtilities::HorizontalSum( mSin );
-				(*_pfDstY) += CUtilities::HorizontalSum( mSig );
+		}
+		// Every noise buffer at each of the 3 phases at which a noise block can start.
+		for ( size_t N = 0; N < LSN_NOISE_BUFFERS; ++N ) {
+			for ( uint16_t H = 0; H < 3; ++H ) {
+				GenLutFootprint( CUtilities::m_fNoiseBuffers[N], 16, uint16_t( H * 4 ), _lLut.i32NoiseLutOffset, _lLut.sNoiseLutLen, _lLut.vNoiseLut.data() + (N * 3 + H) * 3 * _lLut.sNoiseLutLen );
 			}
-#endif	// #ifdef __SSE4_1__
-			{
-				while ( i16End - J >= 1 ) {
-					size_t sIdx = (_ui16Cycle + (12 * 4) + J) % 12;
-					float fLevel = pfSignalStart[J] * m_fFilter[J-i16Start];
-					(*_pfDstY) += pfSignalStart[J] * m_fFilterY[J-i16Start];
-					(*_pfDstI) += m_fPhaseCosTable[sIdx] * fLevel;
-					(*_pfDstQ) += m_fPhaseSinTable[sIdx] * fLevel;
-					++J;
-				}
+		}
+		return true;
+	}
+
+	/**
+	 * Gets the range of input pixels (relative to the first pixel of a block of samples) whose outputs are touched by the block.
+	 * 
+	 * \param _ui16Total The number of samples in the block.
+	 * \param _i32Offset Receives the number of input pixels by which the footprint starts before the block.
+	 * \param _sLen Receives the number of output pixels in the footprint.
+	 **/
+	void CLSpiroNtscFilterBase::LutRange( uint16_t _ui16Total, int32_t &_i32Offset, size_t &_sLen ) const {
+		int32_t i32Scale = m_ui16WidthScale;
+		int32_t i32Kernel = int32_t( m_ui32FilterKernelSize );
+		int32_t i32Half = i32Kernel >> 1;
+		int32_t i32MaxFrac = (i32Scale - 1) * 8 / i32Scale;
+		int32_t i32Bound = (i32Kernel + _ui16Total) / 8 + 3;
+		int32_t i32Min = INT32_MAX, i32Max = INT32_MIN;
+		// Sample K of the block is tap (8 * D + K - Frac - 4 + Half) of the kernel of an output pixel D input pixels before the block.
+		for ( int32_t D = -i32Bound; D <= i32Bound; ++D ) {
+			int32_t i32TMin = D * 8 - i32MaxFrac - 4 + i32Half;
+			int32_t i32TMax = D * 8 + (_ui16Total - 1) - 4 + i32Half;
+			if ( i32TMax >= 0 && i32TMin < i32Kernel ) {
+				i32Min = std::min( i32Min, D );
+				i32Max = std::max( i32Max, D );
 			}
-			(*_pfDstY++) *= fBrightness;
-			++_pfDstI;
-			++_pfDstQ;
+		}
+		_i32Offset = i32Max;
+		_sLen = size_t( i32Max - i32Min + 1 ) * i32Scale;
+	}
+
+	/**
+	 * Decodes a block of samples into its Y/I/Q footprint.
+	 * 
+	 * \param _pfSamples The samples, starting on an input-pixel boundary.
+	 * \param _ui16Total The number of samples.
+	 * \param _ui16Phase The phase of the first sample.
+	 * \param _i32Offset The number of input pixels by which the footprint starts before the block.
+	 * \param _sLen The number of output pixels in the footprint.
+	 * \param _pfDst The destination for _sLen Y values followed by _sLen I values and _sLen Q values.
+	 **/
+	void CLSpiroNtscFilterBase::GenLutFootprint( const float * _pfSamples, uint16_t _ui16Total, uint16_t _ui16Phase, int32_t _i32Offset, size_t _sLen, float * _pfDst ) {
+		float * pfY = _pfDst;
+		float * pfI = pfY + _sLen;
+		float * pfQ = pfI + _sLen;
+		int32_t i32Scale = m_ui16WidthScale;
+		int32_t i32Kernel = int32_t( m_ui32FilterKernelSize );
+		int32_t i32Half = i32Kernel >> 1;
+		float fBrightness = LSN_FINAL_BRIGHT;
+		for ( size_t F = 0; F < _sLen; ++F ) {
+			// The output pixel is D input pixels before the block and R output pixels into that input pixel.
+			int32_t i32D = _i32Offset - int32_t( F / i32Scale );
+			int32_t i32R = int32_t( F % i32Scale );
+			int32_t i32T0 = i32D * 8 - (i32R * 8 / i32Scale) - 4 + i32Half;
+			float fY = 0.0f, fI = 0.0f, fQ = 0.0f;
+			for ( uint16_t K = 0; K < _ui16Total; ++K ) {
+				int32_t i32T = i32T0 + K;
+				if ( i32T < 0 || i32T >= i32Kernel ) { continue; }
+				size_t sIdx = (_ui16Phase + K) % 12;
+				float fLevel = _pfSamples[K] * m_fFilter[i32T];
+				fY += _pfSamples[K] * m_fFilterY[i32T];
+				fI += m_fPhaseCosTable[sIdx] * fLevel;
+				fQ += m_fPhaseSinTable[sIdx] * fLevel;
+			}
+			pfY[F] = fY * fBrightness;
+			pfI[F] = fI;
+			pfQ[F] = fQ;
 		}
 	}
 
@@ -339,28 +448,11 @@ namespace lsn {
 			m_fPhaseCosTable[I] = float( dCos );
 			m_fPhaseSinTable[I] = float( dSin );
 		}
-#ifdef __AVX__
-		for ( size_t J = 0; J < sizeof( __m256 ) / sizeof( float ); ++J ) {
-			for ( size_t I = 0; I < 12; ++I ) {
-				float * pfThis = reinterpret_cast<float *>(&m_mStackedCosTable[I]);
-				pfThis[J] = m_fPhaseCosTable[(J+I)%12];
-
-				pfThis = reinterpret_cast<float *>(&m_mStackedSinTable[I]);
-				pfThis[J] = m_fPhaseSinTable[(J+I)%12];
-			}
-		}
-#endif	// #ifdef __AVX__
-#ifdef __AVX512F__
-		for ( size_t J = 0; J < sizeof( __m512 ) / sizeof( float ); ++J ) {
-			for ( size_t I = 0; I < 12; ++I ) {
-				float * pfThis = reinterpret_cast<float *>(&m_mStackedCosTable512[I]);
-				pfThis[J] = m_fPhaseCosTable[(J+I)%12];
-
-				pfThis = reinterpret_cast<float *>(&m_mStackedSinTable512[I]);
-				pfThis[J] = m_fPhaseSinTable[(J+I)%12];
-			}
+		for ( size_t I = 0; I < std::size( m_fPhaseCosRow ); ++I ) {
+			m_fPhaseCosRow[I] = m_fPhaseCosTable[I%12];
+			m_fPhaseSinRow[I] = m_fPhaseSinTable[I%12];
 		}
-#endif	// #ifdef __AVX512F__
+		++m_ui32LutVersion;
 	}
 
 	/**
@@ -370,6 +462,7 @@ namespace lsn {
 		for ( size_t I = 0; I < 16; ++I ) {
 			m_NormalizedLevels[I] = (CUtilities::m_fNtscLevels[I] - m_fBlackSetting) / (m_fWhiteSetting - m_fBlackSetting);
 		}
+		++m_ui32LutVersion;
 	}
 
 	/**
@@ -387,22 +480,6 @@ namespace lsn {
 		for ( size_t I = 0; I < _ui32Width; ++I ) {
 			m_fFilter[I] = float( m_fFilter[I] * dNorm );
 		}
-#ifdef __AVX__
-		for ( size_t J = 0; J < sizeof( __m256 ) / sizeof( float ); ++J ) {
-			for ( size_t I = 0; I < LSN_MAX_FILTER_SIZE; ++I ) {
-				float * pfDst = reinterpret_cast<float *>(&m_mStackedFilterTable[I]);
-				pfDst[J] = m_fFilter[(J+I)%_ui32Width];
-			}
-		}
-#endif	// #ifdef __AVX__
-#ifdef __AVX512F__
-		for ( size_t J = 0; J < sizeof( __m512 ) / sizeof( float ); ++J ) {
-			for ( size_t I = 0; I < LSN_MAX_FILTER_SIZE; ++I ) {
-				float * pfDst = reinterpret_cast<float *>(&m_mStackedFilterTable512[I]);
-				pfDst[J] = m_fFilter[(J+I)%_ui32Width];
-			}
-		}
-#endif	// #ifdef __AVX512F__
 
 
 		dSum = 0.0;
@@ -415,22 +492,7 @@ namespace lsn {
 			m_fFilterY[I] = float( m_fFilterY[I] * dNorm );
 		}
 
-#ifdef __AVX__
-		for ( size_t J = 0; J < sizeof( __m256 ) / sizeof( float ); ++J ) {
-			for ( size_t I = 0; I < LSN_MAX_FILTER_SIZE; ++I ) {
-				float * pfDst = reinterpret_cast<float *>(&m_mStackedFilterTableY[I]);
-				pfDst[J] = m_fFilterY[(J+I)%_ui32Width];
-			}
-		}
-#endif	// #ifdef __AVX__
-#ifdef __AVX512F__
-		for ( size_t J = 0; J < sizeof( __m512 ) / sizeof( float ); ++J ) {
-			for ( size_t I = 0; I < LSN_MAX_FILTER_SIZE; ++I ) {
-				float * pfDst = reinterpret_cast<float *>(&m_mStackedFilterTable512Y[I]);
-				pfDst[J] = m_fFilterY[(J+I)%_ui32Width];
-			}
-		}
-#endif	// #ifdef __AVX512F__
+		++m_ui32LutVersion;
 	}
 
 	/**
@@ -13,11 +13,15 @@
 #include "../Utilities/LSNAlignmentAllocator.h"
 #include "../Utilities/LSNUtilities.h"
 #include "LSNFilterBase.h"
+#include "LSNFilterKernels.h"
 
 #if defined( __arm__ ) || defined( __aarch64__ )
 #include <arm_neon.h>
 #endif
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <thread>
 
 #pragma warning( push )
@@ -137,6 +141,25 @@ namespace lsn {
 		 **/
 		void												SetWhiteLevel( float _fWhite );
 
+		/**
+		 * Enables or disables table-driven decoding.  When enabled, the Y/I/Q footprint of every (9-bit pixel, phase, line parity)
+		 *	combination is precomputed whenever the settings change, and each scanline is decoded as a sum of those footprints
+		 *	instead of being regenerated and convolved sample-by-sample.
+		 * 
+		 * \param _bEnable If true, table-driven decoding is used.
+		 **/
+		void												SetLutDecode( bool _bEnable ) {
+			m_bLutDecode = _bEnable;
+			++m_ui32LutVersion;
+		}
+
+		/**
+		 * Determines whether table-driven decoding is enabled.
+		 * 
+		 * \return Returns true if table-driven decoding is enabled.
+		 **/
+		inline bool											LutDecode() const { return m_bLutDecode; }
+
 		/**
 		 * Sets the number of signals per pixel.  10 for PAL, 8 for Dendy.
 		 * 
@@ -218,6 +241,21 @@ namespace lsn {
 		typedef float32x4_t									simd_4;
 #endif	// #ifdef __SSE4_1__
 
+		/** The look-up tables for one set of settings.  Built off to the side and published whole, so rendering threads never read tables that are being rebuilt. */
+		struct LSN_LUT {
+			std::vector<float>								vLut;												/**< The Y/I/Q footprint of each (pixel, phase, parity), sLutLen floats per channel. */
+			std::vector<float>								vNoiseLut;											/**< The Y/I/Q footprint of each (noise buffer, pixel offset, phase, parity), sNoiseLutLen floats per channel. */
+			size_t											sLutLen = 0;										/**< The number of output pixels covered by a pixel footprint. */
+			size_t											sNoiseLutLen = 0;									/**< The number of output pixels covered by a noise footprint. */
+			int32_t											i32LutOffset = 0;									/**< The number of input pixels by which a pixel footprint starts before its pixel. */
+			int32_t											i32NoiseLutOffset = 0;								/**< The number of input pixels by which a noise footprint starts before its first pixel. */
+			uint16_t										ui16LutPhaseStep = 4;								/**< The step between the phases at which a pixel can start. */
+			uint16_t										ui16NoiseLutOffsetStep = 8;							/**< The step between the offsets (within a pixel) at which a noise block can start. */
+			uint32_t										ui32Version = 0;									/**< The value of m_ui32LutVersion when the tables were built. */
+			float											fNoiseParm = -1.0f;									/**< The noise parameter at the time the noise footprints were made. */
+			bool											bNoiseIsGaussian = false;							/**< The noise type at the time the noise footprints were made. */
+		};
+
 
 		// == Members.
 		float												m_fFps = 50.006977081298828125f;					/**< The FPS. */
@@ -225,19 +263,6 @@ namespace lsn {
 		uint16_t											m_ui16Height = 0;									/**< The last input height. */
 		uint32_t											m_ui32FinalStride = 0;								/**< The final stride. */
 
-#ifdef __AVX__
-		__m256												m_mStackedFilterTable[LSN_MAX_FILTER_SIZE];			/**< A stack of filter kernels such that each filter index aligns to 32 bytes. */
-		__m256												m_mStackedFilterTableY[LSN_MAX_FILTER_SIZE];		/**< A stack of filter kernels such that each filter index aligns to 32 bytes. */
-		__m256												m_mStackedCosTable[12];								/**< 8 elements of the cosine table stacked. */
-		__m256												m_mStackedSinTable[12];								/**< 8 elements of the sine table stacked. */
-#endif	// #ifdef __AVX__
-#ifdef __AVX512F__
-		__m512												m_mStackedFilterTable512[LSN_MAX_FILTER_SIZE];		/**< A stack of filter kernels such that each filter index aligns to 64 bytes. */
-		__m512												m_mStackedFilterTable512Y[LSN_MAX_FILTER_SIZE];		/**< A stack of filter kernels such that each filter index aligns to 64 bytes. */
-		__m512												m_mStackedCosTable512[12];							/**< 16 elements of the cosine table stacked. */
-		__m512												m_mStackedSinTable512[12];							/**< 16 elements of the sine table stacked. */
-#endif	// #ifdef __AVX__
-		
 		LSN_ALIGN( 32 )
 		float												m_fFilter[LSN_MAX_FILTER_SIZE];						/**< The filter kernel. */
 		float												m_fFilterY[LSN_MAX_FILTER_SIZE];					/**< The filter kernel. */
@@ -258,6 +283,8 @@ namespace lsn {
 
 		float												m_fPhaseCosTable[12];								/**< The cosine phase table. */
 		float												m_fPhaseSinTable[12];								/**< The sine phase table. */
+		float												m_fPhaseCosRow[12+LSN_MAX_FILTER_SIZE];			/**< The cosine phase table repeated, so any phase can start a contiguous run of LSN_MAX_FILTER_SIZE. */
+		float												m_fPhaseSinRow[12+LSN_MAX_FILTER_SIZE];			/**< The sine phase table repeated, so any phase can start a contiguous run of LSN_MAX_FILTER_SIZE. */
 
 		uint32_t											m_ui32Gamma[LSN_SRGB_RES];							/**< The gamma curve. */
 		uint32_t											m_ui32GammaG[LSN_SRGB_RES];							/**< The gamma curve for green. */
@@ -280,6 +307,13 @@ namespace lsn {
 		float												m_fInitPhosphorDecay = 0.25f;						/**< Initial phosphor decay. */
 		float												m_fPhosphorDecayTime = 1.79113161563873291015625f;	/**< The time it takes for the phosphors to decay to 0.001. */
 
+		// ** LOOK-UP TABLE ** //
+		std::shared_ptr<const LSN_LUT>						m_plLut;											/**< The published look-up tables, or nullptr.  Guarded by m_mLutPublishMutex. */
+		bool												m_bLutDecode = true;								/**< If true, scanlines are decoded via the look-up tables. */
+		std::atomic<uint32_t>								m_ui32LutVersion = 1;								/**< Incremented when a setting used by the look-up tables changes. */
+		std::mutex											m_mLutMutex;										/**< Serializes rebuilding of the look-up tables. */
+		std::mutex											m_mLutPublishMutex;									/**< Guards m_plLut. */
+
 
 		// == Functions.
 		/**
@@ -311,8 +345,79 @@ namespace lsn {
 		 * \param _pui16Pixels The start of the 9-bit PPU output for this scanline.
 		 * \param _ui16Cycle The cycle count at the start of the scanline.
 		 * \param _sRowIdx The scanline index.
+		 * \param _plLut The look-up tables from PrepareLut(), or nullptr to convolve the signals directly.
+		 **/
+		void												ScanlineToYiq( float * _pfDstY, float * _pfDstI, float * _pfDstQ, const uint16_t * _pui16Pixels, uint16_t _ui16Cycle, size_t _sRowIdx,
+			const LSN_LUT * _plLut );
+
+		/**
+		 * Creates a single scanline from 9-bit PPU output to a float buffer of YIQ values by summing the precomputed footprints of
+		 *	each pixel (and noise block).
+		 * 
+		 * \param _pfDstY The destination for where to begin storing the YIQ Y values.
+		 * \param _pfDstI The destination for where to begin storing the YIQ I values.
+		 * \param _pfDstQ The destination for where to begin storing the YIQ Q values.
+		 * \param _pui16Pixels The start of the 9-bit PPU output for this scanline.
+		 * \param _ui16Cycle The cycle count at the start of the scanline.  Must be a multiple of 4.
+		 * \param _sRowIdx The scanline index.
+		 * \param _lLut The look-up tables.
 		 **/
-		void												ScanlineToYiq( float * _pfDstY, float * _pfDstI, float * _pfDstQ, const uint16_t * _pui16Pixels, uint16_t _ui16Cycle, size_t _sRowIdx );
+		void												ScanlineToYiqLut( float * _pfDstY, float * _pfDstI, float * _pfDstQ, const uint16_t * _pui16Pixels, uint16_t _ui16Cycle, size_t _sRowIdx,
+			const LSN_LUT &_lLut );
+
+		/**
+		 * Rebuilds the look-up tables if any setting they depend on has changed.  Called once per scanline range.
+		 * 
+		 * \return Returns the look-up tables for the current settings, or nullptr if table-driven decoding is off or the tables could
+		 *	not be built.  The caller keeps them alive for the rest of its scanline range.
+		 **/
+		std::shared_ptr<const LSN_LUT>						PrepareLut();
+
+		/**
+		 * Builds the look-up tables from the current phase tables, levels, filter kernels, signals-per-pixel, and width scale.
+		 * 
+		 * \param _lLut The tables to fill.
+		 * \return Returns true if the tables were allocated.
+		 **/
+		bool												GenLut( LSN_LUT &_lLut );
+
+		/**
+		 * Gets the range of input pixels (relative to the pixel containing the start of a block of samples) whose outputs are
+		 *	touched by the block.
+		 * 
+		 * \param _ui16Total The number of samples in the block.
+		 * \param _ui16MaxOffset The largest offset (in samples) of the start of the block within its pixel.
+		 * \param _i32Offset Receives the number of input pixels by which the footprint starts before the block.
+		 * \param _sLen Receives the number of output pixels in the footprint.
+		 **/
+		void												LutRange( uint16_t _ui16Total, uint16_t _ui16MaxOffset, int32_t &_i32Offset, size_t &_sLen ) const;
+
+		/**
+		 * Decodes a block of samples into its Y/I/Q footprint.
+		 * 
+		 * \param _pfSamples The samples.
+		 * \param _ui16Total The number of samples.
+		 * \param _ui16Offset The offset (in samples) of the first sample within its pixel.
+		 * \param _ui16Phase The phase of the first sample.
+		 * \param _sRowIdx The scanline index (only its parity is used).
+		 * \param _i32Offset The number of input pixels by which the footprint starts before the block.
+		 * \param _sLen The number of output pixels in the footprint.
+		 * \param _pfDst The destination for _sLen Y values followed by _sLen I values and _sLen Q values.
+		 **/
+		void												GenLutFootprint( const float * _pfSamples, uint16_t _ui16Total, uint16_t _ui16Offset, uint16_t _ui16Phase, size_t _sRowIdx, int32_t _i32Offset, size_t _sLen, float * _pfDst );
+
+		/**
+		 * Adds a Y/I/Q footprint to a scanline, clipping it to the scanline.
+		 * 
+		 * \param _pfDstY The scanline Y values.
+		 * \param _pfDstI The scanline I values.
+		 * \param _pfDstQ The scanline Q values.
+		 * \param _sTotal The number of output pixels in the scanline.
+		 * \param _i32Start The output pixel at which the footprint begins.  Can be negative.
+		 * \param _pfFootprint The footprint: _sLen Y values followed by _sLen I values and _sLen Q values.
+		 * \param _sLen The number of output pixels in the footprint.
+		 **/
+		static inline void									AddFootprint( float * _pfDstY, float * _pfDstI, float * _pfDstQ, size_t _sTotal, int32_t _i32Start, const float * _pfFootprint, size_t _sLen );
 
 		/**
 		 * Renders a range of scanlines.
@@ -356,51 +461,6 @@ namespace lsn {
 		 **/
 		virtual bool										AllocYiqBuffers( uint16_t _ui16W, uint16_t _ui16H, uint16_t _ui16Scale );
 
-#ifdef __AVX512F__
-		/**
-		 * Performs convolution on 16 values at a time.
-		 * 
-		 * \param _pfSignals The source signals to convolve.
-		 * \param _sFilterIdx The filter table index.
-		 * \param _sCosIdx The cosine/sine table index.
-		 * \param _sSinIdx The sine table index.
-		 * \param _mCos The summed result of cosine convolution.
-		 * \param _mSin The summed result of sine convolution.
-		 * \param _mSignal The summed result of signal convolution.
-		 **/
-		inline void											Convolution16( float * _pfSignals, size_t _sFilterIdx, size_t _sCosIdx, size_t _sSinIdx, __m512 &_mCos, __m512 &_mSin, __m512 &_mSignal );
-#endif	// #ifdef __AVX512F__
-
-#ifdef __AVX__
-		/**
-		 * Performs convolution on 8 values at a time.
-		 * 
-		 * \param _pfSignals The source signals to convolve.
-		 * \param _sFilterIdx The filter table index.
-		 * \param _sCosIdx The cosine/sine table index.
-		 * \param _sSinIdx The sine table index.
-		 * \param _mCos The summed result of cosine convolution.
-		 * \param _mSin The summed result of sine convolution.
-		 * \param _mSignal The summed result of signal convolution.
-		 **/
-		inline void											Convolution8( float * _pfSignals, size_t _sFilterIdx, size_t _sCosIdx, size_t _sSinIdx, __m256 &_mCos, __m256 &_mSin, __m256 &_mSignal );
-#endif	// #ifdef __AVX__
-
-#ifdef __SSE4_1__
-		/**
-		 * Performs convolution on 4 values at a time.
-		 * 
-		 * \param _pfSignals The source signals to convolve.
-		 * \param _sFilterIdx The filter table index.
-		 * \param _sCosIdx The cosine/sine table index.
-		 * \param _sSinIdx The sine table index.
-		 * \param _mCos The summed result of cosine convolution.
-		 * \param _mSin The summed result of sine convolution.
-		 * \param _mSignal The summed result of signal convolution.
-		 **/
-		inline void											Convolution4( float * _pfSignals, size_t _sFilterIdx, size_t _sCosIdx, size_t _sSinIdx, __m128 &_mCos, __m128 &_mSin, __m128 &_mSignal );
-#endif	// #ifdef __SSE4_1__
-
 		/**
 		 * Converts a single scanline of YIQ values in m_vY/m_vI/m_vQ to BGRA values in the same scanline of m_vRgbBuffer.
 		 * 
@@ -467,6 +527,32 @@ namespace lsn {
 		}
 	}
 
+	/**
+	 * Adds a Y/I/Q footprint to a scanline, clipping it to the scanline.
+	 * 
+	 * \param _pfDstY The scanline Y values.
+	 * \param _pfDstI The scanline I values.
+	 * \param _pfDstQ The scanline Q values.
+	 * \param _sTotal The number of output pixels in the scanline.
+	 * \param _i32Start The output pixel at which the footprint begins.  Can be negative.
+	 * \param _pfFootprint The footprint: _sLen Y values followed by _sLen I values and _sLen Q values.
+	 * \param _sLen The number of output pixels in the footprint.
+	 **/
+	inline void CLSpiroPalFilterBase::AddFootprint( float * _pfDstY, float * _pfDstI, float * _pfDstQ, size_t _sTotal, int32_t _i32Start, const float * _pfFootprint, size_t _sLen ) {
+		// Clip to the scanline.  Only pixels near the edges are clipped.
+		size_t sSrc = 0;
+		if LSN_UNLIKELY( _i32Start < 0 ) {
+			sSrc = size_t( -_i32Start );
+			if ( sSrc >= _sLen ) { return; }
+			_i32Start = 0;
+		}
+		if LSN_UNLIKELY( size_t( _i32Start ) >= _sTotal ) { return; }
+		size_t sCount = std::min( _sLen - sSrc, _sTotal - size_t( _i32Start ) );
+
+		const float * pfSrcY = _pfFootprint + sSrc;
+		CFilterKernels::Kernels().pfAddRows3( _pfDstY + _i32Start, _pfDstI + _i32Start, _pfDstQ + _i32Start, pfSrcY, pfSrcY + _sLen, pfSrcY + _sLen * 2, sCount );
+	}
+
 	/**
 	 * Renders a range of scanlines.
 	 * 
@@ -483,12 +569,13 @@ namespace lsn {
 		float * pfI = reinterpret_cast<float *>(m_vI.data());
 		float * pfQ = reinterpret_cast<float *>(m_vQ.data());
 		size_t sYiqStride = m_ui16ScaledWidth; // * (sizeof( simd_4 ) / sizeof( float ));
+		std::shared_ptr<const LSN_LUT> plLut = PrepareLut();
 		pfY += sYiqStride * _ui16Start;
 		pfI += sYiqStride * _ui16Start;
 		pfQ += sYiqStride * _ui16Start;
 		for ( uint16_t H = _ui16Start; H < _ui16End; ++H ) {
 			const uint16_t * pui6PixelRow = reinterpret_cast<const uint16_t *>(_pui8Pixels + (m_ui16Width * sizeof( uint16_t )) * H);
-			ScanlineToYiq( pfY, pfI, pfQ, pui6PixelRow, uint16_t( ((_ui64RenderStartCycle + LSN_PM_PAL_DOTS_X * H) * 8) % 12 ), H );
+			ScanlineToYiq( pfY, pfI, pfQ, pui6PixelRow, uint16_t( ((_ui64RenderStartCycle + LSN_PM_PAL_DOTS_X * H) * 8) % 12 ), H, plLut.get() );
 			ConvertYiqToBgra<_bStoreToInt, _bPhosphorDecay>( H, _pui8Dst, _sPitch );
 			pfY += sYiqStride;
 			pfI += sYiqStride;
@@ -496,118 +583,6 @@ namespace lsn {
 		}
 	}
 
-#ifdef __AVX512F__
-	/**
-	 * Performs convolution on 16 values at a time.
-	 * 
-	 * \param _pfSignals The source signals to convolve.
-	 * \param _sFilterIdx The filter table index.
-	 * \param _sCosIdx The cosine/sine table index.
-	 * \param _sSinIdx The sine table index.
-	 * \param _mCos The summed result of cosine convolution.
-	 * \param _mSin The summed result of sine convolution.
-	 * \param _mSignal The summed result of signal convolution.
-	 **/
-	inline void CLSpiroPalFilterBase::Convolution16( float * _pfSignals, size_t _sFilterIdx, size_t _sCosIdx, size_t _sSinIdx, __m512 &_mCos, __m512 &_mSin, __m512 &_mSignal ) {
-		// Load the signals.
-		__m512 mSignals = _mm512_loadu_ps( _pfSignals );
-		// Load the filter weights.
-		__m512 mFilter = _mm512_load_ps( reinterpret_cast<float *>(&m_mStackedFilterTable512[_sFilterIdx] ) );
-		__m512 mFilterY = _mm512_load_ps( reinterpret_cast<float *>(&m_mStackedFilterTable512Y[_sFilterIdx] ) );
-		// Load the cosine values.
-		__m512 mCos = _mm512_load_ps( reinterpret_cast<float *>(&m_mStackedCosTable512[_sCosIdx] ) );
-
-		// Multiply Signals and weights.
-		__m512 mLevels = _mm512_mul_ps( mSignals, mFilter );
-		__m512 mLevelsY = _mm512_mul_ps( mSignals, mFilterY );
-		// Load the sine values.
-		__m512 mSin = _mm512_load_ps( reinterpret_cast<float *>(&m_mStackedSinTable512[_sSinIdx] ) );
-
-		// Multiply levels and cosines.
-		//_mCos = _mm512_add_ps( _mCos, _mm512_mul_ps( mLevels, mCos ) );
-		_mCos = _mm512_fmadd_ps( mLevels, mCos, _mCos );
-		// Multiply levels and sines.
-		//_mSin = _mm512_add_ps( _mSin, _mm512_mul_ps( mLevels, mSin ) );
-		_mSin = _mm512_fmadd_ps( mLevels, mSin, _mSin );
-		// Accumulate the signals.
-		_mSignal = _mm512_add_ps( _mSignal, mLevelsY );
-	}
-#endif	// #ifdef __AVX512F__
-
-#ifdef __AVX__
-	/**
-	 * Performs convolution on 8 values at a time.
-	 * 
-	 * \param _pfSignals The source signals to convolve.
-	 * \param _sFilterIdx The filter table index.
-	 * \param _sCosIdx The cosine/sine table index.
-	 * \param _sSinIdx The sine table index.
-	 * \param _mCos The summed result of cosine convolution.
-	 * \param _mSin The summed result of sine convolution.
-	 * \param _mSignal The summed result of signal convolution.
-	 **/
-	inline void CLSpiroPalFilterBase::Convolution8( float * _pfSignals, size_t _sFilterIdx, size_t _sCosIdx, size_t _sSinIdx, __m256 &_mCos, __m256 &_mSin, __m256 &_mSignal ) {
-		// Load the signals.
-		__m256 mSignals = _mm256_loadu_ps( _pfSignals );
-		// Load the filter weights.
-		__m256 mFilter = _mm256_load_ps( reinterpret_cast<float *>(&m_mStackedFilterTable[_sFilterIdx] ) );
-		__m256 mFilterY = _mm256_load_ps( reinterpret_cast<float *>(&m_mStackedFilterTable[_sFilterIdx] ) );
-		// Load the cosine values.
-		__m256 mCos = _mm256_load_ps( reinterpret_cast<float *>(&m_mStackedCosTable[_sCosIdx] ) );
-
-		// Multiply Signals and weights.
-		__m256 mLevels = _mm256_mul_ps( mSignals, mFilter );
-		__m256 mLevelsY = _mm256_mul_ps( mSignals, mFilterY );
-		// Load the sine values.
-		__m256 mSin = _mm256_load_ps( reinterpret_cast<float *>(&m_mStackedSinTable[_sSinIdx] ) );
-
-		// Multiply levels and cosines.
-		//_mCos = _mm256_add_ps( _mCos, _mm256_mul_ps( mLevels, mCos ) );
-		_mCos = _mm256_fmadd_ps( mLevels, mCos, _mCos );
-		// Multiply levels and sines.
-		//_mSin = _mm256_add_ps( _mSin, _mm256_mul_ps( mLevels, mSin ) );
-		_mSin = _mm256_fmadd_ps( mLevels, mSin, _mSin );
-		// Accumulate the signals.
-		_mSignal = _mm256_add_ps( _mSignal, mLevelsY );
-	}
-#endif	// #ifdef __AVX__
-
-#ifdef __SSE4_1__
-	/**
-	 * Performs convolution on 4 values at a time.
-	 * 
-	 * \param _pfSignals The source signals to convolve.
-	 * \param _sFilterIdx The filter table index.
-	 * \param _sCosIdx The cosine/sine table index.
-	 * \param _sSinIdx The sine table index.
-	 * \param _mCos The summed result of cosine convolution.
-	 * \param _mSin The summed result of sine convolution.
-	 * \param _mSignal The summed result of signal convolution.
-	 **/
-	inline void CLSpiroPalFilterBase::Convolution4( float * _pfSignals, size_t _sFilterIdx, size_t _sCosIdx, size_t _sSinIdx, __m128 &_mCos, __m128 &_mSin, __m128 &_mSignal ) {
-		// Load the signals.
-		__m128 mSignals = _mm_loadu_ps( _pfSignals );
-		// Load the filter weights.
-		__m128 mFilter = _mm_load_ps( reinterpret_cast<float *>(&m_mStackedFilterTable[_sFilterIdx] ) );
-		__m128 mFilterY = _mm_load_ps( reinterpret_cast<float *>(&m_mStackedFilterTableY[_sFilterIdx] ) );
-		// Load the cosine values.
-		__m128 mCos = _mm_load_ps( reinterpret_cast<float *>(&m_mStackedCosTable[_sCosIdx] ) );
-
-		// Multiply Signals and weights.
-		__m128 mLevels = _mm_mul_ps( mSignals, mFilter );
-		__m128 mLevelsY = _mm_mul_ps( mSignals, mFilterY );
-		// Load the sine values.
-		__m128 mSin = _mm_load_ps( reinterpret_cast<float *>(&m_mStackedSinTable[_sSinIdx] ) );
-
-		// Multiply levels and cosines.
-		_mCos = _mm_add_ps( _mCos, _mm_mul_ps( mLevels, mCos ) );
-		// Multiply levels and sines.
-		_mSin = _mm_add_ps( _mSin, _mm_mul_ps( mLevels, mSin ) );
-		// Accumulate the signals.
-		_mSignal = _mm_add_ps( _mSignal, mLevelsY );
-	}
-#endif	// #ifdef __SSE4_1__
-
 	/**
 	 * Converts a single scanline of YIQ values in m_vY/m_vI/m_vQ to BGRA values in the same scanline of m_vRgbBuffer.
 	 * 
@@ -10,6 +10,7 @@
 #include "../Utilities/LSNUtilities.h"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 
 namespace lsn {
@@ -27,8 +28,7 @@ namespace lsn {
 		m_fBrightness( -0.106f ),
 		m_fContrast( 0.0f ),
 		m_fSaturation( -0.125f ),
-		m_fHue( 18.0f / 180.0f ),
-		m_bRunThreads( true ) {
+		m_fHue( 18.0f / 180.0f ) {
 
 		// from https ://forums.nesdev.org/viewtopic.php?p=159266#p159266
 		const double signalLumaLow[2][4] = {
@@ -65,11 +65,10 @@ namespace lsn {
 			}
 		}
 
-		m_tThreadData.pblppThis = this;
-		m_ptThread = std::make_unique<std::thread>( Thread, &m_tThreadData );
+		GenSignalTable();
 	}
 	CNtscBisqwitFilter::~CNtscBisqwitFilter() {
-		StopThread();
+		StopThreads();
 	}
 
 	/**
@@ -128,6 +127,9 @@ namespace lsn {
 		m_i32Ib = int32_t( i32Contrast * -1.012984e-6 * i32Saturation / m_i32WidthI );
 		m_i32Qb = int32_t( i32Contrast * 1.667217e-6 * i32Saturation / m_i32WidthQ );
 
+		StopThreads();
+		StartThreads();
+
 		return InputFormat();
 	}
 
@@ -150,39 +152,31 @@ namespace lsn {
 #endif	// #ifdef LSN_BISQWIT_PERF
 
 
-		m_tThreadData.ui32Stride = _ui32Stride;
-		m_tThreadData.ui32ScreenWidth = _ui32Width;
-		m_tThreadData.ui32ScreenHeight = _ui32Height;
-		m_tThreadData.ui64RenderCycle = _ui64RenderStartCycle + 341 * (_ui32Height >> 1);
-		m_tThreadData.pui8Input = _pui8Input;
-		if ( m_ptThread.get() ) {
-			m_eGo.Signal();
+		// If there are no worker threads, filter the whole frame on the calling thread.
+		if LSN_UNLIKELY( !m_vThreads.size() ) {
+			DoFrame( _ui64RenderStartCycle, _pui8Input, 0, _ui32Height );
 		}
+		else {
+			const size_t stThreads = m_vThreads.size() + 1;
+			{
+				std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+				m_jJob.pui8Pixels = _pui8Input;
+				m_jJob.ui64RenderStartCycle = _ui64RenderStartCycle;
+				m_jJob.ui32Height = _ui32Height;
+				m_jJob.stThreads = stThreads;
+				++m_ui64JobId;
+				m_ui32WorkersRemaining.store( uint32_t( m_vThreads.size() ) );
+			}
+			m_cvGo.notify_all();
 
-		DoFrame( _ui64RenderStartCycle, _pui8Input, 0, _ui32Height >> 1, _ui32Width );
+			// Filter the calling thread's band.
+			DoFrame( _ui64RenderStartCycle, _pui8Input, 0, uint32_t( _ui32Height / stThreads ) );
 
-		if ( m_ptThread.get() ) {
-			m_eDone.WaitForSignal();
+			// Wait for all worker threads.
+			std::unique_lock<std::mutex> ulLock( m_mThreadMutex );
+			m_cvDone.wait( ulLock, [&]() { return m_ui32WorkersRemaining.load() == 0; } );
 		}
 
-		//DoFrame( _ui64RenderStartCycle + 341 * (_ui32Height >> 1), _pui8Input, _ui32Height >> 1, _ui32Height, _ui32Width );
-
-		/*uint32_t constexpr ui32ResDiv = 1;
-		int32_t i32PixelsPerCycle = 8 / ui32ResDiv;
-		int32_t i32Phase = int32_t( _ui64RenderStartCycle * 8 % 12 );
-		constexpr int32_t i32LineW = 256;
-		int8_t i8RowSig[i32LineW*m_i32SignalsPerPixel];
-		uint32_t ui32RowPixelGap = _ui32Width * i32PixelsPerCycle;
-		uint32_t * pui32Out = reinterpret_cast<uint32_t *>(m_vFilteredOutput.data());
-		for ( uint32_t Y = 0; Y < _ui32Height; Y++ ) {
-			int32_t i32StartCycle = i32Phase % 12;
-		
-			GenerateNtscSignal( i8RowSig, i32Phase, Y, reinterpret_cast<const uint16_t *>(_pui8Input) );
-
-			NtscDecodeLine( i32LineW * m_i32SignalsPerPixel, i8RowSig, pui32Out, (i32StartCycle + 7) % 12 );
-
-			pui32Out += ui32RowPixelGap;
-		}*/
 		_ui32Width = m_ui32FinalWidth;
 		_ui32Height = m_ui32FinalHeight;
 		_ui32Stride = m_ui32FinalStride;
@@ -194,46 +188,74 @@ namespace lsn {
 	}
 
 	/**
-	 * Converts one row of the 16-bit PPU output to an NTSC signal.
+	 * Sets the number of worker threads used by the filter.  The frame is split into one band of scanlines per thread, including
+	 *	the calling thread.
 	 *
-	 * \param _pi8Signal The output signal generated.
-	 * \param _i32Phase The phase offset of the signal.
-	 * \param _i32Row The row to generate.
-	 * \param _pui16Input The input palette values.
+	 * \param _stThreads Number of worker threads to use.  0 disables worker threads.
 	 */
-	void CNtscBisqwitFilter::GenerateNtscSignal( int8_t * _pi8Signal, int32_t &_i32Phase, int32_t _i32Row, const uint16_t * _pui16Input ) {
-		for ( int32_t X = 0; X < 256; X++ ) {
-			uint16_t ui16Color = _pui16Input[(_i32Row<<8)|X];
+	void CNtscBisqwitFilter::SetWorkerThreadCount( size_t _stThreads ) {
+		if ( _stThreads == m_stWorkerThreadCount ) { return; }
+
+		const bool bRestart = m_bThreadsStarted;
+		if ( bRestart ) { StopThreads(); }
+		m_stWorkerThreadCount = _stThreads;
+		if ( bRestart ) { StartThreads(); }
+	}
 
+	/**
+	 * Fills m_vSignalTable from the low/high signal levels.
+	 */
+	void CNtscBisqwitFilter::GenSignalTable() {
+		m_vSignalTable.resize( 0x200 * 12 );
+		for ( uint16_t ui16Color = 0; ui16Color < 0x200; ++ui16Color ) {
 			int8_t i8Low = m_i8SigLow[ui16Color&0x3F];
 			int8_t i8High = m_i8SigHi[ui16Color&0x3F];
 			int8_t i8Emphasis = int8_t( ui16Color >> 6 );
-
-			uint16_t ui16PhaseBitMask = m_ui16BitMaskTable[std::abs(_i32Phase-(ui16Color&0x0F))%12];
-
-			uint8_t ui8Voltage;
-			for ( int32_t J = 0; J < 8; J++ ) {
-				ui16PhaseBitMask <<= 1;
-				ui8Voltage = i8High;
-				if ( ui16PhaseBitMask >= 0x40 ) {
-					if ( ui16PhaseBitMask == 0x1000 ) {
-						ui16PhaseBitMask = 1;
+			for ( int32_t P = 0; P < 12; ++P ) {
+				uint16_t ui16PhaseBitMask = m_ui16BitMaskTable[(P+24-(ui16Color&0x0F))%12];
+
+				int8_t i8Signal[8];
+				uint8_t ui8Voltage;
+				for ( int32_t J = 0; J < 8; J++ ) {
+					ui16PhaseBitMask <<= 1;
+					ui8Voltage = i8High;
+					if ( ui16PhaseBitMask >= 0x40 ) {
+						if ( ui16PhaseBitMask == 0x1000 ) {
+							ui16PhaseBitMask = 1;
+						}
+						else {
+							ui8Voltage = i8Low;
+						}
 					}
-					else {
-						ui8Voltage = i8Low;
+
+					if ( ui16PhaseBitMask & i8Emphasis ) {
+						ui8Voltage -= ui8Voltage >> 2;
 					}
-				}
 
-				if ( ui16PhaseBitMask & i8Emphasis ) {
-					ui8Voltage -= ui8Voltage >> 2;
+					i8Signal[J] = int8_t( ui8Voltage );
 				}
-
-				_pi8Signal[((X)<<3)|J] = ui8Voltage;
+				std::memcpy( &m_vSignalTable[ui16Color*12+P], i8Signal, sizeof( i8Signal ) );
 			}
+		}
+	}
+
+	/**
+	 * Converts one row of the 16-bit PPU output to an NTSC signal.
+	 *
+	 * \param _pi8Signal The output signal generated.
+	 * \param _i32Phase The phase (0-11) of the first pixel of the row.
+	 * \param _i32Row The row to generate.
+	 * \param _pui16Input The input palette values.
+	 */
+	void CNtscBisqwitFilter::GenerateNtscSignal( int8_t * _pi8Signal, int32_t _i32Phase, int32_t _i32Row, const uint16_t * _pui16Input ) {
+		const uint64_t * pui64Table = m_vSignalTable.data();
+		const uint16_t * pui16Row = _pui16Input + (_i32Row << 8);
+		for ( int32_t X = 0; X < 256; X++ ) {
+			std::memcpy( &_pi8Signal[X<<3], &pui64Table[(pui16Row[X]&0x1FF)*12+_i32Phase], sizeof( uint64_t ) );
 
 			_i32Phase += m_i32SignalsPerPixel;
+			if ( _i32Phase >= 12 ) { _i32Phase -= 12; }
 		}
-		_i32Phase += (341 - 256) * m_i32SignalsPerPixel;
 	}
 
 	/**
@@ -265,19 +287,31 @@ namespace lsn {
 	 *         would convey in the colorburst period in the beginning of each scanline.
 	 */
 	void CNtscBisqwitFilter::NtscDecodeLine( int32_t _i32Width, const int8_t * _pi8Signal, uint32_t * _pui32Output, int32_t _i32Phase0 ) {
+		int32_t i32Brightness = int32_t( m_fBrightness * 750 );
+#ifndef LSN_SRGB_BISQWIT
+		int32_t i32Cos[CFilterKernels::LSN_BISQWIT_PHASE_ROW], i32Sin[CFilterKernels::LSN_BISQWIT_PHASE_ROW];
+		for ( int32_t J = 0; J < CFilterKernels::LSN_BISQWIT_PHASE_ROW; ++J ) {
+			i32Cos[J] = m_i8SinTable[J%12+_i32Phase0];
+			i32Sin[J] = m_i8SinTable[J%12+3+_i32Phase0];
+		}
+		CFilterKernels::LSN_BISQWIT_LINE blLine = {
+			_pi8Signal, _pui32Output, i32Cos, i32Sin,
+			_i32Width, m_i32WidthY, m_i32WidthI, m_i32WidthQ, i32Brightness,
+			m_i32Y, m_i32Ir, m_i32Ig, m_i32Ib, m_i32Qr, m_i32Qg, m_i32Qb
+		};
+		CFilterKernels::Kernels().pfBisqwitDecode( blLine );
+#else
 		uint32_t constexpr ui32ResDiv = 1;
 		uint32_t constexpr ui32OverscanLeft = 0;
 		uint32_t constexpr ui32OverscanRight = 0;
-		auto Read = [=]( int32_t _i32Pos ) -> char { return _i32Pos >= 0 ? _pi8Signal[_i32Pos] : 0; };
+		auto Read = [=]( int32_t _i32Pos ) -> char { return _pi8Signal[_i32Pos]; };
 		auto Cos = [=]( int32_t _i32Pos ) -> char { return m_i8SinTable[(_i32Pos+36)%12+_i32Phase0]; };
 		auto Sin = [=]( int32_t _i32Pos ) -> char { return m_i8SinTable[(_i32Pos+36)%12+3+_i32Phase0]; };
 
-		int32_t i32Brightness = int32_t( m_fBrightness * 750 );
 		int32_t i32SumY = i32Brightness, i32SumI = 0, i32SumQ = 0;
 		int32_t i32Offset = ui32ResDiv + 4;
 		int32_t i32LeftOverscan = ui32OverscanLeft * 8 + i32Offset;
 		int32_t i32RightOverscan = _i32Width - ui32OverscanRight * 8 + i32Offset;
-#ifdef LSN_SRGB_BISQWIT
 		auto LinearTosRGB = [&]( double _dVal ) {
 			return _dVal <= 0.0031308 ?
 				_dVal * 12.92 :
@@ -286,7 +320,6 @@ namespace lsn {
 
 		int32_t i32LastR = 0, i32LastG = 0, i32LastB = 0;
 		int32_t i32LastRs = 0, i32LastGs = 0, i32LastBs = 0;
-#endif	// LSN_SRGB_BISQWIT
 		for ( int32_t I = 0; I < i32RightOverscan; I++ ) {
 			int32_t i32ReadI = Read( I );
 			i32SumY += i32ReadI - Read( I - m_i32WidthY );
@@ -301,7 +334,6 @@ namespace lsn {
 				/*int32_t i32R = std::clamp( (i32SumY * m_i32Y + i32SumI * m_i32Ir + i32SumQ * m_i32Qr) / 65536, 0, 255 );
 				int32_t i32G = std::clamp( (i32SumY * m_i32Y + i32SumI * m_i32Ig + i32SumQ * m_i32Qg) / 65536, 0, 255 );
 				int32_t i32B = std::clamp( (i32SumY * m_i32Y + i32SumI * m_i32Ib + i32SumQ * m_i32Qb) / 65536, 0, 255 );*/
-#ifdef LSN_SRGB_BISQWIT
 				if ( i32R != i32LastR ) {
 					i32LastR = i32R;
 					double dFract = LinearTosRGB( i32R / 255.0 );
@@ -328,59 +360,120 @@ namespace lsn {
 				else {
 					i32B = i32LastRs;
 				}
-#endif	// LSN_SRGB_BISQWIT
 
 
 				(*_pui32Output) = 0xFF000000 | (i32R << 16) | (i32G << 8) | i32B;
 				_pui32Output++;
 			}
 		}
+#endif	// #ifndef LSN_SRGB_BISQWIT
 	}
 
-	void CNtscBisqwitFilter::DoFrame( uint64_t _ui64RenderCycle, uint8_t * _pui8Input, uint32_t _ui32From, uint32_t _ui32To, uint32_t _ui32Width ) {
-		uint32_t constexpr ui32ResDiv = 1;
-		int32_t i32PixelsPerCycle = 8 / ui32ResDiv;
-		int32_t i32Phase = int32_t( _ui64RenderCycle * m_i32SignalsPerPixel % 12 );
+	/**
+	 * Filters a band of scanlines.
+	 *
+	 * \param _ui64RenderCycle The PPU cycle at the start of the frame.
+	 * \param _pui8Input The input 9-bit pixel array.
+	 * \param _ui32From The first scanline to filter.
+	 * \param _ui32To The end of the scanlines to filter.
+	 */
+	void CNtscBisqwitFilter::DoFrame( uint64_t _ui64RenderCycle, const uint8_t * _pui8Input, uint32_t _ui32From, uint32_t _ui32To ) {
 		constexpr int32_t i32LineW = 256;
-		int8_t i8RowSig[i32LineW*m_i32SignalsPerPixel];
-		uint32_t ui32RowPixelGap = _ui32Width * i32PixelsPerCycle;
-		uint32_t * pui32Out = reinterpret_cast<uint32_t *>(m_vFilteredOutput.data() + _ui32From * m_ui32FinalStride);
+		constexpr int32_t i32Pad = CFilterKernels::LSN_BISQWIT_PAD;
+		// The decoder reads up to LSN_BISQWIT_PAD samples on either side of the row, which must be silent.
+		int8_t i8RowSig[i32Pad+i32LineW*m_i32SignalsPerPixel+i32Pad] = {};
+		// Each scanline is 341 cycles, so the phase of a row depends only on its index and the frame's starting cycle.
+		int32_t i32Phase = int32_t( (_ui64RenderCycle + uint64_t( _ui32From ) * 341) * m_i32SignalsPerPixel % 12 );
+		uint8_t * pui8Out = m_vFilteredOutput.data() + _ui32From * m_ui32FinalStride;
 		for ( uint32_t Y = _ui32From; Y < _ui32To; Y++ ) {
-			int32_t i32StartCycle = i32Phase % 12;
-		
-			GenerateNtscSignal( i8RowSig, i32Phase, Y, reinterpret_cast<const uint16_t *>(_pui8Input) );
-			NtscDecodeLine( i32LineW * m_i32SignalsPerPixel, i8RowSig, pui32Out, (i32StartCycle + _ui32From * 341 + 7) % 12 );
+			GenerateNtscSignal( i8RowSig + i32Pad, i32Phase, Y, reinterpret_cast<const uint16_t *>(_pui8Input) );
+			NtscDecodeLine( i32LineW * m_i32SignalsPerPixel, i8RowSig + i32Pad, reinterpret_cast<uint32_t *>(pui8Out), (i32Phase + 7) % 12 );
+
+			i32Phase = (i32Phase + 341 * m_i32SignalsPerPixel) % 12;
+			pui8Out += m_ui32FinalStride;
+		}
+	}
 
-			pui32Out += ui32RowPixelGap;
+	/**
+	 * Starts the worker threads.  Does nothing if they are already started.
+	 */
+	void CNtscBisqwitFilter::StartThreads() {
+		if ( m_bThreadsStarted ) { return; }
+
+		const size_t stWorkers = m_stWorkerThreadCount;
+		m_bStopThreads = false;
+		m_ui64JobId = 0;
+		m_ui32WorkersRemaining.store( 0 );
+		m_vThreads.clear();
+
+		if ( stWorkers ) {
+			m_vThreads.reserve( stWorkers );
+			for ( size_t I = 0; I < stWorkers; ++I ) {
+				m_vThreads.emplace_back( &CNtscBisqwitFilter::WorkerThread, this, I + 1 );
+			}
 		}
+
+		m_bThreadsStarted = true;
 	}
 
 	/**
-	 * Stops the thread.
+	 * Stops the worker threads.  Does nothing if they are not started.
 	 */
-	void CNtscBisqwitFilter::StopThread() {
-		m_bRunThreads = false;
-		if ( m_ptThread.get() ) {
-			m_eGo.Signal();
-			m_eDone.WaitForSignal();
-			m_ptThread->join();
-			m_ptThread.reset();
+	void CNtscBisqwitFilter::StopThreads() {
+		if ( !m_bThreadsStarted ) { return; }
+
+		{
+			std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+			m_bStopThreads = true;
+		}
+		m_cvGo.notify_all();
+
+		for ( auto & T : m_vThreads ) {
+			if ( T.joinable() ) {
+				T.join();
+			}
+		}
+		m_vThreads.clear();
+
+		{
+			std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+			m_bStopThreads = false;
 		}
-		m_bRunThreads = true;
+		m_ui32WorkersRemaining.store( 0 );
+		m_bThreadsStarted = false;
 	}
 
 	/**
-	 * The thread.
+	 * The worker thread entry point.  Filters the band of scanlines assigned to this worker each time a job is signaled via m_cvGo.
 	 *
-	 * \param _pblppFilter Pointer to this object.
+	 * \param _stThreadIdx The worker thread index in the range [1, stThreads - 1].  Index 0 is reserved for the calling thread.
 	 */
-	void CNtscBisqwitFilter::Thread( LSN_THREAD * _ptThread ) {
-		while ( _ptThread->pblppThis->m_bRunThreads ) {
-			_ptThread->pblppThis->m_eGo.WaitForSignal();
-			if ( _ptThread->pblppThis->m_bRunThreads ) {
-				_ptThread->pblppThis->DoFrame( _ptThread->ui64RenderCycle + 341 * (_ptThread->ui32ScreenHeight >> 1), _ptThread->pui8Input, _ptThread->ui32ScreenHeight >> 1, _ptThread->ui32ScreenHeight, _ptThread->ui32ScreenWidth );
+	void CNtscBisqwitFilter::WorkerThread( size_t _stThreadIdx ) {
+		::SetThreadHighPriority();
+
+		uint64_t ui64LastJobId = 0;
+
+		for ( ;; ) {
+			LSN_JOB jJob;
+			{
+				std::unique_lock<std::mutex> ulLock( m_mThreadMutex );
+				m_cvGo.wait( ulLock, [&]() { return m_bStopThreads || m_ui64JobId != ui64LastJobId; } );
+				if ( m_bStopThreads ) { break; }
+
+				ui64LastJobId = m_ui64JobId;
+				jJob = m_jJob;
+			}
+
+			const uint32_t ui32Start = uint32_t( (uint64_t( jJob.ui32Height ) * _stThreadIdx) / jJob.stThreads );
+			const uint32_t ui32End = uint32_t( (uint64_t( jJob.ui32Height ) * (_stThreadIdx + 1)) / jJob.stThreads );
+			if ( ui32End > ui32Start ) {
+				DoFrame( jJob.ui64RenderStartCycle, jJob.pui8Pixels, ui32Start, ui32End );
+			}
+
+			if ( m_ui32WorkersRemaining.fetch_sub( 1 ) == 1 ) {
+				std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+				m_cvDone.notify_one();
 			}
-			_ptThread->pblppThis->m_eDone.Signal();
 		}
 	}
 
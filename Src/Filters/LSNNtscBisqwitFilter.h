@@ -9,8 +9,11 @@
 #pragma once
 
 #include "../LSNLSpiroNes.h"
-#include "../Event/LSNEvent.h"
 #include "LSNFilterBase.h"
+#include "LSNFilterKernels.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -88,38 +91,70 @@ namespace lsn {
 		 */
 		virtual uint32_t									OutputBits() const { return 32; }
 
+		/**
+		 * The color-subcarrier phase changes from frame to frame.  The filter must run even on frames identical to the previous one.
+		 *
+		 * \return Returns true.
+		 */
+		virtual bool										IsTemporal() const { return true; }
+
+		/**
+		 * Sets the number of worker threads used by the filter.  The frame is split into one band of scanlines per thread, including
+		 *	the calling thread.
+		 *
+		 * \param _stThreads Number of worker threads to use.  0 disables worker threads.
+		 */
+		void												SetWorkerThreadCount( size_t _stThreads );
+
+		/**
+		 * Gets the number of worker threads used by the filter.
+		 *
+		 * \return Returns the total number of worker threads used by the filter.
+		 */
+		inline size_t										WorkerThreadCount() const { return m_stWorkerThreadCount; }
+
 
 	protected :
 		// == Types.
-		/** Thread parameters */
-		struct LSN_THREAD {
-			uint64_t										ui64RenderCycle;
-			CNtscBisqwitFilter *							pblppThis;
-			uint8_t *										pui8Input;
-			uint32_t										ui32ScreenWidth;
-			uint32_t										ui32ScreenHeight;
-			uint32_t										ui32Stride;
+		/** A per-frame work package shared by all threads. */
+		struct LSN_JOB {
+			uint64_t										ui64RenderStartCycle = 0;							/**< The render cycle at the start of the frame. */
+			const uint8_t *									pui8Pixels = nullptr;								/**< The input 9-bit pixel array. */
+			uint32_t										ui32Height = 0;										/**< The number of scanlines in the frame. */
+			size_t											stThreads = 1;										/**< Total number of threads for the job, including the calling thread. */
 		};
 
 		// == Members.
-		/** Thread data. */
-		LSN_THREAD											m_tThreadData;
 		/** The filtered output buffer. */
 		std::vector<uint8_t>								m_vFilteredOutput;
-		/** The thread. */
-		std::unique_ptr<std::thread>						m_ptThread;
-		/** The signal for the thread to go. */
-		CEvent												m_eGo;
-		/** The signal that the thread has finished. */
-		CEvent												m_eDone;
+		/** The 8 signal samples of each 9-bit color at each of the 12 phases. */
+		std::vector<uint64_t>								m_vSignalTable;
+		/** Worker threads. */
+		std::vector<std::thread>							m_vThreads;
+		/** Mutex protecting thread state. */
+		std::mutex											m_mThreadMutex;
+		/** Signal to tell worker threads to start a job. */
+		std::condition_variable								m_cvGo;
+		/** Signal to tell the main thread workers have finished. */
+		std::condition_variable								m_cvDone;
+		/** Number of workers still running the current job. */
+		std::atomic<uint32_t>								m_ui32WorkersRemaining = 0;
+		/** Incremented to start a new job. */
+		uint64_t											m_ui64JobId = 0;
+		/** Total number of worker threads. */
+		size_t												m_stWorkerThreadCount = 3;
+		/** The current job. */
+		LSN_JOB												m_jJob;
+		/** True if the worker threads have been created. */
+		bool												m_bThreadsStarted = false;
+		/** True if worker threads should exit. */
+		bool												m_bStopThreads = false;
 		/** The final stride. */
 		uint32_t											m_ui32FinalStride;
 		/** The final width. */
 		uint32_t											m_ui32FinalWidth;
 		/** The final height. */
 		uint32_t											m_ui32FinalHeight;
-		/** Boolean to stop all threads. */
-		std::atomic<bool>									m_bRunThreads;
 		/** Brightness. */
 		float												m_fBrightness;
 		/** Contrast. */
@@ -170,15 +205,20 @@ namespace lsn {
 
 
 		// == Functions.
+		/**
+		 * Fills m_vSignalTable from the low/high signal levels.
+		 */
+		void												GenSignalTable();
+
 		/**
 		 * Converts one row of the 16-bit PPU output to an NTSC signal.
 		 *
 		 * \param _pi8Signal The output signal generated.
-		 * \param _i32Phase The phase offset of the signal.
+		 * \param _i32Phase The phase (0-11) of the first pixel of the row.
 		 * \param _i32Row The row to generate.
 		 * \param _pui16Input The input palette values.
 		 */
-		void												GenerateNtscSignal( int8_t * _pi8Signal, int32_t &_i32Phase, int32_t _i32Row, const uint16_t * _pui16Input );
+		void												GenerateNtscSignal( int8_t * _pi8Signal, int32_t _i32Phase, int32_t _i32Row, const uint16_t * _pui16Input );
 
 		/**
 		 * NTSC_DecodeLine(Width, Signal, Target, Phase0)
@@ -212,19 +252,32 @@ namespace lsn {
 		 */
 		void												NtscDecodeLine( int32_t _i32Width, const int8_t * _pi8Signal, uint32_t * _pui32Output, int32_t _i32Phase0 );
 
-		void												DoFrame( uint64_t _ui64RenderCycle, uint8_t * _pui8Input, uint32_t _ui32From, uint32_t _ui32To, uint32_t _ui32Width );
+		/**
+		 * Filters a band of scanlines.
+		 *
+		 * \param _ui64RenderCycle The PPU cycle at the start of the frame.
+		 * \param _pui8Input The input 9-bit pixel array.
+		 * \param _ui32From The first scanline to filter.
+		 * \param _ui32To The end of the scanlines to filter.
+		 */
+		void												DoFrame( uint64_t _ui64RenderCycle, const uint8_t * _pui8Input, uint32_t _ui32From, uint32_t _ui32To );
+
+		/**
+		 * Starts the worker threads.  Does nothing if they are already started.
+		 */
+		void												StartThreads();
 
 		/**
-		 * Stops the thread.
+		 * Stops the worker threads.  Does nothing if they are not started.
 		 */
-		void												StopThread();
+		void												StopThreads();
 
 		/**
-		 * The thread.
+		 * The worker thread entry point.  Filters the band of scanlines assigned to this worker each time a job is signaled via m_cvGo.
 		 *
-		 * \param _pblppFilter Pointer to this object.
+		 * \param _stThreadIdx The worker thread index in the range [1, stThreads - 1].  Index 0 is reserved for the calling thread.
 		 */
-		static void											Thread( LSN_THREAD * _ptThread );
+		void												WorkerThread( size_t _stThreadIdx );
 	};
 
 }	// namespace lsn
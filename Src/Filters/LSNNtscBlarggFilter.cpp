@@ -54,7 +54,8 @@ namespace lsn {
 		}
 
 		m_ui32FinalStride = RowStride( NES_NTSC_OUT_WIDTH( _ui16Width ), OutputBits() );
-		m_vFilteredOutput.resize( m_ui32FinalStride * _ui16Height );
+		m_vFilteredOutput.resize( m_ui32FinalStride * _ui16Height * 3 );
+		m_rcRowCache.Init( _ui16Height, 3 );
 
 		return InputFormat();
 	}
@@ -73,10 +74,17 @@ namespace lsn {
 	 * \return Returns a pointer to the filtered output buffer.
 	 */
 	uint8_t * CNtscBlarggFilter::ApplyFilter( uint8_t * _pui8Input, uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &/*_ui16BitDepth*/, uint32_t &_ui32Stride, uint64_t /*_ui64PpuFrame*/, uint64_t _ui64RenderStartCycle ) {
-		::nes_ntsc_blit( &m_nnBlarggNtsc,
-			reinterpret_cast<NES_NTSC_IN_T *>(_pui8Input), _ui32Width, _ui64RenderStartCycle % 3, 3,
-			_ui32Width, _ui32Height,
-			m_vFilteredOutput.data(), m_ui32FinalStride );
+		// Each burst phase keeps its own frame, in which only the rows that changed since that phase was last filtered are redone.
+		//	Rows are filtered independently, so a changed row does not affect its neighbors.
+		uint32_t ui32Phase = uint32_t( _ui64RenderStartCycle % 3 );
+		uint8_t * pui8Output = m_vFilteredOutput.data() + size_t( m_ui32FinalStride ) * _ui32Height * ui32Phase;
+		m_rcRowCache.Update( ui32Phase, m_pui64RowVersions, m_sRowVersions, m_ui64FrameVersion, FlipInput() );
+		for ( const auto & rRun : m_rcRowCache.DirtyRuns() ) {
+			::nes_ntsc_blit( &m_nnBlarggNtsc,
+				reinterpret_cast<NES_NTSC_IN_T *>(_pui8Input) + size_t( rRun.ui32Start ) * _ui32Width, _ui32Width, int( (ui32Phase + rRun.ui32Start) % 3 ), 3,
+				_ui32Width, rRun.ui32End - rRun.ui32Start,
+				pui8Output + size_t( rRun.ui32Start ) * m_ui32FinalStride, m_ui32FinalStride );
+		}
 		_ui32Width = NES_NTSC_OUT_WIDTH( _ui32Width );
 		_ui32Stride = m_ui32FinalStride;
 		/*for ( uint32_t Y = _ui32Height >> 1; Y--; ) {
@@ -87,7 +95,7 @@ namespace lsn {
 				std::swap( pui32Src0[X], pui32Src1[X] );
 			}
 		}*/
-		return m_vFilteredOutput.data();
+		return pui8Output;
 	}
 
 }	// namespace lsn
@@ -10,6 +10,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNFilterBase.h"
+#include "LSNRowCache.h"
 #include "nes_ntsc/nes_ntsc.h"
 
 #include <vector>
@@ -83,13 +84,27 @@ namespace lsn {
 		 */
 		virtual uint32_t									OutputBits() const { return 32; }
 
+		/**
+		 * Discards the cached output so that the next frame is filtered in full.
+		 */
+		virtual void										Invalidate() { m_rcRowCache.Invalidate(); }
+
+		/**
+		 * The burst phase changes from frame to frame.  The filter must run even on frames identical to the previous one.
+		 *
+		 * \return Returns true.
+		 */
+		virtual bool										IsTemporal() const { return true; }
+
 
 	protected :
 		// == Members.
 		/** The Blargg NTSC emulation. */
 		nes_ntsc_t											m_nnBlarggNtsc;
-		/** The filtered output buffer. */
+		/** The filtered output buffers, one frame for each burst phase. */
 		std::vector<uint8_t>								m_vFilteredOutput;
+		/** Tracks the rows that changed since each burst phase was last filtered. */
+		CRowCache											m_rcRowCache;
 		/** The image-flip thread. */
 		/** The final stride. */
 		uint32_t											m_ui32FinalStride;
@@ -0,0 +1,275 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: EMMIR (LMP88959)'s fast integer-only NTSC filter.
+ */
+
+#include "LSNNtscCrtFastFilter.h"
+#include "../Utilities/LSNUtilities.h"
+#include "NTSC-CRT-Fast/crt.h"
+
+#define m_nsSettings				(*reinterpret_cast<NES_NTSC_SETTINGS_FAST *>(m_vSettings.data()))
+#define m_ncCrtNtsc					(*reinterpret_cast<CRT_FAST *>(m_vCrtNtsc.data()))
+
+namespace lsn {
+
+	CNtscCrtFastFilter::CNtscCrtFastFilter() :
+		m_ui32FinalStride( 0 ),
+		m_ui32FinalWidth( CRT_HRES ),
+		m_ui32FinalHeight( 0 ) {
+		m_vSettings.resize( sizeof( NES_NTSC_SETTINGS_FAST ) );
+		m_vCrtNtsc.resize( sizeof( CRT_FAST ) );
+	}
+	CNtscCrtFastFilter::~CNtscCrtFastFilter() {
+		StopThreads();
+	}
+
+
+	// == Functions.
+	/**
+	 * Sets the basic parameters for the filter.
+	 *
+	 * \param _stBuffers The number of render targets to create.
+	 * \param _ui16Width The console screen width.  Typically 256.
+	 * \param _ui16Height The console screen height.  Typically 240.
+	 * \return Returns the input format requested of the PPU.
+	 */
+	CDisplayClient::LSN_PPU_OUT_FORMAT CNtscCrtFastFilter::Init( size_t _stBuffers, uint16_t _ui16Width, uint16_t _ui16Height ) {
+		m_vBasicRenderTarget.resize( _stBuffers );
+
+		m_ui32OutputWidth = _ui16Width;
+		m_ui32OutputHeight = _ui16Height;
+		m_stStride = size_t( m_ui32OutputWidth * sizeof( uint16_t ) );
+
+		for ( auto I = m_vBasicRenderTarget.size(); I--; ) {
+			m_vBasicRenderTarget[I].resize( m_stStride * _ui16Height );
+			for ( auto J = m_vBasicRenderTarget[I].size() / sizeof( uint16_t ); J--; ) {
+				(*reinterpret_cast<uint16_t *>(&m_vBasicRenderTarget[I][J*sizeof( uint16_t )])) = 0x0F;
+			}
+		}
+
+		m_ui32FinalWidth = CRT_HRES;
+		m_ui32FinalHeight = _ui16Height;
+		m_ui32FinalStride = RowStride( m_ui32FinalWidth, OutputBits() );
+		m_vFilteredOutput.resize( m_ui32FinalStride * m_ui32FinalHeight );
+
+		StopThreads();
+		::crt_init_fast( &m_ncCrtNtsc, int( m_ui32FinalWidth ), int( m_ui32FinalHeight ), reinterpret_cast<int *>(m_vFilteredOutput.data()) );
+		// The same settings as CNtscCrtFullFilter.
+		m_ncCrtNtsc.hue = 20;
+		m_ncCrtNtsc.brightness = 4;
+		m_ncCrtNtsc.contrast = 180;
+		m_ncCrtNtsc.saturation = 17;
+		m_ncCrtNtsc.black_point = 4;
+		m_ncCrtNtsc.white_point = 75;
+		::crt_nes2ntsc_prepare_fast( &m_ncCrtNtsc );
+
+		m_nsSettings.raw = 0;
+		m_nsSettings.as_color = 1;
+		m_nsSettings.cc[0] = 0;
+		m_nsSettings.cc[1] = 16;
+		m_nsSettings.cc[2] = 0;
+		m_nsSettings.cc[3] = -16;
+		m_nsSettings.ccs = 16;
+
+		StartThreads();
+
+		return InputFormat();
+	}
+
+	/**
+	 * Tells the filter that rendering to the source buffer has completed and that it should filter the results.  The final buffer, along with
+	 *	its width, height, bit-depth, and stride, are returned.
+	 *
+	 * \param _pui8Input The buffer to be filtered, which will be a pointer to one of the buffers returned by OutputBuffer() previously.  Its format will be that returned in InputFormat().
+	 * \param _ui32Width On input, this is the width of the buffer in pixels.  On return, it is filled with the final width, in pixels, of the result.
+	 * \param _ui32Height On input, this is the height of the buffer in pixels.  On return, it is filled with the final height, in pixels, of the result.
+	 * \param _ui16BitDepth On input, this is the bit depth of the buffer.  On return, it is filled with the final bit depth of the result.
+	 * \param _ui32Stride On input, this is the stride of the buffer.  On return, it is filled with the final stride, in bytes, of the result.
+	 * \param _ui64PpuFrame The PPU frame associated with the input data.
+	 * \param _ui64RenderStartCycle The cycle at which rendering of the first pixel began.
+	 * \return Returns a pointer to the filtered output buffer.
+	 */
+	uint8_t * CNtscCrtFastFilter::ApplyFilter( uint8_t * _pui8Input, uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &/*_ui16BitDepth*/, uint32_t &_ui32Stride, uint64_t /*_ui64PpuFrame*/, uint64_t _ui64RenderStartCycle ) {
+		m_nsSettings.data = reinterpret_cast<unsigned short *>(_pui8Input);
+		m_nsSettings.w = int( m_ui32OutputWidth );
+		m_nsSettings.h = int( m_ui32OutputHeight );
+		m_nsSettings.dot_crawl_offset = int( _ui64RenderStartCycle % 3 );
+
+		RunStage( LSN_S_MODULATE, true );
+		// Sync tracking carries from one scanline to the next, so it stays on this thread.
+		::crt_sync_fast( &m_ncCrtNtsc, m_iNoise );
+		// Scanlines can only be decoded side-by-side when each has its own output rows.
+		RunStage( LSN_S_DECODE, m_ui32FinalHeight >= CRT_LINES );
+
+		_ui32Width = m_ui32FinalWidth;
+		_ui32Height = m_ui32FinalHeight;
+		_ui32Stride = m_ui32FinalStride;
+		return m_vFilteredOutput.data();
+	}
+
+	/**
+	 * Called when the filter is about to become active.
+	 */
+	void CNtscCrtFastFilter::Activate() {
+		std::memset( m_vFilteredOutput.data(), 0, m_vFilteredOutput.size() );
+		CFilterBase::Activate();
+	}
+
+	/**
+	 * Sets the number of worker threads used by the filter.  Each stage of the frame is split into one band of scanlines per
+	 *	thread, including the calling thread.
+	 *
+	 * \param _stThreads Number of worker threads to use.  0 disables worker threads.
+	 */
+	void CNtscCrtFastFilter::SetWorkerThreadCount( size_t _stThreads ) {
+		if ( _stThreads == m_stWorkerThreadCount ) { return; }
+
+		const bool bRestart = m_bThreadsStarted;
+		if ( bRestart ) { StopThreads(); }
+		m_stWorkerThreadCount = _stThreads;
+		if ( bRestart ) { StartThreads(); }
+	}
+
+	/**
+	 * Runs a stage over all of its bands, using the worker threads if there are any.
+	 *
+	 * \param _sStage The stage to run.
+	 * \param _bThreaded If false, the whole stage runs on the calling thread.
+	 */
+	void CNtscCrtFastFilter::RunStage( LSN_STAGE _sStage, bool _bThreaded ) {
+		if LSN_UNLIKELY( !m_vThreads.size() || !_bThreaded ) {
+			DoBand( _sStage, 0, 1 );
+			return;
+		}
+		const size_t stThreads = m_vThreads.size() + 1;
+		{
+			std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+			m_jJob.sStage = _sStage;
+			m_jJob.stThreads = stThreads;
+			++m_ui64JobId;
+			m_ui32WorkersRemaining.store( uint32_t( m_vThreads.size() ) );
+		}
+		m_cvGo.notify_all();
+
+		// Run the calling thread's band.
+		DoBand( _sStage, 0, stThreads );
+
+		// Wait for all worker threads.
+		std::unique_lock<std::mutex> ulLock( m_mThreadMutex );
+		m_cvDone.wait( ulLock, [&]() { return m_ui32WorkersRemaining.load() == 0; } );
+	}
+
+	/**
+	 * Runs one band of a stage.
+	 *
+	 * \param _sStage The stage to run.
+	 * \param _stBand The band index.
+	 * \param _stBands The total number of bands.
+	 */
+	void CNtscCrtFastFilter::DoBand( LSN_STAGE _sStage, size_t _stBand, size_t _stBands ) {
+		switch ( _sStage ) {
+			case LSN_S_MODULATE : {
+				// Each band writes and adds noise to only its own lines of the signal.
+				const int iFrom = int( CRT_VRES * _stBand / _stBands );
+				const int iTo = int( CRT_VRES * (_stBand + 1) / _stBands );
+				::crt_nes2ntsc_lines_fast( &m_ncCrtNtsc, &m_nsSettings, iFrom, iTo );
+				::crt_noise_lines_fast( &m_ncCrtNtsc, m_iNoise, iFrom, iTo );
+				break;
+			}
+			case LSN_S_DECODE : {
+				// Bands are whole groups of 16 scanlines so that the vectorized decoder has no leftovers.
+				constexpr size_t stGroups = (CRT_LINES + 15) / 16;
+				const int iFrom = CRT_TOP + int( stGroups * _stBand / _stBands ) * 16;
+				const int iTo = std::min( CRT_TOP + int( stGroups * (_stBand + 1) / _stBands ) * 16, CRT_BOT );
+				::crt_draw_lines_fast( &m_ncCrtNtsc, iFrom, iTo );
+				break;
+			}
+		}
+	}
+
+	/**
+	 * Starts the worker threads.  Does nothing if they are already started.
+	 */
+	void CNtscCrtFastFilter::StartThreads() {
+		if ( m_bThreadsStarted ) { return; }
+
+		const size_t stWorkers = m_stWorkerThreadCount;
+		m_bStopThreads = false;
+		m_ui64JobId = 0;
+		m_ui32WorkersRemaining.store( 0 );
+		m_vThreads.clear();
+
+		if ( stWorkers ) {
+			m_vThreads.reserve( stWorkers );
+			for ( size_t I = 0; I < stWorkers; ++I ) {
+				m_vThreads.emplace_back( &CNtscCrtFastFilter::WorkerThread, this, I + 1 );
+			}
+		}
+
+		m_bThreadsStarted = true;
+	}
+
+	/**
+	 * Stops the worker threads.  Does nothing if they are not started.
+	 */
+	void CNtscCrtFastFilter::StopThreads() {
+		if ( !m_bThreadsStarted ) { return; }
+
+		{
+			std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+			m_bStopThreads = true;
+		}
+		m_cvGo.notify_all();
+
+		for ( auto & T : m_vThreads ) {
+			if ( T.joinable() ) {
+				T.join();
+			}
+		}
+		m_vThreads.clear();
+
+		{
+			std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+			m_bStopThreads = false;
+		}
+		m_ui32WorkersRemaining.store( 0 );
+		m_bThreadsStarted = false;
+	}
+
+	/**
+	 * The worker thread entry point.  Runs the band of the current stage assigned to this worker each time a job is signaled via m_cvGo.
+	 *
+	 * \param _stThreadIdx The worker thread index in the range [1, stThreads - 1].  Index 0 is reserved for the calling thread.
+	 */
+	void CNtscCrtFastFilter::WorkerThread( size_t _stThreadIdx ) {
+		::SetThreadHighPriority();
+
+		uint64_t ui64LastJobId = 0;
+
+		for ( ;; ) {
+			LSN_JOB jJob;
+			{
+				std::unique_lock<std::mutex> ulLock( m_mThreadMutex );
+				m_cvGo.wait( ulLock, [&]() { return m_bStopThreads || m_ui64JobId != ui64LastJobId; } );
+				if ( m_bStopThreads ) { break; }
+
+				ui64LastJobId = m_ui64JobId;
+				jJob = m_jJob;
+			}
+
+			DoBand( jJob.sStage, _stThreadIdx, jJob.stThreads );
+
+			if ( m_ui32WorkersRemaining.fetch_sub( 1 ) == 1 ) {
+				std::lock_guard<std::mutex> lgLock( m_mThreadMutex );
+				m_cvDone.notify_one();
+			}
+		}
+	}
+
+}	// namespace lsn
+
+#undef m_ncCrtNtsc
+#undef m_nsSettings
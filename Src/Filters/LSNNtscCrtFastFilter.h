@@ -0,0 +1,208 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: EMMIR (LMP88959)'s fast integer-only NTSC filter.
+ */
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+#include "LSNFilterBase.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lsn {
+
+	/**
+	 * Class CNtscCrtFastFilter
+	 * \brief EMMIR (LMP88959)'s fast integer-only NTSC filter.
+	 *
+	 * Description: EMMIR (LMP88959)'s fast integer-only NTSC filter.  A lower-cost alternative to CNtscCrtFullFilter with the
+	 *	same controls.  Modulation and decoding are split into bands of scanlines that run on worker threads, with only the
+	 *	sync tracking between them run serially.
+	 */
+	class CNtscCrtFastFilter : public CFilterBase {
+	public :
+		CNtscCrtFastFilter();
+		virtual ~CNtscCrtFastFilter();
+
+
+		// == Functions.
+		/**
+		 * Sets the basic parameters for the filter.
+		 *
+		 * \param _stBuffers The number of render targets to create.
+		 * \param _ui16Width The console screen width.  Typically 256.
+		 * \param _ui16Height The console screen height.  Typically 240.
+		 * \return Returns the input format requested of the PPU.
+		 */
+		virtual CDisplayClient::LSN_PPU_OUT_FORMAT			Init( size_t _stBuffers, uint16_t _ui16Width, uint16_t _ui16Height );
+
+		/**
+		 * Tells the filter that rendering to the source buffer has completed and that it should filter the results.  The final buffer, along with
+		 *	its width, height, bit-depth, and stride, are returned.
+		 *
+		 * \param _pui8Input The buffer to be filtered, which will be a pointer to one of the buffers returned by OutputBuffer() previously.  Its format will be that returned in InputFormat().
+		 * \param _ui32Width On input, this is the width of the buffer in pixels.  On return, it is filled with the final width, in pixels, of the result.
+		 * \param _ui32Height On input, this is the height of the buffer in pixels.  On return, it is filled with the final height, in pixels, of the result.
+		 * \param _ui16BitDepth On input, this is the bit depth of the buffer.  On return, it is filled with the final bit depth of the result.
+		 * \param _ui32Stride On input, this is the stride of the buffer.  On return, it is filled with the final stride, in bytes, of the result.
+		 * \param _ui64PpuFrame The PPU frame associated with the input data.
+		 * \param _ui64RenderStartCycle The cycle at which rendering of the first pixel began.
+		 * \return Returns a pointer to the filtered output buffer.
+		 */
+		virtual uint8_t *									ApplyFilter( uint8_t * _pui8Input, uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &_ui16BitDepth, uint32_t &_ui32Stride, uint64_t _ui64PpuFrame, uint64_t _ui64RenderStartCycle );
+
+		/**
+		 * Gets the PPU output format.
+		 *
+		 * \return Returns the output format from the PPU/input format for this filter.
+		 */
+		virtual CDisplayClient::LSN_PPU_OUT_FORMAT			InputFormat() const { return CDisplayClient::LSN_POF_9BIT_PALETTE; }
+
+		/**
+		 * If true, the PPU is requested to provide a frame that has been flipped vertically.
+		 *
+		 * \return Returns true to receive a vertically flipped image from the PPU, false to receive an unflipped image.
+		 */
+		virtual bool										FlipInput() const { return false; }
+
+		/**
+		 * Gets a pointer to the output buffer.
+		 *
+		 * \return Returns a pointer to the output buffer.
+		 */
+		virtual uint8_t *									OutputBuffer() { return CurTarget(); }
+
+		/**
+		 * Gets the bits-per-pixel of the final output.  Will be 16, 24, or 32.
+		 *
+		 * \return Returns the bits-per-pixel of the final output.
+		 */
+		virtual uint32_t									OutputBits() const { return 32; }
+
+		/**
+		 * The dot-crawl offset changes from frame to frame.  The filter must run even on frames identical to the previous one.
+		 *
+		 * \return Returns true.
+		 */
+		virtual bool										IsTemporal() const { return true; }
+
+		/**
+		 * Called when the filter is about to become active.
+		 */
+		virtual void										Activate();
+
+		/**
+		 * Sets the number of worker threads used by the filter.  Each stage of the frame is split into one band of scanlines per
+		 *	thread, including the calling thread.
+		 *
+		 * \param _stThreads Number of worker threads to use.  0 disables worker threads.
+		 */
+		void												SetWorkerThreadCount( size_t _stThreads );
+
+		/**
+		 * Gets the number of worker threads used by the filter.
+		 *
+		 * \return Returns the total number of worker threads used by the filter.
+		 */
+		inline size_t										WorkerThreadCount() const { return m_stWorkerThreadCount; }
+
+
+	protected :
+		// == Enumerations.
+		/** The parallel stages of a frame. */
+		enum LSN_STAGE : uint32_t {
+			LSN_S_MODULATE,																		/**< Converts the pixels to a signal and adds noise. */
+			LSN_S_DECODE,																		/**< Decodes the signal to the output after the sync has been found. */
+		};
+
+
+		// == Types.
+		/** A work package shared by all threads. */
+		struct LSN_JOB {
+			LSN_STAGE										sStage = LSN_S_MODULATE;							/**< The stage to run. */
+			size_t											stThreads = 1;										/**< Total number of threads for the job, including the calling thread. */
+		};
+
+
+		// == Members.
+		/** The EMMIR (LMP88959) NES NTSC settings. */
+		std::vector<uint8_t>								m_vSettings;
+		/** The CRT structure. */
+		std::vector<uint8_t>								m_vCrtNtsc;
+		/** The filtered output buffer. */
+		std::vector<uint8_t>								m_vFilteredOutput;
+		/** Worker threads. */
+		std::vector<std::thread>							m_vThreads;
+		/** Mutex protecting thread state. */
+		std::mutex											m_mThreadMutex;
+		/** Signal to tell worker threads to start a job. */
+		std::condition_variable								m_cvGo;
+		/** Signal to tell the main thread workers have finished. */
+		std::condition_variable								m_cvDone;
+		/** Number of workers still running the current job. */
+		std::atomic<uint32_t>								m_ui32WorkersRemaining = 0;
+		/** Incremented to start a new job. */
+		uint64_t											m_ui64JobId = 0;
+		/** Total number of worker threads. */
+		size_t												m_stWorkerThreadCount = 3;
+		/** The current job. */
+		LSN_JOB												m_jJob;
+		/** True if the worker threads have been created. */
+		bool												m_bThreadsStarted = false;
+		/** True if worker threads should exit. */
+		bool												m_bStopThreads = false;
+		/** The final stride. */
+		uint32_t											m_ui32FinalStride;
+		/** The final width.  NTSC is CRT_HRES pixels wide. */
+		uint32_t											m_ui32FinalWidth;
+		/** The final height. */
+		uint32_t											m_ui32FinalHeight;
+
+		/** The amount of noise added to the signal. */
+		static constexpr int								m_iNoise = 3;
+
+
+		// == Functions.
+		/**
+		 * Runs a stage over all of its bands, using the worker threads if there are any.
+		 *
+		 * \param _sStage The stage to run.
+		 * \param _bThreaded If false, the whole stage runs on the calling thread.
+		 */
+		void												RunStage( LSN_STAGE _sStage, bool _bThreaded );
+
+		/**
+		 * Runs one band of a stage.
+		 *
+		 * \param _sStage The stage to run.
+		 * \param _stBand The band index.
+		 * \param _stBands The total number of bands.
+		 */
+		void												DoBand( LSN_STAGE _sStage, size_t _stBand, size_t _stBands );
+
+		/**
+		 * Starts the worker threads.  Does nothing if they are already started.
+		 */
+		void												StartThreads();
+
+		/**
+		 * Stops the worker threads.  Does nothing if they are not started.
+		 */
+		void												StopThreads();
+
+		/**
+		 * The worker thread entry point.  Runs the band of the current stage assigned to this worker each time a job is signaled via m_cvGo.
+		 *
+		 * \param _stThreadIdx The worker thread index in the range [1, stThreads - 1].  Index 0 is reserved for the calling thread.
+		 */
+		void												WorkerThread( size_t _stThreadIdx );
+	};
+
+}	// namespace lsn
@@ -97,6 +97,13 @@ namespace lsn {
 		 */
 		virtual uint32_t									OutputBits() const { return 32; }
 
+		/**
+		 * Dot crawl, noise, and phosphor blending change the output from frame to frame.  The filter must run even on frames identical to the previous one.
+		 *
+		 * \return Returns true.
+		 */
+		virtual bool										IsTemporal() const { return true; }
+
 		/**
 		 * Called when the filter is about to become active.
 		 */
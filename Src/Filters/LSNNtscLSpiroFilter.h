@@ -82,6 +82,13 @@ namespace lsn {
 		 */
 		virtual uint32_t									OutputBits() const { return 32; }
 
+		/**
+		 * The subcarrier phase and noise change the output from frame to frame.  The filter must run even on frames identical to the previous one.
+		 *
+		 * \return Returns true.
+		 */
+		virtual bool										IsTemporal() const { return true; }
+
 		/**
 		 * Sets the number of worker threads used by the filter.
 		 *
@@ -53,6 +53,7 @@ namespace lsn {
 
 		m_ui32FinalStride = RowStride( NES_NTSC_OUT_WIDTH( _ui16Width ), OutputBits() );
 		m_vFilteredOutput.resize( m_ui32FinalStride * _ui16Height );
+		m_rcRowCache.Init( _ui16Height );
 
 		return InputFormat();
 	}
@@ -71,10 +72,15 @@ namespace lsn {
 	 * \return Returns a pointer to the filtered output buffer.
 	 */
 	uint8_t * CPalBlarggFilter::ApplyFilter( uint8_t * _pui8Input, uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &/*_ui16BitDepth*/, uint32_t &_ui32Stride, uint64_t /*_ui64PpuFrame*/, uint64_t _ui64RenderStartCycle ) {
-		::nes_ntsc_blit( &m_nnBlarggNtsc,
-			reinterpret_cast<NES_NTSC_IN_T *>(_pui8Input), _ui32Width, _ui64RenderStartCycle & 0b00, 6,
-			_ui32Width, _ui32Height,
-			m_vFilteredOutput.data(), m_ui32FinalStride );
+		// The starting phase never changes, so only the rows that changed since the last frame are redone.
+		int iPhase = int( _ui64RenderStartCycle & 0b00 );
+		m_rcRowCache.Update( 0, m_pui64RowVersions, m_sRowVersions, m_ui64FrameVersion, FlipInput() );
+		for ( const auto & rRun : m_rcRowCache.DirtyRuns() ) {
+			::nes_ntsc_blit( &m_nnBlarggNtsc,
+				reinterpret_cast<NES_NTSC_IN_T *>(_pui8Input) + size_t( rRun.ui32Start ) * _ui32Width, _ui32Width, int( (iPhase + rRun.ui32Start) % 6 ), 6,
+				_ui32Width, rRun.ui32End - rRun.ui32Start,
+				m_vFilteredOutput.data() + size_t( rRun.ui32Start ) * m_ui32FinalStride, m_ui32FinalStride );
+		}
 		_ui32Width = NES_NTSC_OUT_WIDTH( _ui32Width );
 		_ui32Stride = m_ui32FinalStride;
 		/*for ( uint32_t Y = _ui32Height >> 1; Y--; ) {
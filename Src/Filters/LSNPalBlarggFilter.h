@@ -10,6 +10,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNFilterBase.h"
+#include "LSNRowCache.h"
 #include "nes_ntsc/nes_ntsc.h"
 #include <vector>
 
@@ -82,6 +83,11 @@ namespace lsn {
 		 */
 		virtual uint32_t									OutputBits() const { return 32; }
 
+		/**
+		 * Discards the cached output so that the next frame is filtered in full.
+		 */
+		virtual void										Invalidate() { m_rcRowCache.Invalidate(); }
+
 
 	protected :
 		// == Members.
@@ -89,6 +95,8 @@ namespace lsn {
 		nes_ntsc_t											m_nnBlarggNtsc;
 		/** The filtered output buffer. */
 		std::vector<uint8_t>								m_vFilteredOutput;
+		/** Tracks the rows that changed since the last frame was filtered. */
+		CRowCache											m_rcRowCache;
 		/** The final stride. */
 		uint32_t											m_ui32FinalStride;
 	};
@@ -0,0 +1,194 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A CPU post-processing filter that adds phosphor persistence or blends each frame with the previous frame.
+ */
+
+#include "LSNPhosphorPostProcess.h"
+#include "../Utilities/LSNUtilities.h"
+#include "LSNFilterBase.h"
+
+
+namespace lsn {
+
+	CPhosphorPostProcess::CPhosphorPostProcess() :
+		m_bRunThreads( true ) {
+		UpdateDecay();
+	}
+	CPhosphorPostProcess::~CPhosphorPostProcess() {
+		StopThreads();
+	}
+
+
+	// == Functions.
+	/**
+	 * Applies the filter to the given input
+	 *
+	 * \param _ui32ScreenWidth The screen width.
+	 * \param _ui32ScreenHeight The screen height.
+	 * \param _bFlipped Indicates if the image is flipped on input and set to true to indicate that the image is in a flipped state on output.
+	 * \param _ui32Width On input, this is the width of the buffer in pixels.  On return, it is filled with the final width, in pixels, of the result.
+	 * \param _ui32Height On input, this is the height of the buffer in pixels.  On return, it is filled with the final height, in pixels, of the result.
+	 * \param _ui16BitDepth On input, this is the bit depth of the buffer.  On return, it is filled with the final bit depth of the result.
+	 * \param _ui32Stride On input, this is the stride of the buffer.  On return, it is filled with the final stride, in bytes, of the result.
+	 * \param _ui64PpuFrame The PPU frame associated with the input data.
+	 * \param _ui64RenderStartCycle The cycle at which rendering of the first pixel began.
+	 * \return Returns a pointer to the filtered output buffer.
+	 */
+	uint8_t * CPhosphorPostProcess::ApplyFilter( uint8_t * _pui8Input,
+		uint32_t /*_ui32ScreenWidth*/, uint32_t /*_ui32ScreenHeight*/, bool &/*_bFlipped*/,
+		uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &_ui16BitDepth, uint32_t &_ui32Stride, uint64_t _ui64PpuFrame,
+		uint64_t /*_ui64RenderStartCycle*/ ) {
+		if LSN_UNLIKELY( _ui16BitDepth != 32 || !_ui32Width || !_ui32Height ) { return _pui8Input; }
+		uint32_t ui32Stride = CFilterBase::RowStride( _ui32Width, 32 );
+
+		size_t sSize = size_t( ui32Stride ) * _ui32Height;
+		size_t sAccumSize = size_t( _ui32Width ) * 4 * _ui32Height;
+		try {
+			if LSN_UNLIKELY( m_vFinalBuffer.size() != sSize || m_vAccum.size() != sAccumSize ) {
+				m_vFinalBuffer = std::vector<uint8_t>();
+				m_vFinalBuffer.resize( sSize );
+				m_vAccum = std::vector<uint16_t>();
+				m_vAccum.resize( sAccumSize );
+				m_bReset = true;
+			}
+		}
+		catch ( ... ) {
+			m_vFinalBuffer = std::vector<uint8_t>();
+			m_vAccum = std::vector<uint16_t>();
+			return _pui8Input;
+		}
+
+		// A frame that is rendered again (for example while paused) has already been blended into the history.
+		if ( !m_bReset && _ui64PpuFrame == m_ui64LastFrame ) {
+			_ui32Stride = ui32Stride;
+			return m_vFinalBuffer.data();
+		}
+		m_ui64LastFrame = _ui64PpuFrame;
+
+		m_jJob.pui8Src = _pui8Input;
+		m_jJob.ui32SrcStride = _ui32Stride;
+		m_jJob.ui32DstStride = ui32Stride;
+		m_jJob.ui32RowSize = _ui32Width * 4;
+		m_jJob.bReset = m_bReset;
+		RunRows( _ui32Height, size_t( _ui32Width ) * _ui32Height >= LSN_PHOSPHOR_PARALLEL_MIN );
+		m_bReset = false;
+
+		_ui32Stride = ui32Stride;
+		return m_vFinalBuffer.data();
+	}
+
+	/**
+	 * Converts the decay settings to the fixed-point values used by the row kernels.
+	 */
+	void CPhosphorPostProcess::UpdateDecay() {
+		double dDecay = CUtilities::DecayMultiplier( m_fInitPhosphorDecay, 0.001, m_fPhosphorDecayTime, m_fFps );
+		m_ui16Decay = uint16_t( std::clamp( dDecay * 65536.0, 0.0, 65535.0 ) );
+		m_ui16Level = uint16_t( std::clamp( double( m_fInitPhosphorDecay ) * 65536.0, 0.0, 65535.0 ) );
+	}
+
+	/**
+	 * Runs the current job over a number of rows, split into bands across the worker threads.
+	 *
+	 * \param _ui32Rows The number of rows.
+	 * \param _bParallel If true, the rows are split across the worker threads.
+	 */
+	void CPhosphorPostProcess::RunRows( uint32_t _ui32Rows, bool _bParallel ) {
+		if ( _bParallel ) { StartThreads(); }
+		if ( !_bParallel || m_vWorkers.empty() ) {
+			RunBand( 0, _ui32Rows );
+			return;
+		}
+
+		uint32_t ui32Bands = uint32_t( m_vWorkers.size() + 1 );
+		uint32_t ui32BandSize = (_ui32Rows + ui32Bands - 1) / ui32Bands;
+		for ( size_t I = 0; I < m_vWorkers.size(); ++I ) {
+			m_vWorkers[I]->ui32Start = std::min( _ui32Rows, uint32_t( I + 1 ) * ui32BandSize );
+			m_vWorkers[I]->ui32End = std::min( _ui32Rows, uint32_t( I + 2 ) * ui32BandSize );
+			m_vWorkers[I]->eGo.Signal();
+		}
+		RunBand( 0, std::min( _ui32Rows, ui32BandSize ) );
+		for ( size_t I = 0; I < m_vWorkers.size(); ++I ) {
+			m_vWorkers[I]->eDone.WaitForSignal();
+		}
+	}
+
+	/**
+	 * Runs the current job over a band of rows.
+	 *
+	 * \param _ui32Start The first row.
+	 * \param _ui32End One past the last row.
+	 */
+	void CPhosphorPostProcess::RunBand( uint32_t _ui32Start, uint32_t _ui32End ) {
+		const LSN_JOB & jJob = m_jJob;
+		const CFilterKernels::LSN_KERNELS & kKernels = CFilterKernels::Kernels();
+		for ( uint32_t Y = _ui32Start; Y < _ui32End; ++Y ) {
+			const uint8_t * pui8Src = jJob.pui8Src + size_t( Y ) * jJob.ui32SrcStride;
+			uint8_t * pui8Dst = m_vFinalBuffer.data() + size_t( Y ) * jJob.ui32DstStride;
+			uint16_t * pui16Accum = m_vAccum.data() + size_t( Y ) * jJob.ui32RowSize;
+			if LSN_UNLIKELY( jJob.bReset ) {
+				std::memcpy( pui8Dst, pui8Src, jJob.ui32RowSize );
+				for ( uint32_t X = 0; X < jJob.ui32RowSize; ++X ) {
+					pui16Accum[X] = uint16_t( pui8Src[X] << 8 );
+				}
+			}
+			else if ( m_mMode == LSN_M_FRAME_BLEND ) {
+				kKernels.pfFrameBlendRow( pui8Src, pui16Accum, pui8Dst, jJob.ui32RowSize );
+			}
+			else {
+				kKernels.pfPhosphorRow( pui8Src, pui16Accum, pui8Dst, jJob.ui32RowSize, m_ui16Decay, m_ui16Level );
+			}
+		}
+	}
+
+	/**
+	 * Creates the worker threads if they do not exist.
+	 */
+	void CPhosphorPostProcess::StartThreads() {
+		if LSN_LIKELY( !m_vWorkers.empty() ) { return; }
+		uint32_t ui32Threads = std::min<uint32_t>( std::thread::hardware_concurrency(), LSN_PHOSPHOR_MAX_THREADS );
+		try {
+			for ( uint32_t I = 1; I < ui32Threads; ++I ) {
+				m_vWorkers.push_back( std::make_unique<LSN_WORKER>() );
+				m_vWorkers.back()->ptThread = std::make_unique<std::thread>( WorkerThread, this, m_vWorkers.back().get() );
+			}
+		}
+		catch ( ... ) {
+			// Run with however many threads were created.
+			if ( !m_vWorkers.empty() && !m_vWorkers.back()->ptThread.get() ) { m_vWorkers.pop_back(); }
+		}
+	}
+
+	/**
+	 * Stops the worker threads.
+	 */
+	void CPhosphorPostProcess::StopThreads() {
+		m_bRunThreads = false;
+		for ( size_t I = 0; I < m_vWorkers.size(); ++I ) {
+			m_vWorkers[I]->eGo.Signal();
+			m_vWorkers[I]->eDone.WaitForSignal();
+			m_vWorkers[I]->ptThread->join();
+		}
+		m_vWorkers.clear();
+		m_bRunThreads = true;
+	}
+
+	/**
+	 * A worker thread.
+	 *
+	 * \param _pppThis Pointer to this object.
+	 * \param _pwWorker The worker data for this thread.
+	 */
+	void CPhosphorPostProcess::WorkerThread( CPhosphorPostProcess * _pppThis, LSN_WORKER * _pwWorker ) {
+		while ( _pppThis->m_bRunThreads ) {
+			_pwWorker->eGo.WaitForSignal();
+			if ( _pppThis->m_bRunThreads ) {
+				_pppThis->RunBand( _pwWorker->ui32Start, _pwWorker->ui32End );
+			}
+			_pwWorker->eDone.Signal();
+		}
+	}
+
+}	// namespace lsn
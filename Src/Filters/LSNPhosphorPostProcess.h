@@ -0,0 +1,225 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A CPU post-processing filter that adds phosphor persistence or blends each frame with the previous frame.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+#include "../Event/LSNEvent.h"
+#include "LSNFilterKernels.h"
+#include "LSNPostProcessBase.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+#ifndef LSN_PHOSPHOR_MAX_THREADS
+/** The maximum number of threads (including the calling thread) among which CPhosphorPostProcess splits its row bands. */
+#define LSN_PHOSPHOR_MAX_THREADS				4
+#endif	// #ifndef LSN_PHOSPHOR_MAX_THREADS
+
+#ifndef LSN_PHOSPHOR_PARALLEL_MIN
+/** The number of pixels a frame must have before it is split across threads. */
+#define LSN_PHOSPHOR_PARALLEL_MIN				(1 << 17)
+#endif	// #ifndef LSN_PHOSPHOR_PARALLEL_MIN
+
+
+namespace lsn {
+
+	/**
+	 * Class CPhosphorPostProcess
+	 * \brief A CPU post-processing filter that adds phosphor persistence or blends each frame with the previous frame.
+	 *
+	 * Description: A CPU post-processing filter that adds phosphor persistence or blends each frame with the previous frame.  Each
+	 *	channel keeps an exponentially decayed level in 8.8 fixed point, which is updated by the vectorized CFilterKernels row kernels,
+	 *	and frames large enough to benefit are split into row bands that run on persistent worker threads.
+	 *	The frame-blend mode averages each frame with the one before it, which steadies games that flicker sprites on alternate frames.
+	 */
+	class CPhosphorPostProcess : public CPostProcessBase {
+	public :
+		CPhosphorPostProcess();
+		virtual ~CPhosphorPostProcess();
+
+
+		// == Enumerations.
+		/** The blending modes. */
+		enum LSN_MODE {
+			LSN_M_PHOSPHOR,									/**< Each channel fades out over the decay period. */
+			LSN_M_FRAME_BLEND,								/**< Each frame is averaged with the previous frame. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Applies the filter to the given input
+		 *
+		 * \param _ui32ScreenWidth The screen width.
+		 * \param _ui32ScreenHeight The screen height.
+		 * \param _bFlipped Indicates if the image is flipped on input and set to true to indicate that the image is in a flipped state on output.
+		 * \param _ui32Width On input, this is the width of the buffer in pixels.  On return, it is filled with the final width, in pixels, of the result.
+		 * \param _ui32Height On input, this is the height of the buffer in pixels.  On return, it is filled with the final height, in pixels, of the result.
+		 * \param _ui16BitDepth On input, this is the bit depth of the buffer.  On return, it is filled with the final bit depth of the result.
+		 * \param _ui32Stride On input, this is the stride of the buffer.  On return, it is filled with the final stride, in bytes, of the result.
+		 * \param _ui64PpuFrame The PPU frame associated with the input data.
+		 * \param _ui64RenderStartCycle The cycle at which rendering of the first pixel began.
+		 * \return Returns a pointer to the filtered output buffer.
+		 */
+		virtual uint8_t *									ApplyFilter( uint8_t * _pui8Input,
+			uint32_t /*_ui32ScreenWidth*/, uint32_t /*_ui32ScreenHeight*/, bool &/*_bFlipped*/,
+			uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &_ui16BitDepth, uint32_t &_ui32Stride, uint64_t _ui64PpuFrame,
+			uint64_t /*_ui64RenderStartCycle*/ );
+
+		/**
+		 * The history decays on every frame, so the post-process must run even on frames identical to the previous one.
+		 *
+		 * \return Returns true.
+		 */
+		virtual bool										IsTemporal() const { return true; }
+
+		/**
+		 * Sets the blending mode.  The next frame starts over with no history.
+		 *
+		 * \param _mMode The mode to set.
+		 */
+		inline void											SetMode( LSN_MODE _mMode ) {
+			if ( _mMode != m_mMode ) {
+				m_mMode = _mMode;
+				m_bReset = true;
+			}
+		}
+
+		/**
+		 * Gets the blending mode.
+		 *
+		 * \return Returns the blending mode.
+		 */
+		inline LSN_MODE										GetMode() const { return m_mMode; }
+
+		/**
+		 * Sets the phosphor decay time.
+		 *
+		 * \param _fTime The time it takes the phosphors to decay to 0.001.
+		 */
+		inline void											SetPhosphorDecayPeriod( float _fTime = 1.79113161563873291015625f ) {
+			m_fPhosphorDecayTime = _fTime;
+			UpdateDecay();
+		}
+
+		/**
+		 * Sets the initial phosphor decay level.
+		 *
+		 * \param _fLevel The strength of the phosphor decay.
+		 */
+		inline void											SetPhosphorDecayLevel( float _fLevel = 0.25f ) {
+			m_fInitPhosphorDecay = _fLevel;
+			UpdateDecay();
+		}
+
+		/**
+		 * Sets the FPS of the hardware.
+		 *
+		 * \param _fFps The FPS to set.
+		 */
+		inline void											SetFps( float _fFps = 60.098812103271484375f ) {
+			m_fFps = _fFps;
+			UpdateDecay();
+		}
+
+
+	protected :
+		// == Types.
+		/** A worker thread and its row band. */
+		struct LSN_WORKER {
+			std::unique_ptr<std::thread>					ptThread;										/**< The thread. */
+			CEvent											eGo;											/**< Signals the thread to run its band. */
+			CEvent											eDone;											/**< Signaled when the band is done. */
+			uint32_t										ui32Start = 0;									/**< The first row of the band. */
+			uint32_t										ui32End = 0;									/**< One past the last row of the band. */
+		};
+
+		/** The frame being blended. */
+		struct LSN_JOB {
+			const uint8_t *									pui8Src = nullptr;								/**< The source image. */
+			uint32_t										ui32SrcStride = 0;								/**< The source stride in bytes. */
+			uint32_t										ui32DstStride = 0;								/**< The destination stride in bytes. */
+			uint32_t										ui32RowSize = 0;								/**< The channels in each row. */
+			bool											bReset = false;									/**< If true, the history is replaced by the source. */
+		};
+
+
+		// == Members.
+		/** The 8.8 fixed-point level of each channel (4 per pixel, with no row padding). */
+		std::vector<uint16_t>								m_vAccum;
+		/** The worker threads. */
+		std::vector<std::unique_ptr<LSN_WORKER>>			m_vWorkers;
+		/** Boolean to stop all threads. */
+		std::atomic<bool>									m_bRunThreads;
+		/** The frame being blended. */
+		LSN_JOB												m_jJob;
+		/** The PPU frame last blended. */
+		uint64_t											m_ui64LastFrame = 0;
+		/** The blending mode. */
+		LSN_MODE											m_mMode = LSN_M_PHOSPHOR;
+		/** Initial phosphor decay. */
+		float												m_fInitPhosphorDecay = 0.25f;
+		/** The time it takes for the phosphors to decay to 0.001. */
+		float												m_fPhosphorDecayTime = 1.79113161563873291015625f;
+		/** The FPS of the hardware. */
+		float												m_fFps = 60.098812103271484375f;
+		/** The 0.16 fixed-point per-frame decay multiplier. */
+		uint16_t											m_ui16Decay = 0;
+		/** The 0.16 fixed-point initial decay level. */
+		uint16_t											m_ui16Level = 0;
+		/** If true, the next frame replaces the history instead of blending with it. */
+		bool												m_bReset = true;
+
+
+		// == Functions.
+		/**
+		 * Converts the decay settings to the fixed-point values used by the row kernels.
+		 */
+		void												UpdateDecay();
+
+		/**
+		 * Runs the current job over a number of rows, split into bands across the worker threads.
+		 *
+		 * \param _ui32Rows The number of rows.
+		 * \param _bParallel If true, the rows are split across the worker threads.
+		 */
+		void												RunRows( uint32_t _ui32Rows, bool _bParallel );
+
+		/**
+		 * Runs the current job over a band of rows.
+		 *
+		 * \param _ui32Start The first row.
+		 * \param _ui32End One past the last row.
+		 */
+		void												RunBand( uint32_t _ui32Start, uint32_t _ui32End );
+
+		/**
+		 * Creates the worker threads if they do not exist.
+		 */
+		void												StartThreads();
+
+		/**
+		 * Stops the worker threads.
+		 */
+		void												StopThreads();
+
+		/**
+		 * A worker thread.
+		 *
+		 * \param _pppThis Pointer to this object.
+		 * \param _pwWorker The worker data for this thread.
+		 */
+		static void											WorkerThread( CPhosphorPostProcess * _pppThis, LSN_WORKER * _pwWorker );
+	};
+
+}	// namespace lsn
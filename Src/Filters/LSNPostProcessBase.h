@@ -36,6 +36,8 @@ namespace lsn {
 			LSN_PP_BLEED,									/**< Bleed post-processing. */
 			LSN_PP_BILINEAR,								/**< Bilinear scaling. */
 			LSN_PP_SRGB,									/**< linear -> sRGB. */
+			LSN_PP_RESAMPLE,								/**< Kernel-based scaling (Lanczos, Mitchell, etc.). */
+			LSN_PP_PHOSPHOR,								/**< Phosphor persistence or frame blending. */
 
 			LSN_PP_TOTAL,									/**< The total number of filters.  Must be last. */
 		};
@@ -61,6 +63,13 @@ namespace lsn {
 			uint32_t &/*_ui32Width*/, uint32_t &/*_ui32Height*/, uint16_t &/*_ui16BitDepth*/, uint32_t &/*_ui32Stride*/, uint64_t /*_ui64PpuFrame*/,
 			uint64_t /*_ui64RenderStartCycle*/ ) { return _pui8Input; }
 
+		/**
+		 * If true, the post-process's output can change even when its input does not, so it must run on every frame.
+		 *
+		 * \return Returns false.
+		 */
+		virtual bool										IsTemporal() const { return false; }
+
 
 	protected :
 		// == Members.
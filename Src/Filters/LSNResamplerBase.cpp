@@ -36,8 +36,8 @@ namespace lsn {
 		{ CResamplerBase::RobidouxSoftFilterFunc,			2.0f,		L"Robidoux Soft" },
 		{ CResamplerBase::CatmullRomFilterFunc,				2.0f,		L"Catmull-Rom" },
 		{ CResamplerBase::BSplineFilterFunc,				2.0f,		L"B-Spline" },
-		{ CResamplerBase::AdobeBicubicFilterFunc,			2.0f,		L"Adobe Cubic" },
-		{ CResamplerBase::CardinalSplineUniformFilterFunc,	2.0f,		L"L. Spiro/Adobe Cubic Sharp" },
+		{ CResamplerBase::AdobeBicubicFilterFunc,			2.0f,		L"Adobe\u00AE Cubic" },
+		{ CResamplerBase::CardinalSplineUniformFilterFunc,	2.0f,		L"L. Spiro/Adobe\u00AE Cubic Sharp" },
 		{ CResamplerBase::HermiteFilterFunc,				1.0f,		L"Hermite" },
 		{ CResamplerBase::HammingFilterFunc,				1.0f,		L"Hamming" },
 		{ CResamplerBase::HanningFilterFunc,				1.0f,		L"Hanning" },
@@ -0,0 +1,362 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A CPU post-processing filter that scales the image with any of the CResamplerBase kernels.
+ */
+
+#include "LSNResamplerPostProcess.h"
+#include "../Utilities/LSNUtilities.h"
+#include "LSNFilterBase.h"
+
+
+namespace lsn {
+
+	/**
+	 * Converts a filtered channel value back to 8 bits, rounding and clamping away any ringing.
+	 *
+	 * \param _fVal The value to convert.
+	 * \return Returns the value clamped to [0,255] and rounded.
+	 */
+	static inline uint8_t									ToChannel( float _fVal ) {
+		if ( _fVal <= 0.0f ) { return 0; }
+		if ( _fVal >= 255.0f ) { return 255; }
+		return uint8_t( _fVal + 0.5f );
+	}
+
+	CResamplerPostProcess::CResamplerPostProcess() :
+		m_bRunThreads( true ) {
+	}
+	CResamplerPostProcess::~CResamplerPostProcess() {
+		StopThreads();
+	}
+
+
+	// == Functions.
+	/**
+	 * Applies the filter to the given input
+	 *
+	 * \param _ui32ScreenWidth The screen width.
+	 * \param _ui32ScreenHeight The screen height.
+	 * \param _bFlipped Indicates if the image is flipped on input and set to true to indicate that the image is in a flipped state on output.
+	 * \param _ui32Width On input, this is the width of the buffer in pixels.  On return, it is filled with the final width, in pixels, of the result.
+	 * \param _ui32Height On input, this is the height of the buffer in pixels.  On return, it is filled with the final height, in pixels, of the result.
+	 * \param _ui16BitDepth On input, this is the bit depth of the buffer.  On return, it is filled with the final bit depth of the result.
+	 * \param _ui32Stride On input, this is the stride of the buffer.  On return, it is filled with the final stride, in bytes, of the result.
+	 * \param _ui64PpuFrame The PPU frame associated with the input data.
+	 * \param _ui64RenderStartCycle The cycle at which rendering of the first pixel began.
+	 * \return Returns a pointer to the filtered output buffer.
+	 */
+	uint8_t * CResamplerPostProcess::ApplyFilter( uint8_t * _pui8Input,
+		uint32_t _ui32ScreenWidth, uint32_t _ui32ScreenHeight, bool &/*_bFlipped*/,
+		uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &/*_ui16BitDepth*/, uint32_t &_ui32Stride, uint64_t /*_ui64PpuFrame*/,
+		uint64_t /*_ui64RenderStartCycle*/ ) {
+		uint32_t ui32Stride = CFilterBase::RowStride( _ui32ScreenWidth, 32 );
+
+		if LSN_UNLIKELY( _ui32ScreenWidth == _ui32Width && _ui32ScreenHeight == _ui32Height && ui32Stride == _ui32Stride ) {
+			// Pass-through.
+			return _pui8Input;
+		}
+		if LSN_UNLIKELY( !_ui32ScreenWidth || !_ui32ScreenHeight || !_ui32Width || !_ui32Height ) { return _pui8Input; }
+
+		size_t sSize = size_t( ui32Stride ) * _ui32ScreenHeight;
+		try {
+			if LSN_UNLIKELY( m_vFinalBuffer.size() != sSize ) {
+				m_vFinalBuffer = std::vector<uint8_t>();
+				m_vFinalBuffer.resize( sSize );
+			}
+		}
+		catch ( ... ) { return _pui8Input; }
+
+		if ( !Resample( _pui8Input, _ui32Width, _ui32Height, _ui32Stride,
+			m_vFinalBuffer.data(), _ui32ScreenWidth, _ui32ScreenHeight, ui32Stride ) ) { return _pui8Input; }
+
+		_ui32Width = _ui32ScreenWidth;
+		_ui32Height = _ui32ScreenHeight;
+		_ui32Stride = ui32Stride;
+		return m_vFinalBuffer.data();
+	}
+
+	/**
+	 * Scales a 32-bit image.  Can be used directly (without ApplyFilter()) for headless captures and for comparing against GPU
+	 *	output.
+	 *
+	 * \param _pui8Src The source image.
+	 * \param _ui32SrcW The source width in pixels.
+	 * \param _ui32SrcH The source height in pixels.
+	 * \param _ui32SrcStride The source stride in bytes.
+	 * \param _pui8Dst The destination image.
+	 * \param _ui32DstW The destination width in pixels.
+	 * \param _ui32DstH The destination height in pixels.
+	 * \param _ui32DstStride The destination stride in bytes.
+	 * \return Returns true if all allocations succeeded.
+	 */
+	bool CResamplerPostProcess::Resample( const uint8_t * _pui8Src, uint32_t _ui32SrcW, uint32_t _ui32SrcH, uint32_t _ui32SrcStride,
+		uint8_t * _pui8Dst, uint32_t _ui32DstW, uint32_t _ui32DstH, uint32_t _ui32DstStride ) {
+		// Flushed before either list is fetched so that the returned pointers remain valid.
+		if LSN_UNLIKELY( m_mAxisCache.size() > LSN_AXIS_CACHE_SIZE ) { m_mAxisCache.clear(); }
+		const LSN_AXIS * paX = Axis( _ui32SrcW, _ui32DstW );
+		const LSN_AXIS * paY = Axis( _ui32SrcH, _ui32DstH );
+		if LSN_UNLIKELY( !paX || !paY ) { return false; }
+
+		// Rows are padded to 64 bytes.
+		size_t sTmpStride = (size_t( _ui32DstW ) * 4 + 15) & ~size_t( 15 );
+		try {
+			if LSN_UNLIKELY( m_vTmp.size() < sTmpStride * _ui32SrcH ) {
+				m_vTmp.resize( sTmpStride * _ui32SrcH );
+			}
+		}
+		catch ( ... ) { return false; }
+
+		m_jJob.pui8Src = _pui8Src;
+		m_jJob.ui32SrcStride = _ui32SrcStride;
+		m_jJob.pui8Dst = _pui8Dst;
+		m_jJob.ui32DstStride = _ui32DstStride;
+		m_jJob.ui32DstW = _ui32DstW;
+		m_jJob.sTmpStride = sTmpStride;
+		m_jJob.paX = paX;
+		m_jJob.paY = paY;
+
+		// Each pass must finish before the next begins, since the vertical taps of a row band reach into other bands.
+		m_jJob.pPass = LSN_P_HORIZONTAL;
+		RunPass( _ui32SrcH, size_t( _ui32SrcH ) * _ui32DstW >= LSN_RESAMPLER_PARALLEL_MIN );
+		m_jJob.pPass = LSN_P_VERTICAL;
+		RunPass( _ui32DstH, size_t( _ui32DstH ) * _ui32DstW >= LSN_RESAMPLER_PARALLEL_MIN );
+		return true;
+	}
+
+	/**
+	 * Gets the flattened contribution list for a given source and destination size, creating it if needed.
+	 *
+	 * \param _ui32SrcSize The source size.
+	 * \param _ui32DstSize The destination size.
+	 * \return Returns the contribution list or nullptr if it could not be created.
+	 */
+	const CResamplerPostProcess::LSN_AXIS * CResamplerPostProcess::Axis( uint32_t _ui32SrcSize, uint32_t _ui32DstSize ) {
+		uint64_t ui64Key = (uint64_t( _ui32SrcSize ) << 32) | _ui32DstSize;
+		auto aFound = m_mAxisCache.find( ui64Key );
+		if LSN_LIKELY( aFound != m_mAxisCache.end() ) { return &aFound->second; }
+
+		if ( !CreateContribList( _ui32SrcSize, _ui32DstSize, LSN_TA_CLAMP, CResamplerBase::m_fFilter[m_ffFilter].pfFunc, CResamplerBase::m_fFilter[m_ffFilter].fSupport, 1.0f ) ) { return nullptr; }
+
+		try {
+			LSN_AXIS aAxis;
+			uint32_t ui32Taps = 0;
+			for ( size_t I = 0; I < m_cContribs.size(); ++I ) {
+				ui32Taps = std::max( ui32Taps, static_cast<uint32_t>(m_cContribs[I].fContributions.size()) );
+			}
+			// The SIMD loops take 4 taps at a time.  Padding taps have a weight of 0 and read texel 0.
+			ui32Taps = (ui32Taps + 3) & ~3U;
+			aAxis.ui32Taps = ui32Taps;
+			aAxis.vWeights.resize( size_t( _ui32DstSize ) * ui32Taps * 4 );
+			aAxis.vIndices.resize( size_t( _ui32DstSize ) * ui32Taps );
+			for ( uint32_t I = 0; I < _ui32DstSize; ++I ) {
+				const LSN_CONTRIBUTIONS & cContrib = m_cContribs[I];
+				for ( size_t J = 0; J < cContrib.fContributions.size(); ++J ) {
+					int32_t i32Idx = cContrib.i32Indices[J];
+					if ( i32Idx < 0 || uint32_t( i32Idx ) >= _ui32SrcSize ) { continue; }
+					size_t sDst = size_t( I ) * ui32Taps + J;
+					aAxis.vIndices[sDst] = i32Idx;
+					for ( size_t K = 0; K < 4; ++K ) {
+						aAxis.vWeights[sDst*4+K] = cContrib.fContributions[J];
+					}
+				}
+			}
+			return &(m_mAxisCache[ui64Key] = std::move( aAxis ));
+		}
+		catch ( ... ) { return nullptr; }
+	}
+
+	/**
+	 * Runs the current job over a number of rows, split into bands across the worker threads.
+	 *
+	 * \param _ui32Rows The number of rows.
+	 * \param _bParallel If true, the rows are split across the worker threads.
+	 */
+	void CResamplerPostProcess::RunPass( uint32_t _ui32Rows, bool _bParallel ) {
+		if ( _bParallel ) { StartThreads(); }
+		if ( !_bParallel || m_vWorkers.empty() ) {
+			RunBand( 0, _ui32Rows );
+			return;
+		}
+
+		uint32_t ui32Bands = uint32_t( m_vWorkers.size() + 1 );
+		uint32_t ui32BandSize = (_ui32Rows + ui32Bands - 1) / ui32Bands;
+		for ( size_t I = 0; I < m_vWorkers.size(); ++I ) {
+			m_vWorkers[I]->ui32Start = std::min( _ui32Rows, uint32_t( I + 1 ) * ui32BandSize );
+			m_vWorkers[I]->ui32End = std::min( _ui32Rows, uint32_t( I + 2 ) * ui32BandSize );
+			m_vWorkers[I]->eGo.Signal();
+		}
+		RunBand( 0, std::min( _ui32Rows, ui32BandSize ) );
+		for ( size_t I = 0; I < m_vWorkers.size(); ++I ) {
+			m_vWorkers[I]->eDone.WaitForSignal();
+		}
+	}
+
+	/**
+	 * Runs the current job over a band of rows.
+	 *
+	 * \param _ui32Start The first row.
+	 * \param _ui32End One past the last row.
+	 */
+	void CResamplerPostProcess::RunBand( uint32_t _ui32Start, uint32_t _ui32End ) {
+		const LSN_JOB & jJob = m_jJob;
+		float * pfTmp = m_vTmp.data();
+		if ( jJob.pPass == LSN_P_HORIZONTAL ) {
+			PfHorizontalRow pfFunc = RowKernels().pfHorizontalRow;
+			for ( uint32_t Y = _ui32Start; Y < _ui32End; ++Y ) {
+				pfFunc( jJob.pui8Src + size_t( Y ) * jJob.ui32SrcStride, pfTmp + Y * jJob.sTmpStride, (*jJob.paX), jJob.ui32DstW );
+			}
+		}
+		else {
+			PfVerticalRow pfFunc = RowKernels().pfVerticalRow;
+			for ( uint32_t Y = _ui32Start; Y < _ui32End; ++Y ) {
+				pfFunc( pfTmp, jJob.sTmpStride, (*jJob.paY), Y, jJob.pui8Dst + size_t( Y ) * jJob.ui32DstStride, jJob.ui32DstW );
+			}
+		}
+	}
+
+	/**
+	 * Creates the worker threads if they do not exist.
+	 */
+	void CResamplerPostProcess::StartThreads() {
+		if LSN_LIKELY( !m_vWorkers.empty() ) { return; }
+		uint32_t ui32Threads = std::min<uint32_t>( std::thread::hardware_concurrency(), LSN_RESAMPLER_MAX_THREADS );
+		try {
+			for ( uint32_t I = 1; I < ui32Threads; ++I ) {
+				m_vWorkers.push_back( std::make_unique<LSN_WORKER>() );
+				m_vWorkers.back()->ptThread = std::make_unique<std::thread>( WorkerThread, this, m_vWorkers.back().get() );
+			}
+		}
+		catch ( ... ) {
+			// Run with however many threads were created.
+			if ( !m_vWorkers.empty() && !m_vWorkers.back()->ptThread.get() ) { m_vWorkers.pop_back(); }
+		}
+	}
+
+	/**
+	 * Stops the worker threads.
+	 */
+	void CResamplerPostProcess::StopThreads() {
+		m_bRunThreads = false;
+		for ( size_t I = 0; I < m_vWorkers.size(); ++I ) {
+			m_vWorkers[I]->eGo.Signal();
+			m_vWorkers[I]->eDone.WaitForSignal();
+			m_vWorkers[I]->ptThread->join();
+		}
+		m_vWorkers.clear();
+		m_bRunThreads = true;
+	}
+
+	/**
+	 * A worker thread.
+	 *
+	 * \param _prppThis Pointer to this object.
+	 * \param _pwWorker The worker data for this thread.
+	 */
+	void CResamplerPostProcess::WorkerThread( CResamplerPostProcess * _prppThis, LSN_WORKER * _pwWorker ) {
+		while ( _prppThis->m_bRunThreads ) {
+			_pwWorker->eGo.WaitForSignal();
+			if ( _prppThis->m_bRunThreads ) {
+				_prppThis->RunBand( _pwWorker->ui32Start, _pwWorker->ui32End );
+			}
+			_pwWorker->eDone.Signal();
+		}
+	}
+
+	/**
+	 * Gets the row-kernel table for the current processor.  Selected on the first call.
+	 *
+	 * \return Returns the row-kernel table for the current processor.
+	 */
+	const CResamplerPostProcess::LSN_ROW_KERNELS & CResamplerPostProcess::RowKernels() {
+		static const LSN_ROW_KERNELS rkTable = SelectRowKernels();
+		return rkTable;
+	}
+
+	/**
+	 * Selects the row-kernel table for the current processor.
+	 *
+	 * \return Returns the row-kernel table for the current processor.
+	 */
+	CResamplerPostProcess::LSN_ROW_KERNELS CResamplerPostProcess::SelectRowKernels() {
+#ifdef LSN_FILTER_KERNELS_X86
+		if ( CUtilities::IsAvx512FSupported() && CUtilities::IsAvx512BWSupported() && CUtilities::IsAvx2Supported() && CUtilities::IsFmaSupported() ) {
+			return { HorizontalRow_AVX512, VerticalRow_AVX512 };
+		}
+		if ( CUtilities::IsAvx2Supported() && CUtilities::IsFmaSupported() ) {
+			return { HorizontalRow_AVX2, VerticalRow_AVX2 };
+		}
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
+		return { HorizontalRow, VerticalRow };
+	}
+
+	/**
+	 * Scales a row horizontally.
+	 *
+	 * \param _pui8Src The source row.
+	 * \param _pfDst The destination row (4 floats per pixel).
+	 * \param _aAxis The horizontal contributions.
+	 * \param _ui32DstW The destination width.
+	 */
+	void CResamplerPostProcess::HorizontalRow( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW ) {
+		const uint32_t ui32Taps = _aAxis.ui32Taps;
+		const int32_t * pi32Indices = _aAxis.vIndices.data();
+		const float * pfWeights = _aAxis.vWeights.data();
+		for ( uint32_t X = 0; X < _ui32DstW; ++X ) {
+			float fSum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for ( uint32_t T = 0; T < ui32Taps; ++T ) {
+				const uint8_t * pui8Texel = _pui8Src + pi32Indices[T] * 4;
+				float fW = pfWeights[T*4];
+				fSum[0] += pui8Texel[0] * fW;
+				fSum[1] += pui8Texel[1] * fW;
+				fSum[2] += pui8Texel[2] * fW;
+				fSum[3] += pui8Texel[3] * fW;
+			}
+			std::memcpy( _pfDst + X * 4, fSum, sizeof( fSum ) );
+			pi32Indices += ui32Taps;
+			pfWeights += ui32Taps * 4;
+		}
+	}
+
+	/**
+	 * Scales a row vertically.
+	 *
+	 * \param _pfTmp The horizontally scaled rows.
+	 * \param _sTmpStride The stride of _pfTmp in floats.
+	 * \param _aAxis The vertical contributions.
+	 * \param _ui32Y The destination row.
+	 * \param _pui8Dst The destination row.
+	 * \param _ui32DstW The destination width.
+	 */
+	void CResamplerPostProcess::VerticalRow( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+		uint8_t * _pui8Dst, uint32_t _ui32DstW ) {
+		VerticalPixels( _pfTmp, _sTmpStride, _aAxis.vIndices.data() + size_t( _ui32Y ) * _aAxis.ui32Taps, _aAxis.vWeights.data() + size_t( _ui32Y ) * _aAxis.ui32Taps * 4,
+			_aAxis.ui32Taps, 0, _ui32DstW, _pui8Dst );
+	}
+
+	/**
+	 * Scales a range of pixels vertically.  Used by every version for the pixels that do not fill a vector.
+	 *
+	 * \param _pfTmp The horizontally scaled rows.
+	 * \param _sTmpStride The stride of _pfTmp in floats.
+	 * \param _pi32Indices The tap row indices.
+	 * \param _pfWeights The tap weights, each repeated 4 times.
+	 * \param _ui32Taps The number of taps.
+	 * \param _ui32Start The first pixel.
+	 * \param _ui32End One past the last pixel.
+	 * \param _pui8Dst The destination row.
+	 */
+	void CResamplerPostProcess::VerticalPixels( const float * _pfTmp, size_t _sTmpStride, const int32_t * _pi32Indices, const float * _pfWeights,
+		uint32_t _ui32Taps, uint32_t _ui32Start, uint32_t _ui32End, uint8_t * _pui8Dst ) {
+		for ( uint32_t X = _ui32Start * 4; X < _ui32End * 4; ++X ) {
+			float fSum = 0.0f;
+			for ( uint32_t T = 0; T < _ui32Taps; ++T ) {
+				fSum += _pfTmp[_pi32Indices[T]*_sTmpStride+X] * _pfWeights[T*4];
+			}
+			_pui8Dst[X] = ToChannel( fSum );
+		}
+	}
+
+}	// namespace lsn
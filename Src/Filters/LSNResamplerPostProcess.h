@@ -0,0 +1,328 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A CPU post-processing filter that scales the image with any of the CResamplerBase kernels.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+#include "../Event/LSNEvent.h"
+#include "LSNFilterKernels.h"
+#include "LSNPostProcessBase.h"
+#include "LSNResamplerBase.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+#ifndef LSN_RESAMPLER_MAX_THREADS
+/** The maximum number of threads (including the calling thread) among which CResamplerPostProcess splits its row bands. */
+#define LSN_RESAMPLER_MAX_THREADS				8
+#endif	// #ifndef LSN_RESAMPLER_MAX_THREADS
+
+#ifndef LSN_RESAMPLER_PARALLEL_MIN
+/** The number of output pixels a pass must have before it is split across threads. */
+#define LSN_RESAMPLER_PARALLEL_MIN				(1 << 16)
+#endif	// #ifndef LSN_RESAMPLER_PARALLEL_MIN
+
+
+namespace lsn {
+
+	/**
+	 * Class CResamplerPostProcess
+	 * \brief A CPU post-processing filter that scales the image with any of the CResamplerBase kernels.
+	 *
+	 * Description: A CPU post-processing filter that scales the image with any of the CResamplerBase kernels.  The contribution
+	 *	lists are applied as a separable 2-pass resampler (horizontal into a floating-point buffer, then vertical back to 8 bits per
+	 *	channel) with AVX2/AVX-512 inner loops selected at run-time (each in its own translation unit), and each pass is split into row bands that run on persistent worker threads.
+	 *	Contribution lists are cached per source/destination size, so they are only rebuilt when the sizes or the filter change.
+	 */
+	class CResamplerPostProcess : public CPostProcessBase, public CResamplerBase {
+	public :
+		CResamplerPostProcess();
+		virtual ~CResamplerPostProcess();
+
+
+		// == Functions.
+		/**
+		 * Applies the filter to the given input
+		 *
+		 * \param _ui32ScreenWidth The screen width.
+		 * \param _ui32ScreenHeight The screen height.
+		 * \param _bFlipped Indicates if the image is flipped on input and set to true to indicate that the image is in a flipped state on output.
+		 * \param _ui32Width On input, this is the width of the buffer in pixels.  On return, it is filled with the final width, in pixels, of the result.
+		 * \param _ui32Height On input, this is the height of the buffer in pixels.  On return, it is filled with the final height, in pixels, of the result.
+		 * \param _ui16BitDepth On input, this is the bit depth of the buffer.  On return, it is filled with the final bit depth of the result.
+		 * \param _ui32Stride On input, this is the stride of the buffer.  On return, it is filled with the final stride, in bytes, of the result.
+		 * \param _ui64PpuFrame The PPU frame associated with the input data.
+		 * \param _ui64RenderStartCycle The cycle at which rendering of the first pixel began.
+		 * \return Returns a pointer to the filtered output buffer.
+		 */
+		virtual uint8_t *									ApplyFilter( uint8_t * _pui8Input,
+			uint32_t _ui32ScreenWidth, uint32_t _ui32ScreenHeight, bool &/*_bFlipped*/,
+			uint32_t &_ui32Width, uint32_t &_ui32Height, uint16_t &/*_ui16BitDepth*/, uint32_t &_ui32Stride, uint64_t /*_ui64PpuFrame*/,
+			uint64_t /*_ui64RenderStartCycle*/ );
+
+		/**
+		 * Scales a 32-bit image.  Can be used directly (without ApplyFilter()) for headless captures and for comparing against GPU
+		 *	output.
+		 *
+		 * \param _pui8Src The source image.
+		 * \param _ui32SrcW The source width in pixels.
+		 * \param _ui32SrcH The source height in pixels.
+		 * \param _ui32SrcStride The source stride in bytes.
+		 * \param _pui8Dst The destination image.
+		 * \param _ui32DstW The destination width in pixels.
+		 * \param _ui32DstH The destination height in pixels.
+		 * \param _ui32DstStride The destination stride in bytes.
+		 * \return Returns true if all allocations succeeded.
+		 */
+		bool												Resample( const uint8_t * _pui8Src, uint32_t _ui32SrcW, uint32_t _ui32SrcH, uint32_t _ui32SrcStride,
+			uint8_t * _pui8Dst, uint32_t _ui32DstW, uint32_t _ui32DstH, uint32_t _ui32DstStride );
+
+		/**
+		 * Sets the filter function.
+		 *
+		 * \param _ffFilter The filter function to use.
+		 */
+		inline void											SetFilter( LSN_FILTER_FUNCS _ffFilter ) {
+			if ( _ffFilter != m_ffFilter ) {
+				m_mAxisCache.clear();
+				m_ffFilter = _ffFilter;
+			}
+		}
+
+		/**
+		 * Gets the filter function.
+		 *
+		 * \return Returns the filter function.
+		 */
+		inline LSN_FILTER_FUNCS								GetFilter() const { return m_ffFilter; }
+
+
+	protected :
+		// == Enumerations.
+		/** Passes. */
+		enum LSN_PASS {
+			LSN_P_HORIZONTAL,								/**< Source rows -> m_vTmp. */
+			LSN_P_VERTICAL,									/**< m_vTmp -> destination rows. */
+		};
+
+		/** Sizes. */
+		enum : size_t {
+			LSN_AXIS_CACHE_SIZE								= 8,											/**< The number of cached contribution lists before the cache is flushed. */
+		};
+
+
+		// == Types.
+		/** A contribution list flattened so that every output has the same number of taps (a multiple of 4). */
+		struct LSN_AXIS {
+			std::vector<float, CAlignmentAllocator<float, 64>>
+															vWeights;										/**< Each weight repeated 4 times (once per channel); ui32Taps * 4 per output. */
+			std::vector<int32_t>							vIndices;										/**< ui32Taps source indices per output. */
+			uint32_t										ui32Taps = 0;									/**< Taps per output. */
+		};
+
+		/** A worker thread and its row band. */
+		struct LSN_WORKER {
+			std::unique_ptr<std::thread>					ptThread;										/**< The thread. */
+			CEvent											eGo;											/**< Signals the thread to run its band. */
+			CEvent											eDone;											/**< Signaled when the band is done. */
+			uint32_t										ui32Start = 0;									/**< The first row of the band. */
+			uint32_t										ui32End = 0;									/**< One past the last row of the band. */
+		};
+
+		/** The pass being run. */
+		struct LSN_JOB {
+			LSN_PASS										pPass = LSN_P_HORIZONTAL;						/**< The pass. */
+			const uint8_t *									pui8Src = nullptr;								/**< The source image. */
+			uint32_t										ui32SrcStride = 0;								/**< The source stride in bytes. */
+			uint8_t *										pui8Dst = nullptr;								/**< The destination image. */
+			uint32_t										ui32DstStride = 0;								/**< The destination stride in bytes. */
+			uint32_t										ui32DstW = 0;									/**< The destination width. */
+			size_t											sTmpStride = 0;									/**< The m_vTmp stride in floats. */
+			const LSN_AXIS *								paX = nullptr;									/**< The horizontal contributions. */
+			const LSN_AXIS *								paY = nullptr;									/**< The vertical contributions. */
+		};
+
+		/** Scales a row horizontally. */
+		typedef void (*										PfHorizontalRow)( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW );
+		/** Scales a row vertically. */
+		typedef void (*										PfVerticalRow)( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+			uint8_t * _pui8Dst, uint32_t _ui32DstW );
+
+		/** The row-kernel table. */
+		struct LSN_ROW_KERNELS {
+			PfHorizontalRow									pfHorizontalRow;								/**< Scales a row horizontally. */
+			PfVerticalRow									pfVerticalRow;									/**< Scales a row vertically. */
+		};
+
+
+		// == Members.
+		/** The filter function. */
+		LSN_FILTER_FUNCS									m_ffFilter = LSN_FF_CARDINALSPLINEUNIFORM;
+		/** Flattened contribution lists keyed by (source size << 32) | destination size. */
+		std::map<uint64_t, LSN_AXIS>						m_mAxisCache;
+		/** The horizontally scaled rows (source height x destination width, 4 floats per pixel). */
+		std::vector<float, CAlignmentAllocator<float, 64>>	m_vTmp;
+		/** The worker threads. */
+		std::vector<std::unique_ptr<LSN_WORKER>>			m_vWorkers;
+		/** Boolean to stop all threads. */
+		std::atomic<bool>									m_bRunThreads;
+		/** The pass being run. */
+		LSN_JOB												m_jJob;
+
+
+		// == Functions.
+		/**
+		 * Gets the flattened contribution list for a given source and destination size, creating it if needed.
+		 *
+		 * \param _ui32SrcSize The source size.
+		 * \param _ui32DstSize The destination size.
+		 * \return Returns the contribution list or nullptr if it could not be created.
+		 */
+		const LSN_AXIS *									Axis( uint32_t _ui32SrcSize, uint32_t _ui32DstSize );
+
+		/**
+		 * Runs the current job over a number of rows, split into bands across the worker threads.
+		 *
+		 * \param _ui32Rows The number of rows.
+		 * \param _bParallel If true, the rows are split across the worker threads.
+		 */
+		void												RunPass( uint32_t _ui32Rows, bool _bParallel );
+
+		/**
+		 * Runs the current job over a band of rows.
+		 *
+		 * \param _ui32Start The first row.
+		 * \param _ui32End One past the last row.
+		 */
+		void												RunBand( uint32_t _ui32Start, uint32_t _ui32End );
+
+		/**
+		 * Creates the worker threads if they do not exist.
+		 */
+		void												StartThreads();
+
+		/**
+		 * Stops the worker threads.
+		 */
+		void												StopThreads();
+
+		/**
+		 * A worker thread.
+		 *
+		 * \param _prppThis Pointer to this object.
+		 * \param _pwWorker The worker data for this thread.
+		 */
+		static void											WorkerThread( CResamplerPostProcess * _prppThis, LSN_WORKER * _pwWorker );
+
+		/**
+		 * Gets the row-kernel table for the current processor.  Selected on the first call.
+		 *
+		 * \return Returns the row-kernel table for the current processor.
+		 */
+		static const LSN_ROW_KERNELS &						RowKernels();
+
+		/**
+		 * Selects the row-kernel table for the current processor.
+		 *
+		 * \return Returns the row-kernel table for the current processor.
+		 */
+		static LSN_ROW_KERNELS								SelectRowKernels();
+
+		/**
+		 * Scales a range of pixels vertically.  Used by every version for the pixels that do not fill a vector.
+		 *
+		 * \param _pfTmp The horizontally scaled rows.
+		 * \param _sTmpStride The stride of _pfTmp in floats.
+		 * \param _pi32Indices The tap row indices.
+		 * \param _pfWeights The tap weights, each repeated 4 times.
+		 * \param _ui32Taps The number of taps.
+		 * \param _ui32Start The first pixel.
+		 * \param _ui32End One past the last pixel.
+		 * \param _pui8Dst The destination row.
+		 */
+		static void											VerticalPixels( const float * _pfTmp, size_t _sTmpStride, const int32_t * _pi32Indices, const float * _pfWeights,
+			uint32_t _ui32Taps, uint32_t _ui32Start, uint32_t _ui32End, uint8_t * _pui8Dst );
+
+		/**
+		 * Scales a row horizontally.
+		 *
+		 * \param _pui8Src The source row.
+		 * \param _pfDst The destination row (4 floats per pixel).
+		 * \param _aAxis The horizontal contributions.
+		 * \param _ui32DstW The destination width.
+		 */
+		static void											HorizontalRow( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW );
+
+		/**
+		 * Scales a row vertically.
+		 *
+		 * \param _pfTmp The horizontally scaled rows.
+		 * \param _sTmpStride The stride of _pfTmp in floats.
+		 * \param _aAxis The vertical contributions.
+		 * \param _ui32Y The destination row.
+		 * \param _pui8Dst The destination row.
+		 * \param _ui32DstW The destination width.
+		 */
+		static void											VerticalRow( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+			uint8_t * _pui8Dst, uint32_t _ui32DstW );
+
+#ifdef LSN_FILTER_KERNELS_X86
+		/**
+		 * Scales a row horizontally using AVX2.
+		 *
+		 * \param _pui8Src The source row.
+		 * \param _pfDst The destination row (4 floats per pixel).
+		 * \param _aAxis The horizontal contributions.
+		 * \param _ui32DstW The destination width.
+		 */
+		static void											HorizontalRow_AVX2( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW );
+
+		/**
+		 * Scales a row vertically using AVX2.
+		 *
+		 * \param _pfTmp The horizontally scaled rows.
+		 * \param _sTmpStride The stride of _pfTmp in floats.
+		 * \param _aAxis The vertical contributions.
+		 * \param _ui32Y The destination row.
+		 * \param _pui8Dst The destination row.
+		 * \param _ui32DstW The destination width.
+		 */
+		static void											VerticalRow_AVX2( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+			uint8_t * _pui8Dst, uint32_t _ui32DstW );
+
+		/**
+		 * Scales a row horizontally using AVX-512.
+		 *
+		 * \param _pui8Src The source row.
+		 * \param _pfDst The destination row (4 floats per pixel).
+		 * \param _aAxis The horizontal contributions.
+		 * \param _ui32DstW The destination width.
+		 */
+		static void											HorizontalRow_AVX512( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW );
+
+		/**
+		 * Scales a row vertically using AVX-512.
+		 *
+		 * \param _pfTmp The horizontally scaled rows.
+		 * \param _sTmpStride The stride of _pfTmp in floats.
+		 * \param _aAxis The vertical contributions.
+		 * \param _ui32Y The destination row.
+		 * \param _pui8Dst The destination row.
+		 * \param _ui32DstW The destination width.
+		 */
+		static void											VerticalRow_AVX512( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+			uint8_t * _pui8Dst, uint32_t _ui32DstW );
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
+	};
+
+}	// namespace lsn
@@ -0,0 +1,92 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX 2 row kernels of CResamplerPostProcess.  Built without depending on the project-wide instruction set so
+ *	that CResamplerPostProcess can select them at run-time.
+ */
+
+#include "LSNResamplerPostProcess.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Scales a row horizontally using AVX2.
+	 *
+	 * \param _pui8Src The source row.
+	 * \param _pfDst The destination row (4 floats per pixel).
+	 * \param _aAxis The horizontal contributions.
+	 * \param _ui32DstW The destination width.
+	 */
+	LSN_TARGET_AVX2 void CResamplerPostProcess::HorizontalRow_AVX2( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW ) {
+		const uint32_t ui32Taps = _aAxis.ui32Taps;
+		const int32_t * pi32Indices = _aAxis.vIndices.data();
+		const float * pfWeights = _aAxis.vWeights.data();
+		for ( uint32_t X = 0; X < _ui32DstW; ++X ) {
+			__m256 vAcc0 = _mm256_setzero_ps();
+			__m256 vAcc1 = _mm256_setzero_ps();
+			for ( uint32_t T = 0; T < ui32Taps; T += 4 ) {
+				// Gather 4 texels, then widen 2 at a time to 8 floats.
+				__m128i vTexels = _mm_i32gather_epi32( reinterpret_cast<const int *>(_pui8Src), _mm_loadu_si128( reinterpret_cast<const __m128i *>(pi32Indices + T) ), 4 );
+				__m256 vT01 = _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( vTexels ) );
+				__m256 vT23 = _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( _mm_srli_si128( vTexels, 8 ) ) );
+				vAcc0 = _mm256_fmadd_ps( vT01, _mm256_load_ps( pfWeights + T * 4 ), vAcc0 );
+				vAcc1 = _mm256_fmadd_ps( vT23, _mm256_load_ps( pfWeights + T * 4 + 8 ), vAcc1 );
+			}
+			vAcc0 = _mm256_add_ps( vAcc0, vAcc1 );
+			_mm_storeu_ps( _pfDst + X * 4, _mm_add_ps( _mm256_castps256_ps128( vAcc0 ), _mm256_extractf128_ps( vAcc0, 1 ) ) );
+			pi32Indices += ui32Taps;
+			pfWeights += ui32Taps * 4;
+		}
+	}
+
+	/**
+	 * Scales a row vertically using AVX2.
+	 *
+	 * \param _pfTmp The horizontally scaled rows.
+	 * \param _sTmpStride The stride of _pfTmp in floats.
+	 * \param _aAxis The vertical contributions.
+	 * \param _ui32Y The destination row.
+	 * \param _pui8Dst The destination row.
+	 * \param _ui32DstW The destination width.
+	 */
+	LSN_TARGET_AVX2 void CResamplerPostProcess::VerticalRow_AVX2( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+		uint8_t * _pui8Dst, uint32_t _ui32DstW ) {
+		const uint32_t ui32Taps = _aAxis.ui32Taps;
+		const int32_t * pi32Indices = _aAxis.vIndices.data() + size_t( _ui32Y ) * ui32Taps;
+		const float * pfWeights = _aAxis.vWeights.data() + size_t( _ui32Y ) * ui32Taps * 4;
+		// packs/packus interleave the 128-bit lanes; this puts the 8 pixels back in order.
+		const __m256i vOrder = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+		uint32_t X = 0;
+		for ( ; X + 8 <= _ui32DstW; X += 8 ) {
+			__m256 vAcc0 = _mm256_setzero_ps();
+			__m256 vAcc1 = _mm256_setzero_ps();
+			__m256 vAcc2 = _mm256_setzero_ps();
+			__m256 vAcc3 = _mm256_setzero_ps();
+			for ( uint32_t T = 0; T < ui32Taps; ++T ) {
+				if ( pfWeights[T*4] == 0.0f ) { continue; }
+				const float * pfRow = _pfTmp + pi32Indices[T] * _sTmpStride + X * 4;
+				__m256 vW = _mm256_set1_ps( pfWeights[T*4] );
+				vAcc0 = _mm256_fmadd_ps( _mm256_load_ps( pfRow ), vW, vAcc0 );
+				vAcc1 = _mm256_fmadd_ps( _mm256_load_ps( pfRow + 8 ), vW, vAcc1 );
+				vAcc2 = _mm256_fmadd_ps( _mm256_load_ps( pfRow + 16 ), vW, vAcc2 );
+				vAcc3 = _mm256_fmadd_ps( _mm256_load_ps( pfRow + 24 ), vW, vAcc3 );
+			}
+			// Round, then saturate to [0,255].
+			__m256i vLo = _mm256_packs_epi32( _mm256_cvtps_epi32( vAcc0 ), _mm256_cvtps_epi32( vAcc1 ) );
+			__m256i vHi = _mm256_packs_epi32( _mm256_cvtps_epi32( vAcc2 ), _mm256_cvtps_epi32( vAcc3 ) );
+			__m256i vBytes = _mm256_permutevar8x32_epi32( _mm256_packus_epi16( vLo, vHi ), vOrder );
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pui8Dst + X * 4), vBytes );
+		}
+		VerticalPixels( _pfTmp, _sTmpStride, pi32Indices, pfWeights, ui32Taps, X, _ui32DstW, _pui8Dst );
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
@@ -0,0 +1,84 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX-512 row kernels of CResamplerPostProcess.  Built without depending on the project-wide instruction set so
+ *	that CResamplerPostProcess can select them at run-time.
+ */
+
+#include "LSNResamplerPostProcess.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Scales a row horizontally using AVX-512.
+	 *
+	 * \param _pui8Src The source row.
+	 * \param _pfDst The destination row (4 floats per pixel).
+	 * \param _aAxis The horizontal contributions.
+	 * \param _ui32DstW The destination width.
+	 */
+	LSN_TARGET_AVX512 void CResamplerPostProcess::HorizontalRow_AVX512( const uint8_t * _pui8Src, float * _pfDst, const LSN_AXIS &_aAxis, uint32_t _ui32DstW ) {
+		const uint32_t ui32Taps = _aAxis.ui32Taps;
+		const int32_t * pi32Indices = _aAxis.vIndices.data();
+		const float * pfWeights = _aAxis.vWeights.data();
+		for ( uint32_t X = 0; X < _ui32DstW; ++X ) {
+			__m512 vAcc = _mm512_setzero_ps();
+			for ( uint32_t T = 0; T < ui32Taps; T += 4 ) {
+				// Gather 4 texels and widen them to 16 floats.
+				__m128i vTexels = _mm_i32gather_epi32( reinterpret_cast<const int *>(_pui8Src), _mm_loadu_si128( reinterpret_cast<const __m128i *>(pi32Indices + T) ), 4 );
+				vAcc = _mm512_fmadd_ps( _mm512_cvtepi32_ps( _mm512_cvtepu8_epi32( vTexels ) ), _mm512_load_ps( pfWeights + T * 4 ), vAcc );
+			}
+			__m128 vSum = _mm_add_ps( _mm_add_ps( _mm512_extractf32x4_ps( vAcc, 0 ), _mm512_extractf32x4_ps( vAcc, 1 ) ),
+				_mm_add_ps( _mm512_extractf32x4_ps( vAcc, 2 ), _mm512_extractf32x4_ps( vAcc, 3 ) ) );
+			_mm_storeu_ps( _pfDst + X * 4, vSum );
+			pi32Indices += ui32Taps;
+			pfWeights += ui32Taps * 4;
+		}
+	}
+
+	/**
+	 * Scales a row vertically using AVX-512.
+	 *
+	 * \param _pfTmp The horizontally scaled rows.
+	 * \param _sTmpStride The stride of _pfTmp in floats.
+	 * \param _aAxis The vertical contributions.
+	 * \param _ui32Y The destination row.
+	 * \param _pui8Dst The destination row.
+	 * \param _ui32DstW The destination width.
+	 */
+	LSN_TARGET_AVX512 void CResamplerPostProcess::VerticalRow_AVX512( const float * _pfTmp, size_t _sTmpStride, const LSN_AXIS &_aAxis, uint32_t _ui32Y,
+		uint8_t * _pui8Dst, uint32_t _ui32DstW ) {
+		const uint32_t ui32Taps = _aAxis.ui32Taps;
+		const int32_t * pi32Indices = _aAxis.vIndices.data() + size_t( _ui32Y ) * ui32Taps;
+		const float * pfWeights = _aAxis.vWeights.data() + size_t( _ui32Y ) * ui32Taps * 4;
+		const __m512i vZero = _mm512_setzero_si512();
+		uint32_t X = 0;
+		for ( ; X + 16 <= _ui32DstW; X += 16 ) {
+			__m512 vAcc[4] = { _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps() };
+			for ( uint32_t T = 0; T < ui32Taps; ++T ) {
+				if ( pfWeights[T*4] == 0.0f ) { continue; }
+				const float * pfRow = _pfTmp + pi32Indices[T] * _sTmpStride + X * 4;
+				__m512 vW = _mm512_set1_ps( pfWeights[T*4] );
+				for ( size_t I = 0; I < 4; ++I ) {
+					vAcc[I] = _mm512_fmadd_ps( _mm512_load_ps( pfRow + I * 16 ), vW, vAcc[I] );
+				}
+			}
+			for ( size_t I = 0; I < 4; ++I ) {
+				// Round, clamp negatives to 0, then saturate to 255.
+				__m128i vBytes = _mm512_cvtusepi32_epi8( _mm512_max_epi32( _mm512_cvtps_epi32( vAcc[I] ), vZero ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui8Dst + (X + I * 4) * 4), vBytes );
+			}
+		}
+		VerticalPixels( _pfTmp, _sTmpStride, pi32Indices, pfWeights, ui32Taps, X, _ui32DstW, _pui8Dst );
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
@@ -0,0 +1,108 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Tracks which rows of a filter's input have changed since the filter last processed them, so that filters can
+ *	reprocess only the changed scanlines.
+ */
+
+#include "LSNRowCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Sets the number of input rows and phase slots.  Every row of every slot becomes dirty.
+	 *
+	 * \param _ui32Rows The number of rows in the input.
+	 * \param _ui32Slots The number of phase slots.
+	 * \return Returns true if the buffers were allocated.
+	 */
+	bool CRowCache::Init( uint32_t _ui32Rows, uint32_t _ui32Slots ) {
+		try {
+			m_vSlotVersion.assign( _ui32Slots, 0 );
+			m_vDirty.resize( _ui32Rows );
+			m_vSlotValid.assign( _ui32Slots, 0 );
+			m_vRuns.reserve( (_ui32Rows + 1) / 2 );
+		}
+		catch ( ... ) {
+			m_vSlotVersion = std::vector<uint64_t>();
+			m_vDirty = std::vector<uint8_t>();
+			m_vSlotValid = std::vector<uint8_t>();
+			m_ui32Rows = 0;
+			return false;
+		}
+		m_ui32Rows = _ui32Rows;
+		return true;
+	}
+
+	/**
+	 * Marks every row of every slot dirty.  Call when a setting, the palette, or the resolution changes.
+	 */
+	void CRowCache::Invalidate() {
+		std::fill( m_vSlotValid.begin(), m_vSlotValid.end(), uint8_t( 0 ) );
+	}
+
+	/**
+	 * Builds the runs of rows that changed since the given slot was last filtered, using the PPU's per-scanline change versions
+	 *	(CDisplayClient::RowVersions()).  The slot then holds the given frame version, so every run returned must be filtered before
+	 *	the slot's output is used.
+	 *
+	 * \param _ui32Slot The phase slot.
+	 * \param _pui64RowVersions The frame version at which each scanline last changed, or nullptr if unknown.
+	 * \param _sRowVersions The number of versions to which _pui64RowVersions points.
+	 * \param _ui64FrameVersion The version of the frame being filtered.
+	 * \param _bFlipped If true, the input rows are in the reverse order of the scanlines.
+	 * \param _ui32Footprint The number of rows above and below each changed row that its change affects in the output.
+	 * \return Returns the number of rows that must be filtered.
+	 */
+	uint32_t CRowCache::Update( uint32_t _ui32Slot, const uint64_t * _pui64RowVersions, size_t _sRowVersions, uint64_t _ui64FrameVersion,
+		bool _bFlipped, uint32_t _ui32Footprint ) {
+		m_vRuns.clear();
+		if LSN_UNLIKELY( _ui32Slot >= m_vSlotValid.size() ) {
+			// Not initialized.  Everything must be filtered.
+			if ( m_ui32Rows ) { m_vRuns.push_back( { 0, m_ui32Rows } ); }
+			return m_ui32Rows;
+		}
+
+		// Without versions for every row there is no way to know what changed.
+		bool bAll = !m_vSlotValid[_ui32Slot] || !_pui64RowVersions || _sRowVersions != m_ui32Rows || _ui64FrameVersion < m_vSlotVersion[_ui32Slot];
+		uint64_t ui64Last = m_vSlotVersion[_ui32Slot];
+		m_vSlotVersion[_ui32Slot] = _ui64FrameVersion;
+		m_vSlotValid[_ui32Slot] = 1;
+		if LSN_UNLIKELY( bAll ) {
+			if ( m_ui32Rows ) { m_vRuns.push_back( { 0, m_ui32Rows } ); }
+			return m_ui32Rows;
+		}
+		if ( ui64Last == _ui64FrameVersion ) { return 0; }
+
+		// Find the changed rows and spread each one over the rows its change reaches.
+		std::fill( m_vDirty.begin(), m_vDirty.end(), uint8_t( 0 ) );
+		bool bAny = false;
+		for ( uint32_t Y = 0; Y < m_ui32Rows; ++Y ) {
+			if ( _pui64RowVersions[_bFlipped ? (m_ui32Rows - 1 - Y) : Y] > ui64Last ) {
+				uint32_t ui32Start = Y >= _ui32Footprint ? Y - _ui32Footprint : 0;
+				uint32_t ui32End = std::min( m_ui32Rows, Y + _ui32Footprint + 1 );
+				std::memset( &m_vDirty[ui32Start], 1, ui32End - ui32Start );
+				bAny = true;
+			}
+		}
+		if ( !bAny ) { return 0; }
+
+		uint32_t ui32Total = 0;
+		for ( uint32_t Y = 0; Y < m_ui32Rows; ) {
+			if ( !m_vDirty[Y] ) { ++Y; continue; }
+			uint32_t ui32Start = Y;
+			while ( Y < m_ui32Rows && m_vDirty[Y] ) { ++Y; }
+			m_vRuns.push_back( { ui32Start, Y } );
+			ui32Total += Y - ui32Start;
+		}
+		return ui32Total;
+	}
+
+}	// namespace lsn
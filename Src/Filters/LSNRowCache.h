@@ -0,0 +1,93 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Tracks which rows of a filter's input have changed since the filter last processed them, so that filters can
+ *	reprocess only the changed scanlines.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CRowCache
+	 * \brief Tracks which rows of a filter's input have changed since the filter last processed them.
+	 *
+	 * Description: Tracks which rows of a filter's input have changed since the filter last processed them, so that filters can
+	 *	reprocess only the changed scanlines.  The PPU already compares each scanline against the previous frame and stamps it with
+	 *	the frame version at which it last changed, so a row is dirty in a slot when its stamp is newer than the frame the slot last
+	 *	filtered.  This also covers frames that were never filtered.  A filter whose output also depends on a phase that changes from
+	 *	frame to frame keeps one slot (and one output buffer) per phase.
+	 */
+	class CRowCache {
+	public :
+		// == Types.
+		/** A run of rows. */
+		struct LSN_ROWS {
+			uint32_t										ui32Start;										/**< The first row. */
+			uint32_t										ui32End;										/**< One past the last row. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Sets the number of input rows and phase slots.  Every row of every slot becomes dirty.
+		 *
+		 * \param _ui32Rows The number of rows in the input.
+		 * \param _ui32Slots The number of phase slots.
+		 * \return Returns true if the buffers were allocated.
+		 */
+		bool												Init( uint32_t _ui32Rows, uint32_t _ui32Slots = 1 );
+
+		/**
+		 * Marks every row of every slot dirty.  Call when a setting, the palette, or the resolution changes.
+		 */
+		void												Invalidate();
+
+		/**
+		 * Builds the runs of rows that changed since the given slot was last filtered, using the PPU's per-scanline change versions
+		 *	(CDisplayClient::RowVersions()).  The slot then holds the given frame version, so every run returned must be filtered before
+		 *	the slot's output is used.
+		 *
+		 * \param _ui32Slot The phase slot.
+		 * \param _pui64RowVersions The frame version at which each scanline last changed, or nullptr if unknown.
+		 * \param _sRowVersions The number of versions to which _pui64RowVersions points.
+		 * \param _ui64FrameVersion The version of the frame being filtered.
+		 * \param _bFlipped If true, the input rows are in the reverse order of the scanlines.
+		 * \param _ui32Footprint The number of rows above and below each changed row that its change affects in the output.
+		 * \return Returns the number of rows that must be filtered.
+		 */
+		uint32_t											Update( uint32_t _ui32Slot, const uint64_t * _pui64RowVersions, size_t _sRowVersions, uint64_t _ui64FrameVersion,
+			bool _bFlipped, uint32_t _ui32Footprint = 0 );
+
+		/**
+		 * Gets the runs of rows found by the last call to Update().
+		 *
+		 * \return Returns the runs of rows that must be filtered.
+		 */
+		inline const std::vector<LSN_ROWS> &				DirtyRuns() const { return m_vRuns; }
+
+
+	protected :
+		// == Members.
+		/** The frame version last filtered in each slot. */
+		std::vector<uint64_t>								m_vSlotVersion;
+		/** Per-row dirty flags, used while building the runs. */
+		std::vector<uint8_t>								m_vDirty;
+		/** The valid state of each slot. */
+		std::vector<uint8_t>								m_vSlotValid;
+		/** The runs of rows that must be filtered. */
+		std::vector<LSN_ROWS>								m_vRuns;
+		/** The number of rows. */
+		uint32_t											m_ui32Rows = 0;
+	};
+
+}	// namespace lsn
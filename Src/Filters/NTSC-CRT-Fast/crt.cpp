@@ -0,0 +1,1632 @@
+/*****************************************************************************/
+/*
+ * NTSC/CRT - integer-only NTSC video signal encoding / decoding emulation
+ * 
+ *   by EMMIR 2018-2023
+ *   
+ *   YouTube: https://www.youtube.com/@EMMIR_KC/videos
+ *   Discord: https://discord.com/invite/hdYctSmyQJ
+ */
+/*****************************************************************************/
+#include "crt.h"
+#include "../LSNFilterKernels.h"
+#include "../../Utilities/LSNUtilities.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+#endif  // #ifdef LSN_FILTER_KERNELS_X86
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ *                      FULL HORIZONTAL LINE SIGNAL (~63500 ns)
+ * |---------------------------------------------------------------------------|
+ *   HBLANK (~10900 ns)                 ACTIVE VIDEO (~52600 ns)
+ * |-------------------||------------------------------------------------------|
+ *   
+ *   
+ *   WITHIN HBLANK PERIOD:
+ *   
+ *   FP (~1500 ns)  SYNC (~4700 ns)  BW (~600 ns)  CB (~2500 ns)  BP (~1600 ns)
+ * |--------------||---------------||------------||-------------||-------------|
+ *      BLANK            SYNC           BLANK          BLANK          BLANK
+ * 
+ */
+#define LINE_BEG         0
+#define FP_ns            1500      /* front porch */
+#define SYNC_ns          4700      /* sync tip */
+#define BW_ns            600       /* breezeway */
+#define CB_ns            2500      /* color burst */
+#define BP_ns            1600      /* back porch */
+#define AV_ns            52600     /* active video */
+#define HB_ns            (FP_ns + SYNC_ns + BW_ns + CB_ns + BP_ns) /* h blank */
+/* line duration should be ~63500 ns */
+#define LINE_ns          (FP_ns + SYNC_ns + BW_ns + CB_ns + BP_ns + AV_ns)
+
+/* convert nanosecond offset to its corresponding point on the sampled line */
+#define ns2pos(ns)       ((ns) * CRT_HRES / LINE_ns)
+/* starting points for all the different pulses */
+#define FP_BEG           ns2pos(0)
+#define SYNC_BEG         ns2pos(FP_ns)
+#define BW_BEG           ns2pos(FP_ns + SYNC_ns)
+#define CB_BEG           ns2pos(FP_ns + SYNC_ns + BW_ns)
+#define BP_BEG           ns2pos(FP_ns + SYNC_ns + BW_ns + CB_ns)
+#define AV_BEG           ns2pos(HB_ns)
+#define AV_LEN           ns2pos(AV_ns)
+
+/* somewhere between 7 and 12 cycles */
+#define CB_CYCLES   10
+
+/* frequencies for bandlimiting */
+#define L_FREQ           1431818 /* full line */
+#define Y_FREQ           420000  /* Luma   (Y) 4.2  MHz of the 14.31818 MHz */
+#define I_FREQ           150000  /* Chroma (I) 1.5  MHz of the 14.31818 MHz */
+#define Q_FREQ           55000   /* Chroma (Q) 0.55 MHz of the 14.31818 MHz */
+
+/* IRE units (100 = 1.0V, -40 = 0.0V) */
+#define WHITE_LEVEL      100
+#define BURST_LEVEL      20
+#define BLACK_LEVEL      7
+#define BLANK_LEVEL      0
+#define SYNC_LEVEL      -40
+
+#if (CRT_CHROMA_PATTERN == 1)
+/* 227.5 subcarrier cycles per line means every other line has reversed phase */
+#define CC_PHASE(ln)     (((ln) & 1) ? -1 : 1)
+#else
+#define CC_PHASE(ln)     (1)
+#endif
+
+/* ensure negative values for x get properly modulo'd */
+#define POSMOD(x, n)     (((x) % (n) + (n)) % (n))
+
+/*****************************************************************************/
+/***************************** FIXED POINT MATH ******************************/
+/*****************************************************************************/
+
+#define T14_2PI           16384
+#define T14_MASK          (T14_2PI - 1)
+#define T14_PI            (T14_2PI / 2)
+
+static int sigpsin15[18] = { /* significant points on sine wave (15-bit) */
+    0x0000,
+    0x0c88,0x18f8,0x2528,0x30f8,0x3c50,0x4718,0x5130,0x5a80,
+    0x62f0,0x6a68,0x70e0,0x7640,0x7a78,0x7d88,0x7f60,0x8000,
+    0x7f60
+};
+
+static int
+sintabil8(int n)
+{
+    int f, i, a, b;
+    
+    /* looks scary but if you don't change T14_2PI
+     * it won't cause out of bounds memory reads
+     */
+    f = n >> 0 & 0xff;
+    i = n >> 8 & 0xff;
+    a = sigpsin15[i];
+    b = sigpsin15[i + 1];
+    return (a + ((b - a) * f >> 8));
+}
+
+/* 14-bit interpolated sine/cosine */
+extern void
+crt_sincos14_fast(int *s, int *c, int n)
+{
+    int h;
+    
+    n &= T14_MASK;
+    h = n & ((T14_2PI >> 1) - 1);
+    
+    if (h > ((T14_2PI >> 2) - 1)) {
+        *c = -sintabil8(h - (T14_2PI >> 2));
+        *s = sintabil8((T14_2PI >> 1) - h);
+    } else {
+        *c = sintabil8((T14_2PI >> 2) - h);
+        *s = sintabil8(h);
+    }
+    if (n > ((T14_2PI >> 1) - 1)) {
+        *c = -*c;
+        *s = -*s;
+    }
+}
+
+#define EXP_P         11
+#define EXP_ONE       (1 << EXP_P)
+#define EXP_MASK      (EXP_ONE - 1)
+#define EXP_PI        6434
+#define EXP_MUL(x, y) (((x) * (y)) >> EXP_P)
+#define EXP_DIV(x, y) (((x) << EXP_P) / (y))
+
+static int e11[] = {
+    EXP_ONE,
+    5567,  /* e   */
+    15133, /* e^2 */
+    41135, /* e^3 */
+    111817 /* e^4 */
+}; 
+
+/* fixed point e^x */
+static int
+expx(int n)
+{
+    int neg, idx, res;
+    int nxt, acc, del;
+    int i;
+
+    if (n == 0) {
+        return EXP_ONE;
+    }
+    neg = n < 0;
+    if (neg) {
+        n = -n;
+    }
+    idx = n >> EXP_P;
+    res = EXP_ONE;
+    for (i = 0; i < idx / 4; i++) {
+        res = EXP_MUL(res, e11[4]);
+    }
+    idx &= 3;
+    if (idx > 0) {
+        res = EXP_MUL(res, e11[idx]);
+    }
+    
+    n &= EXP_MASK;
+    nxt = EXP_ONE;
+    acc = 0;
+    del = 1;
+    for (i = 1; i < 17; i++) {
+        acc += nxt / del;
+        nxt = EXP_MUL(nxt, n);
+        del *= i;
+        if (del > nxt || nxt <= 0 || del <= 0) {
+            break;
+        }
+    }
+    res = EXP_MUL(res, acc);
+
+    if (neg) {
+        res = EXP_DIV(EXP_ONE, res);
+    }
+    return res;
+}
+
+/*****************************************************************************/
+/********************************* FILTERS ***********************************/
+/*****************************************************************************/
+
+#define HISTLEN     3
+#define HISTOLD     (HISTLEN - 1) /* oldest entry */
+#define HISTNEW     0             /* newest entry */
+
+#define EQ_P        16 /* if changed, the gains will need to be adjusted */
+#define EQ_R        (1 << (EQ_P - 1)) /* rounding */
+/* three band equalizer */
+static struct EQF {
+    int lf, hf; /* fractions */
+    int g[3]; /* gains */
+    int fL[4];
+    int fH[4];
+    int h[HISTLEN]; /* history */
+} eqY, eqI, eqQ;
+
+/* f_lo - low cutoff frequency
+ * f_hi - high cutoff frequency
+ * rate - sampling rate
+ * g_lo, g_mid, g_hi - gains
+ */
+static void
+init_eq(struct EQF *f,
+        int f_lo, int f_hi, int rate,
+        int g_lo, int g_mid, int g_hi)
+{
+    int sn, cs;
+    
+    memset(f, 0, sizeof(struct EQF));
+        
+    f->g[0] = g_lo;
+    f->g[1] = g_mid;
+    f->g[2] = g_hi;
+    
+    crt_sincos14_fast(&sn, &cs, T14_PI * f_lo / rate);
+    if constexpr (EQ_P >= 15) {
+        f->lf = 2 * (sn << (EQ_P - 15));
+    } else {
+        f->lf = 2 * (sn >> (15 - EQ_P));
+    }
+    crt_sincos14_fast(&sn, &cs, T14_PI * f_hi / rate);
+    if constexpr (EQ_P >= 15) {
+        f->hf = 2 * (sn << (EQ_P - 15));
+    } else {
+        f->hf = 2 * (sn >> (15 - EQ_P));
+    }
+}
+
+static void
+reset_eq(struct EQF *f)
+{
+    memset(f->fL, 0, sizeof(f->fL));
+    memset(f->fH, 0, sizeof(f->fH));
+    memset(f->h, 0, sizeof(f->h));
+}
+
+static int
+eqf(struct EQF *f, int s)
+{    
+    int i, r[3];
+
+    f->fL[0] += (f->lf * (s - f->fL[0]) + EQ_R) >> EQ_P;
+    f->fH[0] += (f->hf * (s - f->fH[0]) + EQ_R) >> EQ_P;
+    
+    for (i = 1; i < 4; i++) {
+        f->fL[i] += (f->lf * (f->fL[i - 1] - f->fL[i]) + EQ_R) >> EQ_P;
+        f->fH[i] += (f->hf * (f->fH[i - 1] - f->fH[i]) + EQ_R) >> EQ_P;
+    }
+    
+    r[0] = f->fL[3];
+    r[1] = f->fH[3] - f->fL[3];
+    r[2] = f->h[HISTOLD] - f->fH[3];
+
+    for (i = 0; i < 3; i++) {
+        r[i] = (r[i] * f->g[i]) >> EQ_P;
+    }
+  
+    for (i = HISTOLD; i > 0; i--) {
+        f->h[i] = f->h[i - 1];
+    }
+    f->h[HISTNEW] = s;
+    
+    return (r[0] + r[1] + r[2]);
+}
+
+/* infinite impulse response low pass filter for bandlimiting YIQ */
+static struct IIRLP {
+    int c;
+    int h; /* history */
+} iirY, iirI, iirQ;
+
+/* freq  - total bandwidth
+ * limit - max frequency
+ */
+static void
+init_iir(struct IIRLP *f, int freq, int limit)
+{
+    int rate; /* cycles/pixel rate */
+    
+    memset(f, 0, sizeof(struct IIRLP));
+    rate = (freq << 9) / limit;
+    f->c = EXP_ONE - expx(-((EXP_PI << 9) / rate));
+}
+
+static void
+reset_iir(struct IIRLP *f)
+{
+    f->h = 0;
+}
+
+/* hi-pass for debugging */
+#define HIPASS 0
+
+static int
+iirf(struct IIRLP *f, int s)
+{
+    f->h += EXP_MUL(s - f->h, f->c);
+#if HIPASS
+    return s - f->h;
+#else
+    return f->h;
+#endif
+}
+
+/*****************************************************************************/
+/***************************** PUBLIC FUNCTIONS ******************************/
+/*****************************************************************************/
+
+extern void
+crt_resize_fast(struct CRT_FAST *v, int w, int h, int *out)
+{    
+    v->outw = w;
+    v->outh = h;
+    v->out = out;
+}
+
+extern void
+crt_reset_fast(struct CRT_FAST *v)
+{
+    v->hue = 0;
+    v->saturation = 18;
+    v->brightness = 0;
+    v->contrast = 179;
+    v->black_point = 0;
+    v->white_point = 100;
+    v->hsync = 0;
+    v->vsync = 0;
+}
+#define CRT_NES_PULSE_EQ_FIELD_REFACTOR
+extern void
+crt_init_fast(struct CRT_FAST *v, int w, int h, int *out)
+{
+#ifdef CRT_NES_PULSE_EQ_FIELD_REFACTOR
+    int n;
+#endif  // #ifdef CRT_NES_PULSE_EQ_FIELD_REFACTOR
+    memset(v, 0, sizeof(struct CRT_FAST));
+    crt_resize_fast(v, w, h, out);
+    crt_reset_fast(v);
+    v->rn = 194;
+            
+    /* kilohertz to line sample conversion */
+#define kHz2L(kHz) (CRT_HRES * (kHz * 100) / L_FREQ)
+    
+    /* band gains are pre-scaled as 16-bit fixed point
+     * if you change the EQ_P define, you'll need to update these gains too
+     */
+    init_eq(&eqY, kHz2L(1500), kHz2L(3000), CRT_HRES, 65536, 8192, 9175);
+    init_eq(&eqI, kHz2L(80),   kHz2L(1150), CRT_HRES, 65536, 65536, 1311);
+    init_eq(&eqQ, kHz2L(80),   kHz2L(1000), CRT_HRES, 65536, 65536, 0);
+    
+    init_iir(&iirY, L_FREQ, Y_FREQ);
+    init_iir(&iirI, L_FREQ, I_FREQ);
+    init_iir(&iirQ, L_FREQ, Q_FREQ);
+
+#ifdef CRT_NES_PULSE_EQ_FIELD_REFACTOR
+    for (n = 0; n < CRT_VRES; n++) {
+        int t; /* time */
+        signed char *line = &v->analog[n * CRT_HRES];
+        
+        t = LINE_BEG;
+
+        if (n <= 3 || (n >= 7 && n <= 9)) {
+            /* equalizing pulses - small blips of sync, mostly blank */
+            while (t < (4   * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (50  * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (54  * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (100 * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else if (n >= 4 && n <= 6) {
+            int even[4] = { 46, 50, 96, 100 };
+            int *offs = even; /* always progressive */
+            /* vertical sync pulse - small blips of blank, mostly sync */
+            while (t < (offs[0] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[1] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (offs[2] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[3] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else {
+            /* video line */
+            while (t < SYNC_BEG) line[t++] = BLANK_LEVEL; /* FP */
+            while (t < BW_BEG)   line[t++] = SYNC_LEVEL;  /* SYNC */
+            while (t < AV_BEG)   line[t++] = BLANK_LEVEL; /* BW + CB + BP */
+            if (n < CRT_TOP) {
+                while (t < CRT_HRES) line[t++] = BLANK_LEVEL;
+            }
+        }
+    }
+#endif  // #ifdef CRT_NES_PULSE_EQ_FIELD_REFACTOR
+}
+
+extern void
+crt_2ntsc_fast(struct CRT_FAST *v, struct NTSC_SETTINGS_FAST *s)
+{
+    int x, y, xo, yo;
+    int destw = AV_LEN;
+    int desth = ((CRT_LINES * 64500) >> 16);
+    int n;
+#if CRT_DO_BLOOM
+    if (s->raw) {
+        destw = s->w;
+        desth = s->h;
+        if (destw > ((AV_LEN * 55500) >> 16)) {
+            destw = ((AV_LEN * 55500) >> 16);
+        }
+        if (desth > ((CRT_LINES * 63500) >> 16)) {
+            desth = ((CRT_LINES * 63500) >> 16);
+        }
+    } else {
+        destw = (AV_LEN * 55500) >> 16;
+        desth = (CRT_LINES * 63500) >> 16;
+    }
+#else
+    if (s->raw) {
+        destw = s->w;
+        desth = s->h;
+        if (destw > AV_LEN) {
+            destw = AV_LEN;
+        }
+        if (desth > ((CRT_LINES * 64500) >> 16)) {
+            desth = ((CRT_LINES * 64500) >> 16);
+        }
+    }
+#endif
+
+    xo = AV_BEG  + 4 + (AV_LEN    - destw) / 2;
+    yo = CRT_TOP + 4 + (CRT_LINES - desth) / 2;
+    
+    s->field &= 1;
+    
+    /* align signal */
+    xo = (xo & ~3);
+    
+    for (n = 0; n < CRT_VRES; n++) {
+        int t; /* time */
+        signed char *line = &v->analog[n * CRT_HRES];
+        
+        t = LINE_BEG;
+
+        if (n <= 3 || (n >= 7 && n <= 9)) {
+            /* equalizing pulses - small blips of sync, mostly blank */
+            while (t < (4   * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (50  * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (54  * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (100 * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else if (n >= 4 && n <= 6) {
+            int even[4] = { 46, 50, 96, 100 };
+            int odd[4] =  { 4, 50, 96, 100 };
+            int *offs = even;
+            if (s->field == 1) {
+                offs = odd;
+            }
+            /* vertical sync pulse - small blips of blank, mostly sync */
+            while (t < (offs[0] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[1] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (offs[2] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[3] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else {
+            /* video line */
+            while (t < SYNC_BEG) line[t++] = BLANK_LEVEL; /* FP */
+            while (t < BW_BEG)   line[t++] = SYNC_LEVEL;  /* SYNC */
+            while (t < AV_BEG)   line[t++] = BLANK_LEVEL; /* BW + CB + BP */
+            if (n < CRT_TOP) {
+                while (t < CRT_HRES) line[t++] = BLANK_LEVEL;
+            }
+            if (s->as_color) {
+                int cb;
+                /* CB_CYCLES of color burst at 3.579545 Mhz */
+                for (t = CB_BEG; t < CB_BEG + (CB_CYCLES * CRT_CB_FREQ); t++) {
+                    cb = s->cc[(t + 0) & 3];
+                    line[t] = BLANK_LEVEL + (cb * BURST_LEVEL) / s->ccs;
+                }
+            }
+        }
+    }
+
+    for (y = 0; y < desth; y++) {
+        int field_offset;
+        int syA, syB;
+        
+        field_offset = (s->field * s->h + desth) / desth / 2;
+        syA = (y * s->h) / desth;
+        syB = (y * s->h + desth / 2) / desth;
+    
+        syA += field_offset;
+        syB += field_offset;
+
+        if (syA >= s->h) syA = s->h;
+        if (syB >= s->h) syB = s->h;
+        
+        syA *= s->w;
+        syB *= s->w;
+        
+        reset_iir(&iirY);
+        reset_iir(&iirI);
+        reset_iir(&iirQ);
+        
+        for (x = 0; x < destw; x++) {
+            int fy, fi, fq;
+            int pA, pB;
+            int rA, gA, bA;
+            int rB, gB, bB;
+            int sx, ph;
+            int ire; /* composite signal */
+
+            sx = (x * s->w) / destw;
+            pA = s->rgb[sx + syA];
+            pB = s->rgb[sx + syB];
+            rA = (pA >> 16) & 0xff;
+            gA = (pA >>  8) & 0xff;
+            bA = (pA >>  0) & 0xff;
+            rB = (pB >> 16) & 0xff;
+            gB = (pB >>  8) & 0xff;
+            bB = (pB >>  0) & 0xff;
+
+            /* RGB to YIQ blend with potential pixel below */
+            fy = (19595 * rA + 38470 * gA +  7471 * bA
+                + 19595 * rB + 38470 * gB +  7471 * bB) >> 15;
+            fi = (39059 * rA - 18022 * gA - 21103 * bA
+                + 39059 * rB - 18022 * gB - 21103 * bB) >> 15;
+            fq = (13894 * rA - 34275 * gA + 20382 * bA
+                + 13894 * rB - 34275 * gB + 20382 * bB) >> 15;
+            ph = CC_PHASE(y + yo);
+            ire = BLACK_LEVEL + v->black_point;
+            /* bandlimit Y,I,Q */
+            fy = iirf(&iirY, fy);
+            fi = iirf(&iirI, fi) * ph * s->cc[(x + 0) & 3] / s->ccs;
+            fq = iirf(&iirQ, fq) * ph * s->cc[(x + 3) & 3] / s->ccs;
+            ire += (fy + fi + fq) * (WHITE_LEVEL * v->white_point / 100) >> 10;
+            if (ire < 0)   ire = 0;
+            if (ire > 110) ire = 110;
+
+            v->analog[(x + xo) + (y + yo) * CRT_HRES] = ire;
+        }
+    }
+}
+
+extern void
+crt_2ntscFS_fast(struct CRT_FAST *v, struct NTSC_SETTINGS_FAST *s)
+{
+    int x, y, xo, yo;
+    int destw = AV_LEN;
+    int desth = CRT_LINES;
+    int n;
+
+    xo = AV_BEG;
+    yo = CRT_TOP;
+    
+    s->field &= 1;
+    
+    /* align signal */
+    xo = (xo & ~3);
+    
+    for (n = 0; n < CRT_VRES; n++) {
+        int t; /* time */
+        signed char *line = &v->analog[n * CRT_HRES];
+        
+        t = LINE_BEG;
+
+        if (n <= 3 || (n >= 7 && n <= 9)) {
+            /* equalizing pulses - small blips of sync, mostly blank */
+            while (t < (4   * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (50  * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (54  * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (100 * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else if (n >= 4 && n <= 6) {
+            int even[4] = { 46, 50, 96, 100 };
+            int odd[4] =  { 4, 50, 96, 100 };
+            int *offs = even;
+            if (s->field == 1) {
+                offs = odd;
+            }
+            /* vertical sync pulse - small blips of blank, mostly sync */
+            while (t < (offs[0] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[1] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (offs[2] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[3] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else {
+            /* video line */
+            while (t < SYNC_BEG) line[t++] = BLANK_LEVEL; /* FP */
+            while (t < BW_BEG)   line[t++] = SYNC_LEVEL;  /* SYNC */
+            while (t < AV_BEG)   line[t++] = BLANK_LEVEL; /* BW + CB + BP */
+            if (n < CRT_TOP) {
+                while (t < CRT_HRES) line[t++] = BLANK_LEVEL;
+            }
+            if (s->as_color) {
+                int cb;
+                                
+                /* CB_CYCLES of color burst at 3.579545 Mhz */
+                for (t = CB_BEG; t < CB_BEG + (CB_CYCLES * CRT_CB_FREQ); t++) {
+                    cb = s->cc[(t + 0) & 3];
+                    line[t] = BLANK_LEVEL + (cb * BURST_LEVEL) / s->ccs;
+                }
+            }
+        }
+    }
+
+    for (y = 0; y < desth; y++) {
+        int field_offset;
+        int sy;
+        
+        field_offset = (s->field * s->h + desth) / desth / 2;
+        sy = (y * s->h) / desth;
+    
+        sy += field_offset;
+
+        if (sy >= s->h) sy = s->h;
+        
+        sy *= s->w;
+        
+        reset_iir(&iirY);
+        reset_iir(&iirI);
+        reset_iir(&iirQ);
+        
+        for (x = 0; x < destw; x++) {
+            int fy, fi, fq;
+            int pA, rA, gA, bA;
+            int sx, ph;
+            int ire; /* composite signal */
+
+            sx = (x * s->w) / destw;
+            pA = s->rgb[sx + sy];
+            rA = (pA >> 16) & 0xff;
+            gA = (pA >>  8) & 0xff;
+            bA = (pA >>  0) & 0xff;
+
+            fy = (19595 * rA + 38470 * gA +  7471 * bA) >> 14;
+            fi = (39059 * rA - 18022 * gA - 21103 * bA) >> 14;
+            fq = (13894 * rA - 34275 * gA + 20382 * bA) >> 14;
+            ph = CC_PHASE(y + yo);
+            ire = BLACK_LEVEL + v->black_point;
+            /* bandlimit Y,I,Q */
+            fy = iirf(&iirY, fy);
+            fi = iirf(&iirI, fi) * ph * s->cc[(x + 0) & 3] / s->ccs;
+            fq = iirf(&iirQ, fq) * ph * s->cc[(x + 3) & 3] / s->ccs;
+            ire += (fy + fi + fq) * (WHITE_LEVEL * v->white_point / 100) >> 10;
+            if (ire < 0)   ire = 0;
+            if (ire > 110) ire = 110;
+
+            v->analog[(x + xo) + (y + yo) * CRT_HRES] = ire;
+        }
+    }
+}
+
+/* generate the square wave for a given 9-bit pixel and phase */
+static int
+square_sample(int p, int phase)
+{
+    static int active[6] = {
+        0300, 0100,
+        0500, 0400,
+        0600, 0200
+    };
+    int bri, hue, v;
+
+    hue = (p & 0x0f);
+    
+    /* last two columns are black */
+    if (hue >= 0x0e) {
+        return 0;
+    }
+
+    bri = ((p & 0x30) >> 4) * 300;
+    
+    switch (hue) {
+        case 0:
+            v = bri + 410;
+            break;
+        case 0x0d:
+            v = bri - 300;
+            break;
+        default:
+            v = (((hue + phase) % 12) < 6) ? (bri + 410) : (bri - 300);
+            break;
+    }
+
+    if (v > 1024) {
+        v = 1024;
+    }
+    /* red 0100, green 0200, blue 0400 */
+    if ((p & 0700) & active[(phase >> 1) % 6]) {
+        return (v >> 1) + (v >> 2);
+    }
+
+    return v;
+}
+
+
+/* destination size, offsets and dot crawl phase of an NES image */
+static void
+nes_geometry(const struct NES_NTSC_SETTINGS_FAST *s,
+             int *destw, int *desth, int *xo, int *yo, int *lo, int *po)
+{
+    *destw = AV_LEN;
+    *desth = CRT_LINES;
+#if CRT_DO_BLOOM
+    if (s->raw) {
+        *destw = s->w;
+        *desth = s->h;
+        if (*destw > ((AV_LEN * 55500) >> 16)) {
+            *destw = ((AV_LEN * 55500) >> 16);
+        }
+        if (*desth > ((CRT_LINES * 63500) >> 16)) {
+            *desth = ((CRT_LINES * 63500) >> 16);
+        }
+    } else {
+        *destw = (AV_LEN * 55500) >> 16;
+        *desth = (CRT_LINES * 63500) >> 16;
+    }
+#else
+    if (s->raw) {
+        *destw = s->w;
+        *desth = s->h;
+        if (*destw > AV_LEN) {
+            *destw = AV_LEN;
+        }
+        if (*desth > ((CRT_LINES * 64500) >> 16)) {
+            *desth = ((CRT_LINES * 64500) >> 16);
+        }
+    }
+#endif
+
+    *xo = AV_BEG  + 4 + (AV_LEN    - *destw) / 2;
+    *yo = CRT_TOP + 4 + (CRT_LINES - *desth) / 2;
+        
+    /* align signal */
+    *xo = (*xo & ~3);
+#if CRT_NES_HIRES
+    switch (s->dot_crawl_offset % 3) {
+        case 0:
+            *lo = 1;
+            *po = 3;
+            break;
+        case 1:
+            *lo = 3;
+            *po = 1;
+            break;
+        default:
+            *lo = 2;
+            *po = 0;
+            break;
+    }
+#else
+    *lo = (s->dot_crawl_offset % 3); /* line offset to match color burst */
+    *po = *lo; /* phase offset for color burst */
+    if (*lo == 1) {
+        *lo = 3;
+    }
+#endif
+}
+
+extern void
+crt_nes2ntsc_prepare_fast(struct CRT_FAST *v)
+{
+    int p, ph, ire;
+    int ire_start = BLACK_LEVEL + v->black_point;
+    int ire_white_mul = (WHITE_LEVEL * v->white_point / 100);
+
+    /* the phase always advances by 3 per sample, so a pixel
+     * only ever produces 4 different samples
+     */
+    for (p = 0; p < 512; p++) {
+        for (ph = 0; ph < 4; ph++) {
+            ire = ire_start;
+            ire += square_sample(p, ph * 3 + 0);
+            ire += square_sample(p, ph * 3 + 1);
+            ire += square_sample(p, ph * 3 + 2);
+            ire += square_sample(p, ph * 3 + 3);
+            ire = (ire * ire_white_mul) >> 12;
+            if (ire < 0)   ire = 0;
+            if (ire > 110) ire = 110;
+            v->mod[p][ph] = (signed char) ire;
+        }
+    }
+}
+
+/* writes samples [x0, x1) of image row y, starting at line[x0 + xo - off] */
+static void
+nes_row(struct CRT_FAST *v, const struct NES_NTSC_SETTINGS_FAST *s,
+        int y, int x0, int x1, int destw, int desth, int xo, int lo, signed char *line)
+{
+    int x, q;
+    int sy = (y * s->h) / desth;
+    if (sy >= s->h) sy = s->h;
+    
+    sy *= s->w;
+    /* each line moves the phase by (xo + CRT_HRES) * 3 and each sample by 3 */
+    q = ((y - lo) * (xo + CRT_HRES) + xo) & 3;
+    line += xo;
+    for (x = x0; x < x1; x++) {
+        int p = s->data[((x * s->w) / destw) + sy] & 0x1ff;
+        line[x] = v->mod[p][(q + x) & 3];
+    }
+}
+
+extern void
+crt_nes2ntsc_lines_fast(struct CRT_FAST *v, const struct NES_NTSC_SETTINGS_FAST *s, int n0, int n1)
+{
+    int destw, desth, xo, yo, lo, po;
+    int n, y, split;
+    
+    nes_geometry(s, &destw, &desth, &xo, &yo, &lo, &po);
+    /* samples of a row past the end of its line land on the next line */
+    split = CRT_HRES - xo;
+    if (split > destw) split = destw;
+    
+    for (n = n0; n < n1; n++) {
+        int t; /* time */
+        signed char *line = &v->analog[n * CRT_HRES];
+        
+#ifdef CRT_NES_PULSE_EQ_FIELD_REFACTOR
+        if (n >= 10) {
+            /* video line */
+            if (s->as_color) {
+                int cb;
+                /* CB_CYCLES of color burst at 3.579545 Mhz */
+                for (t = CB_BEG; t < CB_BEG + (CB_CYCLES * CRT_CB_FREQ); t++) {
+                    cb = s->cc[(t + po) & 3];
+                    line[t] = BLANK_LEVEL + (cb * BURST_LEVEL) / s->ccs;
+                }
+            }
+        }
+#else
+        t = LINE_BEG;
+
+        if (n <= 3 || (n >= 7 && n <= 9)) {
+            /* equalizing pulses - small blips of sync, mostly blank */
+            while (t < (4   * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (50  * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (54  * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (100 * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else if (n >= 4 && n <= 6) {
+            int even[4] = { 46, 50, 96, 100 };
+            int *offs = even; /* always progressive */
+            /* vertical sync pulse - small blips of blank, mostly sync */
+            while (t < (offs[0] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[1] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+            while (t < (offs[2] * CRT_HRES / 100)) line[t++] = SYNC_LEVEL;
+            while (t < (offs[3] * CRT_HRES / 100)) line[t++] = BLANK_LEVEL;
+        } else {
+            /* video line */
+            while (t < SYNC_BEG) line[t++] = BLANK_LEVEL; /* FP */
+            while (t < BW_BEG)   line[t++] = SYNC_LEVEL;  /* SYNC */
+            while (t < AV_BEG)   line[t++] = BLANK_LEVEL; /* BW + CB + BP */
+            if (n < CRT_TOP) {
+                while (t < CRT_HRES) line[t++] = BLANK_LEVEL;
+            }
+            if (s->as_color) {
+                int cb;
+                /* CB_CYCLES of color burst at 3.579545 Mhz */
+                for (t = CB_BEG; t < CB_BEG + (CB_CYCLES * CRT_CB_FREQ); t++) {
+                    cb = s->cc[(t + po) & 3];
+                    line[t] = BLANK_LEVEL + (cb * BURST_LEVEL) / s->ccs;
+                }
+            }
+        }
+#endif  // #ifdef CRT_NES_PULSE_EQ_FIELD_REFACTOR
+        
+        /* the end of the previous row */
+        y = n - 1 - yo;
+        if (y >= lo && y < desth && split < destw) {
+            nes_row(v, s, y, split, destw, destw, desth, xo, lo, line - CRT_HRES);
+        }
+        /* this line's row */
+        y = n - yo;
+        if (y >= lo && y < desth) {
+            nes_row(v, s, y, 0, split, destw, desth, xo, lo, line);
+        }
+    }
+}
+
+extern void
+crt_nes2ntsc_fast(struct CRT_FAST *v, struct NES_NTSC_SETTINGS_FAST *s)
+{
+    crt_nes2ntsc_prepare_fast(v);
+    crt_nes2ntsc_lines_fast(v, s, 0, CRT_VRES);
+}
+
+/* search windows, in samples */
+#define HSYNC_WINDOW 8
+#define VSYNC_WINDOW 8
+
+/* noise generator */
+#define RN_MUL 214019u
+#define RN_ADD 140327895u
+
+/* the noise generator n steps ahead is rn * mul + add */
+static void
+rn_skip(unsigned n, unsigned *mul, unsigned *add)
+{
+    unsigned m = 1, a = 0;
+    unsigned bm = RN_MUL, ba = RN_ADD;
+    
+    while (n) {
+        if (n & 1) {
+            m *= bm;
+            a = a * bm + ba;
+        }
+        ba = ba * bm + ba;
+        bm *= bm;
+        n >>= 1;
+    }
+    *mul = m;
+    *add = a;
+}
+
+#ifdef LSN_FILTER_KERNELS_X86
+/* adds noise to 16 samples at a time, returns the number of samples done */
+static LSN_TARGET_SSE4 int
+noise_sse4(const signed char *analog, signed char *inp, int len, unsigned rn, int noise)
+{
+    unsigned rns[4], m4, a4, m, a;
+    int i, k;
+    __m128i vrn[4], vm, va, vmask, v7f, vn, vmin, vmax;
+    
+    /* lanes hold consecutive steps of the generator */
+    for (k = 0; k < 4; k++) {
+        rn_skip(k + 1, &m, &a);
+        rns[k] = rn * m + a;
+    }
+    rn_skip(4, &m4, &a4);
+    vrn[0] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rns));
+    vm = _mm_set1_epi32(int(m4));
+    va = _mm_set1_epi32(int(a4));
+    for (k = 1; k < 4; k++) {
+        vrn[k] = _mm_add_epi32(_mm_mullo_epi32(vrn[k - 1], vm), va);
+    }
+    /* 16 steps per iteration */
+    rn_skip(16, &m, &a);
+    vm = _mm_set1_epi32(int(m));
+    va = _mm_set1_epi32(int(a));
+    vmask = _mm_set1_epi32(0xff);
+    v7f = _mm_set1_epi32(0x7f);
+    vn = _mm_set1_epi32(noise);
+    vmin = _mm_set1_epi32(-127);
+    vmax = _mm_set1_epi32(127);
+    for (i = 0; i + 16 <= len; i += 16) {
+        __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i *>(analog + i));
+        __m128i s[4];
+        s[0] = _mm_cvtepi8_epi32(src);
+        s[1] = _mm_cvtepi8_epi32(_mm_srli_si128(src, 4));
+        s[2] = _mm_cvtepi8_epi32(_mm_srli_si128(src, 8));
+        s[3] = _mm_cvtepi8_epi32(_mm_srli_si128(src, 12));
+        for (k = 0; k < 4; k++) {
+            __m128i nz = _mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(vrn[k], 16), vmask), v7f);
+            s[k] = _mm_add_epi32(s[k], _mm_srai_epi32(_mm_mullo_epi32(nz, vn), 8));
+            s[k] = _mm_min_epi32(_mm_max_epi32(s[k], vmin), vmax);
+            vrn[k] = _mm_add_epi32(_mm_mullo_epi32(vrn[k], vm), va);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(inp + i),
+            _mm_packs_epi16(_mm_packs_epi32(s[0], s[1]), _mm_packs_epi32(s[2], s[3])));
+    }
+    return i;
+}
+#endif  // #ifdef LSN_FILTER_KERNELS_X86
+
+/* the best instruction set available for the decoder */
+enum { SIMD_NONE, SIMD_SSE4, SIMD_AVX2, SIMD_AVX512 };
+
+static int
+simd_level(void)
+{
+#ifdef LSN_FILTER_KERNELS_X86
+    if (lsn::CUtilities::IsAvx512FSupported() && lsn::CUtilities::IsAvx512BWSupported() && lsn::CUtilities::IsAvx2Supported()) {
+        return SIMD_AVX512;
+    }
+    if (lsn::CUtilities::IsAvx2Supported()) {
+        return SIMD_AVX2;
+    }
+    if (lsn::CUtilities::IsSse4Supported()) {
+        return SIMD_SSE4;
+    }
+#endif  // #ifdef LSN_FILTER_KERNELS_X86
+    return SIMD_NONE;
+}
+
+static int
+simd(void)
+{
+    static const int level = simd_level();
+    return level;
+}
+
+extern void
+crt_noise_lines_fast(struct CRT_FAST *v, int noise, int n0, int n1)
+{
+    unsigned mul, add, rn;
+    int i, s, beg, end;
+    
+    beg = n0 * CRT_HRES;
+    end = n1 * CRT_HRES;
+    /* jump ahead to the first sample of the first line */
+    rn_skip(unsigned(beg), &mul, &add);
+    rn = unsigned(v->rn) * mul + add;
+#ifdef LSN_FILTER_KERNELS_X86
+    if (simd() >= SIMD_SSE4) {
+        i = noise_sse4(v->analog + beg, v->inp + beg, end - beg, rn, noise);
+        rn_skip(unsigned(i), &mul, &add);
+        rn = rn * mul + add;
+        beg += i;
+    }
+#endif  // #ifdef LSN_FILTER_KERNELS_X86
+    for (i = beg; i < end; i++) {
+        rn = (RN_MUL * rn + RN_ADD);
+
+        /* signal + noise */
+        s = v->analog[i] + (((int((rn >> 16) & 0xff) - 0x7f) * noise) >> 8);
+        if LSN_UNLIKELY(s >  127) { s =  127; }
+        if LSN_UNLIKELY(s < -127) { s = -127; }
+        v->inp[i] = (signed char) s;
+    }
+}
+
+extern void
+crt_sync_fast(struct CRT_FAST *v, int noise)
+{
+    int i, j, line;
+#if CRT_DO_BLOOM
+    int prev_e; /* filtered beam energy per scan line */
+    int max_e; /* approx maximum energy in a scan line */
+#endif
+    signed char *sig;
+    int s = 0;
+    int field, ratio;
+    int ccref[4]; /* color carrier signal */
+    int huesn, huecs;
+    unsigned mul, add;
+    
+    (void) noise;
+    crt_sincos14_fast(&huesn, &huecs, ((v->hue % 360) + 90) * 8192 / 180);
+    huesn >>= 11; /* make 4-bit */
+    huecs >>= 11;
+
+    memset(ccref, 0, sizeof(ccref));
+    
+    /* crt_noise_lines_fast() stepped through the whole frame */
+    rn_skip(CRT_INPUT_SIZE, &mul, &add);
+    v->rn = int(unsigned(v->rn) * mul + add);
+
+    /* Look for vertical sync.
+     * 
+     * This is done by integrating the signal and
+     * seeing if it exceeds a threshold. The threshold of
+     * the vertical sync pulse is much higher because the
+     * vsync pulse is a lot longer than the hsync pulse.
+     * The signal needs to be integrated to lessen
+     * the noise in the signal.
+     */
+    for (i = -VSYNC_WINDOW; i < VSYNC_WINDOW; i++) {
+        line = POSMOD(v->vsync + i, CRT_VRES);
+        sig = v->inp + line * CRT_HRES;
+        s = 0;
+        for (j = 0; j < CRT_HRES; j++) {
+            s += sig[j];
+            /* increase the multiplier to make the vsync
+             * more stable when there is a lot of noise
+             */
+#if CRT_NES_HIRES
+            if (s <= (150 * SYNC_LEVEL)) {
+                goto vsync_found;
+            }
+#else
+            if (s <= (100 * SYNC_LEVEL)) {
+                goto vsync_found;
+            }
+#endif
+        }
+    }
+vsync_found:
+#if CRT_DO_VSYNC
+    v->vsync = line; /* vsync found (or gave up) at this line */
+#else
+    v->vsync = 0;
+#endif
+    /* if vsync signal was in second half of line, odd field */
+    field = (j > (CRT_HRES / 2));
+#if CRT_DO_BLOOM
+    max_e = (128 + (noise / 2)) * AV_LEN;
+    prev_e = (16384 / 8);
+#endif
+    /* ratio of output height to active video lines in the signal */
+    ratio = (v->outh << 16) / CRT_LINES;
+    ratio = (ratio + 32768) >> 16;
+    
+    field = (field * (ratio / 2));
+
+    for (line = CRT_TOP; line < CRT_BOT; line++) {
+        struct CRT_FAST_LINE *cl = &v->lines[line];
+        unsigned pos, ln;
+#if CRT_DO_BLOOM
+        int line_w;
+#endif
+        int dci, dcq; /* decoded I, Q */
+        int xpos, ypos;
+        int beg, end;
+        int phasealign;
+  
+        beg = (line - CRT_TOP + 0) * v->outh / CRT_LINES + field;
+        end = (line - CRT_TOP + 1) * v->outh / CRT_LINES + field;
+
+        cl->active = 0;
+        if (beg >= v->outh) { continue; }
+        if (end > v->outh) { end = v->outh; }
+
+        /* Look for horizontal sync.
+         * See comment above regarding vertical sync.
+         */
+        ln = (POSMOD(line + v->vsync, CRT_VRES)) * CRT_HRES;
+        sig = v->inp + ln + v->hsync;
+        s = 0;
+        for (i = -HSYNC_WINDOW; i < HSYNC_WINDOW; i++) {
+            s += sig[SYNC_BEG + i];
+            if (s <= (4 * SYNC_LEVEL)) {
+                break;
+            }
+        }
+#if CRT_DO_HSYNC
+        v->hsync = POSMOD(i + v->hsync, CRT_HRES);
+#else
+        v->hsync = 0;
+#endif
+       
+        sig = v->inp + ln + (v->hsync & ~3); /* burst @ 1/CB_FREQ sample rate */
+        for (i = CB_BEG; i < CB_BEG + (CB_CYCLES * CRT_CB_FREQ); i++) {
+            int p = ccref[i & 3] * 127 / 128; /* fraction of the previous */
+            int n = sig[i];                   /* mixed with the new sample */
+            ccref[i & 3] = p + n;
+        }
+        
+        xpos = POSMOD(AV_BEG + v->hsync, CRT_HRES);
+        ypos = POSMOD(line + v->vsync, CRT_VRES);
+        pos = xpos + ypos * CRT_HRES;
+        phasealign = pos & 3;
+        
+        /* amplitude of carrier = saturation, phase difference = hue */
+        dci = ccref[(phasealign + 1) & 3] - ccref[(phasealign + 3) & 3];
+        dcq = ccref[(phasealign + 2) & 3] - ccref[(phasealign + 0) & 3];
+
+        /* rotate them by the hue adjustment angle */
+        cl->wave[0] = ((dci * huecs - dcq * huesn) >> 4) * v->saturation;
+        cl->wave[1] = ((dcq * huecs + dci * huesn) >> 4) * v->saturation;
+        cl->wave[2] = -cl->wave[0];
+        cl->wave[3] = -cl->wave[1];
+        
+        cl->pos = int(pos);
+        cl->beg = beg;
+        cl->end = end;
+        cl->active = 1;
+#if CRT_DO_BLOOM
+        sig = v->inp + pos;
+        s = 0;
+        for (i = 0; i < AV_LEN; i++) {
+            s += sig[i]; /* sum up the scan line */
+        }
+        /* bloom emulation */
+        prev_e = (prev_e * 123 / 128) + ((((max_e >> 1) - s) << 10) / max_e);
+        line_w = (AV_LEN * 112 / 128) + (prev_e >> 9);
+
+        cl->dx = (line_w << 12) / v->outw;
+        cl->scanL = ((AV_LEN / 2) - (line_w >> 1) + 8) << 12;
+        cl->scanR = (AV_LEN - 1) << 12;
+        
+        cl->L = (cl->scanL >> 12);
+        cl->R = (cl->scanR >> 12);
+#else
+        cl->dx = ((AV_LEN - 1) << 12) / v->outw;
+        cl->scanL = 0;
+        cl->scanR = (AV_LEN - 1) << 12;
+        cl->L = 0;
+        cl->R = AV_LEN;
+#endif
+    }
+}
+
+/* duplicate extra lines */
+static void
+dup_rows(struct CRT_FAST *v, const struct CRT_FAST_LINE *cl)
+{
+    int s;
+    size_t ln = v->outw * sizeof(int);
+    
+    for (s = cl->beg + 1; s < cl->end; s++) {
+        memcpy(v->out + s * v->outw, v->out + (s - 1) * v->outw, ln);
+    }
+}
+
+static void
+draw_line(struct CRT_FAST *v, const struct CRT_FAST_LINE *cl)
+{
+    struct {
+        int y, i, q;
+    } out[AV_LEN + 1], *yiqA, *yiqB;
+    /* the filters are reset for every line, so each line can use its own */
+    struct EQF fY = eqY, fI = eqI, fQ = eqQ;
+    int bright = v->brightness - (BLACK_LEVEL + v->black_point);
+    const signed char *sig = v->inp + cl->pos;
+    const int *wave = cl->wave;
+    unsigned pos;
+    int i, s, L, R;
+    int *cL, *cR;
+    
+    reset_eq(&fY);
+    reset_eq(&fI);
+    reset_eq(&fQ);
+    
+    for (i = cl->L; i < cl->R; i++) {
+        out[i].y = eqf(&fY, sig[i] + bright) << 4;
+        out[i].i = eqf(&fI, sig[i] * wave[(i + 0) & 3] >> 9) >> 3;
+        out[i].q = eqf(&fQ, sig[i] * wave[(i + 3) & 3] >> 9) >> 3;
+    }
+
+    cL = v->out + cl->beg * v->outw;
+    cR = cL + v->outw;
+
+    for (pos = cl->scanL; pos < unsigned(cl->scanR) && cL < cR; pos += cl->dx) {
+        int y, i, q;
+        int r, g, b;
+        int aa, bb;
+
+        R = pos & 0xfff;
+        L = 0xfff - R;
+        s = pos >> 12;
+        
+        yiqA = out + s;
+        yiqB = out + s + 1;
+        
+        /* interpolate between samples if needed */
+        y = ((yiqA->y * L) >>  2) + ((yiqB->y * R) >>  2);
+        i = ((yiqA->i * L) >> 14) + ((yiqB->i * R) >> 14);
+        q = ((yiqA->q * L) >> 14) + ((yiqB->q * R) >> 14);
+        
+        /* YIQ to RGB */
+        r = (((y + 3879 * i + 2556 * q) >> 12) * v->contrast) >> 8;
+        g = (((y - 1126 * i - 2605 * q) >> 12) * v->contrast) >> 8;
+        b = (((y - 4530 * i + 7021 * q) >> 12) * v->contrast) >> 8;
+      
+        if (r < 0) r = 0;
+        if (g < 0) g = 0;
+        if (b < 0) b = 0;
+        if (r > 255) r = 255;
+        if (g > 255) g = 255;
+        if (b > 255) b = 255;
+        
+        aa = (r << 16 | g << 8 | b);
+        bb = *cL;
+        /* blend with previous color there */
+        *cL++ = (((aa & 0xfefeff) >> 1) + ((bb & 0xfefeff) >> 1));
+    }
+    
+    dup_rows(v, cl);
+}
+
+#ifdef LSN_FILTER_KERNELS_X86
+/* The SIMD decoders run the equalizers of 4, 8 or 16 lines side-by-side,
+ * one line per lane.  Sample i of lane k is at [i * lanes + k].
+ *   sig      - the transposed lines
+ *   mul      - 4 vectors of per-lane multipliers; sample i uses mul[(i + ph) & 3]
+ *   pre      - right shift after the multiplication
+ *   add      - added after the shift
+ *   lsh, rsh - shifts applied to the equalizer output
+ */
+typedef void (*eq_lanes_fn)(const struct EQF *f, const int *sig, const int *mul,
+                            int ph, int pre, int add, int lsh, int rsh, int *out);
+/* interpolates, converts and blends count output pixels of each lane */
+typedef void (*out_lanes_fn)(struct CRT_FAST *v, const struct CRT_FAST_LINE *cl,
+                             const int *yT, const int *iT, const int *qT, int count);
+
+static LSN_TARGET_SSE4 void
+eq_lanes_sse4(const struct EQF *f, const int *sig, const int *mul,
+              int ph, int pre, int add, int lsh, int rsh, int *out)
+{
+    const __m128i lf = _mm_set1_epi32(f->lf), hf = _mm_set1_epi32(f->hf);
+    const __m128i g0 = _mm_set1_epi32(f->g[0]), g1 = _mm_set1_epi32(f->g[1]), g2 = _mm_set1_epi32(f->g[2]);
+    const __m128i rnd = _mm_set1_epi32(EQ_R), a = _mm_set1_epi32(add);
+    const __m128i cpre = _mm_cvtsi32_si128(pre), cl = _mm_cvtsi32_si128(lsh), cr = _mm_cvtsi32_si128(rsh);
+    __m128i m[4];
+    __m128i fL0, fL1, fL2, fL3, fH0, fH1, fH2, fH3, h0, h1, h2;
+    int i;
+    
+    for (i = 0; i < 4; i++) {
+        m[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mul + i * 4));
+    }
+    fL0 = fL1 = fL2 = fL3 = fH0 = fH1 = fH2 = fH3 = h0 = h1 = h2 = _mm_setzero_si128();
+#define EQ_STEP(F, C, S) F = _mm_add_epi32(F, _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(C, _mm_sub_epi32(S, F)), rnd), EQ_P))
+    for (i = 0; i < AV_LEN; i++) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(sig + i * 4));
+        __m128i o;
+        s = _mm_add_epi32(_mm_sra_epi32(_mm_mullo_epi32(s, m[(i + ph) & 3]), cpre), a);
+        EQ_STEP(fL0, lf, s);
+        EQ_STEP(fH0, hf, s);
+        EQ_STEP(fL1, lf, fL0);
+        EQ_STEP(fH1, hf, fH0);
+        EQ_STEP(fL2, lf, fL1);
+        EQ_STEP(fH2, hf, fH1);
+        EQ_STEP(fL3, lf, fL2);
+        EQ_STEP(fH3, hf, fH2);
+        o = _mm_add_epi32(_mm_add_epi32(
+            _mm_srai_epi32(_mm_mullo_epi32(fL3, g0), EQ_P),
+            _mm_srai_epi32(_mm_mullo_epi32(_mm_sub_epi32(fH3, fL3), g1), EQ_P)),
+            _mm_srai_epi32(_mm_mullo_epi32(_mm_sub_epi32(h2, fH3), g2), EQ_P));
+        h2 = h1;
+        h1 = h0;
+        h0 = s;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 4), _mm_sra_epi32(_mm_sll_epi32(o, cl), cr));
+    }
+#undef EQ_STEP
+}
+
+static LSN_TARGET_SSE4 void
+out_lanes_sse4(struct CRT_FAST *v, const struct CRT_FAST_LINE *cl,
+               const int *yT, const int *iT, const int *qT, int count)
+{
+    const __m128i contrast = _mm_set1_epi32(v->contrast), zero = _mm_setzero_si128(), max = _mm_set1_epi32(255);
+    const __m128i c3879 = _mm_set1_epi32(3879), c2556 = _mm_set1_epi32(2556), c1126 = _mm_set1_epi32(1126);
+    const __m128i c2605 = _mm_set1_epi32(2605), c4530 = _mm_set1_epi32(4530), c7021 = _mm_set1_epi32(7021);
+    int *rows[4];
+    int aa[4];
+    unsigned pos;
+    int x, k;
+    
+    for (k = 0; k < 4; k++) {
+        rows[k] = v->out + cl[k].beg * v->outw;
+    }
+    for (x = 0, pos = cl->scanL; x < count; x++, pos += cl->dx) {
+        int R = pos & 0xfff;
+        int s = (pos >> 12) * 4;
+        __m128i vR = _mm_set1_epi32(R), vL = _mm_set1_epi32(0xfff - R);
+        __m128i y, i, q, r, g, b;
+        
+        /* interpolate between samples if needed */
+        y = _mm_add_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(yT + s)), vL), 2),
+            _mm_srai_epi32(_mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(yT + s + 4)), vR), 2));
+        i = _mm_add_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(iT + s)), vL), 14),
+            _mm_srai_epi32(_mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(iT + s + 4)), vR), 14));
+        q = _mm_add_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(qT + s)), vL), 14),
+            _mm_srai_epi32(_mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(qT + s + 4)), vR), 14));
+        
+        /* YIQ to RGB */
+        r = _mm_add_epi32(y, _mm_add_epi32(_mm_mullo_epi32(i, c3879), _mm_mullo_epi32(q, c2556)));
+        g = _mm_sub_epi32(_mm_sub_epi32(y, _mm_mullo_epi32(i, c1126)), _mm_mullo_epi32(q, c2605));
+        b = _mm_add_epi32(_mm_sub_epi32(y, _mm_mullo_epi32(i, c4530)), _mm_mullo_epi32(q, c7021));
+        r = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_srai_epi32(r, 12), contrast), 8), zero), max);
+        g = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_srai_epi32(g, 12), contrast), 8), zero), max);
+        b = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_srai_epi32(b, 12), contrast), 8), zero), max);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(aa),
+            _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 16), _mm_slli_epi32(g, 8)), b));
+        
+        /* blend with previous color there */
+        for (k = 0; k < 4; k++) {
+            rows[k][x] = (((aa[k] & 0xfefeff) >> 1) + ((rows[k][x] & 0xfefeff) >> 1));
+        }
+    }
+}
+
+static LSN_TARGET_AVX2 void
+eq_lanes_avx2(const struct EQF *f, const int *sig, const int *mul,
+              int ph, int pre, int add, int lsh, int rsh, int *out)
+{
+    const __m256i lf = _mm256_set1_epi32(f->lf), hf = _mm256_set1_epi32(f->hf);
+    const __m256i g0 = _mm256_set1_epi32(f->g[0]), g1 = _mm256_set1_epi32(f->g[1]), g2 = _mm256_set1_epi32(f->g[2]);
+    const __m256i rnd = _mm256_set1_epi32(EQ_R), a = _mm256_set1_epi32(add);
+    const __m128i cpre = _mm_cvtsi32_si128(pre), cl = _mm_cvtsi32_si128(lsh), cr = _mm_cvtsi32_si128(rsh);
+    __m256i m[4];
+    __m256i fL0, fL1, fL2, fL3, fH0, fH1, fH2, fH3, h0, h1, h2;
+    int i;
+    
+    for (i = 0; i < 4; i++) {
+        m[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mul + i * 8));
+    }
+    fL0 = fL1 = fL2 = fL3 = fH0 = fH1 = fH2 = fH3 = h0 = h1 = h2 = _mm256_setzero_si256();
+#define EQ_STEP(F, C, S) F = _mm256_add_epi32(F, _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(C, _mm256_sub_epi32(S, F)), rnd), EQ_P))
+    for (i = 0; i < AV_LEN; i++) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sig + i * 8));
+        __m256i o;
+        s = _mm256_add_epi32(_mm256_sra_epi32(_mm256_mullo_epi32(s, m[(i + ph) & 3]), cpre), a);
+        EQ_STEP(fL0, lf, s);
+        EQ_STEP(fH0, hf, s);
+        EQ_STEP(fL1, lf, fL0);
+        EQ_STEP(fH1, hf, fH0);
+        EQ_STEP(fL2, lf, fL1);
+        EQ_STEP(fH2, hf, fH1);
+        EQ_STEP(fL3, lf, fL2);
+        EQ_STEP(fH3, hf, fH2);
+        o = _mm256_add_epi32(_mm256_add_epi32(
+            _mm256_srai_epi32(_mm256_mullo_epi32(fL3, g0), EQ_P),
+            _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(fH3, fL3), g1), EQ_P)),
+            _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(h2, fH3), g2), EQ_P));
+        h2 = h1;
+        h1 = h0;
+        h0 = s;
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * 8), _mm256_sra_epi32(_mm256_sll_epi32(o, cl), cr));
+    }
+#undef EQ_STEP
+}
+
+static LSN_TARGET_AVX2 void
+out_lanes_avx2(struct CRT_FAST *v, const struct CRT_FAST_LINE *cl,
+               const int *yT, const int *iT, const int *qT, int count)
+{
+    const __m256i contrast = _mm256_set1_epi32(v->contrast), zero = _mm256_setzero_si256(), max = _mm256_set1_epi32(255);
+    const __m256i c3879 = _mm256_set1_epi32(3879), c2556 = _mm256_set1_epi32(2556), c1126 = _mm256_set1_epi32(1126);
+    const __m256i c2605 = _mm256_set1_epi32(2605), c4530 = _mm256_set1_epi32(4530), c7021 = _mm256_set1_epi32(7021);
+    const __m256i blend = _mm256_set1_epi32(0xfefeff);
+    int rows[8];
+    int bb[8];
+    unsigned pos;
+    int x, k;
+    
+    for (k = 0; k < 8; k++) {
+        rows[k] = cl[k].beg * v->outw;
+    }
+    const __m256i vRows = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rows));
+    for (x = 0, pos = cl->scanL; x < count; x++, pos += cl->dx) {
+        int R = pos & 0xfff;
+        int s = (pos >> 12) * 8;
+        __m256i vR = _mm256_set1_epi32(R), vL = _mm256_set1_epi32(0xfff - R);
+        __m256i y, i, q, r, g, b, aa, prev;
+        
+        /* interpolate between samples if needed */
+        y = _mm256_add_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(yT + s)), vL), 2),
+            _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(yT + s + 8)), vR), 2));
+        i = _mm256_add_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(iT + s)), vL), 14),
+            _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(iT + s + 8)), vR), 14));
+        q = _mm256_add_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(qT + s)), vL), 14),
+            _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(qT + s + 8)), vR), 14));
+        
+        /* YIQ to RGB */
+        r = _mm256_add_epi32(y, _mm256_add_epi32(_mm256_mullo_epi32(i, c3879), _mm256_mullo_epi32(q, c2556)));
+        g = _mm256_sub_epi32(_mm256_sub_epi32(y, _mm256_mullo_epi32(i, c1126)), _mm256_mullo_epi32(q, c2605));
+        b = _mm256_add_epi32(_mm256_sub_epi32(y, _mm256_mullo_epi32(i, c4530)), _mm256_mullo_epi32(q, c7021));
+        r = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(r, 12), contrast), 8), zero), max);
+        g = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(g, 12), contrast), 8), zero), max);
+        b = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(b, 12), contrast), 8), zero), max);
+        aa = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r, 16), _mm256_slli_epi32(g, 8)), b);
+        
+        /* blend with previous color there */
+        prev = _mm256_i32gather_epi32(v->out + x, vRows, 4);
+        aa = _mm256_add_epi32(_mm256_srli_epi32(_mm256_and_si256(aa, blend), 1), _mm256_srli_epi32(_mm256_and_si256(prev, blend), 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(bb), aa);
+        for (k = 0; k < 8; k++) {
+            v->out[rows[k] + x] = bb[k];
+        }
+    }
+}
+
+static LSN_TARGET_AVX512 void
+eq_lanes_avx512(const struct EQF *f, const int *sig, const int *mul,
+                int ph, int pre, int add, int lsh, int rsh, int *out)
+{
+    const __m512i lf = _mm512_set1_epi32(f->lf), hf = _mm512_set1_epi32(f->hf);
+    const __m512i g0 = _mm512_set1_epi32(f->g[0]), g1 = _mm512_set1_epi32(f->g[1]), g2 = _mm512_set1_epi32(f->g[2]);
+    const __m512i rnd = _mm512_set1_epi32(EQ_R), a = _mm512_set1_epi32(add);
+    const __m128i cpre = _mm_cvtsi32_si128(pre), cl = _mm_cvtsi32_si128(lsh), cr = _mm_cvtsi32_si128(rsh);
+    __m512i m[4];
+    __m512i fL0, fL1, fL2, fL3, fH0, fH1, fH2, fH3, h0, h1, h2;
+    int i;
+    
+    for (i = 0; i < 4; i++) {
+        m[i] = _mm512_loadu_si512(mul + i * 16);
+    }
+    fL0 = fL1 = fL2 = fL3 = fH0 = fH1 = fH2 = fH3 = h0 = h1 = h2 = _mm512_setzero_si512();
+#define EQ_STEP(F, C, S) F = _mm512_add_epi32(F, _mm512_srai_epi32(_mm512_add_epi32(_mm512_mullo_epi32(C, _mm512_sub_epi32(S, F)), rnd), EQ_P))
+    for (i = 0; i < AV_LEN; i++) {
+        __m512i s = _mm512_loadu_si512(sig + i * 16);
+        __m512i o;
+        s = _mm512_add_epi32(_mm512_sra_epi32(_mm512_mullo_epi32(s, m[(i + ph) & 3]), cpre), a);
+        EQ_STEP(fL0, lf, s);
+        EQ_STEP(fH0, hf, s);
+        EQ_STEP(fL1, lf, fL0);
+        EQ_STEP(fH1, hf, fH0);
+        EQ_STEP(fL2, lf, fL1);
+        EQ_STEP(fH2, hf, fH1);
+        EQ_STEP(fL3, lf, fL2);
+        EQ_STEP(fH3, hf, fH2);
+        o = _mm512_add_epi32(_mm512_add_epi32(
+            _mm512_srai_epi32(_mm512_mullo_epi32(fL3, g0), EQ_P),
+            _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_sub_epi32(fH3, fL3), g1), EQ_P)),
+            _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_sub_epi32(h2, fH3), g2), EQ_P));
+        h2 = h1;
+        h1 = h0;
+        h0 = s;
+        _mm512_storeu_si512(out + i * 16, _mm512_sra_epi32(_mm512_sll_epi32(o, cl), cr));
+    }
+#undef EQ_STEP
+}
+
+static LSN_TARGET_AVX512 void
+out_lanes_avx512(struct CRT_FAST *v, const struct CRT_FAST_LINE *cl,
+                 const int *yT, const int *iT, const int *qT, int count)
+{
+    const __m512i contrast = _mm512_set1_epi32(v->contrast), zero = _mm512_setzero_si512(), max = _mm512_set1_epi32(255);
+    const __m512i c3879 = _mm512_set1_epi32(3879), c2556 = _mm512_set1_epi32(2556), c1126 = _mm512_set1_epi32(1126);
+    const __m512i c2605 = _mm512_set1_epi32(2605), c4530 = _mm512_set1_epi32(4530), c7021 = _mm512_set1_epi32(7021);
+    const __m512i blend = _mm512_set1_epi32(0xfefeff);
+    int rows[16];
+    unsigned pos;
+    int x, k;
+    
+    for (k = 0; k < 16; k++) {
+        rows[k] = cl[k].beg * v->outw;
+    }
+    const __m512i vRows = _mm512_loadu_si512(rows);
+    for (x = 0, pos = cl->scanL; x < count; x++, pos += cl->dx) {
+        int R = pos & 0xfff;
+        int s = (pos >> 12) * 16;
+        __m512i vR = _mm512_set1_epi32(R), vL = _mm512_set1_epi32(0xfff - R);
+        __m512i y, i, q, r, g, b, aa, prev;
+        
+        /* interpolate between samples if needed */
+        y = _mm512_add_epi32(_mm512_srai_epi32(_mm512_mullo_epi32(_mm512_loadu_si512(yT + s), vL), 2),
+            _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_loadu_si512(yT + s + 16), vR), 2));
+        i = _mm512_add_epi32(_mm512_srai_epi32(_mm512_mullo_epi32(_mm512_loadu_si512(iT + s), vL), 14),
+            _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_loadu_si512(iT + s + 16), vR), 14));
+        q = _mm512_add_epi32(_mm512_srai_epi32(_mm512_mullo_epi32(_mm512_loadu_si512(qT + s), vL), 14),
+            _mm512_srai_epi32(_mm512_mullo_epi32(_mm512_loadu_si512(qT + s + 16), vR), 14));
+        
+        /* YIQ to RGB */
+        r = _mm512_add_epi32(y, _mm512_add_epi32(_mm512_mullo_epi32(i, c3879), _mm512_mullo_epi32(q, c2556)));
+        g = _mm512_sub_epi32(_mm512_sub_epi32(y, _mm512_mullo_epi32(i, c1126)), _mm512_mullo_epi32(q, c2605));
+        b = _mm512_add_epi32(_mm512_sub_epi32(y, _mm512_mullo_epi32(i, c4530)), _mm512_mullo_epi32(q, c7021));
+        r = _mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_mullo_epi32(_mm512_srai_epi32(r, 12), contrast), 8), zero), max);
+        g = _mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_mullo_epi32(_mm512_srai_epi32(g, 12), contrast), 8), zero), max);
+        b = _mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_mullo_epi32(_mm512_srai_epi32(b, 12), contrast), 8), zero), max);
+        aa = _mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(r, 16), _mm512_slli_epi32(g, 8)), b);
+        
+        /* blend with previous color there */
+        prev = _mm512_i32gather_epi32(vRows, v->out + x, 4);
+        aa = _mm512_add_epi32(_mm512_srli_epi32(_mm512_and_si512(aa, blend), 1), _mm512_srli_epi32(_mm512_and_si512(prev, blend), 1));
+        _mm512_i32scatter_epi32(v->out + x, vRows, aa, 4);
+    }
+}
+
+/* decodes groups of n lines, returns the first line not decoded */
+static int
+draw_lanes(struct CRT_FAST *v, int l0, int l1, int n, int *buf, eq_lanes_fn eq, out_lanes_fn out)
+{
+    int *sigT = buf;
+    int *yT = sigT + AV_LEN * n;
+    int *iT = yT + AV_LEN * n;
+    int *qT = iT + AV_LEN * n;
+    int ones[4 * 16], wave[4 * 16];
+    int bright = v->brightness - (BLACK_LEVEL + v->black_point);
+    int i, k, count;
+    unsigned pos;
+    
+    for (i = 0; i < 4 * n; i++) {
+        ones[i] = 1;
+    }
+    for (; l0 + n <= l1; l0 += n) {
+        const struct CRT_FAST_LINE *cl = &v->lines[l0];
+        for (k = 0; k < n; k++) {
+            const signed char *sig = v->inp + cl[k].pos;
+            for (i = 0; i < AV_LEN; i++) {
+                sigT[i * n + k] = sig[i];
+            }
+            for (i = 0; i < 4; i++) {
+                wave[i * n + k] = cl[k].wave[i];
+            }
+        }
+        eq(&eqY, sigT, ones, 0, 0, bright, 4, 0, yT);
+        eq(&eqI, sigT, wave, 0, 9, 0, 0, 3, iT);
+        eq(&eqQ, sigT, wave, 3, 9, 0, 0, 3, qT);
+        
+        count = 0;
+        for (pos = cl->scanL; pos < unsigned(cl->scanR) && count < v->outw; pos += cl->dx) {
+            count++;
+        }
+        out(v, cl, yT, iT, qT, count);
+        for (k = 0; k < n; k++) {
+            dup_rows(v, &cl[k]);
+        }
+    }
+    return l0;
+}
+#endif  // #ifdef LSN_FILTER_KERNELS_X86
+
+extern void
+crt_draw_lines_fast(struct CRT_FAST *v, int l0, int l1)
+{
+    int line = l0;
+    
+#if defined(LSN_FILTER_KERNELS_X86) && !CRT_DO_BLOOM
+    /* lines are decoded side-by-side, which needs every line to have its own
+     * output row (inactive lines are always at the end)
+     */
+    int end = l0;
+    while (end < l1 && v->lines[end].active) {
+        end++;
+    }
+    int level = simd();
+    if (level != SIMD_NONE && v->outh >= CRT_LINES && end - line >= 4) {
+        int *buf = (int *) malloc(4 * AV_LEN * 16 * sizeof(int));
+        if (buf) {
+            if (level >= SIMD_AVX512) {
+                line = draw_lanes(v, line, end, 16, buf, eq_lanes_avx512, out_lanes_avx512);
+            }
+            if (level >= SIMD_AVX2) {
+                line = draw_lanes(v, line, end, 8, buf, eq_lanes_avx2, out_lanes_avx2);
+            }
+            line = draw_lanes(v, line, end, 4, buf, eq_lanes_sse4, out_lanes_sse4);
+            free(buf);
+        }
+    }
+#endif  // #if defined(LSN_FILTER_KERNELS_X86) && !CRT_DO_BLOOM
+    for (; line < l1; line++) {
+        if (v->lines[line].active) {
+            draw_line(v, &v->lines[line]);
+        }
+    }
+}
+
+extern void
+crt_draw_fast(struct CRT_FAST *v, int noise)
+{
+    crt_noise_lines_fast(v, noise, 0, CRT_VRES);
+    crt_sync_fast(v, noise);
+    crt_draw_lines_fast(v, CRT_TOP, CRT_BOT);
+}
@@ -8,8 +8,8 @@
  *   Discord: https://discord.com/invite/hdYctSmyQJ
  */
 /*****************************************************************************/
-#ifndef _CRT_H_
-#define _CRT_H_
+#ifndef _CRT_FAST_H_
+#define _CRT_FAST_H_
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,15 +69,28 @@ extern "C" {
 #define CRT_BOT         261    /* final line with active video */
 #define CRT_LINES       (CRT_BOT - CRT_TOP) /* number of active video lines */
 
-struct CRT {
+/* the decoding parameters of one scan line, found by crt_sync_fast() */
+struct CRT_FAST_LINE {
+    int pos; /* offset of the line's active video in inp */
+    int beg, end; /* output rows covered by the line (beg >= end to skip) */
+    int scanL, scanR, dx; /* output sampling */
+    int L, R; /* range of decoded samples */
+    int wave[4]; /* demodulation carrier */
+    int active; /* 0 if the line is not drawn */
+};
+
+struct CRT_FAST {
     signed char analog[CRT_INPUT_SIZE];
     signed char inp[CRT_INPUT_SIZE]; /* CRT input, can be noisy */
+    signed char inp_pad[CRT_HRES]; /* silence for lines that run past the end of inp */
     int hsync, vsync; /* used internally to keep track of sync over frames */
     int hue, brightness, contrast, saturation; /* common monitor settings */
     int black_point, white_point; /* user-adjustable */
     int outw, outh; /* output width/height */
     int *out; /* output image */
     int rn; /* random noise */
+    signed char mod[512][4]; /* NES pixel signal at each phase, from crt_nes2ntsc_prepare_fast() */
+    struct CRT_FAST_LINE lines[CRT_VRES]; /* filled by crt_sync_fast() */
 };
 
 /* Initializes the library. Sets up filters.
@@ -85,19 +98,19 @@ struct CRT {
  *   h   - height of the output image
  *   out - pointer to output image data 32-bit RGB packed as 0xXXRRGGBB
  */
-extern void crt_init(struct CRT *v, int w, int h, int *out);
+extern void crt_init_fast(struct CRT_FAST *v, int w, int h, int *out);
 
 /* Updates the output image parameters
  *   w   - width of the output image
  *   h   - height of the output image
  *   out - pointer to output image data 32-bit RGB packed as 0xXXRRGGBB
  */
-extern void crt_resize(struct CRT *v, int w, int h, int *out);
+extern void crt_resize_fast(struct CRT_FAST *v, int w, int h, int *out);
 
 /* Resets the CRT settings back to their defaults */
-extern void crt_reset(struct CRT *v);
+extern void crt_reset_fast(struct CRT_FAST *v);
 
-struct NTSC_SETTINGS {
+struct NTSC_SETTINGS_FAST {
     const int *rgb; /* 32-bit RGB image data (packed as 0xXXRRGGBB) */
     int w, h;       /* width and height of image */
     int raw;        /* 0 = scale image to fit monitor, 1 = don't scale */
@@ -119,7 +132,7 @@ struct NTSC_SETTINGS {
 /* Convert RGB image to analog NTSC signal
  *   s - struct containing settings to apply to this field
  */
-extern void crt_2ntsc(struct CRT *v, struct NTSC_SETTINGS *s);
+extern void crt_2ntsc_fast(struct CRT_FAST *v, struct NTSC_SETTINGS_FAST *s);
     
 /* Convert RGB image to analog NTSC signal and stretch it to fill
  * the entire active video portion of the NTSC signal.
@@ -128,9 +141,9 @@ extern void crt_2ntsc(struct CRT *v, struct NTSC_SETTINGS *s);
  *   s - struct containing settings to apply to this field
  *       NOTE: raw is ignored in this 'FS' (fill screen) version of the 2ntsc function
  */
-extern void crt_2ntscFS(struct CRT *v, struct NTSC_SETTINGS *s);
+extern void crt_2ntscFS_fast(struct CRT_FAST *v, struct NTSC_SETTINGS_FAST *s);
 
-struct NES_NTSC_SETTINGS {
+struct NES_NTSC_SETTINGS_FAST {
     const unsigned short *data; /* 6 or 9-bit NES 'pixels' */
     int w, h;       /* width and height of image */
     int raw;        /* 0 = scale image to fit monitor, 1 = don't scale */
@@ -153,15 +166,37 @@ struct NES_NTSC_SETTINGS {
 /* Convert NES pixel data (generally 256x240) to analog NTSC signal
  *   s - struct containing settings to apply to this field
  */
-extern void crt_nes2ntsc(struct CRT *v, struct NES_NTSC_SETTINGS *s);
+extern void crt_nes2ntsc_fast(struct CRT_FAST *v, struct NES_NTSC_SETTINGS_FAST *s);
 
-/* Decodes the NTSC signal generated by crt_2ntsc()
+/* The steps of crt_nes2ntsc_fast(), so that the lines can be split among threads.
+ * crt_nes2ntsc_prepare_fast() must be called once before the lines of a frame are
+ * converted, and after black_point or white_point change.
+ * crt_nes2ntsc_lines_fast() writes every sample that lands on lines [n0, n1)
+ * and no other samples, so disjoint line ranges can be converted at once.
+ */
+extern void crt_nes2ntsc_prepare_fast(struct CRT_FAST *v);
+extern void crt_nes2ntsc_lines_fast(struct CRT_FAST *v, const struct NES_NTSC_SETTINGS_FAST *s, int n0, int n1);
+
+/* Decodes the NTSC signal generated by crt_2ntsc_fast()
  *   noise - the amount of noise added to the signal (0 - inf)
  */
-extern void crt_draw(struct CRT *v, int noise);
+extern void crt_draw_fast(struct CRT_FAST *v, int noise);
+
+/* The steps of crt_draw_fast(), so that the lines can be split among threads.
+ *   crt_noise_lines_fast() - adds noise to lines [n0, n1) of the signal.
+ *   crt_sync_fast()        - finds the sync pulses and color bursts of every line
+ *                            once all lines have noise.  Not thread-safe.
+ *   crt_draw_lines_fast()  - decodes lines [l0, l1) (within CRT_TOP - CRT_BOT)
+ *                            to the output image after crt_sync_fast().
+ *                            Disjoint ranges can be decoded at once as long as
+ *                            outh >= CRT_LINES (each line has its own rows).
+ */
+extern void crt_noise_lines_fast(struct CRT_FAST *v, int noise, int n0, int n1);
+extern void crt_sync_fast(struct CRT_FAST *v, int noise);
+extern void crt_draw_lines_fast(struct CRT_FAST *v, int l0, int l1);
 
 /* Exposed utility function */
-extern void crt_sincos14(int *s, int *c, int n);
+extern void crt_sincos14_fast(int *s, int *c, int n);
 
 #ifdef __cplusplus
 }
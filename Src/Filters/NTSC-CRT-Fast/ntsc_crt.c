@@ -138,8 +138,8 @@ promptoverwrite(char *fn)
 int
 main(int argc, char **argv)
 {
-    struct NTSC_SETTINGS ntsc;
-    struct CRT crt;
+    struct NTSC_SETTINGS_FAST ntsc;
+    struct CRT_FAST crt;
     int *img;
     int imgw, imgh;
     int *output = NULL;
@@ -211,7 +211,7 @@ main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
-    crt_init(&crt, outw, outh, output);
+    crt_init_fast(&crt, outw, outh, output);
 
     ntsc.rgb = img;
     ntsc.w = imgw;
@@ -229,12 +229,12 @@ main(int argc, char **argv)
     err = 0;
     /* accumulate 4 frames */
     while (err < 4) {
-        crt_2ntsc(&crt, &ntsc);
-        crt_draw(&crt, noise);
+        crt_2ntsc_fast(&crt, &ntsc);
+        crt_draw_fast(&crt, noise);
         if (!progressive) {
             ntsc.field ^= 1;
-            crt_2ntsc(&crt, &ntsc);
-            crt_draw(&crt, noise);
+            crt_2ntsc_fast(&crt, &ntsc);
+            crt_draw_fast(&crt, noise);
         }
         err++;
     }
@@ -265,7 +265,7 @@ main(int argc, char **argv)
 static int *video = NULL;
 static VIDINFO *info;
 
-static struct CRT crt;
+static struct CRT_FAST crt;
 
 static int *img;
 static int imgw;
@@ -367,7 +367,7 @@ updatecb(void)
         color ^= 1;
     }
     if (pkb_key_pressed('r')) {
-        crt_reset(&crt);
+        crt_reset_fast(&crt);
     }
     if (pkb_key_pressed('f')) {
         field ^= 1;
@@ -423,15 +423,15 @@ fade_phosphors(void)
 static void
 displaycb(void)
 {
-    static struct NTSC_SETTINGS ntsc;
-    static struct NES_NTSC_SETTINGS nes;
+    static struct NTSC_SETTINGS_FAST ntsc;
+    static struct NES_NTSC_SETTINGS_FAST nes;
     static int fno = 0;
     int phase_ref[4] = { 0, 1, 0, -1 };
     int sn, cs;
     int i;
     
     for (i = 0; i < 4; i++) {
-        crt_sincos14(&sn, &cs, (hue + i * 90) * 8192 / 180);
+        crt_sincos14_fast(&sn, &cs, (hue + i * 90) * 8192 / 180);
         phase_ref[i] = sn >> 11;
     }
     
@@ -449,7 +449,7 @@ displaycb(void)
     nes.cc[2] = phase_ref[(phase_offset + 2) & 3];
     nes.cc[3] = phase_ref[(phase_offset + 3) & 3];
     nes.ccs = 16;
-    crt_nes2ntsc(&crt, &nes);
+    crt_nes2ntsc_fast(&crt, &nes);
 #else
     ntsc.rgb = img;
     ntsc.w = imgw;
@@ -462,10 +462,10 @@ displaycb(void)
     ntsc.cc[2] = phase_ref[(phase_offset + 2) & 3];
     ntsc.cc[3] = phase_ref[(phase_offset + 3) & 3];
     ntsc.ccs = 16;
-    crt_2ntsc(&crt, &ntsc);
+    crt_2ntsc_fast(&crt, &ntsc);
 #endif
     
-    crt_draw(&crt, noise);
+    crt_draw_fast(&crt, noise);
 
     vid_blit();
     vid_sync();
@@ -496,7 +496,7 @@ main(int argc, char **argv)
     info = vid_getinfo();
     video = info->video;
 
-    crt_init(&crt, info->width, info->height, video);
+    crt_init_fast(&crt, info->width, info->height, video);
 
     char *input_file;
     if (argc == 1) {
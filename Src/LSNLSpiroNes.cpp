@@ -23,8 +23,11 @@
 #endif	// #ifdef LSN_VULKAN1
 
 #ifdef LSN_CPU_VERIFY
-#include "File/LSNStdFile.h"
+#include "Cpu/LSNCpuVerifier.h"
 #endif	// #ifdef LSN_CPU_VERIFY
+#ifdef LSN_TEST_ROMS
+#include "System/LSNTestRomRunner.h"
+#endif	// #ifdef LSN_TEST_ROMS
 
 //#include "ColorSpace/LSNColorSpace.h"
 //#include "Time/LSNTimer.h"
@@ -32,12 +35,63 @@
 #pragma comment( lib, "winmm.lib" )
 
 
+#ifdef LSN_CPU_VERIFY
+/**
+ * Runs the CPU tests from the command line.
+ *	Usage: [json folder] [cache folder] [threads]
+ *	The JSON folder defaults to Research/nes6502/v1 and the cache folder to a Cache folder inside it.
+ *	"--bench [json folder]" instead times the DOM JSON parser against the streaming reader on the test files.
+ **/
+int main( int _iArgC, char * _pcArgV[] ) {
+	if ( _iArgC > 1 && std::strcmp( _pcArgV[1], "--bench" ) == 0 ) {
+		std::filesystem::path pJson = _iArgC > 2 ? std::filesystem::path( _pcArgV[2] ) : std::filesystem::path( "Research" ) / "nes6502" / "v1";
+		std::fputs( lsn::CCpuVerifier::Benchmark( pJson ).c_str(), stdout );
+		return 0;
+	}
+	std::filesystem::path pJson = _iArgC > 1 ? std::filesystem::path( _pcArgV[1] ) : std::filesystem::path( "Research" ) / "nes6502" / "v1";
+	std::filesystem::path pCache = _iArgC > 2 ? std::filesystem::path( _pcArgV[2] ) : pJson / "Cache";
+	size_t stThreads = _iArgC > 3 ? size_t( std::strtoul( _pcArgV[3], nullptr, 10 ) ) : 0;
+
+	lsn::CCpuVerifier::LSN_RESULTS rResults;
+	bool bPassed = lsn::CCpuVerifier::Run( pJson, pCache, rResults, stThreads );
+	std::fputs( lsn::CCpuVerifier::Report( rResults, true ).c_str(), stdout );
+	return bPassed ? 0 : 1;
+}
+#elif defined( LSN_TEST_ROMS )
+/**
+ * Runs test ROMs headlessly from the command line and prints one result per ROM.
+ *	Usage: [-frames N] [ROM or folder]...
+ *	Folders are searched recursively for .nes files.  The default is the MMC3 IRQ tests (Research/nes-test-roms-master/mmc3_test_2/rom_singles
+ *	and Research/nes-test-roms-master/mmc3_irq_tests), whose output can be compared between builds with and without LSN_MMC3_EXACT_A12.
+ **/
+int main( int _iArgC, char * _pcArgV[] ) {
+	uint32_t ui32Frames = 600;
+	std::vector<std::filesystem::path> vPaths;
+	for ( int I = 1; I < _iArgC; ++I ) {
+		if ( std::strcmp( _pcArgV[I], "-frames" ) == 0 && I + 1 < _iArgC ) {
+			ui32Frames = uint32_t( std::strtoul( _pcArgV[++I], nullptr, 10 ) );
+		}
+		else { vPaths.push_back( std::filesystem::path( _pcArgV[I] ) ); }
+	}
+	if ( vPaths.empty() ) {
+		std::filesystem::path pRoms = std::filesystem::path( "Research" ) / "nes-test-roms-master";
+		vPaths.push_back( pRoms / "mmc3_test_2" / "rom_singles" );
+		vPaths.push_back( pRoms / "mmc3_irq_tests" );
+	}
+
+	std::vector<lsn::CTestRomRunner::LSN_ROM_RESULT> vResults;
+	bool bPassed = lsn::CTestRomRunner::Run( vPaths, ui32Frames, vResults );
+	std::fputs( lsn::CTestRomRunner::Report( vResults ).c_str(), stdout );
+	return bPassed ? 0 : 1;
+}
+#else
 int main() {
 	return 0;
 }
+#endif	// #ifdef LSN_CPU_VERIFY
 
 #ifdef LSN_USE_WINDOWS
-#if !defined( LSN_CPU_VERIFY )
+#if !defined( LSN_CPU_VERIFY ) && !defined( LSN_TEST_ROMS )
 int WINAPI wWinMain( _In_ HINSTANCE _hInstance, _In_opt_ HINSTANCE /*_hPrevInstance*/, _In_ LPWSTR /*_lpCmdLine*/, _In_ int /*_nCmdShow*/ ) {
 	lsw::CBase::Initialize( _hInstance, new lsn::CLayoutManager(),
 		L"LSNDOCK",
@@ -46,7 +100,6 @@ int WINAPI wWinMain( _In_ HINSTANCE _hInstance, _In_opt_ HINSTANCE /*_hPrevInsta
 		L"LSNTREEVIEW",
 		L"LSNTREELISTVIEW",
 		L"LSNCHILDWINDOW" );
-	lsn::CDatabase::Init();
 	lsn::CDirectInput8::CreateDirectInput8();
 	lsn::CAudio::InitializeAudio();
 
@@ -204,7 +257,6 @@ int WINAPI wWinMain( _In_ HINSTANCE _hInstance, _In_opt_ HINSTANCE /*_hPrevInsta
 
 	lsn::CAudio::ShutdownAudio( true );
 	lsw::CBase::ShutDown();
-	lsn::CDatabase::Reset();
 	lsn::CDirectInput8::Release();
 
 	if ( bTimePeriod ) {
@@ -212,87 +264,42 @@ int WINAPI wWinMain( _In_ HINSTANCE _hInstance, _In_opt_ HINSTANCE /*_hPrevInsta
 	}
 	return static_cast<int>(mMsg.wParam);
 }
-#else	// #if !defined( LSN_CPU_VERIFY )
-#include "LSONJson.h"
+#elif defined( LSN_CPU_VERIFY )
 int WINAPI wWinMain( _In_ HINSTANCE /*_hInstance*/, _In_opt_ HINSTANCE /*_hPrevInstance*/, _In_ LPWSTR /*_lpCmdLine*/, _In_ int /*_nCmdShow*/ ) {
-	std::unique_ptr<lsn::CCpuBus> pbBus = std::make_unique<lsn::CCpuBus>();
-	pbBus->ApplyMap();
-	std::unique_ptr<lsn::CCpu6502> pcCpu = std::make_unique<lsn::CCpu6502>( pbBus.get(), nullptr );
-
 	std::wstring wsBuffer;
 	const DWORD dwSize = 0xFFFF;
 	wsBuffer.resize( dwSize + 1 ); 
 	::GetModuleFileNameW( NULL, wsBuffer.data(), dwSize );
 	PWSTR pwsEnd = std::wcsrchr( wsBuffer.data(), L'\\' ) + 1;
 	std::wstring wsRoot = wsBuffer.substr( 0, pwsEnd - wsBuffer.data() );
-	{
-		for ( uint32_t I = 0x00; I < 0x100; ++I ) {
-			std::wstring wsFile;
-			lson::CJson jSon;
-			std::vector<uint8_t> vBytes;
-			lsn::CStdFile sfFile;
-			wchar_t wcFile[64];
-			std::swprintf( wcFile, L"..\\..\\Research\\nes6502\\v1\\%.2X.json", I );
-			if ( sfFile.Open( reinterpret_cast<const char16_t *>((wsRoot + wcFile).c_str()) ) ) {
-				sfFile.LoadToMemory( vBytes );
-				vBytes.push_back( 0 );
-
-				if ( !jSon.SetJson( reinterpret_cast<const char *>(vBytes.data()) ) ) {
-					lsn::DebugA( "JSON FAIL\r\n" );
-				}
-				else {
-					pcCpu->ResetToKnown();
-					pbBus->ApplyMap();
-
-					int32_t i32MinSize = INT32_MAX, i32MaxSize = 0;
-
-					const lson::CJsonContainer::LSON_JSON_VALUE & jvRoot = jSon.GetContainer()->GetValue( jSon.GetContainer()->GetRoot() );
-					for ( size_t J = 0; J < jvRoot.vArray.size(); ++J ) {
-						if ( J >= 9000 && i32MinSize != lsn::CCpu6502::InstrTable()[I].ui8TotalCycles && lsn::CCpu6502::InstrTable()[I].iInstruction != lsn::CCpu6502::LSN_I_JAM ) {
-							lsn::DebugLine( std::format( "\r\n\r\n\r\n*** CHECK CYCLE COUNT {} -> {} ***\r\n\r\n\r\n\r\n\r\n", lsn::CCpu6502::InstrTable()[I].ui8TotalCycles,
-								i32MinSize ) );
-						}
-
-#ifdef LSN_CYCLES_DOC
-						if ( i32MinSize == i32MaxSize ) {
-							lsn::DebugLine( std::format( "{} ({:02X})\tCycles: {}\tSize: {}\r\n"
-							"\t{}\r\nCycle\tR/W\tDesc.", lsn::CCpu6502::m_smdInstMetaData[lsn::CCpu6502::InstrTable()[I].iInstruction].pcName, I,
-								i32MinSize,
-								lsn::CCpu6502::InstrTable()[I].ui8Size,
-								lsn::CCpu6502::InstrTable()[I].pcTypeString ) );
-						}
-						else {
-							
-							lsn::DebugLine( std::format( "{} ({:02X})\tCycles: {}-{}\tSize: {}\r\n"
-							"\t{}\r\nCycle\tR/W\tDesc.", lsn::CCpu6502::m_smdInstMetaData[lsn::CCpu6502::InstrTable()[I].iInstruction].pcName, I,
-								i32MinSize, i32MaxSize,
-								lsn::CCpu6502::InstrTable()[I].ui8Size,
-								lsn::CCpu6502::InstrTable()[I].pcTypeString ) );
-						}
-#endif	// #ifdef LSN_CYCLES_DOC
-
-						const lson::CJsonContainer::LSON_JSON_VALUE & jvThis = jSon.GetContainer()->GetValue( jvRoot.vArray[J] );
-						int32_t i32Cycles = pcCpu->RunJsonTest( jSon, jvThis );
-						if ( i32Cycles > 0 ) {
-							i32MinSize = std::min( i32MinSize, i32Cycles );
-							i32MaxSize = std::max( i32MaxSize, i32Cycles );
-						}
-					}
 
+	std::filesystem::path pJson = std::filesystem::path( wsRoot + L"..\\..\\Research\\nes6502\\v1" );
+	lsn::CCpuVerifier::LSN_RESULTS rResults;
 #ifdef LSN_CYCLES_DOC
-					lsn::DebugLine( std::format( "Min: {}\tMax: {}", i32MinSize, i32MaxSize ).c_str() );
+	// Cycle documentation is printed as the tests run and must not be interleaved.
+	lsn::CCpuVerifier::Run( pJson, pJson / L"Cache", rResults, 1 );
+#else
+	lsn::CCpuVerifier::Run( pJson, pJson / L"Cache", rResults );
 #endif	// #ifdef LSN_CYCLES_DOC
+	lsn::DebugA( lsn::CCpuVerifier::Report( rResults ).c_str() );
+	return 0;
+}
+#else
+int WINAPI wWinMain( _In_ HINSTANCE /*_hInstance*/, _In_opt_ HINSTANCE /*_hPrevInstance*/, _In_ LPWSTR /*_lpCmdLine*/, _In_ int /*_nCmdShow*/ ) {
+	std::wstring wsBuffer;
+	const DWORD dwSize = 0xFFFF;
+	wsBuffer.resize( dwSize + 1 ); 
+	::GetModuleFileNameW( NULL, wsBuffer.data(), dwSize );
+	PWSTR pwsEnd = std::wcsrchr( wsBuffer.data(), L'\\' ) + 1;
+	std::wstring wsRoot = wsBuffer.substr( 0, pwsEnd - wsBuffer.data() );
 
-					lsn::DebugA( "JSON NOT FAIL\r\n" );
-					::OutputDebugStringW( wcFile );
-					lsn::DebugA( "\r\n" );
-				}
-			}
-		}
-	}
+	std::filesystem::path pRoms = std::filesystem::path( wsRoot + L"..\\..\\Research\\nes-test-roms-master" );
+	std::vector<lsn::CTestRomRunner::LSN_ROM_RESULT> vResults;
+	lsn::CTestRomRunner::Run( { pRoms / L"mmc3_test_2" / L"rom_singles", pRoms / L"mmc3_irq_tests" }, 600, vResults );
+	lsn::DebugA( lsn::CTestRomRunner::Report( vResults ).c_str() );
 	return 0;
 }
-#endif	// #if !defined( LSN_CPU_VERIFY )
+#endif	// #if !defined( LSN_CPU_VERIFY ) && !defined( LSN_TEST_ROMS )
 #else
 int wmain( int /*_iArgC*/, wchar_t * /*_pwcArgv*/[] ) {
 #define LSN_PATH				u"J:\\My Projects\\L. Spiro NES\\Tests\\nestest.nes"
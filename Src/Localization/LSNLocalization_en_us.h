@@ -69,6 +69,7 @@
 #define LSN_VIDEO_FILTER_PALM_L_SPIRO										PAL-&M (Brazil Famiclone) (L. Spiro)
 #define LSN_VIDEO_FILTER_PALN_L_SPIRO										PAL-&N (Argentina Famiclone) (L. Spiro)
 #define LSN_VIDEO_FILTER_NTSC_CRT_FULL										NTSC-M (LMP&88959)
+#define LSN_VIDEO_FILTER_NTSC_CRT_FAST										NTSC-M Fa&st (LMP88959)
 #define LSN_VIDEO_FILTER_PAL_CRT_FULL										PAL-B/B1/D/D1/G/H/I/K (LMP88&959)
 #define LSN_VIDEO_FILTER_AUTO_CRT_FULL										NTSC/PAL Auto (LMP889&59)
 #define LSN_VIDEO_FILTER_AUTO_LSPIRO										NTSC/PAL &Auto (L. Spiro)
@@ -267,6 +268,7 @@
 #define LSN_AUDIO_OPTIONS_NON_SILENT										First Non-Zero
 #define LSN_AUDIO_OPTIONS_DURATION											Duration (Seconds)
 #define LSN_AUDIO_OPTIONS_SILENCE_FOR										Silence for (Seconds)
+#define LSN_AUDIO_OPTIONS_EXPRESSION										While Expression Is True								// Uses sample, idx, time, count, and b[$4000]-b[$4017].
 #define LSN_AUDIO_OPTIONS_WAV_TYPES											WAV Files (*.wav)\0*.wav\0\0
 #define LSN_AUDIO_OPTIONS_TXT_TYPES											TXT Files (*.txt)\0*.txt\0\0
 #define LSN_AUDIO_OPTIONS_METADATA											Metadata
@@ -294,6 +296,7 @@
 #define LSN_AUDIO_OPTIONS_ERR_INVALID_END_COND								The selected stopping condition requires a valid numeric input.  This can be in the form of raw numbers (\u201C10\u201D, \u201C5.5\u201D, \u201C0.5f\u201D, etc.) or as equations (\u201C3*60+10.5\u201D, \u201Clog10( 0.5 ) * 20\u201D, etc.)
 #define LSN_AUDIO_OPTIONS_ERR_INVALID_DURATION								Durations must be positive values larger than 0.
 #define LSN_AUDIO_OPTIONS_ERR_INVALID_STOP_SAMPLE							The stop sample must be greater than the start sample.
+#define LSN_AUDIO_OPTIONS_ERR_INVALID_EXPRESSION							The selected condition requires a valid expression.  It can use \u201Csample\u201D, \u201Cidx\u201D, \u201Ctime\u201D, \u201Ccount\u201D, and the APU registers (\u201Cb[$4015]\u201D, etc.), as in \u201Cabs( sample ) > 0.1 && (b[$4015] & 1)\u201D.
 
 // Patcher.
 #define LSN_PATCH_PATCH_ROM													iPatch: Patch a ROM
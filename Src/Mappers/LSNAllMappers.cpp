@@ -0,0 +1,11 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The one translation unit that compiles the mappers.  Each mapper header registers itself with CMapperRegistry, so
+ *	including them all here is what makes them available to the system.
+ */
+
+
+#include "LSNAllMappers.h"
@@ -0,0 +1,106 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Battery-backed cartridge RAM kept in a memory-mapped save file.
+ */
+
+
+#include "LSNBatteryRam.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+
+namespace lsn {
+
+	CBatteryRam::~CBatteryRam() {
+		Close();
+	}
+
+	// == Functions.
+	/**
+	 * Opens a save file, creating it only if it does not exist, and maps its first _sSize bytes.  A file smaller than _sSize is
+	 *	grown and the bytes it did not already have are copied from _pui8Initial; a larger file is never shrunk.
+	 *
+	 * \param _pFile The save file.
+	 * \param _sSize The size of the RAM.
+	 * \param _pui8Initial The current contents of the RAM, used for any bytes the save file does not have.  Can be nullptr.
+	 * \return Returns a pointer to the mapped RAM, or nullptr if the file could not be opened or mapped.
+	 */
+	uint8_t * CBatteryRam::Open( const std::filesystem::path &_pFile, size_t _sSize, const uint8_t * _pui8Initial ) {
+		Close();
+		if ( !_sSize ) { return nullptr; }
+		try {
+			std::error_code ecErr;
+			if ( _pFile.has_parent_path() ) { std::filesystem::create_directories( _pFile.parent_path(), ecErr ); }
+
+			// A save file that exists but cannot be opened (locked, no permission, etc.) is an error, not a reason to replace it.
+			if ( !m_fmFile.OpenOrCreate( _pFile ) ) { return nullptr; }
+			uint64_t ui64Existing = m_fmFile.Size();
+
+			if ( ui64Existing < _sSize && !m_fmFile.Resize( _sSize ) ) {
+				m_fmFile.Close();
+				return nullptr;
+			}
+			if ( !m_fmFile.MapView( 0, _sSize, m_vView ) ) {
+				m_fmFile.Close();
+				return nullptr;
+			}
+			// Bytes the file did not already have take the RAM's current contents.
+			size_t sKept = size_t( std::min<uint64_t>( ui64Existing, _sSize ) );
+			if ( _pui8Initial && sKept < _sSize ) {
+				std::memcpy( m_vView.pui8Data + sKept, _pui8Initial + sKept, _sSize - sKept );
+			}
+
+			m_bStop = false;
+			m_tFlush = std::thread( &CBatteryRam::FlushThread, this );
+			return m_vView.pui8Data;
+		}
+		catch ( ... ) {
+			Close();
+			return nullptr;
+		}
+	}
+
+	/**
+	 * Starts writing any modified RAM back to the save file.
+	 *
+	 * \return Returns true if no file is open or the write-back was started.
+	 */
+	bool CBatteryRam::Flush() {
+		if ( !m_vView.pui8Base ) { return true; }
+		return CFileMap::FlushView( m_vView );
+	}
+
+	/**
+	 * Stops the flush thread, flushes, and unmaps the save file.  Pointers returned by Open() become invalid.
+	 */
+	void CBatteryRam::Close() {
+		if ( m_tFlush.joinable() ) {
+			{
+				std::lock_guard<std::mutex> lgLock( m_mMutex );
+				m_bStop = true;
+			}
+			m_cvStop.notify_one();
+			m_tFlush.join();
+		}
+		Flush();
+		CFileMap::UnmapView( m_vView );
+		m_fmFile.Close();
+	}
+
+	/**
+	 * The flush thread.  Flushes the view every LSN_FLUSH_INTERVAL_MS until told to stop.
+	 */
+	void CBatteryRam::FlushThread() {
+		std::unique_lock<std::mutex> ulLock( m_mMutex );
+		while ( !m_cvStop.wait_for( ulLock, std::chrono::milliseconds( LSN_FLUSH_INTERVAL_MS ), [&]() { return m_bStop; } ) ) {
+			// Only the pages the OS has marked dirty are written.
+			CFileMap::FlushView( m_vView );
+		}
+	}
+
+}	// namespace lsn
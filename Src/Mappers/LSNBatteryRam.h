@@ -0,0 +1,106 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Battery-backed cartridge RAM kept in a memory-mapped save file.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+#include "../File/LSNFileMap.h"
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+
+namespace lsn {
+
+	/**
+	 * Class CBatteryRam
+	 * \brief Battery-backed cartridge RAM kept in a memory-mapped save file.
+	 *
+	 * Description: Maps a save file and hands out a pointer into the mapping for a mapper to use as its PRG RAM (or EEPROM storage)
+	 *	directly.  Writes by the emulator are ordinary memory writes; the OS tracks which pages they dirty, and a background thread asks
+	 *	for the dirty pages to be written back at most once per LSN_FLUSH_INTERVAL_MS.  Because the mapping is shared with the file, the
+	 *	contents survive even if the emulator closes abnormally.
+	 */
+	class CBatteryRam {
+	public :
+		CBatteryRam() {}
+		~CBatteryRam();
+
+
+		// == Enumerations.
+		enum : uint32_t {
+			LSN_FLUSH_INTERVAL_MS						= 1000,										/**< The minimum time between background flushes. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Opens a save file, creating it only if it does not exist, and maps its first _sSize bytes.  A file smaller than _sSize is
+		 *	grown and the bytes it did not already have are copied from _pui8Initial; a larger file is never shrunk.
+		 *
+		 * \param _pFile The save file.
+		 * \param _sSize The size of the RAM.
+		 * \param _pui8Initial The current contents of the RAM, used for any bytes the save file does not have.  Can be nullptr.
+		 * \return Returns a pointer to the mapped RAM, or nullptr if the file could not be opened or mapped.
+		 */
+		uint8_t *										Open( const std::filesystem::path &_pFile, size_t _sSize, const uint8_t * _pui8Initial );
+
+		/**
+		 * Starts writing any modified RAM back to the save file.
+		 *
+		 * \return Returns true if no file is open or the write-back was started.
+		 */
+		bool											Flush();
+
+		/**
+		 * Stops the flush thread, flushes, and unmaps the save file.  Pointers returned by Open() become invalid.
+		 */
+		void											Close();
+
+		/**
+		 * Gets the mapped RAM.
+		 *
+		 * \return Returns the mapped RAM or nullptr if no file is open.
+		 */
+		inline uint8_t *								Data() const { return m_vView.pui8Data; }
+
+		/**
+		 * Gets the size of the mapped RAM.
+		 *
+		 * \return Returns the size of the mapped RAM in bytes.
+		 */
+		inline size_t									Size() const { return m_vView.sSize; }
+
+
+	protected :
+		// == Members.
+		/** The save file. */
+		CFileMap										m_fmFile;
+		/** The view of the save file. */
+		CFileMap::LSN_VIEW								m_vView;
+		/** The background flush thread. */
+		std::thread										m_tFlush;
+		/** Guards m_bStop. */
+		std::mutex										m_mMutex;
+		/** Wakes the flush thread early to stop it. */
+		std::condition_variable							m_cvStop;
+		/** Tells the flush thread to exit. */
+		bool											m_bStop = false;
+
+
+		// == Functions.
+		/**
+		 * The flush thread.  Flushes the view every LSN_FLUSH_INTERVAL_MS until told to stop.
+		 */
+		void											FlushThread();
+	};
+
+}	// namespace lsn
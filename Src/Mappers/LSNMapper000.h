@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -58,4 +59,6 @@ namespace lsn {
 		// == Members.
 	};
 
+	LSN_REGISTER_MAPPER( CMapper000, 0, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
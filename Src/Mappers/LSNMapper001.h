@@ -12,6 +12,7 @@
 #include "../LSNLSpiroNes.h"
 #include "../Database/LSNDatabase.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 
 namespace lsn {
@@ -107,6 +108,9 @@ namespace lsn {
 				m_crChrBanks[I].ui8PgmRamBank = GetBank( m_crChrBanks[I].ui8PgmRamBank, m_sPgmRamSize, PgmRamBankSize() );
 			}
 
+			std::memset( m_ui8PgmRam, 0, sizeof( m_ui8PgmRam ) );
+			m_pui8PgmRam = MapBatteryRam( m_ui8PgmRam, m_sPgmRamSize );
+
 			// For types that have outer banks.
 			if ( m_prRom->riInfo.ui16PcbClass == CDatabase::LSN_PC_SOROM ||
 				m_prRom->riInfo.ui16PcbClass == CDatabase::LSN_PC_SUROM ||
@@ -120,7 +124,7 @@ namespace lsn {
 				}
 				// Outer RAM banks.
 				for ( size_t I = 0; I < std::size( m_puiPgmRamOuterBanks ); ++I ) {
-					m_puiPgmRamOuterBanks[I] = &m_ui8PgmRam[GetBank( uint8_t( I ), m_sPgmRamSize, PgmRamBankSize() )*PgmRamBankSize()];
+					m_puiPgmRamOuterBanks[I] = &m_pui8PgmRam[GetBank( uint8_t( I ), m_sPgmRamSize, PgmRamBankSize() )*PgmRamBankSize()];
 				}
 			}
 			else {
@@ -130,12 +134,11 @@ namespace lsn {
 				}
 				// No outer RAM banks.
 				for ( size_t I = 0; I < std::size( m_puiPgmRamOuterBanks ); ++I ) {
-					m_puiPgmRamOuterBanks[I] = m_ui8PgmRam;
+					m_puiPgmRamOuterBanks[I] = m_pui8PgmRam;
 				}
 			}
 
 			m_bRamEnabled = GetRamEnabled();
-			std::memset( m_ui8PgmRam, 0, sizeof( m_ui8PgmRam ) );
 		}
 
 		/**
@@ -236,6 +239,8 @@ namespace lsn {
 		size_t											m_sPgmRamSize = 8 * 1024;
 		/** The PGM RAM. */
 		uint8_t											m_ui8PgmRam[32*1024];
+		/** The PGM RAM in use (m_ui8PgmRam or the battery-backed save file). */
+		uint8_t *										m_pui8PgmRam = m_ui8PgmRam;
 		/** PGM-ROM outer banks. */
 		uint8_t *										m_puiPgmRomOuterBanks[16];
 		/** PGM-RAM outer banks. */
@@ -350,7 +355,7 @@ namespace lsn {
 		static void LSN_FASTCALL						Mapper001PgmRamRead( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
 			CMapper001 * pmThis = reinterpret_cast<CMapper001 *>(_pvParm0);
 			if ( pmThis->m_bRamEnabled ) {
-				_ui8Ret = pmThis->m_ui8PgmRam[_ui16Parm1];
+				_ui8Ret = pmThis->m_pui8PgmRam[_ui16Parm1];
 			}
 		}
 
@@ -365,7 +370,7 @@ namespace lsn {
 		static void LSN_FASTCALL						Mapper001PgmRamWrite( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper001 * pmThis = reinterpret_cast<CMapper001 *>(_pvParm0);
 			if ( pmThis->m_bRamEnabled ) {
-				pmThis->m_ui8PgmRam[_ui16Parm1] = _ui8Val;
+				pmThis->m_pui8PgmRam[_ui16Parm1] = _ui8Val;
 			}
 		}
 
@@ -852,5 +857,7 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper001, 1, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
 
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -135,4 +136,6 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper002, 2, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -69,6 +70,11 @@ namespace lsn {
 
 
 			m_bAndConflicts = _rRom.riInfo.ui16SubMapper == 2;
+
+			if ( _rRom.i32WorkRamSize > 0 ) {
+				m_vPrgRam.assign( size_t( _rRom.i32WorkRamSize ), 0 );
+				m_pui8PrgRam = MapBatteryRam( m_vPrgRam.data(), m_vPrgRam.size() );
+			}
 		}
 
 		/**
@@ -89,8 +95,7 @@ namespace lsn {
 				_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapperBase::StdMapperCpuRead, this, uint16_t( (I - 0x8000) % m_prRom->vPrgRom.size() ) );
 			}
 
-			if ( m_prRom->i32WorkRamSize ) {
-				m_vPrgRam.resize( m_prRom->i32WorkRamSize );
+			if ( m_prRom->i32WorkRamSize > 0 ) {
 				for ( uint32_t I = 0x6000; I < 0x8000; ++I ) {
 					_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapper003::ReadWRam, this, uint16_t( (I - 0x6000) % m_prRom->i32WorkRamSize ) );
 					_pbCpuBus->SetWriteFunc( uint16_t( I ), &CMapper003::WriteWRam, this, uint16_t( (I - 0x6000) % m_prRom->i32WorkRamSize ) );
@@ -121,6 +126,7 @@ namespace lsn {
 	protected :
 		// == Members.
 		std::vector<uint8_t>							m_vPrgRam;										/**< PRG RAM. */
+		uint8_t *										m_pui8PrgRam = nullptr;							/**< The PRG RAM in use (m_vPrgRam or the battery-backed save file). */
 		uint8_t											m_ui8ChrBankMask = 0b00000011;					/**< CHR banking mask. */
 		bool											m_bAndConflicts = false;						/**< AND-type bus conflicts. */
 
@@ -154,7 +160,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						ReadWRam( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
 			CMapper003 * pmThis = reinterpret_cast<CMapper003 *>(_pvParm0);
-			_ui8Ret = pmThis->m_vPrgRam[_ui16Parm1];
+			_ui8Ret = pmThis->m_pui8PrgRam[_ui16Parm1];
 		}
 
 		/**
@@ -167,9 +173,11 @@ namespace lsn {
 		 **/
 		static void LSN_FASTCALL						WriteWRam( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper003 * pmThis = reinterpret_cast<CMapper003 *>(_pvParm0);
-			pmThis->m_vPrgRam[_ui16Parm1] = _ui8Val;
+			pmThis->m_pui8PrgRam[_ui16Parm1] = _ui8Val;
 		}
 		
 	};
 
+	LSN_REGISTER_MAPPER( CMapper003, 3, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
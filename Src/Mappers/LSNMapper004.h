@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -56,6 +57,9 @@ namespace lsn {
 			SetPgmBank<2, PgmBankSize()>( -2 );
 
 			m_ui8Reg0 = m_ui8Reg1 = 0;
+
+			std::memset( m_ui8PrgRam, 0, sizeof( m_ui8PrgRam ) );
+			m_pui8PrgRam = MapBatteryRam( m_ui8PrgRam, sizeof( m_ui8PrgRam ) );
 		}
 
 		/**
@@ -120,6 +124,12 @@ namespace lsn {
 					_pbPpuBus->SetReadFunc( uint16_t( I ), &Read_CHR_1C00_1FFF, this, uint16_t( I - 0x1C00 ) );
 				}
 			}
+			else {
+				// CHR RAM is mapped by the base class; read it through here so that its fetches still drive the IRQ counter.
+				for ( uint32_t I = 0x0000; I < 0x2000; ++I ) {
+					_pbPpuBus->SetReadFunc( uint16_t( I ), &Read_CHR_RAM, this, uint16_t( I ) );
+				}
+			}
 			// RAM.
 			for ( uint32_t I = 0x6000; I < 0x8000; ++I ) {
 				_pbCpuBus->SetReadFunc( uint16_t( I ), &Mapper004PgmRamRead, this, uint16_t( I - 0x6000 ) );
@@ -178,6 +188,18 @@ namespace lsn {
 			else {
 				ApplyControllableMirrorMap( _pbPpuBus );
 			}
+
+
+			// ================
+			// IRQ
+			// ================
+#ifndef LSN_MMC3_EXACT_A12
+			// Clock the counter from the PPU's rendering state once per scanline instead of filtering every pattern fetch.
+			if ( m_ppbPpu ) {
+				m_ppbPpu->SetSpriteFetchFunc( &CMapper004::Mmc3_OnSpriteFetch, this );
+				m_ppbPpu->SetPpuCtrlWriteFunc( &CMapper004::Mmc3_OnPpuCtrlWrite, this );
+			}
+#endif	// #ifndef LSN_MMC3_EXACT_A12
 		}
 
 		/**
@@ -193,6 +215,9 @@ namespace lsn {
 			m_ui64LastA12LowCpu = 0;
 			m_bA12PrevRaw = false;
 			m_bA12FilteredHigh = false;
+			m_ui64A12PredictedAt = 0;
+			m_ui64A12PredictedUntil = 0;
+			m_ui8A12PredictedCtrl = 0;
 
 			// Clear any mapper IRQ line.
 			if ( m_pInterruptable ) {
@@ -205,6 +230,8 @@ namespace lsn {
 		// == Members.
 		/** PRG RAM, up to 8 kilobytes. Optional. */
 		uint8_t											m_ui8PrgRam[8*1024];
+		/** The PRG RAM in use (m_ui8PrgRam or the battery-backed save file). */
+		uint8_t *										m_pui8PrgRam = m_ui8PrgRam;
 		/** Register 1. */
 		uint8_t											m_ui8Reg0;
 		/** Register 2. */
@@ -243,6 +270,13 @@ namespace lsn {
 		/** Whether the **filtered** A12 is currently considered high (disarmed). */
 		bool											m_bA12FilteredHigh = false;
 
+		/** The PPU cycle at which the current A12 prediction was made (the first sprite fetch of its scanline). */
+		uint64_t										m_ui64A12PredictedAt = 0;
+		/** The PPU cycle until which A12 edges are being predicted from the rendering state rather than sampled, or 0. */
+		uint64_t										m_ui64A12PredictedUntil = 0;
+		/** The PPUCTRL value the current A12 prediction was made with. */
+		uint8_t											m_ui8A12PredictedCtrl = 0;
+
 
 
 
@@ -682,6 +716,20 @@ namespace lsn {
 			pmThis->Mmc3_OnPpuA12Sample( uint16_t( 0x1C00 + _ui16Parm1 ) );
 		}
 
+		/**
+		 * Handles reads from CHR RAM at $0000-$1FFF.
+		 *
+		 * \param _pvParm0 A data value assigned to this address.
+		 * \param _ui16Parm1 A 16-bit parameter assigned to this address.  Typically this will be the address to read from _pui8Data.  It is not constant because sometimes reads do modify status registers etc.
+		 * \param _pui8Data The buffer from which to read.
+		 * \param _ui8Ret The read value.
+		 */
+		static void LSN_FASTCALL						Read_CHR_RAM( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
+			CMapper004 * pmThis = reinterpret_cast<CMapper004 *>(_pvParm0);
+			_ui8Ret = pmThis->m_ui8DefaultChrRam[_ui16Parm1];
+			pmThis->Mmc3_OnPpuA12Sample( _ui16Parm1 );
+		}
+
 		/**
 		 * Reads from the PGM RAM.
 		 *
@@ -702,7 +750,7 @@ namespace lsn {
 			 *	+--------- PRG RAM chip enable (0: disable; 1: enable)
 			 */
 			if ( pmThis->m_ui8Reg1 & 0b10000000 ) {
-				_ui8Ret = pmThis->m_ui8PrgRam[_ui16Parm1];
+				_ui8Ret = pmThis->m_pui8PrgRam[_ui16Parm1];
 			}
 		}
 
@@ -726,7 +774,7 @@ namespace lsn {
 			 *	+--------- PRG RAM chip enable (0: disable; 1: enable)
 			 */
 			if ( (pmThis->m_ui8Reg1 & 0b11000000) == 0b10000000 ) {
-				pmThis->m_ui8PrgRam[_ui16Parm1] = _ui8Val;
+				pmThis->m_pui8PrgRam[_ui16Parm1] = _ui8Val;
 			}
 			
 		}
@@ -744,6 +792,9 @@ namespace lsn {
 		 * @param _ui16PpuAddr The absolute PPU address being accessed (0x0000-0x1FFF).
 		 */
 		inline void										Mmc3_OnPpuA12Sample( uint16_t _ui16PpuAddr ) {
+			// Rendering fetches covered by Mmc3_PredictA12() need no sampling.
+			if ( m_ppbPpu->GetCycleCount() < m_ui64A12PredictedUntil ) { return; }
+
 			const bool bA12Raw = ((_ui16PpuAddr & 0x1000) != 0);
 			const uint64_t ui64CpuNow = m_pcbCpu->GetCycleCount();
 
@@ -816,6 +867,111 @@ namespace lsn {
 			}
 		}
 
+		/**
+		 * Called by the PPU at the first sprite pattern fetch (dot 261) of each rendered scanline.
+		 *
+		 * \param _pvParm0 The mapper.
+		 * \param _ui8PpuCtrl The current PPUCTRL value.
+		 */
+		static void LSN_FASTCALL						Mmc3_OnSpriteFetch( void * _pvParm0, uint8_t _ui8PpuCtrl ) {
+			CMapper004 * pmThis = reinterpret_cast<CMapper004 *>(_pvParm0);
+			pmThis->Mmc3_PredictA12( _ui8PpuCtrl );
+		}
+
+		/**
+		 * Called by the PPU on every write to PPUCTRL.
+		 *
+		 * \param _pvParm0 The mapper.
+		 * \param _ui8PpuCtrl The new PPUCTRL value.
+		 */
+		static void LSN_FASTCALL						Mmc3_OnPpuCtrlWrite( void * _pvParm0, uint8_t _ui8PpuCtrl ) {
+			CMapper004 * pmThis = reinterpret_cast<CMapper004 *>(_pvParm0);
+			pmThis->Mmc3_CheckA12Prediction( _ui8PpuCtrl );
+		}
+
+		/**
+		 * Derives this scanline's A12 rising edge from the pattern tables selected in PPUCTRL.
+		 *
+		 * With 8-by-8 sprites the PPU fetches background patterns through dot 256 and sprite patterns from dot 257, so A12 can only
+		 *	rise (after a long enough low period) at the first sprite fetch, which is now.  That is 1 clock per line when sprites use
+		 *	$1000 and the background uses $0000, and no clocks when both use the same table.  Other arrangements (8-by-16 sprites or the
+		 *	background at $1000 and sprites at $0000) rise at other points, so every fetch of such a line is sampled instead.
+		 *
+		 * The edge detector is left in the state exact sampling would have produced, and sampling is skipped until just past the next
+		 *	line's sprite fetches (or until PPUCTRL changes the pattern tables), after which (V-blank, rendering disabled) it takes over
+		 *	again for CPU-driven $2006/$2007 accesses.
+		 *
+		 * \param _ui8PpuCtrl The current PPUCTRL value.
+		 */
+		inline void										Mmc3_PredictA12( uint8_t _ui8PpuCtrl ) {
+			const uint64_t ui64CpuNow = m_pcbCpu->GetCycleCount();
+			const uint64_t ui64PpuNow = m_ppbPpu->GetCycleCount();
+
+			switch ( _ui8PpuCtrl & 0b00111000 ) {
+				case 0b00001000 : {
+					// Sprites at $1000, background at $0000: the one qualified rise of the line.
+					Mmc3_ClockIrqCounter();
+					m_bA12PrevRaw = true;
+					m_bA12FilteredHigh = true;
+					break;
+				}
+				case 0b00000000 : {
+					// Everything at $0000: A12 stays low.
+					m_bA12PrevRaw = false;
+					m_bA12FilteredHigh = false;
+					m_ui64LastA12LowCpu = ui64CpuNow - LSN_MMC3_A12_LOW_CPU;
+					break;
+				}
+				case 0b00011000 : {
+					// Everything at $1000: A12 stays high.
+					m_bA12PrevRaw = true;
+					m_bA12FilteredHigh = true;
+					break;
+				}
+				default : {
+					// Sample this line.  If the last line was predicted, hand over in the state its background fetches left A12 in, in time
+					//	for the fetch that follows.  The next line's sprite fetches check the arrangement again.
+					if ( ui64PpuNow < m_ui64A12PredictedUntil ) {
+						Mmc3_EndA12Prediction( (_ui8PpuCtrl & 0b00010000) != 0 );
+					}
+					return;
+				}
+			}
+			m_ui64A12PredictedAt = ui64PpuNow;
+			m_ui64A12PredictedUntil = ui64PpuNow + LSN_PM_NTSC_DOTS_X + 2;
+			m_ui8A12PredictedCtrl = _ui8PpuCtrl;
+		}
+
+		/**
+		 * Ends the current A12 prediction if PPUCTRL now selects different pattern tables than the prediction was made with, so that the
+		 *	rest of the scanline's fetches are sampled.  The next line's sprite fetches predict again.
+		 *
+		 * \param _ui8PpuCtrl The new PPUCTRL value.
+		 */
+		inline void										Mmc3_CheckA12Prediction( uint8_t _ui8PpuCtrl ) {
+			const uint64_t ui64PpuNow = m_ppbPpu->GetCycleCount();
+			if ( ui64PpuNow >= m_ui64A12PredictedUntil || !((_ui8PpuCtrl ^ m_ui8A12PredictedCtrl) & 0b00111000) ) { return; }
+
+			// The prediction was made at dot 261.  Sprite patterns are fetched through dot 320 and background patterns from dot 321.
+			const bool bSprites = (ui64PpuNow - m_ui64A12PredictedAt) < (321 - 261);
+			Mmc3_EndA12Prediction( (m_ui8A12PredictedCtrl & (bSprites ? 0b00001000 : 0b00010000)) != 0 );
+		}
+
+		/**
+		 * Stops predicting A12 and leaves the edge detector as the fetches made so far would have left it, so that the next fetch is
+		 *	sampled exactly.
+		 *
+		 * \param _bA12High The level of A12 at the most recent pattern fetch.
+		 */
+		inline void										Mmc3_EndA12Prediction( bool _bA12High ) {
+			m_ui64A12PredictedUntil = 0;
+			m_bA12PrevRaw = _bA12High;
+			m_bA12FilteredHigh = _bA12High;
+			m_ui64LastA12LowCpu = m_pcbCpu->GetCycleCount() - LSN_MMC3_A12_LOW_CPU;
+		}
+
 	};
 
+	LSN_REGISTER_MAPPER( CMapper004, 4, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
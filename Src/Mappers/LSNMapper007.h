@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -133,4 +134,6 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper007, 7, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
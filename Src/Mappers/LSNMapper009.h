@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -59,6 +60,8 @@ namespace lsn {
 			m_ui8Latch0 = 0xFD;
 			m_ui8Latch1 = 0xFD;
 
+			std::memset( m_ui8PgmRam, 0, sizeof( m_ui8PgmRam ) );
+			m_pui8PgmRam = MapBatteryRam( m_ui8PgmRam, sizeof( m_ui8PgmRam ) );
 		}
 
 		/**
@@ -107,12 +110,16 @@ namespace lsn {
 			// ================
 			// RAM
 			// ================
-			// Set the reads and writes of the RAM.
+			// Set the reads and writes of the RAM.  Only the battery-backed (PlayChoice) boards have any.
 			for ( uint32_t I = 0x6000; I < 0x8000; ++I ) {
-				/*_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapper009::Mapper009PgmRamRead, this, uint16_t( I - 0x6000 ) );
-				_pbCpuBus->SetWriteFunc( uint16_t( I ), &CMapper009::Mapper009PgmRamWrite, this, uint16_t( I - 0x6000 ) );*/
-				_pbCpuBus->SetReadFunc( uint16_t( I ), &CCpuBus::NoRead, this, uint16_t( I - 0x6000 ) );
-				_pbCpuBus->SetWriteFunc( uint16_t( I ), &CCpuBus::NoWrite, this, uint16_t( I - 0x6000 ) );
+				if ( m_prRom->riInfo.bBattery ) {
+					_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapper009::Mapper009PgmRamRead, this, uint16_t( I - 0x6000 ) );
+					_pbCpuBus->SetWriteFunc( uint16_t( I ), &CMapper009::Mapper009PgmRamWrite, this, uint16_t( I - 0x6000 ) );
+				}
+				else {
+					_pbCpuBus->SetReadFunc( uint16_t( I ), &CCpuBus::NoRead, this, uint16_t( I - 0x6000 ) );
+					_pbCpuBus->SetWriteFunc( uint16_t( I ), &CCpuBus::NoWrite, this, uint16_t( I - 0x6000 ) );
+				}
 			}
 
 			// ================
@@ -171,6 +178,8 @@ namespace lsn {
 		CPpuBus::LSN_TRAMPOLINE							m_tLatch1Trampoline_1FE8_1FEF[0x1FEF-0x1FE8+1];
 		/** RAM. */
 		uint8_t											m_ui8PgmRam[8*1024];
+		/** The PGM RAM in use (m_ui8PgmRam or the battery-backed save file). */
+		uint8_t *										m_pui8PgmRam = m_ui8PgmRam;
 		/** The 0000 CHR ROM bank used when m_ui8Latch0 == 0xFD. */
 		const uint8_t &									m_ui8ChrBankLatch0_FD;
 		/** The 0000 CHR ROM bank used when m_ui8Latch0 == 0xFE. */
@@ -194,10 +203,10 @@ namespace lsn {
 		 * \param _pui8Data The buffer from which to read.
 		 * \param _ui8Ret The read value.
 		 */
-		//static void LSN_FASTCALL						Mapper009PgmRamRead( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &/*_ui8Ret*/ ) {
-		//	CMapper009 * pmThis = reinterpret_cast<CMapper009 *>(_pvParm0);
-		//	_ui8Ret = pmThis->m_ui8PgmRam[_ui16Parm1];
-		//}
+		static void LSN_FASTCALL						Mapper009PgmRamRead( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
+			CMapper009 * pmThis = reinterpret_cast<CMapper009 *>(_pvParm0);
+			_ui8Ret = pmThis->m_pui8PgmRam[_ui16Parm1];
+		}
 
 		/**
 		 * Writes to the PGM RAM.
@@ -207,10 +216,10 @@ namespace lsn {
 		 * \param _pui8Data The buffer to which to write.
 		 * \param _ui8Val The value to write.
 		 */
-		//static void LSN_FASTCALL						Mapper009PgmRamWrite( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
-		//	CMapper009 * pmThis = reinterpret_cast<CMapper009 *>(_pvParm0);
-		//	pmThis->m_ui8PgmRam[_ui16Parm1] = _ui8Val;
-		//}
+		static void LSN_FASTCALL						Mapper009PgmRamWrite( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
+			CMapper009 * pmThis = reinterpret_cast<CMapper009 *>(_pvParm0);
+			pmThis->m_pui8PgmRam[_ui16Parm1] = _ui8Val;
+		}
 
 		/**
 		 * PPU $0000-$0FFF: Two 4 KB switchable CHR ROM banks.
@@ -466,4 +475,6 @@ namespace lsn {
 
 	};
 
+	LSN_REGISTER_MAPPER( CMapper009, 9, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -60,6 +61,7 @@ namespace lsn {
 			m_ui8Latch1 = 0xFE;
 
 			std::memset( m_ui8PgmRam, 0, sizeof( m_ui8PgmRam ) );
+			m_pui8PgmRam = MapBatteryRam( m_ui8PgmRam, sizeof( m_ui8PgmRam ) );
 		}
 
 		/**
@@ -174,6 +176,8 @@ namespace lsn {
 		CPpuBus::LSN_TRAMPOLINE							m_tLatch1Trampoline_1FE8_1FEF[0x1FEF-0x1FE8+1];
 		/** RAM. */
 		uint8_t											m_ui8PgmRam[8*1024];
+		/** The PGM RAM in use (m_ui8PgmRam or the battery-backed save file). */
+		uint8_t *										m_pui8PgmRam = m_ui8PgmRam;
 		/** The 0000 CHR ROM bank used when m_ui8Latch0 == 0xFD. */
 		const uint8_t &									m_ui8ChrBankLatch0_FD;
 		/** The 0000 CHR ROM bank used when m_ui8Latch0 == 0xFE. */
@@ -199,7 +203,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						Mapper010PgmRamRead( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
 			CMapper010 * pmThis = reinterpret_cast<CMapper010 *>(_pvParm0);
-			_ui8Ret = pmThis->m_ui8PgmRam[_ui16Parm1];
+			_ui8Ret = pmThis->m_pui8PgmRam[_ui16Parm1];
 		}
 
 		/**
@@ -212,7 +216,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						Mapper010PgmRamWrite( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper010 * pmThis = reinterpret_cast<CMapper010 *>(_pvParm0);
-			pmThis->m_ui8PgmRam[_ui16Parm1] = _ui8Val;
+			pmThis->m_pui8PgmRam[_ui16Parm1] = _ui8Val;
 		}
 
 		/**
@@ -468,4 +472,6 @@ namespace lsn {
 
 	};
 
+	LSN_REGISTER_MAPPER( CMapper010, 10, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
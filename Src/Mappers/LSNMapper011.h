@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -117,4 +118,6 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper011, 11, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -163,4 +164,6 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper013, 13, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
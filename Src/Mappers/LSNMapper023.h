@@ -12,6 +12,7 @@
 #include "../LSNLSpiroNes.h"
 #include "../Database/LSNDatabase.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -747,4 +748,9 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper023, 21, CMapperRegistry::LSN_MC_NONE );
+	LSN_REGISTER_MAPPER( CMapper023, 22, CMapperRegistry::LSN_MC_NONE );
+	LSN_REGISTER_MAPPER( CMapper023, 23, CMapperRegistry::LSN_MC_NONE );
+	LSN_REGISTER_MAPPER( CMapper023, 25, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
@@ -13,6 +13,7 @@
 #include "../Database/LSNDatabase.h"
 #include "LSNAudioVrc6.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -538,4 +539,7 @@ namespace lsn {
 
 	};
 
+	LSN_REGISTER_MAPPER( CMapper024, 24, CMapperRegistry::LSN_MC_NONE );
+	LSN_REGISTER_MAPPER( CMapper024, 26, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
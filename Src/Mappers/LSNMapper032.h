@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -54,6 +55,9 @@ namespace lsn {
 			//size_t stBanks = m_prRom->vPrgRom.size() / PgmBankSize();
 			m_ui8Neg1Bank = GetPgmBank<PgmBankSize()>( -1 );
 			m_ui8Neg2Bank = GetPgmBank<PgmBankSize()>( -2 );
+
+			std::memset( m_ui8PgmRam, 0, sizeof( m_ui8PgmRam ) );
+			m_pui8PgmRam = MapBatteryRam( m_ui8PgmRam, sizeof( m_ui8PgmRam ) );
 		}
 
 		/**
@@ -169,6 +173,8 @@ namespace lsn {
 		// == Members.
 		/** RAM. */
 		uint8_t											m_ui8PgmRam[8*1024];
+		/** The PGM RAM in use (m_ui8PgmRam or the battery-backed save file). */
+		uint8_t *										m_pui8PgmRam = m_ui8PgmRam;
 		/** The PGM mode. */
 		uint8_t											m_ui8Mode;
 		/** The index of the -1 bank. */
@@ -188,7 +194,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						Mapper010PgmRamRead( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
 			CMapper032 * pmThis = reinterpret_cast<CMapper032 *>(_pvParm0);
-			_ui8Ret = pmThis->m_ui8PgmRam[_ui16Parm1];
+			_ui8Ret = pmThis->m_pui8PgmRam[_ui16Parm1];
 		}
 
 		/**
@@ -201,7 +207,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						Mapper010PgmRamWrite( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper032 * pmThis = reinterpret_cast<CMapper032 *>(_pvParm0);
-			pmThis->m_ui8PgmRam[_ui16Parm1] = _ui8Val;
+			pmThis->m_pui8PgmRam[_ui16Parm1] = _ui8Val;
 		}
 
 		/**
@@ -324,4 +330,6 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper032, 32, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -53,6 +54,9 @@ namespace lsn {
 			CMapperBase::InitWithRom( _rRom, _pcbCpuBase, _ppbPpuBase, _piInter, _pbPpuBus );
 
 			SanitizeRegs<PgmBankSize(), ChrBankSize()>();
+
+			m_vPrgRam.assign( PgmBankSize(), 0 );
+			m_pui8PrgRam = MapBatteryRam( m_vPrgRam.data(), m_vPrgRam.size() );
 		}
 
 		/**
@@ -75,7 +79,6 @@ namespace lsn {
 			SetPgmBank<0, PgmBankSize()>( -1 );
 			m_ui8PgmBanksF0xx[0] = m_ui8PgmBanks[0];
 
-			m_vPrgRam.resize( PgmBankSize() );
 			for ( uint32_t I = 0x6000; I < 0x8000; ++I ) {
 				_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapper056::ReadWRam, this, uint16_t( (I - 0x6000) % PgmBankSize() ) );
 				_pbCpuBus->SetWriteFunc( uint16_t( I ), &CMapper056::WriteWRam, this, uint16_t( (I - 0x6000) % PgmBankSize() ) );
@@ -220,6 +223,7 @@ namespace lsn {
 	protected :
 		// == Members.
 		std::vector<uint8_t>							m_vPrgRam;										/**< PRG RAM. */
+		uint8_t *										m_pui8PrgRam = nullptr;							/**< The PRG RAM in use (m_vPrgRam or the battery-backed save file). */
 		CVrcIrq3<false>									m_viIrq;										/**< VRC3 IRQ. */
 		uint8_t											m_ui8BankSelect;								/**< Bank selector. */
 		uint8_t											m_ui8PgmBanksF0xx[4];							/**< The 4 PGM banks. */
@@ -237,7 +241,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						ReadWRam( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
 			CMapper056 * pmThis = reinterpret_cast<CMapper056 *>(_pvParm0);
-			_ui8Ret = pmThis->m_vPrgRam[_ui16Parm1];
+			_ui8Ret = pmThis->m_pui8PrgRam[_ui16Parm1];
 		}
 
 		/**
@@ -250,7 +254,7 @@ namespace lsn {
 		 **/
 		static void LSN_FASTCALL						WriteWRam( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper056 * pmThis = reinterpret_cast<CMapper056 *>(_pvParm0);
-			pmThis->m_vPrgRam[_ui16Parm1] = _ui8Val;
+			pmThis->m_pui8PrgRam[_ui16Parm1] = _ui8Val;
 		}
 
 		/**
@@ -454,4 +458,6 @@ namespace lsn {
 
 	};
 
+	LSN_REGISTER_MAPPER( CMapper056, 56, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
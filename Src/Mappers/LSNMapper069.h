@@ -12,6 +12,7 @@
 #include "../LSNLSpiroNes.h"
 #include "LSNAudio5b.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -53,6 +54,10 @@ namespace lsn {
 		virtual void									InitWithRom( LSN_ROM &_rRom, CCpuBase * _pcbCpuBase, CPpuBase * _ppbPpuBase, CInterruptable * _piInter, CBussable * _pbPpuBus ) {
 			CMapperBase::InitWithRom( _rRom, _pcbCpuBase, _ppbPpuBase, _piInter, _pbPpuBus );
 			SanitizeRegs<PgmBankSize(), ChrBankSize()>();
+
+			// Command 8 selects one of 64 8-kilobyte pages.
+			m_vPrgRam.assign( 64 * PgmBankSize(), 0 );
+			m_pui8PrgRam = MapBatteryRam( m_vPrgRam.data(), m_vPrgRam.size() );
 		}
 
 		/**
@@ -78,7 +83,6 @@ namespace lsn {
 			// SWAPPABLE BANKS
 			// ================
 			// CPU.
-			m_vPrgRam.resize( 512 * 1024 );
 			for ( uint32_t I = 0x6000; I < 0x8000; ++I ) {
 				_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapper069::ReadBank0, this, uint16_t( I - 0x6000 ) );
 				_pbCpuBus->SetWriteFunc( uint16_t( I ), &CMapper069::WriteBank0, this, uint16_t( I - 0x6000 ) );
@@ -194,6 +198,8 @@ namespace lsn {
 		// == Members.
 		/** PRG RAM. */
 		std::vector<uint8_t>							m_vPrgRam;
+		/** The PRG RAM in use (m_vPrgRam or the battery-backed save file). */
+		uint8_t *										m_pui8PrgRam = nullptr;
 		/** The 5B audio chip. */
 		CAudio5b										m_Audio5b;
 		/** Command Register. */
@@ -309,7 +315,7 @@ namespace lsn {
 				// RAM.
 				if ( pmThis->m_ui8PgmReg & 0b10000000 ) {
 					// Enabled.
-					_ui8Ret = pmThis->m_vPrgRam[pmThis->m_ui8PgmBank*PgmBankSize()+_ui16Parm1];
+					_ui8Ret = pmThis->m_pui8PrgRam[pmThis->m_ui8PgmBank*PgmBankSize()+_ui16Parm1];
 				}
 			}
 			else {
@@ -328,9 +334,11 @@ namespace lsn {
 		static void LSN_FASTCALL						WriteBank0( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper069 * pmThis = reinterpret_cast<CMapper069 *>(_pvParm0);
 			if ( (pmThis->m_ui8PgmReg & 0b11000000) == 0b11000000 ) {
-				pmThis->m_vPrgRam[size_t(pmThis->m_ui8PgmBank)*size_t(PgmBankSize())+size_t(_ui16Parm1)] = _ui8Val;
+				pmThis->m_pui8PrgRam[size_t(pmThis->m_ui8PgmBank)*size_t(PgmBankSize())+size_t(_ui16Parm1)] = _ui8Val;
 			}
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper069, 69, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -52,6 +53,9 @@ namespace lsn {
 		virtual void									InitWithRom( LSN_ROM &_rRom, CCpuBase * _pcbCpuBase, CPpuBase * _ppbPpuBase, CInterruptable * _piInter, CBussable * _pbPpuBus ) {
 			CMapperBase::InitWithRom( _rRom, _pcbCpuBase, _ppbPpuBase, _piInter, _pbPpuBus );
 			SanitizeRegs<PgmBankSize(), ChrBankSize()>();
+
+			m_vPrgRam.assign( 0x8000 - 0x6000, 0 );
+			m_pui8PrgRam = MapBatteryRam( m_vPrgRam.data(), m_vPrgRam.size() );
 		}
 
 		/**
@@ -81,7 +85,6 @@ namespace lsn {
 				_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapperBase::PgmBankRead<0, PgmBankSize()>, this, uint16_t( I - 0x8000 ) );
 			}
 			//if ( m_prRom->i32SaveRamSize ) {
-				m_vPrgRam.resize( 0x8000 - 0x6000 );
 				for ( uint32_t I = 0x6000; I < 0x8000; ++I ) {
 					_pbCpuBus->SetReadFunc( uint16_t( I ), &CMapper073::ReadWram, this, uint16_t( I - 0x6000 ) );
 					_pbCpuBus->SetWriteFunc( uint16_t( I ), &CMapper073::WriteWram, this, uint16_t( I - 0x6000 ) );
@@ -139,6 +142,8 @@ namespace lsn {
 		// == Members.
 		/** WRAM. */
 		std::vector<uint8_t>							m_vPrgRam;
+		/** The WRAM in use (m_vPrgRam or the battery-backed save file). */
+		uint8_t *										m_pui8PrgRam = nullptr;
 		/** VRC3 IRQ. */
 		CVrcIrq3<true>									m_viIrq;
 
@@ -168,7 +173,7 @@ namespace lsn {
 		 */
 		static void LSN_FASTCALL						ReadWram( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t &_ui8Ret ) {
 			CMapper073 * pmThis = reinterpret_cast<CMapper073 *>(_pvParm0);
-			_ui8Ret = pmThis->m_vPrgRam[_ui16Parm1];
+			_ui8Ret = pmThis->m_pui8PrgRam[_ui16Parm1];
 		}
 
 		/**
@@ -181,7 +186,7 @@ namespace lsn {
 		 **/
 		static void LSN_FASTCALL						WriteWram( void * _pvParm0, uint16_t _ui16Parm1, uint8_t * /*_pui8Data*/, uint8_t _ui8Val ) {
 			CMapper073 * pmThis = reinterpret_cast<CMapper073 *>(_pvParm0);
-			pmThis->m_vPrgRam[_ui16Parm1] = _ui8Val;
+			pmThis->m_pui8PrgRam[_ui16Parm1] = _ui8Val;
 		}
 
 		/**
@@ -263,4 +268,6 @@ namespace lsn {
 		}
 	};
 
+	LSN_REGISTER_MAPPER( CMapper073, 73, CMapperRegistry::LSN_MC_BATTERY );
+
 }	// namespace lsn
@@ -11,6 +11,7 @@
 
 #include "../LSNLSpiroNes.h"
 #include "LSNMapperBase.h"
+#include "LSNMapperRegistry.h"
 
 namespace lsn {
 
@@ -277,4 +278,6 @@ namespace lsn {
 
 	};
 
+	LSN_REGISTER_MAPPER( CMapper142, 142, CMapperRegistry::LSN_MC_NONE );
+
 }	// namespace lsn
@@ -16,6 +16,7 @@
 #include "../Roms/LSNRom.h"
 #include "../System/LSNBussable.h"
 #include "../System/LSNInterruptable.h"
+#include "LSNBatteryRam.h"
 
 namespace lsn {
 
@@ -320,7 +321,7 @@ namespace lsn {
 		 * 
 		 * \return Returns true if the operation completed as expected.  False indicates a file-access error.
 		 **/
-		virtual bool									SaveBatteryBacked() { return true; }
+		virtual bool									SaveBatteryBacked() { return m_brBatteryRam.Flush(); }
 
 		/**
 		 * Called to inform the mapper of a reset.
@@ -394,9 +395,34 @@ namespace lsn {
 		uint8_t &										m_ui8ChrBank;
 		/** The mirroring mode. */
 		LSN_MIRROR_MODE									m_mmMirror = LSN_MM_HORIZONTAL;
+		/** Battery-backed RAM mapped to m_prRom->u16SaveFilePrefix + u".sav". */
+		CBatteryRam										m_brBatteryRam;
 
 
 		// == Functions.
+		/**
+		 * If the cartridge has a battery, maps RAM to its save file (m_prRom->u16SaveFilePrefix + u".sav") so that writes persist.  Call
+		 *	from InitWithRom() after the RAM has been initialized; the RAM's contents are used only if the save file does not exist yet.
+		 *	Only one block of RAM can be battery-backed per mapper.
+		 *
+		 * \param _pui8Ram The RAM.
+		 * \param _sSize The size of the RAM.
+		 * \return Returns the RAM to use: the mapped save file, or _pui8Ram if the cartridge has no battery or the file could not be mapped.
+		 */
+		uint8_t *										MapBatteryRam( uint8_t * _pui8Ram, size_t _sSize ) {
+			if ( !m_prRom || !m_prRom->riInfo.bBattery || m_prRom->u16SaveFilePrefix.empty() ) { return _pui8Ram; }
+			try {
+				uint8_t * pui8Mapped = m_brBatteryRam.Open( std::filesystem::path( m_prRom->u16SaveFilePrefix + u".sav" ), _sSize, _pui8Ram );
+				if ( !pui8Mapped ) {
+					// The game still runs from _pui8Ram, but nothing it saves will persist and an existing save file is left untouched.
+					lsn::DebugA( "CMapperBase::MapBatteryRam(): The save file could not be opened or mapped.  Saves will not persist.\r\n" );
+					return _pui8Ram;
+				}
+				return pui8Mapped;
+			}
+			catch ( ... ) { return _pui8Ram; }
+		}
+
 		/**
 		 * Applies a controllable mirroring map.
 		 *
@@ -0,0 +1,89 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A registry of mapper factories keyed by mapper and sub-mapper number.  Mappers register themselves at the bottom of
+ *	their headers with LSN_REGISTER_MAPPER(), so adding a mapper does not require editing the system.
+ */
+
+
+#include "LSNMapperRegistry.h"
+
+#include <vector>
+
+
+namespace lsn {
+
+	namespace {
+
+		/**
+		 * Gets the registered mappers.  Constructed on first use so that registration from other translation units' static
+		 *	initializers is safe.
+		 *
+		 * \return Returns the registered mappers.
+		 */
+		std::vector<CMapperRegistry::LSN_MAPPER_ENTRY> &	Entries() {
+			static std::vector<CMapperRegistry::LSN_MAPPER_ENTRY> vEntries;
+			return vEntries;
+		}
+
+	}
+
+	// == Functions.
+	/**
+	 * Registers a mapper.  A later registration for the same mapper/sub-mapper pair replaces an earlier one.
+	 *
+	 * \param _meEntry The mapper to register.
+	 * \return Returns true.  The return value exists so that registration can initialize a static.
+	 */
+	bool CMapperRegistry::Register( const LSN_MAPPER_ENTRY &_meEntry ) {
+		auto & vEntries = Entries();
+		for ( auto & meThis : vEntries ) {
+			if ( meThis.ui16Mapper == _meEntry.ui16Mapper && meThis.ui16SubMapper == _meEntry.ui16SubMapper ) {
+				meThis = _meEntry;
+				return true;
+			}
+		}
+		vEntries.push_back( _meEntry );
+		return true;
+	}
+
+	/**
+	 * Finds the entry for a mapper, preferring an exact sub-mapper match over an LSN_ANY_SUBMAPPER entry.
+	 *
+	 * \param _ui16Mapper The mapper number.
+	 * \param _ui16SubMapper The sub-mapper number.
+	 * \return Returns the entry or nullptr if the mapper is not supported.
+	 */
+	const CMapperRegistry::LSN_MAPPER_ENTRY * CMapperRegistry::Find( uint16_t _ui16Mapper, uint16_t _ui16SubMapper ) {
+		const LSN_MAPPER_ENTRY * pmeAny = nullptr;
+		for ( const auto & meThis : Entries() ) {
+			if ( meThis.ui16Mapper != _ui16Mapper ) { continue; }
+			if ( meThis.ui16SubMapper == _ui16SubMapper ) { return &meThis; }
+			if ( meThis.ui16SubMapper == LSN_ANY_SUBMAPPER ) { pmeAny = &meThis; }
+		}
+		return pmeAny;
+	}
+
+	/**
+	 * Creates a mapper.
+	 *
+	 * \param _ui16Mapper The mapper number.
+	 * \param _ui16SubMapper The sub-mapper number.
+	 * \param _ui32Caps Holds the mapper's LSN_MAPPER_CAPS flags on return (LSN_MC_NONE if the mapper is not supported).
+	 * \return Returns the created mapper or an empty pointer if the mapper is not supported.
+	 */
+	std::unique_ptr<CMapperBase> CMapperRegistry::Create( uint16_t _ui16Mapper, uint16_t _ui16SubMapper, uint32_t &_ui32Caps ) {
+		_ui32Caps = LSN_MC_NONE;
+		const LSN_MAPPER_ENTRY * pmeEntry = Find( _ui16Mapper, _ui16SubMapper );
+		if ( !pmeEntry ) { return std::unique_ptr<CMapperBase>(); }
+		try {
+			auto pmbMapper = pmeEntry->pfCreate();
+			if ( pmbMapper ) { _ui32Caps = pmeEntry->ui32Caps; }
+			return pmbMapper;
+		}
+		catch ( ... ) { return std::unique_ptr<CMapperBase>(); }
+	}
+
+}	// namespace lsn
@@ -0,0 +1,134 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A registry of mapper factories keyed by mapper and sub-mapper number.  Mappers register themselves at the bottom of
+ *	their headers with LSN_REGISTER_MAPPER(), so adding a mapper does not require editing the system.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+#include "LSNMapperBase.h"
+
+#include <memory>
+#include <type_traits>
+
+
+namespace lsn {
+
+	/**
+	 * Class CMapperRegistry
+	 * \brief A registry of mapper factories keyed by mapper and sub-mapper number.
+	 *
+	 * Description: A registry of mapper factories keyed by mapper and sub-mapper number.  Each entry also carries capability flags
+	 *	that let the system skip per-cycle, per-sample and save-file work for mappers that do not need it.
+	 */
+	class CMapperRegistry {
+	public :
+		// == Enumerations.
+		/** Mapper capabilities. */
+		enum LSN_MAPPER_CAPS : uint32_t {
+			LSN_MC_NONE										= 0,
+			LSN_MC_EXT_AUDIO								= (1 << 0),									/**< The mapper has expansion audio (GetExtAudio()/PostProcessAudioSample()). */
+			LSN_MC_TICK										= (1 << 1),									/**< The mapper needs Tick() on every CPU cycle. */
+			LSN_MC_BATTERY									= (1 << 2),									/**< The mapper keeps battery-backed RAM in a save file (calls MapBatteryRam()). */
+		};
+
+		/** Matches any sub-mapper. */
+		static constexpr uint16_t							LSN_ANY_SUBMAPPER = 0xFFFF;
+
+
+		// == Types.
+		/** Creates a mapper. */
+		typedef std::unique_ptr<CMapperBase> (*			PfCreateMapper)();
+
+		/** A registered mapper. */
+		struct LSN_MAPPER_ENTRY {
+			uint16_t										ui16Mapper;									/**< The mapper number. */
+			uint16_t										ui16SubMapper;								/**< The sub-mapper number or LSN_ANY_SUBMAPPER. */
+			uint32_t										ui32Caps;									/**< LSN_MAPPER_CAPS flags. */
+			PfCreateMapper									pfCreate;									/**< Creates the mapper. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Registers a mapper.  A later registration for the same mapper/sub-mapper pair replaces an earlier one.
+		 *
+		 * \param _meEntry The mapper to register.
+		 * \return Returns true.  The return value exists so that registration can initialize a static.
+		 */
+		static bool											Register( const LSN_MAPPER_ENTRY &_meEntry );
+
+		/**
+		 * Finds the entry for a mapper, preferring an exact sub-mapper match over an LSN_ANY_SUBMAPPER entry.
+		 *
+		 * \param _ui16Mapper The mapper number.
+		 * \param _ui16SubMapper The sub-mapper number.
+		 * \return Returns the entry or nullptr if the mapper is not supported.
+		 */
+		static const LSN_MAPPER_ENTRY *						Find( uint16_t _ui16Mapper, uint16_t _ui16SubMapper );
+
+		/**
+		 * Creates a mapper.
+		 *
+		 * \param _ui16Mapper The mapper number.
+		 * \param _ui16SubMapper The sub-mapper number.
+		 * \param _ui32Caps Holds the mapper's LSN_MAPPER_CAPS flags on return (LSN_MC_NONE if the mapper is not supported).
+		 * \return Returns the created mapper or an empty pointer if the mapper is not supported.
+		 */
+		static std::unique_ptr<CMapperBase>					Create( uint16_t _ui16Mapper, uint16_t _ui16SubMapper, uint32_t &_ui32Caps );
+
+		/**
+		 * Gets the capabilities that can be determined from a mapper class itself: LSN_MC_TICK if it overrides Tick() and
+		 *	LSN_MC_EXT_AUDIO if it overrides GetExtAudio() or PostProcessAudioSample().
+		 *
+		 * \return Returns the detected LSN_MAPPER_CAPS flags.
+		 */
+		template <typename _tMapper>
+		static constexpr uint32_t							DetectCaps() {
+			// A member function not overridden anywhere below CMapperBase keeps CMapperBase as its class.
+			uint32_t ui32Caps = LSN_MC_NONE;
+			if constexpr ( !std::is_same_v<decltype(&_tMapper::Tick), decltype(&CMapperBase::Tick)> ) {
+				ui32Caps |= LSN_MC_TICK;
+			}
+			if constexpr ( !std::is_same_v<decltype(&_tMapper::GetExtAudio), decltype(&CMapperBase::GetExtAudio)> ||
+				!std::is_same_v<decltype(&_tMapper::PostProcessAudioSample), decltype(&CMapperBase::PostProcessAudioSample)> ) {
+				ui32Caps |= LSN_MC_EXT_AUDIO;
+			}
+			return ui32Caps;
+		}
+
+		/**
+		 * Creates a mapper of the given type.
+		 *
+		 * \return Returns the created mapper.
+		 */
+		template <typename _tMapper>
+		static std::unique_ptr<CMapperBase>					CreateMapper() { return std::make_unique<_tMapper>(); }
+	};
+
+}	// namespace lsn
+
+
+/**
+ * Registers a mapper class for a mapper number (any sub-mapper).  Place after the class at namespace scope in the mapper's header.
+ *	CAPS holds the flags that cannot be detected from the class (LSN_MC_BATTERY).
+ */
+#define LSN_REGISTER_MAPPER( CLASS, MAPPER, CAPS )																									\
+	LSN_REGISTER_SUBMAPPER( CLASS, MAPPER, ::lsn::CMapperRegistry::LSN_ANY_SUBMAPPER, CAPS )
+
+/**
+ * Registers a mapper class for a specific mapper/sub-mapper pair.
+ */
+#define LSN_REGISTER_SUBMAPPER( CLASS, MAPPER, SUBMAPPER, CAPS )																					\
+	inline const bool LSN_REGISTER_NAME( CLASS, MAPPER, __LINE__ ) = ::lsn::CMapperRegistry::Register( {									\
+		uint16_t( MAPPER ), uint16_t( SUBMAPPER ),																									\
+		uint32_t( CAPS ) | ::lsn::CMapperRegistry::DetectCaps<CLASS>(),																				\
+		&::lsn::CMapperRegistry::CreateMapper<CLASS> } )
+
+#define LSN_REGISTER_NAME( CLASS, MAPPER, LINE )			LSN_REGISTER_NAME_( CLASS, MAPPER, LINE )
+#define LSN_REGISTER_NAME_( CLASS, MAPPER, LINE )			g_bRegistered_ ## CLASS ## _ ## MAPPER ## _ ## LINE
@@ -16,17 +16,7 @@ void LSN_FASTCALL								Cycle_0__1x241() {
 void LSN_FASTCALL								Cycle_0__68x0_76x0_84x0_92x0_100x0_108x0_116x0_124x0_132x0_140x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -50,17 +40,7 @@ void LSN_FASTCALL								Cycle_0__68x0_76x0_84x0_92x0_100x0_108x0_116x0_124x0_13
 void LSN_FASTCALL								Cycle_0__68x261_76x261_84x261_92x261_100x261_108x261_116x261_124x261_132x261_140x261_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -82,17 +62,7 @@ void LSN_FASTCALL								Cycle_0__68x261_76x261_84x261_92x261_100x261_108x261_11
 void LSN_FASTCALL								Cycle_0__66x0_74x0_82x0_90x0_98x0_106x0_114x0_122x0_130x0_138x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -116,17 +86,7 @@ void LSN_FASTCALL								Cycle_0__66x0_74x0_82x0_90x0_98x0_106x0_114x0_122x0_130
 void LSN_FASTCALL								Cycle_0__66x261_74x261_82x261_90x261_98x261_106x261_114x261_122x261_130x261_138x261_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -148,17 +108,7 @@ void LSN_FASTCALL								Cycle_0__66x261_74x261_82x261_90x261_98x261_106x261_114
 void LSN_FASTCALL								Cycle_0__70x0_78x0_86x0_94x0_102x0_110x0_118x0_126x0_134x0_142x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -182,17 +132,7 @@ void LSN_FASTCALL								Cycle_0__70x0_78x0_86x0_94x0_102x0_110x0_118x0_126x0_13
 void LSN_FASTCALL								Cycle_0__70x261_78x261_86x261_94x261_102x261_110x261_118x261_126x261_134x261_142x261_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -214,17 +154,7 @@ void LSN_FASTCALL								Cycle_0__70x261_78x261_86x261_94x261_102x261_110x261_11
 void LSN_FASTCALL								Cycle_0__72x0_80x0_88x0_96x0_104x0_112x0_120x0_128x0_136x0_144x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -253,17 +183,7 @@ void LSN_FASTCALL								Cycle_0__72x0_80x0_88x0_96x0_104x0_112x0_120x0_128x0_13
 void LSN_FASTCALL								Cycle_0__256x0_256x1_256x2_256x3_256x4_256x5_256x6_256x7_256x8_256x9_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -295,17 +215,7 @@ void LSN_FASTCALL								Cycle_0__256x0_256x1_256x2_256x3_256x4_256x5_256x6_256x
 void LSN_FASTCALL								Cycle_0__72x261_80x261_88x261_96x261_104x261_112x261_120x261_128x261_136x261_144x261_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -332,17 +242,7 @@ void LSN_FASTCALL								Cycle_0__72x261_80x261_88x261_96x261_104x261_112x261_12
 void LSN_FASTCALL								Cycle_0__256x261() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -372,17 +272,7 @@ void LSN_FASTCALL								Cycle_0__256x261() {
 void LSN_FASTCALL								Cycle_0__67x0_75x0_83x0_91x0_99x0_107x0_115x0_123x0_131x0_139x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -414,17 +304,7 @@ void LSN_FASTCALL								Cycle_0__67x0_75x0_83x0_91x0_99x0_107x0_115x0_123x0_131
 void LSN_FASTCALL								Cycle_0__67x261_75x261_83x261_91x261_99x261_107x261_115x261_123x261_131x261_139x261_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -454,17 +334,7 @@ void LSN_FASTCALL								Cycle_0__67x261_75x261_83x261_91x261_99x261_107x261_115
 void LSN_FASTCALL								Cycle_0__73x0_81x0_89x0_97x0_105x0_113x0_121x0_129x0_137x0_145x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -495,17 +365,7 @@ void LSN_FASTCALL								Cycle_0__73x0_81x0_89x0_97x0_105x0_113x0_121x0_129x0_13
 void LSN_FASTCALL								Cycle_0__73x261_81x261_89x261_97x261_105x261_113x261_121x261_129x261_137x261_145x261_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -534,17 +394,7 @@ void LSN_FASTCALL								Cycle_0__73x261_81x261_89x261_97x261_105x261_113x261_12
 void LSN_FASTCALL								Cycle_0__69x0_77x0_85x0_93x0_101x0_109x0_117x0_125x0_133x0_141x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -572,17 +422,7 @@ void LSN_FASTCALL								Cycle_0__69x0_77x0_85x0_93x0_101x0_109x0_117x0_125x0_13
 void LSN_FASTCALL								Cycle_0__69x261_77x261_85x261_93x261_101x261_109x261_117x261_125x261_133x261_141x261_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -608,17 +448,7 @@ void LSN_FASTCALL								Cycle_0__69x261_77x261_85x261_93x261_101x261_109x261_11
 void LSN_FASTCALL								Cycle_0__71x0_79x0_87x0_95x0_103x0_111x0_119x0_127x0_135x0_143x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -646,17 +476,7 @@ void LSN_FASTCALL								Cycle_0__71x0_79x0_87x0_95x0_103x0_111x0_119x0_127x0_13
 void LSN_FASTCALL								Cycle_0__71x261_79x261_87x261_95x261_103x261_111x261_119x261_127x261_135x261_143x261_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -682,17 +502,7 @@ void LSN_FASTCALL								Cycle_0__71x261_79x261_87x261_95x261_103x261_111x261_11
 void LSN_FASTCALL								Cycle_0__65x0_65x1_65x2_65x3_65x4_65x5_65x6_65x7_65x8_65x9_X() {
 	Pixel_Evaluation_Sprite<true, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -723,17 +533,7 @@ void LSN_FASTCALL								Cycle_0__65x0_65x1_65x2_65x3_65x4_65x5_65x6_65x7_65x8_6
 void LSN_FASTCALL								Cycle_0__65x261() {
 	Pixel_Evaluation_Sprite<true, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2319,17 +2119,7 @@ void LSN_FASTCALL								Cycle_0__1x261() {
 void LSN_FASTCALL								Cycle_0__4x0_12x0_20x0_28x0_36x0_44x0_52x0_60x0_4x1_12x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2353,17 +2143,7 @@ void LSN_FASTCALL								Cycle_0__4x0_12x0_20x0_28x0_36x0_44x0_52x0_60x0_4x1_12x
 void LSN_FASTCALL								Cycle_0__4x261_12x261_20x261_28x261_36x261_44x261_52x261_60x261() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2385,17 +2165,7 @@ void LSN_FASTCALL								Cycle_0__4x261_12x261_20x261_28x261_36x261_44x261_52x26
 void LSN_FASTCALL								Cycle_0__2x0_10x0_18x0_26x0_34x0_42x0_50x0_58x0_2x1_10x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2419,17 +2189,7 @@ void LSN_FASTCALL								Cycle_0__2x0_10x0_18x0_26x0_34x0_42x0_50x0_58x0_2x1_10x
 void LSN_FASTCALL								Cycle_0__2x261_10x261_18x261_26x261_34x261_42x261_50x261_58x261() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2451,17 +2211,7 @@ void LSN_FASTCALL								Cycle_0__2x261_10x261_18x261_26x261_34x261_42x261_50x26
 void LSN_FASTCALL								Cycle_0__6x0_14x0_22x0_30x0_38x0_46x0_54x0_62x0_6x1_14x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2485,17 +2235,7 @@ void LSN_FASTCALL								Cycle_0__6x0_14x0_22x0_30x0_38x0_46x0_54x0_62x0_6x1_14x
 void LSN_FASTCALL								Cycle_0__6x261_14x261_22x261_30x261_38x261_46x261_54x261_62x261() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2517,17 +2257,7 @@ void LSN_FASTCALL								Cycle_0__6x261_14x261_22x261_30x261_38x261_46x261_54x26
 void LSN_FASTCALL								Cycle_0__8x0_16x0_24x0_32x0_40x0_48x0_56x0_64x0_8x1_16x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2556,17 +2286,7 @@ void LSN_FASTCALL								Cycle_0__8x0_16x0_24x0_32x0_40x0_48x0_56x0_64x0_8x1_16x
 void LSN_FASTCALL								Cycle_0__8x261_16x261_24x261_32x261_40x261_48x261_56x261_64x261() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2593,17 +2313,7 @@ void LSN_FASTCALL								Cycle_0__8x261_16x261_24x261_32x261_40x261_48x261_56x26
 void LSN_FASTCALL								Cycle_0__3x0_11x0_19x0_27x0_35x0_43x0_51x0_59x0_3x1_11x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2635,17 +2345,7 @@ void LSN_FASTCALL								Cycle_0__3x0_11x0_19x0_27x0_35x0_43x0_51x0_59x0_3x1_11x
 void LSN_FASTCALL								Cycle_0__3x261_11x261_19x261_27x261_35x261_43x261_51x261_59x261() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2675,17 +2375,7 @@ void LSN_FASTCALL								Cycle_0__3x261_11x261_19x261_27x261_35x261_43x261_51x26
 void LSN_FASTCALL								Cycle_0__9x0_17x0_25x0_33x0_41x0_49x0_57x0_9x1_17x1_25x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2716,17 +2406,7 @@ void LSN_FASTCALL								Cycle_0__9x0_17x0_25x0_33x0_41x0_49x0_57x0_9x1_17x1_25x
 void LSN_FASTCALL								Cycle_0__9x261_17x261_25x261_33x261_41x261_49x261_57x261() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2755,17 +2435,7 @@ void LSN_FASTCALL								Cycle_0__9x261_17x261_25x261_33x261_41x261_49x261_57x26
 void LSN_FASTCALL								Cycle_0__5x0_13x0_21x0_29x0_37x0_45x0_53x0_61x0_5x1_13x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2793,17 +2463,7 @@ void LSN_FASTCALL								Cycle_0__5x0_13x0_21x0_29x0_37x0_45x0_53x0_61x0_5x1_13x
 void LSN_FASTCALL								Cycle_0__5x261_13x261_21x261_29x261_37x261_45x261_53x261_61x261() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2829,17 +2489,7 @@ void LSN_FASTCALL								Cycle_0__5x261_13x261_21x261_29x261_37x261_45x261_53x26
 void LSN_FASTCALL								Cycle_0__7x0_15x0_23x0_31x0_39x0_47x0_55x0_63x0_7x1_15x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -2867,17 +2517,7 @@ void LSN_FASTCALL								Cycle_0__7x0_15x0_23x0_31x0_39x0_47x0_55x0_63x0_7x1_15x
 void LSN_FASTCALL								Cycle_0__7x261_15x261_23x261_31x261_39x261_47x261_55x261_63x261() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
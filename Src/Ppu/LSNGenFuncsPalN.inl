@@ -16,17 +16,7 @@ void LSN_FASTCALL								Cycle_4__1x291() {
 void LSN_FASTCALL								Cycle_4__68x0_76x0_84x0_92x0_100x0_108x0_116x0_124x0_132x0_140x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -50,17 +40,7 @@ void LSN_FASTCALL								Cycle_4__68x0_76x0_84x0_92x0_100x0_108x0_116x0_124x0_13
 void LSN_FASTCALL								Cycle_4__66x0_74x0_82x0_90x0_98x0_106x0_114x0_122x0_130x0_138x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -84,17 +64,7 @@ void LSN_FASTCALL								Cycle_4__66x0_74x0_82x0_90x0_98x0_106x0_114x0_122x0_130
 void LSN_FASTCALL								Cycle_4__70x0_78x0_86x0_94x0_102x0_110x0_118x0_126x0_134x0_142x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -118,17 +88,7 @@ void LSN_FASTCALL								Cycle_4__70x0_78x0_86x0_94x0_102x0_110x0_118x0_126x0_13
 void LSN_FASTCALL								Cycle_4__72x0_80x0_88x0_96x0_104x0_112x0_120x0_128x0_136x0_144x0_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -157,17 +117,7 @@ void LSN_FASTCALL								Cycle_4__72x0_80x0_88x0_96x0_104x0_112x0_120x0_128x0_13
 void LSN_FASTCALL								Cycle_4__256x0_256x1_256x2_256x3_256x4_256x5_256x6_256x7_256x8_256x9_X() {
 	Pixel_Evaluation_Sprite<false, false>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -199,17 +149,7 @@ void LSN_FASTCALL								Cycle_4__256x0_256x1_256x2_256x3_256x4_256x5_256x6_256x
 void LSN_FASTCALL								Cycle_4__67x0_75x0_83x0_91x0_99x0_107x0_115x0_123x0_131x0_139x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -241,17 +181,7 @@ void LSN_FASTCALL								Cycle_4__67x0_75x0_83x0_91x0_99x0_107x0_115x0_123x0_131
 void LSN_FASTCALL								Cycle_4__73x0_81x0_89x0_97x0_105x0_113x0_121x0_129x0_137x0_145x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -282,17 +212,7 @@ void LSN_FASTCALL								Cycle_4__73x0_81x0_89x0_97x0_105x0_113x0_121x0_129x0_13
 void LSN_FASTCALL								Cycle_4__69x0_77x0_85x0_93x0_101x0_109x0_117x0_125x0_133x0_141x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -320,17 +240,7 @@ void LSN_FASTCALL								Cycle_4__69x0_77x0_85x0_93x0_101x0_109x0_117x0_125x0_13
 void LSN_FASTCALL								Cycle_4__71x0_79x0_87x0_95x0_103x0_111x0_119x0_127x0_135x0_143x0_X() {
 	Pixel_Evaluation_Sprite<false, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -358,17 +268,7 @@ void LSN_FASTCALL								Cycle_4__71x0_79x0_87x0_95x0_103x0_111x0_119x0_127x0_13
 void LSN_FASTCALL								Cycle_4__65x0_65x1_65x2_65x3_65x4_65x5_65x6_65x7_65x8_65x9_X() {
 	Pixel_Evaluation_Sprite<true, true>();
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1607,17 +1507,7 @@ void LSN_FASTCALL								Cycle_4__1x311() {
 void LSN_FASTCALL								Cycle_4__4x0_12x0_20x0_28x0_36x0_44x0_52x0_60x0_4x1_12x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1641,17 +1531,7 @@ void LSN_FASTCALL								Cycle_4__4x0_12x0_20x0_28x0_36x0_44x0_52x0_60x0_4x1_12x
 void LSN_FASTCALL								Cycle_4__2x0_10x0_18x0_26x0_34x0_42x0_50x0_58x0_2x1_10x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1675,17 +1555,7 @@ void LSN_FASTCALL								Cycle_4__2x0_10x0_18x0_26x0_34x0_42x0_50x0_58x0_2x1_10x
 void LSN_FASTCALL								Cycle_4__6x0_14x0_22x0_30x0_38x0_46x0_54x0_62x0_6x1_14x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1709,17 +1579,7 @@ void LSN_FASTCALL								Cycle_4__6x0_14x0_22x0_30x0_38x0_46x0_54x0_62x0_6x1_14x
 void LSN_FASTCALL								Cycle_4__8x0_16x0_24x0_32x0_40x0_48x0_56x0_64x0_8x1_16x1_X() {
 	m_soSecondaryOam.ui8Bytes[m_ui8Oam2ClearIdx++] = m_ui8OamLatch;	m_ui8Oam2ClearIdx %= sizeof( m_soSecondaryOam.ui8Bytes );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1748,17 +1608,7 @@ void LSN_FASTCALL								Cycle_4__8x0_16x0_24x0_32x0_40x0_48x0_56x0_64x0_8x1_16x
 void LSN_FASTCALL								Cycle_4__3x0_11x0_19x0_27x0_35x0_43x0_51x0_59x0_3x1_11x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1790,17 +1640,7 @@ void LSN_FASTCALL								Cycle_4__3x0_11x0_19x0_27x0_35x0_43x0_51x0_59x0_3x1_11x
 void LSN_FASTCALL								Cycle_4__9x0_17x0_25x0_33x0_41x0_49x0_57x0_9x1_17x1_25x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1831,17 +1671,7 @@ void LSN_FASTCALL								Cycle_4__9x0_17x0_25x0_33x0_41x0_49x0_57x0_9x1_17x1_25x
 void LSN_FASTCALL								Cycle_4__5x0_13x0_21x0_29x0_37x0_45x0_53x0_61x0_5x1_13x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
@@ -1869,17 +1699,7 @@ void LSN_FASTCALL								Cycle_4__5x0_13x0_21x0_29x0_37x0_45x0_53x0_61x0_5x1_13x
 void LSN_FASTCALL								Cycle_4__7x0_15x0_23x0_31x0_39x0_47x0_55x0_63x0_7x1_15x1_X() {
 	m_ui8OamLatch = ReadOam( m_ui8OamAddr );
 
-	if ( m_bRendering ) {
-		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
-			if ( m_asActiveSprites.ui8X[I] ) {
-				--m_asActiveSprites.ui8X[I];
-			}
-			else {
-				m_asActiveSprites.ui8ShiftLo[I] <<= 1;
-				m_asActiveSprites.ui8ShiftHi[I] <<= 1;
-			}
-		}
-	}
+	UpdateSprites();
 
 	if ( m_bRendering ) {
 
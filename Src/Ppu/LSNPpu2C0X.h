@@ -13,6 +13,7 @@
 #include "../Bus/LSNBus.h"
 #include "../Display/LSNDisplayClient.h"
 #include "../Display/LSNDisplayHost.h"
+#include "../Filters/LSNFilterKernels.h"
 #include "../Mappers/LSNMapperBase.h"
 #include "../Palette/LSNPalette.h"
 #include "../System/LSNBussable.h"
@@ -31,6 +32,9 @@
 
 //#define LSN_USE_PHI2
 #define LSN_INT_OAM_DECAY
+// Output must match the per-dot path frame-for-frame on sprite_hit_tests_2005.10.05, sprite_overflow_tests, spritecans-2011 and
+//	blargg_ppu_tests_2005.09.15b (Research/nes-test-roms-master).  Comment out to compare against the per-dot path.
+#define LSN_SPRITE_LINE_BUFFER						// Rasterize each line's sprites once instead of scanning the 8 sprite slots at every dot.
 //#define LSN_GEN_PPU
 
 #ifdef LSN_GEN_PPU
@@ -122,6 +126,16 @@ namespace lsn {
 			LSN_SES_FINISHED_OAM_LIST,					/**< When evaluation has gone through all of the OAM sprites. */
 		};
 
+#ifdef LSN_SPRITE_LINE_BUFFER
+		/** The bits of each m_ui8SpriteLine entry. */
+		enum LSN_SPRITE_LINE : uint8_t {
+			LSN_SL_PIXEL_MASK							= 0x03,		/**< The 2-bit sprite pixel.  0 is transparent. */
+			LSN_SL_PALETTE_SHIFT						= 2,		/**< The shift to the 2-bit sprite palette. */
+			LSN_SL_PRIORITY								= 0x10,		/**< Set if the sprite is in front of the background. */
+			LSN_SL_SPRITE0								= 0x20,		/**< Set if the pixel comes from the first sprite in secondary OAM. */
+		};
+#endif	// #ifdef LSN_SPRITE_LINE_BUFFER
+
 
 		// == Functions.
 		/**
@@ -482,6 +496,59 @@ namespace lsn {
 		 */
 		virtual bool									DebugSideDisplay() const { return false; }
 
+		/**
+		 * Sets the render target and selects the scanline-output stage that converts palette indices to its format.
+		 *
+		 * \param _pui8Target Pointer to the pixel buffer to be used as a render target.  This is filled in during frame rendering.
+		 * \param _stStride The stride of each row in the render target.
+		 * \param _pofFormat The output format from the PPU.
+		 * \param _bFlip If true, the output frame is flipped vertically.
+		 */
+		virtual void									SetRenderTarget( uint8_t * _pui8Target, size_t _stStride, LSN_PPU_OUT_FORMAT _pofFormat, bool _bFlip ) {
+			CDisplayClient::SetRenderTarget( _pui8Target, _stStride, _pofFormat, _bFlip );
+			switch ( _pofFormat ) {
+				case LSN_POF_6BIT_PALETTE : {
+					m_pfLineOut = &CPpu2C0X::LineOut6Bit;
+					break;
+				}
+				case LSN_POF_9BIT_PALETTE : {
+					m_pfLineOut = &CPpu2C0X::LineOut9Bit;
+					break;
+				}
+				case LSN_POF_RGB32 : {
+					m_pfLineOut = &CPpu2C0X::LineOutRgb32;
+					break;
+				}
+				default : {
+					m_pfLineOut = &CPpu2C0X::LineOutRgb24;
+				}
+			}
+			if ( _pofFormat == LSN_POF_RGB32 || _pofFormat == LSN_POF_RGB ) {
+				BuildRgb32Palette();
+			}
+		}
+
+		/**
+		 * Informs the PPU that the colors of its palette have changed.  The RGB table is rebuilt immediately and the current and
+		 *	next frames are marked as changed, since their palette indices can match the previous frame's while their colors do not.
+		 */
+		virtual void									PaletteChanged() {
+			if ( m_pofOutFormat == LSN_POF_RGB32 || m_pofOutFormat == LSN_POF_RGB ) {
+				BuildRgb32Palette();
+			}
+			// The scanlines already output this frame used the old colors, so the next frame must not match them either.
+			std::memset( m_ui16PrevFrame, 0xFF, sizeof( m_ui16PrevFrame ) );
+			std::fill( std::begin( m_ui64RowVersion ), std::end( m_ui64RowVersion ), m_ui64FrameVersion + 1 );
+			m_bFrameChanged = true;
+		}
+
+		/**
+		 * Gets the frame version at which each scanline last changed.
+		 *
+		 * \return Returns DisplayHeight() versions, indexed by scanline.
+		 */
+		virtual const uint64_t *						RowVersions() const { return m_ui64RowVersion; }
+
 		/**
 		 * Gets a reference to the PPU bus.
 		 *
@@ -692,6 +759,9 @@ namespace lsn {
 		 */
 		template <unsigned _uSpriteIdx, unsigned _uStage>
 		inline void LSN_FASTCALL						Pixel_Fetch_Sprite() {
+#ifdef LSN_SPRITE_LINE_BUFFER
+			CommitSprites();
+#endif	// #ifdef LSN_SPRITE_LINE_BUFFER
 			if ( !m_bRendering ) { return; }
 			// 1-4: Read the Y-coordinate, tile number, attributes, and X-coordinate of the selected sprite from secondary OAM
 			// ========================
@@ -734,62 +804,67 @@ namespace lsn {
 			};
 			// 5-8: Read the X-coordinate of the selected sprite from secondary OAM 4 times (while the PPU fetches the sprite tile data)
 			if constexpr ( _uStage == 4 ) {
-				m_ui16SpritePatternTmp = 0;
+				if constexpr ( _uSpriteIdx == 0 ) {
+					// The first sprite pattern fetch of the line; let A12 watchers know (sprites are fetched even if there are none on the line).
+					if ( m_pfSpriteFetchFunc ) { m_pfSpriteFetchFunc( m_pvSpriteFetchParm, m_pcPpuCtrl.ui8Reg ); }
+				}
 
+				// Empty slots fetch too (tile $FF from the cleared secondary OAM), which is what clocks A12-based IRQ counters on lines
+				//	without sprites.
 				uint16_t ui16ScanLine = uint16_t( m_ui16CurY );
 				
-				if ( _uSpriteIdx < m_ui8ThisLineSpriteCount ) {
-					// Calculate m_ui16SpritePatternTmp.
-					if ( !m_pcPpuCtrl.s.ui8SpriteSize ) {
-						// 8-by-8.
-						if ( !(m_ui8SpriteAttrib & 0x80) ) {
-							// No vertical flip.
-							m_ui16SpritePatternTmp = (m_pcPpuCtrl.s.ui8SpriteTileSelect << 12) |
-								(m_ui8SpriteM << 4) |
-								((ui16ScanLine - m_ui8SpriteN) & 0x7);
+				// Calculate m_ui16SpritePatternTmp.
+				if ( !m_pcPpuCtrl.s.ui8SpriteSize ) {
+					// 8-by-8.
+					if ( !(m_ui8SpriteAttrib & 0x80) ) {
+						// No vertical flip.
+						m_ui16SpritePatternTmp = (m_pcPpuCtrl.s.ui8SpriteTileSelect << 12) |
+							(m_ui8SpriteM << 4) |
+							((ui16ScanLine - m_ui8SpriteN) & 0x7);
+					}
+					else {
+						// Major vertical flippage going on here.
+						m_ui16SpritePatternTmp = (m_pcPpuCtrl.s.ui8SpriteTileSelect << 12) |
+							(m_ui8SpriteM << 4) |
+							((7 - (ui16ScanLine - m_ui8SpriteN)) & 0x7);
+					}
+				}
+				else {
+					// 8-by-16.
+					uint8_t ui8PatternLine = uint8_t( ui16ScanLine - m_ui8SpriteN );
+					if ( !(m_ui8SpriteAttrib & 0x80) ) {
+						// No vertical flip.
+						if ( ui8PatternLine < 8 ) {
+							// Top half.
+							m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
+								((m_ui8SpriteM & 0xFE) << 4) |
+								(ui8PatternLine & 0x7);
 						}
 						else {
-							// Major vertical flippage going on here.
-							m_ui16SpritePatternTmp = (m_pcPpuCtrl.s.ui8SpriteTileSelect << 12) |
-								(m_ui8SpriteM << 4) |
-								((7 - (ui16ScanLine - m_ui8SpriteN)) & 0x7);
+							// Bottom half.
+							m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
+								(((m_ui8SpriteM & 0xFE) + 1) << 4) |
+								(ui8PatternLine & 0x7);
 						}
 					}
 					else {
-						// 8-by-16.
-						uint8_t ui8PatternLine = uint8_t( ui16ScanLine - m_ui8SpriteN );
-						if ( !(m_ui8SpriteAttrib & 0x80) ) {
-							// No vertical flip.
-							if ( ui8PatternLine < 8 ) {
-								// Top half.
-								m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
-									((m_ui8SpriteM & 0xFE) << 4) |
-									(ui8PatternLine & 0x7);
-							}
-							else {
-								// Bottom half.
-								m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
-									(((m_ui8SpriteM & 0xFE) + 1) << 4) |
-									(ui8PatternLine & 0x7);
-							}
+						// Major vertical flippage going on here.
+						if ( ui8PatternLine < 8 ) {
+							// Top half (using bottom tile).
+							m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
+								(((m_ui8SpriteM & 0xFE) + 1) << 4) |
+								((7 - ui8PatternLine) & 0x7);
 						}
 						else {
-							// Major vertical flippage going on here.
-							if ( ui8PatternLine < 8 ) {
-								// Top half (using bottom tile).
-								m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
-									(((m_ui8SpriteM & 0xFE) + 1) << 4) |
-									((7 - ui8PatternLine) & 0x7);
-							}
-							else {
-								// Bottom half (using top tile).
-								m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
-									((m_ui8SpriteM & 0xFE) << 4) |
-									((7 - ui8PatternLine) & 0x7);
-							}
+							// Bottom half (using top tile).
+							m_ui16SpritePatternTmp = ((m_ui8SpriteM & 0x01) << 12) |
+								((m_ui8SpriteM & 0xFE) << 4) |
+								((7 - ui8PatternLine) & 0x7);
 						}
 					}
-					uint8_t ui8Bits = Read( m_ui16SpritePatternTmp );
+				}
+				uint8_t ui8Bits = Read( m_ui16SpritePatternTmp );
+				if ( _uSpriteIdx < m_ui8ThisLineSpriteCount ) {
 					if ( m_ui8SpriteAttrib & 0x40 ) {
 						ui8Bits = FlipBits( ui8Bits );
 					}
@@ -808,8 +883,8 @@ namespace lsn {
 			// Sprite MSB.
 			// ========================
 			if constexpr ( _uStage == 6 ) {
+				uint8_t ui8Bits = Read( (m_ui16SpritePatternTmp + 8) );
 				if ( _uSpriteIdx < m_ui8ThisLineSpriteCount ) {
-					uint8_t ui8Bits = Read( (m_ui16SpritePatternTmp + 8) );
 					if ( m_ui8SpriteAttrib & 0x40 ) {
 						ui8Bits = FlipBits( ui8Bits );
 					}
@@ -824,6 +899,78 @@ namespace lsn {
 			}
 		}
 
+		/**
+		 * Advances the active sprites by one dot during dots 2-256.  Each sprite counts its X down to 0 and then shifts out its pattern.
+		 */
+		inline void										UpdateSprites() {
+			if ( m_bRendering ) {
+#ifdef LSN_SPRITE_LINE_BUFFER
+				// Every sprite's state is a function of how many updates have run, so only count them.
+				++m_ui8SpriteUpdates;
+#else
+				for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
+					if ( m_asActiveSprites.ui8X[I] ) {
+						--m_asActiveSprites.ui8X[I];
+					}
+					else {
+						m_asActiveSprites.ui8ShiftLo[I] <<= 1;
+						m_asActiveSprites.ui8ShiftHi[I] <<= 1;
+					}
+				}
+#endif	// #ifdef LSN_SPRITE_LINE_BUFFER
+			}
+		}
+
+#ifdef LSN_SPRITE_LINE_BUFFER
+		/**
+		 * Applies the updates counted by UpdateSprites() to m_asActiveSprites and marks m_ui8SpriteLine for rebuilding.  Called
+		 *	before the sprite fetches modify m_asActiveSprites or m_ui8ThisLineSpriteCount.
+		 */
+		inline void										CommitSprites() {
+			if ( m_ui8SpriteUpdates ) {
+				for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
+					if ( m_asActiveSprites.ui8X[I] >= m_ui8SpriteUpdates ) {
+						m_asActiveSprites.ui8X[I] -= m_ui8SpriteUpdates;
+					}
+					else {
+						uint8_t ui8Shift = m_ui8SpriteUpdates - m_asActiveSprites.ui8X[I];
+						m_asActiveSprites.ui8X[I] = 0;
+						m_asActiveSprites.ui8ShiftLo[I] = ui8Shift >= 8 ? 0 : uint8_t( m_asActiveSprites.ui8ShiftLo[I] << ui8Shift );
+						m_asActiveSprites.ui8ShiftHi[I] = ui8Shift >= 8 ? 0 : uint8_t( m_asActiveSprites.ui8ShiftHi[I] << ui8Shift );
+					}
+				}
+				m_ui8SpriteUpdates = 0;
+			}
+			m_bSpriteLineDirty = true;
+		}
+
+		/**
+		 * Rasterizes the active sprites into m_ui8SpriteLine.  Entry N is the front-most opaque sprite pixel after N calls to
+		 *	UpdateSprites(), which is the pixel at dot N + 1 unless rendering was switched off partway through the line.
+		 */
+		void											RasterizeSprites() {
+			std::memset( m_ui8SpriteLine, 0, sizeof( m_ui8SpriteLine ) );
+			// Lower slots are in front, so they are drawn last.
+			for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {
+				uint8_t ui8Lo = m_asActiveSprites.ui8ShiftLo[I];
+				uint8_t ui8Hi = m_asActiveSprites.ui8ShiftHi[I];
+				const uint8_t ui8Latch = m_asActiveSprites.ui8Latch[I];
+				const uint8_t ui8Attr = uint8_t( ((ui8Latch & 0x03) << LSN_SL_PALETTE_SHIFT) |
+					((ui8Latch & 0x20) ? 0 : LSN_SL_PRIORITY) |
+					(I == 0 ? LSN_SL_SPRITE0 : 0) );
+				for ( size_t J = m_asActiveSprites.ui8X[I]; (ui8Lo | ui8Hi) && J < _tRenderW; ++J ) {
+					const uint8_t ui8Pixel = uint8_t( ((ui8Hi & 0x80) >> 6) | ((ui8Lo & 0x80) >> 7) );
+					if ( ui8Pixel ) {
+						m_ui8SpriteLine[J] = ui8Pixel | ui8Attr;
+					}
+					ui8Lo <<= 1;
+					ui8Hi <<= 1;
+				}
+			}
+			m_bSpriteLineDirty = false;
+		}
+#endif	// #ifdef LSN_SPRITE_LINE_BUFFER
+
 		/**
 		 * Writing to 0x2000 (PPUCTRL).
 		 *
@@ -839,6 +986,7 @@ namespace lsn {
 			ppPpu->m_paPpuAddrT.s.ui16NametableX = LSN_CTRL_NAMETABLE_X( ppPpu->m_pcPpuCtrl );
 			ppPpu->m_paPpuAddrT.s.ui16NametableY = LSN_CTRL_NAMETABLE_Y( ppPpu->m_pcPpuCtrl );
 			ppPpu->GlitchyVUpdate( ppPpu->m_ui8IoBusLatch << 10, 0x0400 );
+			if ( ppPpu->m_pfPpuCtrlWriteFunc ) { ppPpu->m_pfPpuCtrlWriteFunc( ppPpu->m_pvPpuCtrlWriteParm, _ui8Val ); }
 			if ( !ppPpu->m_pcPpuCtrl.s.ui8Nmi ) {
 				ppPpu->m_pnNmiTarget->ClearNmi();
 			}
@@ -1194,6 +1342,8 @@ namespace lsn {
 		// == Types.
 		/** Function pointer for per-cycle work. */
 		typedef void (LSN_FASTCALL CPpu2C0X:: *			PfCycles)();
+		/** Function pointer for writing a finished scanline to a render-target row. */
+		typedef void (CPpu2C0X:: *						PfLineOut)( uint8_t * _pui8Row );
 
 		/** The PPUCTRL register. */
 		struct LSN_PPUCTRL {
@@ -1310,9 +1460,20 @@ namespace lsn {
 		__m128											m_m128OamDecayFactor;							/**< The OAM decay factor in an MMX rgister. */
 #endif	// #ifdef LSN_INT_OAM_DECAY
 		LSN_PALETTE										m_pPalette;										/**< The 9-bit palette. */
+		uint32_t										m_ui32Rgb32Palette[1<<9];						/**< The 9-bit palette as RGB32, rebuilt in SetRenderTarget() and PaletteChanged() for the RGB formats. */
+		uint16_t										m_ui16LineBuffer[_tRenderW];					/**< The 9-bit palette indices of the scanline being rendered. */
+		PfLineOut										m_pfLineOut = &CPpu2C0X::LineOutRgb24;			/**< Writes m_ui16LineBuffer to a render-target row in the render target's format. */
+		uint16_t										m_ui16PrevFrame[_tPreRender+_tRender][_tRenderW] = {};	/**< The scanlines of the previous frame, used to detect identical frames. */
+		bool											m_bFrameChanged = true;							/**< Set when a scanline of the current frame differs from the previous frame. */
+		uint64_t										m_ui64RowVersion[_tPreRender+_tRender] = {};	/**< The frame version at which each scanline last changed. */
 		uint64_t										m_ui64Frame;									/**< The frame counter. */
 		//uint64_t										m_ui64Cycle;									/**< The cycle counter. */
 		LSN_ACTIVE_SPRITE								m_asActiveSprites;								/**< The active sprites. */
+#ifdef LSN_SPRITE_LINE_BUFFER
+		uint8_t											m_ui8SpriteLine[_tRenderW];						/**< The active sprites rasterized by RasterizeSprites(), as LSN_SPRITE_LINE bits. */
+		uint8_t											m_ui8SpriteUpdates = 0;							/**< The number of UpdateSprites() calls not yet applied to m_asActiveSprites. */
+		bool											m_bSpriteLineDirty = true;						/**< If true, m_ui8SpriteLine must be rebuilt before it is next read. */
+#endif	// #ifdef LSN_SPRITE_LINE_BUFFER
 		
 		CInterruptable *								m_pnNmiTarget;									/**< The target object of NMI notifications. */
 		uint8_t											m_ui8PaletteRam[LSN_PPU_PALETTE_MEMORY_SIZE];	/**< Dedicated palette RAM. */
@@ -1804,6 +1965,16 @@ namespace lsn {
 					uint8_t ui8ForegroundPriority = 0;
 					bool bIsRenderingSprite0 = false;
 					if ( m_bShowSprites && (m_dvPpuMaskDelay.ValueWithDelay<2>().s.ui8LeftSprites || ui16X >= 8) ) {
+#ifdef LSN_SPRITE_LINE_BUFFER
+						if LSN_UNLIKELY( m_bSpriteLineDirty ) {
+							RasterizeSprites();
+						}
+						const uint8_t ui8Sprite = m_ui8SpriteLine[m_ui8SpriteUpdates];
+						ui8ForegroundPixel = ui8Sprite & LSN_SL_PIXEL_MASK;
+						ui8ForegroundPalette = ((ui8Sprite >> LSN_SL_PALETTE_SHIFT) & 0x03) + 4;
+						ui8ForegroundPriority = (ui8Sprite & LSN_SL_PRIORITY) != 0;
+						bIsRenderingSprite0 = (ui8Sprite & LSN_SL_SPRITE0) != 0;
+#else
 						for ( uint8_t I = 0; I < m_ui8ThisLineSpriteCount; ++I ) {
 							if ( m_asActiveSprites.ui8X[I] == 0 ) {
 								ui8ForegroundPixel = (((m_asActiveSprites.ui8ShiftHi[I] & 0x80) > 0) << 1) |
@@ -1817,6 +1988,7 @@ namespace lsn {
 								}
 							}
 						}
+#endif	// #ifdef LSN_SPRITE_LINE_BUFFER
 					}
 
 					// Handle priority.
@@ -1909,55 +2081,31 @@ namespace lsn {
 					pui8RenderPixel[1] = ui16Val;
 					pui8RenderPixel[2] = ui16Val;
 				}
-#else
-
-				
-				if ( ui16X < _tBorderW || ui16X >= (_tRenderW - _tBorderW) ) {				// Horizontal black border on PAL.
-					if ( m_pofOutFormat == LSN_POF_6BIT_PALETTE ) {
-						uint8_t * pui8RenderPixel = &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X];
-						pui8RenderPixel[0] = 0x0F;
-					}
-					else if ( m_pofOutFormat == LSN_POF_9BIT_PALETTE ) {
-						uint16_t * pui16RenderPixel = reinterpret_cast<uint16_t *>(&m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X*sizeof(uint16_t)]);
-						pui16RenderPixel[0] = 0x0F;
-					}
-					else if ( m_pofOutFormat == LSN_POF_RGB32 ) {
-						uint8_t * pui8RenderPixel = &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X*4];
-						// Above pixel processing done because Sprite 0 can be hit even inside these borders.
-						pui8RenderPixel[0] = 0;
-						pui8RenderPixel[1] = 0;
-						pui8RenderPixel[2] = 0;
-						pui8RenderPixel[3] = 0xFF;
-					}
-					else {
-						uint8_t * pui8RenderPixel = &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X*3];
-						// Above pixel processing done because Sprite 0 can be hit even inside these borders.
-						pui8RenderPixel[0] = 0;
-						pui8RenderPixel[1] = 0;
-						pui8RenderPixel[2] = 0;
-					}
+				if ( ui16X == _tRenderW - 1 && ui16ThisY == _tPreRender + _tRender - 1 ) {
+					++m_ui64FrameVersion;
+					std::fill( std::begin( m_ui64RowVersion ), std::end( m_ui64RowVersion ), m_ui64FrameVersion );
 				}
-				else {
-					if ( m_pofOutFormat == LSN_POF_6BIT_PALETTE ) {
-						uint8_t * pui8RenderPixel = &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X];
-						pui8RenderPixel[0] = uint8_t( ui16Val ) & 0b111111;
-					}
-					else if ( m_pofOutFormat == LSN_POF_9BIT_PALETTE ) {
-						uint16_t * pui16RenderPixel = reinterpret_cast<uint16_t *>(&m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X*sizeof(uint16_t)]);
-						pui16RenderPixel[0] = ui16Val;
-					}
-					else if ( m_pofOutFormat == LSN_POF_RGB32 ) {
-						uint8_t * pui8RenderPixel = &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X*4];
-						pui8RenderPixel[0] = m_pPalette.uVals[ui16Val].ui8Rgb[0];
-						pui8RenderPixel[1] = m_pPalette.uVals[ui16Val].ui8Rgb[1];
-						pui8RenderPixel[2] = m_pPalette.uVals[ui16Val].ui8Rgb[2];
-						pui8RenderPixel[3] = 0xFF;
+#else
+				m_ui16LineBuffer[ui16X] = ui16Val;
+				if ( ui16X == _tRenderW - 1 ) {
+					// The scanline is finished.  Convert it to the render target's format in one pass.
+					(this->*m_pfLineOut)( &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride] );
+					// Compare it against the same scanline of the previous frame so that identical frames can skip filtering.
+					if ( std::memcmp( m_ui16PrevFrame[ui16ThisY], m_ui16LineBuffer, sizeof( m_ui16LineBuffer ) ) != 0 ) {
+						std::memcpy( m_ui16PrevFrame[ui16ThisY], m_ui16LineBuffer, sizeof( m_ui16LineBuffer ) );
+						// Filters refilter only the scanlines whose version is newer than the frame they last filtered.
+						m_ui64RowVersion[ui16ThisY] = m_ui64FrameVersion + 1;
+						m_bFrameChanged = true;
 					}
-					else {
-						uint8_t * pui8RenderPixel = &m_pui8RenderTarget[ui16Y*m_stRenderTargetStride+ui16X*3];
-						pui8RenderPixel[0] = m_pPalette.uVals[ui16Val].ui8Rgb[0];
-						pui8RenderPixel[1] = m_pPalette.uVals[ui16Val].ui8Rgb[1];
-						pui8RenderPixel[2] = m_pPalette.uVals[ui16Val].ui8Rgb[2];
+					if ( ui16ThisY == _tPreRender + _tRender - 1 ) {
+						// The debug side display is drawn outside of the scanlines and can change at any time.
+						if ( m_bFrameChanged || DebugSideDisplay() ) {
+							++m_ui64FrameVersion;
+							m_bFrameChanged = false;
+							if ( DebugSideDisplay() ) {
+								std::fill( std::begin( m_ui64RowVersion ), std::end( m_ui64RowVersion ), m_ui64FrameVersion );
+							}
+						}
 					}
 				}
 #endif	// #ifdef LSN_SHOW_PIXEL
@@ -1966,6 +2114,75 @@ namespace lsn {
 			}
 		}
 
+		/**
+		 * Builds the RGB32 table used by the RGB scanline-output stages from the 9-bit palette.
+		 */
+		void											BuildRgb32Palette() {
+			for ( size_t I = 0; I < std::size( m_ui32Rgb32Palette ); ++I ) {
+				m_ui32Rgb32Palette[I] = uint32_t( m_pPalette.uVals[I].ui8Rgb[0] ) |
+					(uint32_t( m_pPalette.uVals[I].ui8Rgb[1] ) << 8) |
+					(uint32_t( m_pPalette.uVals[I].ui8Rgb[2] ) << 16) |
+					0xFF000000;
+			}
+		}
+
+		/**
+		 * Writes the finished scanline to a 6-bit-palette render-target row.
+		 *
+		 * \param _pui8Row The render-target row.
+		 */
+		void											LineOut6Bit( uint8_t * _pui8Row ) {
+			for ( size_t I = _tBorderW; I < _tRenderW - _tBorderW; ++I ) {
+				_pui8Row[I] = uint8_t( m_ui16LineBuffer[I] ) & 0b111111;
+			}
+			// Horizontal black border on PAL.  The border pixels were still processed because sprite 0 can be hit inside them.
+			for ( size_t I = 0; I < _tBorderW; ++I ) {
+				_pui8Row[I] = _pui8Row[_tRenderW-1-I] = 0x0F;
+			}
+		}
+
+		/**
+		 * Writes the finished scanline to a 9-bit-palette render-target row.
+		 *
+		 * \param _pui8Row The render-target row.
+		 */
+		void											LineOut9Bit( uint8_t * _pui8Row ) {
+			uint16_t * pui16Row = reinterpret_cast<uint16_t *>(_pui8Row);
+			std::memcpy( pui16Row + _tBorderW, m_ui16LineBuffer + _tBorderW, (_tRenderW - _tBorderW * 2) * sizeof( uint16_t ) );
+			// Horizontal black border on PAL.
+			for ( size_t I = 0; I < _tBorderW; ++I ) {
+				pui16Row[I] = pui16Row[_tRenderW-1-I] = 0x0F;
+			}
+		}
+
+		/**
+		 * Writes the finished scanline to an RGB32 render-target row.
+		 *
+		 * \param _pui8Row The render-target row.
+		 */
+		void											LineOutRgb32( uint8_t * _pui8Row ) {
+			uint32_t * pui32Row = reinterpret_cast<uint32_t *>(_pui8Row);
+			CFilterKernels::Kernels().pfPaletteToRgb32( m_ui16LineBuffer + _tBorderW, m_ui32Rgb32Palette, pui32Row + _tBorderW, _tRenderW - _tBorderW * 2 );
+			// Horizontal black border on PAL.
+			for ( size_t I = 0; I < _tBorderW; ++I ) {
+				pui32Row[I] = pui32Row[_tRenderW-1-I] = 0xFF000000;
+			}
+		}
+
+		/**
+		 * Writes the finished scanline to a 24-bit RGB render-target row.
+		 *
+		 * \param _pui8Row The render-target row.
+		 */
+		void											LineOutRgb24( uint8_t * _pui8Row ) {
+			CFilterKernels::Kernels().pfPaletteToRgb24( m_ui16LineBuffer + _tBorderW, m_ui32Rgb32Palette, _pui8Row + _tBorderW * 3, _tRenderW - _tBorderW * 2 );
+			// Horizontal black border on PAL.
+			if constexpr ( _tBorderW != 0 ) {
+				std::memset( _pui8Row, 0, _tBorderW * 3 );
+				std::memset( _pui8Row + (_tRenderW - _tBorderW) * 3, 0, _tBorderW * 3 );
+			}
+		}
+
 #ifdef LSN_GEN_PPU
 		/**
 		 * Executing a single PPU cycle.
@@ -2047,17 +2264,7 @@ namespace lsn {
 
 				if ( (_uX >= (LSN_LEFT + 1) && _uX < LSN_RIGHT) ) {
 					sRet += "\r\n"
-					"	if ( m_bRendering ) {\r\n"
-					"		for ( uint8_t I = m_ui8ThisLineSpriteCount; I--; ) {\r\n"
-					"			if ( m_asActiveSprites.ui8X[I] ) {\r\n"
-					"				--m_asActiveSprites.ui8X[I];\r\n"
-					"			}\r\n"
-					"			else {\r\n"
-					"				m_asActiveSprites.ui8ShiftLo[I] <<= 1;\r\n"
-					"				m_asActiveSprites.ui8ShiftHi[I] <<= 1;\r\n"
-					"			}\r\n"
-					"		}\r\n"
-					"	}\r\n";
+					"	UpdateSprites();\r\n";
 				}
 			}
 			if ( _uY == ui61RenderHeight && _uX == 0 ) {
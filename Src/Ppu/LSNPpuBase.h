@@ -29,6 +29,13 @@ namespace lsn {
 		}
 
 
+		// == Types.
+		/** A function called once per rendered scanline, at the first sprite pattern fetch (dot 261), with the current PPUCTRL value. */
+		typedef void (LSN_FASTCALL *					PfSpriteFetchFunc)( void * _pvParm, uint8_t _ui8PpuCtrl );
+		/** A function called on every write to PPUCTRL, with the new value. */
+		typedef void (LSN_FASTCALL *					PfPpuCtrlWriteFunc)( void * _pvParm, uint8_t _ui8PpuCtrl );
+
+
 		// == Functions.
 		
 
@@ -39,11 +46,39 @@ namespace lsn {
 		 */
 		inline uint64_t									GetCycleCount() const { return m_ui64Cycle; }
 
+		/**
+		 * Sets the function to call at the start of the sprite pattern fetches of each rendered scanline.  Mappers that clock on PPU
+		 *	A12 can use this to derive their edges from the PPU state rather than inspecting every pattern fetch.
+		 *
+		 * \param _pfFunc The function to call or nullptr.
+		 * \param _pvParm The parameter to pass to _pfFunc.
+		 */
+		inline void										SetSpriteFetchFunc( PfSpriteFetchFunc _pfFunc, void * _pvParm ) {
+			m_pfSpriteFetchFunc = _pfFunc;
+			m_pvSpriteFetchParm = _pvParm;
+		}
+
+		/**
+		 * Sets the function to call on every write to PPUCTRL.  Mappers that derive A12 edges from the pattern tables selected in
+		 *	PPUCTRL use this to notice changes made in the middle of a scanline.
+		 *
+		 * \param _pfFunc The function to call or nullptr.
+		 * \param _pvParm The parameter to pass to _pfFunc.
+		 */
+		inline void										SetPpuCtrlWriteFunc( PfPpuCtrlWriteFunc _pfFunc, void * _pvParm ) {
+			m_pfPpuCtrlWriteFunc = _pfFunc;
+			m_pvPpuCtrlWriteParm = _pvParm;
+		}
+
 
 	protected :
 		// == Members.
 		uint64_t										m_ui64Cycle;									/**< The total PPU cycles that have ticked. */
 		CCpuBus *										m_pbBus;										/**< Pointer to the bus. */
+		PfSpriteFetchFunc								m_pfSpriteFetchFunc = nullptr;					/**< Called at the first sprite pattern fetch of each rendered scanline. */
+		void *											m_pvSpriteFetchParm = nullptr;					/**< The parameter passed to m_pfSpriteFetchFunc. */
+		PfPpuCtrlWriteFunc								m_pfPpuCtrlWriteFunc = nullptr;					/**< Called on every write to PPUCTRL. */
+		void *											m_pvPpuCtrlWriteParm = nullptr;					/**< The parameter passed to m_pfPpuCtrlWriteFunc. */
 	};
 
 }	// namespace lsn
@@ -27,6 +27,7 @@ namespace lsn {
 		std::u16string						s16RomName;										/**< The ROM file name in UTF-16. */
 		uint32_t							ui32Crc;										/**< The ROM CRC. */
 		uint32_t							ui32HeaderlessCrc;								/**< The ROM headerless CRC. */
+		uint32_t							ui32FullCrc;									/**< The CRC of the full file. */
 		CMd5::LSN_MD5_HASH					mhMd5;											/**< The ROM MD5. */
 		CMd5::LSN_MD5_HASH					mhHeaderlessMd5;								/**< The ROM headerless MD5. */
 		LSN_MIRROR_MODE						mmMirroring;									/**< The ROM mirroring mode. */
@@ -36,6 +37,7 @@ namespace lsn {
 		uint16_t							ui16Chip;										/**< The mapper chip. */
 		uint16_t							ui16PcbClass;									/**< The PCB class. */
 		bool								bBusConficts = true;							/**< Support bus conflicts (when available)? */
+		bool								bBattery = false;								/**< Does the cartridge have battery-backed RAM? */
 		bool								bMapperSupported;								/**< If true, the necessary mapper is supported. */
 	};
 
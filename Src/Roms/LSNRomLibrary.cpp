@@ -0,0 +1,600 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A persistent index of ROM files and their identifying information.  Scans folders in the background, re-reading only files
+ *	whose size or modification time changed.
+ */
+
+
+#include "LSNRomLibrary.h"
+#include "../File/LSNFileMap.h"
+#include "../File/LSNStdFile.h"
+#include "../File/LSNZipFile.h"
+#include "../System/LSNSystemBase.h"
+#include "../Utilities/LSNStream.h"
+#include "../Utilities/LSNUtilities.h"
+
+#include <filesystem>
+#include <unordered_set>
+
+
+#define LSN_ROM_LIBRARY_VERSION						1
+
+namespace lsn {
+
+	CRomLibrary::CRomLibrary() :
+		m_bScanning( false ),
+		m_bStopScan( false ),
+		m_bDirty( false ) {
+	}
+	CRomLibrary::~CRomLibrary() {
+		StopScan();
+	}
+
+	// == Functions.
+	/**
+	 * Loads the index from a file and remembers the path for later saves.  A missing file leaves an empty index.
+	 *
+	 * \param _u16Path The path to the index file.
+	 * \return Returns true if the file was loaded.
+	 **/
+	bool CRomLibrary::Load( const std::u16string &_u16Path ) {
+		StopScan();
+		std::lock_guard<std::mutex> lgLock( m_mMutex );
+		try {
+			m_u16File = _u16Path;
+			m_vEntries.clear();
+			m_mEmptyFiles.clear();
+			m_bDirty = false;
+
+			CStdFile sfFile;
+			std::vector<uint8_t> vFile;
+			if ( !sfFile.Open( _u16Path.c_str() ) || !sfFile.LoadToMemory( vFile ) ) {
+				RebuildMaps();
+				return false;
+			}
+			sfFile.Close();
+
+			CStream sStream( vFile );
+			uint32_t ui32Version;
+			uint64_t ui64Total;
+			if ( !sStream.ReadUi32( ui32Version ) || ui32Version > LSN_ROM_LIBRARY_VERSION || !sStream.ReadUi64( ui64Total ) ) {
+				RebuildMaps();
+				return false;
+			}
+			m_vEntries.reserve( size_t( ui64Total ) );
+			for ( uint64_t I = 0; I < ui64Total; ++I ) {
+				LSN_ENTRY eEntry;
+				if ( !ReadEntry( sStream, eEntry ) ) {
+					m_vEntries.clear();
+					RebuildMaps();
+					return false;
+				}
+				m_vEntries.push_back( std::move( eEntry ) );
+			}
+			if ( ui32Version >= 1 ) {
+				if ( !sStream.ReadUi64( ui64Total ) ) {
+					m_vEntries.clear();
+					RebuildMaps();
+					return false;
+				}
+				for ( uint64_t I = 0; I < ui64Total; ++I ) {
+					LSN_EMPTY_FILE efFile;
+					if ( !sStream.ReadStringU16( efFile.u16Path ) || !sStream.ReadUi64( efFile.ui64Size ) || !sStream.ReadUi64( efFile.ui64ModTime ) ) {
+						m_vEntries.clear();
+						m_mEmptyFiles.clear();
+						RebuildMaps();
+						return false;
+					}
+					std::u16string u16Key = Normalize( efFile.u16Path );
+					m_mEmptyFiles[u16Key] = std::move( efFile );
+				}
+			}
+			RebuildMaps();
+			return true;
+		}
+		catch ( ... ) {
+			m_vEntries.clear();
+			m_mEmptyFiles.clear();
+			try { RebuildMaps(); } catch ( ... ) {}
+			return false;
+		}
+	}
+
+	/**
+	 * Saves the index to the path given to Load() if it has changed.
+	 *
+	 * \return Returns true if the index was saved or did not need to be saved.
+	 **/
+	bool CRomLibrary::Save() {
+		std::lock_guard<std::mutex> lgLock( m_mMutex );
+		if ( !m_bDirty ) { return true; }
+		if ( !m_u16File.size() ) { return false; }
+		try {
+			std::vector<uint8_t> vFile;
+			CStream sStream( vFile );
+			if ( !sStream.WriteUi32( LSN_ROM_LIBRARY_VERSION ) ) { return false; }
+			if ( !sStream.WriteUi64( m_vEntries.size() ) ) { return false; }
+			for ( size_t I = 0; I < m_vEntries.size(); ++I ) {
+				if ( !WriteEntry( sStream, m_vEntries[I] ) ) { return false; }
+			}
+			if ( !sStream.WriteUi64( m_mEmptyFiles.size() ) ) { return false; }
+			for ( const auto & aFile : m_mEmptyFiles ) {
+				if ( !sStream.WriteStringU16( aFile.second.u16Path ) ) { return false; }
+				if ( !sStream.WriteUi64( aFile.second.ui64Size ) ) { return false; }
+				if ( !sStream.WriteUi64( aFile.second.ui64ModTime ) ) { return false; }
+			}
+
+			// Write to a temporary file and swap it in so that an interrupted save cannot destroy the existing index.
+			std::u16string u16Tmp = m_u16File + u".tmp";
+			{
+				CStdFile sfFile;
+				if ( !sfFile.Create( u16Tmp.c_str() ) ) { return false; }
+				if ( !sfFile.WriteToFile( vFile ) ) { return false; }
+			}
+			std::error_code ecErr;
+			std::filesystem::rename( std::filesystem::path( u16Tmp ), std::filesystem::path( m_u16File ), ecErr );
+			if ( ecErr ) { return false; }
+			m_bDirty = false;
+			return true;
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * Starts scanning folders in the background.  Any scan already in progress is stopped first.
+	 *
+	 * \param _vFolders The folders to scan.
+	 * \param _bRecursive If true, sub-folders are also scanned.
+	 * \param _stThreads The number of threads to use to read files, or 0 to use one per hardware thread.
+	 **/
+	void CRomLibrary::StartScan( const std::vector<std::u16string> &_vFolders, bool _bRecursive, size_t _stThreads ) {
+		StopScan();
+		if ( !_stThreads ) { _stThreads = std::max<size_t>( std::thread::hardware_concurrency(), 1 ); }
+		try {
+			m_bStopScan = false;
+			m_bScanning = true;
+			m_tScanThread = std::thread( &CRomLibrary::ScanThread, this, _vFolders, _bRecursive, _stThreads );
+		}
+		catch ( ... ) { m_bScanning = false; }
+	}
+
+	/**
+	 * Stops the background scan, if any, and waits for it to finish.  Files already read are kept.
+	 **/
+	void CRomLibrary::StopScan() {
+		m_bStopScan = true;
+		if ( m_tScanThread.joinable() ) {
+			m_tScanThread.join();
+		}
+		m_bScanning = false;
+	}
+
+	/**
+	 * Adds or updates the entry for a ROM that has just been loaded, so that the index stays current without a scan.
+	 *
+	 * \param _riInfo The information of the loaded ROM.
+	 * \param _bInDatabase If true, the ROM was found in the database.
+	 **/
+	void CRomLibrary::Add( const LSN_ROM_INFO &_riInfo, bool _bInDatabase ) {
+		try {
+			LSN_ENTRY eEntry;
+			FillEntry( _riInfo, _bInDatabase, eEntry );
+			eEntry.u16Container = ContainerPath( eEntry.u16Path );
+			if ( !FileStamp( eEntry.u16Container, eEntry.ui64Size, eEntry.ui64ModTime ) ) { return; }
+
+			std::lock_guard<std::mutex> lgLock( m_mMutex );
+			m_mEmptyFiles.erase( Normalize( eEntry.u16Container ) );
+			auto aFound = m_mPaths.find( Normalize( eEntry.u16Path ) );
+			if ( aFound != m_mPaths.end() ) {
+				m_vEntries[aFound->second] = std::move( eEntry );
+			}
+			else {
+				m_vEntries.push_back( std::move( eEntry ) );
+			}
+			RebuildMaps();
+			m_bDirty = true;
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Finds a ROM by path.
+	 *
+	 * \param _u16Path The full path to the ROM.
+	 * \param _eEntry Holds the entry upon success.
+	 * \return Returns true if the ROM is indexed.
+	 **/
+	bool CRomLibrary::FindPath( const std::u16string &_u16Path, LSN_ENTRY &_eEntry ) const {
+		try {
+			std::lock_guard<std::mutex> lgLock( m_mMutex );
+			auto aFound = m_mPaths.find( Normalize( _u16Path ) );
+			if ( aFound == m_mPaths.end() ) { return false; }
+			_eEntry = m_vEntries[aFound->second];
+			return true;
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * Gets the indexed ROM files inside a ZIP file.  Fails if the ZIP file is not indexed or has changed since it was indexed.
+	 *
+	 * \param _u16ZipPath The path to the ZIP file.
+	 * \param _vFiles Holds the names of the ROM files inside the ZIP file upon success.
+	 * \return Returns true if the ZIP file is indexed and up-to-date.
+	 **/
+	bool CRomLibrary::ArchiveFiles( const std::u16string &_u16ZipPath, std::vector<std::u16string> &_vFiles ) const {
+		try {
+			uint64_t ui64Size, ui64ModTime;
+			if ( !FileStamp( _u16ZipPath, ui64Size, ui64ModTime ) ) { return false; }
+
+			std::lock_guard<std::mutex> lgLock( m_mMutex );
+			auto aRange = m_mContainers.equal_range( Normalize( _u16ZipPath ) );
+			if ( aRange.first == aRange.second ) { return false; }
+			std::vector<std::u16string> vFiles;
+			for ( auto I = aRange.first; I != aRange.second; ++I ) {
+				const LSN_ENTRY & eEntry = m_vEntries[I->second];
+				if ( eEntry.ui64Size != ui64Size || eEntry.ui64ModTime != ui64ModTime ) { return false; }
+				// "Zip{File}".
+				if ( eEntry.u16Path.size() < eEntry.u16Container.size() + 2 ) { return false; }
+				vFiles.push_back( eEntry.u16Path.substr( eEntry.u16Container.size() + 1, eEntry.u16Path.size() - eEntry.u16Container.size() - 2 ) );
+			}
+			_vFiles = std::move( vFiles );
+			return true;
+		}
+		catch ( ... ) { return false; }
+	}
+
+	/**
+	 * Gets the number of indexed ROMs.
+	 *
+	 * \return Returns the number of indexed ROMs.
+	 **/
+	size_t CRomLibrary::Size() const {
+		std::lock_guard<std::mutex> lgLock( m_mMutex );
+		return m_vEntries.size();
+	}
+
+	/**
+	 * The background scan.
+	 *
+	 * \param _vFolders The folders to scan.
+	 * \param _bRecursive If true, sub-folders are also scanned.
+	 * \param _stThreads The number of threads to use to read files.
+	 **/
+	void CRomLibrary::ScanThread( std::vector<std::u16string> _vFolders, bool _bRecursive, size_t _stThreads ) {
+		try {
+			// Map keys use the native separator (Normalize() only converts separators on Windows).
+			constexpr char16_t c16Sep = char16_t( std::filesystem::path::preferred_separator );
+
+			// Gather the files on disk.
+			std::vector<LSN_SCAN_FILE> vFound;
+			std::vector<std::u16string> vFolderKeys;
+			for ( size_t I = 0; I < _vFolders.size() && !m_bStopScan; ++I ) {
+				std::error_code ecErr;
+				std::filesystem::path pFolder( _vFolders[I] );
+				if ( !std::filesystem::is_directory( pFolder, ecErr ) ) { continue; }
+				vFolderKeys.push_back( Normalize( pFolder.u16string() ) );
+				if ( vFolderKeys.back().size() && vFolderKeys.back().back() != c16Sep ) { vFolderKeys.back().push_back( c16Sep ); }
+
+				auto AddFile = [&]( const std::filesystem::directory_entry &_deEntry ) {
+					std::error_code ecFileErr;
+					if ( !_deEntry.is_regular_file( ecFileErr ) ) { return; }
+					std::u16string u16Ext = CUtilities::ToLower( _deEntry.path().extension().u16string() );
+					if ( u16Ext != u".nes" && u16Ext != u".zip" ) { return; }
+					LSN_SCAN_FILE sfFile;
+					sfFile.u16Path = _deEntry.path().u16string();
+					if ( !FileStamp( sfFile.u16Path, sfFile.ui64Size, sfFile.ui64ModTime ) ) { return; }
+					vFound.push_back( std::move( sfFile ) );
+				};
+				if ( _bRecursive ) {
+					for ( std::filesystem::recursive_directory_iterator rdiI( pFolder, std::filesystem::directory_options::skip_permission_denied, ecErr ), rdiEnd; !ecErr && rdiI != rdiEnd && !m_bStopScan; rdiI.increment( ecErr ) ) {
+						AddFile( (*rdiI) );
+					}
+				}
+				else {
+					for ( std::filesystem::directory_iterator diI( pFolder, std::filesystem::directory_options::skip_permission_denied, ecErr ), diEnd; !ecErr && diI != diEnd && !m_bStopScan; diI.increment( ecErr ) ) {
+						AddFile( (*diI) );
+					}
+				}
+			}
+			if ( m_bStopScan ) {
+				m_bScanning = false;
+				return;
+			}
+
+			// Keep only the files that are new or changed, and find indexed files in the scanned folders that no longer exist.
+			std::vector<LSN_SCAN_FILE> vChanged;
+			{
+				std::unordered_set<std::u16string> sFoundKeys;
+				std::lock_guard<std::mutex> lgLock( m_mMutex );
+				for ( size_t I = 0; I < vFound.size(); ++I ) {
+					std::u16string u16Key = Normalize( vFound[I].u16Path );
+					bool bChanged;
+					auto aFound = m_mContainers.find( u16Key );
+					if ( aFound != m_mContainers.end() ) {
+						bChanged = m_vEntries[aFound->second].ui64Size != vFound[I].ui64Size || m_vEntries[aFound->second].ui64ModTime != vFound[I].ui64ModTime;
+					}
+					else {
+						// Files with no valid ROMs are remembered by their stamps alone.
+						auto aEmpty = m_mEmptyFiles.find( u16Key );
+						bChanged = aEmpty == m_mEmptyFiles.end() ||
+							aEmpty->second.ui64Size != vFound[I].ui64Size || aEmpty->second.ui64ModTime != vFound[I].ui64ModTime;
+					}
+					if ( bChanged ) {
+						vChanged.push_back( std::move( vFound[I] ) );
+					}
+					sFoundKeys.insert( std::move( u16Key ) );
+				}
+				std::unordered_set<std::u16string> sRemoved;
+				auto RemoveIfGone = [&]( const std::u16string &_u16Key, const std::u16string &_u16Path ) {
+					if ( sFoundKeys.count( _u16Key ) || sRemoved.count( _u16Key ) ) { return; }
+					for ( size_t J = 0; J < vFolderKeys.size(); ++J ) {
+						if ( _u16Key.compare( 0, vFolderKeys[J].size(), vFolderKeys[J] ) == 0 &&
+							(_bRecursive || _u16Key.find( c16Sep, vFolderKeys[J].size() ) == std::u16string::npos) ) {
+							sRemoved.insert( _u16Key );
+							LSN_SCAN_FILE sfGone;
+							sfGone.u16Path = _u16Path;
+							vChanged.push_back( std::move( sfGone ) );
+							break;
+						}
+					}
+				};
+				for ( auto I = m_mContainers.begin(); I != m_mContainers.end(); ++I ) {
+					RemoveIfGone( I->first, m_vEntries[I->second].u16Container );
+				}
+				for ( auto I = m_mEmptyFiles.begin(); I != m_mEmptyFiles.end(); ++I ) {
+					RemoveIfGone( I->first, I->second.u16Path );
+				}
+			}
+
+			// Read the changed files in parallel.
+			std::atomic<size_t> aNext = 0;
+			auto Worker = [&]() {
+				for ( size_t I = aNext++; I < vChanged.size() && !m_bStopScan; I = aNext++ ) {
+					if ( vChanged[I].ui64ModTime || vChanged[I].ui64Size ) {
+						ReadFile( vChanged[I] );
+					}
+				}
+			};
+			std::vector<std::thread> vThreads;
+			for ( size_t I = 1; I < std::min( _stThreads, vChanged.size() ); ++I ) {
+				vThreads.emplace_back( Worker );
+			}
+			Worker();
+			for ( auto & tThread : vThreads ) { tThread.join(); }
+
+			if ( !m_bStopScan && vChanged.size() ) {
+				{
+					std::lock_guard<std::mutex> lgLock( m_mMutex );
+					ReplaceContainers( vChanged );
+				}
+				Save();
+			}
+		}
+		catch ( ... ) {}
+		m_bScanning = false;
+	}
+
+	/**
+	 * Reads every ROM in a file.
+	 *
+	 * \param _sfFile The file to read.  Its entries are filled.
+	 **/
+	void CRomLibrary::ReadFile( LSN_SCAN_FILE &_sfFile ) {
+		try {
+			auto AddRom = [&]( const uint8_t * _pui8Data, size_t _sSize, const std::u16string &_u16RomPath ) {
+				LSN_ROM_INFO riInfo;
+				bool bInDatabase = false;
+				if ( CSystemBase::ReadRomInfo( _pui8Data, _sSize, riInfo, _u16RomPath, &bInDatabase ) ) {
+					LSN_ENTRY eEntry;
+					FillEntry( riInfo, bInDatabase, eEntry );
+					eEntry.u16Container = _sfFile.u16Path;
+					eEntry.ui64Size = _sfFile.ui64Size;
+					eEntry.ui64ModTime = _sfFile.ui64ModTime;
+					_sfFile.vEntries.push_back( std::move( eEntry ) );
+				}
+			};
+
+			if ( CUtilities::ToLower( CUtilities::GetFileExtension( _sfFile.u16Path ) ) == u"zip" ) {
+				CZipFile zfFile;
+				if ( !zfFile.Open( _sfFile.u16Path.c_str() ) ) { return; }
+				std::vector<std::u16string> vFiles;
+				if ( !zfFile.GatherArchiveFiles( vFiles, u".nes" ) ) { return; }
+				std::vector<uint8_t> vData;
+				for ( size_t I = 0; I < vFiles.size(); ++I ) {
+					if ( !zfFile.ExtractToMemory( vFiles[I], vData ) ) { continue; }
+					AddRom( vData.data(), vData.size(), _sfFile.u16Path + u"{" + vFiles[I] + u"}" );
+				}
+			}
+			else {
+				CFileMap fmFile;
+				CFileMap::LSN_VIEW vView;
+				if ( !fmFile.OpenReadOnly( std::filesystem::path( _sfFile.u16Path ) ) || fmFile.Size() > SIZE_MAX ) { return; }
+				if ( !fmFile.MapView( 0, size_t( fmFile.Size() ), vView ) ) { return; }
+				AddRom( vView.pui8Data, vView.sSize, _sfFile.u16Path );
+				CFileMap::UnmapView( vView );
+			}
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Fills an entry from ROM information.
+	 *
+	 * \param _riInfo The ROM information.
+	 * \param _bInDatabase If true, the ROM was found in the database.
+	 * \param _eEntry The entry to fill.
+	 **/
+	void CRomLibrary::FillEntry( const LSN_ROM_INFO &_riInfo, bool _bInDatabase, LSN_ENTRY &_eEntry ) {
+		_eEntry.u16Path = _riInfo.s16File;
+		_eEntry.ui32Crc = _riInfo.ui32Crc;
+		_eEntry.ui32HeaderlessCrc = _riInfo.ui32HeaderlessCrc;
+		_eEntry.ui32FullCrc = _riInfo.ui32FullCrc;
+		_eEntry.mhMd5 = _riInfo.mhMd5;
+		_eEntry.mhHeaderlessMd5 = _riInfo.mhHeaderlessMd5;
+		_eEntry.mmMirroring = _riInfo.mmMirroring;
+		_eEntry.pmConsoleRegion = _riInfo.pmConsoleRegion;
+		_eEntry.ui16Mapper = _riInfo.ui16Mapper;
+		_eEntry.ui16SubMapper = _riInfo.ui16SubMapper;
+		_eEntry.ui16Chip = _riInfo.ui16Chip;
+		_eEntry.ui16PcbClass = _riInfo.ui16PcbClass;
+		_eEntry.bInDatabase = _bInDatabase;
+	}
+
+	/**
+	 * Replaces the entries of a set of containers.  Call with m_mMutex locked.
+	 *
+	 * \param _vFiles The rescanned containers and their new entries.
+	 **/
+	void CRomLibrary::ReplaceContainers( std::vector<LSN_SCAN_FILE> &_vFiles ) {
+		std::unordered_set<std::u16string> sReplace;
+		for ( size_t I = 0; I < _vFiles.size(); ++I ) {
+			std::u16string u16Key = Normalize( _vFiles[I].u16Path );
+			m_mEmptyFiles.erase( u16Key );
+			// Files that were read but hold no valid ROMs are remembered so that they are not read again until they change.
+			//	Files that are gone have no stamp.
+			if ( !_vFiles[I].vEntries.size() && (_vFiles[I].ui64Size || _vFiles[I].ui64ModTime) ) {
+				LSN_EMPTY_FILE efFile;
+				efFile.u16Path = _vFiles[I].u16Path;
+				efFile.ui64Size = _vFiles[I].ui64Size;
+				efFile.ui64ModTime = _vFiles[I].ui64ModTime;
+				m_mEmptyFiles[u16Key] = std::move( efFile );
+			}
+			sReplace.insert( std::move( u16Key ) );
+		}
+		std::vector<LSN_ENTRY> vNew;
+		vNew.reserve( m_vEntries.size() );
+		for ( size_t I = 0; I < m_vEntries.size(); ++I ) {
+			if ( !sReplace.count( Normalize( m_vEntries[I].u16Container ) ) ) {
+				vNew.push_back( std::move( m_vEntries[I] ) );
+			}
+		}
+		for ( size_t I = 0; I < _vFiles.size(); ++I ) {
+			for ( size_t J = 0; J < _vFiles[I].vEntries.size(); ++J ) {
+				vNew.push_back( std::move( _vFiles[I].vEntries[J] ) );
+			}
+		}
+		m_vEntries = std::move( vNew );
+		RebuildMaps();
+		m_bDirty = true;
+	}
+
+	/**
+	 * Rebuilds the maps from m_vEntries.  Call with m_mMutex locked.
+	 **/
+	void CRomLibrary::RebuildMaps() {
+		m_mPaths.clear();
+		m_mContainers.clear();
+		m_mPaths.reserve( m_vEntries.size() );
+		m_mContainers.reserve( m_vEntries.size() );
+		for ( size_t I = 0; I < m_vEntries.size(); ++I ) {
+			const LSN_ENTRY & eEntry = m_vEntries[I];
+			m_mPaths[Normalize( eEntry.u16Path )] = I;
+			m_mContainers.emplace( Normalize( eEntry.u16Container ), I );
+		}
+	}
+
+	/**
+	 * Gets the normalized form of a path used as a map key.  On Windows, paths are lower-cased and back-slashed.  Elsewhere, file
+	 *	systems can be case-sensitive, so paths are used as-is.
+	 *
+	 * \param _u16Path The path to normalize.
+	 * \return Returns the normalized path.
+	 **/
+	std::u16string CRomLibrary::Normalize( const std::u16string &_u16Path ) {
+#ifdef LSN_WINDOWS
+		return CUtilities::ToLower( CUtilities::Replace( _u16Path, u'/', u'\\' ) );
+#else
+		return _u16Path;
+#endif	// #ifdef LSN_WINDOWS
+	}
+
+	/**
+	 * Gets the container of a ROM path (the part before "{" for ROMs inside ZIP files).
+	 *
+	 * \param _u16Path The ROM path.
+	 * \return Returns the path of the file on disk.
+	 **/
+	std::u16string CRomLibrary::ContainerPath( const std::u16string &_u16Path ) {
+		if ( CUtilities::LastChar( _u16Path ) == u'}' ) {
+			size_t sPos = _u16Path.rfind( u'{' );
+			if ( sPos != std::u16string::npos ) { return _u16Path.substr( 0, sPos ); }
+		}
+		return _u16Path;
+	}
+
+	/**
+	 * Gets the size and modification time of a file.
+	 *
+	 * \param _u16Path The path to the file.
+	 * \param _ui64Size Holds the size of the file.
+	 * \param _ui64ModTime Holds the modification time of the file.
+	 * \return Returns true if the file exists.
+	 **/
+	bool CRomLibrary::FileStamp( const std::u16string &_u16Path, uint64_t &_ui64Size, uint64_t &_ui64ModTime ) {
+		std::error_code ecErr;
+		std::filesystem::path pPath( _u16Path );
+		_ui64Size = uint64_t( std::filesystem::file_size( pPath, ecErr ) );
+		if ( ecErr ) { return false; }
+		_ui64ModTime = uint64_t( std::filesystem::last_write_time( pPath, ecErr ).time_since_epoch().count() );
+		return !ecErr;
+	}
+
+	/**
+	 * Writes an entry to a stream.
+	 *
+	 * \param _sStream The stream to which to write.
+	 * \param _eEntry The entry to write.
+	 * \return Returns true if the entry was written.
+	 **/
+	bool CRomLibrary::WriteEntry( CStream &_sStream, const LSN_ENTRY &_eEntry ) {
+		if ( !_sStream.WriteStringU16( _eEntry.u16Path ) ) { return false; }
+		if ( !_sStream.WriteStringU16( _eEntry.u16Container ) ) { return false; }
+		if ( !_sStream.WriteUi64( _eEntry.ui64Size ) ) { return false; }
+		if ( !_sStream.WriteUi64( _eEntry.ui64ModTime ) ) { return false; }
+		if ( !_sStream.WriteUi32( _eEntry.ui32Crc ) ) { return false; }
+		if ( !_sStream.WriteUi32( _eEntry.ui32HeaderlessCrc ) ) { return false; }
+		if ( !_sStream.WriteUi32( _eEntry.ui32FullCrc ) ) { return false; }
+		if ( !_sStream.Write( _eEntry.mhMd5 ) ) { return false; }
+		if ( !_sStream.Write( _eEntry.mhHeaderlessMd5 ) ) { return false; }
+		if ( !_sStream.Write( _eEntry.mmMirroring ) ) { return false; }
+		if ( !_sStream.Write( _eEntry.pmConsoleRegion ) ) { return false; }
+		if ( !_sStream.WriteUi16( _eEntry.ui16Mapper ) ) { return false; }
+		if ( !_sStream.WriteUi16( _eEntry.ui16SubMapper ) ) { return false; }
+		if ( !_sStream.WriteUi16( _eEntry.ui16Chip ) ) { return false; }
+		if ( !_sStream.WriteUi16( _eEntry.ui16PcbClass ) ) { return false; }
+		if ( !_sStream.WriteBool( _eEntry.bInDatabase ) ) { return false; }
+		return true;
+	}
+
+	/**
+	 * Reads an entry from a stream.
+	 *
+	 * \param _sStream The stream from which to read.
+	 * \param _eEntry Holds the entry upon success.
+	 * \return Returns true if the entry was read.
+	 **/
+	bool CRomLibrary::ReadEntry( CStream &_sStream, LSN_ENTRY &_eEntry ) {
+		if ( !_sStream.ReadStringU16( _eEntry.u16Path ) ) { return false; }
+		if ( !_sStream.ReadStringU16( _eEntry.u16Container ) ) { return false; }
+		if ( !_sStream.ReadUi64( _eEntry.ui64Size ) ) { return false; }
+		if ( !_sStream.ReadUi64( _eEntry.ui64ModTime ) ) { return false; }
+		if ( !_sStream.ReadUi32( _eEntry.ui32Crc ) ) { return false; }
+		if ( !_sStream.ReadUi32( _eEntry.ui32HeaderlessCrc ) ) { return false; }
+		if ( !_sStream.ReadUi32( _eEntry.ui32FullCrc ) ) { return false; }
+		if ( !_sStream.Read( _eEntry.mhMd5 ) ) { return false; }
+		if ( !_sStream.Read( _eEntry.mhHeaderlessMd5 ) ) { return false; }
+		if ( !_sStream.Read( _eEntry.mmMirroring ) ) { return false; }
+		if ( !_sStream.Read( _eEntry.pmConsoleRegion ) ) { return false; }
+		if ( !_sStream.ReadUi16( _eEntry.ui16Mapper ) ) { return false; }
+		if ( !_sStream.ReadUi16( _eEntry.ui16SubMapper ) ) { return false; }
+		if ( !_sStream.ReadUi16( _eEntry.ui16Chip ) ) { return false; }
+		if ( !_sStream.ReadUi16( _eEntry.ui16PcbClass ) ) { return false; }
+		if ( !_sStream.ReadBool( _eEntry.bInDatabase ) ) { return false; }
+		return true;
+	}
+
+}	// namespace lsn
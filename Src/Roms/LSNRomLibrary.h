@@ -0,0 +1,249 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A persistent index of ROM files and their identifying information.  Scans folders in the background, re-reading only files
+ *	whose size or modification time changed.
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+#include "LSNRomInfo.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace lsn {
+
+	class CStream;
+
+	/**
+	 * Class CRomLibrary
+	 * \brief A persistent index of ROM files and their identifying information.
+	 *
+	 * Description: A persistent index of ROM files and their identifying information.  Scans folders in the background, re-reading only files
+	 *	whose size or modification time changed.  Entries inside ZIP files use the same "Zip{File}" path format as the recent-files list.
+	 */
+	class CRomLibrary {
+	public :
+		CRomLibrary();
+		~CRomLibrary();
+
+
+		// == Types.
+		/** An indexed ROM. */
+		struct LSN_ENTRY {
+			std::u16string									u16Path;								/**< The full path to the ROM. */
+			std::u16string									u16Container;							/**< The file on disk that holds the ROM (the ZIP file for archived ROMs). */
+			uint64_t										ui64Size = 0;							/**< The size of the container. */
+			uint64_t										ui64ModTime = 0;						/**< The modification time of the container. */
+			uint32_t										ui32Crc = 0;							/**< The PRG CRC. */
+			uint32_t										ui32HeaderlessCrc = 0;					/**< The headerless CRC. */
+			uint32_t										ui32FullCrc = 0;						/**< The CRC of the full image. */
+			CMd5::LSN_MD5_HASH								mhMd5 = {};								/**< The MD5 of the full image. */
+			CMd5::LSN_MD5_HASH								mhHeaderlessMd5 = {};					/**< The headerless MD5. */
+			LSN_MIRROR_MODE									mmMirroring = LSN_MM_HORIZONTAL;		/**< The mirroring mode. */
+			LSN_PPU_METRICS									pmConsoleRegion = LSN_PM_UNKNOWN;		/**< NTSC, PAL, or Dendy. */
+			uint16_t										ui16Mapper = 0;							/**< The mapper. */
+			uint16_t										ui16SubMapper = 0;						/**< The sub-mapper. */
+			uint16_t										ui16Chip = 0;							/**< The mapper chip. */
+			uint16_t										ui16PcbClass = 0;						/**< The PCB class. */
+			bool											bInDatabase = false;					/**< If true, the ROM was found in the database. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Loads the index from a file and remembers the path for later saves.  A missing file leaves an empty index.
+		 *
+		 * \param _u16Path The path to the index file.
+		 * \return Returns true if the file was loaded.
+		 **/
+		bool												Load( const std::u16string &_u16Path );
+
+		/**
+		 * Saves the index to the path given to Load() if it has changed.
+		 *
+		 * \return Returns true if the index was saved or did not need to be saved.
+		 **/
+		bool												Save();
+
+		/**
+		 * Starts scanning folders in the background.  Any scan already in progress is stopped first.
+		 *
+		 * \param _vFolders The folders to scan.
+		 * \param _bRecursive If true, sub-folders are also scanned.
+		 * \param _stThreads The number of threads to use to read files, or 0 to use one per hardware thread.
+		 **/
+		void												StartScan( const std::vector<std::u16string> &_vFolders, bool _bRecursive = false, size_t _stThreads = 0 );
+
+		/**
+		 * Stops the background scan, if any, and waits for it to finish.  Files already read are kept.
+		 **/
+		void												StopScan();
+
+		/**
+		 * Determines if a background scan is running.
+		 *
+		 * \return Returns true if a background scan is running.
+		 **/
+		inline bool											Scanning() const { return m_bScanning; }
+
+		/**
+		 * Adds or updates the entry for a ROM that has just been loaded, so that the index stays current without a scan.
+		 *
+		 * \param _riInfo The information of the loaded ROM.
+		 * \param _bInDatabase If true, the ROM was found in the database.
+		 **/
+		void												Add( const LSN_ROM_INFO &_riInfo, bool _bInDatabase );
+
+		/**
+		 * Finds a ROM by path.
+		 *
+		 * \param _u16Path The full path to the ROM.
+		 * \param _eEntry Holds the entry upon success.
+		 * \return Returns true if the ROM is indexed.
+		 **/
+		bool												FindPath( const std::u16string &_u16Path, LSN_ENTRY &_eEntry ) const;
+
+		/**
+		 * Gets the indexed ROM files inside a ZIP file.  Fails if the ZIP file is not indexed or has changed since it was indexed.
+		 *
+		 * \param _u16ZipPath The path to the ZIP file.
+		 * \param _vFiles Holds the names of the ROM files inside the ZIP file upon success.
+		 * \return Returns true if the ZIP file is indexed and up-to-date.
+		 **/
+		bool												ArchiveFiles( const std::u16string &_u16ZipPath, std::vector<std::u16string> &_vFiles ) const;
+
+		/**
+		 * Gets the number of indexed ROMs.
+		 *
+		 * \return Returns the number of indexed ROMs.
+		 **/
+		size_t												Size() const;
+
+
+	protected :
+		// == Types.
+		/** A file found by a scan. */
+		struct LSN_SCAN_FILE {
+			std::u16string									u16Path;								/**< The path to the file. */
+			uint64_t										ui64Size = 0;							/**< The size of the file. */
+			uint64_t										ui64ModTime = 0;						/**< The modification time of the file. */
+			std::vector<LSN_ENTRY>							vEntries;								/**< The ROMs read from the file. */
+		};
+
+		/** A scanned file that holds no valid ROMs. */
+		struct LSN_EMPTY_FILE {
+			std::u16string									u16Path;								/**< The path to the file. */
+			uint64_t										ui64Size = 0;							/**< The size of the file when it was read. */
+			uint64_t										ui64ModTime = 0;						/**< The modification time of the file when it was read. */
+		};
+
+
+		// == Members.
+		std::vector<LSN_ENTRY>								m_vEntries;								/**< The indexed ROMs. */
+		std::unordered_map<std::u16string, size_t>			m_mPaths;								/**< Maps normalized ROM paths to indices into m_vEntries. */
+		std::unordered_multimap<std::u16string, size_t>		m_mContainers;							/**< Maps normalized container paths to indices into m_vEntries. */
+		std::unordered_map<std::u16string, LSN_EMPTY_FILE>	m_mEmptyFiles;							/**< Scanned files with no valid ROMs, by normalized path.  They are not read again until they change. */
+		std::u16string										m_u16File;								/**< The index file. */
+		mutable std::mutex									m_mMutex;								/**< Guards the entries and maps. */
+		std::thread											m_tScanThread;							/**< The background scan thread. */
+		std::atomic<bool>									m_bScanning;							/**< Set while a background scan is running. */
+		std::atomic<bool>									m_bStopScan;							/**< Tells the background scan to stop. */
+		bool												m_bDirty;								/**< Set when the index has changed since it was loaded or saved. */
+
+
+		// == Functions.
+		/**
+		 * The background scan.
+		 *
+		 * \param _vFolders The folders to scan.
+		 * \param _bRecursive If true, sub-folders are also scanned.
+		 * \param _stThreads The number of threads to use to read files.
+		 **/
+		void												ScanThread( std::vector<std::u16string> _vFolders, bool _bRecursive, size_t _stThreads );
+
+		/**
+		 * Reads every ROM in a file.
+		 *
+		 * \param _sfFile The file to read.  Its entries are filled.
+		 **/
+		static void											ReadFile( LSN_SCAN_FILE &_sfFile );
+
+		/**
+		 * Fills an entry from ROM information.
+		 *
+		 * \param _riInfo The ROM information.
+		 * \param _bInDatabase If true, the ROM was found in the database.
+		 * \param _eEntry The entry to fill.
+		 **/
+		static void											FillEntry( const LSN_ROM_INFO &_riInfo, bool _bInDatabase, LSN_ENTRY &_eEntry );
+
+		/**
+		 * Replaces the entries of a set of containers.  Call with m_mMutex locked.
+		 *
+		 * \param _vFiles The rescanned containers and their new entries.
+		 **/
+		void												ReplaceContainers( std::vector<LSN_SCAN_FILE> &_vFiles );
+
+		/**
+		 * Rebuilds the maps from m_vEntries.  Call with m_mMutex locked.
+		 **/
+		void												RebuildMaps();
+
+		/**
+		 * Gets the normalized form of a path used as a map key.  On Windows, paths are lower-cased and back-slashed.  Elsewhere, file
+		 *	systems can be case-sensitive, so paths are used as-is.
+		 *
+		 * \param _u16Path The path to normalize.
+		 * \return Returns the normalized path.
+		 **/
+		static std::u16string								Normalize( const std::u16string &_u16Path );
+
+		/**
+		 * Gets the container of a ROM path (the part before "{" for ROMs inside ZIP files).
+		 *
+		 * \param _u16Path The ROM path.
+		 * \return Returns the path of the file on disk.
+		 **/
+		static std::u16string								ContainerPath( const std::u16string &_u16Path );
+
+		/**
+		 * Gets the size and modification time of a file.
+		 *
+		 * \param _u16Path The path to the file.
+		 * \param _ui64Size Holds the size of the file.
+		 * \param _ui64ModTime Holds the modification time of the file.
+		 * \return Returns true if the file exists.
+		 **/
+		static bool											FileStamp( const std::u16string &_u16Path, uint64_t &_ui64Size, uint64_t &_ui64ModTime );
+
+		/**
+		 * Writes an entry to a stream.
+		 *
+		 * \param _sStream The stream to which to write.
+		 * \param _eEntry The entry to write.
+		 * \return Returns true if the entry was written.
+		 **/
+		static bool											WriteEntry( CStream &_sStream, const LSN_ENTRY &_eEntry );
+
+		/**
+		 * Reads an entry from a stream.
+		 *
+		 * \param _sStream The stream from which to read.
+		 * \param _eEntry Holds the entry upon success.
+		 * \return Returns true if the entry was read.
+		 **/
+		static bool											ReadEntry( CStream &_sStream, LSN_ENTRY &_eEntry );
+	};
+
+}	// namespace lsn
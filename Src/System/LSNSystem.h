@@ -309,6 +309,10 @@ namespace lsn {
 		virtual bool									LoadRom( LSN_ROM &_rRom ) {
 			m_pmbMapper.reset();
 			m_cCpu.SetMapper( nullptr );
+			m_aApu.SetMapper( nullptr );
+			m_pPpu.SetSpriteFetchFunc( nullptr, nullptr );
+			m_pPpu.SetPpuCtrlWriteFunc( nullptr, nullptr );
+			m_ui32MapperCaps = CMapperRegistry::LSN_MC_NONE;
 			m_rRom = std::move( _rRom );
 
 			//m_bBus.DGB_FillMemoryUi32( 0xFFFFFF00 );
@@ -329,256 +333,14 @@ namespace lsn {
 			m_bBus.CopyToMemory( m_rRom.vPrgRom.data() + stOffset, ui16Size, ui16Addr );
 
 			m_rRom.riInfo.bMapperSupported = true;
-			switch ( m_rRom.riInfo.ui16Mapper ) {
-				case 0 : {
-					m_pmbMapper = std::make_unique<CMapper000>();
-					break;
-				}
-				case 1 : {
-					m_pmbMapper = std::make_unique<CMapper001>();
-					break;
-				}
-				case 2 : {
-					m_pmbMapper = std::make_unique<CMapper002>();
-					break;
-				}
-				case 3 : {
-					m_pmbMapper = std::make_unique<CMapper003>();
-					break;
-				}
-				case 4 : {
-					m_pmbMapper = std::make_unique<CMapper004>();
-					break;
-				}
-				case 7 : {
-					m_pmbMapper = std::make_unique<CMapper007>();
-					break;
-				}
-				case 9 : {
-					m_pmbMapper = std::make_unique<CMapper009>();
-					break;
-				}
-				case 10 : {
-					m_pmbMapper = std::make_unique<CMapper010>();
-					break;
-				}
-				case 11 : {
-					m_pmbMapper = std::make_unique<CMapper011>();
-					break;
-				}
-				case 13 : {
-					m_pmbMapper = std::make_unique<CMapper013>();
-					break;
-				}
-				case 21 : {
-					m_pmbMapper = std::make_unique<CMapper023>();
-					break;
-				}
-				case 22 : {
-					m_pmbMapper = std::make_unique<CMapper023>();
-					break;
-				}
-				case 23 : {
-					m_pmbMapper = std::make_unique<CMapper023>();
-					break;
-				}
-				case 24 : {
-					m_pmbMapper = std::make_unique<CMapper024>();
-					break;
-				}
-				case 25 : {
-					m_pmbMapper = std::make_unique<CMapper023>();
-					break;
-				}
-				case 26 : {
-					m_pmbMapper = std::make_unique<CMapper024>();
-					break;
-				}
-
-				case 32 : {
-					m_pmbMapper = std::make_unique<CMapper032>();
-					break;
-				}
-				case 33 : {
-					m_pmbMapper = std::make_unique<CMapper033>();
-					break;
-				}
-				case 34 : {
-					m_pmbMapper = std::make_unique<CMapper034>();
-					break;
-				}
-				case 36 : {
-					m_pmbMapper = std::make_unique<CMapper036>();
-					break;
-				}
-				case 38 : {
-					m_pmbMapper = std::make_unique<CMapper038>();
-					break;
-				}
-				case 41 : {
-					m_pmbMapper = std::make_unique<CMapper041>();
-					break;
-				}
-				case 56 : {
-					m_pmbMapper = std::make_unique<CMapper056>();
-					break;
-				}
-				case 65 : {
-					m_pmbMapper = std::make_unique<CMapper065>();
-					break;
-				}
-				case 66 : {
-					m_pmbMapper = std::make_unique<CMapper066>();
-					break;
-				}
-				case 67 : {
-					m_pmbMapper = std::make_unique<CMapper067>();
-					break;
-				}
-				case 69 : {
-					m_pmbMapper = std::make_unique<CMapper069>();
-					break;
-				}
-				case 70 : {
-					m_pmbMapper = std::make_unique<CMapper070>();
-					break;
-				}
-				case 71 : {
-					m_pmbMapper = std::make_unique<CMapper071>();
-					break;
-				}
-				case 72 : {
-					m_pmbMapper = std::make_unique<CMapper072>();
-					break;
-				}
-				case 73 : {
-					m_pmbMapper = std::make_unique<CMapper073>();
-					break;
-				}
-				case 75 : {
-					m_pmbMapper = std::make_unique<CMapper075>();
-					break;
-				}
-				case 76 : {
-					m_pmbMapper = std::make_unique<CMapper076>();
-					break;
-				}
-				case 77 : {
-					m_pmbMapper = std::make_unique<CMapper077>();
-					break;
-				}
-				case 78 : {
-					m_pmbMapper = std::make_unique<CMapper078>();
-					break;
-				}
-				case 79 : {
-					m_pmbMapper = std::make_unique<CMapper079>();
-					break;
-				}
-				case 80 : {
-					m_pmbMapper = std::make_unique<CMapper080>();
-					break;
-				}
-				case 81 : {
-					m_pmbMapper = std::make_unique<CMapper081>();
-					break;
-				}
-				case 87 : {
-					m_pmbMapper = std::make_unique<CMapper087>();
-					break;
-				}
-				case 88 : {
-					m_pmbMapper = std::make_unique<CMapper088>();
-					break;
-				}
-				case 89 : {
-					m_pmbMapper = std::make_unique<CMapper089>();
-					break;
-				}
-				case 92 : {
-					m_pmbMapper = std::make_unique<CMapper092>();
-					break;
-				}
-				case 93 : {
-					m_pmbMapper = std::make_unique<CMapper093>();
-					break;
-				}
-				case 94 : {
-					m_pmbMapper = std::make_unique<CMapper094>();
-					break;
-				}
-				case 95 : {
-					m_pmbMapper = std::make_unique<CMapper095>();
-					break;
-				}
-				case 97 : {
-					m_pmbMapper = std::make_unique<CMapper097>();
-					break;
-				}
-				case 101 : {
-					m_pmbMapper = std::make_unique<CMapper101>();
-					break;
-				}
-				case 112 : {
-					m_pmbMapper = std::make_unique<CMapper112>();
-					break;
-				}
-				case 113 : {
-					m_pmbMapper = std::make_unique<CMapper113>();
-					break;
-				}
-				case 140 : {
-					m_pmbMapper = std::make_unique<CMapper140>();
-					break;
-				}
-				case 142 : {
-					m_pmbMapper = std::make_unique<CMapper142>();
-					break;
-				}
-				case 152 : {
-					m_pmbMapper = std::make_unique<CMapper152>();
-					break;
-				}
-				case 154 : {
-					m_pmbMapper = std::make_unique<CMapper154>();
-					break;
-				}
-				/*case 155 : {
-					m_pmbMapper = std::make_unique<CMapper001>();
-					break;
-				}*/
-				case 157 : {
-					m_pmbMapper = std::make_unique<CMapper157>();
-					break;
-				}
-				case 184 : {
-					m_pmbMapper = std::make_unique<CMapper184>();
-					break;
-				}
-				case 185 : {
-					m_pmbMapper = std::make_unique<CMapper185>();
-					break;
-				}
-				case 206 : {
-					m_pmbMapper = std::make_unique<CMapper206>();
-					break;
-				}
-				case 232 : {
-					m_pmbMapper = std::make_unique<CMapper232>();
-					break;
-				}
-				case 234 : {
-					m_pmbMapper = std::make_unique<CMapper234>();
-					break;
-				}
-				default : {
-					m_pmbMapper = std::make_unique<CMapperBase>();
-					m_rRom.riInfo.bMapperSupported = false;
-					std::string sText = "****** Mapper not handled: " + std::to_string( m_rRom.riInfo.ui16Mapper ) + ".\r\n";
+			m_pmbMapper = CMapperRegistry::Create( m_rRom.riInfo.ui16Mapper, m_rRom.riInfo.ui16SubMapper, m_ui32MapperCaps );
+			if ( !m_pmbMapper ) {
+				m_pmbMapper = std::make_unique<CMapperBase>();
+				m_rRom.riInfo.bMapperSupported = false;
+				std::string sText = "****** Mapper not handled: " + std::to_string( m_rRom.riInfo.ui16Mapper ) + ".\r\n";
 #ifdef LSN_WINDOWS
-					::OutputDebugStringA( sText.c_str() );
+				::OutputDebugStringA( sText.c_str() );
 #endif	// #ifdef LSN_WINDOWS
-				}
 			}
 #ifdef LSN_WINDOWS
 			{
@@ -599,10 +361,14 @@ namespace lsn {
 
 				sText = "****** PGM RAM Size: " + std::to_string( m_rRom.i32WorkRamSize ) + ".\r\n";
 				::OutputDebugStringA( sText.c_str() );
+				if ( m_rRom.riInfo.bBattery && !(m_ui32MapperCaps & CMapperRegistry::LSN_MC_BATTERY) ) {
+					::OutputDebugStringA( "****** Battery-backed RAM is not saved by this mapper.\r\n" );
+				}
 			}
 #endif	// #ifdef LSN_WINDOWS
-			m_cCpu.SetMapper( m_pmbMapper.get() );
-			m_aApu.SetMapper( m_pmbMapper.get() );
+			// Only mappers that need them get the per-cycle Tick() and the per-sample audio calls.
+			m_cCpu.SetMapper( m_pmbMapper.get(), (m_ui32MapperCaps & CMapperRegistry::LSN_MC_TICK) != 0 );
+			m_aApu.SetMapper( (m_ui32MapperCaps & CMapperRegistry::LSN_MC_EXT_AUDIO) ? m_pmbMapper.get() : nullptr );
 			if ( m_pmbMapper ) {
 				m_pmbMapper->InitWithRom( m_rRom, &m_cCpu, &m_pPpu, &m_cCpu, &m_pPpu );
 			}
@@ -619,9 +385,15 @@ namespace lsn {
 		virtual bool									CloseRom() {
 			bool bRes = true;
 			if ( m_pmbMapper.get() ) {
-				bRes = m_pmbMapper->SaveBatteryBacked();
+				if ( m_ui32MapperCaps & CMapperRegistry::LSN_MC_BATTERY ) {
+					bRes = m_pmbMapper->SaveBatteryBacked();
+				}
 				m_pmbMapper.reset();
 				m_cCpu.SetMapper( nullptr );
+				m_aApu.SetMapper( nullptr );
+				m_pPpu.SetSpriteFetchFunc( nullptr, nullptr );
+				m_pPpu.SetPpuCtrlWriteFunc( nullptr, nullptr );
+				m_ui32MapperCaps = CMapperRegistry::LSN_MC_NONE;
 			}
 			m_rRom.vPrgRom.clear();
 
@@ -825,6 +597,7 @@ namespace lsn {
 				m_rRom.riInfo.ui16SubMapper = pnhHeader->GetSubMapper();
 				m_rRom.riInfo.mmMirroring = pnhHeader->GetMirrorMode();
 				m_rRom.riInfo.pmConsoleRegion = pnhHeader->GetGameRegion();
+				m_rRom.riInfo.bBattery = pnhHeader->HasBattery();
 				m_rRom.i32ChrRamSize = pnhHeader->GetChrRomSize();
 				m_rRom.i32SaveChrRamSize = pnhHeader->GetSaveChrRamSize();
 				m_rRom.i32WorkRamSize = pnhHeader->GetWorkRamSize();
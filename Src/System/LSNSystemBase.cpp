@@ -8,7 +8,10 @@
 
 #include "LSNSystemBase.h"
 #include "../Crc/LSNCrc.h"
+#include "../Crc/LSNRomHash.h"
 #include "../Database/LSNDatabase.h"
+#include "../File/LSNFileMap.h"
+#include "../File/LSNZipFile.h"
 #include "../Roms/LSNNesHeader.h"
 #include "../Utilities/LSNUtilities.h"
 
@@ -29,74 +32,113 @@ namespace lsn {
 	 * \return Returns true if the ROM was loaded.
 	 */
 	bool CSystemBase::LoadRom( const std::vector<uint8_t> &_vRom, LSN_ROM &_rRom, const std::u16string &_s16Path ) {
-		_rRom = LSN_ROM();
-		_rRom.riInfo.s16File = _s16Path;
-		_rRom.riInfo.s16RomName = CUtilities::GetFileName( _s16Path );
-		_rRom.riInfo.ui16Chip = static_cast<uint16_t>(CDatabase::LSN_C_UNKNOWN);
-		_rRom.riInfo.ui16PcbClass = static_cast<uint16_t>(CDatabase::LSN_PC_UNKNOWN);
-		_rRom.riInfo.bBusConficts = true;
+		return LoadRom( _vRom.data(), _vRom.size(), _rRom, _s16Path );
+	}
+
+	/**
+	 * Loads a ROM from memory into the given LSN_ROM object.
+	 *
+	 * \param _pui8Rom The in-memory ROM fille.
+	 * \param _sSize The number of bytes to which _pui8Rom points.
+	 * \param _rRom The LSN_ROM target object.
+	 * \param _s16Path The ROM file path.
+	 * \return Returns true if the ROM was loaded.
+	 */
+	bool CSystemBase::LoadRom( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM &_rRom, const std::u16string &_s16Path ) {
+		try {
+			BeginRom( _rRom, _s16Path );
 
-		if ( _vRom.size() >= 4 ) {
-			const uint8_t ui8NesHeader[] = {
-				0x4E, 0x45, 0x53, 0x1A
-			};
-			if ( std::memcmp( _vRom.data(), ui8NesHeader, sizeof( ui8NesHeader ) ) == 0 ) {
+			if ( IsNes( _pui8Rom, _sSize ) ) {
 				// .NES.
-				if ( !LoadNes( _vRom, _rRom ) ) { return false; }
-				//return true;
-			}
-			else {
-				_rRom = LSN_ROM();
-				return false;
+				if ( LoadNes( _pui8Rom, _sSize, _rRom ) ) {
+					FinishRom( _rRom );
+					return true;
+				}
 			}
+		}
+		catch ( ... ) {}
+
+		_rRom = LSN_ROM();
+		return false;
+	}
 
-			// ROM loaded.
-			_rRom.riInfo.ui32Crc = CCrc::GetCrc( _rRom.vPrgRom.data(), _rRom.vPrgRom.size() );
-
-			// Apply overrides from the database.
-			{
-				auto aEntry = CDatabase::m_mDatabase.find( _rRom.riInfo.ui32Crc );
-				if ( aEntry != CDatabase::m_mDatabase.end() ) {
-					if ( aEntry->second.mmMirrorOverride != LSN_MM_NO_OVERRIDE ) {
-						_rRom.riInfo.mmMirroring = aEntry->second.mmMirrorOverride;
-					}
-					if ( aEntry->second.pmRegion != LSN_PM_UNKNOWN ) {
-						_rRom.riInfo.pmConsoleRegion = aEntry->second.pmRegion;
-					}
-					if ( aEntry->second.ui16Mapper != 0xFFFF ) {
-						_rRom.riInfo.ui16Mapper = aEntry->second.ui16Mapper;
-					}
-					if ( aEntry->second.ui16SubMapper != 0xFFFF ) {
-						_rRom.riInfo.ui16SubMapper = aEntry->second.ui16SubMapper;
-					}
-					if ( aEntry->second.cChip != CDatabase::LSN_C_UNKNOWN ) {
-						_rRom.riInfo.ui16Chip = static_cast<uint16_t>(aEntry->second.cChip);
-					}
-					if ( aEntry->second.pcPcbClass != CDatabase::LSN_PC_UNKNOWN ) {
-						_rRom.riInfo.ui16PcbClass = static_cast<uint16_t>(aEntry->second.pcPcbClass);
-					}
-					if ( aEntry->second.ui32PgmRomSize != 0 ) {
-						if ( !_rRom.vChrRom.size() ) {
-							if ( _rRom.vPrgRom.size() > aEntry->second.ui32PgmRomSize ) {
-								// Assume the extra data we are about to clip off is actually CHR ROM.
-								size_t stChrSize = _rRom.vPrgRom.size() - aEntry->second.ui32PgmRomSize;
-								_rRom.vChrRom.resize( stChrSize );
-								std::memcpy( _rRom.vChrRom.data(), &_rRom.vPrgRom[_rRom.vPrgRom.size()-stChrSize], stChrSize );
-							}
-						}
-						_rRom.vPrgRom.resize( aEntry->second.ui32PgmRomSize );
-					}
-					_rRom.riInfo.bBusConficts = aEntry->second.bBusConflicts;
+	/**
+	 * Loads a ROM file into the given LSN_ROM object.  The file is memory-mapped and read in place, so the only copies made are the
+	 *	final PRG and CHR buffers.
+	 *
+	 * \param _s16Path The ROM file path.
+	 * \param _rRom The LSN_ROM target object.
+	 * \return Returns true if the ROM was loaded.
+	 */
+	bool CSystemBase::LoadRomFile( const std::u16string &_s16Path, LSN_ROM &_rRom ) {
+		CFileMap fmFile;
+		CFileMap::LSN_VIEW vView;
+		try {
+			if ( !fmFile.OpenReadOnly( std::filesystem::path( _s16Path ) ) ) { return false; }
+			if ( fmFile.Size() > SIZE_MAX ) { return false; }
+		}
+		catch ( ... ) { return false; }
+		if ( !fmFile.MapView( 0, static_cast<size_t>(fmFile.Size()), vView ) ) { return false; }
+		bool bRet = LoadRom( vView.pui8Data, vView.sSize, _rRom, _s16Path );
+		CFileMap::UnmapView( vView );
+		return bRet;
+	}
+
+	/**
+	 * Loads a ROM from inside a ZIP file into the given LSN_ROM object.  The file is decompressed directly into the PRG buffer, which
+	 *	is then trimmed in place.
+	 *
+	 * \param _zfFile The opened ZIP file.
+	 * \param _s16File The name of the file inside the ZIP to load.
+	 * \param _rRom The LSN_ROM target object.
+	 * \param _s16Path The ROM file path.
+	 * \return Returns true if the ROM was loaded.
+	 */
+	bool CSystemBase::LoadZipRom( const CZipFile &_zfFile, const std::u16string &_s16File, LSN_ROM &_rRom, const std::u16string &_s16Path ) {
+		try {
+			BeginRom( _rRom, _s16Path );
+
+			if ( _zfFile.ExtractToMemory( _s16File, _rRom.vPrgRom ) && IsNes( _rRom.vPrgRom.data(), _rRom.vPrgRom.size() ) ) {
+				// .NES.
+				if ( LoadNesInPlace( _rRom ) ) {
+					FinishRom( _rRom );
+					return true;
 				}
 			}
-
-			return true;
 		}
+		catch ( ... ) {}
 
 		_rRom = LSN_ROM();
 		return false;
 	}
 
+	/**
+	 * Gathers the information and hashes of a ROM image without copying its PRG or CHR data.
+	 *
+	 * \param _pui8Rom The in-memory ROM fille.
+	 * \param _sSize The number of bytes to which _pui8Rom points.
+	 * \param _riInfo Holds the ROM information upon success.
+	 * \param _s16Path The ROM file path.
+	 * \param _pbInDatabase If not nullptr, holds whether the ROM was found in the database.
+	 * \return Returns true if the image is a supported ROM image.
+	 */
+	bool CSystemBase::ReadRomInfo( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM_INFO &_riInfo, const std::u16string &_s16Path, bool * _pbInDatabase ) {
+		try {
+			LSN_ROM rTmp;
+			BeginRom( rTmp, _s16Path );
+			size_t stPrgOffset;
+			if ( IsNes( _pui8Rom, _sSize ) && ParseNes( _pui8Rom, _sSize, rTmp, stPrgOffset ) ) {
+				uint32_t ui32PgmRomSize;
+				bool bFound = ApplyDatabase( rTmp.riInfo, ui32PgmRomSize );
+				if ( _pbInDatabase ) { (*_pbInDatabase) = bFound; }
+				_riInfo = std::move( rTmp.riInfo );
+				return true;
+			}
+		}
+		catch ( ... ) {}
+		return false;
+	}
+
 	/**
 	 * Loads a ROM image in .NES format.
 	 *
@@ -104,17 +146,81 @@ namespace lsn {
 	 * \return Returns true if the image was loaded, false otherwise.
 	 */
 	bool CSystemBase::LoadNes( const std::vector<uint8_t> &_vRom, LSN_ROM &_rRom ) {
-		if ( _vRom.size() >= sizeof( LSN_NES_HEADER ) ) {
-			size_t stDataSize = _vRom.size() - sizeof( LSN_NES_HEADER );
-			const uint8_t * pui8Data = _vRom.data() + sizeof( LSN_NES_HEADER );
-			const LSN_NES_HEADER * pnhHeader = reinterpret_cast<const LSN_NES_HEADER *>(_vRom.data());
+		return LoadNes( _vRom.data(), _vRom.size(), _rRom );
+	}
+
+	/**
+	 * Loads a ROM image in .NES format.
+	 *
+	 * \param _pui8Rom The ROM image to load.
+	 * \param _sSize The number of bytes to which _pui8Rom points.
+	 * \return Returns true if the image was loaded, false otherwise.
+	 */
+	bool CSystemBase::LoadNes( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM &_rRom ) {
+		size_t stPrgOffset;
+		if ( !ParseNes( _pui8Rom, _sSize, _rRom, stPrgOffset ) ) { return false; }
+
+		const LSN_NES_HEADER * pnhHeader = reinterpret_cast<const LSN_NES_HEADER *>(_pui8Rom);
+		const uint8_t * pui8Data = _pui8Rom + stPrgOffset;
+		uint32_t ui32PrgSize = pnhHeader->GetPgmRomSize();
+		uint32_t ui32ChrSize = pnhHeader->GetChrRomSize();
+		_rRom.vPrgRom.assign( pui8Data, pui8Data + ui32PrgSize );
+		pui8Data += ui32PrgSize;
+		_rRom.vChrRom.assign( pui8Data, pui8Data + ui32ChrSize );
+		return true;
+	}
+
+	/**
+	 * Loads a ROM image in .NES format whose full image has been placed into _rRom.vPrgRom.  The CHR data is moved out and the PRG
+	 *	data is shifted down over the header in place.
+	 *
+	 * \param _rRom The LSN_ROM holding the full image in vPrgRom.
+	 * \return Returns true if the image was loaded, false otherwise.
+	 */
+	bool CSystemBase::LoadNesInPlace( LSN_ROM &_rRom ) {
+		size_t stPrgOffset;
+		if ( !ParseNes( _rRom.vPrgRom.data(), _rRom.vPrgRom.size(), _rRom, stPrgOffset ) ) { return false; }
+
+		const LSN_NES_HEADER * pnhHeader = reinterpret_cast<const LSN_NES_HEADER *>(_rRom.vPrgRom.data());
+		uint32_t ui32PrgSize = pnhHeader->GetPgmRomSize();
+		uint32_t ui32ChrSize = pnhHeader->GetChrRomSize();
+		uint8_t * pui8Data = _rRom.vPrgRom.data() + stPrgOffset;
+		_rRom.vChrRom.assign( pui8Data + ui32PrgSize, pui8Data + ui32PrgSize + ui32ChrSize );
+		// The header is no longer needed; move the PRG data down over it.
+		std::memmove( _rRom.vPrgRom.data(), pui8Data, ui32PrgSize );
+		_rRom.vPrgRom.resize( ui32PrgSize );
+		return true;
+	}
+
+	/**
+	 * Reads the header of an image in .NES format, fills out the ROM information and hashes, and verifies that the PRG and CHR data
+	 *	fit inside the image.
+	 *
+	 * \param _pui8Rom The ROM image.
+	 * \param _sSize The number of bytes to which _pui8Rom points.
+	 * \param _rRom The LSN_ROM whose information is filled.
+	 * \param _sPrgOffset Holds the offset of the PRG data inside the image upon success.
+	 * \return Returns true if the image is a valid .NES image.
+	 */
+	bool CSystemBase::ParseNes( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM &_rRom, size_t &_sPrgOffset ) {
+		if ( _sSize >= sizeof( LSN_NES_HEADER ) ) {
+			size_t stDataSize = _sSize - sizeof( LSN_NES_HEADER );
+			const uint8_t * pui8Data = _pui8Rom + sizeof( LSN_NES_HEADER );
+			const LSN_NES_HEADER * pnhHeader = reinterpret_cast<const LSN_NES_HEADER *>(_pui8Rom);
 			_rRom.riInfo.ui16Mapper = pnhHeader->GetMapper();
 			_rRom.riInfo.ui16SubMapper = pnhHeader->GetSubMapper();
 			_rRom.riInfo.mmMirroring = pnhHeader->GetMirrorMode();
 			_rRom.riInfo.pmConsoleRegion = pnhHeader->GetGameRegion();
-			_rRom.riInfo.ui32HeaderlessCrc = CCrc::GetCrc( pui8Data, stDataSize );
-			_rRom.riInfo.mhMd5 = CMd5::Compute( _vRom.data(), _vRom.size() );
-			_rRom.riInfo.mhHeaderlessMd5 = CMd5::Compute( pui8Data, stDataSize );
+			_rRom.riInfo.bBattery = pnhHeader->HasBattery();
+			// All hashes come from one pass over the image.  Without a trainer the PRG data directly follows the header, so its CRC is a
+			//	prefix of the headerless CRC.
+			CRomHash::LSN_HASHES hHashes;
+			CRomHash::Compute( _pui8Rom, _sSize, sizeof( LSN_NES_HEADER ), pnhHeader->HasTrainer() ? 0 : pnhHeader->GetPgmRomSize(), hHashes );
+			_rRom.riInfo.ui32HeaderlessCrc = hHashes.ui32Crc;
+			_rRom.riInfo.ui32FullCrc = hHashes.ui32FullCrc;
+			_rRom.riInfo.ui32Crc = hHashes.ui32PrefixCrc;
+			_rRom.riInfo.mhMd5 = hHashes.mhMd5;
+			_rRom.riInfo.mhHeaderlessMd5 = hHashes.mhHeaderlessMd5;
 
 			_rRom.i32ChrRamSize = pnhHeader->GetChrRamSize();
 			_rRom.i32SaveChrRamSize = pnhHeader->GetSaveChrRamSize();
@@ -122,23 +228,107 @@ namespace lsn {
 			_rRom.i32SaveRamSize = pnhHeader->GetSaveRamSize();
 				
 
+			_sPrgOffset = sizeof( LSN_NES_HEADER );
 			if ( pnhHeader->HasTrainer() ) {
 				if ( stDataSize < 512 ) { return false; }
-				// Load trainer.
+				// Skip trainer.
 				stDataSize -= 512;
-				pui8Data += 512;
+				_sPrgOffset += 512;
 			}
 
 			uint32_t ui32PrgSize = pnhHeader->GetPgmRomSize();
 			uint32_t ui32ChrSize = pnhHeader->GetChrRomSize();
 			if ( size_t( ui32PrgSize ) + size_t( ui32ChrSize ) > stDataSize ) { return false; }
-			_rRom.vPrgRom.insert( _rRom.vPrgRom.end(), pui8Data, pui8Data + ui32PrgSize );
-			pui8Data += ui32PrgSize;
-			_rRom.vChrRom.insert( _rRom.vChrRom.end(), pui8Data, pui8Data + ui32ChrSize );
-
+			if ( pnhHeader->HasTrainer() ) {
+				_rRom.riInfo.ui32Crc = CCrc::GetCrc( _pui8Rom + _sPrgOffset, ui32PrgSize );
+			}
 			return true;
 		}
 		return false;
 	}
 
+	/**
+	 * Resets the given LSN_ROM and sets its default information.
+	 *
+	 * \param _rRom The LSN_ROM to reset.
+	 * \param _s16Path The ROM file path.
+	 */
+	void CSystemBase::BeginRom( LSN_ROM &_rRom, const std::u16string &_s16Path ) {
+		_rRom = LSN_ROM();
+		_rRom.riInfo.s16File = _s16Path;
+		_rRom.riInfo.s16RomName = CUtilities::GetFileName( _s16Path );
+		_rRom.riInfo.ui16Chip = static_cast<uint16_t>(CDatabase::LSN_C_UNKNOWN);
+		_rRom.riInfo.ui16PcbClass = static_cast<uint16_t>(CDatabase::LSN_PC_UNKNOWN);
+		_rRom.riInfo.bBusConficts = true;
+	}
+
+	/**
+	 * Determines if an image is in .NES format.
+	 *
+	 * \param _pui8Rom The ROM image.
+	 * \param _sSize The number of bytes to which _pui8Rom points.
+	 * \return Returns true if the image begins with the .NES header magic.
+	 */
+	bool CSystemBase::IsNes( const uint8_t * _pui8Rom, size_t _sSize ) {
+		const uint8_t ui8NesHeader[] = {
+			0x4E, 0x45, 0x53, 0x1A
+		};
+		return _sSize >= sizeof( ui8NesHeader ) && std::memcmp( _pui8Rom, ui8NesHeader, sizeof( ui8NesHeader ) ) == 0;
+	}
+
+	/**
+	 * Applies overrides from the database to a loaded ROM.  riInfo.ui32Crc must already hold the CRC of the PRG data.
+	 *
+	 * \param _rRom The loaded ROM.
+	 */
+	void CSystemBase::FinishRom( LSN_ROM &_rRom ) {
+		uint32_t ui32PgmRomSize;
+		if ( ApplyDatabase( _rRom.riInfo, ui32PgmRomSize ) && ui32PgmRomSize != 0 ) {
+			if ( !_rRom.vChrRom.size() ) {
+				if ( _rRom.vPrgRom.size() > ui32PgmRomSize ) {
+					// Assume the extra data we are about to clip off is actually CHR ROM.
+					size_t stChrSize = _rRom.vPrgRom.size() - ui32PgmRomSize;
+					_rRom.vChrRom.resize( stChrSize );
+					std::memcpy( _rRom.vChrRom.data(), &_rRom.vPrgRom[_rRom.vPrgRom.size()-stChrSize], stChrSize );
+				}
+			}
+			_rRom.vPrgRom.resize( ui32PgmRomSize );
+		}
+	}
+
+	/**
+	 * Applies overrides from the database to ROM information.  _riInfo.ui32Crc must already hold the CRC of the PRG data.
+	 *
+	 * \param _riInfo The ROM information to update.
+	 * \param _ui32PgmRomSize Holds the PRG size given by the database, or 0 if the database does not override it.
+	 * \return Returns true if the ROM was found in the database.
+	 */
+	bool CSystemBase::ApplyDatabase( LSN_ROM_INFO &_riInfo, uint32_t &_ui32PgmRomSize ) {
+		_ui32PgmRomSize = 0;
+		const CDatabase::LSN_ENTRY * peEntry = CDatabase::Find( _riInfo.ui32Crc, &_riInfo.mhHeaderlessMd5 );
+		if ( !peEntry ) { return false; }
+
+		if ( peEntry->mmMirrorOverride != LSN_MM_NO_OVERRIDE ) {
+			_riInfo.mmMirroring = peEntry->mmMirrorOverride;
+		}
+		if ( peEntry->pmRegion != LSN_PM_UNKNOWN ) {
+			_riInfo.pmConsoleRegion = peEntry->pmRegion;
+		}
+		if ( peEntry->ui16Mapper != 0xFFFF ) {
+			_riInfo.ui16Mapper = peEntry->ui16Mapper;
+		}
+		if ( peEntry->ui16SubMapper != 0xFFFF ) {
+			_riInfo.ui16SubMapper = peEntry->ui16SubMapper;
+		}
+		if ( peEntry->cChip != CDatabase::LSN_C_UNKNOWN ) {
+			_riInfo.ui16Chip = static_cast<uint16_t>(peEntry->cChip);
+		}
+		if ( peEntry->pcPcbClass != CDatabase::LSN_PC_UNKNOWN ) {
+			_riInfo.ui16PcbClass = static_cast<uint16_t>(peEntry->pcPcbClass);
+		}
+		_ui32PgmRomSize = peEntry->ui32PgmRomSize;
+		_riInfo.bBusConficts = peEntry->bBusConflicts;
+		return true;
+	}
+
 }	// namespace lsn
@@ -14,7 +14,7 @@
 #include "../Bus/LSNBus.h"
 #include "../Display/LSNDisplayClient.h"
 #include "../Input/LSNInputPoller.h"
-#include "../Mappers/LSNAllMappers.h"
+#include "../Mappers/LSNMapperRegistry.h"
 #include "../Palette/LSNPalette.h"
 #include "../Time/LSNClock.h"
 #include "../Wav/LSNWavFile.h"
@@ -22,6 +22,8 @@
 
 namespace lsn {
 
+	class CZipFile;
+
 	/**
 	 * Class CSystemBase
 	 * \brief System base class.
@@ -263,6 +265,13 @@ namespace lsn {
 		 */
 		virtual const LSN_ROM *							GetRom() const { return IsRomLoaded() ? &m_rRom : nullptr; }
 
+		/**
+		 * Gets the loaded mapper's capabilities.
+		 *
+		 * \return Returns the CMapperRegistry::LSN_MAPPER_CAPS flags of the loaded mapper, or LSN_MC_NONE if no mapper is loaded.
+		 */
+		inline uint32_t									MapperCaps() const { return m_ui32MapperCaps; }
+
 		/**
 		 * Sets the audio options.
 		 * 
@@ -345,6 +354,51 @@ namespace lsn {
 		 */
 		static bool										LoadRom( const std::vector<uint8_t> &_vRom, LSN_ROM &_rRom, const std::u16string &_s16Path );
 
+		/**
+		 * Loads a ROM from memory into the given LSN_ROM object.
+		 *
+		 * \param _pui8Rom The in-memory ROM fille.
+		 * \param _sSize The number of bytes to which _pui8Rom points.
+		 * \param _rRom The LSN_ROM target object.
+		 * \param _s16Path The ROM file path.
+		 * \return Returns true if the ROM was loaded.
+		 */
+		static bool										LoadRom( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM &_rRom, const std::u16string &_s16Path );
+
+		/**
+		 * Loads a ROM file into the given LSN_ROM object.  The file is memory-mapped and read in place, so the only copies made are the
+		 *	final PRG and CHR buffers.
+		 *
+		 * \param _s16Path The ROM file path.
+		 * \param _rRom The LSN_ROM target object.
+		 * \return Returns true if the ROM was loaded.
+		 */
+		static bool										LoadRomFile( const std::u16string &_s16Path, LSN_ROM &_rRom );
+
+		/**
+		 * Loads a ROM from inside a ZIP file into the given LSN_ROM object.  The file is decompressed directly into the PRG buffer, which
+		 *	is then trimmed in place.
+		 *
+		 * \param _zfFile The opened ZIP file.
+		 * \param _s16File The name of the file inside the ZIP to load.
+		 * \param _rRom The LSN_ROM target object.
+		 * \param _s16Path The ROM file path.
+		 * \return Returns true if the ROM was loaded.
+		 */
+		static bool										LoadZipRom( const CZipFile &_zfFile, const std::u16string &_s16File, LSN_ROM &_rRom, const std::u16string &_s16Path );
+
+		/**
+		 * Gathers the information and hashes of a ROM image without copying its PRG or CHR data.
+		 *
+		 * \param _pui8Rom The in-memory ROM fille.
+		 * \param _sSize The number of bytes to which _pui8Rom points.
+		 * \param _riInfo Holds the ROM information upon success.
+		 * \param _s16Path The ROM file path.
+		 * \param _pbInDatabase If not nullptr, holds whether the ROM was found in the database.
+		 * \return Returns true if the image is a supported ROM image.
+		 */
+		static bool										ReadRomInfo( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM_INFO &_riInfo, const std::u16string &_s16Path, bool * _pbInDatabase = nullptr );
+
 
 	protected :
 		// == Members.
@@ -356,6 +410,7 @@ namespace lsn {
 		uint64_t										m_ui64CurMasterCounter;				/**< The time of the last component's update, or the time of the current component being updated if accessed by the CPU, PPU, or APU. */
 		LSN_ROM											m_rRom;								/**< The current cartridge. */
 		std::unique_ptr<CMapperBase>					m_pmbMapper;						/**< The mapper. */
+		uint32_t										m_ui32MapperCaps = CMapperRegistry::LSN_MC_NONE;	/**< The mapper's CMapperRegistry::LSN_MAPPER_CAPS flags. */
 		bool											m_bPaused;							/**< Pause flag. */
 
 
@@ -370,6 +425,69 @@ namespace lsn {
 		 * \return Returns true if the image was loaded, false otherwise.
 		 */
 		static bool										LoadNes( const std::vector<uint8_t> &_vRom, LSN_ROM &_rRom );
+
+		/**
+		 * Loads a ROM image in .NES format.
+		 *
+		 * \param _pui8Rom The ROM image to load.
+		 * \param _sSize The number of bytes to which _pui8Rom points.
+		 * \return Returns true if the image was loaded, false otherwise.
+		 */
+		static bool										LoadNes( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM &_rRom );
+
+		/**
+		 * Loads a ROM image in .NES format whose full image has been placed into _rRom.vPrgRom.  The CHR data is moved out and the PRG
+		 *	data is shifted down over the header in place.
+		 *
+		 * \param _rRom The LSN_ROM holding the full image in vPrgRom.
+		 * \return Returns true if the image was loaded, false otherwise.
+		 */
+		static bool										LoadNesInPlace( LSN_ROM &_rRom );
+
+		/**
+		 * Reads the header of an image in .NES format, fills out the ROM information and hashes, and verifies that the PRG and CHR data
+		 *	fit inside the image.
+		 *
+		 * \param _pui8Rom The ROM image.
+		 * \param _sSize The number of bytes to which _pui8Rom points.
+		 * \param _rRom The LSN_ROM whose information is filled.
+		 * \param _sPrgOffset Holds the offset of the PRG data inside the image upon success.
+		 * \return Returns true if the image is a valid .NES image.
+		 */
+		static bool										ParseNes( const uint8_t * _pui8Rom, size_t _sSize, LSN_ROM &_rRom, size_t &_sPrgOffset );
+
+		/**
+		 * Resets the given LSN_ROM and sets its default information.
+		 *
+		 * \param _rRom The LSN_ROM to reset.
+		 * \param _s16Path The ROM file path.
+		 */
+		static void										BeginRom( LSN_ROM &_rRom, const std::u16string &_s16Path );
+
+		/**
+		 * Determines if an image is in .NES format.
+		 *
+		 * \param _pui8Rom The ROM image.
+		 * \param _sSize The number of bytes to which _pui8Rom points.
+		 * \return Returns true if the image begins with the .NES header magic.
+		 */
+		static bool										IsNes( const uint8_t * _pui8Rom, size_t _sSize );
+
+		/**
+		 * Applies overrides from the database to a loaded ROM.  riInfo.ui32Crc must already hold the CRC of the PRG data.
+		 *
+		 * \param _rRom The loaded ROM.
+		 */
+		static void										FinishRom( LSN_ROM &_rRom );
+
+		/**
+		 * Applies overrides from the database to ROM information.  _riInfo.ui32Crc must already hold the CRC of the PRG data.
+		 *
+		 * \param _riInfo The ROM information to update.
+		 * \param _ui32PgmRomSize Holds the PRG size given by the database, or 0 if the database does not override it.
+		 * \return Returns true if the ROM was found in the database.
+		 */
+		static bool										ApplyDatabase( LSN_ROM_INFO &_riInfo, uint32_t &_ui32PgmRomSize );
 	};
 
 }	// namespace lsn
@@ -0,0 +1,216 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Runs test ROMs headlessly on the NTSC system and reports one result per ROM.  The system is stepped by master clock
+ *	rather than real time, so runs are repeatable and as fast as the host allows.
+ */
+
+
+#ifdef LSN_TEST_ROMS
+
+#include "LSNTestRomRunner.h"
+#include "LSNSystem.h"
+
+#include <algorithm>
+#include <format>
+#include <memory>
+
+
+namespace lsn {
+
+	/** An NTSC system that is stepped by master cycles and whose CPU bus can be inspected. */
+	class CTestRomSystem : public CNtscSystem {
+	public :
+		// == Functions.
+		/**
+		 * Runs every component up to the given number of master cycles past the current master counter.  Mirrors Tick() without the
+		 *	real-time clock.
+		 *
+		 * \param _ui64Master The number of master cycles to run.
+		 */
+		void												Step( uint64_t _ui64Master ) {
+			constexpr size_t sApuSlot = 2;
+			m_ui64MasterCounter += _ui64Master;
+			while ( true ) {
+				LSN_HW_SLOTS * phsSlot = nullptr;
+				uint64_t ui64Low = ~0ULL;
+				size_t sCheckedSlot = 0;
+				size_t sTmp = m_sSlotsToCheck[1];
+				if ( m_hsSlots[sTmp].ui64Counter <= m_ui64MasterCounter ) {
+					phsSlot = &m_hsSlots[sTmp];
+					ui64Low = phsSlot->ui64Counter;
+					sCheckedSlot = 1;
+				}
+				sTmp = m_sSlotsToCheck[0];
+				if ( m_hsSlots[sTmp].ui64Counter < ui64Low && m_hsSlots[sTmp].ui64Counter <= m_ui64MasterCounter ) {
+					phsSlot = &m_hsSlots[sTmp];
+					ui64Low = phsSlot->ui64Counter;
+					sCheckedSlot = 0;
+				}
+				if ( m_hsSlots[sApuSlot].ui64Counter <= ui64Low && m_hsSlots[sApuSlot].ui64Counter <= m_ui64MasterCounter ) {
+					m_ui64CurMasterCounter = m_hsSlots[sApuSlot].ui64Counter;
+					(m_hsSlots[sApuSlot].ptHw->*m_hsSlots[sApuSlot].pfTick)();
+					m_hsSlots[sApuSlot].ui64Counter += m_hsSlots[sApuSlot].ui64Inc;
+				}
+				else if ( phsSlot != nullptr ) {
+					m_ui64CurMasterCounter = phsSlot->ui64Counter;
+					(phsSlot->ptHw->*phsSlot->pfTick)();
+					phsSlot->ui64Counter += phsSlot->ui64Inc;
+					m_sSlotsToCheck[sCheckedSlot] = phsSlot->sPartnerSlot;
+				}
+				else { break; }
+			}
+		}
+
+		/**
+		 * Runs until the PPU finishes the current frame.
+		 */
+		void												Frame() {
+			uint64_t ui64Frame = GetPpuFrameCount();
+			while ( GetPpuFrameCount() == ui64Frame ) { Step( 1000 ); }
+		}
+
+		/**
+		 * Reads a byte from the CPU bus.
+		 *
+		 * \param _ui16Addr The address to read.
+		 * \return Returns the byte at the given address.
+		 */
+		uint8_t												Peek( uint16_t _ui16Addr ) { return m_bBus.Read( _ui16Addr ); }
+	};
+
+
+	// == Functions.
+	/**
+	 * Runs every given ROM, searching folders recursively for .nes files.
+	 *
+	 * \param _vPaths The ROMs and folders to run.
+	 * \param _ui32Frames The number of frames after which to give up on a ROM that has not reported.
+	 * \param _vResults Holds the results of each ROM.
+	 * \return Returns true if every ROM reported success.
+	 */
+	bool CTestRomRunner::Run( const std::vector<std::filesystem::path> &_vPaths, uint32_t _ui32Frames, std::vector<LSN_ROM_RESULT> &_vResults ) {
+		std::vector<std::filesystem::path> vRoms;
+		for ( const auto & pPath : _vPaths ) {
+			if ( !std::filesystem::is_directory( pPath ) ) {
+				vRoms.push_back( pPath );
+				continue;
+			}
+			std::vector<std::filesystem::path> vThisDir;
+			for ( const auto & deEntry : std::filesystem::recursive_directory_iterator( pPath ) ) {
+				if ( !deEntry.is_regular_file() ) { continue; }
+				std::u16string u16Ext = CUtilities::ToLower( deEntry.path().extension().u16string() );
+				if ( u16Ext == u".nes" ) { vThisDir.push_back( deEntry.path() ); }
+			}
+			std::sort( vThisDir.begin(), vThisDir.end() );
+			vRoms.insert( vRoms.end(), vThisDir.begin(), vThisDir.end() );
+		}
+
+		bool bPassed = true;
+		_vResults.clear();
+		_vResults.reserve( vRoms.size() );
+		for ( const auto & pRom : vRoms ) {
+			_vResults.push_back( RunRom( pRom, _ui32Frames ) );
+			if ( _vResults.back().i32Status != 0 ) { bPassed = false; }
+		}
+		return bPassed;
+	}
+
+	/**
+	 * Creates a report from the results of Run().
+	 *
+	 * \param _vResults The results to report.
+	 * \return Returns a human-readable report with one line per ROM.
+	 */
+	std::string CTestRomRunner::Report( const std::vector<LSN_ROM_RESULT> &_vResults ) {
+		std::string sRet;
+		size_t sPassed = 0;
+		for ( const auto & rrThis : _vResults ) {
+			std::string sName = rrThis.pPath.filename().string();
+			if ( !rrThis.bLoaded ) {
+				sRet += std::format( "{}: failed to load\r\n", sName );
+			}
+			else if ( rrThis.i32Status < 0 ) {
+				sRet += std::format( "{}: no result; screen: {}\r\n", sName, rrThis.sText );
+			}
+			else {
+				sRet += std::format( "{}: {} {}\r\n", sName, rrThis.i32Status, rrThis.sText );
+				if ( rrThis.i32Status == 0 ) { ++sPassed; }
+			}
+		}
+		sRet += std::format( "{} of {} passed.\r\n", sPassed, _vResults.size() );
+		return sRet;
+	}
+
+	/**
+	 * Runs a single ROM.
+	 *
+	 * \param _pPath The ROM to run.
+	 * \param _ui32Frames The number of frames after which to give up if the ROM has not reported.
+	 * \return Returns the result of the ROM.
+	 */
+	CTestRomRunner::LSN_ROM_RESULT CTestRomRunner::RunRom( const std::filesystem::path &_pPath, uint32_t _ui32Frames ) {
+		LSN_ROM_RESULT rrRet;
+		rrRet.pPath = _pPath;
+		LSN_ROM rRom;
+		if ( !CSystemBase::LoadRomFile( _pPath.u16string(), rRom ) ) { return rrRet; }
+		rrRet.bLoaded = true;
+		// Never touch save files.
+		rRom.u16SaveFilePrefix.clear();
+
+		std::unique_ptr<CTestRomSystem> ptrsSystem = std::make_unique<CTestRomSystem>();
+		ptrsSystem->LoadRom( rRom );
+		std::vector<uint8_t> vTarget( 256 * 240 * 2 );
+		ptrsSystem->GetPpu().SetRenderTarget( vTarget.data(), 256 * 2, CDisplayClient::LSN_POF_9BIT_PALETTE, false );
+		ptrsSystem->ResetState( false );
+
+		uint32_t ui32ResetAt = ~0U;
+		for ( uint32_t F = 0; F < _ui32Frames; ++F ) {
+			ptrsSystem->Frame();
+			if ( F == ui32ResetAt ) {
+				ptrsSystem->ResetState( true );
+				ui32ResetAt = ~0U;
+				continue;
+			}
+			if ( ptrsSystem->Peek( 0x6001 ) != 0xDE || ptrsSystem->Peek( 0x6002 ) != 0xB0 || ptrsSystem->Peek( 0x6003 ) != 0x61 ) { continue; }
+			uint8_t ui8Status = ptrsSystem->Peek( 0x6000 );
+			if ( ui8Status == 0x81 ) {
+				// The ROM asks for a reset after at least 100 milliseconds.
+				if ( ui32ResetAt == ~0U ) { ui32ResetAt = F + 10; }
+				continue;
+			}
+			if ( ui8Status < 0x80 ) {
+				for ( uint16_t A = 0x6004; A < 0x7000; ++A ) {
+					char cChar = char( ptrsSystem->Peek( A ) );
+					if ( !cChar ) { break; }
+					if ( cChar == '\n' ) {
+						if ( rrRet.sText.size() && rrRet.sText.back() != ' ' ) { rrRet.sText += " | "; }
+					}
+					else { rrRet.sText.push_back( cChar ); }
+				}
+				while ( rrRet.sText.size() && (rrRet.sText.back() == ' ' || rrRet.sText.back() == '|') ) { rrRet.sText.pop_back(); }
+				rrRet.i32Status = ui8Status;
+				return rrRet;
+			}
+		}
+
+		// No result; take what is on the screen.
+		for ( uint16_t Y = 0; Y < 30; ++Y ) {
+			std::string sLine;
+			for ( uint16_t X = 0; X < 32; ++X ) {
+				uint8_t ui8Char = ptrsSystem->GetPpu().GetPpuBus().DBG_Inspect( uint16_t( 0x2000 + Y * 32 + X ) );
+				sLine.push_back( (ui8Char >= 0x20 && ui8Char < 0x7F) ? char( ui8Char ) : ' ' );
+			}
+			size_t sStart = sLine.find_first_not_of( ' ' );
+			if ( sStart == std::string::npos ) { continue; }
+			if ( rrRet.sText.size() ) { rrRet.sText += " | "; }
+			rrRet.sText += sLine.substr( sStart, sLine.find_last_not_of( ' ' ) - sStart + 1 );
+		}
+		return rrRet;
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_TEST_ROMS
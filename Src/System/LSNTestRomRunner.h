@@ -0,0 +1,78 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: Runs test ROMs headlessly on the NTSC system and reports one result per ROM.  The system is stepped by master clock
+ *	rather than real time, so runs are repeatable and as fast as the host allows.
+ */
+
+
+#pragma once
+
+#ifdef LSN_TEST_ROMS
+
+#include "../LSNLSpiroNes.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+namespace lsn {
+
+	/**
+	 * Class CTestRomRunner
+	 * \brief Runs test ROMs headlessly on the NTSC system.
+	 *
+	 * Description: Runs test ROMs headlessly on the NTSC system.  ROMs that report through the $6000 protocol (blargg's) give their status
+	 *	code and message; for the rest, the printable characters of the first nametable are taken after a given number of frames.  The
+	 *	report is meant to be compared between builds, such as with and without LSN_MMC3_EXACT_A12.
+	 */
+	class CTestRomRunner {
+	public :
+		// == Types.
+		/** The result of one ROM. */
+		struct LSN_ROM_RESULT {
+			std::filesystem::path							pPath;									/**< The ROM. */
+			int32_t											i32Status = -1;							/**< The $6000 status, or -1 if the ROM could not be loaded or never reported. */
+			bool											bLoaded = false;						/**< Set if the ROM was loaded. */
+			std::string										sText;									/**< The ROM's message, or the screen text if it never reported. */
+		};
+
+
+		// == Functions.
+		/**
+		 * Runs every given ROM, searching folders recursively for .nes files.
+		 *
+		 * \param _vPaths The ROMs and folders to run.
+		 * \param _ui32Frames The number of frames after which to give up on a ROM that has not reported.
+		 * \param _vResults Holds the results of each ROM.
+		 * \return Returns true if every ROM reported success.
+		 */
+		static bool											Run( const std::vector<std::filesystem::path> &_vPaths, uint32_t _ui32Frames, std::vector<LSN_ROM_RESULT> &_vResults );
+
+		/**
+		 * Creates a report from the results of Run().
+		 *
+		 * \param _vResults The results to report.
+		 * \return Returns a human-readable report with one line per ROM.
+		 */
+		static std::string									Report( const std::vector<LSN_ROM_RESULT> &_vResults );
+
+
+	protected :
+		// == Functions.
+		/**
+		 * Runs a single ROM.
+		 *
+		 * \param _pPath The ROM to run.
+		 * \param _ui32Frames The number of frames after which to give up if the ROM has not reported.
+		 * \return Returns the result of the ROM.
+		 */
+		static LSN_ROM_RESULT								RunRom( const std::filesystem::path &_pPath, uint32_t _ui32Frames );
+	};
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_TEST_ROMS
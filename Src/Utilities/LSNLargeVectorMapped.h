@@ -0,0 +1,810 @@
+/**
+ * Copyright L. Spiro 2025
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A memory-mapped backend for large_vector.  The complete set of elements is stored in a file that is
+ *	mapped through several fixed-size views (sections) that are recycled in LRU order.  Sequential walks (forward or
+ *	backward) are detected and the next section is prefetched on a background thread, while evicted sections are
+ *	flushed and unmapped on that same thread, so the calling thread rarely waits on the disk.
+ *
+ * Note: Iterator support is explicitly removed, as with large_vector.
+ */
+
+#pragma once
+
+#include "../File/LSNFileMap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined( _MSC_VER )
+    // Microsoft Visual Studio Compiler.
+    #define LGVM_LIKELY( x )					( x ) [[likely]]
+    #define LGVM_UNLIKELY( x )					( x ) [[unlikely]]
+#elif defined( __GNUC__ ) || defined( __clang__ )
+    // GNU Compiler Collection (GCC) or Clang.
+    #define LGVM_LIKELY( x )					( __builtin_expect( !!(x), 1 ) )
+    #define LGVM_UNLIKELY( x )					( __builtin_expect( !!(x), 0 ) )
+#else
+    #error "Unsupported compiler"
+#endif
+
+namespace lsn {
+
+	//------------------------------------------------------------------------------
+	// large_vector_mapped_base: Shared Backing-File Directory Management
+	//------------------------------------------------------------------------------
+
+	/**
+	 * \brief Non-template base that owns the backing-file directory shared by every large_vector_mapped instantiation.
+	 *
+	 * Files are created under the current directory in "lvecm" so that they never collide with large_vector's "lvec" files.
+	 */
+	class large_vector_mapped_base {
+	protected :
+		/**
+		 * \brief Registers an instance and generates a unique backing-file path.
+		 *
+		 * \return Returns the path to use for the new instance's backing file.
+		 * \throws std::runtime_error if the directory could not be created.
+		 */
+		static std::filesystem::path							acquirePath() {
+			std::lock_guard<std::mutex> lgLock( s_mMutex );
+			if ( s_nInstanceCount == 0 ) {
+				s_pBaseDirectory = std::filesystem::current_path() / "lvecm";
+				std::error_code ecErr;
+				if ( !std::filesystem::create_directories( s_pBaseDirectory, ecErr ) && ecErr ) {
+					throw std::runtime_error( "Failed to create directories for large_vector_mapped file: " + ecErr.message() );
+				}
+			}
+			++s_nInstanceCount;
+			return s_pBaseDirectory / ("lvecm" + std::to_string( s_uID.fetch_add( 1, std::memory_order_relaxed ) ) + ".dat");
+		}
+
+		/**
+		 * \brief Unregisters an instance, removing the directory when the last instance goes away.
+		 */
+		static void												releasePath() {
+			std::lock_guard<std::mutex> lgLock( s_mMutex );
+			if ( --s_nInstanceCount == 0 ) {
+				std::error_code ecErr;
+				std::filesystem::remove_all( s_pBaseDirectory, ecErr );
+				s_uID.store( 0, std::memory_order_relaxed );
+			}
+		}
+
+		/**
+		 * \brief Registers an additional reference to the directory (used by moves).
+		 */
+		static void												addRef() {
+			std::lock_guard<std::mutex> lgLock( s_mMutex );
+			++s_nInstanceCount;
+		}
+
+
+	private :
+		/** A static atomic counter for generating unique IDs for each instance. */
+		inline static std::atomic<uint64_t>						s_uID{ 0 };
+
+		// Static variables for instance counting and directory management.
+		inline static size_t									s_nInstanceCount = 0;
+		inline static std::mutex								s_mMutex;
+		inline static std::filesystem::path						s_pBaseDirectory;
+	};
+
+
+	//------------------------------------------------------------------------------
+	// large_vector_mapped: A Memory-Mapped, Disk-Backed Vector
+	//------------------------------------------------------------------------------
+
+	/**
+	 * \brief A drop-in alternative to large_vector that keeps its elements in a memory-mapped file.
+	 *
+	 * _nMaxRamItems elements are mapped at a time, split across _nSections views that are recycled in LRU order.
+	 *	Element access inside a mapped section is a pointer offset with no I/O.  Inserting/erasing shifts elements with
+	 *	memmove() between views rather than through a temporary buffer and stream reads/writes.
+	 *
+	 * \tparam T The type of elements stored.  Must be trivially copyable; new elements are zero-initialized.
+	 * \tparam Allocator Unused.  Accepted so the type can replace large_vector<T, Allocator> directly.
+	 */
+	template <typename T, typename Allocator = std::allocator<T>>
+	class large_vector_mapped : protected large_vector_mapped_base {
+		static_assert( std::is_trivially_copyable<T>::value, "large_vector_mapped requires a trivially copyable type." );
+	public :
+		using value_type										= T;
+		using allocator_type	 								= Allocator;
+		using size_type											= size_t;
+		using difference_type									= ptrdiff_t;
+		using reference											= T &;
+		using const_reference									= const T &;
+		using pointer											= T *;
+		using const_pointer										= const T *;
+
+		// --- Disable Copy ---
+		large_vector_mapped( const large_vector_mapped & ) = delete;
+		large_vector_mapped &									operator = ( const large_vector_mapped & ) = delete;
+
+		/**
+		 * \brief Constructs a large_vector_mapped.
+		 *
+		 * \param _nMaxRamItems Maximum number of items to keep mapped at one time (across all sections).
+		 * \param _nTotalSize Total number of elements that the vector will initially store.
+		 * \param _nSections The number of sections to keep mapped.  At least 2 are needed for prefetching.
+		 * \throws std::runtime_error if the backing file could not be created.
+		 */
+		large_vector_mapped( size_t _nMaxRamItems, size_t _nTotalSize, size_t _nSections = 4 ) :
+			m_pfmFile( std::make_unique<CFileMap>() ),
+			m_nMaxSections( std::max<size_t>( _nSections, 1 ) ) {
+			m_pPathDiskFile = acquirePath();
+			try {
+				// Sections are a whole number of elements and start on a view-alignment boundary.
+				const size_t sUnit = std::lcm( CFileMap::Granularity(), sizeof( T ) );
+				size_t sSectionBytes = std::max<size_t>( _nMaxRamItems / m_nMaxSections, 1 ) * sizeof( T );
+				sSectionBytes = (sSectionBytes + sUnit - 1) / sUnit * sUnit;
+				m_nSectionItems = sSectionBytes / sizeof( T );
+
+				if ( !m_pfmFile->Create( m_pPathDiskFile ) ) { throw std::runtime_error( "Failed to create disk file for large_vector_mapped." ); }
+				m_vSections.reserve( m_nMaxSections );
+				grow( std::max<size_t>( _nTotalSize, 1 ) );
+				m_nTotalSize = _nTotalSize;
+			}
+			catch ( ... ) {
+				m_pfmFile.reset();
+				std::error_code ecErr;
+				std::filesystem::remove( m_pPathDiskFile, ecErr );
+				releasePath();
+				throw;
+			}
+		}
+		large_vector_mapped( large_vector_mapped && _lvOther ) noexcept {
+			addRef();
+			steal( _lvOther );
+		}
+
+		/**
+		 * \brief Destructor that unmaps all sections and deletes the on-disk file.
+		 */
+		~large_vector_mapped() {
+			destroy();
+			releasePath();
+		}
+
+		// --- move assignment ---
+		large_vector_mapped &									operator = ( large_vector_mapped && _lvOther ) noexcept {
+			if ( this != &_lvOther ) {
+				destroy();
+				steal( _lvOther );
+			}
+			return (*this);
+		}
+
+		//-------------------------------------------------------------------------
+		// Size Queries
+		//-------------------------------------------------------------------------
+
+		/**
+		 * \brief Returns the total number of elements stored.
+		 *
+		 * \return The total number of elements.
+		 */
+		size_t													size() const { return m_nTotalSize; }
+
+		/**
+		 * \brief Checks if the container is empty.
+		 *
+		 * \return True if there are no elements; false otherwise.
+		 */
+		bool													empty() const { return m_nTotalSize == 0; }
+
+		/**
+		 * \brief Returns the number of elements the backing file can hold without growing.
+		 *
+		 * \return The capacity in elements.
+		 */
+		size_t													capacity() const { return m_nCapacity; }
+
+		//-------------------------------------------------------------------------
+		// Element Access
+		//-------------------------------------------------------------------------
+
+		/**
+		 * \brief Provides bounds–checked access to an element.
+		 *
+		 * \param _nIndex The global index of the element.
+		 * \return Reference to the element.
+		 * \throws std::out_of_range if _nIndex is outside [0, size()).
+		 */
+		T &														at( size_t _nIndex ) {
+			if ( _nIndex >= m_nTotalSize ) { throw std::out_of_range( "Index out of range in at()." ); }
+			return (*this)[_nIndex];
+		}
+
+		/**
+		 * \brief Provides bounds–checked, read–only access to an element.
+		 *
+		 * \param _nIndex The global index of the element.
+		 * \return Const reference to the element.
+		 * \throws std::out_of_range if _nIndex is outside [0, size()).
+		 */
+		const T &												at( size_t _nIndex ) const {
+			if ( _nIndex >= m_nTotalSize ) { throw std::out_of_range( "Index out of range in at() const." ); }
+			return (*this)[_nIndex];
+		}
+
+		T &														front() = delete;
+		const T &												front() const = delete;
+		T &														back() = delete;
+		const T &												back() const = delete;
+
+		/**
+		 * \brief Provides non–const access to an element using the [] operator.
+		 *
+		 * If the element is in the most recently used section this is a pointer offset.  Otherwise the section is found
+		 *	or mapped (evicting the least-recently used one) and marked dirty.
+		 *
+		 * \param _nIndex The global index of the element.
+		 * \return Reference to the element.
+		 * \throws std::out_of_range if _nIndex is not valid.
+		 * \throws std::runtime_error if a section could not be mapped.
+		 */
+		T &														operator [] ( size_t _nIndex ) {
+			if LGVM_UNLIKELY( _nIndex >= m_nTotalSize ) {
+				throw std::out_of_range( "Index out of range in operator[]." );
+			}
+			return element( _nIndex, true );
+		}
+
+		/**
+		 * \brief Provides const access to an element using the [] operator.
+		 *
+		 * \param _nIndex The global index of the element.
+		 * \return Const reference to the element.
+		 */
+		const T &												operator [] ( size_t _nIndex ) const {
+			if LGVM_UNLIKELY( _nIndex >= m_nTotalSize ) {
+				throw std::out_of_range( "Index out of range in operator[]." );
+			}
+			return const_cast<large_vector_mapped *>(this)->element( _nIndex, false );
+		}
+
+		//-------------------------------------------------------------------------
+		// Disable Iterator Support
+		//-------------------------------------------------------------------------
+
+		T *														begin() = delete;
+		T *														end() = delete;
+		const T *												begin() const = delete;
+		const T *												end() const = delete;
+		const T *												cbegin() const = delete;
+		const T *												cend() const = delete;
+
+		//-------------------------------------------------------------------------
+		// Modification Functions
+		//-------------------------------------------------------------------------
+
+		/**
+		 * \brief Appends an element to the end of the vector.
+		 *
+		 * \param _tElem The element to append.
+		 * \throws std::runtime_error if the file could not be grown or mapped.
+		 */
+		void													push_back( const T & _tElem ) {
+			if LGVM_UNLIKELY( m_nTotalSize == m_nCapacity ) { grow( m_nTotalSize + 1 ); }
+			element( m_nTotalSize++, true ) = _tElem;
+		}
+
+		/**
+		 * \brief Appends an array of elements to the end of the vector.
+		 *
+		 * \param _pArray Pointer to the first element of the array to append.
+		 * \param _nCount Number of elements to append.
+		 * \throws std::runtime_error if the file could not be grown or mapped.
+		 */
+		void													push_back( const T * _pArray, size_t _nCount ) {
+			grow( m_nTotalSize + _nCount );
+			copyIn( m_nTotalSize, _pArray, _nCount );
+			m_nTotalSize += _nCount;
+		}
+
+		/**
+		 * \brief Removes the last element from the vector.  The file keeps its capacity.
+		 *
+		 * \throws std::runtime_error if the vector is empty.
+		 */
+		void													pop_back() {
+			if ( m_nTotalSize == 0 ) { throw std::runtime_error( "pop_back called on empty vector." ); }
+			--m_nTotalSize;
+		}
+
+		/**
+		 * \brief Removes a specified number of elements from the back of the vector.  The file keeps its capacity.
+		 *
+		 * \param _nCount The number of items to pop.
+		 * \throws std::runtime_error if _nCount exceeds the current size.
+		 */
+		void													pop_back( size_t _nCount ) {
+			if ( _nCount > m_nTotalSize ) { throw std::runtime_error( "pop_back called with too many items." ); }
+			m_nTotalSize -= _nCount;
+		}
+
+		/**
+		 * \brief Inserts an element at the specified index.
+		 *
+		 * \param _nIndex The global index at which to insert the element.
+		 * \param _tElem The element to insert.
+		 * \throws std::out_of_range if _nIndex is greater than the current size.
+		 * \throws std::runtime_error if the file could not be grown or mapped.
+		 */
+		void													insert( size_t _nIndex, const T & _tElem ) {
+			insert( _nIndex, &_tElem, 1 );
+		}
+
+		/**
+		 * \brief Inserts an array of elements at the specified index.
+		 *
+		 * The tail is moved up with memmove() between mapped views, then the new range is copied in.
+		 *
+		 * \param _nIndex The global index at which to insert.
+		 * \param _pArray Pointer to the first element to insert.
+		 * \param _nCount Number of elements to insert.
+		 * \throws std::out_of_range if _nIndex is greater than the current size.
+		 * \throws std::runtime_error if the file could not be grown or mapped.
+		 */
+		void													insert( size_t _nIndex, const T * _pArray, size_t _nCount ) {
+			if ( _nIndex > m_nTotalSize ) { throw std::out_of_range( "Insert index out of range." ); }
+			if ( !_nCount ) { return; }
+			grow( m_nTotalSize + _nCount );
+			moveItems( _nIndex + _nCount, _nIndex, m_nTotalSize - _nIndex );
+			copyIn( _nIndex, _pArray, _nCount );
+			m_nTotalSize += _nCount;
+		}
+
+		/**
+		 * \brief Erases a number of elements from the front of the vector.
+		 *
+		 * \param _nCount The number of elements to remove from the front.
+		 * \throws std::runtime_error if _nCount exceeds the current size or a view could not be mapped.
+		 */
+		void													erase_front( size_t _nCount ) {
+			if ( _nCount > m_nTotalSize ) { throw std::runtime_error( "erase_front count too large." ); }
+			if ( !_nCount ) { return; }
+			moveItems( 0, _nCount, m_nTotalSize - _nCount );
+			m_nTotalSize -= _nCount;
+		}
+
+		/**
+		 * \brief Resizes the vector to contain _nNewSize elements.  New elements are zero-initialized.
+		 *
+		 * \param _nNewSize The new total number of elements.
+		 * \throws std::runtime_error if the file could not be grown or mapped.
+		 */
+		void													resize( size_t _nNewSize ) {
+			if ( _nNewSize > m_nTotalSize ) {
+				grow( _nNewSize );
+				// Space past the old size may hold elements from before a shrink.
+				fillZero( m_nTotalSize, _nNewSize - m_nTotalSize );
+			}
+			m_nTotalSize = _nNewSize;
+		}
+
+		/**
+		 * \brief Grows the backing file so that at least _nNewCapacity elements fit without further resizing.
+		 *
+		 * \param _nNewCapacity The requested capacity.
+		 * \throws std::runtime_error if the file could not be grown.
+		 */
+		void													reserve( size_t _nNewCapacity ) {
+			grow( _nNewCapacity );
+		}
+
+
+	private :
+		// == Types.
+		/** A mapped section. */
+		struct LSN_SECTION {
+			CFileMap::LSN_VIEW									vView;					/**< The mapped view. */
+			size_t												nStart = 0;				/**< The index of the first element in the section. */
+			T *													ptData = nullptr;		/**< The elements. */
+			uint64_t											ui64LastUse = 0;		/**< LRU tick. */
+			bool												bDirty = false;			/**< True if the section has been written since it was mapped. */
+		};
+
+		/** A request for the background I/O thread. */
+		struct LSN_IO_REQ {
+			CFileMap::LSN_VIEW									vView;					/**< The view to act on. */
+			bool												bPrefetch = false;		/**< If true, prefetch the view; otherwise unmap it. */
+			bool												bFlush = false;			/**< If unmapping, flush it first. */
+		};
+
+
+		// == Members.
+		std::unique_ptr<CFileMap>								m_pfmFile;				/**< The backing file. */
+		std::filesystem::path									m_pPathDiskFile;		/**< Generated disk file path. */
+		std::vector<LSN_SECTION>								m_vSections;			/**< The mapped sections. */
+		size_t													m_nMaxSections = 1;		/**< Maximum number of mapped sections. */
+		size_t													m_nSectionItems = 1;	/**< Elements per section. */
+		size_t													m_nTotalSize = 0;		/**< Total number of elements stored. */
+		size_t													m_nCapacity = 0;		/**< Number of elements the file can hold. */
+		size_t													m_stLast = 0;			/**< Index into m_vSections of the last section used. */
+		size_t													m_nLastSection = size_t( -1 );	/**< The section number of the last section entered. */
+		int32_t													m_i32SeqDir = 0;		/**< +1 or -1 if the last 2 sections entered were adjacent, otherwise 0. */
+		uint64_t												m_ui64Tick = 0;			/**< LRU clock. */
+
+		std::thread												m_tIo;					/**< The background I/O thread (started on demand). */
+		std::mutex												m_mIo;					/**< Protects the I/O queue. */
+		std::condition_variable									m_cvIo;					/**< Signals the I/O thread. */
+		std::condition_variable									m_cvIoIdle;				/**< Signals that the I/O queue is empty. */
+		std::deque<LSN_IO_REQ>									m_dIoQueue;				/**< Pending I/O requests. */
+		bool													m_bIoBusy = false;		/**< True while the I/O thread is working on a request. */
+		bool													m_bStopIo = false;		/**< Tells the I/O thread to exit. */
+
+
+		// == Functions.
+		/**
+		 * \brief Gets an element, mapping its section if needed.  _nIndex must be less than m_nCapacity.
+		 *
+		 * \param _nIndex The global index of the element.
+		 * \param _bWrite If true, the section is marked dirty.
+		 * \return Returns a reference to the element.
+		 */
+		inline T &												element( size_t _nIndex, bool _bWrite ) {
+			if LGVM_LIKELY( m_stLast < m_vSections.size() ) {
+				LSN_SECTION & sSec = m_vSections[m_stLast];
+				size_t nOff = _nIndex - sSec.nStart;											// Wraps to a huge value if _nIndex < nStart.
+				if LGVM_LIKELY( nOff < m_nSectionItems ) {
+					sSec.bDirty |= _bWrite;
+					return sSec.ptData[nOff];
+				}
+			}
+			LSN_SECTION & sSec = section( _nIndex );
+			sSec.bDirty |= _bWrite;
+			return sSec.ptData[_nIndex-sSec.nStart];
+		}
+
+		/**
+		 * \brief Finds or maps the section containing a given element and makes it the most recently used.
+		 *
+		 * \param _nIndex The global index of the element.
+		 * \return Returns the section.
+		 * \throws std::runtime_error if the section could not be mapped.
+		 */
+		LSN_SECTION &											section( size_t _nIndex ) {
+			const size_t nSection = _nIndex / m_nSectionItems;
+			// Sequential-access detection.  Only called when leaving the last-used section, so adjacent sections mean a walk.
+			if ( m_nLastSection != size_t( -1 ) && nSection == m_nLastSection + 1 ) { m_i32SeqDir = 1; }
+			else if ( m_nLastSection != size_t( -1 ) && nSection + 1 == m_nLastSection ) { m_i32SeqDir = -1; }
+			else { m_i32SeqDir = 0; }
+			m_nLastSection = nSection;
+
+			size_t stIdx = findSection( nSection * m_nSectionItems );
+			if ( stIdx == m_vSections.size() ) {
+				stIdx = mapSection( nSection, m_vSections.size() );
+			}
+			m_vSections[stIdx].ui64LastUse = ++m_ui64Tick;
+
+			// Read ahead in the direction of the walk.
+			if ( m_i32SeqDir && m_nMaxSections >= 2 ) {
+				if ( m_i32SeqDir > 0 ? ((nSection + 1) * m_nSectionItems < m_nCapacity) : (nSection > 0) ) {
+					size_t nNext = m_i32SeqDir > 0 ? nSection + 1 : nSection - 1;
+					if ( findSection( nNext * m_nSectionItems ) == m_vSections.size() ) {
+						try {
+							size_t stNext = mapSection( nNext, stIdx );
+							m_vSections[stNext].ui64LastUse = m_ui64Tick;
+							queueIo( m_vSections[stNext].vView, true, false );
+						}
+						catch ( ... ) {}																// Prefetching is optional.
+					}
+				}
+			}
+			m_stLast = stIdx;
+			return m_vSections[stIdx];
+		}
+
+		/**
+		 * \brief Finds a mapped section by its starting element.
+		 *
+		 * \param _nStart The first element in the section.
+		 * \return Returns the index into m_vSections or m_vSections.size().
+		 */
+		size_t													findSection( size_t _nStart ) const {
+			for ( size_t I = 0; I < m_vSections.size(); ++I ) {
+				if ( m_vSections[I].nStart == _nStart ) { return I; }
+			}
+			return m_vSections.size();
+		}
+
+		/**
+		 * \brief Maps a section into a free slot or the least-recently-used slot.
+		 *
+		 * \param _nSection The section number to map.
+		 * \param _stKeep A slot that must not be evicted (or m_vSections.size() for none).
+		 * \return Returns the slot index.
+		 * \throws std::runtime_error if the section could not be mapped.
+		 */
+		size_t													mapSection( size_t _nSection, size_t _stKeep ) {
+			size_t stSlot;
+			if ( m_vSections.size() < m_nMaxSections ) {
+				m_vSections.emplace_back();
+				stSlot = m_vSections.size() - 1;
+			}
+			else {
+				stSlot = m_vSections.size();
+				for ( size_t I = 0; I < m_vSections.size(); ++I ) {
+					if ( I == _stKeep ) { continue; }
+					if ( stSlot == m_vSections.size() || m_vSections[I].ui64LastUse < m_vSections[stSlot].ui64LastUse ) { stSlot = I; }
+				}
+				// Write-behind: the evicted view is flushed and unmapped in the background.
+				queueIo( m_vSections[stSlot].vView, false, m_vSections[stSlot].bDirty );
+			}
+			LSN_SECTION & sSec = m_vSections[stSlot];
+			sSec = LSN_SECTION();
+			sSec.nStart = size_t( -1 );																	// Never matches until mapped.
+			if ( !m_pfmFile->MapView( uint64_t( _nSection ) * m_nSectionItems * sizeof( T ), m_nSectionItems * sizeof( T ), sSec.vView ) ) {
+				if ( m_stLast == stSlot ) { m_stLast = m_vSections.size(); }
+				throw std::runtime_error( "Failed to map a section in large_vector_mapped." );
+			}
+			sSec.nStart = _nSection * m_nSectionItems;
+			sSec.ptData = reinterpret_cast<T *>(sSec.vView.pui8Data);
+			return stSlot;
+		}
+
+		/**
+		 * \brief Grows the backing file to hold at least _nItems elements.  All sections are unmapped first.
+		 *
+		 * \param _nItems The number of elements needed.
+		 * \throws std::runtime_error if the file could not be resized.
+		 */
+		void													grow( size_t _nItems ) {
+			if ( _nItems <= m_nCapacity ) { return; }
+			size_t nNewCap = std::max( _nItems, m_nCapacity * 2 );
+			nNewCap = (nNewCap + m_nSectionItems - 1) / m_nSectionItems * m_nSectionItems;
+			unmapAll();
+			if ( !m_pfmFile->Resize( uint64_t( nNewCap ) * sizeof( T ) ) ) {
+				throw std::runtime_error( "Failed to grow disk file for large_vector_mapped." );
+			}
+			m_nCapacity = nNewCap;
+		}
+
+		/**
+		 * \brief Copies elements into the vector section-by-section.  The range must be inside the capacity.
+		 *
+		 * \param _nIndex The first element to write.
+		 * \param _pSrc The source elements.
+		 * \param _nCount The number of elements to write.
+		 */
+		void													copyIn( size_t _nIndex, const T * _pSrc, size_t _nCount ) {
+			while ( _nCount ) {
+				T * ptDst = &element( _nIndex, true );
+				size_t nRun = std::min( _nCount, m_nSectionItems - (_nIndex % m_nSectionItems) );
+				std::memcpy( ptDst, _pSrc, nRun * sizeof( T ) );
+				_pSrc += nRun;
+				_nIndex += nRun;
+				_nCount -= nRun;
+			}
+		}
+
+		/**
+		 * \brief Zeros elements section-by-section.  The range must be inside the capacity.
+		 *
+		 * \param _nIndex The first element to clear.
+		 * \param _nCount The number of elements to clear.
+		 */
+		void													fillZero( size_t _nIndex, size_t _nCount ) {
+			while ( _nCount ) {
+				T * ptDst = &element( _nIndex, true );
+				size_t nRun = std::min( _nCount, m_nSectionItems - (_nIndex % m_nSectionItems) );
+				std::memset( static_cast<void *>(ptDst), 0, nRun * sizeof( T ) );
+				_nIndex += nRun;
+				_nCount -= nRun;
+			}
+		}
+
+		/**
+		 * \brief Moves a range of elements inside the file.  Both ranges must be inside the capacity.
+		 *
+		 * Works in section-sized chunks in the direction that never overwrites unread source elements.  Chunks closer
+		 *	together than a section share one view so memmove() can handle the overlap; others use 2 views.
+		 *
+		 * \param _nDst The destination index.
+		 * \param _nSrc The source index.
+		 * \param _nCount The number of elements to move.
+		 * \throws std::runtime_error if a view could not be mapped.
+		 */
+		void													moveItems( size_t _nDst, size_t _nSrc, size_t _nCount ) {
+			if ( !_nCount || _nDst == _nSrc ) { return; }
+			const size_t nDist = _nDst > _nSrc ? _nDst - _nSrc : _nSrc - _nDst;
+			const size_t nChunkMax = m_nSectionItems;
+			for ( size_t nDone = 0; nDone < _nCount; ) {
+				size_t nChunk = std::min( nChunkMax, _nCount - nDone );
+				// Moving up: walk from the end.  Moving down: walk from the start.
+				size_t nOff = _nDst > _nSrc ? (_nCount - nDone - nChunk) : nDone;
+				size_t nS = _nSrc + nOff, nD = _nDst + nOff;
+				CFileMap::LSN_VIEW vA, vB;
+				if ( nDist < nChunk ) {
+					size_t nLo = std::min( nS, nD );
+					if ( !m_pfmFile->MapView( uint64_t( nLo ) * sizeof( T ), (nChunk + nDist) * sizeof( T ), vA ) ) {
+						throw std::runtime_error( "Failed to map a view in large_vector_mapped." );
+					}
+					T * ptBase = reinterpret_cast<T *>(vA.pui8Data);
+					std::memmove( ptBase + (nD - nLo), ptBase + (nS - nLo), nChunk * sizeof( T ) );
+					CFileMap::UnmapView( vA );
+				}
+				else {
+					if ( !m_pfmFile->MapView( uint64_t( nS ) * sizeof( T ), nChunk * sizeof( T ), vA ) ) {
+						throw std::runtime_error( "Failed to map a view in large_vector_mapped." );
+					}
+					if ( !m_pfmFile->MapView( uint64_t( nD ) * sizeof( T ), nChunk * sizeof( T ), vB ) ) {
+						CFileMap::UnmapView( vA );
+						throw std::runtime_error( "Failed to map a view in large_vector_mapped." );
+					}
+					std::memcpy( vB.pui8Data, vA.pui8Data, nChunk * sizeof( T ) );
+					CFileMap::UnmapView( vB );
+					CFileMap::UnmapView( vA );
+				}
+				nDone += nChunk;
+			}
+		}
+
+		/**
+		 * \brief Sends a view to the background I/O thread, starting the thread if needed.
+		 *
+		 * \param _vView The view.  The thread takes ownership of it if it is to be unmapped.
+		 * \param _bPrefetch If true, prefetch the view; otherwise unmap it.
+		 * \param _bFlush If unmapping, flush it first.
+		 */
+		void													queueIo( const CFileMap::LSN_VIEW &_vView, bool _bPrefetch, bool _bFlush ) {
+			LSN_IO_REQ irReq;
+			irReq.vView = _vView;
+			irReq.bPrefetch = _bPrefetch;
+			irReq.bFlush = _bFlush;
+			try {
+				if ( !m_tIo.joinable() ) {
+					m_bStopIo = false;
+					m_tIo = std::thread( &large_vector_mapped::ioThread, this );
+				}
+				{
+					std::lock_guard<std::mutex> lgLock( m_mIo );
+					m_dIoQueue.push_back( irReq );
+				}
+				m_cvIo.notify_one();
+			}
+			catch ( ... ) {
+				// No thread or no memory: do the work here.
+				doIo( irReq );
+			}
+		}
+
+		/**
+		 * \brief Performs a single I/O request.
+		 *
+		 * \param _irReq The request.
+		 */
+		static void												doIo( LSN_IO_REQ &_irReq ) {
+			if ( _irReq.bPrefetch ) {
+				CFileMap::PrefetchView( _irReq.vView );
+			}
+			else {
+				if ( _irReq.bFlush ) { CFileMap::FlushView( _irReq.vView ); }
+				CFileMap::UnmapView( _irReq.vView );
+			}
+		}
+
+		/**
+		 * \brief The background I/O thread.  Requests are handled in order, so a prefetch always finishes before its view is unmapped.
+		 */
+		void													ioThread() {
+			while ( true ) {
+				LSN_IO_REQ irReq;
+				{
+					std::unique_lock<std::mutex> ulLock( m_mIo );
+					m_cvIo.wait( ulLock, [&]() { return m_bStopIo || !m_dIoQueue.empty(); } );
+					if ( m_dIoQueue.empty() ) { break; }												// Stopping with nothing left to do.
+					irReq = m_dIoQueue.front();
+					m_dIoQueue.pop_front();
+					m_bIoBusy = true;
+				}
+				doIo( irReq );
+				{
+					std::lock_guard<std::mutex> lgLock( m_mIo );
+					m_bIoBusy = false;
+					if ( m_dIoQueue.empty() ) { m_cvIoIdle.notify_all(); }
+				}
+			}
+		}
+
+		/**
+		 * \brief Waits until the background I/O thread has finished all queued requests.
+		 */
+		void													waitIo() {
+			if ( !m_tIo.joinable() ) { return; }
+			std::unique_lock<std::mutex> ulLock( m_mIo );
+			m_cvIoIdle.wait( ulLock, [&]() { return m_dIoQueue.empty() && !m_bIoBusy; } );
+		}
+
+		/**
+		 * \brief Stops the background I/O thread after it finishes all queued requests.
+		 */
+		void													stopIo() {
+			if ( !m_tIo.joinable() ) { return; }
+			{
+				std::lock_guard<std::mutex> lgLock( m_mIo );
+				m_bStopIo = true;
+			}
+			m_cvIo.notify_one();
+			m_tIo.join();
+			m_bStopIo = false;
+		}
+
+		/**
+		 * \brief Unmaps every section (through the I/O thread) and waits for all I/O to finish.
+		 */
+		void													unmapAll() {
+			for ( auto & S : m_vSections ) {
+				queueIo( S.vView, false, false );
+			}
+			m_vSections.clear();
+			m_stLast = 0;
+			m_nLastSection = size_t( -1 );
+			m_i32SeqDir = 0;
+			waitIo();
+		}
+
+		/**
+		 * \brief Releases all resources and deletes the backing file.
+		 */
+		void													destroy() noexcept {
+			try {
+				stopIo();
+				for ( auto & S : m_vSections ) {
+					CFileMap::UnmapView( S.vView );
+				}
+				m_vSections.clear();
+				m_pfmFile.reset();
+				if ( !m_pPathDiskFile.empty() ) {
+					std::error_code ecErr;
+					std::filesystem::remove( m_pPathDiskFile, ecErr );
+				}
+			}
+			catch ( ... ) {}
+			m_nTotalSize = m_nCapacity = 0;
+		}
+
+		/**
+		 * \brief Takes the file and sections from another instance, leaving it empty.
+		 *
+		 * \param _lvOther The instance to steal from.
+		 */
+		void													steal( large_vector_mapped &_lvOther ) noexcept {
+			_lvOther.stopIo();
+			m_pfmFile = std::move( _lvOther.m_pfmFile );
+			m_pPathDiskFile = std::move( _lvOther.m_pPathDiskFile );
+			_lvOther.m_pPathDiskFile.clear();
+			m_vSections = std::move( _lvOther.m_vSections );
+			_lvOther.m_vSections.clear();
+			m_nMaxSections = _lvOther.m_nMaxSections;
+			m_nSectionItems = _lvOther.m_nSectionItems;
+			m_nTotalSize = _lvOther.m_nTotalSize;
+			m_nCapacity = _lvOther.m_nCapacity;
+			m_stLast = _lvOther.m_stLast;
+			m_nLastSection = _lvOther.m_nLastSection;
+			m_i32SeqDir = _lvOther.m_i32SeqDir;
+			m_ui64Tick = _lvOther.m_ui64Tick;
+			_lvOther.m_nTotalSize = _lvOther.m_nCapacity = 0;
+			_lvOther.m_stLast = 0;
+		}
+	};
+
+}	// namespace lsn
@@ -95,6 +95,33 @@ namespace lsn {
 			std::memcpy( &m_ui8Buffer[ui32Index], &_pui8Data[I], _sLen - I );
 		}
 
+		/**
+		 * Determines if all data passed to Update() so far fills whole 64-byte blocks (nothing is buffered).
+		 *
+		 * \return Returns true if the context is on a block boundary.
+		 */
+		inline bool												OnBlockBoundary() const { return (m_ui32Count[0] & 0x1FF) == 0; }
+
+		/**
+		 * Updates 2 MD5 contexts with the same number of whole 64-byte blocks each.  The 2 transforms are independent and are interleaved so that
+		 *	their dependency chains overlap, which nearly doubles throughput over 2 separate Update() calls.  Both contexts must be on a block
+		 *	boundary (see OnBlockBoundary()).
+		 *
+		 * \param _mA The first context.
+		 * \param _pui8A The data for the first context.  Must contain at least _sBlocks * 64 bytes.
+		 * \param _mB The second context.
+		 * \param _pui8B The data for the second context.  Must contain at least _sBlocks * 64 bytes.
+		 * \param _sBlocks The number of 64-byte blocks to add to each context.
+		 */
+		static void												UpdatePair( CMd5 &_mA, const uint8_t * _pui8A, CMd5 &_mB, const uint8_t * _pui8B, size_t _sBlocks ) {
+			for ( size_t I = 0; I < _sBlocks; ++I ) {
+				Transform2( _mA.m_ui32State, &_pui8A[I*64], _mB.m_ui32State, &_pui8B[I*64] );
+			}
+			uint64_t ui64Bits = uint64_t( _sBlocks ) << 9;
+			_mA.AddBits( ui64Bits );
+			_mB.AddBits( ui64Bits );
+		}
+
 		/**
 		 * Finalizes the MD5 context and returns the hash.
 		 *
@@ -264,6 +291,118 @@ namespace lsn {
 			_pui32State[3] += D;
 		}
 
+		/**
+		 * MD5 basic transformation applied to 2 independent states and blocks at once.
+		 *
+		 * \param _pui32StateA The first state to update.
+		 * \param _pui8BlockA The first 64-byte block.
+		 * \param _pui32StateB The second state to update.
+		 * \param _pui8BlockB The second 64-byte block.
+		 */
+		static void												Transform2( uint32_t _pui32StateA[4], const uint8_t _pui8BlockA[64], uint32_t _pui32StateB[4], const uint8_t _pui8BlockB[64] ) {
+			uint32_t A0 = _pui32StateA[0], B0 = _pui32StateA[1], C0 = _pui32StateA[2], D0 = _pui32StateA[3];
+			uint32_t A1 = _pui32StateB[0], B1 = _pui32StateB[1], C1 = _pui32StateB[2], D1 = _pui32StateB[3];
+			uint32_t X0[16], X1[16];
+
+			Decode( X0, _pui8BlockA, 64 );
+			Decode( X1, _pui8BlockB, 64 );
+
+#define LSN_MD5_STEP2( OP, A, B, C, D, K, S, T )		OP( A##0, B##0, C##0, D##0, X0[K], S, T ); OP( A##1, B##1, C##1, D##1, X1[K], S, T )
+			// Round 1
+			LSN_MD5_STEP2( FF, A, B, C, D,  0,  7, 0xD76AA478 );
+			LSN_MD5_STEP2( FF, D, A, B, C,  1, 12, 0xE8C7B756 );
+			LSN_MD5_STEP2( FF, C, D, A, B,  2, 17, 0x242070DB );
+			LSN_MD5_STEP2( FF, B, C, D, A,  3, 22, 0xC1BDCEEE );
+			LSN_MD5_STEP2( FF, A, B, C, D,  4,  7, 0xF57C0FAF );
+			LSN_MD5_STEP2( FF, D, A, B, C,  5, 12, 0x4787C62A );
+			LSN_MD5_STEP2( FF, C, D, A, B,  6, 17, 0xA8304613 );
+			LSN_MD5_STEP2( FF, B, C, D, A,  7, 22, 0xFD469501 );
+			LSN_MD5_STEP2( FF, A, B, C, D,  8,  7, 0x698098D8 );
+			LSN_MD5_STEP2( FF, D, A, B, C,  9, 12, 0x8B44F7AF );
+			LSN_MD5_STEP2( FF, C, D, A, B, 10, 17, 0xFFFF5BB1 );
+			LSN_MD5_STEP2( FF, B, C, D, A, 11, 22, 0x895CD7BE );
+			LSN_MD5_STEP2( FF, A, B, C, D, 12,  7, 0x6B901122 );
+			LSN_MD5_STEP2( FF, D, A, B, C, 13, 12, 0xFD987193 );
+			LSN_MD5_STEP2( FF, C, D, A, B, 14, 17, 0xA679438E );
+			LSN_MD5_STEP2( FF, B, C, D, A, 15, 22, 0x49B40821 );
+
+			// Round 2
+			LSN_MD5_STEP2( GG, A, B, C, D,  1,  5, 0xF61E2562 );
+			LSN_MD5_STEP2( GG, D, A, B, C,  6,  9, 0xC040B340 );
+			LSN_MD5_STEP2( GG, C, D, A, B, 11, 14, 0x265E5A51 );
+			LSN_MD5_STEP2( GG, B, C, D, A,  0, 20, 0xE9B6C7AA );
+			LSN_MD5_STEP2( GG, A, B, C, D,  5,  5, 0xD62F105D );
+			LSN_MD5_STEP2( GG, D, A, B, C, 10,  9, 0x02441453 );
+			LSN_MD5_STEP2( GG, C, D, A, B, 15, 14, 0xD8A1E681 );
+			LSN_MD5_STEP2( GG, B, C, D, A,  4, 20, 0xE7D3FBC8 );
+			LSN_MD5_STEP2( GG, A, B, C, D,  9,  5, 0x21E1CDE6 );
+			LSN_MD5_STEP2( GG, D, A, B, C, 14,  9, 0xC33707D6 );
+			LSN_MD5_STEP2( GG, C, D, A, B,  3, 14, 0xF4D50D87 );
+			LSN_MD5_STEP2( GG, B, C, D, A,  8, 20, 0x455A14ED );
+			LSN_MD5_STEP2( GG, A, B, C, D, 13,  5, 0xA9E3E905 );
+			LSN_MD5_STEP2( GG, D, A, B, C,  2,  9, 0xFCEFA3F8 );
+			LSN_MD5_STEP2( GG, C, D, A, B,  7, 14, 0x676F02D9 );
+			LSN_MD5_STEP2( GG, B, C, D, A, 12, 20, 0x8D2A4C8A );
+
+			// Round 3
+			LSN_MD5_STEP2( HH, A, B, C, D,  5,  4, 0xFFFA3942 );
+			LSN_MD5_STEP2( HH, D, A, B, C,  8, 11, 0x8771F681 );
+			LSN_MD5_STEP2( HH, C, D, A, B, 11, 16, 0x6D9D6122 );
+			LSN_MD5_STEP2( HH, B, C, D, A, 14, 23, 0xFDE5380C );
+			LSN_MD5_STEP2( HH, A, B, C, D,  1,  4, 0xA4BEEA44 );
+			LSN_MD5_STEP2( HH, D, A, B, C,  4, 11, 0x4BDECFA9 );
+			LSN_MD5_STEP2( HH, C, D, A, B,  7, 16, 0xF6BB4B60 );
+			LSN_MD5_STEP2( HH, B, C, D, A, 10, 23, 0xBEBFBC70 );
+			LSN_MD5_STEP2( HH, A, B, C, D, 13,  4, 0x289B7EC6 );
+			LSN_MD5_STEP2( HH, D, A, B, C,  0, 11, 0xEAA127FA );
+			LSN_MD5_STEP2( HH, C, D, A, B,  3, 16, 0xD4EF3085 );
+			LSN_MD5_STEP2( HH, B, C, D, A,  6, 23, 0x04881D05 );
+			LSN_MD5_STEP2( HH, A, B, C, D,  9,  4, 0xD9D4D039 );
+			LSN_MD5_STEP2( HH, D, A, B, C, 12, 11, 0xE6DB99E5 );
+			LSN_MD5_STEP2( HH, C, D, A, B, 15, 16, 0x1FA27CF8 );
+			LSN_MD5_STEP2( HH, B, C, D, A,  2, 23, 0xC4AC5665 );
+
+			// Round 4
+			LSN_MD5_STEP2( II, A, B, C, D,  0,  6, 0xF4292244 );
+			LSN_MD5_STEP2( II, D, A, B, C,  7, 10, 0x432AFF97 );
+			LSN_MD5_STEP2( II, C, D, A, B, 14, 15, 0xAB9423A7 );
+			LSN_MD5_STEP2( II, B, C, D, A,  5, 21, 0xFC93A039 );
+			LSN_MD5_STEP2( II, A, B, C, D, 12,  6, 0x655B59C3 );
+			LSN_MD5_STEP2( II, D, A, B, C,  3, 10, 0x8F0CCC92 );
+			LSN_MD5_STEP2( II, C, D, A, B, 10, 15, 0xFFEFF47D );
+			LSN_MD5_STEP2( II, B, C, D, A,  1, 21, 0x85845DD1 );
+			LSN_MD5_STEP2( II, A, B, C, D,  8,  6, 0x6FA87E4F );
+			LSN_MD5_STEP2( II, D, A, B, C, 15, 10, 0xFE2CE6E0 );
+			LSN_MD5_STEP2( II, C, D, A, B,  6, 15, 0xA3014314 );
+			LSN_MD5_STEP2( II, B, C, D, A, 13, 21, 0x4E0811A1 );
+			LSN_MD5_STEP2( II, A, B, C, D,  4,  6, 0xF7537E82 );
+			LSN_MD5_STEP2( II, D, A, B, C, 11, 10, 0xBD3AF235 );
+			LSN_MD5_STEP2( II, C, D, A, B,  2, 15, 0x2AD7D2BB );
+			LSN_MD5_STEP2( II, B, C, D, A,  9, 21, 0xEB86D391 );
+#undef LSN_MD5_STEP2
+
+			_pui32StateA[0] += A0;
+			_pui32StateA[1] += B0;
+			_pui32StateA[2] += C0;
+			_pui32StateA[3] += D0;
+			_pui32StateB[0] += A1;
+			_pui32StateB[1] += B1;
+			_pui32StateB[2] += C1;
+			_pui32StateB[3] += D1;
+		}
+
+		/**
+		 * Adds to the bit count.
+		 *
+		 * \param _ui64Bits The number of bits to add.
+		 */
+		void													AddBits( uint64_t _ui64Bits ) {
+			uint64_t ui64Count = (uint64_t( m_ui32Count[1] ) << 32) | m_ui32Count[0];
+			ui64Count += _ui64Bits;
+			m_ui32Count[0] = uint32_t( ui64Count );
+			m_ui32Count[1] = uint32_t( ui64Count >> 32 );
+		}
+
 		/**
 		 * Encodes input (uint32_t) into output (uint8_t). Assumes length is a multiple of 4.
 		 *
@@ -0,0 +1,207 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A user-defined start/stop condition for WAV streaming, written as an expression over the sample value, its index,
+ *	the elapsed time, the number of samples recorded, and memory (APU registers) read with b[]/w[]/u32[]/q[].
+ */
+
+
+#include "LSNWavConditionExp.h"
+
+#include <EEExpEvalLexer.h>
+#include <Gen/EEExpEvalParser.h>
+#include <PreProc/EEPreProc.h>
+#include <sstream>
+
+
+namespace lsn {
+
+	CWavConditionExp::CWavConditionExp() :
+		m_peecContainer( nullptr ),
+		m_pui8Memory( nullptr ),
+		m_ui64MemoryBase( 0 ),
+		m_sMemorySize( 0 ) {
+	}
+	CWavConditionExp::~CWavConditionExp() {
+		Reset();
+	}
+
+	// == Functions.
+	/**
+	 * Parses and compiles an expression.  This is costly, so do it as few times as possible.
+	 *
+	 * \param _sExp The UTF-8 expression.
+	 * \return Returns true if the expression is valid.
+	 */
+	bool CWavConditionExp::SetExpression( const std::string &_sExp ) {
+		Reset();
+
+		ee::CExpEvalLexer * peelLexer = nullptr;
+		ee::CExpEvalParser * peepParser = nullptr;
+		try {
+			// The condition variables are macros over numbered parameters, which the compiled program reads directly.
+			std::string sSrc = "#define sample $" + std::to_string( LSN_P_SAMPLE ) +
+				"\n#define idx $" + std::to_string( LSN_P_INDEX ) +
+				"\n#define time $" + std::to_string( LSN_P_TIME ) +
+				"\n#define count $" + std::to_string( LSN_P_COUNT ) +
+				"\n" + _sExp;
+			std::string sPreProc;
+			ee::CPreProc::EE_MACROS mMacros;
+			if ( ee::CPreProc::PreProcessFile( sSrc, sPreProc, mMacros ) != ee::CPreProc::EE_E_SUCCESS ) { return false; }
+
+			std::istringstream sStream( sPreProc );
+			peelLexer = new( std::nothrow ) ee::CExpEvalLexer( &sStream );
+			if ( !peelLexer ) { return false; }
+			m_peecContainer = new( std::nothrow ) ee::CExpEvalContainer( peelLexer );
+			if ( !m_peecContainer ) { delete peelLexer; return false; }
+			peepParser = new( std::nothrow ) ee::CExpEvalParser( peelLexer, m_peecContainer );
+			if ( !peepParser ) { delete peelLexer; Reset(); return false; }
+			peelLexer->SetContainer( (*m_peecContainer) );
+
+			int iRet = peepParser->parse();
+			m_peecContainer->Parsed();
+			delete peepParser;
+			delete peelLexer;
+			peepParser = nullptr;
+			peelLexer = nullptr;
+			if ( iRet != 0 ) { Reset(); return false; }
+
+			ee::CExpEvalContainer::EE_RESULT rParm;
+			rParm.ncType = ee::EE_NC_UNSIGNED;
+			rParm.u.ui64Val = 0;
+			// Create every parameter up front so that Find() never resizes the parameter list.
+			for ( size_t I = LSN_P_TOTAL; I--; ) {
+				if ( !m_peecContainer->SetNumberedParm( I, rParm ) ) { Reset(); return false; }
+			}
+			m_peecContainer->SetAddressHandler( AddressHandler, reinterpret_cast<uintptr_t>(this) );
+			return true;
+		}
+		catch ( ... ) {
+			delete peepParser;
+			delete peelLexer;
+			Reset();
+			return false;
+		}
+	}
+
+	/**
+	 * Resets the expression back to scratch.
+	 */
+	void CWavConditionExp::Reset() {
+		delete m_peecContainer;
+		m_peecContainer = nullptr;
+	}
+
+	/**
+	 * Finds the first sample in a block for which the expression evaluates to a given truth value.
+	 *
+	 * \param _pfSamples The block of samples.
+	 * \param _sTotal The number of samples in the block.
+	 * \param _ui64Index The absolute index of _pfSamples[0].
+	 * \param _ui64Count The number of samples recorded before _pfSamples[0].  Pass 0 for start conditions.
+	 * \param _bCounting If true, the recorded count advances with each sample tested (stop conditions).
+	 * \param _dHz The sample rate, used to convert indices to time.
+	 * \param _bWant The truth value to find.
+	 * \return Returns the index within the block of the first matching sample, or _sTotal if none match.  A sample for which the
+	 *	expression fails to evaluate is treated as false.
+	 */
+	size_t CWavConditionExp::Find( const float * _pfSamples, size_t _sTotal, uint64_t _ui64Index, uint64_t _ui64Count,
+		bool _bCounting, double _dHz, bool _bWant ) {
+		if LSN_UNLIKELY( !m_peecContainer ) { return _bWant ? _sTotal : 0; }
+		ee::CExpEvalContainer::EE_RESULT rSample, rIndex, rTime, rCount, rRes;
+		rSample.ncType = ee::EE_NC_FLOATING;
+		rIndex.ncType = ee::EE_NC_UNSIGNED;
+		rTime.ncType = ee::EE_NC_FLOATING;
+		rCount.ncType = ee::EE_NC_UNSIGNED;
+		rCount.u.ui64Val = _ui64Count;
+		double dInvHz = _dHz ? 1.0 / _dHz : 0.0;
+		for ( size_t I = 0; I < _sTotal; ++I ) {
+			rSample.u.dVal = _pfSamples[I];
+			rIndex.u.ui64Val = _ui64Index + I;
+			rTime.u.dVal = double( rIndex.u.ui64Val ) * dInvHz;
+			m_peecContainer->SetNumberedParm( LSN_P_SAMPLE, rSample );
+			m_peecContainer->SetNumberedParm( LSN_P_INDEX, rIndex );
+			m_peecContainer->SetNumberedParm( LSN_P_TIME, rTime );
+			m_peecContainer->SetNumberedParm( LSN_P_COUNT, rCount );
+
+			bool bTrue = false;
+			if LSN_LIKELY( m_peecContainer->Resolve( rRes ) ) {
+				switch ( rRes.ncType ) {
+					case ee::EE_NC_SIGNED : {}		LSN_FALLTHROUGH
+					case ee::EE_NC_UNSIGNED : {
+						bTrue = rRes.u.ui64Val != 0;
+						break;
+					}
+					case ee::EE_NC_FLOATING : {
+						bTrue = rRes.u.dVal != 0.0;
+						break;
+					}
+					default : {}
+				}
+			}
+			if ( bTrue == _bWant ) { return I; }
+			if ( _bCounting ) { ++rCount.u.ui64Val; }
+		}
+		return _sTotal;
+	}
+
+	/**
+	 * Checks that an expression is valid without keeping it.
+	 *
+	 * \param _sExp The UTF-8 expression.
+	 * \return Returns true if the expression is valid.
+	 */
+	bool CWavConditionExp::Test( const std::string &_sExp ) {
+		CWavConditionExp wceTmp;
+		return wceTmp.SetExpression( _sExp );
+	}
+
+	/**
+	 * Reads memory for the expression.
+	 *
+	 * \param _ui64Address The address to read.
+	 * \param _tType The type of the read.
+	 * \param _uiptrData Points to the CWavConditionExp object.
+	 * \param _peecContainer The container.
+	 * \param _rResult Receives the value.
+	 * \return Returns true if the address and type are valid.
+	 */
+	bool EE_CALLBACK CWavConditionExp::AddressHandler( uint64_t _ui64Address, ee::EE_CAST_TYPES _tType, uintptr_t _uiptrData,
+		ee::CExpEvalContainer * /*_peecContainer*/, ee::CExpEvalContainer::EE_RESULT &_rResult ) {
+		const CWavConditionExp * pwceThis = reinterpret_cast<const CWavConditionExp *>(_uiptrData);
+		size_t sSize;
+		bool bSigned;
+		switch ( _tType ) {
+			case ee::EE_CT_INT8 : { sSize = 1; bSigned = true; break; }
+			case ee::EE_CT_UINT8 : { sSize = 1; bSigned = false; break; }
+			case ee::EE_CT_INT16 : { sSize = 2; bSigned = true; break; }
+			case ee::EE_CT_UINT16 : { sSize = 2; bSigned = false; break; }
+			case ee::EE_CT_INT32 : { sSize = 4; bSigned = true; break; }
+			case ee::EE_CT_UINT32 : { sSize = 4; bSigned = false; break; }
+			case ee::EE_CT_INT64 : { sSize = 8; bSigned = true; break; }
+			case ee::EE_CT_UINT64 : { sSize = 8; bSigned = false; break; }
+			default : { return false; }
+		}
+		if ( !pwceThis->m_pui8Memory || _ui64Address < pwceThis->m_ui64MemoryBase ) { return false; }
+		uint64_t ui64Offset = _ui64Address - pwceThis->m_ui64MemoryBase;
+		if ( ui64Offset >= pwceThis->m_sMemorySize || pwceThis->m_sMemorySize - ui64Offset < sSize ) { return false; }
+
+		uint64_t ui64Val = 0;
+		for ( size_t I = sSize; I--; ) {
+			ui64Val = (ui64Val << 8) | pwceThis->m_pui8Memory[ui64Offset+I];
+		}
+		if ( bSigned ) {
+			uint32_t ui32Shift = uint32_t( 64 - sSize * 8 );
+			_rResult.ncType = ee::EE_NC_SIGNED;
+			_rResult.u.i64Val = int64_t( ui64Val << ui32Shift ) >> ui32Shift;
+		}
+		else {
+			_rResult.ncType = ee::EE_NC_UNSIGNED;
+			_rResult.u.ui64Val = ui64Val;
+		}
+		return true;
+	}
+
+}	// namespace lsn
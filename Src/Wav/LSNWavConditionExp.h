@@ -0,0 +1,141 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: A user-defined start/stop condition for WAV streaming, written as an expression over the sample value, its index,
+ *	the elapsed time, the number of samples recorded, and memory (APU registers) read with b[]/w[]/u32[]/q[].
+ */
+
+
+#pragma once
+
+#include "../LSNLSpiroNes.h"
+
+#include <EEExpEvalContainer.h>
+#include <string>
+
+
+namespace lsn {
+
+	/**
+	 * Class CWavConditionExp
+	 * \brief A user-defined start/stop condition for WAV streaming.
+	 *
+	 * Description: A user-defined start/stop condition for WAV streaming.  The expression is parsed and compiled once and then
+	 *	evaluated over whole blocks of samples, stopping at the first sample whose result matches the requested truth value.
+	 *
+	 *	The expression can use:
+	 *	sample: The value of the sample being tested.
+	 *	idx: The absolute index of the sample being tested.
+	 *	time: The absolute time of the sample being tested, in seconds.
+	 *	count: The number of samples recorded so far (0 while waiting for the start condition).
+	 *	b[addr] etc.: Memory set via SetMemory(), normally the APU registers at $4000-$4017.
+	 */
+	class CWavConditionExp {
+	public :
+		CWavConditionExp();
+		~CWavConditionExp();
+
+
+		// == Functions.
+		/**
+		 * Parses and compiles an expression.  This is costly, so do it as few times as possible.
+		 *
+		 * \param _sExp The UTF-8 expression.
+		 * \return Returns true if the expression is valid.
+		 */
+		bool												SetExpression( const std::string &_sExp );
+
+		/**
+		 * Resets the expression back to scratch.
+		 */
+		void												Reset();
+
+		/**
+		 * Determines whether an expression has been set.
+		 *
+		 * \return Returns true if SetExpression() succeeded since the last Reset().
+		 */
+		inline bool											Valid() const { return m_peecContainer != nullptr; }
+
+		/**
+		 * Determines whether the expression reads memory.  If not, the memory does not need to be tracked.
+		 *
+		 * \return Returns true if the expression contains an address read.
+		 */
+		inline bool											ReadsMemory() const { return m_peecContainer && m_peecContainer->HasAddressRead(); }
+
+		/**
+		 * Sets the memory that address reads in the expression will access.
+		 *
+		 * \param _pui8Memory The memory, or nullptr to make address reads fail.  Must remain valid while the expression is used.
+		 * \param _ui64Base The address of _pui8Memory[0].
+		 * \param _sSize The number of bytes at _pui8Memory.
+		 */
+		inline void											SetMemory( const uint8_t * _pui8Memory, uint64_t _ui64Base, size_t _sSize ) {
+			m_pui8Memory = _pui8Memory;
+			m_ui64MemoryBase = _ui64Base;
+			m_sMemorySize = _sSize;
+		}
+
+		/**
+		 * Finds the first sample in a block for which the expression evaluates to a given truth value.
+		 *
+		 * \param _pfSamples The block of samples.
+		 * \param _sTotal The number of samples in the block.
+		 * \param _ui64Index The absolute index of _pfSamples[0].
+		 * \param _ui64Count The number of samples recorded before _pfSamples[0].  Pass 0 for start conditions.
+		 * \param _bCounting If true, the recorded count advances with each sample tested (stop conditions).
+		 * \param _dHz The sample rate, used to convert indices to time.
+		 * \param _bWant The truth value to find.
+		 * \return Returns the index within the block of the first matching sample, or _sTotal if none match.  A sample for which the
+		 *	expression fails to evaluate is treated as false.
+		 */
+		size_t												Find( const float * _pfSamples, size_t _sTotal, uint64_t _ui64Index, uint64_t _ui64Count,
+			bool _bCounting, double _dHz, bool _bWant );
+
+		/**
+		 * Checks that an expression is valid without keeping it.
+		 *
+		 * \param _sExp The UTF-8 expression.
+		 * \return Returns true if the expression is valid.
+		 */
+		static bool											Test( const std::string &_sExp );
+
+
+	protected :
+		// == Enumerations.
+		/** The numbered parameters behind the condition variables. */
+		enum LSN_PARMS : size_t {
+			LSN_P_SAMPLE,																	/**< sample. */
+			LSN_P_INDEX,																	/**< idx. */
+			LSN_P_TIME,																		/**< time. */
+			LSN_P_COUNT,																	/**< count. */
+			LSN_P_TOTAL,
+		};
+
+
+		// == Members.
+		ee::CExpEvalContainer *								m_peecContainer;				/**< Holds the parsed and compiled expression. */
+		const uint8_t *										m_pui8Memory;					/**< The memory read by address reads. */
+		uint64_t											m_ui64MemoryBase;				/**< The address of m_pui8Memory[0]. */
+		size_t												m_sMemorySize;					/**< The number of bytes at m_pui8Memory. */
+
+
+		// == Functions.
+		/**
+		 * Reads memory for the expression.
+		 *
+		 * \param _ui64Address The address to read.
+		 * \param _tType The type of the read.
+		 * \param _uiptrData Points to the CWavConditionExp object.
+		 * \param _peecContainer The container.
+		 * \param _rResult Receives the value.
+		 * \return Returns true if the address and type are valid.
+		 */
+		static bool EE_CALLBACK								AddressHandler( uint64_t _ui64Address, ee::EE_CAST_TYPES _tType, uintptr_t _uiptrData,
+			ee::CExpEvalContainer * _peecContainer, ee::CExpEvalContainer::EE_RESULT &_rResult );
+	};
+
+}	// namespace lsn
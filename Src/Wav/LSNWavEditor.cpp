@@ -9,9 +9,10 @@
 #include "LSNWavEditor.h"
 #include "../Audio/LSNAudio.h"
 #include "../Audio/LSNHpfFilter.h"
+#include "../Audio/LSNLoudnessMeter.h"
 #include "../Audio/LSNPoleFilter.h"
 #include "../Utilities/LSNAlignmentAllocator.h"
-#include "../Utilities/LSNLargeVector.h"
+#include "../Utilities/LSNLargeVectorMapped.h"
 #include "../Utilities/LSNStream.h"
 
 #include <EEExpEval.h>
@@ -31,12 +32,14 @@ namespace lsn {
 
 	// == Functions.
 	/**
-	 * Executes the conversion operations.
+	 * Executes the conversion operations.  File sets are independent, so when _epParms allows more than 1 thread they are
+	 *	processed by a bounded worker pool.  The .BAT and metadata outputs are always assembled in track order.
 	 * 
 	 * \param _wsMsg The error message upon failure.
+	 * \param _epParms Scheduling parameters (thread count, memory budget, and progress reporting).
 	 * \return Returns true if the operation completes successfully.  If false, _wsMsg contains the reason for failure.
 	 **/
-	bool CWavEditor::Execute( std::wstring &_wsMsg ) {
+	bool CWavEditor::Execute( std::wstring &_wsMsg, const LSN_EXECUTE_PARMS &_epParms ) {
 		if ( !m_vFileList.size() ) { return true; }																	// Nothing to do.
 
 		try {
@@ -48,9 +51,9 @@ namespace lsn {
 		}
 
 		try {
-			std::wstring wsMeta, wsBatFile;
-			std::wstring wsBatName;
-			size_t sIdx = 0;
+			LSN_EXECUTE_STATE esState;
+			esState.pepParms = &_epParms;
+			esState.vJobs.resize( m_vFileList.size() );
 			for ( size_t I = 0; I < m_vFileList.size(); ++I ) {
 				LSN_PER_FILE pfFindMe;
 				pfFindMe.ui32Id = m_vFileList[I];
@@ -60,22 +63,43 @@ namespace lsn {
 					_wsMsg = LSN_LSTR( LSN_INTERNAL_ERROR );
 					return false;
 				}
-				if ( !DoFile( (*pwfsSet), (*aPerFile), m_oOutput, sIdx, m_vFileList.size(), _wsMsg, wsBatFile, wsMeta ) ) { return false; }
-				if ( wsBatName.empty() ) {
-					if ( aPerFile->wsAlbum.size() ) {
-						wsBatName = CUtilities::FixFile( aPerFile->wsAlbum );
-					}
-				}
-				if ( m_oOutput.bNumbered && !wsBatFile.empty() ) {
-					WriteBat( L"Tmp.bat", wsBatFile, _wsMsg );
+				esState.vJobs[I].pwfsSet = pwfsSet;
+				esState.vJobs[I].ppfFile = &(*aPerFile);
+				esState.vJobs[I].ui64Memory = EstimateJobMemory( (*pwfsSet), (*aPerFile), m_oOutput );
+			}
+
+			size_t stThreads = _epParms.stThreads;
+			if ( !stThreads ) { stThreads = std::max<size_t>( std::thread::hardware_concurrency(), 1 ); }
+			stThreads = std::min( stThreads, esState.vJobs.size() );
+
+			// The calling thread is always one of the workers.
+			std::vector<std::thread> vThreads;
+			try {
+				vThreads.reserve( stThreads - 1 );
+				for ( size_t I = 1; I < stThreads; ++I ) {
+					vThreads.emplace_back( &CWavEditor::ExecuteWorker, this, std::ref( esState ) );
 				}
-				if ( !wsMeta.empty() ) {
-					WriteMetadata( L"Tmp.txt", wsMeta, _wsMsg );
+			}
+			catch ( ... ) {}																							// Run with however many threads could be made.
+			ExecuteWorker( esState );
+			for ( auto & T : vThreads ) {
+				T.join();
+			}
+
+			if ( esState.aFailed ) {
+				// Report the first failure in track order.
+				for ( size_t I = 0; I < esState.vJobs.size(); ++I ) {
+					if ( esState.vJobs[I].bDone && !esState.vJobs[I].bSuccess ) {
+						_wsMsg = esState.vJobs[I].wsMsg;
+						break;
+					}
 				}
+				if ( _wsMsg.empty() ) { _wsMsg = LSN_LSTR( LSN_INTERNAL_ERROR ); }
+				return false;
 			}
 
-			if ( m_oOutput.bNumbered && !wsBatFile.empty() ) {
-				if ( !WriteBat( wsBatName, wsBatFile, _wsMsg ) ) { return false; }
+			if ( m_oOutput.bNumbered && !esState.wsBatFile.empty() ) {
+				if ( !WriteBat( esState.wsBatName, esState.wsBatFile, _wsMsg ) ) { return false; }
 				try {
 					auto pDeleteMe = std::filesystem::path( m_oOutput.wsFolder );
 					pDeleteMe /= L"Tmp.bat.bat";
@@ -83,8 +107,8 @@ namespace lsn {
 				}
 				catch ( ... ) {}
 			}
-			if ( !wsMeta.empty() ) {
-				if ( !WriteMetadata( L"Tracks.txt", wsMeta, _wsMsg ) ) { return false; }
+			if ( !esState.wsMetadata.empty() ) {
+				if ( !WriteMetadata( L"Tracks.txt", esState.wsMetadata, _wsMsg ) ) { return false; }
 				try {
 					auto pDeleteMe = std::filesystem::path( m_oOutput.wsFolder );
 					pDeleteMe /= L"Tmp.txt";
@@ -100,6 +124,119 @@ namespace lsn {
 		return true;
 	}
 
+	/**
+	 * Estimates the peak number of bytes of RAM DoFile() will use for a given file set.  Used to throttle parallel execution.
+	 * 
+	 * \param _wfsSet The file set.
+	 * \param _pfFile The per-file data settings.
+	 * \param _oOutput The output settings.
+	 * \return Returns the estimated peak RAM usage in bytes.
+	 **/
+	uint64_t CWavEditor::EstimateJobMemory( const LSN_WAV_FILE_SET &_wfsSet, const LSN_PER_FILE &_pfFile, const LSN_OUTPUT &_oOutput ) {
+		const double dSrcHz = double( _wfsSet.wfFile.fcFormat.uiSampleRate );
+		const double dActualHz = _pfFile.dActualHz ? _pfFile.dActualHz : dSrcHz;
+		const uint64_t ui64SrcChans = std::max<uint64_t>( _wfsSet.wfFile.fcFormat.uiNumChannels, 1 );
+		const uint64_t ui64OutChans = (_oOutput.i32Channels == LSN_C_MONO) ? 1 : 2;
+		const uint64_t ui64Chans = std::max( ui64SrcChans, ui64OutChans );
+
+		// Length of the clip at the source rate and of the final track in seconds.
+		double dSrcSecs = std::max( _pfFile.dStopTime - _pfFile.dStartTime, 0.0 );
+		double dSecs = dSrcHz ? dSrcSecs * dSrcHz / dActualHz : dSrcSecs;
+		if ( _pfFile.bLoop ) { dSecs += _pfFile.dDelayTime + _pfFile.dFadeTime; }
+		dSecs += _pfFile.dOpeningSilence + _pfFile.dTrailingSilence;
+		const uint64_t ui64SrcSamples = uint64_t( std::ceil( dSecs * dActualHz ) );
+		const uint64_t ui64OutSamples = uint64_t( std::ceil( dSecs * _oOutput.ui32Hz ) );
+
+		// Each large_vector_mapped keeps at most 32 megabytes mapped at a time.
+		const uint64_t ui64LargeVec = std::min<uint64_t>( 32 * 1024 * 1024, ui64SrcSamples * sizeof( double ) );
+		uint64_t ui64Total = ui64LargeVec * ui64Chans;
+		// The raw source data for the clipped range is loaded before being converted.
+		ui64Total += ui64SrcSamples * ui64SrcChans * std::max<uint64_t>( _wfsSet.wfFile.fcFormat.uiBitsPerSample / 8, 1 );
+		// The 4x oversampled std::vector<double> plus the 2x copy made while down-sampling it.
+		ui64Total += ui64OutSamples * 4 * sizeof( double ) + ui64OutSamples * 2 * sizeof( double );
+		// The final PCM buffer built by SaveAsPcm().
+		ui64Total += ui64OutSamples * ui64OutChans * std::max<uint64_t>( _oOutput.ui16Bits / 8, 1 );
+		return ui64Total;
+	}
+
+	/**
+	 * The Execute() worker.  Pulls jobs in order until none are left or a job fails.  Also run on the calling thread.
+	 * 
+	 * \param _esState The shared execution state.
+	 **/
+	void CWavEditor::ExecuteWorker( LSN_EXECUTE_STATE &_esState ) {
+		const size_t stTotal = _esState.vJobs.size();
+		const uint64_t ui64Budget = _esState.pepParms->ui64MemoryBudget;
+		while ( !_esState.aFailed ) {
+			size_t stJob = _esState.aNextJob.fetch_add( 1 );
+			if ( stJob >= stTotal ) { break; }
+			LSN_JOB & jJob = _esState.vJobs[stJob];
+
+			// Wait for room in the memory budget.  A job is always allowed to run if nothing else is running.
+			if ( ui64Budget ) {
+				std::unique_lock<std::mutex> ulLock( _esState.mMutex );
+				if ( _esState.ui64InFlight && _esState.ui64InFlight + jJob.ui64Memory > ui64Budget ) {
+					ReportProgress( _esState.pepParms, stJob, stTotal, LSN_JS_WAITING );
+					_esState.cvMemory.wait( ulLock, [&]() {
+						return _esState.aFailed || !_esState.ui64InFlight || _esState.ui64InFlight + jJob.ui64Memory <= ui64Budget;
+					} );
+				}
+				if ( _esState.aFailed ) { break; }
+				_esState.ui64InFlight += jJob.ui64Memory;
+			}
+
+			size_t stIdx = stJob;
+			bool bSuccess = false;
+			try {
+				bSuccess = DoFile( (*jJob.pwfsSet), (*jJob.ppfFile), m_oOutput, stIdx, stTotal, jJob.wsMsg, jJob.wsBatFile, jJob.wsMetadata, _esState.pepParms );
+			}
+			catch ( ... ) {
+				jJob.wsMsg = LSN_LSTR( LSN_OUT_OF_MEMORY );
+			}
+			ReportProgress( _esState.pepParms, stJob, stTotal, bSuccess ? LSN_JS_DONE : LSN_JS_FAILED, 1.0 );
+
+			{
+				std::lock_guard<std::mutex> lgLock( _esState.mMutex );
+				jJob.bDone = true;
+				jJob.bSuccess = bSuccess;
+				if ( ui64Budget ) { _esState.ui64InFlight -= jJob.ui64Memory; }
+				if ( !bSuccess ) { _esState.aFailed = true; }
+				else { FlushFinishedJobs( _esState ); }
+			}
+			if ( ui64Budget ) { _esState.cvMemory.notify_all(); }
+		}
+	}
+
+	/**
+	 * Appends the output of every finished job at the front of the queue to the totals and writes the temporary .BAT/metadata files.
+	 *	Must be called with _esState.mMutex locked.
+	 * 
+	 * \param _esState The shared execution state.
+	 **/
+	void CWavEditor::FlushFinishedJobs( LSN_EXECUTE_STATE &_esState ) {
+		bool bFlushed = false;
+		while ( _esState.stFlushed < _esState.vJobs.size() && _esState.vJobs[_esState.stFlushed].bDone && _esState.vJobs[_esState.stFlushed].bSuccess ) {
+			LSN_JOB & jJob = _esState.vJobs[_esState.stFlushed++];
+			_esState.wsBatFile += jJob.wsBatFile;
+			_esState.wsMetadata += jJob.wsMetadata;
+			if ( _esState.wsBatName.empty() && jJob.ppfFile->wsAlbum.size() ) {
+				_esState.wsBatName = CUtilities::FixFile( jJob.ppfFile->wsAlbum );
+			}
+			jJob.wsBatFile.clear();
+			jJob.wsMetadata.clear();
+			bFlushed = true;
+		}
+		if ( bFlushed ) {
+			std::wstring wsIgnored;
+			if ( m_oOutput.bNumbered && !_esState.wsBatFile.empty() ) {
+				WriteBat( L"Tmp.bat", _esState.wsBatFile, wsIgnored );
+			}
+			if ( !_esState.wsMetadata.empty() ) {
+				WriteMetadata( L"Tmp.txt", _esState.wsMetadata, wsIgnored );
+			}
+		}
+	}
+
 	/**
 	 * Adds a WAV file.  Automatically detects file sequences and metadata files.
 	 * 
@@ -356,13 +493,15 @@ namespace lsn {
 	 * \param _wsMsg Error message upon failure.
 	 * \param _wsBatFile The contents of a .BAT file for creating videos.
 	 * \param _wsMetadata The contents of a .TXT file containing information about each track.
+	 * \param _pepParms Optional scheduling parameters used for progress reporting.
 	 * \return Returns true if the file was created.  If false is returned, _wsMsg will be filled with error text.
 	 **/
 	bool CWavEditor::DoFile( const LSN_WAV_FILE_SET &_wfsSet, const LSN_PER_FILE &_pfFile, const LSN_OUTPUT &_oOutput, size_t &_stIdx, size_t _sTotal, std::wstring &_wsMsg,
-		std::wstring &_wsBatFile, std::wstring &_wsMetadata ) {
+		std::wstring &_wsBatFile, std::wstring &_wsMetadata, const LSN_EXECUTE_PARMS * _pepParms ) {
 		CUtilities::LSN_FEROUNDMODE frmMode( FE_TONEAREST );
+		ReportProgress( _pepParms, _stIdx, _sTotal, LSN_JS_LOADING );
 
-		using large_vec = large_vector<double, CAlignmentAllocator<double, 64>>;
+		using large_vec = large_vector_mapped<double, CAlignmentAllocator<double, 64>>;
 		// Determine the sample range to load.
 		double dStartTime = _pfFile.dStartTime;
 		double dStopTime = _pfFile.dStopTime;
@@ -454,8 +593,26 @@ namespace lsn {
 		dFadeStart += _pfFile.dOpeningSilence;
 
 		double dFileVol = 1.0;
+		// Loudness analysis rides along with the last pass over each channel (or the mono mix-down) instead of taking its own.
+		bool bMeter = _oOutput.i32VolType != LSN_VT_ABS;
+		bool bMixDown = _oOutput.i32Channels != LSN_C_STEREO && _oOutput.i32Channels != LSN_C_SURROUND && vSamples.size() > 1;
+		// Surround inverts the right side.  It has to happen before metering so that the meters see the samples that get written.
+		bool bSurround = _oOutput.i32Channels == LSN_C_SURROUND;
+		std::vector<CLoudnessMeter> vMeters;
+		std::vector<double> vMeterBlock;
+		try {
+			if ( bMeter ) {
+				vMeters.resize( bMixDown ? 1 : vSamples.size() );
+				vMeterBlock.resize( LSN_METER_BLOCK );
+			}
+		}
+		catch ( ... ) {
+			_wsMsg = LSN_LSTR( LSN_OUT_OF_MEMORY );
+			return false;
+		}
 		// For each channel.
 		for ( size_t J = 0; J < vSamples.size(); ++J ) {
+			ReportProgress( _pepParms, _stIdx, _sTotal, LSN_JS_PROCESSING, double( J ) / double( vSamples.size() ) );
 			vSamples[J].resize( size_t( sEndSample ) );
 
 			if ( _pfFile.sstStartMod == LSN_SST_SNAP && vSamples[J].size() >= 2 ) {
@@ -762,8 +919,23 @@ namespace lsn {
 				if ( _pfFile.bInvert ) {
 					dFileVol *= -1.0;
 				}
-				for ( size_t I = 0; I < sMax; ++I ) {
-					vThis[I] *= dFileVol;
+				if ( bSurround && J == 1 ) {
+					dFileVol *= -1.0;
+				}
+				if ( bMeter && !bMixDown ) {
+					vMeters[J].Reset( double( _oOutput.ui32Hz ) );
+					for ( size_t I = 0; I < sMax; I += LSN_METER_BLOCK ) {
+						size_t sTotal = std::min<size_t>( LSN_METER_BLOCK, sMax - I );
+						for ( size_t K = 0; K < sTotal; ++K ) {
+							vMeterBlock[K] = vThis[I+K] *= dFileVol;
+						}
+						if ( !vMeters[J].Process( vMeterBlock.data(), sTotal ) ) { throw std::bad_alloc(); }
+					}
+				}
+				else {
+					for ( size_t I = 0; I < sMax; ++I ) {
+						vThis[I] *= dFileVol;
+					}
 				}
 			}
 			catch ( ... ) {
@@ -783,8 +955,26 @@ namespace lsn {
 							vSamples.push_back( large_vec( 32 * 1024 * 1024 / sizeof( double ), 0 ) );
 							vSamples[1].resize( vSamples[0].size() );
 							size_t sSamples = vSamples[0].size();
-							for ( size_t I = 0; I < sSamples; ++I ) {
-								vSamples[1][I] = vSamples[0][I];
+							if ( bSurround ) {
+								// The right side is inverted, so it gets its own meter.
+								if ( bMeter ) {
+									vMeters.push_back( CLoudnessMeter() );
+									vMeters[1].Reset( double( _oOutput.ui32Hz ) );
+								}
+								for ( size_t I = 0; I < sSamples; I += LSN_METER_BLOCK ) {
+									size_t sTotal = std::min<size_t>( LSN_METER_BLOCK, sSamples - I );
+									for ( size_t K = 0; K < sTotal; ++K ) {
+										vSamples[1][I+K] = -vSamples[0][I+K];
+										if ( bMeter ) { vMeterBlock[K] = vSamples[1][I+K]; }
+									}
+									if ( bMeter && !vMeters[1].Process( vMeterBlock.data(), sTotal ) ) { throw std::bad_alloc(); }
+								}
+							}
+							else {
+								for ( size_t I = 0; I < sSamples; ++I ) {
+									vSamples[1][I] = vSamples[0][I];
+								}
+								if ( bMeter ) { vMeters.push_back( vMeters[0] ); }
 							}
 						}
 						catch ( ... ) {
@@ -799,13 +989,6 @@ namespace lsn {
 						return false;
 					}
 				}
-				if ( _oOutput.i32Channels == 3 ) {
-					// Surround.  Invert the right side.
-					size_t sSamples = vSamples[1].size();
-					for ( size_t I = 0; I < sSamples; ++I ) {
-						vSamples[1][I] = -vSamples[1][I];
-					}
-				}
 				break;
 			}
 			default : {
@@ -813,12 +996,21 @@ namespace lsn {
 				if ( vSamples.size() > 1 ) {
 					size_t sSamples = vSamples[0].size();
 					double dChans = double( vSamples.size() );
-					for ( size_t I = 0; I < sSamples; ++I ) {
-						double dThis = vSamples[0][I];
-						for ( size_t J = 1; J < vSamples.size(); ++J ) {
-							dThis += vSamples[J][I];
+					if ( bMeter ) { vMeters[0].Reset( double( _oOutput.ui32Hz ) ); }
+					for ( size_t I = 0; I < sSamples; I += LSN_METER_BLOCK ) {
+						size_t sTotal = std::min<size_t>( LSN_METER_BLOCK, sSamples - I );
+						for ( size_t K = 0; K < sTotal; ++K ) {
+							double dThis = vSamples[0][I+K];
+							for ( size_t J = 1; J < vSamples.size(); ++J ) {
+								dThis += vSamples[J][I+K];
+							}
+							vSamples[0][I+K] = dThis / dChans;
+							if ( bMeter ) { vMeterBlock[K] = dThis / dChans; }
+						}
+						if ( bMeter && !vMeters[0].Process( vMeterBlock.data(), sTotal ) ) {
+							_wsMsg = LSN_LSTR( LSN_OUT_OF_MEMORY );
+							return false;
 						}
-						vSamples[0][I] = dThis / dChans;
 					}
 					while ( vSamples.size() != 1 ) { vSamples.pop_back(); }
 					//vSamples.resize( 1 );
@@ -836,10 +1028,8 @@ namespace lsn {
 			}
 			case LSN_VT_NORM : {
 				double dMax = 0.0;
-				for ( auto J = vSamples.size(); J--; ) {
-					double dChannelMax = ee::CExpEval::MaxVec<large_vec>( vSamples[J] );
-
-					dMax = std::max( dMax, dChannelMax );
+				for ( auto J = vMeters.size(); J--; ) {
+					dMax = std::max( dMax, vMeters[J].SamplePeak() );
 				}
 				if ( dMax != 0.0 ) {
 					dApplyVol = 1.0 / dMax * _oOutput.dNormalizeTo;
@@ -849,7 +1039,8 @@ namespace lsn {
 			case LSN_VT_LOUDNESS : {
 				double dMax = 0.0;
 				for ( auto J = vSamples.size(); J--; ) {
-					double dChannelMax = ee::CExpEval::CalcRmsGated<large_vec>( vSamples[J], 0.1 );
+					// The meter already has the mean, so the gate needs only 1 pass.
+					double dChannelMax = CLoudnessMeter::CalcRmsGated<large_vec>( vSamples[J], vMeters[J].Mean(), 0.1 );
 
 					dMax = std::max( dMax, dChannelMax );
 				}
@@ -858,6 +1049,21 @@ namespace lsn {
 				}
 				break;
 			}
+			case LSN_VT_LUFS : {
+				double dLufs = CLoudnessMeter::IntegratedLoudness( vMeters.data(), vMeters.size() );
+				if ( std::isfinite( dLufs ) ) {
+					dApplyVol = std::pow( 10.0, (_oOutput.dLufs - dLufs) / 20.0 );
+					// Keep the true peak under the ceiling.
+					double dPeak = 0.0;
+					for ( auto J = vMeters.size(); J--; ) {
+						dPeak = std::max( dPeak, vMeters[J].TruePeak() );
+					}
+					if ( dPeak * dApplyVol > _oOutput.dTruePeakCeiling ) {
+						dApplyVol = _oOutput.dTruePeakCeiling / dPeak;
+					}
+				}
+				break;
+			}
 		}
 		for ( auto J = vSamples.size(); J--; ) {
 			for ( auto I = vSamples[J].size(); I--; ) {
@@ -903,6 +1109,7 @@ namespace lsn {
 		sdData.uiBitsPerSample = _oOutput.ui16Bits;
 		sdData.uiHz = _oOutput.ui32Hz;
 		sdData.bDither = _oOutput.bDither;
+		ReportProgress( _pepParms, _stIdx, _sTotal, LSN_JS_SAVING );
 		if ( !wfFile.SaveAsPcm( pPath.generic_u8string().c_str(), vSamples, &sdData ) ) {
 			_wsMsg = std::format( LSN_LSTR( LSN_WE_FAILED_TO_SAVE_WAV ), _wfsSet.wfFile.wsPath );
 			return false;
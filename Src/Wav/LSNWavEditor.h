@@ -16,11 +16,14 @@
 #include "LSNWavFile.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <filesystem>
 #include <format>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 
@@ -91,10 +94,40 @@ namespace lsn {
 			LSN_VT_ABS,
 			LSN_VT_NORM,
 			LSN_VT_LOUDNESS,
+			LSN_VT_LUFS,																								/**< EBU R128 integrated loudness with a true-peak ceiling. */
+		};
+
+		/** Job states passed to the progress callback. */
+		enum LSN_JOB_STATE {
+			LSN_JS_WAITING,																								/**< The job is waiting for room in the memory budget. */
+			LSN_JS_LOADING,																								/**< The source samples are being loaded. */
+			LSN_JS_PROCESSING,																							/**< The channels are being filtered/resampled. */
+			LSN_JS_SAVING,																								/**< The final WAV is being written. */
+			LSN_JS_DONE,																								/**< The job finished successfully. */
+			LSN_JS_FAILED,																								/**< The job failed or was cancelled due to another job failing. */
 		};
 
 
 		// == Types.
+		/**
+		 * Per-job progress callback.  Called from worker threads when Execute() runs in parallel, so it must be thread-safe.
+		 *
+		 * \param _pvParm The user parameter from LSN_EXECUTE_PARMS::pvProgressParm.
+		 * \param _stJob The index of the job (track) being reported.
+		 * \param _stTotal The total number of jobs.
+		 * \param _jsState The new state of the job.
+		 * \param _dProgress The progress within the state, from 0.0 to 1.0.
+		 **/
+		typedef void (LSN_STDCALL *									PfJobProgress)( void * _pvParm, size_t _stJob, size_t _stTotal, LSN_JOB_STATE _jsState, double _dProgress );
+
+		/** Parameters controlling how Execute() schedules its jobs. */
+		struct LSN_EXECUTE_PARMS {
+			size_t														stThreads = 1;									/**< Maximum number of files to process at once.  0 = one per hardware thread.  1 = run serially on the calling thread. */
+			uint64_t													ui64MemoryBudget = 0;							/**< The estimated number of bytes all in-flight jobs may use together.  0 = unlimited.  A job larger than the budget runs alone. */
+			PfJobProgress												pfProgress = nullptr;							/**< Optional per-job progress callback. */
+			void *														pvProgressParm = nullptr;						/**< The user parameter passed to pfProgress. */
+		};
+
 		/** Per-file data. */
 		struct LSN_PER_FILE {
 			double														dStartTime = 0.0;								/**< The starting point in the file.  Used for clipping and the start of the music. */
@@ -150,6 +183,8 @@ namespace lsn {
 			double														dAbsoluteVol = 5.0;								/**< Absolute volume. */
 			double														dNormalizeTo = std::pow( 10, -5.5 / 20.0 );		/**< Normalize-to level. */
 			double														dLoudness = std::pow( 10, -5.5 / 20.0 );		/**< Loudness level. */
+			double														dLufs = -16.0;									/**< Integrated loudness target in LUFS (LSN_VT_LUFS). */
+			double														dTruePeakCeiling = std::pow( 10, -1.0 / 20.0 );	/**< The highest true peak allowed by LSN_VT_LUFS. */
 			double														dMainsHumVol = 1.0;								/**< Mains Hum volume. */
 			double														dWhiteNoiseVol = 1.0;							/**< White Noise volume. */
 			double														dWhiteNoiseTemp = 290.0;						/**< White-noise temperature. */
@@ -260,12 +295,24 @@ namespace lsn {
 
 		// == Functions.
 		/**
-		 * Executes the conversion operations.
+		 * Executes the conversion operations.  File sets are independent, so when _epParms allows more than 1 thread they are
+		 *	processed by a bounded worker pool.  The .BAT and metadata outputs are always assembled in track order.
 		 * 
 		 * \param _wsMsg The error message upon failure.
+		 * \param _epParms Scheduling parameters (thread count, memory budget, and progress reporting).
 		 * \return Returns true if the operation completes successfully.  If false, _wsMsg contains the reason for failure.
 		 **/
-		bool															Execute( std::wstring &_wsMsg );
+		bool															Execute( std::wstring &_wsMsg, const LSN_EXECUTE_PARMS &_epParms = LSN_EXECUTE_PARMS() );
+
+		/**
+		 * Estimates the peak number of bytes of RAM DoFile() will use for a given file set.  Used to throttle parallel execution.
+		 * 
+		 * \param _wfsSet The file set.
+		 * \param _pfFile The per-file data settings.
+		 * \param _oOutput The output settings.
+		 * \return Returns the estimated peak RAM usage in bytes.
+		 **/
+		static uint64_t													EstimateJobMemory( const LSN_WAV_FILE_SET &_wfsSet, const LSN_PER_FILE &_pfFile, const LSN_OUTPUT &_oOutput );
 
 		/**
 		 * Adds a WAV file.  Automatically detects file sequences and metadata files.
@@ -352,6 +399,41 @@ namespace lsn {
 
 
 	protected :
+		// == Enumerations.
+		enum : size_t {
+			LSN_METER_BLOCK												= 1 << 20,										/**< Samples handed to the loudness meters at a time. */
+		};
+
+
+		// == Types.
+		/** A single job in Execute(). */
+		struct LSN_JOB {
+			const LSN_WAV_FILE_SET *									pwfsSet = nullptr;								/**< The file set to process. */
+			const LSN_PER_FILE *										ppfFile = nullptr;								/**< The per-file settings. */
+			uint64_t													ui64Memory = 0;									/**< Estimated peak RAM usage. */
+			std::wstring												wsBatFile;										/**< This job's .BAT lines. */
+			std::wstring												wsMetadata;										/**< This job's metadata text. */
+			std::wstring												wsMsg;											/**< This job's error message. */
+			bool														bDone = false;									/**< Set when the job has finished (successfully or not). */
+			bool														bSuccess = false;								/**< Set when the job has finished successfully. */
+		};
+
+		/** State shared between the Execute() workers. */
+		struct LSN_EXECUTE_STATE {
+			std::vector<LSN_JOB>										vJobs;											/**< The jobs, in track order. */
+			const LSN_EXECUTE_PARMS *									pepParms = nullptr;								/**< The scheduling parameters. */
+			std::mutex													mMutex;											/**< Protects everything below. */
+			std::condition_variable										cvMemory;										/**< Signalled when memory is released back to the budget. */
+			std::atomic<size_t>											aNextJob = 0;									/**< The next job to hand out. */
+			std::atomic<bool>											aFailed = false;								/**< Set when any job fails; stops new jobs from starting. */
+			uint64_t													ui64InFlight = 0;								/**< Estimated RAM held by running jobs. */
+			size_t														stFlushed = 0;									/**< Number of leading jobs whose output has been appended to the totals. */
+			std::wstring												wsBatFile;										/**< The accumulated .BAT file. */
+			std::wstring												wsMetadata;										/**< The accumulated metadata. */
+			std::wstring												wsBatName;										/**< The .BAT file name (from the first album name). */
+		};
+
+
 		// == Members.
 		/** The per-file set. */
 		std::set<LSN_PER_FILE>											m_sPerFile;
@@ -396,10 +478,41 @@ namespace lsn {
 		 * \param _wsMsg Error message upon failure.
 		 * \param _wsBatFile The contents of a .BAT file for creating videos.
 		 * \param _wsMetadata The contents of a .TXT file containing information about each track.
+		 * \param _pepParms Optional scheduling parameters used for progress reporting.
 		 * \return Returns true if the file was created.  If false is returned, _wsMsg will be filled with error text.
 		 **/
 		bool															DoFile( const LSN_WAV_FILE_SET &_wfsSet, const LSN_PER_FILE &_pfFile, const LSN_OUTPUT &_oOutput, size_t &_stIdx, size_t _sTotal, std::wstring &_wsMsg,
-			std::wstring &_wsBatFile, std::wstring &_wsMetadata );
+			std::wstring &_wsBatFile, std::wstring &_wsMetadata, const LSN_EXECUTE_PARMS * _pepParms = nullptr );
+
+		/**
+		 * The Execute() worker.  Pulls jobs in order until none are left or a job fails.  Also run on the calling thread.
+		 * 
+		 * \param _esState The shared execution state.
+		 **/
+		void															ExecuteWorker( LSN_EXECUTE_STATE &_esState );
+
+		/**
+		 * Appends the output of every finished job at the front of the queue to the totals and writes the temporary .BAT/metadata files.
+		 *	Must be called with _esState.mMutex locked.
+		 * 
+		 * \param _esState The shared execution state.
+		 **/
+		void															FlushFinishedJobs( LSN_EXECUTE_STATE &_esState );
+
+		/**
+		 * Reports job progress if a callback is set.
+		 * 
+		 * \param _pepParms The scheduling parameters or nullptr.
+		 * \param _stJob The index of the job.
+		 * \param _stTotal The total number of jobs.
+		 * \param _jsState The new state of the job.
+		 * \param _dProgress The progress within the state, from 0.0 to 1.0.
+		 **/
+		static inline void												ReportProgress( const LSN_EXECUTE_PARMS * _pepParms, size_t _stJob, size_t _stTotal, LSN_JOB_STATE _jsState, double _dProgress = 0.0 ) {
+			if ( _pepParms && _pepParms->pfProgress ) {
+				_pepParms->pfProgress( _pepParms->pvProgressParm, _stJob, _stTotal, _jsState, _dProgress );
+			}
+		}
 
 		/**
 		 * Writes the BAT data to a given file.
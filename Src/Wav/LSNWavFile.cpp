@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <codecvt>
+#include <cstring>
 #include <filesystem>
 #include <string>
 
@@ -362,26 +363,27 @@ namespace lsn {
 
 		std::unique_lock<std::mutex> ulLock( m_sStream.mMutex );
 		
+		m_sStream.wceStartExp.Reset();
+		m_sStream.wceEndExp.Reset();
 		switch ( _stfoFileOptions.scStartCondition ) {
-			case LSN_SC_NONE : {
-				m_sStream.pfStartCondFunc = &CWavFile::StartCondFunc_None;
-				break;
-			}
+			case LSN_SC_NONE : { break; }
 			case LSN_SC_START_AT_SAMPLE : {
-				m_sStream.pfStartCondFunc = &CWavFile::StartCondFunc_StartAtSample;
 				m_sStream.cdStartData.ui64Parm0 = scpStartParm.ui64Parm;
 				break;
 			}
-			case LSN_SC_FIRST_NON_ZERO : {
-				m_sStream.pfStartCondFunc = &CWavFile::StartCondFunc_FirstNonZero;
-				break;
-			}
+			case LSN_SC_FIRST_NON_ZERO : { break; }
 			case LSN_SC_ZERO_FOR_DURATION : {
-				m_sStream.pfStartCondFunc = &CWavFile::StartCondFunc_ZeroForDuration;
 				m_sStream.cdStartData.ui64Counter = 0;
 				m_sStream.cdStartData.ui64Parm0 = uint64_t( std::round( scpStartParm.dParm * _ui32Hz ) );
 				break;
 			}
+			case LSN_SC_EXPRESSION : {
+				if ( !m_sStream.wceStartExp.SetExpression( _stfoFileOptions.sStartExp ) ) {
+					std::wprintf( L"Invalid start-condition expression: %s.\r\n", _stfoFileOptions.wsPath.c_str() );
+					return false;
+				}
+				break;
+			}
 			default : {
 				std::wprintf( L"Unrecognized start condition %X: %s.\r\n", _stfoFileOptions.scStartCondition, _stfoFileOptions.wsPath.c_str() );
 				return false;
@@ -389,32 +391,37 @@ namespace lsn {
 		}
 		
 		switch ( _stfoFileOptions.seEndCondition ) {
-			case LSN_EC_NONE : {
-				m_sStream.pfEndCondFunc = &CWavFile::EndCondFunc_None;
-				break;
-			}
+			case LSN_EC_NONE : { break; }
 			case LSN_EC_END_AT_SAMPLE : {
-				m_sStream.pfEndCondFunc = &CWavFile::EndCondFunc_EndAtSample;
 				m_sStream.cdStopData.ui64Parm0 = scpStopParm.ui64Parm;
 				break;
 			}
 			case LSN_EC_ZERO_FOR_DURATION : {
-				m_sStream.pfEndCondFunc = &CWavFile::EndCondFunc_ZeroForDuration;
 				m_sStream.cdStopData.ui64Counter = 0;
 				m_sStream.cdStopData.ui64Parm0 = uint64_t( std::round( scpStopParm.dParm * _ui32Hz ) );
 				break;
 			}
 			case LSN_EC_DURATION : {
-				m_sStream.pfEndCondFunc = &CWavFile::EndCondFunc_Duration;
 				m_sStream.cdStopData.ui64Parm0 = uint64_t( std::round( scpStopParm.dParm * _ui32Hz ) );
 				break;
 			}
+			case LSN_EC_EXPRESSION : {
+				if ( !m_sStream.wceEndExp.SetExpression( _stfoFileOptions.sEndExp ) ) {
+					std::wprintf( L"Invalid stop-condition expression: %s.\r\n", _stfoFileOptions.wsPath.c_str() );
+					return false;
+				}
+				break;
+			}
 			default : {
 				std::wprintf( L"Unrecognized stop condition %X: %s.\r\n", _stfoFileOptions.seEndCondition, _stfoFileOptions.wsPath.c_str() );
 				return false;
 			}
 		}
-		m_sStream.pfAddSampleFunc = &CWavFile::AddSample_CheckStartCond;
+		m_sStream.scStartCondition = _stfoFileOptions.scStartCondition;
+		m_sStream.seEndCondition = _stfoFileOptions.seEndCondition;
+		m_sStream.wceStartExp.SetMemory( m_sStream.vCondMemory.data(), m_sStream.ui64CondMemoryBase, m_sStream.vCondMemory.size() );
+		m_sStream.wceEndExp.SetMemory( m_sStream.vCondMemory.data(), m_sStream.ui64CondMemoryBase, m_sStream.vCondMemory.size() );
+		m_sStream.bCondMemory = m_sStream.wceStartExp.ReadsMemory() || m_sStream.wceEndExp.ReadsMemory();
 
 		m_sStream.fFormat = _stfoFileOptions.fFormat;
 		m_sStream.ui16Bits = static_cast<uint16_t>(_stfoFileOptions.ui32Bits);
@@ -456,6 +463,10 @@ namespace lsn {
 			m_sStream.stBufferSize = _stBufferSize * m_sStream.ui16Channels;
 			m_sStream.vCurBuffer.clear();
 			m_sStream.vCurBuffer.reserve( m_sStream.stBufferSize );
+			// Metadata is gathered as each sample is recorded, so it cannot be deferred to a block.
+			m_sStream.stPendingSize = m_sStream.bMeta ? 1 : std::min<size_t>( LSN_CONDITION_BLOCK, m_sStream.stBufferSize );
+			m_sStream.vPending.clear();
+			m_sStream.vPending.reserve( m_sStream.stPendingSize );
 		}
 		catch ( ... ) {
 			m_sStream.sfFile.Close();
@@ -469,30 +480,26 @@ namespace lsn {
 				switch ( m_sStream.ui16Bits ) {
 					case 8 : {
 						m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm8;
-#ifdef __AVX2__
-						if ( CUtilities::IsAvx2Supported() ) {
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+						if ( Avx2Supported() ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm8_AVX2;
 						}
-#endif	// #ifdef __AVX2__
-#ifdef __AVX512F__
-						if ( CUtilities::IsAvx512FSupported() ) {
+						if ( Avx512Supported() ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm8_AVX512;
 						}
-#endif	// #ifdef __AVX512F__
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
 						break;
 					}
 					case 16 : {
 						m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm16;
-#ifdef __AVX2__
-						if ( CUtilities::IsAvx2Supported() ) {
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+						if ( Avx2Supported() ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm16_AVX2;
 						}
-#endif	// #ifdef __AVX2__
-#ifdef __AVX512F__
-						if ( CUtilities::IsAvx512FSupported() ) {
+						if ( Avx512Supported() ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm16_AVX512;
 						}
-#endif	// #ifdef __AVX512F__
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
 						if ( m_sStream.bDither ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm16_Dither;
 						}
@@ -500,16 +507,14 @@ namespace lsn {
 					}
 					case 24 : {
 						m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm24;
-#ifdef __AVX2__
-						if ( CUtilities::IsAvx2Supported() ) {
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+						if ( Avx2Supported() ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm24_AVX2;
 						}
-#endif	// #ifdef __AVX2__
-#ifdef __AVX512F__
-						if ( CUtilities::IsAvx512FSupported() ) {
+						if ( Avx512Supported() ) {
 							m_sStream.pfCvtAndWriteFunc = &CWavFile::BatchF32ToPcm24_AVX512;
 						}
-#endif	// #ifdef __AVX512F__
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
 						break;
 					}
 					default : {
@@ -542,6 +547,9 @@ namespace lsn {
 
 		m_sStream.ui64SamplesReceived = m_sStream.ui64SamplesWritten = 0;
 		m_sStream.bAdding = false;
+		if ( m_sStream.pui8CondMemorySrc ) {
+			std::memcpy( m_sStream.vCondMemory.data(), m_sStream.pui8CondMemorySrc, m_sStream.vCondMemory.size() );
+		}
 		m_sStream.ui64MetaWritten = 0;
 		m_sStream.bStreaming = true;
 		return true;
@@ -555,6 +563,8 @@ namespace lsn {
 			std::unique_lock<std::mutex> ulLock( m_sStream.mMutex );
 			if ( m_sStream.sfFile.IsOpen() ) {
 				if ( m_sStream.bStreaming ) {
+					// The memory source might already be gone, so the pending samples are tested against the current snapshot.
+					ProcessPendingSamples( false );
 					if ( !m_sStream.vCurBuffer.empty() ) {
 						LSN_STREAM_BUFFER sbBuffer;
 						sbBuffer.vBuffer = std::move( m_sStream.vCurBuffer );
@@ -588,59 +598,43 @@ namespace lsn {
 		std::unique_lock<std::mutex> ulLock( m_sStream.mMutex );
 
 		if LSN_LIKELY( m_sStream.bStreaming && !m_sStream.bEnd ) {
-			if ( (*m_sStream.pfAddSampleFunc)( _fSample, m_sStream ) ) {
-				m_sStream.bAdding = true;
-				m_sStream.vCurBuffer.push_back( _fSample );
-				
-				++m_sStream.ui64SamplesWritten;
-				m_sStream.ui32WavFile_DSize += sizeof( float );
-
-				if ( m_sStream.bMeta && m_sStream.pfMetaFunc ) {
-					std::unique_lock<std::mutex> ulLockMeta( m_sStream.mMetaMutex );
-					AddMetaData();
-				}
-
-				uint32_t ui32MaxFloatBytes = ((UINT_MAX - m_sStream.ui32WavFile_Size - 4) / sizeof( float )) * sizeof( float );
-				bool bSplit = m_sStream.ui32WavFile_DSize == ui32MaxFloatBytes;
-
-				if LSN_UNLIKELY( bSplit || m_sStream.vCurBuffer.size() == m_sStream.stBufferSize ) {
-					// Efficiently pass the buffer off to the writer thread.
-					LSN_STREAM_BUFFER sbBuffer;
-					sbBuffer.vBuffer = std::move( m_sStream.vCurBuffer );
-					sbBuffer.ui32WavFile_DSize = 0;
-					m_sStream.qBufferQueue.push( std::move( sbBuffer ) );
-					
-					if LSN_UNLIKELY( bSplit ) {
-						// Push an empty buffer as a signal to the writer thread to split the file.
-						LSN_STREAM_BUFFER sbSplitSignal;
-						sbSplitSignal.ui32WavFile_DSize = m_sStream.ui32WavFile_DSize;
-						m_sStream.qBufferQueue.push( std::move( sbSplitSignal ) );
-
-						// Reset the local file size counter for the upcoming file.
-						m_sStream.ui32WavFile_DSize = 0;
-					}
-
-					// Create a new buffer and reserve space for efficiency.
-					m_sStream.vCurBuffer.clear();
-					m_sStream.vCurBuffer.reserve( m_sStream.stBufferSize );
-					// Notify the writer thread that a full buffer is ready.
-					m_sStream.cvCondition.notify_one();
-				}
-			}
-			else if ( m_sStream.bEnd ) {
-				LSN_STREAM_BUFFER sbBuffer;
-				sbBuffer.vBuffer = std::move( m_sStream.vCurBuffer );
-				sbBuffer.ui32WavFile_DSize = 0;
-				m_sStream.qBufferQueue.push( std::move( sbBuffer ) );
-				// Create a new buffer and reserve space for efficiency.
-				m_sStream.vCurBuffer.clear();
-				// Notify the writer thread that a full buffer is ready.
-				m_sStream.cvCondition.notify_one();
+			m_sStream.vPending.push_back( _fSample );
+			if LSN_UNLIKELY( m_sStream.vPending.size() >= m_sStream.stPendingSize ) {
+				ProcessPendingSamples( false );
 			}
-			++m_sStream.ui64SamplesReceived;
 		}
 	}
 
+	/**
+	 * Sets the memory that expression conditions can read (normally the APU registers).  A snapshot is taken, so address reads
+	 *	see the memory as it was when each sample was produced as long as ConditionMemoryChanged() is called before adding the
+	 *	first sample produced after each change.
+	 * 
+	 * \param _pui8Memory The live memory, or nullptr to detach it.
+	 * \param _ui64Base The address of _pui8Memory[0].
+	 * \param _sSize The number of bytes at _pui8Memory.
+	 **/
+	void CWavFile::SetConditionMemory( const uint8_t * _pui8Memory, uint64_t _ui64Base, size_t _sSize ) {
+		std::unique_lock<std::mutex> ulLock( m_sStream.mMutex );
+		// Samples produced under the previous memory are tested before it is replaced.
+		ProcessPendingSamples( false );
+		m_sStream.pui8CondMemorySrc = nullptr;
+		try {
+			m_sStream.vCondMemory.resize( _pui8Memory ? _sSize : 0 );
+		}
+		catch ( ... ) {
+			m_sStream.vCondMemory.clear();
+			_pui8Memory = nullptr;
+		}
+		if ( _pui8Memory ) {
+			std::memcpy( m_sStream.vCondMemory.data(), _pui8Memory, m_sStream.vCondMemory.size() );
+			m_sStream.pui8CondMemorySrc = _pui8Memory;
+			m_sStream.ui64CondMemoryBase = _ui64Base;
+		}
+		m_sStream.wceStartExp.SetMemory( m_sStream.pui8CondMemorySrc ? m_sStream.vCondMemory.data() : nullptr, m_sStream.ui64CondMemoryBase, m_sStream.vCondMemory.size() );
+		m_sStream.wceEndExp.SetMemory( m_sStream.pui8CondMemorySrc ? m_sStream.vCondMemory.data() : nullptr, m_sStream.ui64CondMemoryBase, m_sStream.vCondMemory.size() );
+	}
+
 	/**
 	 * Called to update the metadata stream output.  Call immediately after calling AddStreamSample().
 	 **/
@@ -1425,125 +1419,166 @@ namespace lsn {
 	}
 
 	/**
-	 * The None start condition.  Returns true.
-	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns true if the start condition has been met.
-	 **/
-	bool LSN_STDCALL CWavFile::StartCondFunc_None( uint64_t /*_ui64AbsoluteIdx*/, float /*_fSample*/, LSN_CONDITIONS_DATA &/*_cdData*/ ) { return true; }
-
-	/**
-	 * The Start-at-Sample start condition.  Returns true if _ui64AbsoluteIdx >= _cdData.ui64Parm0.
+	 * Tests the pending samples against the start/end conditions and sends the ones that are recorded to the file.
 	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns true if the start condition has been met.
+	 * \param _bSyncMemory If true, the condition-memory snapshot is refreshed from the live memory afterwards.
 	 **/
-	bool LSN_STDCALL CWavFile::StartCondFunc_StartAtSample( uint64_t _ui64AbsoluteIdx, float /*_fSample*/, LSN_CONDITIONS_DATA &_cdData ) { return _ui64AbsoluteIdx >= _cdData.ui64Parm0; }
-
-	/**
-	 * The First-Non-Zero start condition.  Returns true if _fSample != 0.0f.
-	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns true if the start condition has been met.
-	 **/
-	bool LSN_STDCALL CWavFile::StartCondFunc_FirstNonZero( uint64_t /*_ui64AbsoluteIdx*/, float _fSample, LSN_CONDITIONS_DATA &/*_cdData*/ ) { return _fSample != 0.0f; }
+	void CWavFile::ProcessPendingSamples( bool _bSyncMemory ) {
+		const float * pfSamples = m_sStream.vPending.data();
+		size_t sTotal = m_sStream.vPending.size();
+		size_t sPos = 0;
+		while ( sPos < sTotal && m_sStream.bStreaming && !m_sStream.bEnd ) {
+			uint64_t ui64Index = m_sStream.ui64SamplesReceived + sPos;
+			if ( !m_sStream.bAdding ) {
+				sPos += FindStart( pfSamples + sPos, sTotal - sPos, ui64Index );
+				if ( sPos == sTotal ) { break; }
+				m_sStream.bAdding = true;
+				ui64Index = m_sStream.ui64SamplesReceived + sPos;
+			}
+			size_t sRun = FindEnd( pfSamples + sPos, sTotal - sPos, ui64Index );
+			WriteStreamSamples( pfSamples + sPos, sRun );
+			sPos += sRun;
+			if ( sPos < sTotal ) {
+				// The end condition was reached.  Hand off what remains and let the writer thread close the file.
+				m_sStream.bEnd = true;
+				LSN_STREAM_BUFFER sbBuffer;
+				sbBuffer.vBuffer = std::move( m_sStream.vCurBuffer );
+				sbBuffer.ui32WavFile_DSize = 0;
+				m_sStream.qBufferQueue.push( std::move( sbBuffer ) );
+				m_sStream.vCurBuffer.clear();
+				m_sStream.cvCondition.notify_one();
+			}
+		}
+		m_sStream.ui64SamplesReceived += sTotal;
+		m_sStream.vPending.clear();
 
-	/**
-	 * The Zero-For-Duration start condition.  Returns true if _cdData.ui64Counter >= _cdData.ui64Parm0, with _cdData.ui64Counter being counted on each 0 sample.
-	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns true if the start condition has been met.
-	 **/
-	bool LSN_STDCALL CWavFile::StartCondFunc_ZeroForDuration( uint64_t /*_ui64AbsoluteIdx*/, float _fSample, LSN_CONDITIONS_DATA &_cdData ) {
-		if ( _fSample && _cdData.ui64Counter >= _cdData.ui64Parm0 ) { return true; }
-		if ( _fSample ) { _cdData.ui64Counter = 0; }
-		else { ++_cdData.ui64Counter; }
-		return false;
+		if ( _bSyncMemory && m_sStream.pui8CondMemorySrc ) {
+			std::memcpy( m_sStream.vCondMemory.data(), m_sStream.pui8CondMemorySrc, m_sStream.vCondMemory.size() );
+		}
 	}
-		
-	/**
-	 * The None end condition.  Returns true.
-	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns false if the end condition has been met, at which point recording should stop.
-	 **/
-	bool LSN_STDCALL CWavFile::EndCondFunc_None( uint64_t /*_ui64AbsoluteIdx*/, uint64_t /*_ui64IdxSinceStart*/, float /*_fSample*/, LSN_CONDITIONS_DATA &/*_cdData*/ ) { return true; }
-
-	/**
-	 * The End-At-Sample end condition.  Returns true if _ui64AbsoluteIdx < _cdData.ui64Parm0.
-	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns false if the end condition has been met, at which point recording should stop.
-	 **/
-	bool LSN_STDCALL CWavFile::EndCondFunc_EndAtSample( uint64_t _ui64AbsoluteIdx, uint64_t /*_ui64IdxSinceStart*/, float /*_fSample*/, LSN_CONDITIONS_DATA &_cdData ) { return _ui64AbsoluteIdx < _cdData.ui64Parm0; }
 
 	/**
-	 * The Zero-For-Duration end condition.  Returns true if _cdData.ui64Counter < _cdData.ui64Parm0, with _cdData.ui64Counter counting consecutive 0's.
+	 * Finds the first sample in a block at which the start condition is met.
 	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns false if the end condition has been met, at which point recording should stop.
+	 * \param _pfSamples The samples.
+	 * \param _sTotal The number of samples.
+	 * \param _ui64Index The absolute index of _pfSamples[0].
+	 * \return Returns the index within the block of the first sample to record, or _sTotal if recording does not start in the block.
 	 **/
-	bool LSN_STDCALL CWavFile::EndCondFunc_ZeroForDuration( uint64_t /*_ui64AbsoluteIdx*/, uint64_t /*_ui64IdxSinceStart*/, float _fSample, LSN_CONDITIONS_DATA &_cdData ) {
-		if LSN_LIKELY( _fSample ) { _cdData.ui64Counter = 0; return false; }
-		return ++_cdData.ui64Counter < _cdData.ui64Parm0;
+	size_t CWavFile::FindStart( const float * _pfSamples, size_t _sTotal, uint64_t _ui64Index ) {
+		switch ( m_sStream.scStartCondition ) {
+			case LSN_SC_START_AT_SAMPLE : {
+				if ( _ui64Index >= m_sStream.cdStartData.ui64Parm0 ) { return 0; }
+				return size_t( std::min<uint64_t>( m_sStream.cdStartData.ui64Parm0 - _ui64Index, _sTotal ) );
+			}
+			case LSN_SC_FIRST_NON_ZERO : {
+				for ( size_t I = 0; I < _sTotal; ++I ) {
+					if ( _pfSamples[I] != 0.0f ) { return I; }
+				}
+				return _sTotal;
+			}
+			case LSN_SC_ZERO_FOR_DURATION : {
+				// Starts on the first non-zero sample after at least ui64Parm0 consecutive zeros.
+				LSN_CONDITIONS_DATA & cdData = m_sStream.cdStartData;
+				for ( size_t I = 0; I < _sTotal; ++I ) {
+					if ( _pfSamples[I] != 0.0f ) {
+						if ( cdData.ui64Counter >= cdData.ui64Parm0 ) { return I; }
+						cdData.ui64Counter = 0;
+					}
+					else { ++cdData.ui64Counter; }
+				}
+				return _sTotal;
+			}
+			case LSN_SC_EXPRESSION : {
+				return m_sStream.wceStartExp.Find( _pfSamples, _sTotal, _ui64Index, 0, false, double( m_sStream.ui32Hz ), true );
+			}
+			default : { return 0; }
+		}
 	}
 
 	/**
-	 * The Duration end condition.  Returns true if _ui64IdxSinceStart < _cdData.ui64Parm0.
-	 * 
-	 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-	 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-	 * \param _fSample The value of the sample being tested.
-	 * \param _cdData Function-specific data.
-	 * \return Returns false if the end condition has been met, at which point recording should stop.
-	 **/
-	bool LSN_STDCALL CWavFile::EndCondFunc_Duration( uint64_t /*_ui64AbsoluteIdx*/, uint64_t _ui64IdxSinceStart, float /*_fSample*/, LSN_CONDITIONS_DATA &_cdData ) { return _ui64IdxSinceStart < _cdData.ui64Parm0; }
-
-	/**
-	 * Checks the starting condition before adding a sample.  Once the starting condition has been reached, _sStream.pfAddSampleFunc is changed to AddSample_CheckStopCond().
+	 * Finds the first sample in a block at which the end condition is met.
 	 * 
-	 * \param _fSample The sampple to add.
-	 * \param _sStream The stream data.
-	 * \return Returns true if the starting condition has been reached.
+	 * \param _pfSamples The samples.
+	 * \param _sTotal The number of samples.
+	 * \param _ui64Index The absolute index of _pfSamples[0].
+	 * \return Returns the number of samples at the start of the block to record.  If less than _sTotal, recording ends at that sample.
 	 **/
-	bool LSN_STDCALL CWavFile::AddSample_CheckStartCond( float _fSample, LSN_STREAMING &_sStream ) {
-		if ( (*_sStream.pfStartCondFunc)( _sStream.ui64SamplesReceived, _fSample, _sStream.cdStartData ) ) {
-			_sStream.pfAddSampleFunc = &CWavFile::AddSample_CheckStopCond;
-			return (*_sStream.pfAddSampleFunc)( _fSample, _sStream );
+	size_t CWavFile::FindEnd( const float * _pfSamples, size_t _sTotal, uint64_t _ui64Index ) {
+		switch ( m_sStream.seEndCondition ) {
+			case LSN_EC_END_AT_SAMPLE : {
+				if ( _ui64Index >= m_sStream.cdStopData.ui64Parm0 ) { return 0; }
+				return size_t( std::min<uint64_t>( m_sStream.cdStopData.ui64Parm0 - _ui64Index, _sTotal ) );
+			}
+			case LSN_EC_ZERO_FOR_DURATION : {
+				// Ends on the sample that completes ui64Parm0 consecutive zeros.
+				LSN_CONDITIONS_DATA & cdData = m_sStream.cdStopData;
+				for ( size_t I = 0; I < _sTotal; ++I ) {
+					if ( _pfSamples[I] != 0.0f ) { cdData.ui64Counter = 0; }
+					else if ( ++cdData.ui64Counter >= cdData.ui64Parm0 ) { return I; }
+				}
+				return _sTotal;
+			}
+			case LSN_EC_DURATION : {
+				if ( m_sStream.ui64SamplesWritten >= m_sStream.cdStopData.ui64Parm0 ) { return 0; }
+				return size_t( std::min<uint64_t>( m_sStream.cdStopData.ui64Parm0 - m_sStream.ui64SamplesWritten, _sTotal ) );
+			}
+			case LSN_EC_EXPRESSION : {
+				return m_sStream.wceEndExp.Find( _pfSamples, _sTotal, _ui64Index, m_sStream.ui64SamplesWritten, true, double( m_sStream.ui32Hz ), false );
+			}
+			default : { return _sTotal; }
 		}
-		return false;
 	}
 
 	/**
-	 * Checks the stopping condition before adding a sample.  Once the stopping condition has been reached, the stream ends. 
+	 * Adds samples that passed the conditions to the output buffer, handing full buffers and file splits to the writer thread.
 	 * 
-	 * \param _fSample The sampple to add.
-	 * \param _sStream The stream data.
-	 * \return Returns true for as long as samples should be output.  Once false is returned, the ending condition has been reached and the stream should close without adding the sample.
+	 * \param _pfSamples The samples.
+	 * \param _sTotal The number of samples.
 	 **/
-	bool LSN_STDCALL CWavFile::AddSample_CheckStopCond( float _fSample, LSN_STREAMING &_sStream ) {
-		if LSN_UNLIKELY( !(*_sStream.pfEndCondFunc)( _sStream.ui64SamplesReceived, _sStream.ui64SamplesWritten, _fSample, _sStream.cdStopData ) ) {
-			_sStream.bEnd = true;
-			return false;
+	void CWavFile::WriteStreamSamples( const float * _pfSamples, size_t _sTotal ) {
+		while ( _sTotal ) {
+			uint32_t ui32MaxFloatBytes = ((UINT_MAX - m_sStream.ui32WavFile_Size - 4) / sizeof( float )) * sizeof( float );
+			size_t sCopy = std::min( _sTotal, m_sStream.stBufferSize - m_sStream.vCurBuffer.size() );
+			sCopy = std::min<size_t>( sCopy, (ui32MaxFloatBytes - m_sStream.ui32WavFile_DSize) / sizeof( float ) );
+			if ( m_sStream.bMeta && m_sStream.pfMetaFunc ) { sCopy = std::min<size_t>( sCopy, 1 ); }
+
+			m_sStream.vCurBuffer.insert( m_sStream.vCurBuffer.end(), _pfSamples, _pfSamples + sCopy );
+			m_sStream.ui64SamplesWritten += sCopy;
+			m_sStream.ui32WavFile_DSize += uint32_t( sCopy * sizeof( float ) );
+			_pfSamples += sCopy;
+			_sTotal -= sCopy;
+
+			if ( m_sStream.bMeta && m_sStream.pfMetaFunc ) {
+				std::unique_lock<std::mutex> ulLockMeta( m_sStream.mMetaMutex );
+				AddMetaData();
+			}
+
+			bool bSplit = m_sStream.ui32WavFile_DSize == ui32MaxFloatBytes;
+			if LSN_UNLIKELY( bSplit || m_sStream.vCurBuffer.size() == m_sStream.stBufferSize ) {
+				// Efficiently pass the buffer off to the writer thread.
+				LSN_STREAM_BUFFER sbBuffer;
+				sbBuffer.vBuffer = std::move( m_sStream.vCurBuffer );
+				sbBuffer.ui32WavFile_DSize = 0;
+				m_sStream.qBufferQueue.push( std::move( sbBuffer ) );
+					
+				if LSN_UNLIKELY( bSplit ) {
+					// Push an empty buffer as a signal to the writer thread to split the file.
+					LSN_STREAM_BUFFER sbSplitSignal;
+					sbSplitSignal.ui32WavFile_DSize = m_sStream.ui32WavFile_DSize;
+					m_sStream.qBufferQueue.push( std::move( sbSplitSignal ) );
+
+					// Reset the local file size counter for the upcoming file.
+					m_sStream.ui32WavFile_DSize = 0;
+				}
+
+				// Create a new buffer and reserve space for efficiency.
+				m_sStream.vCurBuffer.clear();
+				m_sStream.vCurBuffer.reserve( m_sStream.stBufferSize );
+				// Notify the writer thread that a full buffer is ready.
+				m_sStream.cvCondition.notify_one();
+			}
 		}
-		return true;
 	}
 
 }	// namespace lsn
@@ -13,6 +13,7 @@
 #include "../Utilities/LSNAlignmentAllocator.h"
 #include "../Utilities/LSNStreamBase.h"
 #include "../Utilities/LSNUtilities.h"
+#include "LSNWavConditionExp.h"
 
 #include <cinttypes>
 #include <condition_variable>
@@ -98,6 +99,7 @@ namespace lsn {
 			LSN_SC_START_AT_SAMPLE,
 			LSN_SC_FIRST_NON_ZERO,
 			LSN_SC_ZERO_FOR_DURATION,
+			LSN_SC_EXPRESSION,
 		};
 
 		/** End conditions. */
@@ -106,6 +108,7 @@ namespace lsn {
 			LSN_EC_END_AT_SAMPLE,
 			LSN_EC_ZERO_FOR_DURATION,
 			LSN_EC_DURATION,
+			LSN_EC_EXPRESSION,
 		};
 
 		/** Metadata formats. */
@@ -113,11 +116,15 @@ namespace lsn {
 			LSN_MF_AUDACITY,
 		};
 
+		/** Streaming sizes. */
+		enum : size_t {
+			LSN_CONDITION_BLOCK											= 1024,					// Samples gathered before the start/end conditions are tested.
+		};
+
 
 		// == Types.
 		typedef std::vector<double, CAlignmentAllocator<double, 64>>	lwtrack;
 		typedef std::vector<lwtrack>									lwaudio;
-		typedef bool (LSN_STDCALL *										PfAddSampleFunc)( float, struct CWavFile::LSN_STREAMING & );
 		typedef void (LSN_STDCALL *										PfBatchConvNWrite)( const std::vector<float> &, std::vector<uint8_t> &, struct CWavFile::LSN_STREAMING & );
 		typedef bool (LSN_STDCALL *										PfAddMetaDataFunc)( void *, struct CWavFile::LSN_STREAMING & );
 		typedef void (LSN_STDCALL *										PfMetaDataThreadFunc)( CWavFile *, void *, struct CWavFile::LSN_STREAMING &, std::vector<uint8_t, CAlignmentAllocator<uint8_t, 64>> &, std::vector<uint8_t> & );
@@ -166,6 +173,8 @@ namespace lsn {
 			LSN_END_CONDITIONS											seEndCondition = LSN_EC_NONE;
 			uint64_t													ui64EndParm = 0;
 			double														dEndParm = 0.0;
+			std::string													sStartExp;				// UTF-8 expression for LSN_SC_EXPRESSION.  See CWavConditionExp.
+			std::string													sEndExp;				// UTF-8 expression for LSN_EC_EXPRESSION.  Recording stops when it becomes false.
 
 			uint64_t													ui64MetaParm = 0;
 			void *														pvMetaParm = nullptr;
@@ -187,10 +196,7 @@ namespace lsn {
 			uint64_t													ui64Parm0 = 0;
 			float														fParm1 = 0.0f;
 		};
-		
-		typedef bool (LSN_STDCALL *										PfStartConditionFunc)( uint64_t, float, LSN_CONDITIONS_DATA & );
-		typedef bool (LSN_STDCALL *										PfEndConditionFunc)( uint64_t, uint64_t, float, LSN_CONDITIONS_DATA & );
-		
+
 #pragma pack( push, 1 )
 		/** Chunk. */
 		struct LSN_CHUNK {
@@ -329,10 +335,16 @@ namespace lsn {
 			
 			LSN_CONDITIONS_DATA											cdStartData;				/**< The start-condition data. */
 			LSN_CONDITIONS_DATA											cdStopData;					/**< The stop-condition data. */
-			PfStartConditionFunc										pfStartCondFunc = nullptr;	/**< The start-condition function. */
-			PfEndConditionFunc											pfEndCondFunc = nullptr;	/**< The end-condition function. */
+			LSN_START_CONDITIONS										scStartCondition = LSN_SC_NONE;	/**< The start condition. */
+			LSN_END_CONDITIONS											seEndCondition = LSN_EC_NONE;	/**< The end condition. */
+			CWavConditionExp											wceStartExp;				/**< The compiled LSN_SC_EXPRESSION condition. */
+			CWavConditionExp											wceEndExp;					/**< The compiled LSN_EC_EXPRESSION condition. */
+			std::vector<float>											vPending;					/**< Samples received but not yet tested against the start/end conditions. */
+			size_t														stPendingSize = LSN_CONDITION_BLOCK;	/**< The number of samples to gather before testing the conditions. */
+			std::vector<uint8_t>										vCondMemory;				/**< The memory (APU registers) as it was when the pending samples were produced. */
+			const uint8_t *												pui8CondMemorySrc = nullptr;/**< The live memory copied into vCondMemory. */
+			uint64_t													ui64CondMemoryBase = 0;		/**< The address of vCondMemory[0]. */
 			PfBatchConvNWrite											pfCvtAndWriteFunc = nullptr;/**< The function for batch conversion and writing to the WAV file. */
-			PfAddSampleFunc												pfAddSampleFunc = nullptr;	/**< The function for adding a sample.  There is one that checks the starting condition and then one that keeps adding samples until the stopping condition is reached. */
 			uint32_t													ui32WavFile_Size = 0;		/**< The final file size to write to the WAV file. */
 			uint32_t													ui32WavFile_DSize = 0;		/**< The final data size to write to the WAV file. */
 			int32_t														i32MetaFormat = 0;			/**< The metadata format. */
@@ -345,6 +357,7 @@ namespace lsn {
 			bool														bAdding = false;			/**< Set to true after the starting condition is met.  Indicates that samples are being added. */
 			bool														bDither = false;			/**< To dither 16-bit PCM or not. */
 			bool														bMeta = false;				/**< Whether metadata is being streamed or not. */
+			bool														bCondMemory = false;		/**< Whether a condition reads vCondMemory, which then must be kept in sync with the pending samples. */
 		};
 
 
@@ -574,6 +587,28 @@ namespace lsn {
 		 **/
 		void															AddStreamSample( float _fSample );
 
+		/**
+		 * Sets the memory that expression conditions can read (normally the APU registers).  A snapshot is taken, so address reads
+		 *	see the memory as it was when each sample was produced as long as ConditionMemoryChanged() is called before adding the
+		 *	first sample produced after each change.
+		 * 
+		 * \param _pui8Memory The live memory, or nullptr to detach it.
+		 * \param _ui64Base The address of _pui8Memory[0].
+		 * \param _sSize The number of bytes at _pui8Memory.
+		 **/
+		void															SetConditionMemory( const uint8_t * _pui8Memory, uint64_t _ui64Base, size_t _sSize );
+
+		/**
+		 * Tells the stream that the memory given to SetConditionMemory() has changed.  If a condition reads the memory, the pending
+		 *	samples are tested against the old snapshot and the snapshot is refreshed.  Otherwise this does nothing.
+		 **/
+		inline void														ConditionMemoryChanged() {
+			if LSN_UNLIKELY( m_sStream.bCondMemory ) {
+				std::unique_lock<std::mutex> ulLock( m_sStream.mMutex );
+				ProcessPendingSamples( true );
+			}
+		}
+
 		/**
 		 * Called to update the metadata stream output.
 		 **/
@@ -1114,12 +1149,8 @@ namespace lsn {
 				_vDst.reserve( _vDst.size() + stNumSamples * stNumChannels * sizeof( int16_t ) );
 				int16_t * pi16Dst = reinterpret_cast<int16_t *>(_vDst.data() + aSize);
 
-#ifdef __AVX512BW__
-				if ( CUtilities::IsAvx512BWSupported() ) {
-					// Constants for AVX-512 operations
-					__m512d vdFactor = _mm512_set1_pd( dFactor );
-					__m512d vdMin = _mm512_set1_pd( -1.0 );
-					__m512d vdMax = _mm512_set1_pd( 1.0 );
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+				if ( Avx512Supported() ) {
 					std::vector<std::vector<uint16_t>, CAlignmentAllocator<std::vector<uint16_t>, 64>> vSamples;
 					vSamples.resize( stNumChannels );
 					for ( auto I = stNumChannels; I--; ) {
@@ -1127,29 +1158,7 @@ namespace lsn {
 					}
 				
 					for ( auto C = stNumChannels; C--; ) {
-						lwaudio::size_type stIdx = 0;
-						while ( stIdx < stNumSamples - (8 - 1) ) {
-							__m512d vdSamples = _mm512_load_pd( &_vSrc[C][stIdx] );
-
-							// Clamp samples between -1.0 and 1.0.
-							vdSamples = _mm512_max_pd( vdSamples, vdMin );
-							vdSamples = _mm512_min_pd( vdSamples, vdMax );
-
-							// Multiply by scaling factor.
-							vdSamples = _mm512_mul_pd( vdSamples, vdFactor );
-
-							// Round to nearest integer and convert to int32_t
-							__m256i viInt32 = _mm512_cvt_roundpd_epi32( vdSamples, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
-
-							// Convert int32_t to int16_t with saturation
-							__m128i viInt16 = _mm256_cvtsepi32_epi16( viInt32 );
-
-							_mm_store_si128( reinterpret_cast<__m128i *>(&vSamples[C][stIdx]), viInt16 );
-
-
-							stIdx += sizeof( __m512d ) / sizeof( double );
-						}
-
+						lwaudio::size_type stIdx = F64ToI16_AVX512( _vSrc[C].data(), reinterpret_cast<int16_t *>(vSamples[C].data()), stNumSamples );
 						while ( stIdx < stNumSamples ) {
 							vSamples[C][stIdx++] = static_cast<int16_t>(std::round( std::clamp( _vSrc[C][stIdx], -1.0, 1.0 ) * dFactor ));
 						}
@@ -1163,7 +1172,7 @@ namespace lsn {
 
 					return true;
 				}
-#endif	// #ifdef __AVX512BW__
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
 
 				for ( size_t I = 0; I < _vSrc[0].size(); ++I ) {
 					for ( size_t J = 0; J < _vSrc.size(); ++J ) {
@@ -1253,12 +1262,8 @@ namespace lsn {
 				_vDst.resize( _vDst.size() + stNumSamples * stNumChannels * sizeof( int32_t ) );
 				int32_t * pi32Dst = reinterpret_cast<int32_t *>(_vDst.data() + aSize);
 
-#ifdef __AVX512BW__
-				if ( CUtilities::IsAvx512BWSupported() ) {
-					// Constants for AVX-512 operations
-					__m512d vdFactor = _mm512_set1_pd( dFactor );
-					__m512d vdMin = _mm512_set1_pd( -1.0 );
-					__m512d vdMax = _mm512_set1_pd( 1.0 );
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+				if ( Avx512Supported() ) {
 					std::vector<std::vector<uint32_t>, CAlignmentAllocator<std::vector<uint32_t>, 64>> vSamples;
 					vSamples.resize( stNumChannels );
 					for ( auto I = stNumChannels; I--; ) {
@@ -1266,27 +1271,7 @@ namespace lsn {
 					}
 				
 					for ( auto C = stNumChannels; C--; ) {
-						lwaudio::size_type stIdx = 0;
-						while ( stIdx < stNumSamples - (8 - 1) ) {
-							__m512d vdSamples = _mm512_load_pd( &_vSrc[C][stIdx] );
-
-							// Clamp samples between -1.0 and 1.0.
-							vdSamples = _mm512_max_pd( vdSamples, vdMin );
-							vdSamples = _mm512_min_pd( vdSamples, vdMax );
-
-							// Multiply by scaling factor.
-							vdSamples = _mm512_mul_pd( vdSamples, vdFactor );
-
-							// Round to nearest integer and convert to int32_t
-							__m256i viInt32 = _mm512_cvt_roundpd_epi32( vdSamples, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
-
-							// Store the int32_t samples.
-							_mm256_store_si256( reinterpret_cast<__m256i*>(&vSamples[C][stIdx]), viInt32 );
-
-
-							stIdx += sizeof( __m512d ) / sizeof( double );
-						}
-
+						lwaudio::size_type stIdx = F64ToI32_AVX512( _vSrc[C].data(), reinterpret_cast<int32_t *>(vSamples[C].data()), stNumSamples );
 						while ( stIdx < stNumSamples ) {
 							vSamples[C][stIdx++] = static_cast<int32_t>(std::round( std::clamp( _vSrc[C][stIdx], -1.0, 1.0 ) * dFactor ));
 						}
@@ -1300,7 +1285,7 @@ namespace lsn {
 
 					return true;
 				}
-#endif	// #ifdef __AVX512BW__
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
 
 				for ( size_t I = 0; I < _vSrc[0].size(); ++I ) {
 					for ( size_t J = 0; J < _vSrc.size(); ++J ) {
@@ -1428,105 +1413,39 @@ namespace lsn {
 		void 															MetadataWriterThread();
 
 		/**
-		 * The None start condition.  Returns true.
+		 * Tests the pending samples against the start/end conditions and sends the ones that are recorded to the file.
 		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns true if the start condition has been met.
+		 * \param _bSyncMemory If true, the condition-memory snapshot is refreshed from the live memory afterwards.
 		 **/
-		static bool LSN_STDCALL											StartCondFunc_None( uint64_t /*_ui64AbsoluteIdx*/, float /*_fSample*/, LSN_CONDITIONS_DATA &/*_cdData*/ );
+		void															ProcessPendingSamples( bool _bSyncMemory );
 
 		/**
-		 * The Start-at-Sample start condition.  Returns true if _ui64AbsoluteIdx >= _cdData.ui64Parm0.
+		 * Finds the first sample in a block at which the start condition is met.
 		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns true if the start condition has been met.
+		 * \param _pfSamples The samples.
+		 * \param _sTotal The number of samples.
+		 * \param _ui64Index The absolute index of _pfSamples[0].
+		 * \return Returns the index within the block of the first sample to record, or _sTotal if recording does not start in the block.
 		 **/
-		static bool LSN_STDCALL											StartCondFunc_StartAtSample( uint64_t _ui64AbsoluteIdx, float /*_fSample*/, LSN_CONDITIONS_DATA &_cdData );
+		size_t															FindStart( const float * _pfSamples, size_t _sTotal, uint64_t _ui64Index );
 
 		/**
-		 * The First-Non-Zero start condition.  Returns true if _fSample != 0.0f.
+		 * Finds the first sample in a block at which the end condition is met.
 		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns true if the start condition has been met.
+		 * \param _pfSamples The samples.
+		 * \param _sTotal The number of samples.
+		 * \param _ui64Index The absolute index of _pfSamples[0].
+		 * \return Returns the number of samples at the start of the block to record.  If less than _sTotal, recording ends at that sample.
 		 **/
-		static bool LSN_STDCALL											StartCondFunc_FirstNonZero( uint64_t /*_ui64AbsoluteIdx*/, float _fSample, LSN_CONDITIONS_DATA &/*_cdData*/ );
+		size_t															FindEnd( const float * _pfSamples, size_t _sTotal, uint64_t _ui64Index );
 
 		/**
-		 * The Zero-For-Duration start condition.  Returns true if _cdData.ui64Counter >= _cdData.ui64Parm0, with _cdData.ui64Counter being counted on each 0 sample.
+		 * Adds samples that passed the conditions to the output buffer, handing full buffers and file splits to the writer thread.
 		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns true if the start condition has been met.
+		 * \param _pfSamples The samples.
+		 * \param _sTotal The number of samples.
 		 **/
-		static bool LSN_STDCALL											StartCondFunc_ZeroForDuration( uint64_t /*_ui64AbsoluteIdx*/, float _fSample, LSN_CONDITIONS_DATA &_cdData );
-
-		/**
-		 * The None end condition.  Returns true.
-		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns false if the end condition has been met, at which point recording should stop.
-		 **/
-		static bool LSN_STDCALL											EndCondFunc_None( uint64_t /*_ui64AbsoluteIdx*/, uint64_t /*_ui64IdxSinceStart*/, float /*_fSample*/, LSN_CONDITIONS_DATA &/*_cdData*/ );
-
-		/**
-		 * The End-At-Sample end condition.  Returns true if _ui64AbsoluteIdx < _cdData.ui64Parm0.
-		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns false if the end condition has been met, at which point recording should stop.
-		 **/
-		static bool LSN_STDCALL											EndCondFunc_EndAtSample( uint64_t _ui64AbsoluteIdx, uint64_t /*_ui64IdxSinceStart*/, float /*_fSample*/, LSN_CONDITIONS_DATA &_cdData );
-
-		/**
-		 * The Zero-For-Duration end condition.  Returns true if _cdData.ui64Counter < _cdData.ui64Parm0, with _cdData.ui64Counter counting consecutive 0's.
-		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns false if the end condition has been met, at which point recording should stop.
-		 **/
-		static bool LSN_STDCALL											EndCondFunc_ZeroForDuration( uint64_t /*_ui64AbsoluteIdx*/, uint64_t /*_ui64IdxSinceStart*/, float _fSample, LSN_CONDITIONS_DATA &_cdData );
-
-		/**
-		 * The Duration end condition.  Returns true if _ui64IdxSinceStart < _cdData.ui64Parm0.
-		 * 
-		 * \param _ui64AbsoluteIdx The absolute index of the sample being tested.
-		 * \param _ui64IdxSinceStart The index of the sample being tested since recording began.
-		 * \param _fSample The value of the sample being tested.
-		 * \param _cdData Function-specific data.
-		 * \return Returns false if the end condition has been met, at which point recording should stop.
-		 **/
-		static bool LSN_STDCALL											EndCondFunc_Duration( uint64_t /*_ui64AbsoluteIdx*/, uint64_t _ui64IdxSinceStart, float /*_fSample*/, LSN_CONDITIONS_DATA &_cdData );
-
-		/**
-		 * Checks the starting condition before adding a sample.  Once the starting condition has been reached, _sStream.pfAddSampleFunc is changed to AddSample_CheckStopCond().
-		 * 
-		 * \param _fSample The sampple to add.
-		 * \param _sStream The stream data.
-		 **/
-		static bool LSN_STDCALL											AddSample_CheckStartCond( float _fSample, LSN_STREAMING &_sStream );
-
-		/**
-		 * Checks the stopping condition before adding a sample.  Once the stopping condition has been reached, the stream ends. 
-		 * 
-		 * \param _fSample The sampple to add.
-		 * \param _sStream The stream data.
-		 * \return Returns true if the starting condition has been reached.
-		 **/
-		static bool LSN_STDCALL											AddSample_CheckStopCond( float _fSample, LSN_STREAMING &_sStream );
+		void															WriteStreamSamples( const float * _pfSamples, size_t _sTotal );
 
 		/**
 		 * Performs no conversion.  Input is directly sent to the file stream.
@@ -1574,7 +1493,7 @@ namespace lsn {
 		 **/
 		static inline void LSN_STDCALL									BatchF32ToPcm24( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
 
-#ifdef __AVX2__
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
 		/**
 		 * Converts a batch of floats to 8-bit PCM using AVX 2.
 		 * 
@@ -1582,7 +1501,7 @@ namespace lsn {
 		 * \param _vOut The output samples.
 		 * \param _sStream The stream data.
 		 **/
-		static inline void LSN_STDCALL									BatchF32ToPcm8_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
+		static void LSN_STDCALL										BatchF32ToPcm8_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
 
 		/**
 		 * Converts a batch of floats to 16-bit PCM using AVX 2.
@@ -1591,7 +1510,7 @@ namespace lsn {
 		 * \param _vOut The output samples.
 		 * \param _sStream The stream data.
 		 **/
-		static inline void LSN_STDCALL									BatchF32ToPcm16_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
+		static void LSN_STDCALL										BatchF32ToPcm16_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
 
 		/**
 		 * Converts a batch of floats to 24-bit PCM using AVX 2.
@@ -1600,17 +1519,16 @@ namespace lsn {
 		 * \param _vOut The output samples.
 		 * \param _sStream The stream data.
 		 **/
-		static inline void LSN_STDCALL									BatchF32ToPcm24_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
-#endif	// #ifdef __AVX2__
+		static void LSN_STDCALL										BatchF32ToPcm24_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
 
-#ifdef __AVX512F__
-		/* Converts a batch of floats to 8-bit PCM using AVX-512.
+		/**
+		 * Converts a batch of floats to 8-bit PCM using AVX-512.
 		 * 
 		 * \param _vSrc The input samples.
 		 * \param _vOut The output samples.
 		 * \param _sStream The stream data.
 		 **/
-		static inline void LSN_STDCALL									BatchF32ToPcm8_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
+		static void LSN_STDCALL										BatchF32ToPcm8_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
 
 		/**
 		 * Converts a batch of floats to 16-bit PCM using AVX-512.
@@ -1619,7 +1537,7 @@ namespace lsn {
 		 * \param _vOut The output samples.
 		 * \param _sStream The stream data.
 		 **/
-		static inline void LSN_STDCALL									BatchF32ToPcm16_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
+		static void LSN_STDCALL										BatchF32ToPcm16_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
 
 		/**
 		 * Converts a batch of floats to 24-bit PCM using AVX-512.
@@ -1628,8 +1546,46 @@ namespace lsn {
 		 * \param _vOut The output samples.
 		 * \param _sStream The stream data.
 		 **/
-		static inline void LSN_STDCALL									BatchF32ToPcm24_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
-#endif	// #ifdef __AVX512F__
+		static void LSN_STDCALL										BatchF32ToPcm24_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream );
+
+		/**
+		 * Converts doubles to 16-bit PCM using AVX-512, 8 at a time.
+		 *
+		 * \param _pdSrc The input samples.
+		 * \param _pi16Dst The output samples.
+		 * \param _sTotal The number of input samples.
+		 * \return Returns the number of samples converted, which is _sTotal rounded down to a multiple of 8.
+		 **/
+		static size_t													F64ToI16_AVX512( const double * _pdSrc, int16_t * _pi16Dst, size_t _sTotal );
+
+		/**
+		 * Converts doubles to 32-bit PCM using AVX-512, 8 at a time.
+		 *
+		 * \param _pdSrc The input samples.
+		 * \param _pi32Dst The output samples.
+		 * \param _sTotal The number of input samples.
+		 * \return Returns the number of samples converted, which is _sTotal rounded down to a multiple of 8.
+		 **/
+		static size_t													F64ToI32_AVX512( const double * _pdSrc, int32_t * _pi32Dst, size_t _sTotal );
+#endif	// #if defined( __i386__ ) || defined( __x86_64__ ) || defined( _MSC_VER )
+
+		/**
+		 * Determines whether the AVX 2 converters (LSNWavFile_AVX2.cpp) can be used.
+		 *
+		 * \return Returns true if the processor supports the instruction sets the AVX 2 converters are built for.
+		 **/
+		static inline bool												Avx2Supported() {
+			return CUtilities::IsAvx2Supported() && CUtilities::IsFmaSupported();
+		}
+
+		/**
+		 * Determines whether the AVX-512 converters (LSNWavFile_AVX512.cpp) can be used.
+		 *
+		 * \return Returns true if the processor supports the instruction sets the AVX-512 converters are built for.
+		 **/
+		static inline bool												Avx512Supported() {
+			return CUtilities::IsAvx512FSupported() && CUtilities::IsAvx512BWSupported() && Avx2Supported();
+		}
 		
 #pragma optimize( "", on )
 	};
@@ -1773,259 +1729,5 @@ namespace lsn {
 		catch ( ... ) {}
 	}
 
-#ifdef __AVX2__
-	/**
-	 * Converts a batch of floats to 8-bit PCM using AVX 2.
-	 * 
-	 * \param _vSrc The input samples.
-	 * \param _vOut The output samples.
-	 * \param _sStream The stream data.
-	 **/
-	inline void LSN_STDCALL CWavFile::BatchF32ToPcm8_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
-		try {
-			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
-			size_t sSize = _vSrc.size();
-			if LSN_UNLIKELY( _vOut.size() < sSize ) {
-				_vOut.resize( sSize );
-			}
-			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
-			size_t I = 0;
-			constexpr size_t sRegSize = sizeof( __m256 ) / sizeof( float );
-			if LSN_LIKELY( sSize >= sRegSize ) {
-				size_t sTotal = sSize - sRegSize;
-				while ( I <= sTotal ) {
-					CUtilities::SampleToUi8_AVX2( &_vSrc[I], &_vOut[I] );
-					I += sRegSize;
-				}
-			}
-
-			for ( ; I < sSize; ++I ) {
-				_vOut[I] = CUtilities::SampleToUi8( _vSrc[I] );
-			}
-
-			_sStream.sfFile.WriteToFile( _vOut.data(),
-				_vSrc.size() );
-		}
-		catch ( ... ) {}
-	}
-
-	/**
-	 * Converts a batch of floats to 16-bit PCM using AVX 2.
-	 * 
-	 * \param _vSrc The input samples.
-	 * \param _vOut The output samples.
-	 * \param _sStream The stream data.
-	 **/
-	inline void LSN_STDCALL CWavFile::BatchF32ToPcm16_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
-		try {
-			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
-			size_t sSize = _vSrc.size();
-			if LSN_UNLIKELY( _vOut.size() < sSize << 1 ) {
-				_vOut.resize( _vSrc.size() << 1 );
-			}
-			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
-			size_t I = 0;
-			constexpr size_t sRegSize = sizeof( __m256 ) / sizeof( float );
-			if LSN_LIKELY( sSize >= sRegSize ) {
-				size_t sTotal = sSize - sRegSize;
-				while ( I <= sTotal ) {
-					CUtilities::SampleToI16_AVX2( &_vSrc[I], reinterpret_cast<int16_t *>(&_vOut[I<<1]) );
-					I += sRegSize;
-				}
-			}
-
-			for ( ; I < sSize; ++I ) {
-				(*reinterpret_cast<int16_t *>(&_vOut[I<<1])) = CUtilities::SampleToI16( _vSrc[I] );
-			}
-
-			_sStream.sfFile.WriteToFile( _vOut.data(),
-				_vSrc.size() * sizeof( uint16_t ) );
-		}
-		catch ( ... ) {}
-	}
-
-	/**
-	 * Converts a batch of floats to 24-bit PCM using AVX 2.
-	 * 
-	 * \param _vSrc The input samples.
-	 * \param _vOut The output samples.
-	 * \param _sStream The stream data.
-	 **/
-	inline void LSN_STDCALL CWavFile::BatchF32ToPcm24_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
-		try {
-			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
-			size_t sSize = _vSrc.size();
-			if LSN_UNLIKELY( _vOut.size() < sSize * 3 ) {
-				_vOut.resize( sSize * 3 );
-			}
-			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
-			
-
-			size_t I = 0;
-			constexpr size_t sRegSize = sizeof( __m256 ) / sizeof( float );
-			LSN_ALIGN( 32 )
-			int32_t i32uffer[sRegSize];
-			if LSN_LIKELY( sSize >= sRegSize ) {
-				size_t sTotal = sSize - sRegSize;
-				while ( I <= sTotal ) {
-					CUtilities::SampleToI24_AVX2( &_vSrc[I], i32uffer );
-					for ( size_t J = 0; J < (sRegSize - 1); ++J ) {
-						auto sIdx = (I + J) * 3;
-						(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32uffer[J];
-					}
-					(*reinterpret_cast<int16_t *>(&_vOut[(I+(sRegSize - 1))*3])) = int16_t( i32uffer[(sRegSize-1)] );
-					_vOut[(I+(sRegSize - 1))*3+2] = int8_t( i32uffer[(sRegSize-1)] >> 16 );
-					I += sRegSize;
-				}
-				
-			}
-			if LSN_UNLIKELY( sSize > I ) {	// Unlikely because almost always we will be passing in buffers that are a size divisible by 8 (sRegSize).
-				--sSize;
-				for ( ; I < sSize; ++I ) {
-					int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
-					auto sIdx = I * 3;
-					(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32Tmp;
-				}
-
-				// Last one has to be carefully constructed.
-				int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
-				auto sIdx = I * 3;
-				(*reinterpret_cast<int16_t *>(&_vOut[sIdx])) = int16_t( i32Tmp );
-				_vOut[sIdx+2] = uint8_t( i32Tmp >> 16 );
-			}
-
-			_sStream.sfFile.WriteToFile( _vOut.data(),
-				_vSrc.size() * 3 );
-		}
-		catch ( ... ) {}
-	}
-#endif	// #ifdef __AVX2__
-
-#ifdef __AVX512F__
-		/* Converts a batch of floats to 8-bit PCM using AVX-512.
-		 * 
-		 * \param _vSrc The input samples.
-		 * \param _vOut The output samples.
-		 * \param _sStream The stream data.
-		 **/
-		inline void LSN_STDCALL CWavFile::BatchF32ToPcm8_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
-			try {
-			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
-			size_t sSize = _vSrc.size();
-			if LSN_UNLIKELY( _vOut.size() < sSize ) {
-				_vOut.resize( sSize );
-			}
-			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
-			size_t I = 0;
-			constexpr size_t sRegSize = sizeof( __m512 ) / sizeof( float );
-			if LSN_LIKELY( sSize >= sRegSize ) {
-				size_t sTotal = sSize - sRegSize;
-				while ( I <= sTotal ) {
-					CUtilities::SampleToUi8_AVX512( &_vSrc[I], &_vOut[I] );
-					I += sRegSize;
-				}
-			}
-
-			for ( ; I < sSize; ++I ) {
-				_vOut[I] = CUtilities::SampleToUi8( _vSrc[I] );
-			}
-
-			_sStream.sfFile.WriteToFile( _vOut.data(),
-				_vSrc.size() );
-		}
-		catch ( ... ) {}
-		}
-
-		/**
-		 * Converts a batch of floats to 16-bit PCM using AVX-512.
-		 * 
-		 * \param _vSrc The input samples.
-		 * \param _vOut The output samples.
-		 * \param _sStream The stream data.
-		 **/
-		inline void LSN_STDCALL CWavFile::BatchF32ToPcm16_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
-			try {
-			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
-			size_t sSize = _vSrc.size();
-			if LSN_UNLIKELY( _vOut.size() < sSize << 1 ) {
-				_vOut.resize( _vSrc.size() << 1 );
-			}
-			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
-			size_t I = 0;
-			constexpr size_t sRegSize = sizeof( __m512 ) / sizeof( float );
-			if LSN_LIKELY( sSize >= sRegSize ) {
-				size_t sTotal = sSize - sRegSize;
-				while ( I <= sTotal ) {
-					CUtilities::SampleToI16_AVX512( &_vSrc[I], reinterpret_cast<int16_t *>(&_vOut[I<<1]) );
-					I += sRegSize;
-				}
-			}
-
-			for ( ; I < sSize; ++I ) {
-				(*reinterpret_cast<int16_t *>(&_vOut[I<<1])) = CUtilities::SampleToI16( _vSrc[I] );
-			}
-
-			_sStream.sfFile.WriteToFile( _vOut.data(),
-				_vSrc.size() * sizeof( uint16_t ) );
-		}
-		catch ( ... ) {}
-		}
-
-		/**
-		 * Converts a batch of floats to 24-bit PCM using AVX-512.
-		 * 
-		 * \param _vSrc The input samples.
-		 * \param _vOut The output samples.
-		 * \param _sStream The stream data.
-		 **/
-		inline void LSN_STDCALL CWavFile::BatchF32ToPcm24_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
-			try {
-			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
-			size_t sSize = _vSrc.size();
-			if LSN_UNLIKELY( _vOut.size() < sSize * 3 ) {
-				_vOut.resize( sSize * 3 );
-			}
-			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
-			
-
-			size_t I = 0;
-			constexpr size_t sRegSize = sizeof( __m512 ) / sizeof( float );
-			LSN_ALIGN( 64 )
-			int32_t i32uffer[sRegSize];
-			if LSN_LIKELY( sSize >= sRegSize ) {
-				size_t sTotal = sSize - sRegSize;
-				while ( I <= sTotal ) {
-					CUtilities::SampleToI24_AVX512( &_vSrc[I], i32uffer );
-					for ( size_t J = 0; J < (sRegSize - 1); ++J ) {
-						auto sIdx = (I + J) * 3;
-						(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32uffer[J];
-					}
-					(*reinterpret_cast<int16_t *>(&_vOut[(I+(sRegSize - 1))*3])) = int16_t( i32uffer[(sRegSize-1)] );
-					_vOut[(I+(sRegSize - 1))*3+2] = int8_t( i32uffer[(sRegSize-1)] >> 16 );
-					I += sRegSize;
-				}
-				
-			}
-			if LSN_UNLIKELY( sSize ) {	// Unlikely because almost always we will be passing in buffers that are a size divisible by 8 (sRegSize).
-				--sSize;
-				for ( ; I < sSize; ++I ) {
-					int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
-					auto sIdx = I * 3;
-					(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32Tmp;
-				}
-
-				// Last one has to be carefully constructed.
-				int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
-				auto sIdx = I * 3;
-				(*reinterpret_cast<int16_t *>(&_vOut[sIdx])) = int16_t( i32Tmp );
-				_vOut[sIdx+2] = uint8_t( i32Tmp >> 16 );
-			}
-
-			_sStream.sfFile.WriteToFile( _vOut.data(),
-				_vSrc.size() * 3 );
-		}
-		catch ( ... ) {}
-		}
-#endif	// #ifdef __AVX512F__
 
 }	// namespace lsn
@@ -0,0 +1,217 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX 2 versions of the CWavFile batch converters.  Built without depending on the project-wide instruction set
+ *	so that CWavFile can select them at run-time.
+ */
+
+#include "LSNWavFile.h"
+#include "../Filters/LSNFilterKernels.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Converts a sample from a floating-point format to a uint8_t.  8-bit PCM data is expressed as an unsigned value over the range 0 to 255, 128 being an
+	 *	audio output level of zero.
+	 * 
+	 * \param _pfSample Pointer to the samples to convert.
+	 * \param _pui8Dst Pointer to the output.
+	 * \return Returns the converted sample.
+	 **/
+	static inline LSN_TARGET_AVX2 void						SampleToUi8_AVX2( const float * _pfSample, uint8_t * _pui8Dst ) {
+		auto vSamples	= _mm256_loadu_ps( _pfSample );
+		auto vClamped	= _mm256_max_ps( _mm256_set1_ps( -1.0f ), _mm256_min_ps( vSamples, _mm256_set1_ps( 1.0f ) ) );
+		auto vScaled	= _mm256_mul_ps( _mm256_mul_ps( _mm256_add_ps( vClamped, _mm256_set1_ps( 1.0f ) ), _mm256_set1_ps( 0.5f ) ), _mm256_set1_ps( 255.0f ) );
+		auto vRounded	= _mm256_round_ps( vScaled, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+		// Paack into 8-bit PCM values.
+		auto vInt32Vals = _mm256_cvtps_epi32( vRounded );
+
+		auto vLo		= _mm256_castsi256_si128( vInt32Vals );					// Lower 128 bits.
+		auto vHi		= _mm256_extracti128_si256( vInt32Vals, 1 );			// Upper 128 bits.
+		auto vPacked16	= _mm_packus_epi32( vLo, vHi );
+
+		// Finally, pack the 16-bit integers into 8-bit integers and store the low 8.
+		auto vPacked8	= _mm_packus_epi16( vPacked16, vPacked16 );
+		_mm_storel_epi64( reinterpret_cast<__m128i *>(_pui8Dst), vPacked8 );
+	}
+
+	/**
+	 * Converts a sample from a floating-point format to an int16_t.  16-bit PCM data is expressed as a signed value over the
+	 *	range -32768 to 32767, 0 being an audio output level of zero.  Note that both -32768 and -32767 are -1.0; a proper
+	 *	conversion never generates -32768.
+	 * 
+	 * \param _pfSample Pointer to the samples to convert.
+	 * \param _pi16Dst Pointer to the output.
+	 * \return Returns the converted sample.
+	 **/
+	static inline LSN_TARGET_AVX2 void						SampleToI16_AVX2( const float * _pfSample, int16_t * _pi16Dst ) {
+		auto vSamples	= _mm256_loadu_ps( _pfSample );
+		auto vClamped	= _mm256_max_ps( _mm256_set1_ps( -1.0f ), _mm256_min_ps( vSamples, _mm256_set1_ps( 1.0f ) ) );
+		auto vScaled	= _mm256_mul_ps( vClamped, _mm256_set1_ps( 32767.0f ) );
+		auto vRounded	= _mm256_round_ps( vScaled, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+
+		auto vInt32Vals	= _mm256_cvtps_epi32( vRounded );
+    
+		// Extract the lower and upper 128-bit lanes.
+		auto vLo		= _mm256_castsi256_si128( vInt32Vals );					// Lower 4 integers.
+		auto vHi		= _mm256_extracti128_si256( vInt32Vals, 1 );			// Upper 4 integers.
+		auto vPacked16	= _mm_packs_epi32( vLo, vHi );
+    
+		_mm_storeu_si128( reinterpret_cast<__m128i *>(_pi16Dst), vPacked16 );
+	}
+
+	/**
+	 * Converts a sample from a floating-point format to an int32_t.  24-bit PCM data is expressed as a signed value over the
+	 *	range -8388607 to 8388607, 0 being an audio output level of zero.  Note that both -8388608 and -8388607 are -1.0; a proper
+	 *	conversion never generates -8388608.
+	 *
+	 * \param _pfSample Pointer to the samples to convert.
+	 * \param _pi32Dst Pointer to the output.  Must be aligned to a 32-byte boundary.
+	 * \return Returns the converted sample.
+	 **/
+	static inline LSN_TARGET_AVX2 void						SampleToI24_AVX2( const float * _pfSample, int32_t * _pi32Dst ) {
+		auto vSamples	= _mm256_loadu_ps( _pfSample );
+		auto vClamped	= _mm256_max_ps( _mm256_set1_ps( -1.0f ), _mm256_min_ps( vSamples, _mm256_set1_ps( 1.0f ) ) );
+		auto vScaled	= _mm256_mul_ps( vClamped, _mm256_set1_ps( 8388607.0f ) );
+		auto vRounded	= _mm256_round_ps( vScaled, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+
+		auto vInt32Vals	= _mm256_cvtps_epi32( vRounded );
+		_mm256_store_si256( reinterpret_cast<__m256i *>(_pi32Dst), vInt32Vals );
+	}
+
+	/**
+	 * Converts a batch of floats to 8-bit PCM using AVX 2.
+	 * 
+	 * \param _vSrc The input samples.
+	 * \param _vOut The output samples.
+	 * \param _sStream The stream data.
+	 **/
+	LSN_TARGET_AVX2 void LSN_STDCALL CWavFile::BatchF32ToPcm8_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
+		try {
+			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
+			size_t sSize = _vSrc.size();
+			if LSN_UNLIKELY( _vOut.size() < sSize ) {
+				_vOut.resize( sSize );
+			}
+			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
+			size_t I = 0;
+			constexpr size_t sRegSize = sizeof( __m256 ) / sizeof( float );
+			if LSN_LIKELY( sSize >= sRegSize ) {
+				size_t sTotal = sSize - sRegSize;
+				while ( I <= sTotal ) {
+					SampleToUi8_AVX2( &_vSrc[I], &_vOut[I] );
+					I += sRegSize;
+				}
+			}
+
+			for ( ; I < sSize; ++I ) {
+				_vOut[I] = CUtilities::SampleToUi8( _vSrc[I] );
+			}
+
+			_sStream.sfFile.WriteToFile( _vOut.data(),
+				_vSrc.size() );
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Converts a batch of floats to 16-bit PCM using AVX 2.
+	 * 
+	 * \param _vSrc The input samples.
+	 * \param _vOut The output samples.
+	 * \param _sStream The stream data.
+	 **/
+	LSN_TARGET_AVX2 void LSN_STDCALL CWavFile::BatchF32ToPcm16_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
+		try {
+			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
+			size_t sSize = _vSrc.size();
+			if LSN_UNLIKELY( _vOut.size() < sSize << 1 ) {
+				_vOut.resize( _vSrc.size() << 1 );
+			}
+			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
+			size_t I = 0;
+			constexpr size_t sRegSize = sizeof( __m256 ) / sizeof( float );
+			if LSN_LIKELY( sSize >= sRegSize ) {
+				size_t sTotal = sSize - sRegSize;
+				while ( I <= sTotal ) {
+					SampleToI16_AVX2( &_vSrc[I], reinterpret_cast<int16_t *>(&_vOut[I<<1]) );
+					I += sRegSize;
+				}
+			}
+
+			for ( ; I < sSize; ++I ) {
+				(*reinterpret_cast<int16_t *>(&_vOut[I<<1])) = CUtilities::SampleToI16( _vSrc[I] );
+			}
+
+			_sStream.sfFile.WriteToFile( _vOut.data(),
+				_vSrc.size() * sizeof( uint16_t ) );
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Converts a batch of floats to 24-bit PCM using AVX 2.
+	 * 
+	 * \param _vSrc The input samples.
+	 * \param _vOut The output samples.
+	 * \param _sStream The stream data.
+	 **/
+	LSN_TARGET_AVX2 void LSN_STDCALL CWavFile::BatchF32ToPcm24_AVX2( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
+		try {
+			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
+			size_t sSize = _vSrc.size();
+			if LSN_UNLIKELY( _vOut.size() < sSize * 3 ) {
+				_vOut.resize( sSize * 3 );
+			}
+			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
+			
+
+			size_t I = 0;
+			constexpr size_t sRegSize = sizeof( __m256 ) / sizeof( float );
+			LSN_ALIGN( 32 )
+			int32_t i32uffer[sRegSize];
+			if LSN_LIKELY( sSize >= sRegSize ) {
+				size_t sTotal = sSize - sRegSize;
+				while ( I <= sTotal ) {
+					SampleToI24_AVX2( &_vSrc[I], i32uffer );
+					for ( size_t J = 0; J < (sRegSize - 1); ++J ) {
+						auto sIdx = (I + J) * 3;
+						(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32uffer[J];
+					}
+					(*reinterpret_cast<int16_t *>(&_vOut[(I+(sRegSize - 1))*3])) = int16_t( i32uffer[(sRegSize-1)] );
+					_vOut[(I+(sRegSize - 1))*3+2] = int8_t( i32uffer[(sRegSize-1)] >> 16 );
+					I += sRegSize;
+				}
+				
+			}
+			if LSN_UNLIKELY( sSize > I ) {	// Unlikely because almost always we will be passing in buffers that are a size divisible by 8 (sRegSize).
+				--sSize;
+				for ( ; I < sSize; ++I ) {
+					int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
+					auto sIdx = I * 3;
+					(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32Tmp;
+				}
+
+				// Last one has to be carefully constructed.
+				int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
+				auto sIdx = I * 3;
+				(*reinterpret_cast<int16_t *>(&_vOut[sIdx])) = int16_t( i32Tmp );
+				_vOut[sIdx+2] = uint8_t( i32Tmp >> 16 );
+			}
+
+			_sStream.sfFile.WriteToFile( _vOut.data(),
+				_vSrc.size() * 3 );
+		}
+		catch ( ... ) {}
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
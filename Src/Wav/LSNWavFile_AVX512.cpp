@@ -0,0 +1,276 @@
+/**
+ * Copyright L. Spiro 2026
+ *
+ * Written by: Shawn (L. Spiro) Wilcoxen
+ *
+ * Description: The AVX-512 versions of the CWavFile batch converters.  Built without depending on the project-wide instruction set
+ *	so that CWavFile can select them at run-time.
+ */
+
+#include "LSNWavFile.h"
+#include "../Filters/LSNFilterKernels.h"
+
+#ifdef LSN_FILTER_KERNELS_X86
+#include <immintrin.h>
+
+
+namespace lsn {
+
+	// == Functions.
+	/**
+	 * Converts a sample from a floating-point format to a uint8_t.  8-bit PCM data is expressed as an unsigned value over the range 0 to 255, 128 being an
+	 *	audio output level of zero.
+	 * 
+	 * \param _pfSample Pointer to the samples to convert.
+	 * \param _pui8Dst Pointer to the output.
+	 * \return Returns the converted sample.
+	 **/
+	static inline LSN_TARGET_AVX512 void						SampleToUi8_AVX512( const float * _pfSample, uint8_t * _pui8Dst ) {
+		auto vSamples   = _mm512_loadu_ps( _pfSample );
+		auto vClamped   = _mm512_max_ps( _mm512_set1_ps( -1.0f ), _mm512_min_ps( vSamples, _mm512_set1_ps( 1.0f ) ) );
+		auto vScaled    = _mm512_mul_ps( _mm512_mul_ps( _mm512_add_ps( vClamped, _mm512_set1_ps( 1.0f ) ), _mm512_set1_ps( 0.5f ) ), _mm512_set1_ps( 255.0f ) );
+		auto vRounded	= _mm512_roundscale_ps( vScaled, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+		// Pack into 8-bit PCM values.
+		auto vInt32Vals = _mm512_cvtps_epi32( vRounded );
+		
+		// Narrow to 8 bits.  The values are already in range, so the truncation is exact and the samples stay in order.
+		_mm_storeu_si128( reinterpret_cast<__m128i *>(_pui8Dst), _mm512_cvtepi32_epi8( vInt32Vals ) );
+	}
+
+	/**
+	 * Converts a sample from a floating-point format to an int16_t.  16-bit PCM data is expressed as a signed value over the
+	 *	range -32768 to 32767, 0 being an audio output level of zero.  Note that both -32768 and -32767 are -1.0; a proper
+	 *	conversion never generates -32768.
+	 * 
+	 * \param _pfSample Pointer to the samples to convert.
+	 * \param _pi16Dst Pointer to the output.
+	 * \return Returns the converted sample.
+	 **/
+	static inline LSN_TARGET_AVX512 void						SampleToI16_AVX512( const float * _pfSample, int16_t * _pi16Dst ) {
+		auto vSamples   = _mm512_loadu_ps( _pfSample );
+
+		auto vClamped   = _mm512_max_ps( _mm512_set1_ps( -1.0f ), _mm512_min_ps( vSamples, _mm512_set1_ps( 1.0f ) ) );
+		auto vScaled    = _mm512_mul_ps( vClamped, _mm512_set1_ps( 32767.0f ) );
+		auto vRounded	= _mm512_roundscale_ps( vScaled, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+
+		auto vInt32Vals = _mm512_cvtps_epi32( vRounded );
+
+		auto vPacked16  = _mm512_cvtepi32_epi16( vInt32Vals );
+    
+		_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pi16Dst), vPacked16 );
+	}
+
+	/**
+	 * Converts a sample from a floating-point format to an int32_t.  24-bit PCM data is expressed as a signed value over the
+	 *	range -8388607 to 8388607, 0 being an audio output level of zero.  Note that both -8388608 and -8388607 are -1.0; a proper
+	 *	conversion never generates -8388608.
+	 *
+	 * \param _pfSample Pointer to the samples to convert.
+	 * \param _pi32Dst Pointer to the output.  Must be aligned to a 64-byte boundary.
+	 * \return Returns the converted sample.
+	 **/
+	static inline LSN_TARGET_AVX512 void						SampleToI24_AVX512( const float * _pfSample, int32_t * _pi32Dst ) {
+		auto vSamples   = _mm512_loadu_ps( _pfSample );
+		auto vClamped   = _mm512_max_ps( _mm512_set1_ps( -1.0f ), _mm512_min_ps( vSamples, _mm512_set1_ps( 1.0f ) ) );
+		auto vScaled    = _mm512_mul_ps( vClamped, _mm512_set1_ps( 8388607.0f ) );
+		auto vRounded	= _mm512_roundscale_ps( vScaled, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+		
+		auto vInt32Vals = _mm512_cvtps_epi32( vRounded );
+		_mm512_store_si512( reinterpret_cast<__m512i *>(_pi32Dst), vInt32Vals );
+	}
+
+	/**
+	 * Converts a batch of floats to 8-bit PCM using AVX-512.
+	 * 
+	 * \param _vSrc The input samples.
+	 * \param _vOut The output samples.
+	 * \param _sStream The stream data.
+	 **/
+	LSN_TARGET_AVX512 void LSN_STDCALL CWavFile::BatchF32ToPcm8_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
+		try {
+			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
+			size_t sSize = _vSrc.size();
+			if LSN_UNLIKELY( _vOut.size() < sSize ) {
+				_vOut.resize( sSize );
+			}
+			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
+			size_t I = 0;
+			constexpr size_t sRegSize = sizeof( __m512 ) / sizeof( float );
+			if LSN_LIKELY( sSize >= sRegSize ) {
+				size_t sTotal = sSize - sRegSize;
+				while ( I <= sTotal ) {
+					SampleToUi8_AVX512( &_vSrc[I], &_vOut[I] );
+					I += sRegSize;
+				}
+			}
+
+			for ( ; I < sSize; ++I ) {
+				_vOut[I] = CUtilities::SampleToUi8( _vSrc[I] );
+			}
+
+			_sStream.sfFile.WriteToFile( _vOut.data(),
+				_vSrc.size() );
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Converts a batch of floats to 16-bit PCM using AVX-512.
+	 * 
+	 * \param _vSrc The input samples.
+	 * \param _vOut The output samples.
+	 * \param _sStream The stream data.
+	 **/
+	LSN_TARGET_AVX512 void LSN_STDCALL CWavFile::BatchF32ToPcm16_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
+		try {
+			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
+			size_t sSize = _vSrc.size();
+			if LSN_UNLIKELY( _vOut.size() < sSize << 1 ) {
+				_vOut.resize( _vSrc.size() << 1 );
+			}
+			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
+			size_t I = 0;
+			constexpr size_t sRegSize = sizeof( __m512 ) / sizeof( float );
+			if LSN_LIKELY( sSize >= sRegSize ) {
+				size_t sTotal = sSize - sRegSize;
+				while ( I <= sTotal ) {
+					SampleToI16_AVX512( &_vSrc[I], reinterpret_cast<int16_t *>(&_vOut[I<<1]) );
+					I += sRegSize;
+				}
+			}
+
+			for ( ; I < sSize; ++I ) {
+				(*reinterpret_cast<int16_t *>(&_vOut[I<<1])) = CUtilities::SampleToI16( _vSrc[I] );
+			}
+
+			_sStream.sfFile.WriteToFile( _vOut.data(),
+				_vSrc.size() * sizeof( uint16_t ) );
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Converts a batch of floats to 24-bit PCM using AVX-512.
+	 * 
+	 * \param _vSrc The input samples.
+	 * \param _vOut The output samples.
+	 * \param _sStream The stream data.
+	 **/
+	LSN_TARGET_AVX512 void LSN_STDCALL CWavFile::BatchF32ToPcm24_AVX512( const std::vector<float> &_vSrc, std::vector<uint8_t> &_vOut, LSN_STREAMING &_sStream ) {
+		try {
+			if LSN_UNLIKELY( !_vSrc.size() ) { _vOut.clear(); return; }
+			size_t sSize = _vSrc.size();
+			if LSN_UNLIKELY( _vOut.size() < sSize * 3 ) {
+				_vOut.resize( sSize * 3 );
+			}
+			LSN_PREFETCH_LINE( _vSrc.data() + (sSize >> 1) );
+			
+
+			size_t I = 0;
+			constexpr size_t sRegSize = sizeof( __m512 ) / sizeof( float );
+			LSN_ALIGN( 64 )
+			int32_t i32uffer[sRegSize];
+			if LSN_LIKELY( sSize >= sRegSize ) {
+				size_t sTotal = sSize - sRegSize;
+				while ( I <= sTotal ) {
+					SampleToI24_AVX512( &_vSrc[I], i32uffer );
+					for ( size_t J = 0; J < (sRegSize - 1); ++J ) {
+						auto sIdx = (I + J) * 3;
+						(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32uffer[J];
+					}
+					(*reinterpret_cast<int16_t *>(&_vOut[(I+(sRegSize - 1))*3])) = int16_t( i32uffer[(sRegSize-1)] );
+					_vOut[(I+(sRegSize - 1))*3+2] = int8_t( i32uffer[(sRegSize-1)] >> 16 );
+					I += sRegSize;
+				}
+				
+			}
+			if LSN_UNLIKELY( sSize > I ) {	// Unlikely because almost always we will be passing in buffers that are a size divisible by 16 (sRegSize).
+				--sSize;
+				for ( ; I < sSize; ++I ) {
+					int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
+					auto sIdx = I * 3;
+					(*reinterpret_cast<int32_t *>(&_vOut[sIdx])) = i32Tmp;
+				}
+
+				// Last one has to be carefully constructed.
+				int32_t i32Tmp = CUtilities::SampleToI24( _vSrc[I] );
+				auto sIdx = I * 3;
+				(*reinterpret_cast<int16_t *>(&_vOut[sIdx])) = int16_t( i32Tmp );
+				_vOut[sIdx+2] = uint8_t( i32Tmp >> 16 );
+			}
+
+			_sStream.sfFile.WriteToFile( _vOut.data(),
+				_vSrc.size() * 3 );
+		}
+		catch ( ... ) {}
+	}
+
+	/**
+	 * Converts doubles to 16-bit PCM using AVX-512, 8 at a time.
+	 *
+	 * \param _pdSrc The input samples.
+	 * \param _pi16Dst The output samples.
+	 * \param _sTotal The number of input samples.
+	 * \return Returns the number of samples converted, which is _sTotal rounded down to a multiple of 8.
+	 **/
+	LSN_TARGET_AVX512 size_t CWavFile::F64ToI16_AVX512( const double * _pdSrc, int16_t * _pi16Dst, size_t _sTotal ) {
+		__m512d vdFactor = _mm512_set1_pd( 32767.0 );
+		__m512d vdMin = _mm512_set1_pd( -1.0 );
+		__m512d vdMax = _mm512_set1_pd( 1.0 );
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			__m512d vdSamples = _mm512_loadu_pd( _pdSrc + I );
+
+			// Clamp samples between -1.0 and 1.0.
+			vdSamples = _mm512_max_pd( vdSamples, vdMin );
+			vdSamples = _mm512_min_pd( vdSamples, vdMax );
+
+			// Multiply by scaling factor.
+			vdSamples = _mm512_mul_pd( vdSamples, vdFactor );
+
+			// Round to nearest integer and convert to int32_t
+			__m256i viInt32 = _mm512_cvt_roundpd_epi32( vdSamples, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+
+			// Convert int32_t to int16_t with saturation.
+			__m128i viInt16 = _mm_packs_epi32( _mm256_castsi256_si128( viInt32 ), _mm256_extracti128_si256( viInt32, 1 ) );
+
+			_mm_storeu_si128( reinterpret_cast<__m128i *>(_pi16Dst + I), viInt16 );
+		}
+		return I;
+	}
+
+	/**
+	 * Converts doubles to 32-bit PCM using AVX-512, 8 at a time.
+	 *
+	 * \param _pdSrc The input samples.
+	 * \param _pi32Dst The output samples.
+	 * \param _sTotal The number of input samples.
+	 * \return Returns the number of samples converted, which is _sTotal rounded down to a multiple of 8.
+	 **/
+	LSN_TARGET_AVX512 size_t CWavFile::F64ToI32_AVX512( const double * _pdSrc, int32_t * _pi32Dst, size_t _sTotal ) {
+		__m512d vdFactor = _mm512_set1_pd( 2147483647.0 );
+		__m512d vdMin = _mm512_set1_pd( -1.0 );
+		__m512d vdMax = _mm512_set1_pd( 1.0 );
+		size_t I = 0;
+		for ( ; I + 8 <= _sTotal; I += 8 ) {
+			__m512d vdSamples = _mm512_loadu_pd( _pdSrc + I );
+
+			// Clamp samples between -1.0 and 1.0.
+			vdSamples = _mm512_max_pd( vdSamples, vdMin );
+			vdSamples = _mm512_min_pd( vdSamples, vdMax );
+
+			// Multiply by scaling factor.
+			vdSamples = _mm512_mul_pd( vdSamples, vdFactor );
+
+			// Round to nearest integer and convert to int32_t
+			__m256i viInt32 = _mm512_cvt_roundpd_epi32( vdSamples, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+
+			// Store the int32_t samples.
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>(_pi32Dst + I), viInt32 );
+		}
+		return I;
+	}
+
+}	// namespace lsn
+
+#endif	// #ifdef LSN_FILTER_KERNELS_X86
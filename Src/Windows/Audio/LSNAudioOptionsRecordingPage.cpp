@@ -353,7 +353,13 @@ namespace lsn {
 		ee::CExpEvalContainer::EE_RESULT eTest;
 		aEdit = FindChild( Layout::LSN_AOWI_PAGE_RAW_START_COMBO );
 		if ( aEdit && bEnabled && lStartCond != CWavFile::LSN_SC_NONE && lStartCond != CWavFile::LSN_SC_FIRST_NON_ZERO ) {
-			if ( lStartCond == CWavFile::LSN_SC_START_AT_SAMPLE ) {
+			if ( lStartCond == CWavFile::LSN_SC_EXPRESSION ) {
+				if ( !CWavConditionExp::Test( aEdit->GetTextUTF8() ) ) {
+					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_EXPRESSION );
+					return aEdit;
+				}
+			}
+			else if ( lStartCond == CWavFile::LSN_SC_START_AT_SAMPLE ) {
 				if ( !aEdit->GetTextAsUInt64Expression( eTest ) ) {
 					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_START_COND );
 					return aEdit;
@@ -374,7 +380,13 @@ namespace lsn {
 		}
 		aEdit = FindChild( Layout::LSN_AOWI_PAGE_RAW_STOP_COMBO );
 		if ( aEdit && bEnabled && lEndCond != CWavFile::LSN_EC_NONE ) {
-			if ( lEndCond == CWavFile::LSN_EC_END_AT_SAMPLE ) {
+			if ( lEndCond == CWavFile::LSN_EC_EXPRESSION ) {
+				if ( !CWavConditionExp::Test( aEdit->GetTextUTF8() ) ) {
+					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_EXPRESSION );
+					return aEdit;
+				}
+			}
+			else if ( lEndCond == CWavFile::LSN_EC_END_AT_SAMPLE ) {
 				if ( !aEdit->GetTextAsUInt64Expression( eTest ) ) {
 					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_START_COND );
 					return aEdit;
@@ -425,7 +437,13 @@ namespace lsn {
 
 		aEdit = FindChild( Layout::LSN_AOWI_PAGE_OUT_START_COMBO );
 		if ( aEdit && bEnabled && lStartCond != CWavFile::LSN_SC_NONE && lStartCond != CWavFile::LSN_SC_FIRST_NON_ZERO ) {
-			if ( lStartCond == CWavFile::LSN_SC_START_AT_SAMPLE ) {
+			if ( lStartCond == CWavFile::LSN_SC_EXPRESSION ) {
+				if ( !CWavConditionExp::Test( aEdit->GetTextUTF8() ) ) {
+					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_EXPRESSION );
+					return aEdit;
+				}
+			}
+			else if ( lStartCond == CWavFile::LSN_SC_START_AT_SAMPLE ) {
 				if ( !aEdit->GetTextAsUInt64Expression( eTest ) ) {
 					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_START_COND );
 					return aEdit;
@@ -446,7 +464,13 @@ namespace lsn {
 		}
 		aEdit = FindChild( Layout::LSN_AOWI_PAGE_OUT_STOP_COMBO );
 		if ( aEdit && bEnabled && lEndCond != CWavFile::LSN_EC_NONE ) {
-			if ( lEndCond == CWavFile::LSN_EC_END_AT_SAMPLE ) {
+			if ( lEndCond == CWavFile::LSN_EC_EXPRESSION ) {
+				if ( !CWavConditionExp::Test( aEdit->GetTextUTF8() ) ) {
+					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_EXPRESSION );
+					return aEdit;
+				}
+			}
+			else if ( lEndCond == CWavFile::LSN_EC_END_AT_SAMPLE ) {
 				if ( !aEdit->GetTextAsUInt64Expression( eTest ) ) {
 					_wsMsg = LSN_LSTR( LSN_AUDIO_OPTIONS_ERR_INVALID_START_COND );
 					return aEdit;
@@ -573,6 +597,12 @@ namespace lsn {
 				}
 				break;
 			}
+			case CWavFile::LSN_SC_EXPRESSION : {
+				if ( aEdit ) {
+					m_poOptions->stfStreamOptionsRaw.sStartExp = aEdit->GetTextUTF8();
+				}
+				break;
+			}
 		}
 		
 		aEdit = FindChild( Layout::LSN_AOWI_PAGE_RAW_STOP_COMBO );
@@ -597,6 +627,12 @@ namespace lsn {
 				}
 				break;
 			}
+			case CWavFile::LSN_EC_EXPRESSION : {
+				if ( aEdit ) {
+					m_poOptions->stfStreamOptionsRaw.sEndExp = aEdit->GetTextUTF8();
+				}
+				break;
+			}
 		}
 
 
@@ -623,6 +659,12 @@ namespace lsn {
 				}
 				break;
 			}
+			case CWavFile::LSN_SC_EXPRESSION : {
+				if ( aEdit ) {
+					m_poOptions->stfStreamOptionsOutCapture.sStartExp = aEdit->GetTextUTF8();
+				}
+				break;
+			}
 		}
 		
 		aEdit = FindChild( Layout::LSN_AOWI_PAGE_OUT_STOP_COMBO );
@@ -647,6 +689,12 @@ namespace lsn {
 				}
 				break;
 			}
+			case CWavFile::LSN_EC_EXPRESSION : {
+				if ( aEdit ) {
+					m_poOptions->stfStreamOptionsOutCapture.sEndExp = aEdit->GetTextUTF8();
+				}
+				break;
+			}
 		}
 
 
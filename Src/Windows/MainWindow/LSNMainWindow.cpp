@@ -315,14 +315,8 @@ namespace lsn {
 						LoadZipRom( fpPath.u16sPath, fpPath.u16sFile );
 					}
 					else {
-						lsn::CStdFile sfFile;
 						std::u16string s16File = m_bnEmulator.RecentFiles()[_wId];
-						if ( sfFile.Open( s16File.c_str() ) ) {
-							std::vector<uint8_t> vExtracted;
-							if ( sfFile.LoadToMemory( vExtracted ) ) {
-								LoadRom( vExtracted, s16File );
-							}
-						}
+						LoadRom( s16File );
 					}
 				}
 			}
@@ -352,7 +346,9 @@ namespace lsn {
 								lsn::CZipFile zfFile;
 								if ( zfFile.Open( reinterpret_cast<const char16_t *>(ofnOpenFile.lpstrFile) ) ) {
 									std::vector<std::u16string> vFiles;
-									if ( zfFile.GatherArchiveFiles( vFiles ) ) {
+									// The ROM library already knows the contents of ZIP files it has indexed.
+									if ( m_bnEmulator.RomLibrary().ArchiveFiles( reinterpret_cast<const char16_t *>(ofnOpenFile.lpstrFile), vFiles ) ||
+										zfFile.GatherArchiveFiles( vFiles ) ) {
 										std::vector<std::u16string> vFinalFiles;
 										for ( size_t I = 0; I < vFiles.size(); ++I ) {
 											std::u16string s16Ext = lsn::CUtilities::GetFileExtension( vFiles[I] );
@@ -360,39 +356,24 @@ namespace lsn {
 												vFinalFiles.push_back( vFiles[I] );
 											}
 										}
-										std::vector<uint8_t> vExtracted;
 										DWORD dwIdx;
 										if ( vFinalFiles.size() == 1 ) {
 											dwIdx = 0;
-											zfFile.ExtractToMemory( vFinalFiles[dwIdx], vExtracted );
 										}
 										else {
 											dwIdx = CSelectRomDialogLayout::CreateSelectRomDialog( this, &vFinalFiles );
-											if ( dwIdx < DWORD( vFinalFiles.size() ) ) {
-												zfFile.ExtractToMemory( vFinalFiles[dwIdx], vExtracted );
-											}
-											else { return LSW_H_CONTINUE; }
+											if ( dwIdx >= DWORD( vFinalFiles.size() ) ) { return LSW_H_CONTINUE; }
 										}
-										std::u16string u16sPath = reinterpret_cast<const char16_t *>(ofnOpenFile.lpstrFile);
-										u16sPath += u"{";
-										u16sPath.append( vFinalFiles[dwIdx].c_str() );
-										u16sPath += u"}";
-										LoadRom( vExtracted, u16sPath );
+										LoadZipRom( zfFile, reinterpret_cast<const char16_t *>(ofnOpenFile.lpstrFile), vFinalFiles[dwIdx] );
 										return LSW_H_CONTINUE;
 									}
 								}
 								return LSW_H_CONTINUE;
 							}
 							else {
-								lsn::CStdFile sfFile;
 								std::u16string s16File = reinterpret_cast<const char16_t *>(ofnOpenFile.lpstrFile);
-								if ( sfFile.Open( s16File.c_str() ) ) {
-									std::vector<uint8_t> vExtracted;
-									if ( sfFile.LoadToMemory( vExtracted ) ) {
-										LoadRom( vExtracted, s16File );
-										return LSW_H_CONTINUE;
-									}
-								}
+								LoadRom( s16File );
+								return LSW_H_CONTINUE;
 							}
 						}
 					}
@@ -656,6 +637,10 @@ namespace lsn {
 				m_bnEmulator.SetCurFilter( CFilterBase::LSN_F_NTSC_CRT_FULL );
 				break;
 			}
+			case CMainWindowLayout::LSN_MWMI_VIDEO_FILTER_NTSC_CRT_FAST : {
+				m_bnEmulator.SetCurFilter( CFilterBase::LSN_F_NTSC_CRT_FAST );
+				break;
+			}
 			case CMainWindowLayout::LSN_MWMI_VIDEO_FILTER_PAL_CRT_FULL : {
 				m_bnEmulator.SetCurFilter( CFilterBase::LSN_F_PAL_CRT_FULL );
 				break;
@@ -1667,6 +1652,11 @@ namespace lsn {
 					::SetMenuItemInfoW( _hMenu, uiId, FALSE, &miiInfo );
 					break;
 				}
+				case CMainWindowLayout::LSN_MWMI_VIDEO_FILTER_NTSC_CRT_FAST : {
+					MENUITEMINFOW miiInfo = { .cbSize = sizeof( MENUITEMINFOW ), .fMask = MIIM_STATE, .fState = UINT( m_bnEmulator.GetCurFilter() == CFilterBase::LSN_F_NTSC_CRT_FAST ? MFS_CHECKED : MFS_UNCHECKED ) };
+					::SetMenuItemInfoW( _hMenu, uiId, FALSE, &miiInfo );
+					break;
+				}
 				case CMainWindowLayout::LSN_MWMI_VIDEO_FILTER_PAL_CRT_FULL : {
 					MENUITEMINFOW miiInfo = { .cbSize = sizeof( MENUITEMINFOW ), .fMask = MIIM_STATE, .fState = UINT( m_bnEmulator.GetCurFilter() == CFilterBase::LSN_F_PAL_CRT_FULL ? MFS_CHECKED : MFS_UNCHECKED ) };
 					::SetMenuItemInfoW( _hMenu, uiId, FALSE, &miiInfo );
@@ -1733,6 +1723,8 @@ namespace lsn {
 		{
 			lsw::CCriticalSection::CEnterCrit ecCrit( m_csRenderCrit );
 			m_bnEmulator.Swap( _bActuallySwap );
+			// The window already shows this frame.
+			if ( m_bnEmulator.RenderIsRedundant() ) { return; }
 		}
 		::RedrawWindow( Wnd(), NULL, NULL,
 			RDW_INVALIDATE |
@@ -2206,29 +2198,18 @@ namespace lsn {
 	 */
 	bool CMainWindow::LoadRom( const std::vector<uint8_t> &_vRom, const std::u16string &_s16Path ) {
 		StopThread();
-		if ( m_bnEmulator.LoadRom( _vRom, _s16Path, m_bnEmulator.Options().pmRegion ) ) {
-			UpdatedConsolePointer();
-
-			if ( m_bnEmulator.GetSystem()->GetRom() ) {
-				std::u16string u16Name = u"BeesNES: " + CUtilities::NoExtension( CUtilities::GetFileName( m_bnEmulator.GetSystem()->GetRom()->riInfo.s16RomName ) );
-				uint16_t ui16Mapper = m_bnEmulator.GetSystem()->GetRom()->riInfo.ui16Mapper;
-				if ( ui16Mapper == 4 ) {
-					u16Name += u" (Partial Support)";
-				}
-				else if ( !m_bnEmulator.GetSystem()->GetRom()->riInfo.bMapperSupported ) {
-					u16Name += u" (Bad Support)";
-				}
-				::SetWindowTextW( Wnd(), reinterpret_cast<LPCWSTR>(u16Name.c_str()) );
-				UpdateOpenRecent();
-			}
+		return FinishLoadRom( m_bnEmulator.LoadRom( _vRom, _s16Path, m_bnEmulator.Options().pmRegion ) );
+	}
 
-			m_bnEmulator.GetSystem()->ResetState( false );
-			m_cClock.SetStartingTick();
-			StartThread();
-			return true;
-		}
-		::SetWindowTextW( Wnd(), L"BeesNES" );
-		return false;
+	/**
+	 * Loads a ROM file given its path.  The file is memory-mapped and read in place.
+	 *
+	 * \param _s16Path The full path to the ROM.
+	 * \return Returns true if loading of the ROM succeeded.
+	 */
+	bool CMainWindow::LoadRom( const std::u16string &_s16Path ) {
+		StopThread();
+		return FinishLoadRom( m_bnEmulator.LoadRomFile( _s16Path, m_bnEmulator.Options().pmRegion ) );
 	}
 
 	/**
@@ -2245,13 +2226,7 @@ namespace lsn {
 			if ( zfFile.GatherArchiveFiles( vFiles ) ) {
 				for ( size_t I = 0; I < vFiles.size(); ++I ) {
 					if ( CUtilities::Replace( vFiles[I], u'/', u'\\' ) == _s16File ) {
-						std::vector<uint8_t> vExtracted;
-						zfFile.ExtractToMemory( vFiles[I], vExtracted );
-						std::u16string u16sPath = _s16ZipPath;
-						u16sPath += u"{";
-						u16sPath.append( vFiles[I].c_str() );
-						u16sPath += u"}";
-						return LoadRom( vExtracted, u16sPath );
+						return LoadZipRom( zfFile, _s16ZipPath, vFiles[I] );
 					}
 				}
 			}
@@ -2259,6 +2234,55 @@ namespace lsn {
 		return false;
 	}
 
+	/**
+	 * Loads a ROM file from an opened ZIP file.  The file is decompressed directly into the ROM buffers.
+	 * 
+	 * \param _zfFile The opened ZIP file.
+	 * \param _s16ZipPath The path to the ZIP file.
+	 * \param _s16File The name of the file inside the ZIP to load.
+	 * \return Returns true if the file was loaded.
+	 **/
+	bool CMainWindow::LoadZipRom( const CZipFile &_zfFile, const std::u16string &_s16ZipPath, const std::u16string &_s16File ) {
+		std::u16string u16sPath = _s16ZipPath;
+		u16sPath += u"{";
+		u16sPath.append( _s16File.c_str() );
+		u16sPath += u"}";
+		StopThread();
+		return FinishLoadRom( m_bnEmulator.LoadZipRom( _zfFile, _s16File, u16sPath, m_bnEmulator.Options().pmRegion ) );
+	}
+
+	/**
+	 * Updates the window after an attempt to load a ROM and restarts emulation if the ROM was loaded.
+	 * 
+	 * \param _bLoaded The result of the attempt to load the ROM.
+	 * \return Returns _bLoaded.
+	 **/
+	bool CMainWindow::FinishLoadRom( bool _bLoaded ) {
+		if ( _bLoaded ) {
+			UpdatedConsolePointer();
+
+			if ( m_bnEmulator.GetSystem()->GetRom() ) {
+				std::u16string u16Name = u"BeesNES: " + CUtilities::NoExtension( CUtilities::GetFileName( m_bnEmulator.GetSystem()->GetRom()->riInfo.s16RomName ) );
+				uint16_t ui16Mapper = m_bnEmulator.GetSystem()->GetRom()->riInfo.ui16Mapper;
+				if ( ui16Mapper == 4 ) {
+					u16Name += u" (Partial Support)";
+				}
+				else if ( !m_bnEmulator.GetSystem()->GetRom()->riInfo.bMapperSupported ) {
+					u16Name += u" (Bad Support)";
+				}
+				::SetWindowTextW( Wnd(), reinterpret_cast<LPCWSTR>(u16Name.c_str()) );
+				UpdateOpenRecent();
+			}
+
+			m_bnEmulator.GetSystem()->ResetState( false );
+			m_cClock.SetStartingTick();
+			StartThread();
+			return true;
+		}
+		::SetWindowTextW( Wnd(), L"BeesNES" );
+		return false;
+	}
+
 	/**
 	 * Call when changing the m_psbSystem pointer to hook everything (display client, input polling, etc.) back up to the new system.
 	 * 
@@ -490,6 +490,14 @@ namespace lsn {
 		 */
 		bool									LoadRom( const std::vector<uint8_t> &_vRom, const std::u16string &_s16Path );
 
+		/**
+		 * Loads a ROM file given its path.  The file is memory-mapped and read in place.
+		 *
+		 * \param _s16Path The full path to the ROM.
+		 * \return Returns true if loading of the ROM succeeded.
+		 */
+		bool									LoadRom( const std::u16string &_s16Path );
+
 		/**
 		 * Loads a ROM file given a path to a ZIP and a file name inside the ZIP.
 		 * 
@@ -499,6 +507,24 @@ namespace lsn {
 		 **/
 		bool									LoadZipRom( const std::u16string &_s16ZipPath, const std::u16string &_s16File );
 
+		/**
+		 * Loads a ROM file from an opened ZIP file.  The file is decompressed directly into the ROM buffers.
+		 * 
+		 * \param _zfFile The opened ZIP file.
+		 * \param _s16ZipPath The path to the ZIP file.
+		 * \param _s16File The name of the file inside the ZIP to load.
+		 * \return Returns true if the file was loaded.
+		 **/
+		bool									LoadZipRom( const CZipFile &_zfFile, const std::u16string &_s16ZipPath, const std::u16string &_s16File );
+
+		/**
+		 * Updates the window after an attempt to load a ROM and restarts emulation if the ROM was loaded.
+		 * 
+		 * \param _bLoaded The result of the attempt to load the ROM.
+		 * \return Returns _bLoaded.
+		 **/
+		bool									FinishLoadRom( bool _bLoaded );
+
 		/**
 		 * Call when changing the m_psbSystem pointer to hook everything (display client, input polling, etc.) back up to the new system.
 		 * 
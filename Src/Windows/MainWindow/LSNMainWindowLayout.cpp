@@ -150,6 +150,7 @@ namespace lsn {
 		{ FALSE,		LSN_MWMI_VIDEO_FILTER_PALN_LSPIRO,					TRUE,		FALSE,		TRUE,		LSN_LSTR( LSN_VIDEO_FILTER_PALN_L_SPIRO ) },
 		{ TRUE,			0,													FALSE,		FALSE,		TRUE,		nullptr },
 		{ FALSE,		LSN_MWMI_VIDEO_FILTER_NTSC_CRT_FULL,				TRUE,		FALSE,		TRUE,		LSN_LSTR( LSN_VIDEO_FILTER_NTSC_CRT_FULL ) },
+		{ FALSE,		LSN_MWMI_VIDEO_FILTER_NTSC_CRT_FAST,				TRUE,		FALSE,		TRUE,		LSN_LSTR( LSN_VIDEO_FILTER_NTSC_CRT_FAST ) },
 		{ FALSE,		LSN_MWMI_VIDEO_FILTER_PAL_CRT_FULL,					TRUE,		FALSE,		TRUE,		LSN_LSTR( LSN_VIDEO_FILTER_PAL_CRT_FULL ) },
 		{ TRUE,			0,													FALSE,		FALSE,		TRUE,		nullptr },
 		{ FALSE,		LSN_MWMI_VIDEO_FILTER_AUTO_CRT_FULL,				TRUE,		FALSE,		TRUE,		LSN_LSTR( LSN_VIDEO_FILTER_AUTO_CRT_FULL ) },
@@ -107,6 +107,7 @@ namespace lsn {
 			LSN_MWMI_VIDEO_FILTER_PALM_LSPIRO,
 			LSN_MWMI_VIDEO_FILTER_PALN_LSPIRO,
 			LSN_MWMI_VIDEO_FILTER_NTSC_CRT_FULL,
+			LSN_MWMI_VIDEO_FILTER_NTSC_CRT_FAST,
 			LSN_MWMI_VIDEO_FILTER_PAL_CRT_FULL,
 			LSN_MWMI_VIDEO_FILTER_AUTO_CRT_FULL,
 			LSN_MWMI_VIDEO_FILTER_AUTO_LSPIRO,
@@ -191,11 +191,14 @@ namespace lsn {
 
 					try {
 						for ( size_t I = 0; I < m_vPatchInfo.size(); ++I ) {
-							m_vPatchInfo[I].ui32PatchCrc = CCrc::GetCrc( m_vPatchInfo[I].vLoadedPatchFile.data(), m_vPatchInfo[I].vLoadedPatchFile.size() );
-							if ( I < sTxtStart ) {
-								if ( m_vPatchInfo[I].vLoadedPatchFile.size() >= 4 ) {
-									m_vPatchInfo[I].ui32PatchCrcMinus4 = CCrc::GetCrc( m_vPatchInfo[I].vLoadedPatchFile.data(), m_vPatchInfo[I].vLoadedPatchFile.size() - 4 );
-								}
+							const std::vector<uint8_t> & vPatch = m_vPatchInfo[I].vLoadedPatchFile;
+							if ( I < sTxtStart && vPatch.size() >= 4 ) {
+								// The full CRC continues from the CRC of all but the last 4 bytes rather than rescanning the file.
+								m_vPatchInfo[I].ui32PatchCrcMinus4 = CCrc::GetCrc( vPatch.data(), vPatch.size() - 4 );
+								m_vPatchInfo[I].ui32PatchCrc = CCrc::Update( m_vPatchInfo[I].ui32PatchCrcMinus4, vPatch.data() + vPatch.size() - 4, 4 );
+							}
+							else {
+								m_vPatchInfo[I].ui32PatchCrc = CCrc::GetCrc( vPatch.data(), vPatch.size() );
 							}
 							if ( I >= sBpsStart && I < sTxtStart ) {
 								if ( m_vPatchInfo[I].vLoadedPatchFile.size() >= 12 ) {
@@ -631,7 +634,7 @@ namespace lsn {
 
 			auto pwPathEdit = FindChild( CPatchWindowLayout::LSN_PWI_INFO_CRC_LABEL );
 			if ( pwPathEdit ) {
-				m_ui32FullCrc = CCrc::GetCrc( m_vPatchRomFile.data(), m_vPatchRomFile.size() );
+				m_ui32FullCrc = rRom.riInfo.ui32FullCrc;
 				try {
 					pwPathEdit->SetTextW( std::format( L"Full CRC32:\t\t{:08X}", m_ui32FullCrc ).c_str() );
 				} catch ( ... ) {}
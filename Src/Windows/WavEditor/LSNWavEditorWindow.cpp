@@ -20,6 +20,7 @@
 #include <TreeListView/LSWTreeListView.h>
 
 #include <commdlg.h>
+#include <cwchar>
 #include <filesystem>
 
 #include "../../../resource.h"
@@ -1145,7 +1146,22 @@ namespace lsn {
 			if ( _pweEditor ) {
 				_pweEditor->SetParms( vPerFile, oOutput );
 				std::wstring wsError;
-				if ( !_pweEditor->Execute( wsError ) ) {
+				// Process the files in parallel, keeping the estimated working set within half of the free physical RAM.
+				CWavEditor::LSN_EXECUTE_PARMS epParms;
+				epParms.stThreads = 0;
+				MEMORYSTATUSEX msexStatus = { sizeof( MEMORYSTATUSEX ) };
+				if ( ::GlobalMemoryStatusEx( &msexStatus ) ) {
+					epParms.ui64MemoryBudget = msexStatus.ullAvailPhys / 2;
+				}
+				LSN_EXECUTE_PROGRESS epProgress;
+				epProgress.pwewWindow = this;
+				epProgress.wsTitle = GetTextW();
+				epProgress.dwThreadId = ::GetCurrentThreadId();
+				epParms.pfProgress = ExecuteProgress;
+				epParms.pvProgressParm = &epProgress;
+				bool bExecuted = _pweEditor->Execute( wsError, epParms );
+				SetTextW( epProgress.wsTitle.c_str() );
+				if ( !bExecuted ) {
 					lsw::CBase::MessageBoxError( Wnd(), wsError.c_str(), LSN_LSTR( LSN_ERROR ) );
 					return false;
 				}
@@ -1155,6 +1171,30 @@ namespace lsn {
 		catch ( ... ) { return false; }
 	}
 
+	/**
+	 * Receives progress from the CWavEditor workers and shows it in the window title.  Only the window's own thread touches the
+	 *	window; it runs jobs as well, so the title still updates between each of its jobs.
+	 * 
+	 * \param _pvParm Pointer to the LSN_EXECUTE_PROGRESS.
+	 * \param _stJob The index of the job.
+	 * \param _stTotal The total number of jobs.
+	 * \param _jsState The new state of the job.
+	 * \param _dProgress The progress of the job from 0 to 1.
+	 **/
+	void LSN_STDCALL CWavEditorWindow::ExecuteProgress( void * _pvParm, size_t /*_stJob*/, size_t _stTotal, CWavEditor::LSN_JOB_STATE _jsState, double /*_dProgress*/ ) {
+		LSN_EXECUTE_PROGRESS * pepProgress = static_cast<LSN_EXECUTE_PROGRESS *>(_pvParm);
+		size_t stFinished = pepProgress->aFinished.load();
+		if ( _jsState == CWavEditor::LSN_JS_DONE || _jsState == CWavEditor::LSN_JS_FAILED ) {
+			stFinished = ++pepProgress->aFinished;
+		}
+		// Setting the text from a worker would SendMessage() to a thread that is blocked waiting on that worker.
+		if ( ::GetCurrentThreadId() != pepProgress->dwThreadId ) { return; }
+
+		wchar_t szProgress[64];
+		std::swprintf( szProgress, std::size( szProgress ), L" (%zu/%zu)", stFinished, _stTotal );
+		pepProgress->pwewWindow->SetTextW( (pepProgress->wsTitle + szProgress).c_str() );
+	}
+
 	/**
 	 * Saves the project.
 	 * 
@@ -22,6 +22,8 @@
 #include <Images/LSWBitmap.h>
 #include <MainWindow/LSWMainWindow.h>
 
+#include <atomic>
+
 using namespace lsw;
 
 namespace lsn {
@@ -243,6 +245,16 @@ namespace lsn {
 
 
 	public :
+		// == Types.
+		/** Progress state shared with the CWavEditor workers during Execute(). */
+		struct LSN_EXECUTE_PROGRESS {
+			CWavEditorWindow *								pwewWindow = nullptr;							/**< The window whose title shows the progress. */
+			std::wstring									wsTitle;										/**< The original window title. */
+			DWORD											dwThreadId = 0;									/**< The window's thread. */
+			std::atomic<size_t>								aFinished = 0;									/**< The number of finished jobs. */
+		};
+
+
 		// == Members.
 		/** The WAV Editor object. */
 		CWavEditor											m_weEditor;
@@ -293,6 +305,18 @@ namespace lsn {
 		 **/
 		bool												Save( LSN_WAV_EDITOR_WINDOW_OPTIONS &_wewoWindowState, CWavEditor * _pweEditor );
 
+		/**
+		 * Receives progress from the CWavEditor workers and shows it in the window title.  Only the window's own thread touches the
+		 *	window; it runs jobs as well, so the title still updates between each of its jobs.
+		 * 
+		 * \param _pvParm Pointer to the LSN_EXECUTE_PROGRESS.
+		 * \param _stJob The index of the job.
+		 * \param _stTotal The total number of jobs.
+		 * \param _jsState The new state of the job.
+		 * \param _dProgress The progress of the job from 0 to 1.
+		 **/
+		static void LSN_STDCALL								ExecuteProgress( void * _pvParm, size_t _stJob, size_t _stTotal, CWavEditor::LSN_JOB_STATE _jsState, double _dProgress );
+
 		/**
 		 * Saves the project.
 		 * 
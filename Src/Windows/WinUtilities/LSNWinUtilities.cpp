@@ -152,6 +152,7 @@ namespace lsn {
 			{ LSN_LSTR( LSN_AUDIO_OPTIONS_START_SAMPLE ),				CWavFile::LSN_SC_START_AT_SAMPLE,					},
 			{ LSN_LSTR( LSN_AUDIO_OPTIONS_NON_SILENT ),					CWavFile::LSN_SC_FIRST_NON_ZERO,					},
 			{ LSN_LSTR( LSN_AUDIO_OPTIONS_SILENCE_FOR ),				CWavFile::LSN_SC_ZERO_FOR_DURATION,					},
+			{ LSN_LSTR( LSN_AUDIO_OPTIONS_EXPRESSION ),					CWavFile::LSN_SC_EXPRESSION,						},
 		};
 		return FillComboBox( _pwComboBox, ceEnries, std::size( ceEnries ), _lpDefaultSelect, CWavFile::LSN_SC_NONE );
 	}
@@ -170,6 +171,7 @@ namespace lsn {
 			{ LSN_LSTR( LSN_AUDIO_OPTIONS_END_SAMPLE ),					CWavFile::LSN_EC_END_AT_SAMPLE,						},
 			{ LSN_LSTR( LSN_AUDIO_OPTIONS_SILENCE_FOR ),				CWavFile::LSN_EC_ZERO_FOR_DURATION,					},
 			{ LSN_LSTR( LSN_AUDIO_OPTIONS_DURATION ),					CWavFile::LSN_EC_DURATION,							},
+			{ LSN_LSTR( LSN_AUDIO_OPTIONS_EXPRESSION ),					CWavFile::LSN_EC_EXPRESSION,						},
 		};
 		return FillComboBox( _pwComboBox, ceEnries, std::size( ceEnries ), _lpDefaultSelect, CWavFile::LSN_SC_NONE );
 	}
@@ -0,0 +1,388 @@
+// ROM Database Generator.cpp : Sorts the ROM database table and optionally merges a NES 2.0 XML database dump into it.
+//
+// Usage: "ROM Database Generator" <LSNDatabaseTable.inl> [nes20db.xml] [output]
+//	The table is read (it may also be an older LSNDatabase.cpp), entries from the dump whose PRG CRC is not already in the table are added,
+//	everything is sorted by CRC (then MD5), and the result is written back to the table (or to the output path if given).
+//	Hand-written entries always take priority over the dump.  Among duplicate entries the last one in the file wins.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+/** An entry in the table. */
+struct LSN_TABLE_ENTRY {
+	std::vector<std::string>	vComments;				// Comment lines preceding the entry, without the leading "//".
+	std::vector<std::string>	vFields;				// The designated initializers, such as ".pmRegion = LSN_PM_PAL".
+	std::string					sTrailing;				// A comment following the entry, without the leading "//".
+	uint32_t					ui32Crc = 0;			// The value of .ui32Crc.
+	std::string					sMd5;					// The 16 bytes of .mhMd5, or empty.
+	bool						bDisabled = false;		// Set if the entry is commented out.
+};
+
+
+/**
+ * Removes whitespace from both ends of a string.
+ *
+ * \param _sString The string to trim.
+ * \return Returns the trimmed string.
+ */
+std::string		Trim( const std::string &_sString ) {
+	size_t sStart = _sString.find_first_not_of( " \t\r\n" );
+	if ( sStart == std::string::npos ) { return std::string(); }
+	size_t sEnd = _sString.find_last_not_of( " \t\r\n" );
+	return _sString.substr( sStart, sEnd - sStart + 1 );
+}
+
+/**
+ * Splits the inside of a designated-initializer list at top-level commas.
+ *
+ * \param _sBody The text between the outer braces.
+ * \return Returns the trimmed, non-empty fields.
+ */
+std::vector<std::string>	SplitFields( const std::string &_sBody ) {
+	std::vector<std::string> vRet;
+	int iDepth = 0;
+	std::string sThis;
+	for ( char cChar : _sBody ) {
+		if ( cChar == '{' ) { ++iDepth; }
+		else if ( cChar == '}' ) { --iDepth; }
+		if ( cChar == ',' && iDepth == 0 ) {
+			sThis = Trim( sThis );
+			if ( sThis.size() ) { vRet.push_back( sThis ); }
+			sThis.clear();
+			continue;
+		}
+		sThis.push_back( cChar );
+	}
+	sThis = Trim( sThis );
+	if ( sThis.size() ) { vRet.push_back( sThis ); }
+	return vRet;
+}
+
+/**
+ * Finds the value of a field.
+ *
+ * \param _vFields The fields to search.
+ * \param _pcName The field name, such as ".ui32Crc".
+ * \return Returns the text after the "=", or an empty string.
+ */
+std::string		FieldValue( const std::vector<std::string> &_vFields, const char * _pcName ) {
+	std::string sName = _pcName;
+	for ( const auto & sField : _vFields ) {
+		if ( sField.compare( 0, sName.size(), sName ) == 0 ) {
+			std::string sRest = Trim( sField.substr( sName.size() ) );
+			if ( sRest.size() && sRest[0] == '=' ) { return Trim( sRest.substr( 1 ) ); }
+		}
+	}
+	return std::string();
+}
+
+/**
+ * Converts the text of an MD5 initializer (such as "{ { 0x9E, 0x10, ... } }") to bytes.
+ *
+ * \param _sText The initializer text.
+ * \return Returns the 16 bytes of the hash, or an empty string if _sText is empty.
+ */
+std::string		ParseMd5( const std::string &_sText ) {
+	std::string sRet;
+	const char * pcText = _sText.c_str();
+	while ( (*pcText) && sRet.size() < 16 ) {
+		if ( std::isdigit( static_cast<unsigned char>(*pcText) ) ) {
+			char * pcEnd;
+			sRet.push_back( char( std::strtoul( pcText, &pcEnd, 0 ) ) );
+			pcText = pcEnd;
+		}
+		else { ++pcText; }
+	}
+	if ( sRet.size() ) { sRet.resize( 16, '\0' ); }
+	return sRet;
+}
+
+/**
+ * Parses a line holding a single entry.
+ *
+ * \param _sLine The line, with any leading comment marker already removed.
+ * \param _teEntry Holds the fields, trailing comment, CRC, and MD5 of the entry.
+ * \return Returns true if the line holds an entry.
+ */
+bool			ParseEntry( const std::string &_sLine, LSN_TABLE_ENTRY &_teEntry ) {
+	if ( _sLine.compare( 0, 1, "{" ) != 0 || _sLine.find( ".ui32Crc" ) == std::string::npos ) { return false; }
+	int iDepth = 0;
+	size_t sClose = std::string::npos;
+	for ( size_t I = 0; I < _sLine.size(); ++I ) {
+		if ( _sLine[I] == '{' ) { ++iDepth; }
+		else if ( _sLine[I] == '}' && --iDepth == 0 ) {
+			sClose = I;
+			break;
+		}
+	}
+	if ( sClose == std::string::npos ) { return false; }
+	_teEntry.vFields = SplitFields( _sLine.substr( 1, sClose - 1 ) );
+	std::string sCrc = FieldValue( _teEntry.vFields, ".ui32Crc" );
+	if ( sCrc.empty() ) { return false; }
+	_teEntry.ui32Crc = uint32_t( std::strtoul( sCrc.c_str(), nullptr, 0 ) );
+	_teEntry.sMd5 = ParseMd5( FieldValue( _teEntry.vFields, ".mhMd5" ) );
+
+	size_t sComment = _sLine.find( "//", sClose );
+	if ( sComment != std::string::npos ) {
+		_teEntry.sTrailing = Trim( _sLine.substr( sComment + 2 ) );
+	}
+	return true;
+}
+
+/**
+ * Reads the entries of an existing table.
+ *
+ * \param _pcPath The table file.
+ * \param _vEntries Holds the entries.
+ * \return Returns true if the file was read.
+ */
+bool			ReadTable( const char * _pcPath, std::vector<LSN_TABLE_ENTRY> &_vEntries ) {
+	std::ifstream ifFile( _pcPath );
+	if ( !ifFile ) { return false; }
+	std::vector<std::string> vPending;
+	bool bInBlock = false;
+	std::string sLine;
+	while ( std::getline( ifFile, sLine ) ) {
+		std::string sText = Trim( sLine );
+		bool bCommented = bInBlock;
+		if ( sText.compare( 0, 2, "/*" ) == 0 ) {
+			sText = Trim( sText.substr( 2 ) );
+			bCommented = bInBlock = true;
+		}
+		if ( bInBlock && sText.size() >= 2 && sText.compare( sText.size() - 2, 2, "*/" ) == 0 ) {
+			sText = Trim( sText.substr( 0, sText.size() - 2 ) );
+			bInBlock = false;
+		}
+
+		bool bLineComment = sText.compare( 0, 2, "//" ) == 0;
+		std::string sBody = bLineComment ? Trim( sText.substr( 2 ) ) : sText;
+
+		LSN_TABLE_ENTRY teEntry;
+		if ( ParseEntry( sBody, teEntry ) ) {
+			teEntry.bDisabled = bCommented || bLineComment;
+			teEntry.vComments = vPending;
+			_vEntries.push_back( teEntry );
+			vPending.clear();
+		}
+		else if ( bLineComment && sBody.compare( 0, 3, "===" ) != 0 && sBody.compare( 0, 3, "== " ) != 0 ) {
+			vPending.push_back( sBody );
+		}
+		else {
+			// Blank lines, section banners, and code end a comment run.
+			vPending.clear();
+		}
+	}
+	return true;
+}
+
+/**
+ * Gets the value of an attribute in an XML tag.
+ *
+ * \param _sTag The tag text.
+ * \param _pcName The attribute name.
+ * \return Returns the attribute value or an empty string.
+ */
+std::string		Attribute( const std::string &_sTag, const char * _pcName ) {
+	std::string sFind = std::string( " " ) + _pcName + "=\"";
+	size_t sStart = _sTag.find( sFind );
+	if ( sStart == std::string::npos ) { return std::string(); }
+	sStart += sFind.size();
+	size_t sEnd = _sTag.find( '"', sStart );
+	if ( sEnd == std::string::npos ) { return std::string(); }
+	return _sTag.substr( sStart, sEnd - sStart );
+}
+
+/**
+ * Gets the text of the first tag with the given name inside a block.
+ *
+ * \param _sBlock The block to search.
+ * \param _pcName The tag name.
+ * \return Returns the tag text (from "<" to ">") or an empty string.
+ */
+std::string		Tag( const std::string &_sBlock, const char * _pcName ) {
+	std::string sFind = std::string( "<" ) + _pcName + " ";
+	size_t sStart = _sBlock.find( sFind );
+	if ( sStart == std::string::npos ) { return std::string(); }
+	size_t sEnd = _sBlock.find( '>', sStart );
+	if ( sEnd == std::string::npos ) { return std::string(); }
+	return _sBlock.substr( sStart, sEnd - sStart + 1 );
+}
+
+/**
+ * Reads the games of a NES 2.0 XML database (nes20db.xml).  Games that share a PRG CRC but disagree on any field are dropped.
+ *
+ * \param _pcPath The XML file.
+ * \param _vEntries Holds the entries, one per PRG CRC.
+ * \return Returns true if the file was read.
+ */
+bool			ReadNes20Db( const char * _pcPath, std::vector<LSN_TABLE_ENTRY> &_vEntries ) {
+	std::ifstream ifFile( _pcPath, std::ios::binary );
+	if ( !ifFile ) { return false; }
+	std::stringstream ssStream;
+	ssStream << ifFile.rdbuf();
+	std::string sXml = ssStream.str();
+
+	std::map<uint32_t, LSN_TABLE_ENTRY> mGames;
+	std::map<uint32_t, bool> mAmbiguous;
+	for ( size_t sPos = sXml.find( "<game>" ); sPos != std::string::npos; sPos = sXml.find( "<game>", sPos ) ) {
+		size_t sEnd = sXml.find( "</game>", sPos );
+		if ( sEnd == std::string::npos ) { break; }
+		std::string sGame = sXml.substr( sPos, sEnd - sPos );
+		sPos = sEnd;
+
+		std::string sPrg = Tag( sGame, "prgrom" );
+		std::string sCrc = Attribute( sPrg, "crc32" );
+		if ( sCrc.empty() ) { continue; }
+
+		LSN_TABLE_ENTRY teEntry;
+		teEntry.ui32Crc = uint32_t( std::strtoul( sCrc.c_str(), nullptr, 16 ) );
+		char szBuffer[64];
+		std::snprintf( szBuffer, sizeof( szBuffer ), ".ui32Crc = 0x%.8X", teEntry.ui32Crc );
+		teEntry.vFields.push_back( szBuffer );
+
+		std::string sPcb = Tag( sGame, "pcb" );
+		std::string sMirror = Attribute( sPcb, "mirroring" );
+		if ( sMirror == "H" ) { teEntry.vFields.push_back( ".mmMirrorOverride = LSN_MM_HORIZONTAL" ); }
+		else if ( sMirror == "V" ) { teEntry.vFields.push_back( ".mmMirrorOverride = LSN_MM_VERTICAL" ); }
+		else if ( sMirror == "4" ) { teEntry.vFields.push_back( ".mmMirrorOverride = LSN_MM_4_SCREENS" ); }
+
+		std::string sRegion = Attribute( Tag( sGame, "console" ), "region" );
+		if ( sRegion == "0" ) { teEntry.vFields.push_back( ".pmRegion = LSN_PM_NTSC" ); }
+		else if ( sRegion == "1" ) { teEntry.vFields.push_back( ".pmRegion = LSN_PM_PAL" ); }
+		else if ( sRegion == "3" ) { teEntry.vFields.push_back( ".pmRegion = LSN_PM_DENDY" ); }
+
+		std::string sMapper = Attribute( sPcb, "mapper" );
+		if ( sMapper.size() ) { teEntry.vFields.push_back( ".ui16Mapper = " + sMapper ); }
+		std::string sSubMapper = Attribute( sPcb, "submapper" );
+		if ( sSubMapper.size() ) { teEntry.vFields.push_back( ".ui16SubMapper = " + sSubMapper ); }
+
+		size_t sComment = sGame.find( "<!--" );
+		if ( sComment != std::string::npos ) {
+			size_t sCommentEnd = sGame.find( "-->", sComment );
+			std::string sName = Trim( sGame.substr( sComment + 4, sCommentEnd - sComment - 4 ) );
+			// Names are file paths; keep only the file name without the extension.
+			size_t sSlash = sName.find_last_of( "\\/" );
+			if ( sSlash != std::string::npos ) { sName = sName.substr( sSlash + 1 ); }
+			if ( sName.size() > 4 && sName.compare( sName.size() - 4, 4, ".nes" ) == 0 ) { sName.resize( sName.size() - 4 ); }
+			teEntry.vComments.push_back( sName );
+		}
+
+		auto aExisting = mGames.find( teEntry.ui32Crc );
+		if ( aExisting == mGames.end() ) {
+			mGames.insert( std::make_pair( teEntry.ui32Crc, teEntry ) );
+		}
+		else if ( aExisting->second.vFields != teEntry.vFields ) {
+			mAmbiguous[teEntry.ui32Crc] = true;
+		}
+	}
+
+	for ( auto & aGame : mGames ) {
+		if ( mAmbiguous.find( aGame.first ) != mAmbiguous.end() ) { continue; }
+		_vEntries.push_back( aGame.second );
+	}
+	std::cerr << mGames.size() << " PRG CRCs in the dump; " << mAmbiguous.size() << " dropped as ambiguous." << std::endl;
+	return true;
+}
+
+/**
+ * Writes the table.
+ *
+ * \param _pcPath The file to write.
+ * \param _vEntries The sorted entries.
+ * \return Returns true if the file was written.
+ */
+bool			WriteTable( const char * _pcPath, const std::vector<LSN_TABLE_ENTRY> &_vEntries ) {
+	std::ofstream ofFile( _pcPath, std::ios::binary );
+	if ( !ofFile ) { return false; }
+	ofFile << "// Generated by Tools/ROM Database Generator.  Entries must remain sorted by CRC (then MD5); a static_assert in LSNDatabase.cpp checks this.\n";
+	ofFile << "// Entries may be edited or added by hand; run the generator afterwards to re-sort the table.\n\n";
+	for ( const auto & teEntry : _vEntries ) {
+		for ( const auto & sComment : teEntry.vComments ) {
+			ofFile << "\t\t// " << sComment << "\n";
+		}
+		ofFile << (teEntry.bDisabled ? "\t\t//{ " : "\t\t{ ");
+		for ( size_t I = 0; I < teEntry.vFields.size(); ++I ) {
+			ofFile << teEntry.vFields[I] << (I + 1 < teEntry.vFields.size() ? ", " : " ");
+		}
+		ofFile << "},";
+		if ( teEntry.sTrailing.size() ) { ofFile << "\t// " << teEntry.sTrailing; }
+		ofFile << "\n";
+	}
+	return bool( ofFile );
+}
+
+
+int main( int _iArgC, char * _pcArgV[] ) {
+	if ( _iArgC < 2 ) {
+		std::cerr << "Usage: \"ROM Database Generator\" <LSNDatabaseTable.inl> [nes20db.xml] [output]" << std::endl;
+		return 1;
+	}
+
+	std::vector<LSN_TABLE_ENTRY> vEntries;
+	if ( !ReadTable( _pcArgV[1], vEntries ) ) {
+		std::cerr << "Failed to read " << _pcArgV[1] << std::endl;
+		return 1;
+	}
+
+	// Among duplicates, the last entry wins.
+	std::stable_sort( vEntries.begin(), vEntries.end(), []( const LSN_TABLE_ENTRY &_teLeft, const LSN_TABLE_ENTRY &_teRight ) {
+		if ( _teLeft.ui32Crc != _teRight.ui32Crc ) { return _teLeft.ui32Crc < _teRight.ui32Crc; }
+		return _teLeft.sMd5 < _teRight.sMd5;
+	} );
+	std::vector<LSN_TABLE_ENTRY> vSorted;
+	for ( size_t I = 0; I < vEntries.size(); ++I ) {
+		if ( !vEntries[I].bDisabled ) {
+			bool bSuperseded = false;
+			for ( size_t J = I + 1; J < vEntries.size() && vEntries[J].ui32Crc == vEntries[I].ui32Crc; ++J ) {
+				if ( !vEntries[J].bDisabled && vEntries[J].sMd5 == vEntries[I].sMd5 ) {
+					bSuperseded = true;
+					break;
+				}
+			}
+			if ( bSuperseded ) {
+				std::fprintf( stderr, "Duplicate entry 0x%.8X; keeping the last one.\r\n", vEntries[I].ui32Crc );
+				continue;
+			}
+		}
+		vSorted.push_back( vEntries[I] );
+	}
+
+	if ( _iArgC >= 3 ) {
+		std::vector<LSN_TABLE_ENTRY> vDump;
+		if ( !ReadNes20Db( _pcArgV[2], vDump ) ) {
+			std::cerr << "Failed to read " << _pcArgV[2] << std::endl;
+			return 1;
+		}
+		size_t sAdded = 0;
+		for ( auto & teEntry : vDump ) {
+			auto aFound = std::find_if( vSorted.begin(), vSorted.end(), [&]( const LSN_TABLE_ENTRY &_teThis ) {
+				return !_teThis.bDisabled && _teThis.ui32Crc == teEntry.ui32Crc;
+			} );
+			if ( aFound != vSorted.end() ) { continue; }
+			vSorted.push_back( teEntry );
+			++sAdded;
+		}
+		std::stable_sort( vSorted.begin(), vSorted.end(), []( const LSN_TABLE_ENTRY &_teLeft, const LSN_TABLE_ENTRY &_teRight ) {
+			if ( _teLeft.ui32Crc != _teRight.ui32Crc ) { return _teLeft.ui32Crc < _teRight.ui32Crc; }
+			return _teLeft.sMd5 < _teRight.sMd5;
+		} );
+		std::cerr << sAdded << " entries added from the dump." << std::endl;
+	}
+
+	const char * pcOut = _iArgC >= 4 ? _pcArgV[3] : _pcArgV[1];
+	if ( !WriteTable( pcOut, vSorted ) ) {
+		std::cerr << "Failed to write " << pcOut << std::endl;
+		return 1;
+	}
+	return 0;
+}